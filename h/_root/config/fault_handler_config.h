@@ -0,0 +1,325 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fault_handler_config.h
+ * ***********************************************************************************************
+ * File:   fault_handler_config.h
+ * Author: M91406
+ * 
+ * Summary:
+ * User configuration file for the generic fault handler
+ * 
+ * Description:
+ * Users can select how fault objects listed in fault_object_list[] are evaluated by the 
+ * fault handler and adjust the resources reserved for the fault evaluation engine.
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***********************************************************************************************/
+
+#ifndef _ROOT_FAULT_HANDLER_CONFIGURATION_H_
+#define	_ROOT_FAULT_HANDLER_CONFIGURATION_H_
+
+/* ***********************************************************************************************
+ * DEFAULT INCLUDES
+ * ***********************************************************************************************/
+
+#include <stdint.h>
+#include "mcal/mcal.h" // required to include p33SMPS_devices.h
+#include "mcal/config/devcfg_oscillator.h"
+
+/*!USE_FAULT_ENGINE
+ * ***********************************************************************************************
+ * Description:
+ * By default exec_FaultCheckAll() walks through the list of fault object pointers and checks 
+ * each fault object individually. The fault condition check branches on the compare type 
+ * and operates on the bit-fields of each fault object.
+ * 
+ * When USE_FAULT_ENGINE is enabled, all enabled fault objects are compiled into a 
+ * struct-of-arrays data structure (monitored value pointers, bit masks, trip levels, reset 
+ * levels, counter thresholds and counters in contiguous arrays). The fault condition of every 
+ * object is evaluated by the same branch-free sequence of comparisons and the active and status 
+ * flags of all objects are maintained as packed 16-bit words. Branches are only taken when a 
+ * fault status changes. Hence, the execution time grows linearly with a small effort per object 
+ * and fault flags of up to 16 objects can be tested with one instruction.
+ * 
+ * The fault engine is compiled automatically with the first fault check after reset. When 
+ * fault objects are enabled/disabled or fault levels are modified at runtime, the engine 
+ * has to be recompiled by calling fault_EngineCompile().
+ * 
+ * Please note:
+ * In fault engine mode, the fltactive and fltstat flag bits of fault objects are updated when 
+ * they change. The fault counters are maintained by the fault engine only.
+ * 
+ * Settings:
+ * FAULT_ENGINE_OBJECTS_MAX: maximum number of enabled fault objects managed by the fault engine
+ * 
+ * See also:
+ * fault_EngineCompile, fault_engine
+ * ***********************************************************************************************/
+
+#define USE_FAULT_ENGINE                    1       // Enable/Disable fault evaluation by the compiled fault engine
+
+#if (USE_FAULT_ENGINE == 1)
+  #define FAULT_ENGINE_OBJECTS_MAX          48      // Maximum number of fault objects compiled into the fault engine
+  #define FAULT_ENGINE_WORDS                ((FAULT_ENGINE_OBJECTS_MAX + 15) >> 4) // Number of packed flag words
+#endif
+
+/*!FAULT_SCAN_MODE
+ * ***********************************************************************************************
+ * Description:
+ * In FAULT_SCAN_FULL mode all fault objects are checked with every call of exec_FaultCheckAll().
+ * 
+ * In FAULT_SCAN_BUDGETED mode each fault object is assigned to a scan class by its scan_class
+ * setting:
+ * 
+ *      - FAULT_SCAN_CLASS_FAST: fault objects monitoring fast changing conditions (e.g. over 
+ *        current, CPU load overrun) are checked with every scheduler tick
+ *      - FAULT_SCAN_CLASS_SLOW: fault objects monitoring slow changing conditions (e.g. over 
+ *        temperature, input under voltage lock-out) are checked incrementally. With every 
+ *        scheduler tick, slow class objects are checked one after another until the time 
+ *        budget FAULT_SCAN_SLOW_BUDGET_TIME has been used up (at least one object per tick).
+ * 
+ * The number of scheduler ticks required to check all objects of a class (scan latency) is 
+ * reported in fault_scan[]. The fault response time of a slow class object is its scan latency 
+ * multiplied by its trip counter threshold.
+ * 
+ * Please note:
+ * FAULT_SCAN_BUDGETED mode requires USE_FAULT_ENGINE to be enabled.
+ * 
+ * See also:
+ * exec_FaultCheckSequential, fault_scan, FAULT_SCAN_CLASS_e
+ * ***********************************************************************************************/
+
+#define FAULT_SCAN_FULL                     0       // All fault objects are checked every scheduler tick
+#define FAULT_SCAN_BUDGETED                 1       // SLOW class fault objects are checked incrementally under a time budget
+
+#define FAULT_SCAN_MODE                     FAULT_SCAN_BUDGETED // Selected fault scan mode
+
+#if (FAULT_SCAN_MODE == FAULT_SCAN_BUDGETED)
+
+  #if (USE_FAULT_ENGINE != 1)
+    #error === budgeted fault scan mode requires the fault engine (USE_FAULT_ENGINE = 1) ===
+  #endif
+
+  #define FAULT_SCAN_SLOW_BUDGET_TIME       (float)(2.0e-6)     // Time budget for SLOW scan class objects per tick in [sec]
+  #define FAULT_SCAN_SLOW_BUDGET            (uint16_t)((float)system_frequencies.fcy * (float)FAULT_SCAN_SLOW_BUDGET_TIME) // Time budget in timer ticks (converted by fault_EngineCompile())
+
+#endif
+
+/*!FAULT_EVENT_INDEX_MAX
+ * ***********************************************************************************************
+ * Description:
+ * Fault objects with trigger setting FAULT_TRIGGER_EVENT are not polled by the fault handler. 
+ * They are only checked after a fault event has been raised by an interrupt service routine 
+ * (e.g. comparator, PWM fault or ADC threshold interrupt) by calling FAULT_EVENT_RAISE(index) 
+ * with the index of the fault object in fault_object_list[], and as long as their fault 
+ * condition is active or their fault status is set.
+ * 
+ * Raised events are collected in a pending-fault bitmap. FAULT_EVENT_INDEX_MAX determines 
+ * the highest fault object list index + 1 which can be used by event-triggered fault objects.
+ * 
+ * See also:
+ * FAULT_EVENT_RAISE, fault_pending, FAULT_TRIGGER_e
+ * ***********************************************************************************************/
+
+#define FAULT_EVENT_INDEX_MAX               48      // Number of fault object list indices covered by the pending-fault bitmap
+#define FAULT_EVENT_WORDS                   ((FAULT_EVENT_INDEX_MAX + 15) >> 4) // Number of pending-fault bitmap words
+
+/*!USE_FAULT_GROUPS
+ * ***********************************************************************************************
+ * Description:
+ * Fault objects are assigned to fault groups by their group setting (e.g. one group per power 
+ * converter instance, one for the task manager flow control). With each change of the fault 
+ * condition or fault status of a fault object, the packed active and status flag words and the 
+ * fault class summary of its group are updated. The status of a group is therefore available 
+ * with one word compare (see FAULT_GROUP_HEALTHY()) and the global fault class summary 
+ * fault_group_summary replaces the scan of all fault status flags after each fault check. 
+ * When recovering from the fault mode, fault release handlers are only called for fault 
+ * objects which have tripped since the previous recovery.
+ * 
+ * Groups are set up by fault_GroupsBuild() with the first fault check after reset and each 
+ * time the fault engine is compiled. Each group holds up to FAULT_GROUP_MEMBERS_MAX members.
+ * 
+ * Please note:
+ * Fault groups are declared by the user in fault_group_index_e and fault_group[] 
+ * (see task_FaultHandler.c).
+ * 
+ * See also:
+ * FAULT_GROUP_t, fault_GroupsBuild, FAULT_GROUP_HEALTHY
+ * ***********************************************************************************************/
+
+#define USE_FAULT_GROUPS                    1       // Enable/Disable incrementally updated fault group summaries
+
+#if (USE_FAULT_GROUPS == 1)
+  #define FAULT_GROUP_MEMBERS_MAX           16      // Maximum number of fault objects per group (one flag word)
+  #define FAULT_GROUP_NONE                  0xFFFF  // Group index of fault objects not assigned to any group
+#endif
+
+/*!USE_FAULT_HARDWARE_OBJECTS
+ * ***********************************************************************************************
+ * Description:
+ * Fault objects with a hardware binding of type FAULT_HW_BINDING_t (fltobj->cfg->hw != NULL) are 
+ * executed by the peripherals of the dsPIC33C device. The trip level criteria.trip_level is 
+ * programmed into the DAC of the analog comparator monitoring the signal. The comparator output 
+ * is routed to the Fault PCI input of the PWM generator, which shuts down the PWM outputs 
+ * within the propagation delay of comparator and PWM logic and holds them in the fault state 
+ * (latched) until the fault has been released by the fault handler.
+ * 
+ * The software fault object only mirrors the comparator output. When the fault status gets set,
+ * the DAC is reprogrammed with criteria.reset_level, so that the comparator output resets when 
+ * the monitored signal has returned within the release threshold. When the fault handler 
+ * recovers from the fault mode, the DAC is set back to the trip level, the latched PCI fault 
+ * state is terminated and the user_fault_reset function of the fault object is called.
+ * 
+ * Trip and reset levels are given in DAC ticks, which are equal to ADC ticks when DAC and ADC 
+ * share the same reference voltage.
+ * 
+ * Please note:
+ * Hardware fault objects should be of class FLT_CLASS_CRITICAL. The latched PCI fault state is 
+ * only terminated when the fault handler recovers from the fault mode.
+ * 
+ * See also:
+ * fault_HwBind, FAULT_HW_BINDING_t
+ * ***********************************************************************************************/
+
+#define USE_FAULT_HARDWARE_OBJECTS          1       // Enable/Disable fault objects bound to PWM PCI and comparator/DAC peripherals
+
+/*!USE_FAULT_FILTERS
+ * ***********************************************************************************************
+ * Description:
+ * Fault objects with criteria FAULT_LEVEL_SLOPE_RISING, FAULT_LEVEL_SLOPE_FALLING, 
+ * FAULT_LEVEL_WINDOW_MEAN or FAULT_LEVEL_BAND evaluate a value derived from the most recent 
+ * samples of the monitored value by the fault filter fltobj->cfg->filter of type FAULT_FILTER_t. 
+ * Each criterion is updated with one sample per fault check with a constant effort, 
+ * independent of the window length. Rate-of-change, averaged and two-sided limits are 
+ * therefore monitored by one fault object without additional user tasks.
+ * 
+ * See also:
+ * FAULT_FILTER_t, FAULT_OBJECT_CONDITION_LEVEL_e
+ * ***********************************************************************************************/
+
+#define USE_FAULT_FILTERS                   1       // Enable/Disable slope, window mean and band fault criteria
+
+/*!USE_FAULT_LOG
+ * ***********************************************************************************************
+ * Description:
+ * The fault event log captures fault trips, fault mode recoveries, CPU traps and CPU resets as 
+ * compact binary records (sequence number, scheduler tick, event type, fault/trap ID, operating 
+ * mode, process code and a snapshot of the monitored value). Records are written into a ring 
+ * buffer located in persistent RAM, which is not cleared by soft resets (e.g. after a trap). 
+ * After a power-on reset the ring buffer is cleared.
+ * 
+ * When USE_FAULT_LOG_FLASH is enabled, records are copied into a reserved region of 
+ * FAULT_LOG_FLASH_PAGES program memory pages in the background. Records are appended 
+ * sequentially over all pages and the next page is only erased when the write position enters
+ * it, so each page is erased once per pass over all log pages (wear leveling). The most recent 
+ * log position is restored by scanning the sequence numbers after reset.
+ * 
+ * Please note:
+ * Program memory erase and write operations stall the CPU (page erase ~20 ms, double-word 
+ * write ~50 us). Records are therefore only flushed in the operating modes specified by 
+ * FAULT_LOG_FLUSH_OP_MODES, when the converter is not running, with one double-word write or 
+ * one page erase per fault handler call.
+ * 
+ * The slave core of dual-core devices executes from program RAM and has no access to program 
+ * memory. USE_FAULT_LOG_FLASH is therefore disabled in slave core images.
+ * 
+ * Settings:
+ * FAULT_LOG_DEPTH: number of records held in persistent RAM (has to be 2^n)
+ * FAULT_LOG_FLASH_PAGES: number of program memory pages reserved for the fault log
+ * FAULT_LOG_FLASH_PAGE_SIZE: program memory page size in program counter units
+ * FAULT_LOG_FLUSH_OP_MODES: operating modes (ORed OP_MODE_xxx) in which records are flushed
+ * 
+ * See also:
+ * fault_LogWrite, fault_LogRead, exec_FaultLogFlush
+ * ***********************************************************************************************/
+
+#define USE_FAULT_LOG                       1       // Enable/Disable fault and trap event log
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_FAULT_LOG_FLASH                 0       // Slave core has no access to program memory
+#else
+#define USE_FAULT_LOG_FLASH                 1       // Enable/Disable flushing the fault event log into program memory
+#endif
+
+#if (USE_FAULT_LOG == 1)
+  #define FAULT_LOG_DEPTH                   16      // Number of records in the persistent RAM ring buffer (has to be 2^n)
+  #define FAULT_LOG_MASK                    (FAULT_LOG_DEPTH - 1) // Ring buffer index mask
+
+  #if (FAULT_LOG_DEPTH & FAULT_LOG_MASK)
+    #error === fault log depth FAULT_LOG_DEPTH has to be 2^n ===
+  #endif
+
+  #if (USE_FAULT_LOG_FLASH == 1)
+    #define FAULT_LOG_FLASH_PAGES           2       // Number of program memory pages reserved for the fault log
+    #define FAULT_LOG_FLASH_PAGE_SIZE       0x0800  // Program memory page size in PC units (1024 instruction words)
+    #define FAULT_LOG_FLUSH_OP_MODES        (OP_MODE_FAULT | OP_MODE_STANDBY | OP_MODE_IDLE) // Operating modes in which the log is flushed
+  #endif
+#endif
+
+/*!TRAP_POLICY
+ * ***********************************************************************************************
+ * Description:
+ * When a CPU trap occurs, the default trap handler executes the following policy:
+ * 
+ *      1. capture: the trap ID, trap flags and interrupt vector are captured in persistent RAM, 
+ *         the persistent trap counter is incremented and a trap event is logged
+ *      2. safe state: the outputs of all PWM generators are overridden to LOW immediately
+ *      3. reset: the CPU is reset after TRAP_POLICY_RESET_DELAY_TIME. The delay is timed by 
+ *         the scheduler timer running with interrupts held off. 
+ * 
+ * The reset delay escalates by the number of traps captured since the last power-on or 
+ * brown-out reset:
+ * 
+ *      - from TRAP_POLICY_BACKOFF_THRESHOLD traps on, the reset is delayed by 
+ *        TRAP_POLICY_BACKOFF_DELAY_TIME
+ *      - from TRAP_POLICY_LOCKOUT_THRESHOLD traps on, the device remains in safe state 
+ *        (blinking the debug LED) until the next power-on or brown-out reset. A value of 0 
+ *        disables the lockout.
+ * 
+ * Please note:
+ * The wait for each timer period is bounded by a loop counter, so the reset delay remains 
+ * finite even when the timer is not clocked. If the watchdog timer is enabled, it may reset 
+ * the device before the delay has expired.
+ * 
+ * See also:
+ * DefaultTrapHandler, SaveTrapStatus
+ * ***********************************************************************************************/
+
+#define TRAP_POLICY_RESET_DELAY_TIME        (float)(1.0e-3)     // Delay between safe state and CPU reset in [sec]
+#define TRAP_POLICY_BACKOFF_THRESHOLD       3                   // Number of traps since power-up from which on the back-off delay applies
+#define TRAP_POLICY_BACKOFF_DELAY_TIME      (float)(100.0e-3)   // Back-off delay between safe state and CPU reset in [sec]
+#define TRAP_POLICY_LOCKOUT_THRESHOLD       10                  // Number of traps since power-up from which on the device is locked in safe state (0 = disabled)
+#define TRAP_POLICY_LOCKOUT_BLINK_TIME      (float)(250.0e-3)   // Debug LED toggle period in lockout state in [sec]
+#if defined (__P33SMPS_CH_MSTR__)
+  #define TRAP_POLICY_PWM_GENERATORS        4                   // Number of PWM generators forced into safe state
+#else
+  #define TRAP_POLICY_PWM_GENERATORS        8                   // Number of PWM generators forced into safe state
+#endif
+
+#define TRAP_POLICY_RESET_DELAY             (uint16_t)(TRAP_POLICY_RESET_DELAY_TIME / TASK_MGR_TIME_STEP) // Reset delay in scheduler ticks
+#define TRAP_POLICY_BACKOFF_DELAY           (uint16_t)(TRAP_POLICY_BACKOFF_DELAY_TIME / TASK_MGR_TIME_STEP) // Back-off delay in scheduler ticks
+#define TRAP_POLICY_LOCKOUT_BLINK           (uint16_t)(TRAP_POLICY_LOCKOUT_BLINK_TIME / TASK_MGR_TIME_STEP) // LED toggle period in scheduler ticks
+
+
+#endif	/* _ROOT_FAULT_HANDLER_CONFIGURATION_H_ */
+
+// EOF
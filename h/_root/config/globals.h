@@ -52,6 +52,19 @@
 #include "_root/generic/fdrv_TrapHandler.h"
 #include "_root/generic/task_manager.h"
 #include "_root/generic/task_scheduler.h"
+#include "_root/generic/task_realtime.h"
+#include "_root/generic/task_slack.h"
+#include "_root/generic/task_stack.h"
+#include "_root/generic/task_selftest.h"
+#include "_root/generic/task_event.h"
+#include "_root/generic/task_history.h"
+#include "_root/generic/task_jitter.h"
+#include "_root/generic/task_timebase.h"
+#include "_root/generic/task_warmboot.h"
+#include "_root/generic/task_watchdog.h"
+#include "_root/generic/task_benchmark.h"
+#include "_root/generic/task_trace.h"
+#include "_root/generic/task_bootprof.h"
 
 /* ***********************************************************************************************
  * PROJECT SPECIFIC INCLUDES
@@ -0,0 +1,135 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!msi_exchange_config.h
+ * ***********************************************************************************************
+ * File:   msi_exchange_config.h
+ * Author: M91406
+ * 
+ * Summary:
+ * User configuration file for the master/slave core data exchange of dual-core devices
+ * 
+ * Description:
+ * dsPIC33CH devices offer two independent CPU cores connected by the Master Slave Interface
+ * (MSI). When the dual-core partitioning is enabled, the control loops, the soft-start and 
+ * the analog acquisition pipeline are executed on the slave core while the task scheduler, 
+ * fault handler and communication tasks are executed on the master core. Both firmware images 
+ * are built from the same source tree: the master image by project frmwrk4.X, the slave image 
+ * by project frmwrk4_slave.X (slave core device, __P33SMPS_CH_SLV__). The slave project needs 
+ * to be added to the master project properties (Slaves) to link the slave image into the 
+ * master image.
+ * 
+ * Data is exchanged through two mailbox data flow control protocol blocks:
+ * 
+ *     - protocol block A: MSIxMBX0D ... MSIxMBX7D, master-to-slave (handshake register MBX7D)
+ *     - protocol block B: MSIxMBX8D ... MSIxMBX15D, slave-to-master (handshake register MBX15D)
+ * 
+ * The contents of both blocks are declared here and need to match the mailbox direction and 
+ * handshake configuration bits (see config_bits_P33CH.c).
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***********************************************************************************************/
+
+#ifndef _ROOT_MSI_EXCHANGE_CONFIGURATION_H_
+#define	_ROOT_MSI_EXCHANGE_CONFIGURATION_H_
+
+/* ***********************************************************************************************
+ * DEFAULT INCLUDES
+ * ***********************************************************************************************/
+
+#include <stdint.h>
+#include "mcal/mcal.h" // required to include p33SMPS_devices.h
+
+/*!USE_DUAL_CORE_PARTITIONING
+ * ***********************************************************************************************
+ * Description:
+ * Enables the partitioning of the firmware across master and slave core of dsPIC33CH devices.
+ * The core role is derived from the selected device:
+ * 
+ *     - MSI_ROLE_NONE:   single core device or partitioning disabled (no data exchange)
+ *     - MSI_ROLE_MASTER: scheduler, fault handler and communication; the control related tasks
+ *                        are removed from the task queues (see CONTROL_CORE_ENTRY in tasks.h)
+ *     - MSI_ROLE_SLAVE:  control loops, soft-start and acquisition
+ * 
+ * Settings:
+ * MSI_SLAVE_IMAGE: name of the slave core image as declared in the master project properties 
+ *                  (Slaves); the master core programs and starts the slave core during boot
+ * MSI_BOOT_TIMEOUT: number of exchange task calls after which the link is declared lost when the
+ *                  slave core has not completed its boot handshake
+ * MSI_LINK_TIMEOUT: number of exchange task calls without new data before the link is declared lost
+ * 
+ * See also:
+ * msi_exchange.h, task_MsiExchange.c
+ * ***********************************************************************************************/
+
+#define USE_DUAL_CORE_PARTITIONING          0       // Enable/Disable control loop execution on the slave core
+
+#define MSI_ROLE_NONE                       0       // No mailbox data exchange
+#define MSI_ROLE_MASTER                     1       // Master core side of the data exchange
+#define MSI_ROLE_SLAVE                      2       // Slave core side of the data exchange
+
+#if (USE_DUAL_CORE_PARTITIONING == 1) && defined (__P33SMPS_CH_MSTR__)
+  #define MSI_CORE_ROLE                     MSI_ROLE_MASTER
+#elif (USE_DUAL_CORE_PARTITIONING == 1) && defined (__P33SMPS_CH_SLV__)
+  #define MSI_CORE_ROLE                     MSI_ROLE_SLAVE
+#else
+  #define MSI_CORE_ROLE                     MSI_ROLE_NONE
+#endif
+
+#define MSI_SLAVE_IMAGE                     frmwrk4_slave // Slave core image name
+#define MSI_BOOT_TIMEOUT                    10000   // Exchange task calls until the slave core has to be ready
+#define MSI_LINK_TIMEOUT                    10      // Exchange task calls without new data until link loss
+
+/*!MSI Mailbox Data Blocks
+ * ***********************************************************************************************
+ * Description:
+ * Each data block occupies MSI_MAILBOX_BLOCK_SIZE mailbox registers. The last word of each block
+ * is written to the handshake register of the protocol block and therefore has to be the 
+ * sequence counter, which is incremented with every published data set. The receiver detects
+ * new data by the data ready flag and a lost link by a sequence counter not being incremented.
+ * ***********************************************************************************************/
+
+#define MSI_MAILBOX_BLOCK_SIZE              8       // Number of mailbox registers per protocol block
+
+#define MSI_CMD_RUN                         0x0001  // Master allows the power converter to run
+#define MSI_CMD_FAULT_OVERRIDE              0x0002  // Master fault handler enforces a shut down
+
+typedef struct {
+    volatile uint16_t command; // Command flags (MSI_CMD_xxx)
+    volatile uint16_t op_mode; // Recent operating mode of the master core task manager
+    volatile uint16_t v_reference; // Output voltage reference (0 = slave core default)
+    volatile uint16_t reserved[4]; // (reserved)
+    volatile uint16_t sequence; // Sequence counter (handshake register)
+} __attribute__((packed)) MSI_M2S_DATA_t; // Master-to-slave data block (protocol block A)
+
+typedef struct {
+    volatile uint16_t v_in; // Input voltage
+    volatile uint16_t i_in; // Input current
+    volatile uint16_t v_out; // Output voltage
+    volatile uint16_t i_out; // Output current
+    volatile uint16_t temperature; // Board temperature
+    volatile uint16_t ctrl_status; // Control status flags of the slave core (see CONTROL_STATUS_t)
+    volatile uint16_t control_output; // Most recent control loop output
+    volatile uint16_t sequence; // Sequence counter (handshake register)
+} __attribute__((packed)) MSI_S2M_DATA_t; // Slave-to-master data block (protocol block B)
+
+#endif	/* _ROOT_MSI_EXCHANGE_CONFIGURATION_H_ */
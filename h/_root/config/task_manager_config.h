@@ -47,6 +47,7 @@
 #include <math.h>
 #include "mcal/mcal.h" // required to include p33SMPS_devices.h
 #include "mcal/config/devcfg_oscillator.h"
+#include "mcal/config/devcfg_irq.h" // interrupt priority plan
 
 
 /*!EXECUTE_MCC_SYSTEM_INITIALIZE
@@ -226,6 +227,182 @@ extern volatile uint16_t task_time_buffer[];
 extern volatile uint16_t cpu_time_buffer[];
 #endif
     
+/*!USE_TASK_MANAGER_LOAD_HISTORY
+ * ***********************************************************************************************
+ * Description:
+ * In addition to the debug arrays above, the task manager can log a production-safe history of
+ * the scheduler execution profile. After each scheduler tick a record of tick counter timestamp,
+ * task ID, task execution time and CPU load meter result is pushed into a lock-free single-
+ * producer/single-consumer ring buffer. 
+ * 
+ * Records are read out by calling task_LoadHistoryRead(), e.g. by a communication task 
+ * streaming the profile to a host, without stopping the scheduler. When the buffer is full, 
+ * new records are dropped and counted until the reader has caught up.
+ * 
+ * Settings:
+ * TASK_MGR_LOAD_HISTORY_DEPTH: number of records of the ring buffer (has to be 2^n)
+ * 
+ * See also:
+ * task_LoadHistoryRead, task_LoadHistoryCount, load_history_record_t
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_LOAD_HISTORY       0   // Reduced footprint of the slave core image (no host streaming)
+#else
+#define USE_TASK_MANAGER_LOAD_HISTORY       1   // Enable/Disable the CPU load history ring buffer
+#endif
+
+#if (USE_TASK_MANAGER_LOAD_HISTORY == 1)
+  #define TASK_MGR_LOAD_HISTORY_DEPTH       32  // Number of records in the ring buffer (has to be 2^n)
+
+  #if ((TASK_MGR_LOAD_HISTORY_DEPTH & (TASK_MGR_LOAD_HISTORY_DEPTH - 1)) != 0)
+    #error === load history depth has to be a power of two ===
+  #endif
+#endif
+
+/*!USE_TASK_MANAGER_TASK_STATISTICS
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the task manager maintains an execution time statistics record for each task 
+ * registered in Task_Table[]. Each record is updated in every scheduler tick from the timer 
+ * captures taken around the task function call and provides
+ * 
+ *    - the number of calls
+ *    - minimum and maximum execution time
+ *    - the exponentially weighted moving average (EWMA) of the execution time
+ *    - a log2 histogram of the execution time
+ * 
+ * All times are given in system timer ticks. The records are declared in task_stats[] and are 
+ * indexed by task ID (see task_id_no_e). Unlike task_mgr.task_time_ctrl.maximum, these records 
+ * are not reset when the operation mode changes. They can be cleared by calling
+ * task_ResetStatistics().
+ * 
+ * Settings:
+ * TASK_MGR_STATS_EWMA_SHIFT: filter coefficient of the moving average (alpha = 1/2^n)
+ * TASK_MGR_STATS_HISTOGRAM_SHIFT: histogram resolution. Bin index is log2(task time) >> n, 
+ *                                 resulting in 16/2^n histogram bins
+ * 
+ * See also:
+ * task_stats, task_ResetStatistics
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_TASK_STATISTICS    0   // Reduced footprint of the slave core image
+#else
+#define USE_TASK_MANAGER_TASK_STATISTICS    1   // Enable/Disable per-task execution time statistics
+#endif
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+  #define TASK_MGR_STATS_EWMA_SHIFT         4   // Moving average filter coefficient alpha = 1/16
+  #define TASK_MGR_STATS_HISTOGRAM_SHIFT    1   // Two log2-steps per histogram bin
+  #define TASK_MGR_STATS_HISTOGRAM_BINS     (16 >> TASK_MGR_STATS_HISTOGRAM_SHIFT) // Number of histogram bins
+#endif
+
+/*!TASK_MGR_RESUMABLE_SLICE_TIME
+ * ***********************************************************************************************
+ * Description:
+ * Resumable tasks (see task_resumable.h) split long jobs into slices executed in consecutive 
+ * time slots. Yield points declared by TASK_PT_YIELD_EXPIRED() leave the task function once the 
+ * recent task call has taken longer than this slice budget. The budget has to leave sufficient
+ * time for the status capture and fault check within the time slot. When per-task execution 
+ * time statistics are enabled, the task manager accumulates the time of all slices of a job 
+ * in the context object of the resumable task.
+ * 
+ * Settings:
+ * TASK_MGR_RESUMABLE_SLICE_TIME: slice budget of resumable tasks in [sec]
+ * 
+ * See also:
+ * TASK_PT_BEGIN, TASK_PT_YIELD_EXPIRED, task_ResumableStart
+ * ***********************************************************************************************/
+
+#define TASK_MGR_RESUMABLE_SLICE_TIME       (float)(40.0e-6)    // Slice budget of resumable tasks in [sec]
+#define TASK_MGR_RESUMABLE_SLICE            (uint16_t)((float)system_frequencies.fcy * (float)TASK_MGR_RESUMABLE_SLICE_TIME)
+
+/*!USE_TASK_MANAGER_JITTER_MONITOR
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the scheduler captures the counter of the task manager timer right after the 
+ * wait loop has been left. As the timer counter is reset when the time slot begins, this value 
+ * is the slot-start latency. The jitter monitor slot_profile provides
+ * 
+ *    - slot-start latency of the most recent time slot with minimum and maximum
+ *    - a linear histogram of the slot-start latency
+ *    - the number of time slots which started later than the latency limit
+ *    - the time spent in each framework phase of the time slot (task execution, system status
+ *      capture, fault scan, watchdog service and operation mode check) with maximum
+ *    - the total execution time of the time slot with maximum
+ * 
+ * All times are given in system timer ticks. When the execution of a time slot exceeds the 
+ * scheduler period, the next time slot starts late. Such overruns are detected by the fault
+ * object fltobj_SlotStartLatency monitoring slot_profile.latency. Its trip level is derived from
+ * the scheduler period at runtime. Statistics can be cleared by calling task_JitterReset().
+ * 
+ * Please note:
+ * In interrupt mode the latency includes the execution time of the scheduler timer interrupt
+ * service routine waking up the CPU. Overruns longer than one full scheduler period cannot be
+ * distinguished from short overruns by the latency capture (see task_mgr.tick_ctrl.overrun).
+ * 
+ * Settings:
+ * TASK_MGR_JITTER_HISTOGRAM_BINS: number of histogram bins (the last bin collects all latencies 
+ *                                 beyond the histogram range)
+ * TASK_MGR_JITTER_HISTOGRAM_SHIFT: histogram resolution. Each bin covers 2^n timer ticks
+ * TASK_MGR_JITTER_LIMIT_SHIFT: latency limit = scheduler period / 2^n
+ * 
+ * See also:
+ * slot_profile, task_JitterReset, fltobj_SlotStartLatency
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_JITTER_MONITOR     0   // Reduced footprint of the slave core image
+#else
+#define USE_TASK_MANAGER_JITTER_MONITOR     1   // Enable/Disable the slot-start latency and slot phase time monitor
+#endif
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+  #define TASK_MGR_JITTER_HISTOGRAM_BINS    8   // Number of slot-start latency histogram bins
+  #define TASK_MGR_JITTER_HISTOGRAM_SHIFT   3   // Eight timer ticks per histogram bin
+  #define TASK_MGR_JITTER_LIMIT_SHIFT       4   // Latency limit = 1/16 of the scheduler period
+#endif
+
+/*!USE_TASK_MANAGER_MULTI_RATE_QUEUES
+ * ***********************************************************************************************
+ * Description:
+ * Task queue entries are declared using the macro TASK_QUEUE_ENTRY(task_id, period, phase).
+ * 
+ * In single-rate mode (default) the task manager steps through the active task queue calling 
+ * one entry per scheduler tick in the order of appearance. Period and phase are ignored.
+ * 
+ * In multi-rate mode each entry carries its own call period (in scheduler ticks) and phase 
+ * offset (scheduler tick of the first call, 0 ... period-1). In every scheduler tick all entries
+ * which are due are executed. The length of one queue pass (= queue frame at the end of which 
+ * the operation mode switch-over check is executed) equals the longest period declared in the 
+ * queue. Periods should therefore be harmonic (e.g. 1, 2, 4, 8, ...) to keep the schedule 
+ * identical in every queue pass. By assigning different phases to tasks of the same period 
+ * their execution is spread across different ticks, keeping the load of each time slot flat.
+ * 
+ * In this mode task_mgr.task_time_ctrl.task_time holds the accumulated execution time of all
+ * tasks executed in the most recent time slot.
+ * 
+ * Please note:
+ * Entries declared as TASK_QUEUE_ENTRY(id, n, i), with i being the index of the entry in a 
+ * queue holding n entries, result in the same task sequence in both modes. All entries of
+ * such a queue must use the same period n and distinct, ascending step indices i < n. This
+ * rule is checked at compile time for all task queues declared in tasks.h except for the
+ * warm boot queue, which is executed in one sequence (see TASK_QUEUE_IS_SEQUENCE).
+ * 
+ * Settings:
+ * TASK_MGR_QUEUE_SIZE_MAX: maximum number of entries of a multi-rate task queue
+ * 
+ * See also:
+ * TASK_QUEUE_ENTRY, task_queue_item_t
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_MULTI_RATE_QUEUES  0   // Enable/Disable multi-rate task queues
+
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+  #define TASK_MGR_QUEUE_SIZE_MAX           20  // Maximum number of entries per task queue
+#endif
+
 /*!Task Manager Heartbeat Configuration
  * ***********************************************************************************************
  * Description:
@@ -253,9 +430,7 @@ extern volatile uint16_t cpu_time_buffer[];
 #define TASK_MGR_TIMER_COUNTER_REGISTER     TMR1    // Timer counter register
 #define TASK_MGR_TIMER_PERIOD_REGISTER      PR1     // Timer Period register
 #define TASK_MGR_TIMER_ISR_FLAG_REGISTER    IFS0    // Timer Interrupt Flag Register
-#define TASK_MGR_ISR_PRIORITY               1       // Timer ISR priority (Always leave 1))
-#define TASK_MGR_ISR_STATE                  0       // Timer ISR state (0=disabled, 1=enabled)
-                                                    // (PLEASE DO NOT ENABLE)
+#define TASK_MGR_ISR_PRIORITY               IRQ_PRIORITY_SCHEDULER // Timer ISR priority (lowest level of the interrupt priority plan, see devcfg_irq.h)
 
 // Timer Interrupt Flag Register Bit Mask
 #if defined (__P33SMPS_CK1__) || defined (__P33SMPS_CK2__) || defined (__P33SMPS_CK5__)
@@ -270,6 +445,607 @@ extern volatile uint16_t cpu_time_buffer[];
   #error === selected device family could not be indentified or is not supported by the task manager  ===
 #endif
     
+/*!USE_TASK_MANAGER_TIME_BASE
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the scheduler tick period can be changed at runtime by calling 
+ * task_TimeBaseSet(), e.g. to run a slower tick in standby or a faster tick under heavy load. 
+ * TASK_MGR_TIME_STEP becomes the nominal tick period. The new period is applied at the 
+ * beginning of the next time slot. All values depending on the tick period are re-derived
+ * consistently at that point:
+ * 
+ *    - values given in system timer ticks (task time quota, CPU load factor and the fault levels
+ *      registered in TIME_BASE_REGISTRY, see timebase.h) are scaled with the tick period
+ *    - intervals given in scheduler ticks are defined for the nominal tick period and are 
+ *      converted by TASK_MGR_TICKS() where they are used (watchdog window, CPU load peak-hold 
+ *      window, DebugLED blink rates, soft-start delays, CAN message timing, trap policy delays)
+ * 
+ * Task queues are not affected. Tasks are still called in every n-th time slot, so their call
+ * rate changes with the tick period.
+ * 
+ * Every operation mode switch-over restores the nominal tick period before the switch-over
+ * function of the new operation mode is called. Operation modes running at a different tick 
+ * period therefore select it from within their switch-over function. In OP_MODE_STANDBY the 
+ * tick period is set to TASK_MGR_TIME_STEP_STANDBY.
+ * 
+ * Please note:
+ * Power is only saved when the scheduler is running in interrupt mode, where the CPU is put
+ * into IDLE mode until the next time slot begins (see TASK_MGR_SCHEDULER_MODE).
+ * 
+ * Settings:
+ * TASK_MGR_TIME_STEP_MIN: shortest tick period accepted by task_TimeBaseSet() in [sec]
+ * TASK_MGR_TIME_STEP_STANDBY: tick period selected in OP_MODE_STANDBY in [sec] 
+ *                             (0 = nominal tick period)
+ * TASK_MGR_TIME_BASE_PERIOD: Macro; converts a tick period in [sec] into the timer period
+ * TASK_MGR_TIME_BASE_Q: fixed point resolution of the tick scaling factor 
+ *                       (the tick period may be increased by up to 2^(16-Q) - 1)
+ * 
+ * See also:
+ * task_TimeBaseSet, task_TimeBaseRestore, TASK_MGR_TICKS, TIME_BASE_REGISTRY
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_TIME_BASE          0       // Slave core tick is coupled to the master core
+#else
+#define USE_TASK_MANAGER_TIME_BASE          1       // Enable/Disable the runtime configurable scheduler tick period
+#endif
+
+#if (USE_TASK_MANAGER_TIME_BASE == 1)
+  #define TASK_MGR_TIME_STEP_MIN            (float)(25.0e-6)    // Shortest tick period in [sec]
+  #define TASK_MGR_TIME_STEP_STANDBY        (float)(500.0e-6)   // Tick period in standby mode in [sec]
+  #define TASK_MGR_TIME_BASE_PERIOD(t)      (uint16_t)((float)system_frequencies.fcy * (float)(t))
+  #define TASK_MGR_TIME_BASE_Q              12      // Tick scaling factor resolution (Q4.12)
+#endif
+
+/*!TASK_MGR_SCHEDULER_MODE
+ * ***********************************************************************************************
+ * Description:
+ * The task manager supports two different ways of synchronizing the main loop to the system
+ * timer:
+ * 
+ *    - TASK_MGR_MODE_POLLING:   The main loop polls the timer interrupt flag bit and counts the 
+ *                               number of wait loop iterations to determine the CPU load. The
+ *                               CPU is kept fully active between time slots. (default)
+ * 
+ *    - TASK_MGR_MODE_INTERRUPT: The system timer interrupt service routine releases the next 
+ *                               time slot by incrementing the tick counter task_mgr.tick_ctrl.counter.
+ *                               Between time slots the CPU is put into IDLE mode (PWRSAV #1).  
+ *                               The CPU load is determined from a timer capture taken at the end 
+ *                               of each time slot instead of loop counting.
+ * 
+ * In interrupt mode the CPU priority level is temporarily raised to TASK_MGR_ISR_PRIORITY before 
+ * the tick counter is checked and the CPU enters IDLE mode. A timer interrupt occurring in between 
+ * will therefore still wake up the CPU (execution continues after the PWRSAV instruction) and the 
+ * pending interrupt is served as soon as the CPU priority level has been restored. Interrupts of 
+ * higher priority (e.g. control loops) are not affected.
+ * 
+ * Please note:
+ * In interrupt mode the system timer is configured to continue operation in IDLE mode. The CPU 
+ * load lock-out check of the polling mode (wait loop counter exceeding the time quota) is not 
+ * available as the CPU is halted while waiting. An external watchdog needs to be used to recover 
+ * from a stalled system timer.
+ * 
+ * TASK_MGR_ISR_STATE is derived from this setting and must not be changed manually.
+ * 
+ * See also:
+ * TASK_MGR_ISR_PRIORITY, PWRSAV_IDLE
+ * ***********************************************************************************************/
+
+#define TASK_MGR_MODE_POLLING               0       // Main loop is polling the system timer interrupt flag bit
+#define TASK_MGR_MODE_INTERRUPT             1       // System timer interrupt releases the next time slot
+
+#define TASK_MGR_SCHEDULER_MODE             TASK_MGR_MODE_POLLING  // Selected scheduler synchronization mode
+
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+  #define TASK_MGR_ISR_STATE                1       // Timer ISR state (0=disabled, 1=enabled)
+#else
+  #define TASK_MGR_ISR_STATE                0       // Timer ISR state (0=disabled, 1=enabled)
+#endif
+
+/*!USE_TASK_MANAGER_RT_TIER
+ * ***********************************************************************************************
+ * Description:
+ * Besides the cooperative task queues executed from the main loop, the task manager offers an
+ * interrupt-level real-time task tier for tasks with hard timing requirements such as soft-start
+ * ramps or protection checks. Real-time tasks are registered in RT_TASK_REGISTRY (tasks.h) and
+ * are dispatched by the interrupt service routine of a dedicated timer, preempting the
+ * cooperative task queues at any time. 
+ * 
+ * Within the real-time tier tasks are executed in order of registration (first entry = highest
+ * priority). Each task has a period (in real-time tier ticks), a phase offset and a deadline 
+ * (in [sec], relative to the timer period match releasing the tier tick). When a task completes 
+ * later than its deadline, its deadline-miss counter is incremented.
+ * 
+ * Settings:
+ * RT_TIER_TIME_STEP: real-time tier tick period in [sec]
+ * RT_TIER_TIMER_INDEX: index of the timer peripheral used (default = Timer2)
+ * RT_TIER_ISR_PRIORITY: interrupt priority of the real-time tier. This priority has to be 
+ *                       higher than TASK_MGR_ISR_PRIORITY and should be lower than the
+ *                       priorities of control loop interrupts.
+ * 
+ * See also:
+ * RT_TASK_REGISTRY, rt_task_status
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_RT_TIER    0       // Enable/Disable the interrupt-level real-time task tier
+
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+  #define RT_TIER_TIME_STEP                 (float)(50.0e-6)    // Real-time tier time step in [sec]
+  #define RT_TIER_PERIOD                    (uint16_t)((float)system_frequencies.fcy * (float)RT_TIER_TIME_STEP)
+
+  #define RT_TIER_TIMER_INDEX               2       // Index of the timer peripheral used
+  #define RT_TIER_TIMER_COUNTER_REGISTER    TMR2    // Timer counter register
+  #define RT_TIER_TIMER_PERIOD_REGISTER     PR2     // Timer Period register
+  #define RT_TIER_TIMER_ISR_FLAG            IFS0bits.T2IF // Timer interrupt flag bit
+  #define RT_TIER_ISR_PRIORITY              IRQ_PRIORITY_RT_TIER // Timer ISR priority (has to be > TASK_MGR_ISR_PRIORITY)
+
+  #if (RT_TIER_ISR_PRIORITY <= TASK_MGR_ISR_PRIORITY)
+    #error === real-time tier interrupt priority has to be higher than the task manager priority ===
+  #endif
+
+#endif
+
+/*!USE_TASK_MANAGER_SLACK_EXECUTOR
+ * ***********************************************************************************************
+ * Description:
+ * Time left in a scheduler time slot after the recent task, the system status capture and the 
+ * fault check have been executed is usually spent waiting for the next tick. When the slack 
+ * executor is enabled, deferrable jobs like flash write sequences, checksum calculations or 
+ * telemetry formatting can be posted into a ring buffer by calling task_PostSlackJob(). 
+ * The jobs are executed in chunks while the remaining time until the next scheduler tick, 
+ * measured from the system timer counter against its period register, exceeds the declared 
+ * worst-case chunk execution time plus a guard time. 
+ * 
+ * Time consumed by slack jobs is accounted as free CPU time by the CPU load meter.
+ * 
+ * Settings:
+ * TASK_MGR_SLACK_QUEUE_SIZE: number of jobs which can be pending at a time (has to be 2^n)
+ * TASK_MGR_SLACK_GUARD_TIME: minimum time in [sec] left until the next tick after a chunk 
+ *                            has been executed
+ * 
+ * See also:
+ * task_PostSlackJob, exec_SlackJobs
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_SLACK_EXECUTOR     0       // Enable/Disable execution of deferrable jobs in slot slack time
+
+#if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+
+  #define TASK_MGR_SLACK_QUEUE_SIZE         8                   // Number of slack job queue entries (has to be 2^n)
+  #define TASK_MGR_SLACK_GUARD_TIME         (float)(5.0e-6)     // Guard time until next tick in [sec]
+  #define TASK_MGR_SLACK_GUARD              (uint16_t)((float)system_frequencies.fcy * (float)TASK_MGR_SLACK_GUARD_TIME)
+
+  #if ((TASK_MGR_SLACK_QUEUE_SIZE & (TASK_MGR_SLACK_QUEUE_SIZE - 1)) != 0)
+    #error === slack job queue size has to be a power of two ===
+  #endif
+
+#endif
+
+/*!USE_TASK_MANAGER_STACK_MONITOR
+ * ***********************************************************************************************
+ * Description:
+ * The stack trap _StackError is only raised after the stack pointer has already exceeded its 
+ * limit. When the stack monitor is enabled, the unused stack area between the recent stack 
+ * pointer and the stack pointer limit SPLIM is painted with a fill pattern by the scheduler 
+ * before the operating system is initialized. In the remaining time of each scheduler time 
+ * slot, a few words of the stack area are checked for the fill pattern, starting at the stack 
+ * limit and moving down towards the recent high-water mark. When a word has been overwritten, 
+ * the high-water mark is moved up to this word. 
+ * 
+ * The maximum stack usage in percent of the stack size is published in task_stack.usage and 
+ * monitored by the fault objects fltobj_StackUsageWarning and fltobj_StackUsageCritical. 
+ * 
+ * Please note:
+ * The high-water mark never decreases. Fault conditions of the stack usage fault objects are 
+ * only released by a device reset. Stack words written with a value equal to the fill pattern 
+ * are not detected.
+ * 
+ * Settings:
+ * TASK_MGR_STACK_PAINT_PATTERN: fill pattern of unused stack words
+ * TASK_MGR_STACK_PAINT_MARGIN: number of words above the recent stack pointer left unpainted
+ * TASK_MGR_STACK_SCAN_WORDS: number of stack words checked per scheduler time slot
+ * TASK_MGR_STACK_WARNING_LEVEL: stack usage in [%] triggering a warning
+ * TASK_MGR_STACK_CRITICAL_LEVEL: stack usage in [%] triggering a critical fault
+ * TASK_MGR_STACK_BASE/LIMIT/POINTER: addresses of the stack area and the recent stack pointer 
+ *                                    (may be overridden by the device header)
+ * 
+ * See also:
+ * task_stack, task_StackPaint, exec_StackMonitor
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_STACK_MONITOR      1       // Enable/Disable the stack usage high-water mark monitor
+
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+
+  #define TASK_MGR_STACK_PAINT_PATTERN      0x5AA5  // Fill pattern of unused stack words
+  #define TASK_MGR_STACK_PAINT_MARGIN       16      // Words above the recent stack pointer left unpainted
+  #define TASK_MGR_STACK_SCAN_WORDS         8       // Stack words checked per scheduler time slot
+  #define TASK_MGR_STACK_WARNING_LEVEL      75      // Stack usage in [%] triggering a warning
+  #define TASK_MGR_STACK_CRITICAL_LEVEL     90      // Stack usage in [%] triggering a critical fault
+
+  #ifndef TASK_MGR_STACK_BASE
+    #define TASK_MGR_STACK_BASE             ((volatile uint16_t*)&_SP_init) // Lowest stack address (linker symbol __SP_init)
+    #define TASK_MGR_STACK_LIMIT            ((volatile uint16_t*)SPLIM)     // Stack pointer limit
+    #define TASK_MGR_STACK_POINTER          ((volatile uint16_t*)WREG15)    // Recent stack pointer
+  #endif
+
+  #if (TASK_MGR_STACK_WARNING_LEVEL >= TASK_MGR_STACK_CRITICAL_LEVEL) || (TASK_MGR_STACK_CRITICAL_LEVEL > 100)
+    #error === stack usage warning level has to be below the critical level (max. 100%) ===
+  #endif
+
+#endif
+
+/*!USE_TASK_MANAGER_SELF_TEST
+ * ***********************************************************************************************
+ * Description:
+ * When the run-time self-test is enabled, program memory and data memory are checked in the 
+ * background without delaying the boot process. In the remaining time of each scheduler time 
+ * slot, following steps are executed:
+ * 
+ *   - Flash CRC: TASK_MGR_SELF_TEST_FLASH_WORDS instruction words of the application image are 
+ *     added to a CRC-16 signature (CCITT polynomial 0x1021, initial value 0xFFFF). Each 
+ *     instruction word is fed as its lower 16-bit word followed by its upper byte. When a pass 
+ *     over the program memory range is complete, the signature is compared to the reference. 
+ *     Program memory regions written at runtime (fault log, calibration record) are skipped.
+ * 
+ *   - RAM March test: one block of TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS data memory words is saved,
+ *     tested by a March C- sequence and restored while all interrupts are held off. The test 
+ *     rotates through the data memory range below the stack. Buffers written by DMA or by 
+ *     peripheral bus masters are skipped (see apl/config/selftest.h).
+ * 
+ * Both tests start when the startup sequence has been completed. Failures are latched in 
+ * task_selftest.failures and reported by the fault objects fltobj_FlashCrcFailure and 
+ * fltobj_RamTestFailure.
+ * 
+ * Please note:
+ * The reference signature is captured by the first complete pass unless the expected signature
+ * of the image is declared by TASK_MGR_SELF_TEST_FLASH_CRC. The signature of the hardware CRC 
+ * module may differ from the signature of the software CRC. Each RAM block test holds off all
+ * interrupts, including the control loop interrupt, for approx. 15 instruction cycles per word.
+ * The flash CRC is not available on the slave core of dual-core devices, which executes from 
+ * program RAM loaded by the master core.
+ * 
+ * Settings:
+ * TASK_MGR_SELF_TEST_FLASH_WORDS: instruction words added to the flash CRC per time slot
+ * TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS: data memory words tested per time slot
+ * TASK_MGR_SELF_TEST_HW_CRC: 1 = flash CRC is calculated by the CRC module, 0 = by software
+ * TASK_MGR_SELF_TEST_FLASH_CRC: expected signature of the image (optional, not defined = captured)
+ * TASK_MGR_SELF_TEST_FLASH_START/END: program memory range covered by the flash CRC
+ * TASK_MGR_SELF_TEST_RAM_START/END: data memory range covered by the RAM March test
+ *                                   (may be overridden by the device header)
+ * 
+ * See also:
+ * task_selftest, exec_SelfTest
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_SELF_TEST          1       // Enable/Disable the run-time flash CRC and RAM March test
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+
+  #if defined (__P33SMPS_CH_SLV__)
+    #define TASK_MGR_SELF_TEST_FLASH        0       // Slave core has no access to program memory
+  #else
+    #define TASK_MGR_SELF_TEST_FLASH        1       // Enable/Disable the flash CRC
+  #endif
+
+  #define TASK_MGR_SELF_TEST_FLASH_WORDS    16      // Instruction words added to the flash CRC per time slot
+  #define TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS 4      // Data memory words tested per time slot
+  #ifndef TASK_MGR_SELF_TEST_HW_CRC
+    #define TASK_MGR_SELF_TEST_HW_CRC       1       // Flash CRC is calculated by the CRC module
+  #endif
+//  #define TASK_MGR_SELF_TEST_FLASH_CRC    0x0000  // Expected signature of the image (captured by the first pass when not defined)
+
+  #ifndef TASK_MGR_SELF_TEST_FLASH_START
+    #define TASK_MGR_SELF_TEST_FLASH_START  0x000000UL                      // Reset vector and interrupt vector table are included
+    #define TASK_MGR_SELF_TEST_FLASH_END    (SELF_TEST_LINKER_ADDRESS(&_CODE_BASE) + SELF_TEST_LINKER_ADDRESS(&_CODE_LENGTH)) // End of user program memory (linker symbols __CODE_BASE/__CODE_LENGTH)
+  #endif
+  #ifndef TASK_MGR_SELF_TEST_RAM_START
+    #define TASK_MGR_SELF_TEST_RAM_START    ((volatile uint16_t*)&_DATA_BASE) // Start of data memory (linker symbol __DATA_BASE)
+    #define TASK_MGR_SELF_TEST_RAM_END      ((volatile uint16_t*)&_SP_init)   // Lowest stack address (linker symbol __SP_init)
+  #endif
+
+  #if ((TASK_MGR_SELF_TEST_FLASH_WORDS < 1) || (TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS < 1))
+    #error === self-test steps have to cover at least one word per time slot ===
+  #endif
+
+#endif
+
+/*!USE_TASK_MANAGER_EVENT_BUS
+ * ***********************************************************************************************
+ * Description:
+ * Tasks, the task manager and the fault handler coordinate through global status flags, which 
+ * need to be polled by each interested task in each call. When the event bus is enabled, the 
+ * task manager, the fault handler and application modules post events of a fixed event ID space
+ * (see apl/config/events.h). Each subscriber declares a bitmask of the events it is interested 
+ * in and takes posted events when it is called. Posting an event is a single word write, which 
+ * is safe within interrupt service routines, and taking an event is a single bit test per event.
+ * Tasks only evaluate status flags or data when an event has been taken.
+ * 
+ * Please note:
+ * Events are not queued. An event posted multiple times before a subscriber has taken it is 
+ * delivered once. Subscribers need to read the recent state (e.g. operating mode, fault flags) 
+ * when an event has been taken. The event bus is limited to 16 events and 16 subscribers.
+ * 
+ * See also:
+ * task_event_bus, init_EventBus, task_EventTake, EVENT_POST
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_EVENT_BUS          1       // Enable/Disable the publish/subscribe event bus
+
+/*!USE_TASK_MANAGER_WARM_BOOT
+ * ***********************************************************************************************
+ * Description:
+ * After every device reset the firmware runs through the complete boot process including the 
+ * oscillator and PLL configuration and the boot, device startup and system startup task queues.
+ * When warm boot is enabled, the oscillator settings, system frequencies, application timing 
+ * settings and fault object configurations are captured in a checksummed snapshot located in 
+ * persistent RAM when the startup sequence has been completed. 
+ * 
+ * After a software reset or watchdog timer time-out, which has not been caused by a trap or by
+ * any other critical reset source, the snapshot is validated. If it is intact, the oscillator 
+ * configuration is only re-applied when the recent oscillator registers do not match the 
+ * snapshot (e.g. when the reset has restored the FNOSC selection), the settings are restored 
+ * and the task manager directly enters OP_MODE_SYSTEM_STARTUP. Peripheral initializations 
+ * required after the reset need to be listed in task queue TASK_QUEUE_WARM_BOOT (tasks.h), 
+ * which is executed once before the task manager is started.
+ * 
+ * Please note:
+ * Warm boot is not available on the slave core of dual-core devices. The slave core program 
+ * RAM is loaded and the slave core is restarted by the master core (see msi_Init()).
+ * 
+ * Settings:
+ * WARM_BOOT_RETRY_LIMIT: number of successive warm boots without the startup sequence being 
+ *                        completed after which a cold boot is enforced
+ * WARM_BOOT_FAULT_OBJECTS_MAX: maximum number of fault object configurations captured
+ * 
+ * See also:
+ * warm_boot_Check, warm_boot_Capture, warm_boot_Restore, TASK_QUEUE_WARM_BOOT
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_WARM_BOOT          0       // Slave core is restarted by the master core
+#else
+#define USE_TASK_MANAGER_WARM_BOOT          1       // Enable/Disable warm boot after software and watchdog resets
+#endif
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+  #define WARM_BOOT_RETRY_LIMIT             3       // Successive warm boot attempts before a cold boot is enforced
+  #define WARM_BOOT_FAULT_OBJECTS_MAX       16      // Maximum number of fault object configurations in the snapshot
+#endif
+
+/*!USE_TASK_MANAGER_WATCHDOG
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the watchdog timer is started by OS_Initialize() and serviced by the scheduler 
+ * in windowed mode. Critical tasks are registered with a check-in bit in WDT_CHECKIN_REGISTRY 
+ * (tasks.h) together with the operation modes in which they are expected to run. A task checks 
+ * in automatically each time it has been called by the task manager and has returned. 
+ * 
+ * The scheduler counts the ticks since the most recent watchdog clear. The watchdog timer is 
+ * only cleared once the watchdog window has opened and all check-ins expected in the recent 
+ * operation mode have arrived. When an operation mode switch occurs, only tasks expected in 
+ * both operation modes remain mandatory for the recent window. If the check-ins are incomplete 
+ * when the window closes, the missing check-ins and the first task which missed its check-in 
+ * are captured in the persistent diagnostic record task_wdt_diag and the watchdog timer is left
+ * to expire, resetting the device.
+ * 
+ * Please note:
+ * The window timing is derived from the watchdog period and window size selected by the 
+ * configuration bits RWDTPS and WDTWIN (see config_bits_P33xx.c). Both settings need to be 
+ * kept in sync with the settings below.
+ * The window is timed by counting scheduler ticks. Blocking operations stalling the scheduler
+ * (e.g. flash page erase cycles of the fault log) shift the window against the watchdog timer 
+ * and should be kept well below TASK_MGR_WDT_PERIOD_TIME * (1 - TASK_MGR_WDT_WINDOW_SIZE).
+ * 
+ * Settings:
+ * TASK_MGR_WDT_PERIOD_TIME: watchdog timer period in [sec] selected by RWDTPS 
+ * TASK_MGR_WDT_WINDOW_SIZE: watchdog window size selected by WDTWIN (fraction of the period)
+ * TASK_MGR_WDT_TOLERANCE: LPRC oscillator tolerance applied to both window limits
+ * 
+ * See also:
+ * WDT_CHECKIN_REGISTRY, task_wdt, task_wdt_diag, exec_TaskWatchdog
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_WATCHDOG           1       // Enable/Disable windowed watchdog timer service with task check-ins
+
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+  #define TASK_MGR_WDT_PERIOD_TIME          (float)(32.0e-3)    // Watchdog period in [sec] (RWDTPS = PS1024 at LPRC = 32 kHz)
+  #define TASK_MGR_WDT_WINDOW_SIZE          (float)(0.50)       // Watchdog window size (WDTWIN = WIN50)
+  #define TASK_MGR_WDT_TOLERANCE            (float)(0.15)       // LPRC frequency tolerance
+
+  #define TASK_MGR_WDT_WINDOW_OPEN          (uint16_t)(((float)TASK_MGR_WDT_PERIOD_TIME * (1.0 - (float)TASK_MGR_WDT_WINDOW_SIZE) * \
+                                                (1.0 + (float)TASK_MGR_WDT_TOLERANCE)) / (float)TASK_MGR_TIME_STEP)
+  #define TASK_MGR_WDT_WINDOW_CLOSE         (uint16_t)(((float)TASK_MGR_WDT_PERIOD_TIME * (1.0 - (float)TASK_MGR_WDT_TOLERANCE)) / \
+                                                (float)TASK_MGR_TIME_STEP)
+
+#endif
+
+/*!USE_TASK_MANAGER_BENCHMARK
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the benchmark task TASK_BENCHMARK is added to the IDLE task queue. It measures
+ * the execution time of the framework hot paths listed in BENCH_CASE_REGISTRY (task_benchmark.h)
+ * in CPU cycles by reading the counter of a dedicated free running timer before and after each
+ * call. Each benchmark case is sampled BENCH_ITERATIONS times, taking BENCH_BATCH samples per
+ * call of the benchmark task. Minimum, maximum and average cycle counts of each case are
+ * collected in the result table bench_results[], which can be read by the debugger or through
+ * the runtime parameter access protocol. After one complete pass the benchmark task returns
+ * immediately.
+ *
+ * Please note:
+ * The functions under test are called outside of their regular context. The state of the task
+ * manager, the fault engine and the watchdog service is saved before and restored after each
+ * sample. As the benchmark task is only queued in IDLE mode, the power converter is not running
+ * while fault objects are being checked.
+ * Minimum values are free of interrupt latencies while maximum values include preemptions by
+ * interrupt service routines. Results are meant as regression baseline of a release and this
+ * option should be disabled in production builds.
+ *
+ * Settings:
+ * BENCH_TIMER_INDEX: index of the timer peripheral used as cycle counter (default = Timer3)
+ * BENCH_ITERATIONS: number of samples taken of each benchmark case
+ * BENCH_BATCH: number of samples taken per call of the benchmark task
+ *
+ * See also:
+ * BENCH_CASE_REGISTRY, bench_results, exec_TaskBenchmark
+ * ***********************************************************************************************/
+
+#define USE_TASK_MANAGER_BENCHMARK          0       // Enable/Disable the on-target micro-benchmark of the framework hot paths
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+
+  #define BENCH_TIMER_INDEX                 3       // Index of the timer peripheral used
+  #define BENCH_TIMER_COUNTER_REGISTER      TMR3    // Timer counter register
+  #define BENCH_TIMER_PERIOD_REGISTER       PR3     // Timer Period register
+  #define BENCH_TIMER_PERIOD                0xFFFF  // Timer period (free running 16-bit counter)
+
+  #define BENCH_ITERATIONS                  256     // Number of samples per benchmark case
+  #define BENCH_BATCH                       4       // Number of samples per benchmark task call
+
+#endif
+
+/*!USE_TASK_MANAGER_TRACE
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, trace points record 32-bit events (timestamp, event ID, argument) into the RAM
+ * ring buffer trace. Ready-made trace points are located at task start and end, operation mode
+ * switch-over, fault trip and release, trap entry as well as entry and exit of the scheduler
+ * timer, real-time tier and control loop interrupt service routines. Additional trace points
+ * can be placed in user code by TRACE_USER(event, arg).
+ *
+ * Each trace point is assigned to a trace level. Trace points above TRACE_LEVEL are removed at
+ * compile time and do not cost any CPU cycles or program memory:
+ *
+ *     - TRACE_LEVEL_FAULT: fault trip and release, trap entry
+ *     - TRACE_LEVEL_MODE:  + operation mode switch-over
+ *     - TRACE_LEVEL_TASK:  + task start and end
+ *     - TRACE_LEVEL_ALL:   + interrupt service routine entry/exit and user trace points
+ *
+ * The timestamp is the counter of the task manager timer. The host-side decoder
+ * (support/trace/trace_decode.py) counts a new scheduler tick whenever the timestamp decreases.
+ * Absolute timing is therefore only reconstructed if at least one event is recorded per
+ * scheduler tick, which is the case for TRACE_LEVEL_TASK and above.
+ *
+ * Please note:
+ * The ring buffer is located in persistent RAM. A trap freezes the buffer and the frozen buffer
+ * is preserved across the subsequent soft reset for post-mortem analysis. Recording resumes when
+ * trace.frozen is cleared by the debugger or through the parameter access protocol. After a
+ * power-on reset the ring buffer is always cleared.
+ *
+ * Settings:
+ * TRACE_LEVEL: highest trace level recorded
+ * TRACE_BUFFER_SIZE: number of records held in the ring buffer (has to be a power of two)
+ *
+ * See also:
+ * TRACE_EVENT_e, trace, trace_Record
+ * ***********************************************************************************************/
+
+#define TRACE_LEVEL_OFF                     0       // No trace points are recorded
+#define TRACE_LEVEL_FAULT                   1       // Fault trip and release, trap entry
+#define TRACE_LEVEL_MODE                    2       // Trace level FAULT plus operation mode switch-over
+#define TRACE_LEVEL_TASK                    3       // Trace level MODE plus task start and end
+#define TRACE_LEVEL_ALL                     4       // Trace level TASK plus interrupt service routines and user trace points
+
+#define USE_TASK_MANAGER_TRACE              0       // Enable/Disable recording of trace points
+
+#if (USE_TASK_MANAGER_TRACE == 1)
+
+  #define TRACE_LEVEL                       TRACE_LEVEL_TASK // Highest trace level recorded
+  #define TRACE_BUFFER_SIZE                 256     // Number of trace records in the ring buffer (power of two)
+
+  #if ((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0)
+    #error === trace buffer size has to be a power of two ===
+  #endif
+
+#else
+  #define TRACE_LEVEL                       TRACE_LEVEL_OFF
+#endif
+
+/*!USE_TASK_MANAGER_BOOT_PROFILER
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the boot profiler timestamps every startup step from the reset root cause 
+ * check until the task manager leaves the startup operation modes (usually when entering 
+ * OP_MODE_NORMAL). Recorded steps are the initialization functions called before the 
+ * scheduler is started (Device_Reset(), CLOCK_Initialize(), OS_Initialize(), etc.) and each 
+ * entry of the task queues of OP_MODE_BOOT, OP_MODE_DEVICE_STARTUP and OP_MODE_SYSTEM_STARTUP.
+ * 
+ * Time is counted in [us] by a free running timer with prescaler, which is converted at the 
+ * CPU clock given in system_frequencies. The host-side readout support/bootprof/boot_report.py
+ * lists all steps in chronological order and reports the critical path from reset to the 
+ * first operation mode after startup.
+ * 
+ * Please note:
+ * The record boot_profile is located in persistent RAM. The record of a boot which has been 
+ * interrupted by a soft reset (e.g. by a trap or the watchdog timer) is preserved for analysis 
+ * and the following boot is not profiled. Device_Reset() powers off the profiler timer, the 
+ * few instruction cycles until it has been restarted are not counted.
+ *
+ * Settings:
+ * BOOT_PROF_TIMER_INDEX: index of the timer peripheral used as time base (default = Timer4)
+ * BOOT_PROF_TIMER_PRESCALER: timer input clock prescaler (has to match BOOT_PROF_TIMER_TCKPS)
+ * BOOT_PROF_SIZE: number of step records (pre-scheduler steps plus startup queue entries)
+ * BOOT_PROF_FCY_RESET: instruction cycle frequency before CLOCK_Initialize() has been executed
+ *
+ * See also:
+ * BOOT_STEP_e, boot_profile, init_BootProfile
+ * ***********************************************************************************************/
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_TASK_MANAGER_BOOT_PROFILER      0       // Reduced footprint of the slave core image
+#else
+#define USE_TASK_MANAGER_BOOT_PROFILER      1       // Enable/Disable boot time profiling of startup steps
+#endif
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+
+  #define BOOT_PROF_TIMER_INDEX             4       // Index of the timer peripheral used
+  #define BOOT_PROF_TIMER_COUNTER_REGISTER  TMR4    // Timer counter register
+  #define BOOT_PROF_TIMER_PERIOD            0xFFFF  // Timer period (free running 16-bit counter)
+  #define BOOT_PROF_TIMER_PRESCALER         64      // Timer input clock prescaler (counter wraps after 41.9 ms at 100 MIPS)
+  #define BOOT_PROF_TIMER_TCKPS             0b10    // Timer input clock prescaler selection 1:64
+
+  #define BOOT_PROF_SIZE                    32      // Number of step records
+  #define BOOT_PROF_FCY_RESET               4000000UL // Instruction cycle frequency at reset (FRC = 8 MHz)
+
+#endif
+
+/*!TASK_MGR_CPU_LOAD_METER_MODE
+ * ***********************************************************************************************
+ * Description:
+ * The CPU load meter measures the free CPU time left in each scheduler time slot. 
+ * 
+ * In TASK_MGR_CPU_LOAD_METER_LOOP_COUNT mode the iterations of the wait loop are counted and 
+ * multiplied by the number of CPU cycles of one loop iteration (TASK_MGR_CPU_LOAD_NOMBLK). This
+ * constant depends on the code optimization level and compiler version and needs to be verified 
+ * after every compiler update.
+ * 
+ * In TASK_MGR_CPU_LOAD_METER_TIMESTAMP mode the free time is captured from the system timer 
+ * counter against its period register when the main loop starts waiting for the next tick. 
+ * This measurement is independent from code optimization and compiler version. The interrupt
+ * scheduler mode always uses timestamp captures.
+ * 
+ * Besides the free CPU time result in task_mgr.cpu_load.load the CPU load meter reports the 
+ * CPU utilization in [0.1 %] with a peak-hold value and a decaying average.
+ * 
+ * Settings:
+ * TASK_MGR_CPU_LOAD_PEAK_WINDOW: number of scheduler ticks the utilization peak is held
+ * TASK_MGR_CPU_LOAD_AVERAGE_SHIFT: filter coefficient of the decaying average (alpha = 1/2^n)
+ * 
+ * See also:
+ * cpu_load_settings_t, task_UpdateCPULoad
+ * ***********************************************************************************************/
+
+#define TASK_MGR_CPU_LOAD_METER_LOOP_COUNT  0   // Free CPU time is measured by counting wait loop iterations
+#define TASK_MGR_CPU_LOAD_METER_TIMESTAMP   1   // Free CPU time is measured by system timer counter captures
+
+#define TASK_MGR_CPU_LOAD_METER_MODE        TASK_MGR_CPU_LOAD_METER_TIMESTAMP // Selected CPU load meter mode
+
+#define TASK_MGR_CPU_LOAD_PEAK_WINDOW       10000   // Peak-hold window in scheduler ticks (= 1 sec at 100 usec time step)
+#define TASK_MGR_CPU_LOAD_AVERAGE_SHIFT     6       // Decaying average filter coefficient alpha = 1/64
+
 /*!CPU Meter Configuration
  * ***********************************************************************************************
  * Description:
@@ -301,7 +1077,7 @@ extern volatile uint16_t cpu_time_buffer[];
  * See also:
  * (none)
  * ***********************************************************************************************/
-#if __XC16_VERSION > 1040   // Example: v1.36 is represented by 1036
+#if (__XC16_VERSION > 1040) && (TASK_MGR_CPU_LOAD_METER_MODE == TASK_MGR_CPU_LOAD_METER_LOOP_COUNT)
     #pragma message "=== The CPU Load Meter has not been tested with the recent compiler version ==="
     // If this message occurs in the output window, please verify the constants 
     // TASK_MGR_CPU_LOAD_NOMBLK by using the MPLAB X stopwatch (see comment above)
@@ -18,6 +18,10 @@
 
 #include <xc.h> // include processor files - each processor file is guarded.  
 #include <stdint.h>
+
+#include "_root/config/fault_handler_config.h"
+#include "_root/generic/fdrv_FaultHardware.h"
+#include "_root/generic/fdrv_FaultLog.h"
 #include "_root/config/globals.h"
 
 
@@ -159,17 +163,43 @@ typedef union
  * thresholds, the periodic counter counting successive fault conditions and the maximum counter
  * threshold at which a fault event is triggered resp. the periodic counter counting successive 
  * OK conditions and the maximum counter threshold at which a fault condition is reset.
+ * 
+ * Besides instantaneous comparisons of the monitored value, the following criteria are 
+ * evaluated on a value derived from the recent and previous samples of the monitored value. 
+ * Each criterion requires a fault filter of type FAULT_FILTER_t (fltobj->cfg->filter) holding its 
+ * state and is computed incrementally with a constant effort per fault check (one sample per 
+ * check):
+ * 
+ *      - FAULT_LEVEL_SLOPE_RISING: value[n] - value[n-N] > trip_level (signed, hysteresis to 
+ *        reset_level), with N = 2^filter->shift samples
+ *      - FAULT_LEVEL_SLOPE_FALLING: value[n-N] - value[n] > trip_level (signed, hysteresis to 
+ *        reset_level)
+ *      - FAULT_LEVEL_WINDOW_MEAN: mean of the most recent N samples > trip_level (hysteresis to 
+ *        reset_level). The running sum is updated by the sample entering and the sample 
+ *        leaving the window.
+ *      - FAULT_LEVEL_BAND: value > trip_level (upper limit) or value < reset_level (lower limit). 
+ *        While the fault condition is active, both limits are moved into the band by 
+ *        filter->hysteresis. The filter may be omitted (NULL) when no hysteresis is required.
+ * 
+ * Slope and mean criteria are not active before the window has been filled with N samples.
  * ***********************************************************************************************/
 
 #define FAULT_OBJECT_BIT_MASK_DEFAULT   0xFFFF
 
 typedef enum
 {
-    FAULT_LEVEL_GREATER_THAN = 0b0000000000000000, // Flag to perform "greater than" comparison
-    FAULT_LEVEL_LESS_THAN    = 0b0000000000000001, // Flag to perform "less than" comparison
-    FAULT_LEVEL_EQUAL        = 0b0000000000000010, // Flag to perform "is equal" comparison
-    FAULT_LEVEL_NOT_EQUAL    = 0b0000000000000100  // Flag to perform "is not equal than" comparison
+    FAULT_LEVEL_GREATER_THAN  = 0b0000000000000000, // Flag to perform "greater than" comparison
+    FAULT_LEVEL_LESS_THAN     = 0b0000000000000001, // Flag to perform "less than" comparison
+    FAULT_LEVEL_EQUAL         = 0b0000000000000010, // Flag to perform "is equal" comparison
+    FAULT_LEVEL_NOT_EQUAL     = 0b0000000000000100, // Flag to perform "is not equal than" comparison
+    FAULT_LEVEL_SLOPE_RISING  = 0b0000000000001000, // Flag to perform "rising slope over N samples greater than" comparison
+    FAULT_LEVEL_SLOPE_FALLING = 0b0000000000010000, // Flag to perform "falling slope over N samples greater than" comparison
+    FAULT_LEVEL_WINDOW_MEAN   = 0b0000000000100000, // Flag to perform "mean of N samples greater than" comparison
+    FAULT_LEVEL_BAND          = 0b0000000001000000  // Flag to perform "outside of band" comparison
 }FAULT_OBJECT_CONDITION_LEVEL_e;
+
+#define FAULT_LEVEL_FILTERED        (FAULT_LEVEL_SLOPE_RISING | FAULT_LEVEL_SLOPE_FALLING | \
+                                     FAULT_LEVEL_WINDOW_MEAN | FAULT_LEVEL_BAND) // criteria evaluating a derived value
     
 typedef struct
 {
@@ -181,29 +211,134 @@ typedef struct
     volatile uint16_t trip_cnt_threshold; // Fault counter threshold triggering fault exception
 }__attribute__((packed))FAULT_CONDITION_SETTINGS_t;
 
+/*!FAULT_FILTER_t
+ * ***********************************************************************************************
+ * Description:
+ * FAULT_FILTER_t holds the state of the slope, window mean and band criteria of a fault object.
+ * The sample buffer of slope and mean criteria has to provide 2^shift words and is declared by 
+ * the user together with the filter, e.g.
+ * 
+ *      volatile uint16_t fltflt_vin_buffer[FAULT_FILTER_SAMPLES(3)]; // 8 samples
+ *      volatile FAULT_FILTER_t fltflt_vin = { &fltflt_vin_buffer[0], 3, 0, 0, 0, 0 };
+ * 
+ * Index, fill counter and running sum are reset when the fault engine is compiled.
+ * ***********************************************************************************************/
+
+#define FAULT_FILTER_SAMPLES(shift)     (1 << (shift)) // Window length in samples of a filter shift setting
+#define FAULT_FILTER_SHIFT_MAX          8       // Longest supported window 2^FAULT_FILTER_SHIFT_MAX samples
+
+typedef struct
+{
+    volatile uint16_t* buffer; // sample history of 2^shift samples (slope and mean criteria)
+    volatile uint16_t shift; // window length of 2^shift samples (slope and mean criteria)
+    volatile uint16_t index; // ring buffer index of the oldest sample
+    volatile uint16_t fill; // number of samples captured since the last reset (up to 2^shift)
+    volatile uint32_t sum; // running sum of all samples in the window (mean criterion)
+    volatile uint16_t hysteresis; // hysteresis of both band limits (band criterion)
+}__attribute__((packed))FAULT_FILTER_t;
+
+
+/*!FAULT_SCAN_CLASS_e
+ * ***********************************************************************************************
+ * Description:
+ * FAULT_SCAN_CLASS_e determines how often a fault object is checked when the fault handler runs
+ * in FAULT_SCAN_BUDGETED mode (see fault_handler_config.h). In FAULT_SCAN_FULL mode all fault 
+ * objects are checked every scheduler tick regardless of their scan class.
+ * ***********************************************************************************************/
+
+typedef enum
+{
+    FAULT_SCAN_CLASS_FAST = 0, // Fault object is checked every scheduler tick
+    FAULT_SCAN_CLASS_SLOW = 1, // Fault object is checked incrementally under the slow scan class time budget
+    FAULT_SCAN_CLASS_COUNT     // Number of scan classes (has to be the last item of this list)
+}FAULT_SCAN_CLASS_e;
+
+/*!FAULT_TRIGGER_e
+ * ***********************************************************************************************
+ * Description:
+ * FAULT_TRIGGER_e determines if a fault object is polled with every fault check or only checked 
+ * after a fault event has been raised by FAULT_EVENT_RAISE().
+ * ***********************************************************************************************/
+
+typedef enum
+{
+    FAULT_TRIGGER_POLLED = 0, // Fault object is polled by the fault handler
+    FAULT_TRIGGER_EVENT  = 1  // Fault object is checked when a fault event is pending or while not idle
+}FAULT_TRIGGER_e;
+
+/*!FAULT_OBJECT_DESCRIPTOR_t
+ * ***********************************************************************************************
+ * Description:
+ * The fault object descriptor FAULT_OBJECT_DESCRIPTOR_t holds all settings of a fault object 
+ * which do not change at runtime: the monitored object, identifiers, fault classes, fault 
+ * levels, user fault actions, scan class, fault check trigger, fault group and the optional 
+ * hardware binding and fault filter. It also provides the default fault condition criteria 
+ * and the initial status of the fault object.
+ * 
+ * Descriptors are declared as const data, which is located in program memory and accessed 
+ * through the PSV window. They are assigned to their fault objects by fault_ObjectLoad(), e.g.
+ * 
+ *      const FAULT_OBJECT_DESCRIPTOR_t fltdsc_OCP = {
+ *          &i_out, FAULT_OBJECT_BIT_MASK_DEFAULT,  // monitored object and bit mask
+ *          (uint32_t)FLTOBJ_OCP, (uint16_t)FLTOBJ_OCP, // error code and ID
+ *          FAULT_LEVEL_GREATER_THAN, IOUT_OCL_TRIP, 3, IOUT_OCL_RELEASE, 10, // default criteria
+ *          FLT_CLASS_CRITICAL, (FAULT_HW | FLTCHK_ENABLED), // fault classes and initial status
+ *          NULL, NULL, // user fault action and reset functions
+ *          FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, FLTGRP_SYSTEM, // scan class, trigger, group
+ *          NULL, NULL }; // hardware binding and fault filter
+ * 
+ * Please note:
+ * Functions called by interrupt service routines declared with no_auto_psv must not access 
+ * fault object descriptors.
+ * ***********************************************************************************************/
+
+typedef struct FAULT_OBJECT_DESCRIPTOR_s
+{
+    volatile uint16_t* object; // pointer to an object (e.g. variable or SFR) to be monitored
+    uint16_t object_bit_mask; // bit mask filter to monitor specific bits within OBJECT
+    uint32_t error_code; // error code helping to identify source module, system level and importance
+    uint16_t id; // global identifier of this fault object
+    uint16_t fault_ratio; // default fault condition type of type FAULT_OBJECT_CONDITION_LEVEL_e
+    uint16_t trip_level; // default fault trip level
+    uint16_t trip_cnt_threshold; // default number of successive trips before triggering a fault event
+    uint16_t reset_level; // default fault release level
+    uint16_t reset_cnt_threshold; // default number of successive resets before triggering a fault release
+    uint16_t classes; // fault classes of type FAULT_OBJECT_CLASS_e ORed together
+    uint16_t status; // initial fault object status of type FAULT_OBJECT_STATUS_e ORed together
+    volatile uint16_t (*user_fault_action)(void); // pointer to a user function called when a defined fault condition is detected
+    volatile uint16_t (*user_fault_reset)(void); // pointer to a user function called when a defined fault condition is released
+    uint16_t scan_class; // fault scan class of type FAULT_SCAN_CLASS_e
+    uint16_t trigger; // fault check trigger of type FAULT_TRIGGER_e
+    uint16_t group; // index of the fault group of type fault_group_index_e (FAULT_GROUP_NONE = not grouped)
+    volatile FAULT_HW_BINDING_t* hw; // pointer to a hardware binding (NULL = software fault object)
+    volatile FAULT_FILTER_t* filter; // pointer to the state of slope, mean and band criteria (NULL = none)
+}FAULT_OBJECT_DESCRIPTOR_t; // constant fault object settings
 
 /*!FAULT_OBJECT_t
  * ***********************************************************************************************
  * Description:
- * This generic fault object FAULT_OBJECT_t provides a 16-bit address pointer to a variable 
- * or SFR, which is monitored. The fault check response can be set by a TRIP and RELEASE point 
- * threshold as well as a counter based filter, comparing recent successive threshold violations 
- * against a given maximum of tolerable violations before a fault response is triggered.
+ * This generic fault object FAULT_OBJECT_t holds the runtime state of a fault check. The 
+ * constant settings are provided by its descriptor cfg, including a 16-bit address pointer to 
+ * a variable or SFR, which is monitored. The fault check response can be set by a TRIP and 
+ * RELEASE point threshold as well as a counter based filter, comparing recent successive 
+ * threshold violations against a given maximum of tolerable violations before a fault 
+ * response is triggered. Thresholds are loaded from the descriptor and may be tuned at runtime 
+ * (e.g. by the parameter table or the warm boot restore).
+ * 
+ * When a hardware binding is assigned (cfg->hw != NULL), the fault check is executed by the 
+ * comparator and PWM peripherals declared in the binding (see USE_FAULT_HARDWARE_OBJECTS).
  * ***********************************************************************************************/
 
-typedef struct
+typedef struct FAULT_OBJECT_s
 {
     volatile FAULT_OBJECT_STATUS_t status; // status bit field
-    volatile FAULT_OBJECT_CLASS_t classes; // fault class bit field
     volatile FAULT_CONDITION_SETTINGS_t criteria; // Fault check settings of the  fault object
-    volatile uint32_t error_code; // error code helping to identify source module, system level and importance
-    volatile uint16_t id; // global identifier of this fault object
-    volatile uint16_t* object; // pointer to an object (e.g. variable or SFR) to be monitored
-    volatile uint16_t object_bit_mask; // bit mask filter to monitor specific bits within OBJECT
-    volatile uint16_t (*user_fault_action)(void); // pointer to a user function called when a defined fault condition is detected
-    volatile uint16_t (*user_fault_reset)(void); // pointer to a user function called when a defined fault condition is detected
+    volatile uint16_t group_mask; // member flag bit within the fault group (assigned by fault_GroupsBuild())
+    const FAULT_OBJECT_DESCRIPTOR_t* cfg; // pointer to the constant settings of this fault object (NULL = not initialized)
 }__attribute__((packed))FAULT_OBJECT_t; // global fault object data structure
 
+#define FAULT_OBJECT_LOADED(fltobj) (((fltobj)->cfg != NULL) && ((fltobj)->cfg->object != NULL)) // fault object has been initialized
+
 /*!fault_object_list[]
  * ***********************************************************************************************
  * Description:
@@ -215,6 +350,121 @@ typedef struct
 extern volatile FAULT_OBJECT_t *fault_object_list[];
 extern volatile uint16_t fltobj_list_size;
 
+/*!FAULT_GROUP_t
+ * ***********************************************************************************************
+ * Description:
+ * A fault group collects up to FAULT_GROUP_MEMBERS_MAX fault objects. Bit n of the flag words 
+ * active and stat represents the fault condition and fault status of member n. Both words and 
+ * the fault class summary classes are updated with each change of a member, so that a group 
+ * is tested by one word compare:
+ * 
+ *      if (FAULT_GROUP_HEALTHY(FLTGRP_CONVERTER_VOUT)) { ... }
+ * 
+ * The recover flags mark members which have tripped since the previous fault recovery.
+ * fault_group_summary holds the fault classes of all tripped fault objects of all groups.
+ * 
+ * Please note:
+ * The fault group array fault_group[] and its size fault_group_count are declared by the user 
+ * (see task_FaultHandler.c).
+ * ***********************************************************************************************/
+
+#if (USE_FAULT_GROUPS == 1)
+
+typedef struct
+{
+    volatile uint16_t active; // packed fault active flags of all members (most recent condition violation)
+    volatile uint16_t stat; // packed fault status flags of all members (triggered fault conditions)
+    volatile uint16_t classes; // fault classes of all tripped members ORed together
+    volatile uint16_t recover; // packed flags of members tripped since the previous fault recovery
+    volatile uint16_t members; // packed flags of assigned members
+    volatile FAULT_OBJECT_t* member[FAULT_GROUP_MEMBERS_MAX]; // pointers to the member fault objects
+}FAULT_GROUP_t;
+
+extern volatile FAULT_GROUP_t fault_group[];
+extern volatile uint16_t fault_group_count;
+extern volatile uint16_t fault_group_summary;
+
+#define FAULT_GROUP_HEALTHY(grp)    (fault_group[(grp)].stat == 0) // no member of the group has tripped
+#define FAULT_GROUP_CLASSES(grp)    (fault_group[(grp)].classes) // fault classes of all tripped members of the group
+
+#endif
+
+/*!FAULT_ENGINE_t
+ * ***********************************************************************************************
+ * Description:
+ * The fault engine data structure FAULT_ENGINE_t holds the settings of all fault objects of 
+ * fault_object_list[] in a struct-of-arrays layout. LESS_THAN comparisons are converted into 
+ * GREATER_THAN comparisons by inverting the monitored value and the levels using the compare 
+ * key (XOR 0xFFFF), so that all hysteresis comparisons are executed by the same code sequence.
+ * The active and status flags of object n are bit (n & 0x0F) of word (n >> 4) of the packed
+ * flag arrays.
+ * 
+ * This data structure is only accessed by the fault handler. It is generated from the fault 
+ * objects by fault_EngineCompile().
+ * ***********************************************************************************************/
+
+#if (USE_FAULT_ENGINE == 1)
+
+typedef enum {
+    FAULT_ENGINE_CMP_HYSTERESIS = 0b0000000000000000, // Trip/reset levels with hysteresis (greater than/less than)
+    FAULT_ENGINE_CMP_EQUAL      = 0b0000000000000001, // Trip level equality compare
+    FAULT_ENGINE_CMP_INVERT     = 0b0000000000000010, // Inverted equality compare (not equal)
+    FAULT_ENGINE_CMP_FILTER     = 0b0000000000000100  // Compare of a value derived by the fault filter (slope, mean, band)
+}FAULT_ENGINE_COMPARE_MODE_e;
+
+typedef struct
+{
+    volatile uint16_t* object[FAULT_ENGINE_OBJECTS_MAX]; // pointers to monitored objects
+    uint16_t mask[FAULT_ENGINE_OBJECTS_MAX]; // bit masks filtering the monitored objects
+    uint16_t key[FAULT_ENGINE_OBJECTS_MAX]; // compare keys (0x0000 = greater than, 0xFFFF = less than)
+    uint16_t mode[FAULT_ENGINE_OBJECTS_MAX]; // compare modes of type FAULT_ENGINE_COMPARE_MODE_e
+    uint16_t trip_level[FAULT_ENGINE_OBJECTS_MAX]; // trip levels (XOR compare key)
+    uint16_t reset_level[FAULT_ENGINE_OBJECTS_MAX]; // reset levels (XOR compare key)
+    uint16_t trip_cnt_threshold[FAULT_ENGINE_OBJECTS_MAX]; // fault counter thresholds triggering fault exceptions
+    uint16_t reset_cnt_threshold[FAULT_ENGINE_OBJECTS_MAX]; // fault counter thresholds resetting fault exceptions
+    uint16_t counter[FAULT_ENGINE_OBJECTS_MAX]; // fault hit counters (mirrored into fltobj->criteria.counter)
+    uint16_t fault_class[FAULT_ENGINE_OBJECTS_MAX]; // fault classes of type FAULT_OBJECT_CLASS_e
+    volatile FAULT_OBJECT_t* fltobj[FAULT_ENGINE_OBJECTS_MAX]; // pointers to the source fault objects
+    uint16_t active[FAULT_ENGINE_WORDS]; // packed fault active flags (most recent condition violation)
+    uint16_t stat[FAULT_ENGINE_WORDS]; // packed fault status flags (triggered fault conditions)
+    uint16_t count; // number of fault objects compiled into the fault engine
+    uint16_t slow_first; // index of the first SLOW scan class fault object
+    uint16_t event_first; // index of the first event-triggered fault object
+    uint16_t index[FAULT_EVENT_INDEX_MAX]; // fault engine index of each fault object in fault_object_list[] (0xFFFF = not compiled)
+    uint16_t due[FAULT_ENGINE_WORDS]; // packed flags of event-triggered fault objects with pending events
+    uint16_t slow_budget; // time budget of SLOW scan class objects per tick in timer ticks (see FAULT_SCAN_SLOW_BUDGET)
+    uint16_t compiled; // flag indicating that the fault engine has been compiled
+}FAULT_ENGINE_t;
+
+typedef struct
+{
+    volatile uint16_t ticks; // scheduler ticks since the start of the recent scan
+    volatile uint16_t latency; // scheduler ticks required for the most recent complete scan
+    volatile uint16_t latency_max; // longest scan latency captured
+    volatile uint16_t passes; // number of complete scans
+}__attribute__((packed))FAULT_SCAN_STATUS_t;
+
+extern FAULT_ENGINE_t fault_engine;
+extern volatile FAULT_SCAN_STATUS_t fault_scan[]; // scan latency monitor of each scan class (index FAULT_SCAN_CLASS_e)
+
+#endif
+
+
+/*!FAULT_EVENT_RAISE
+ * ***********************************************************************************************
+ * Description:
+ * Raises a fault event for the event-triggered fault object of index fltobj_index in 
+ * fault_object_list[]. This macro may be called from interrupt service routines of any priority.
+ * When fltobj_index is a constant (e.g. a label of fault_object_index_e), the bit is set by one
+ * single bit-set instruction and no interrupt needs to be held off.
+ * 
+ * Example: 
+ *      FAULT_EVENT_RAISE(FLTOBJ_OCP);
+ * ***********************************************************************************************/
+
+extern volatile uint16_t fault_pending[]; // pending-fault bitmap (bit n = fault_object_list[n])
+
+#define FAULT_EVENT_RAISE(fltobj_index) { fault_pending[((fltobj_index) >> 4)] |= (1 << ((fltobj_index) & 0x000F)); }
 
 /*!CPU Reset Classes
  * ***********************************************************************************************
@@ -248,7 +498,16 @@ extern volatile uint16_t fltobj_list_size;
  * ***********************************************************************************************/
 extern volatile uint16_t CheckCPUResetRootCause(void);
 extern volatile uint16_t exec_FaultCheckAll(void);
-//extern inline volatile uint16_t exec_FaultCheckSequential(void);
+extern volatile uint16_t fault_ObjectLoad(volatile FAULT_OBJECT_t* fltobj, const FAULT_OBJECT_DESCRIPTOR_t* cfg);
+#if (USE_FAULT_ENGINE == 1)
+extern volatile uint16_t fault_EngineCompile(void);
+#endif
+#if (USE_FAULT_GROUPS == 1)
+extern volatile uint16_t fault_GroupsBuild(void);
+#endif
+#if (USE_FAULT_ENGINE == 1) && (FAULT_SCAN_MODE == FAULT_SCAN_BUDGETED)
+extern volatile uint16_t exec_FaultCheckSequential(void);
+#endif
 
 #endif	/* _ROOT_LAYER_FAULT_HANDLER_H_ */
 
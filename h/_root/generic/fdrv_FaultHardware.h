@@ -0,0 +1,141 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fdrv_FaultHardware.h
+ *****************************************************************************
+ * File:   fdrv_FaultHardware.h
+ *
+ * Summary:
+ * Hardware-assisted fault objects bound to PWM PCI and comparator/DAC peripherals
+ *
+ * Description:	
+ * Fault objects with a hardware binding are executed by an analog comparator 
+ * and the Fault PCI logic of a PWM generator (see USE_FAULT_HARDWARE_OBJECTS).
+ * The peripheral registers are programmed directly from the trip and reset 
+ * levels of the fault object. The software fault object mirrors the comparator
+ * output and handles the fault recovery.
+ *
+ * References:
+ * dsPIC33/PIC24 Family Reference Manual, High-Resolution PWM with Fine Edge Placement
+ * dsPIC33/PIC24 Family Reference Manual, High-Speed Analog Comparator with Slope Compensation DAC
+ *
+ * See also:
+ * fdrv_FaultHardware.c
+ * fault_handler_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_FAULT_HARDWARE_H_
+#define	_ROOT_FAULT_HARDWARE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/fault_handler_config.h"
+
+/*!FAULT_HW_BINDING_t
+ * ***********************************************************************************************
+ * Description:
+ * The hardware binding of a fault object declares the peripheral instances executing the fault 
+ * check and fault response:
+ * 
+ *      - dac_instance: index of the comparator/DAC instance monitoring the signal (1, 2, 3, ...)
+ *      - cmp_input:    comparator input selection (INSEL<2:0>, see device data sheet)
+ *      - pwm_instance: index of the PWM generator shut down by the comparator (1, 2, 3, ...)
+ *      - pci_source:   PCI source selection of the comparator output (PSS<4:0>, see device 
+ *                      data sheet)
+ *      - fault_state:  state of the PWMxH/PWMxL outputs during fault (FLTDAT<1:0>)
+ * 
+ * The comparator polarity is derived from criteria.fault_ratio of the fault object 
+ * (FAULT_LEVEL_LESS_THAN inverts the comparator output). The status pointer and status mask are 
+ * set by fault_HwBind() and point to the comparator status bit.
+ * 
+ * Example:
+ *      volatile FAULT_HW_BINDING_t fltobj_OCP_hw;
+ *      const FAULT_OBJECT_DESCRIPTOR_t fltdsc_OCP = { ..., // criteria FAULT_LEVEL_GREATER_THAN, 
+ *          ..., &fltobj_OCP_hw, NULL }; // IOUT_OCL_TRIP and IOUT_OCL_RELEASE, hardware binding
+ * 
+ *      fltobj_OCP_hw.dac_instance = 1;
+ *      fltobj_OCP_hw.cmp_input = 0;
+ *      fltobj_OCP_hw.pwm_instance = 1;
+ *      fltobj_OCP_hw.pci_source = FAULT_HW_PCI_SOURCE_CMP1;
+ *      fltobj_OCP_hw.fault_state = FAULT_HW_PWM_FAULT_STATE_LOW;
+ *      fres &= fault_ObjectLoad(&fltobj_OCP, &fltdsc_OCP);
+ *      fres &= fault_HwBind(&fltobj_OCP);
+ * ***********************************************************************************************/
+
+typedef struct FAULT_HW_BINDING_s
+{
+    volatile uint16_t dac_instance; // comparator/DAC instance monitoring the signal (1, 2, 3, ...)
+    volatile uint16_t cmp_input; // comparator input selection INSEL<2:0>
+    volatile uint16_t pwm_instance; // PWM generator instance shut down by the comparator (1, 2, 3, ...)
+    volatile uint16_t pci_source; // PCI source selection PSS<4:0> of the comparator output
+    volatile uint16_t fault_state; // PWMxH/PWMxL output state during fault FLTDAT<1:0>
+    volatile uint16_t* status; // pointer to the comparator status register (set by fault_HwBind)
+    volatile uint16_t status_mask; // comparator status bit mask (set by fault_HwBind)
+}__attribute__((packed))FAULT_HW_BINDING_t;
+
+/*!FAULT_HW_PGxIOCONL
+ * ***********************************************************************************************
+ * Description:
+ * Access to the PWM generator output control register PGxIOCONL by generator index (1, 2, 3, ...)
+ * using the register block offset of the PWM generators in the device register map. This macro 
+ * is also used by the trap handler to force the PWM outputs into a safe state.
+ * ***********************************************************************************************/
+
+#define FAULT_HW_PG_REG_OFFSET      0x0028  // PG1CONL to PG2CONL (80 bytes)
+#define FAULT_HW_PGxIOCONL(n)       (*((volatile uint16_t*)&PG1IOCONL + (((n)-1) * FAULT_HW_PG_REG_OFFSET)))
+
+#define FAULT_HW_PGxIOCONL_OVRENH   0b0010000000000000  // PWMxH output override enable
+#define FAULT_HW_PGxIOCONL_OVRENL   0b0001000000000000  // PWMxL output override enable
+#define FAULT_HW_PGxIOCONL_OVRDAT   0b0000110000000000  // PWMxH/PWMxL output override state OVRDAT<1:0>
+#define FAULT_HW_PGxIOCONL_OSYNC    0b0000001100000000  // output override synchronization OSYNC<1:0>
+#define FAULT_HW_PGxIOCONL_OSYNC_IMMEDIATE 0b0000000100000000 // output overrides take effect immediately
+#define FAULT_HW_PGxIOCONL_FLTDAT   0b0000000011000000  // PWM output state during fault FLTDAT<1:0>
+
+#if (USE_FAULT_HARDWARE_OBJECTS == 1)
+
+/* PWM output states during fault (FLTDAT<1:0> = PWMxH:PWMxL) */
+#define FAULT_HW_PWM_FAULT_STATE_LOW        0b00    // PWMxH and PWMxL are driven low during fault
+#define FAULT_HW_PWM_FAULT_STATE_L_HIGH     0b01    // PWMxL is driven high, PWMxH is driven low during fault
+#define FAULT_HW_PWM_FAULT_STATE_H_HIGH     0b10    // PWMxH is driven high, PWMxL is driven low during fault
+
+/* PCI source selections of the comparator outputs (PSS<4:0>, please check device data sheet) */
+#define FAULT_HW_PCI_SOURCE_CMP1            0b11011 // Comparator 1 output
+#define FAULT_HW_PCI_SOURCE_CMP2            0b11100 // Comparator 2 output
+#define FAULT_HW_PCI_SOURCE_CMP3            0b11101 // Comparator 3 output
+
+/* Public function prototypes */
+struct FAULT_OBJECT_s; // fault object data structure declared in fdrv_FaultHandler.h
+extern volatile uint16_t fault_HwBind(volatile struct FAULT_OBJECT_s* fltobj);
+extern volatile uint16_t fault_HwTrip(volatile struct FAULT_OBJECT_s* fltobj);
+extern volatile uint16_t fault_HwRecover(volatile struct FAULT_OBJECT_s* fltobj);
+
+#endif
+
+#endif	/* _ROOT_FAULT_HARDWARE_H_ */
+
+// EOF
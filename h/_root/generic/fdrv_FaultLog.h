@@ -0,0 +1,127 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fdrv_FaultLog.h
+ *****************************************************************************
+ * File:   fdrv_FaultLog.h
+ *
+ * Summary:
+ * Persistent fault and trap event log
+ *
+ * Description:	
+ * Fault trips, fault mode recoveries, CPU traps and CPU resets are captured 
+ * as compact binary records in a ring buffer located in persistent RAM (see 
+ * USE_FAULT_LOG), which survives soft resets. Records are flushed into a
+ * reserved region of program memory in the background for post-mortem 
+ * analysis.
+ *
+ * References:
+ * dsPIC33/PIC24 Family Reference Manual, Flash Programming
+ *
+ * See also:
+ * fdrv_FaultLog.c
+ * fault_handler_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_FAULT_LOG_H_
+#define	_ROOT_FAULT_LOG_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/fault_handler_config.h"
+
+#if (USE_FAULT_LOG == 1)
+
+/*!FAULT_LOG_EVENT_e
+ * ***********************************************************************************************
+ * Description:
+ * Type of the event captured by a fault log record
+ * ***********************************************************************************************/
+
+typedef enum {
+    FAULT_LOG_EVENT_RESET           = 0x0001, // CPU reset (id = 0, value = RCON)
+    FAULT_LOG_EVENT_FAULT_TRIP      = 0x0002, // Fault status of a fault object has been set (id = fault object ID, value = monitored value)
+    FAULT_LOG_EVENT_FAULT_RECOVERY  = 0x0003, // Fault handler recovered from fault mode (id = 0, value = 0)
+    FAULT_LOG_EVENT_TRAP            = 0x0004, // CPU trap (id = trap ID of type TRAP_ID_e, value = INTTREG)
+    FAULT_LOG_EVENT_WATCHDOG        = 0x0005  // Watchdog window closed with missing check-ins (id = task ID, value = missing check-in bits)
+}FAULT_LOG_EVENT_e;
+
+/*!FAULT_LOG_RECORD_t
+ * ***********************************************************************************************
+ * Description:
+ * Fault log record of eight 16-bit words. The sequence number is counted up with every record
+ * written (0xFFFF is never used and marks an empty record in program memory).
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint16_t sequence; // running record sequence number
+    volatile uint16_t timestamp; // scheduler tick counter value at the time of the event
+    volatile uint16_t event; // event type of type FAULT_LOG_EVENT_e
+    volatile uint16_t id; // fault object ID or trap ID
+    volatile uint16_t op_mode; // operating mode at the time of the event
+    volatile uint32_t proc_code; // task manager process code at the time of the event
+    volatile uint16_t value; // event specific value snapshot
+}__attribute__((packed))FAULT_LOG_RECORD_t;
+
+#define FAULT_LOG_RECORD_WORDS      (sizeof(FAULT_LOG_RECORD_t) >> 1) // Number of 16-bit words per record
+
+/*!FAULT_LOG_STATUS_t
+ * ***********************************************************************************************
+ * Description:
+ * Status of the persistent RAM ring buffer. The check word is used to validate the ring buffer 
+ * after a soft reset.
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint16_t head; // index of the next record to be written
+    volatile uint16_t count; // number of records held in the ring buffer
+    volatile uint16_t unflushed; // number of most recent records not yet written to program memory
+    volatile uint16_t sequence; // sequence number of the next record
+    volatile uint16_t dropped; // number of records overwritten before being written to program memory
+    volatile uint16_t check; // check word validating the ring buffer status
+}__attribute__((packed))FAULT_LOG_STATUS_t;
+
+extern volatile FAULT_LOG_STATUS_t __attribute__((__persistent__))fault_log_status;
+extern volatile FAULT_LOG_RECORD_t __attribute__((__persistent__))fault_log[];
+#if (USE_FAULT_LOG_FLASH == 1)
+extern volatile uint32_t fault_log_flash_base; // program memory address of the fault log region
+#endif
+
+/* Public function prototypes */
+extern volatile uint16_t init_FaultLog(volatile uint16_t power_on_reset);
+extern volatile uint16_t fault_LogWrite(volatile uint16_t event, volatile uint16_t id, volatile uint16_t value);
+extern volatile uint16_t fault_LogRead(volatile uint16_t index, volatile FAULT_LOG_RECORD_t* record);
+#if (USE_FAULT_LOG_FLASH == 1)
+extern volatile uint16_t exec_FaultLogFlush(void);
+#endif
+
+#endif
+
+#endif	/* _ROOT_FAULT_LOG_H_ */
+
+// EOF
@@ -0,0 +1,138 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!msi_exchange.h
+ *****************************************************************************
+ * File:   msi_exchange.h
+ *
+ * Summary:
+ * Double-buffered master/slave core data exchange through MSI mailboxes
+ *
+ * Description:	
+ * The transmit and receive data blocks are held in two buffers each. The 
+ * application writes transmit data into the buffer msi_TxData() and hands it
+ * over by calling msi_Publish(). Received data is always read from the buffer 
+ * msi_RxData(), which holds the most recent complete data set. Hence, neither
+ * side ever accesses a partially transferred data set.
+ * 
+ * The master core starts the slave core early in its boot task queue. Both 
+ * cores then boot in parallel. The slave core signals the completion of its 
+ * startup by the slave-to-master interrupt request STMIRQ, which is 
+ * acknowledged by the master core (boot handshake). Mailbox data is only 
+ * exchanged after the boot handshake has been completed.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * msi_exchange.c
+ * msi_exchange_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_MSI_EXCHANGE_H_
+#define	_ROOT_MSI_EXCHANGE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/msi_exchange_config.h"
+
+#if (MSI_CORE_ROLE != MSI_ROLE_NONE)
+
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+
+  typedef MSI_M2S_DATA_t MSI_TX_DATA_t; // Master transmits protocol block A
+  typedef MSI_S2M_DATA_t MSI_RX_DATA_t; // Master receives protocol block B
+
+  #define MSI_TX_MAILBOX            ((volatile uint16_t*)&MSI1MBX0D) // First transmit mailbox register
+  #define MSI_RX_MAILBOX            ((volatile uint16_t*)&MSI1MBX8D) // First receive mailbox register
+  #define MSI_TX_DATA_READY         MSI1MBXSbits.DTRDYA // Transmit data not yet read by the slave core
+  #define MSI_RX_DATA_READY         MSI1MBXSbits.DTRDYB // New receive data written by the slave core
+
+#else
+
+  typedef MSI_S2M_DATA_t MSI_TX_DATA_t; // Slave transmits protocol block B
+  typedef MSI_M2S_DATA_t MSI_RX_DATA_t; // Slave receives protocol block A
+
+  #define MSI_TX_MAILBOX            ((volatile uint16_t*)&SI1MBX8D) // First transmit mailbox register
+  #define MSI_RX_MAILBOX            ((volatile uint16_t*)&SI1MBX0D) // First receive mailbox register
+  #define MSI_TX_DATA_READY         SI1MBXSbits.DTRDYB // Transmit data not yet read by the master core
+  #define MSI_RX_DATA_READY         SI1MBXSbits.DTRDYA // New receive data written by the master core
+
+#endif
+
+/* Data structures */
+
+typedef union {
+    volatile MSI_TX_DATA_t data; // Transmit data block
+    volatile uint16_t words[MSI_MAILBOX_BLOCK_SIZE]; // Mailbox register image
+} MSI_TX_BUFFER_t;
+
+typedef union {
+    volatile MSI_RX_DATA_t data; // Receive data block
+    volatile uint16_t words[MSI_MAILBOX_BLOCK_SIZE]; // Mailbox register image
+} MSI_RX_BUFFER_t;
+
+typedef struct {
+    volatile bool link_active :1; // Bit 0: Data is received from the other core
+    volatile bool link_lost :1; // Bit 1: No new data has been received for MSI_LINK_TIMEOUT transfers
+    volatile bool tx_pending :1; // Bit 2: A published data set is waiting for transmission
+    volatile bool remote_ready :1; // Bit 3: Boot handshake with the other core has been completed
+    volatile unsigned :11; // Bit 4-14: (reserved)
+    volatile bool enabled :1; // Bit 15: Data exchange has been initialized
+} __attribute__((packed)) MSI_STATUS_FLAGS_t;
+
+typedef union {
+    volatile uint16_t value; // 16-bit wide access to status bit field
+    volatile MSI_STATUS_FLAGS_t flags; // single bit access to status bit field
+} MSI_STATUS_t;
+
+typedef struct {
+    volatile MSI_TX_BUFFER_t tx[2]; // Transmit buffers
+    volatile MSI_RX_BUFFER_t rx[2]; // Receive buffers
+    volatile uint16_t tx_write; // Index of the transmit buffer written by the application
+    volatile uint16_t rx_read; // Index of the receive buffer holding the most recent complete data set
+    volatile uint16_t tx_sequence; // Sequence counter of the most recently published data set
+    volatile uint16_t rx_timeout; // Transfers since the last new data set has been received
+    volatile uint16_t tx_overruns; // Published data sets replaced before they could be transmitted
+    volatile MSI_STATUS_t status; // Data exchange status
+} MSI_EXCHANGE_t;
+
+#define msi_TxData()    (&msi.tx[msi.tx_write].data) // Transmit data set written by the application
+#define msi_RxData()    (&msi.rx[msi.rx_read].data)  // Most recent complete receive data set
+
+// Public data exchange data structure declaration
+extern volatile MSI_EXCHANGE_t msi;
+
+// Public data exchange function prototypes
+extern volatile uint16_t msi_Init(void);
+extern volatile uint16_t msi_Publish(void);
+extern volatile uint16_t msi_Transfer(void);
+
+#endif  /* MSI_CORE_ROLE */
+
+#endif	/* _ROOT_MSI_EXCHANGE_H_ */
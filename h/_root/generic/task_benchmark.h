@@ -0,0 +1,136 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_benchmark.h
+ *****************************************************************************
+ * File:   task_benchmark.h
+ *
+ * Summary:
+ * On-target micro-benchmark of the framework hot paths
+ *
+ * Description:	
+ * The benchmark task measures the execution time of the functions called by
+ * the scheduler in every time slot in CPU cycles of a free running timer (see 
+ * USE_TASK_MANAGER_BENCHMARK). Results are collected in a result table which
+ * serves as regression baseline between firmware releases.
+ * 
+ * When the benchmark is disabled (USE_TASK_MANAGER_BENCHMARK = 0), the task 
+ * function returns immediately and its task queue entry is removed (see 
+ * BENCH_ENTRY in tasks.h).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_benchmark.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_BENCHMARK_H_
+#define	_ROOT_TASK_BENCHMARK_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+
+/*!Benchmark Case Registry
+ * *****************************************************************************************************
+ * Benchmark Case Registry lists all measurements taken by the benchmark task
+ * *****************************************************************************************************
+ * Each benchmark case is registered by one line CASE(case_id, function, variant). The function
+ * prepares the input conditions of the given variant, captures the cycle counter before and after
+ * the call of the function under test and returns the elapsed CPU cycles. Cases are sampled in 
+ * order of appearance.
+ * 
+ * The registry is expanded at compile time into
+ * 
+ *   - the benchmark case enumeration bench_case_e (index of bench_results[])
+ *   - the constant benchmark case table located in program memory (see task_benchmark.c)
+ * *****************************************************************************************************/
+
+typedef enum {
+    BENCH_VARIANT_DEFAULT = 0, // Function under test is called in its recent state
+    BENCH_VARIANT_SWITCH  = 1, // Operation mode switch-over is enforced (recent mode is selected again)
+    BENCH_VARIANT_EVENTS  = 2  // Fault events are pending for all event-triggered fault objects
+} BENCH_VARIANT_e;
+
+#define BENCH_CASE_REGISTRY(CASE) \
+    CASE(BENCH_CASE_TASK_DISPATCH, bench_TaskManagerTick, BENCH_VARIANT_DEFAULT)            /* task_manager_tick() dispatching TASK_IDLE */ \
+    CASE(BENCH_CASE_OP_MODE_CHECK, bench_CheckOperationModeStatus, BENCH_VARIANT_DEFAULT)   /* task_CheckOperationModeStatus() without mode change */ \
+    CASE(BENCH_CASE_OP_MODE_SWITCH, bench_CheckOperationModeStatus, BENCH_VARIANT_SWITCH)   /* task_CheckOperationModeStatus() with task queue switch-over */ \
+    CASE(BENCH_CASE_SYSTEM_STATUS, bench_CaptureSystemStatus, BENCH_VARIANT_DEFAULT)        /* exec_CaptureSystemStatus() */ \
+    CASE(BENCH_CASE_FAULT_CHECK, bench_FaultCheckAll, BENCH_VARIANT_DEFAULT)                /* exec_FaultCheckAll() without pending fault events */ \
+    CASE(BENCH_CASE_FAULT_CHECK_EVENTS, bench_FaultCheckAll, BENCH_VARIANT_EVENTS)          /* exec_FaultCheckAll() with all fault events pending */
+
+#define BENCH_CASE_REGISTRY_ENUM(id, function, variant)     id,
+
+typedef enum {
+    
+    BENCH_CASE_REGISTRY(BENCH_CASE_REGISTRY_ENUM)
+
+    BENCH_CASE_COUNT // Number of registered benchmark cases (has to be the last item of this list)
+            
+} bench_case_e;
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t (*function)(volatile uint16_t variant); // Function measuring one sample in CPU cycles
+    uint16_t variant; // Input condition variant of type BENCH_VARIANT_e
+} bench_case_descriptor_t;
+
+typedef struct {
+    volatile uint16_t minimum; // Shortest execution time in CPU cycles
+    volatile uint16_t maximum; // Longest execution time in CPU cycles
+    volatile uint16_t average; // Average execution time in CPU cycles (valid when all samples have been taken)
+    volatile uint16_t samples; // Number of samples taken
+    volatile uint32_t sum; // Accumulated execution time of all samples
+} __attribute__((packed))bench_result_t;
+
+typedef struct {
+    volatile uint16_t case_index; // Benchmark case recently sampled (BENCH_CASE_COUNT = benchmark complete)
+    volatile uint16_t overhead; // CPU cycles of an empty measurement window subtracted from each sample
+    volatile uint16_t select; // Benchmark case copied into the result view
+    volatile bench_result_t view; // Copy of the selected result (read by the parameter access protocol)
+    volatile bool complete; // Flag indicating that all benchmark cases have been sampled
+} __attribute__((packed))bench_status_t;
+
+// Public Benchmark data structure declarations
+extern volatile bench_result_t bench_results[]; // Benchmark results, indexed by benchmark case ID
+extern volatile bench_status_t bench; // Benchmark status
+
+// Public Benchmark Function Prototypes
+extern volatile uint16_t init_TaskBenchmark(void);
+
+#endif  /* USE_TASK_MANAGER_BENCHMARK */
+
+extern volatile uint16_t exec_TaskBenchmark(void);
+
+#endif	/* _ROOT_TASK_BENCHMARK_H_ */
@@ -0,0 +1,138 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_bootprof.h
+ *****************************************************************************
+ * File:   task_bootprof.h
+ *
+ * Summary:
+ * Boot time profiler of startup steps and startup task queues
+ *
+ * Description:	
+ * The boot profiler records start time, end time and accumulated execution
+ * time of every startup step into the persistent record boot_profile (see 
+ * USE_TASK_MANAGER_BOOT_PROFILER). Steps executed before the scheduler is 
+ * started are recorded by BOOT_PROF_STEP(), task queue entries of the startup 
+ * operation modes are recorded by the task manager.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_bootprof.c
+ * task_manager_config.h
+ * support/bootprof/boot_report.py
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_BOOT_PROFILER_H_
+#define	_ROOT_TASK_BOOT_PROFILER_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+/*!BOOT_STEP_e
+ * ***********************************************************************************************
+ * Description:
+ * IDs of the steps executed before the scheduler is started. Step records of task queue 
+ * entries are identified by the operation mode index in the high byte and the task ID in the
+ * low byte. The host-side readout needs to be kept in sync with this list.
+ * ***********************************************************************************************/
+
+typedef enum {
+    BOOT_STEP_WARM_BOOT_CHECK   = 0xFF00, // warm_boot_Check()
+    BOOT_STEP_DEVICE_RESET      = 0xFF01, // Device_Reset()
+    BOOT_STEP_USER_STARTUP      = 0xFF02, // ExecuteUserStartupCode()
+    BOOT_STEP_CLOCK_INIT        = 0xFF03, // CLOCK_Initialize()
+    BOOT_STEP_OS_INIT           = 0xFF04  // OS_Initialize()
+}BOOT_STEP_e;
+
+#define BOOT_STEP_COUNT         5 // Number of steps executed before the scheduler is started
+
+/*!Boot Profiler Hooks
+ * ***********************************************************************************************
+ * Description:
+ * Hooks of the steps executed before the scheduler is started, of the task queue entries 
+ * executed by the task manager and of operation mode switch-overs. When the boot profiler is 
+ * disabled, hooks expand to nothing.
+ * ***********************************************************************************************/
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+  #define BOOT_PROF_STEP(step)      { boot_ProfileStep(step); }
+  #define BOOT_PROF_SUSPEND()       { boot_ProfileSuspend(); }
+  #define BOOT_PROF_RESUME()        { boot_ProfileResume(); }
+  #define BOOT_PROF_TASK_BEGIN()    { boot_ProfileTaskBegin(); }
+  #define BOOT_PROF_TASK_END(index, task_id)  { boot_ProfileTaskEnd(index, task_id); }
+  #define BOOT_PROF_MODE(mode_index)  { boot_ProfileMode(mode_index); }
+#else
+  #define BOOT_PROF_STEP(step)      { }
+  #define BOOT_PROF_SUSPEND()       { }
+  #define BOOT_PROF_RESUME()        { }
+  #define BOOT_PROF_TASK_BEGIN()    { }
+  #define BOOT_PROF_TASK_END(index, task_id)  { }
+  #define BOOT_PROF_MODE(mode_index)  { }
+#endif
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t id; // Step ID of type BOOT_STEP_e or (operation mode index << 8 | task ID)
+    volatile uint16_t calls; // Number of calls
+    volatile uint32_t start; // Time of the first call since reset in [us]
+    volatile uint32_t end; // Time of the return of the most recent call since reset in [us]
+    volatile uint32_t busy; // Accumulated execution time of all calls in [us]
+} __attribute__((packed))BOOT_PROF_STEP_t;
+
+typedef struct {
+    volatile uint16_t complete; // Flag indicating that the startup operation modes have been left
+    volatile uint16_t count; // Number of step records in use
+    volatile uint16_t size; // Number of step records (read by the host-side readout)
+    volatile uint16_t final_mode; // Operation mode index of the first operation mode after startup
+    volatile uint32_t total; // Time from reset until the first operation mode after startup in [us]
+    volatile uint32_t mode_start[3]; // Time when BOOT, DEVICE_STARTUP and SYSTEM_STARTUP have been entered in [us]
+    volatile BOOT_PROF_STEP_t step[BOOT_PROF_SIZE]; // Step records
+} __attribute__((packed))BOOT_PROFILE_t;
+
+// Public boot profiler data structure declaration
+extern volatile BOOT_PROFILE_t __attribute__((__persistent__))boot_profile;
+
+// Public boot profiler function prototypes
+extern volatile uint16_t init_BootProfile(volatile uint16_t power_on_reset);
+extern volatile uint16_t boot_ProfileStep(volatile uint16_t step);
+extern volatile uint16_t boot_ProfileSuspend(void);
+extern volatile uint16_t boot_ProfileResume(void);
+extern volatile uint16_t boot_ProfileActive(void);
+extern volatile uint16_t boot_ProfileTaskBegin(void);
+extern volatile uint16_t boot_ProfileTaskEnd(volatile uint16_t index, volatile uint16_t task_id);
+extern volatile uint16_t boot_ProfileMode(volatile uint16_t mode_index);
+
+#endif  /* USE_TASK_MANAGER_BOOT_PROFILER */
+
+#endif	/* _ROOT_TASK_BOOT_PROFILER_H_ */
@@ -0,0 +1,88 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_event.h
+ *****************************************************************************
+ * File:   task_event.h
+ *
+ * Summary:
+ * Publish/subscribe event bus between tasks, task manager and fault handler
+ *
+ * Description:	
+ * Events of the fixed event ID space declared in apl/config/events.h are 
+ * posted by EVENT_POST() and taken by subscribers using task_EventTake() 
+ * (see USE_TASK_MANAGER_EVENT_BUS). The delivery state of all events is 
+ * held in the data structure task_event_bus.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_event.c
+ * task_manager_config.h
+ * apl/config/events.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_EVENT_H_
+#define	_ROOT_TASK_EVENT_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_EVENT_BUS == 1)
+
+#include "apl/config/events.h"
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t undelivered[EVENT_COUNT]; // Per event: bitmask of subscribers which have not taken the recent post yet
+    volatile uint16_t subscribers[EVENT_COUNT]; // Per event: bitmask of subscribers which have declared the event
+} __attribute__((packed))task_event_bus_t;
+
+// Public Event Bus data structure declarations
+extern volatile task_event_bus_t task_event_bus; // Event delivery state
+
+// Public Event Bus Function Prototypes
+extern volatile uint16_t init_EventBus(void);
+extern volatile uint16_t task_EventTake(volatile uint16_t subscriber, volatile uint16_t events);
+
+/*!EVENT_POST
+ * ***********************************************************************************************
+ * Description:
+ * Posts the event id of type task_event_id_e to all subscribers which have declared the event.
+ * Posting is a single word write and may be used in interrupt service routines.
+ * ***********************************************************************************************/
+#define EVENT_POST(id)  { task_event_bus.undelivered[(id)] = task_event_bus.subscribers[(id)]; }
+
+#else
+  #define EVENT_POST(id)
+#endif  /* USE_TASK_MANAGER_EVENT_BUS */
+
+#endif	/* _ROOT_TASK_EVENT_H_ */
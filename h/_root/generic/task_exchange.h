@@ -0,0 +1,137 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_exchange.h
+ *****************************************************************************
+ * File:   task_exchange.h
+ *
+ * Summary:
+ * Lock-free data exchange between interrupt service routines and tasks
+ *
+ * Description:	
+ * This file declares three primitives which allow interrupt service routines
+ * and tasks to share data without raising the CPU priority level:
+ * 
+ *   - SEQLOCK_t: sequence counter protecting a data block written by exactly
+ *     one writer (e.g. the control loop ISR). The counter is odd while the 
+ *     block is written. Readers copy the block and retry when the counter
+ *     was odd or has changed during the copy.
+ *   - DOUBLE_BUFFER_t: two data blocks of which one is published by a single
+ *     16-bit write of the active index. The writer fills the inactive block.
+ *     Readers preempting the writer (e.g. an ISR reading task data) always 
+ *     see a complete block.
+ *   - SPSC_RING_t: single-producer/single-consumer ring buffer of fixed size
+ *     elements. The head index is only written by the producer, the tail 
+ *     index only by the consumer (see task_history.c).
+ * 
+ * All indices and counters are 16-bit wide. 16-bit accesses to aligned words
+ * are atomic on the dsPIC33 core. Data blocks are copied word by word and 
+ * their sizes are therefore given in words.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_exchange.c
+ * task_history.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ * A seqlock supports one writer only. Two writers running at different 
+ * interrupt priority levels corrupt the sequence counter.
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_EXCHANGE_H_
+#define	_ROOT_TASK_EXCHANGE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!SEQLOCK_READ_RETRIES
+ * ***********************************************************************************************
+ * Number of attempts seqlock_Read() takes to copy a consistent data block before it gives up.
+ * A reader is only interrupted by the writer once per writer period. Two attempts are therefore
+ * sufficient as long as the copy takes less time than one writer period.
+ * ***********************************************************************************************/
+#define SEQLOCK_READ_RETRIES            4
+
+/*!SEQLOCK_WRITE_BEGIN/SEQLOCK_WRITE_END
+ * ***********************************************************************************************
+ * Writer brackets for interrupt service routines. They increment the sequence counter of the 
+ * seqlock <lock> directly and avoid the function call overhead of seqlock_WriteBegin() and 
+ * seqlock_WriteEnd() in the control loop.
+ * ***********************************************************************************************/
+#define SEQLOCK_WRITE_BEGIN(lock)       { (lock).sequence++; } // Sequence counter becomes odd
+#define SEQLOCK_WRITE_END(lock)         { (lock).sequence++; } // Sequence counter becomes even
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t sequence; // Sequence counter (odd while the data block is written)
+    volatile uint16_t collisions; // Number of failed read attempts (modified by readers only)
+} __attribute__((packed))SEQLOCK_t;
+
+typedef struct {
+    volatile uint16_t* buffer[2]; // Pointers to the two data blocks
+    volatile uint16_t words; // Size of each data block in words
+    volatile uint16_t active; // Index of the block holding the most recent complete data set
+    volatile uint16_t sequence; // Number of publications (modified by the writer only)
+} __attribute__((packed))DOUBLE_BUFFER_t;
+
+typedef struct {
+    volatile uint16_t* buffer; // Pointer to the element array
+    volatile uint16_t mask; // Index mask (number of elements - 1)
+    volatile uint16_t words; // Size of each element in words
+    volatile uint16_t head; // Write index (modified by the producer only)
+    volatile uint16_t tail; // Read index (modified by the consumer only)
+    volatile uint16_t dropped; // Number of elements dropped while the buffer was full (modified by the producer only)
+} __attribute__((packed))SPSC_RING_t;
+
+// Public seqlock function prototypes
+extern volatile uint16_t seqlock_Init(volatile SEQLOCK_t* lock);
+extern volatile uint16_t seqlock_WriteBegin(volatile SEQLOCK_t* lock);
+extern volatile uint16_t seqlock_WriteEnd(volatile SEQLOCK_t* lock);
+extern volatile uint16_t seqlock_ReadBegin(volatile SEQLOCK_t* lock);
+extern volatile uint16_t seqlock_ReadRetry(volatile SEQLOCK_t* lock, volatile uint16_t sequence);
+extern volatile uint16_t seqlock_Write(volatile SEQLOCK_t* lock, volatile uint16_t* data, 
+                                       volatile uint16_t* source, volatile uint16_t words);
+extern volatile uint16_t seqlock_Read(volatile SEQLOCK_t* lock, volatile uint16_t* data, 
+                                      volatile uint16_t* target, volatile uint16_t words);
+
+// Public double buffer function prototypes
+extern volatile uint16_t dbuf_Init(volatile DOUBLE_BUFFER_t* dbuf, volatile uint16_t* buffer_a, 
+                                   volatile uint16_t* buffer_b, volatile uint16_t words);
+extern volatile uint16_t* dbuf_WriteBuffer(volatile DOUBLE_BUFFER_t* dbuf);
+extern volatile uint16_t dbuf_Publish(volatile DOUBLE_BUFFER_t* dbuf);
+extern volatile uint16_t* dbuf_ReadBuffer(volatile DOUBLE_BUFFER_t* dbuf);
+extern volatile uint16_t dbuf_Read(volatile DOUBLE_BUFFER_t* dbuf, volatile uint16_t* target);
+
+// Public ring buffer function prototypes
+extern volatile uint16_t spsc_Init(volatile SPSC_RING_t* ring, volatile uint16_t* buffer, 
+                                   volatile uint16_t elements, volatile uint16_t words);
+extern volatile uint16_t spsc_Push(volatile SPSC_RING_t* ring, volatile uint16_t* source);
+extern volatile uint16_t spsc_Pop(volatile SPSC_RING_t* ring, volatile uint16_t* target);
+extern volatile uint16_t spsc_Count(volatile SPSC_RING_t* ring);
+
+#endif	/* _ROOT_TASK_EXCHANGE_H_ */
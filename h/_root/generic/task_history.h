@@ -0,0 +1,85 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_history.h
+ *****************************************************************************
+ * File:   task_history.h
+ *
+ * Summary:
+ * CPU load and task execution time history ring buffer
+ *
+ * Description:	
+ * The scheduler pushes one record per tick into a lock-free single-producer/
+ * single-consumer ring buffer (see USE_TASK_MANAGER_LOAD_HISTORY). One reader,
+ * e.g. a communication task, pulls records by calling task_LoadHistoryRead().
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_history.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_HISTORY_H_
+#define	_ROOT_TASK_HISTORY_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_LOAD_HISTORY == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t timestamp; // Scheduler tick counter value when the record was written
+    volatile uint16_t task_id; // ID of the most recent task executed
+    volatile uint16_t task_time; // Execution time of the most recent task in system timer ticks
+    volatile uint16_t cpu_load; // CPU load meter result (free CPU time in [10x %])
+} __attribute__((packed))load_history_record_t;
+
+typedef struct {
+    volatile uint16_t head; // Write index (modified by the scheduler only)
+    volatile uint16_t tail; // Read index (modified by the reader only)
+    volatile uint16_t dropped; // Number of records dropped while the buffer was full
+} __attribute__((packed))load_history_status_t;
+
+// Public Load History data structure declarations
+extern volatile load_history_record_t load_history[]; // Ring buffer of history records
+extern volatile load_history_status_t load_history_status; // Ring buffer status
+
+// Public Load History Function Prototypes
+extern volatile uint16_t task_LoadHistoryWrite(void);
+extern volatile uint16_t task_LoadHistoryRead(volatile load_history_record_t* record);
+extern volatile uint16_t task_LoadHistoryCount(void);
+extern volatile uint16_t task_LoadHistoryFlush(void);
+
+#endif  /* USE_TASK_MANAGER_LOAD_HISTORY */
+
+#endif	/* _ROOT_TASK_HISTORY_H_ */
@@ -0,0 +1,102 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_jitter.h
+ *****************************************************************************
+ * File:   task_jitter.h
+ *
+ * Summary:
+ * Scheduler slot-start latency and slot phase time monitor
+ *
+ * Description:	
+ * The scheduler captures the task manager timer counter when a time slot 
+ * begins and after each framework phase of the time slot (see 
+ * USE_TASK_MANAGER_JITTER_MONITOR). Latency and phase time statistics are
+ * collected in the data structure slot_profile.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_jitter.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_JITTER_H_
+#define	_ROOT_TASK_JITTER_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+
+/*!SLOT_PHASE_e
+ * *****************************************************************************************************
+ * Framework phases of one scheduler time slot in order of execution
+ * *****************************************************************************************************/
+typedef enum {
+    SLOT_PHASE_TASK         = 0, // Execution of the queued task(s)
+    SLOT_PHASE_STATUS       = 1, // System status capture
+    SLOT_PHASE_FAULT        = 2, // Fault scan
+    SLOT_PHASE_MODE         = 3, // Watchdog service, task queue index update and operation mode check
+    SLOT_PHASE_COUNT        = 4  // Number of slot phases (has to be the last item of this list)
+} SLOT_PHASE_e;
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t recent; // Time spent in this phase during the most recent time slot
+    volatile uint16_t maximum; // Longest time spent in this phase
+} __attribute__((packed))slot_phase_time_t;
+
+typedef struct {
+    volatile uint16_t latency; // Slot-start latency of the most recent time slot
+    volatile uint16_t minimum; // Shortest slot-start latency captured
+    volatile uint16_t maximum; // Longest slot-start latency captured
+    volatile uint16_t late; // Number of time slots started later than the latency limit
+    volatile uint16_t limit; // Latency limit in system timer ticks
+    volatile uint32_t slots; // Number of time slots captured
+    volatile uint16_t histogram[TASK_MGR_JITTER_HISTOGRAM_BINS]; // Linear slot-start latency histogram
+    volatile slot_phase_time_t phase[SLOT_PHASE_COUNT]; // Time spent in the framework phases
+    volatile uint16_t slot_time; // Execution time of the most recent time slot (latency excluded)
+    volatile uint16_t slot_time_max; // Longest execution time of a time slot
+    volatile uint16_t timestamp; // Timer counter value captured at the end of the previous phase
+} __attribute__((packed))slot_profile_t;
+
+// Public Jitter Monitor data structure declarations
+extern volatile slot_profile_t slot_profile; // Slot-start latency and slot phase time statistics
+
+// Public Jitter Monitor Function Prototypes
+extern volatile uint16_t task_JitterSlotStart(void);
+extern volatile uint16_t task_JitterPhaseEnd(volatile uint16_t phase);
+extern volatile uint16_t task_JitterReset(void);
+
+#endif  /* USE_TASK_MANAGER_JITTER_MONITOR */
+
+#endif	/* _ROOT_TASK_JITTER_H_ */
@@ -48,6 +48,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_timebase.h"
+
 /* Data structures */
 
 typedef enum {
@@ -57,10 +60,51 @@ typedef enum {
     OP_MODE_SYSTEM_STARTUP   = 0b0000000000000100, // PCB start-up period (self-check, soft-start, etc.)
     OP_MODE_IDLE             = 0b0000000000001000, // Entering Normal operation mode, "NO ACTION" operating mode from which active op-modes are enabled
     OP_MODE_NORMAL           = 0b0000000000010000, // SDB board is powered by AC adapter, motherboard is powered by ADB board, batteries are charged
+    OP_MODE_USER_1           = 0b0000000000100000, // User defined operation mode #1
+    OP_MODE_USER_2           = 0b0000000001000000, // User defined operation mode #2
+    OP_MODE_USER_3           = 0b0000000010000000, // User defined operation mode #3
+    OP_MODE_USER_4           = 0b0000000100000000, // User defined operation mode #4
+    OP_MODE_USER_5           = 0b0000001000000000, // User defined operation mode #5
+    OP_MODE_USER_6           = 0b0000010000000000, // User defined operation mode #6
+    OP_MODE_USER_7           = 0b0000100000000000, // User defined operation mode #7
+    OP_MODE_USER_8           = 0b0001000000000000, // User defined operation mode #8
+    OP_MODE_USER_9           = 0b0010000000000000, // User defined operation mode #9
     OP_MODE_FAULT            = 0b0100000000000000, // Fault mode will be entered when a critical fault condition has been detected
     OP_MODE_STANDBY          = 0b1000000000000000  // During standby mode the converter is disabled
 } SYSTEM_OPERATION_MODE_e;
 
+/*!OP_MODE_INDEX_e
+ * *****************************************************************************************************
+ * Each operation mode is represented by one bit in SYSTEM_OPERATION_MODE_e. The bit position of 
+ * an operation mode is used as index into the operation mode descriptor table task_op_mode_table[].
+ * *****************************************************************************************************/
+typedef enum {
+    OP_MODE_INDEX_BOOT            = 0,  // Table index of OP_MODE_BOOT
+    OP_MODE_INDEX_DEVICE_STARTUP  = 1,  // Table index of OP_MODE_DEVICE_STARTUP
+    OP_MODE_INDEX_SYSTEM_STARTUP  = 2,  // Table index of OP_MODE_SYSTEM_STARTUP
+    OP_MODE_INDEX_IDLE            = 3,  // Table index of OP_MODE_IDLE
+    OP_MODE_INDEX_NORMAL          = 4,  // Table index of OP_MODE_NORMAL
+    OP_MODE_INDEX_USER_1          = 5,  // Table index of OP_MODE_USER_1
+    OP_MODE_INDEX_USER_2          = 6,  // Table index of OP_MODE_USER_2
+    OP_MODE_INDEX_USER_3          = 7,  // Table index of OP_MODE_USER_3
+    OP_MODE_INDEX_USER_4          = 8,  // Table index of OP_MODE_USER_4
+    OP_MODE_INDEX_USER_5          = 9,  // Table index of OP_MODE_USER_5
+    OP_MODE_INDEX_USER_6          = 10, // Table index of OP_MODE_USER_6
+    OP_MODE_INDEX_USER_7          = 11, // Table index of OP_MODE_USER_7
+    OP_MODE_INDEX_USER_8          = 12, // Table index of OP_MODE_USER_8
+    OP_MODE_INDEX_USER_9          = 13, // Table index of OP_MODE_USER_9
+    OP_MODE_INDEX_FAULT           = 14, // Table index of OP_MODE_FAULT
+    OP_MODE_INDEX_STANDBY         = 15, // Table index of OP_MODE_STANDBY
+    OP_MODE_TABLE_SIZE            = 16  // Number of operation mode descriptors
+} OP_MODE_INDEX_e;
+
+typedef enum {
+    OP_MODE_FLAG_NONE             = 0b0000000000000000, // No special action
+    OP_MODE_FLAG_FAULT_OVERRIDE   = 0b0000000000000001, // Set global fault override flag bit when entering this mode
+    OP_MODE_FLAG_STARTUP_COMPLETE = 0b0000000000000010  // Set startup sequence complete flag bit after the first queue pass
+} OP_MODE_FLAGS_e;
+
+
 typedef struct {
     volatile bool boot:1;           // Bit #0: Operation mode during device start-up and peripheral configuration
     volatile bool device_startup;   // Bit #1: On-chip peripherals start-up period (self-check, soft-start, etc.)
@@ -93,6 +137,12 @@ typedef struct {
     volatile uint16_t load_max_buffer; // CPU load maximum is tracked and logged
     volatile uint16_t loop_nomblk; // Number of cycles required for one CPU load counter tick
     volatile uint32_t load_factor; // CPU_TICKS result has to be multiplied with this number to get CPU_LOAD in [10x %] => percentage with 1 digit accuracy, e.g. 124 = 12.4%
+    volatile uint16_t utilization; // CPU utilization of the recent time slot in [10x %] (1000 - load)
+    volatile uint16_t peak; // CPU utilization peak held over TASK_MGR_CPU_LOAD_PEAK_WINDOW ticks in [10x %]
+    volatile uint16_t peak_buffer; // CPU utilization peak of the running peak-hold window
+    volatile uint16_t peak_window_counter; // Tick counter of the running peak-hold window
+    volatile uint16_t average; // Decaying average of the CPU utilization in [10x %]
+    volatile uint32_t average_filter; // Decaying average filter accumulator
 } cpu_load_settings_t;
 
 typedef struct {
@@ -106,13 +156,62 @@ typedef union {
     volatile task_manager_process_code_segment_t segments;
 } task_manager_process_code_t;
 
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+typedef struct {
+    uint16_t task_id; // Task ID from task id definition table
+    uint16_t period; // Call period in scheduler ticks (1 = every tick)
+    uint16_t phase; // Scheduler tick of the first call within the queue frame (0 ... period-1)
+} __attribute__((packed))task_queue_item_t;
+
+#define TASK_QUEUE_ENTRY(id, period, phase)   { (id), (period), (phase) }
+#else
+typedef uint16_t task_queue_item_t; // In single-rate mode task queues only hold task IDs
+
+#define TASK_QUEUE_ENTRY(id, period, phase)   (id)
+#endif
+
+/*!task_op_mode_descriptor_t
+ * *****************************************************************************************************
+ * Each operation mode is described by a constant descriptor holding the task queue, the number
+ * of queue entries, the user function called when switching over to this mode and the operation
+ * mode which will be set automatically after the queue has been executed once. The optional
+ * leave function is called when the task manager switches from this mode to another one.
+ * Descriptors without task queue (queue = NULL) are treated as undefined and result in the
+ * task queue of OP_MODE_IDLE to be loaded.
+ * *****************************************************************************************************/
+typedef struct {
+    const task_queue_item_t *queue; // Task queue executed in this operation mode
+    uint16_t size; // Number of entries in the task queue
+    volatile uint16_t (*switch_over_function)(void); // User function called when switching over to this mode (NULL = none)
+    uint16_t next_mode; // Operation mode automatically selected after one queue pass (OP_MODE_UNKNOWN = none)
+    uint16_t flags; // Operation mode flags (see OP_MODE_FLAGS_e)
+    volatile uint16_t (*leave_function)(void); // User function called when leaving this mode (NULL = none)
+} task_op_mode_descriptor_t;
+
 typedef struct {
-    volatile uint16_t quota; // Maximum allowed task execution period
-    volatile uint16_t buffer; // Buffer for most recent task time meter result
-    volatile uint16_t task_time; // Execution time meter result of last called task
-    volatile uint16_t maximum; // Task time meter maximum is tracked and logged
+    volatile uint16_t counter; // Free running scheduler tick counter (incremented by the system timer ISR in interrupt mode)
+    uint16_t executed; // Tick counter value of the most recently executed time slot
+    uint16_t overrun; // Number of time slots lost due to execution time overruns
+} __attribute__((packed))task_tick_control_t;
+
+typedef struct {
+    uint16_t quota; // Maximum allowed task execution period
+    uint16_t buffer; // Buffer for most recent task time meter result
+    uint16_t task_time; // Execution time meter result of last called task
+    uint16_t maximum; // Task time meter maximum is tracked and logged
 } __attribute__((packed))task_control_t;
 
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+typedef struct {
+    volatile uint32_t calls; // Number of calls of this task
+    volatile uint16_t minimum; // Shortest execution time captured
+    volatile uint16_t maximum; // Longest execution time captured
+    volatile uint16_t average; // Moving average of the execution time
+    volatile uint32_t average_filter; // Moving average filter accumulator
+    volatile uint16_t histogram[TASK_MGR_STATS_HISTOGRAM_BINS]; // log2 execution time histogram
+} __attribute__((packed))task_statistics_t;
+#endif
+
 typedef enum {
     EXEC_STAT_FAULT_OVERRIDE        = 0b0000000000000001, // Some fault condition is overriding task settings and actions
     EXEC_STAT_START_COMPLETE        = 0b0000000000000010, // Firmware has passed startup sequence
@@ -127,7 +226,7 @@ typedef struct {
     volatile bool fault_override :1; // Bit #0: Flag bit indicating that all other operating modes are overridden by the FAULT_HANDLER
     volatile bool startup_sequence_complete:1; // Bit #1: Flag bit indicating that device and system startup has been completed
     volatile bool queue_switch:1; // Bit #2: queue_switch occurred (active for one queue loop)
-    volatile unsigned :1; // Bit #3:  (reserved)
+    volatile bool queue_hold:1; // Bit #3: Flag bit set by a task to be called again in the next time slot (cleared by the scheduler)
     volatile unsigned :1; // Bit #4:  (reserved)
     volatile unsigned :1; // Bit #5:  (reserved)
     volatile unsigned :1; // Bit #6:  (reserved)
@@ -150,47 +249,72 @@ typedef union
 } task_manager_status_t;
 
 
+/*!task_manager_settings_t
+ * ***********************************************************************************************
+ * Description:
+ * Settings and status of the task manager. Fields accessed in every scheduler tick are grouped 
+ * at the beginning of the data structure, followed by the operation mode status. Only fields 
+ * shared with interrupt service routines and trap handlers are declared volatile. The registers
+ * of the task manager timer are accessed directly through the TASK_MGR_TIMER_xxx_REGISTER 
+ * macros, which resolve register addresses at compile time.
+ * 
+ * The data structure task_mgr is placed in near data memory for short addressing.
+ * ***********************************************************************************************/
+
 typedef struct {
 
-    /* System operation mode (selects the active task queue) */
-    volatile system_operation_mode_t pre_op_mode; // ID of previous operating mode (=op_mode after switch-over)
-    volatile system_operation_mode_t op_mode; // ID of current operating mode
-    volatile uint16_t (*op_mode_switch_over_function)(void); // pointer to a user function called when a switch in op_mode is performed
-    volatile task_manager_process_code_t proc_code;   // in case an execution error occurred, this code contains task ID
-                                    // and queue ID which caused the error 
-    
-    /* Active task queue properties */
-    volatile uint16_t exec_task_id; // Main task ID from task id definition table
-    volatile uint16_t *task_queue; // Pointer to the task queue (lookup table of task flow combinations)
-    volatile uint16_t task_queue_ubound; // Number of tasks in the current queue (1-n))
-    volatile uint16_t task_queue_tick_index; // Recent task queue tick counter
-
-    /* Settings for task scheduler timer */
-    volatile uint16_t task_timer_index; // specifies the timer used for the task manager (e.g. 1 for Timer1)
-    volatile uint16_t *reg_task_timer_period; // Pointer to Timer period register (e.g. PR1)
-    volatile uint16_t *reg_task_timer_counter; // Pointer to Timer counter register (e.g. TMR1))
-    volatile uint16_t *reg_task_timer_irq_flag; // Pointer to Timer interrupt flag register (e.g. IFS0)
-    volatile uint16_t task_timer_irq_flag_mask; // Bit-Mask for filtering on dedicated interrupt flag bit
+    /* Active task queue properties (accessed in every scheduler tick) */
+    uint16_t task_queue_tick_index; // Recent task queue tick counter
+    uint16_t task_queue_ubound; // Number of tasks in the current queue (1-n))
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    uint16_t task_queue_items; // Number of entries in the current multi-rate queue
+    #endif
+    const task_queue_item_t *task_queue; // Pointer to the task queue located in program memory (lookup table of task flow combinations)
+    const task_op_mode_descriptor_t *op_mode_descriptor; // pointer to the descriptor of the current operating mode
+    uint16_t exec_task_id; // Main task ID from task id definition table
+    uint16_t exec_task_period; // Nominal number of scheduler ticks between two calls of the recently executed queue entry
+
+    /* Scheduler tick counter */
+    task_tick_control_t tick_ctrl; // Scheduler time slot counter and overrun monitor
 
     /* Generic task execution time control settings and buffer variables */
-    volatile task_control_t task_time_ctrl; // Task time control settings and monitoring
+    task_control_t task_time_ctrl; // Task time control settings and monitoring
 
     /* CPU Load Meter variables */
     volatile cpu_load_settings_t cpu_load;
     
-    /* Global task manager status flags */
+    /* Global task manager status flags (set by the fault handler) */
     volatile task_manager_status_t status;
     
+    /* System operation mode (selects the active task queue, may be forced by the fault handler) */
+    volatile system_operation_mode_t op_mode; // ID of current operating mode
+    volatile system_operation_mode_t pre_op_mode; // ID of previous operating mode (=op_mode after switch-over)
+    volatile uint16_t (*op_mode_switch_over_function)(void); // pointer to a user function called when a switch in op_mode is performed
+    volatile task_manager_process_code_t proc_code;   // in case an execution error occurred, this code contains task ID
+                                    // and queue ID which caused the error (captured by the fault log)
+    
 } task_manager_settings_t;
 
 // Public Task Manager data structure declaration
-extern volatile task_manager_settings_t task_mgr; // Declare a data structure holding the settings of the task manager
+extern task_manager_settings_t __attribute__((near))task_mgr; // Declare a data structure holding the settings of the task manager
+
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+extern volatile task_statistics_t task_stats[]; // Execution time statistics of each task in Task_Table[]
+#endif
 
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+extern volatile uint16_t task_queue_countdown[]; // Period counters of the entries of the active multi-rate task queue
+#endif
 
 // Public Task Manager Function Prototypes
 extern volatile uint16_t init_TaskManager(void);
 extern volatile uint16_t task_manager_tick(void);
 extern volatile uint16_t task_CheckOperationModeStatus(void);
+extern volatile uint16_t task_UpdateCPULoad(void);
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+extern volatile uint16_t task_ResetStatistics(void);
+#endif
 
 
 #endif	/* _ROOT_TASK_MANAGER_H_ */
@@ -0,0 +1,93 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_realtime.h
+ *****************************************************************************
+ * File:   task_realtime.h
+ *
+ * Summary:
+ * Interrupt-level real-time task tier
+ *
+ * Description:	
+ * Real-time tasks are dispatched by the interrupt service routine of a dedicated
+ * timer (see USE_TASK_MANAGER_RT_TIER) and preempt the cooperative task queues
+ * of the task manager. Each task is monitored against its deadline.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_realtime.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_REALTIME_H_
+#define	_ROOT_TASK_REALTIME_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t (*function)(void); // Task function called
+    uint16_t period; // Call period in real-time tier ticks (1 = every tick)
+    uint16_t phase; // Real-time tier tick of the first call (0 ... period-1)
+    float deadline; // Latest completion time after tier tick release in [sec]
+} rt_task_descriptor_t;
+
+typedef struct {
+    volatile uint16_t countdown; // Period counter (task is called when counter is zero)
+    volatile uint16_t deadline; // Deadline in timer ticks
+    volatile uint16_t response; // Most recent response time (tier tick release to task completion) in timer ticks
+    volatile uint16_t maximum; // Longest response time captured
+    volatile uint16_t deadline_misses; // Number of deadline violations
+    volatile uint16_t retval; // Most recent return value of the task function
+    volatile uint32_t calls; // Number of calls of this task
+} __attribute__((packed))rt_task_status_t;
+
+typedef struct {
+    volatile uint16_t tick_counter; // Real-time tier tick counter
+    volatile uint16_t overrun; // Number of tier ticks in which the tier execution exceeded the tier period
+    volatile uint16_t deadline_misses; // Accumulated deadline violations of all real-time tasks
+} __attribute__((packed))rt_tier_status_t;
+
+// Public Real-Time Tier data structure declarations
+extern volatile rt_task_status_t rt_task_status[]; // Status of each real-time task, indexed by real-time task ID
+extern volatile rt_tier_status_t rt_tier; // Real-time tier status
+
+// Public Real-Time Tier Function Prototypes
+extern volatile uint16_t init_TaskRealTimeTier(void);
+extern void exec_TaskRealTimeTier(void);
+
+#endif  /* USE_TASK_MANAGER_RT_TIER */
+
+#endif	/* _ROOT_TASK_REALTIME_H_ */
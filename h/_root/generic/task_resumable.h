@@ -0,0 +1,156 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_resumable.h
+ *****************************************************************************
+ * File:   task_resumable.h
+ *
+ * Summary:
+ * Resumable tasks splitting long jobs across scheduler ticks
+ *
+ * Description:	
+ * Task functions of the task queues run to completion within one time slot.
+ * A resumable task executes a long job in slices: it leaves the task function
+ * at yield points and continues behind the recent yield point when it is 
+ * called the next time. Resumable tasks are written as one sequential 
+ * function body (protothread) enclosed by TASK_PT_BEGIN() and TASK_PT_END():
+ * 
+ *   volatile uint16_t exec_Job(void) {
+ *       TASK_PT_BEGIN(&job.pt);
+ *       for (job.index = 0; job.index < JOB_SIZE; job.index++) {
+ *           job.sum += job_data[job.index];
+ *           TASK_PT_YIELD_EXPIRED(&job.pt);
+ *       }
+ *       TASK_PT_END(&job.pt, 1);
+ *   }
+ * 
+ * The resume point is stored in a TASK_PT_t context object. Each yield 
+ * point expands into one case label of a switch statement on the resume 
+ * point. Hence, 
+ * 
+ *   - local variables are not preserved across yield points. Variables 
+ *     used across yield points have to be located in the context data 
+ *     structure of the task
+ *   - yield points must not be placed inside switch statements
+ *   - only one yield point may be placed in one source line
+ * 
+ * At a yield point, the task holds the task queue at its position and is 
+ * called again in the next time slot (see task_mgr.status.flags.queue_hold).
+ * When the job is complete, the task returns immediately on every call until
+ * the job is started again by task_ResumableStart().
+ * 
+ * When per-task execution time statistics are enabled, the task manager adds 
+ * the execution time of each slice to the job statistics of the context 
+ * object (see USE_TASK_MANAGER_TASK_STATISTICS). The statistics of each slice
+ * are captured in task_stats[] like those of all other tasks.
+ *
+ * References:
+ * A. Dunkels et al., "Protothreads: Simplifying Event-Driven Programming of
+ * Memory-Constrained Embedded Systems", SenSys 2006
+ *
+ * See also:
+ * task_resumable.c
+ * task_manager.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_RESUMABLE_H_
+#define	_ROOT_TASK_RESUMABLE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+
+#define TASK_PT_START       0x0000  // Resume point of a job which has not been started yet
+#define TASK_PT_COMPLETE    0xFFFF  // Resume point of a completed job
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t line; // Resume point (source line of the recent yield point, 0 = start)
+  #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    volatile uint16_t slices; // Number of slices of the recent job
+    volatile uint32_t job_time; // Accumulated execution time of the recent job in timer ticks
+    volatile uint16_t jobs; // Number of completed jobs
+    volatile uint16_t last_slices; // Number of slices of the most recently completed job
+    volatile uint32_t last_time; // Execution time of the most recently completed job in timer ticks
+    volatile uint32_t max_time; // Longest execution time of all completed jobs in timer ticks
+  #endif
+} __attribute__((packed))TASK_PT_t;
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+extern volatile TASK_PT_t* task_pt_active; // Context of the resumable task executed in the recent task call
+  #define TASK_PT_ACCOUNT(pt)   { task_pt_active = (pt); } // Slice time is added to the job statistics
+#else
+  #define TASK_PT_ACCOUNT(pt)   { ; }
+#endif
+
+/*!Resumable Task Macros
+ * ***********************************************************************************************
+ * TASK_PT_BEGIN(pt): first statement of the task function. Returns 1 if the job is complete.
+ * TASK_PT_YIELD(pt): leaves the task function and continues behind this point in the next slot
+ * TASK_PT_YIELD_EXPIRED(pt): yields when the recent slice has exceeded TASK_MGR_RESUMABLE_SLICE
+ * TASK_PT_WAIT_WHILE(pt, condition): yields in every call as long as <condition> is true
+ * TASK_PT_EXIT(pt, retval): completes the job immediately and returns <retval>
+ * TASK_PT_END(pt, retval): last statement of the task function, completes the job
+ * ***********************************************************************************************/
+#define TASK_PT_BEGIN(pt)   \
+    if ((pt)->line == TASK_PT_COMPLETE) { return(1); } \
+    TASK_PT_ACCOUNT(pt); \
+    switch ((pt)->line) { case TASK_PT_START:
+    
+#define TASK_PT_YIELD(pt)   \
+    { (pt)->line = __LINE__; task_mgr.status.flags.queue_hold = true; return(1); case __LINE__: ; }
+
+#define TASK_PT_YIELD_EXPIRED(pt)   \
+    { if (task_ResumableExpired()) { (pt)->line = __LINE__; task_mgr.status.flags.queue_hold = true; return(1); } case __LINE__: ; }
+
+#define TASK_PT_WAIT_WHILE(pt, condition)   \
+    { (pt)->line = __LINE__; case __LINE__: \
+      if (condition) { task_mgr.status.flags.queue_hold = true; return(1); } }
+
+#define TASK_PT_EXIT(pt, retval)    \
+    { (pt)->line = TASK_PT_COMPLETE; return(retval); }
+
+#define TASK_PT_END(pt, retval)     \
+    default: ; } TASK_PT_EXIT(pt, retval)
+
+extern volatile uint16_t task_resumable_slice; // Slice budget of resumable tasks in timer ticks
+
+// Public resumable task function prototypes
+extern volatile uint16_t init_TaskResumable(void);
+extern volatile uint16_t task_ResumableClockChange(void);
+extern volatile uint16_t task_ResumableStart(volatile TASK_PT_t* pt);
+extern volatile uint16_t task_ResumableBusy(volatile TASK_PT_t* pt);
+extern volatile uint16_t task_ResumableExpired(void);
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+extern volatile uint16_t task_ResumableAccount(volatile uint16_t task_time);
+#endif
+
+#endif	/* _ROOT_TASK_RESUMABLE_H_ */
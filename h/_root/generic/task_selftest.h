@@ -0,0 +1,105 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_selftest.h
+ *****************************************************************************
+ * File:   task_selftest.h
+ *
+ * Summary:
+ * Run-time flash CRC and RAM March test
+ *
+ * Description:	
+ * Program memory is covered by an incremental CRC and data memory by a 
+ * March C- test of one small block at a time, both executed in the remaining
+ * time of each scheduler time slot (see USE_TASK_MANAGER_SELF_TEST). Test 
+ * results are published in the data structure task_selftest.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_selftest.c
+ * task_manager_config.h
+ * apl/config/selftest.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_SELFTEST_H_
+#define	_ROOT_TASK_SELFTEST_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+
+#define SELF_TEST_FAILURE_FLASH         0x0001  // Failure flag of the flash CRC (signature differs from the reference)
+#define SELF_TEST_FAILURE_RAM           0x0002  // Failure flag of the RAM March test (data memory cell failure)
+
+/*!SELF_TEST_FLASH_STATE_e
+ * ***********************************************************************************************
+ * Description:
+ * - SELF_TEST_FLASH_START: the next pass is started in the next time slot
+ * - SELF_TEST_FLASH_FEED: instruction words are added to the CRC
+ * - SELF_TEST_FLASH_DRAIN: the CRC module completes the signature of the recent pass
+ * - SELF_TEST_FLASH_COMPLETE: the signature is compared to the reference
+ * ***********************************************************************************************/
+typedef enum {
+    SELF_TEST_FLASH_START       = 0, // Pass is started in the next time slot
+    SELF_TEST_FLASH_FEED        = 1, // Adding instruction words to the CRC
+    SELF_TEST_FLASH_DRAIN       = 2, // Waiting for the CRC module to complete the signature
+    SELF_TEST_FLASH_COMPLETE    = 3  // Signature complete
+} SELF_TEST_FLASH_STATE_e; // States of the flash CRC
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t failures; // Latched failure flags SELF_TEST_FAILURE_xxx (monitored by fault objects)
+    volatile uint16_t flash_state; // Recent state of the flash CRC of type SELF_TEST_FLASH_STATE_e
+    volatile uint32_t flash_address; // Next program memory address added to the flash CRC
+    volatile uint32_t flash_end; // First program memory address not covered by the flash CRC
+    volatile uint16_t flash_crc; // Running CRC of the recent pass (software CRC)
+    volatile uint16_t flash_signature; // Signature of the most recent complete pass
+    volatile uint16_t flash_reference; // Reference signature of the image
+    volatile uint16_t flash_passes; // Number of completed flash CRC passes
+    volatile uint16_t* ram_block; // Next data memory block tested by the RAM March test
+    volatile uint16_t* ram_failure; // First data memory block which failed the RAM March test (NULL = none)
+    volatile uint16_t ram_passes; // Number of completed RAM March test passes
+} __attribute__((packed))task_selftest_status_t;
+
+// Public Self-Test data structure declarations
+extern volatile task_selftest_status_t task_selftest; // Run-time self-test status
+
+// Public Self-Test Function Prototypes
+extern volatile uint16_t exec_SelfTest(void);
+#if (TASK_MGR_SELF_TEST_FLASH == 1) && (TASK_MGR_SELF_TEST_HW_CRC == 1)
+extern volatile uint16_t task_SelfTestCrcRestart(void);
+#endif
+
+#endif  /* USE_TASK_MANAGER_SELF_TEST */
+
+#endif	/* _ROOT_TASK_SELFTEST_H_ */
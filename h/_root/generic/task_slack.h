@@ -0,0 +1,92 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_slack.h
+ *****************************************************************************
+ * File:   task_slack.h
+ *
+ * Summary:
+ * Background slack executor for deferrable jobs
+ *
+ * Description:	
+ * Deferrable jobs are posted into a ring buffer and executed chunk by chunk 
+ * in the time left in each scheduler time slot (see USE_TASK_MANAGER_SLACK_EXECUTOR).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_slack.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_SLACK_H_
+#define	_ROOT_TASK_SLACK_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+
+/* Data structures */
+
+typedef enum {
+    SLACK_JOB_COMPLETE = 0, // Job has been completed and will be removed from the queue
+    SLACK_JOB_PENDING = 1   // Job has more chunks to execute and will be called again
+} SLACK_JOB_STATUS_e;
+
+typedef struct {
+    volatile uint16_t (*function)(volatile uint16_t* param); // Job chunk function, returning SLACK_JOB_STATUS_e
+    volatile uint16_t param; // User parameter/chunk state passed to the job function
+    volatile uint16_t wcet; // Worst-case execution time of one chunk in system timer ticks
+} slack_job_t;
+
+typedef struct {
+    volatile uint16_t head; // Write index (incremented by task_PostSlackJob)
+    volatile uint16_t tail; // Read index (incremented by exec_SlackJobs when a job has been completed)
+    volatile uint16_t guard; // Guard time until the next scheduler tick in system timer ticks
+    volatile uint16_t consumed; // System timer ticks consumed by slack jobs in the recent time slot
+    volatile uint16_t dropped; // Number of jobs rejected by task_PostSlackJob
+    volatile uint32_t chunks; // Number of job chunks executed
+    volatile uint32_t completed; // Number of jobs completed
+} __attribute__((packed))task_slack_status_t;
+
+// Public Slack Executor data structure declarations
+extern volatile slack_job_t slack_queue[]; // Ring buffer of pending slack jobs
+extern volatile task_slack_status_t task_slack; // Slack executor status
+
+// Public Slack Executor Function Prototypes
+extern volatile uint16_t init_TaskSlackExecutor(void);
+extern volatile uint16_t task_PostSlackJob(volatile uint16_t (*function)(volatile uint16_t* param), 
+                    volatile uint16_t param, volatile uint16_t wcet);
+extern volatile uint16_t exec_SlackJobs(void);
+
+#endif  /* USE_TASK_MANAGER_SLACK_EXECUTOR */
+
+#endif	/* _ROOT_TASK_SLACK_H_ */
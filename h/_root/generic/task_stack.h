@@ -0,0 +1,82 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_stack.h
+ *****************************************************************************
+ * File:   task_stack.h
+ *
+ * Summary:
+ * Stack usage high-water mark monitor
+ *
+ * Description:	
+ * The unused stack area is painted with a fill pattern at boot and checked 
+ * for overwritten words a few words per scheduler time slot (see 
+ * USE_TASK_MANAGER_STACK_MONITOR). The maximum stack usage is published in
+ * the data structure task_stack.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_stack.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_STACK_H_
+#define	_ROOT_TASK_STACK_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t* base; // Lowest address of the stack area
+    volatile uint16_t* limit; // Highest address of the stack area (stack pointer limit)
+    volatile uint16_t* hwm; // Highest stack word overwritten since the stack has been painted (high-water mark)
+    volatile uint16_t* scan; // Next stack word to be checked by the recent pass
+    volatile uint16_t size; // Size of the stack area in words
+    volatile uint16_t used; // Maximum stack usage in words
+    volatile uint16_t headroom; // Number of stack words never used
+    volatile uint16_t usage; // Maximum stack usage in [%] of the stack size (monitored by fault objects)
+    volatile uint16_t passes; // Number of completed scan passes
+} __attribute__((packed))task_stack_status_t;
+
+// Public Stack Monitor data structure declarations
+extern volatile task_stack_status_t task_stack; // Stack usage high-water mark monitor status
+
+// Public Stack Monitor Function Prototypes
+extern volatile uint16_t task_StackPaint(void);
+extern volatile uint16_t exec_StackMonitor(void);
+
+#endif  /* USE_TASK_MANAGER_STACK_MONITOR */
+
+#endif	/* _ROOT_TASK_STACK_H_ */
@@ -0,0 +1,94 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_timebase.h
+ *****************************************************************************
+ * File:   task_timebase.h
+ *
+ * Summary:
+ * Runtime configurable scheduler tick period
+ *
+ * Description:	
+ * The scheduler tick period can be changed at runtime by task_TimeBaseSet()
+ * (see USE_TASK_MANAGER_TIME_BASE). Intervals defined in scheduler ticks of
+ * the nominal tick period are converted into ticks of the recent tick period
+ * by TASK_MGR_TICKS().
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_timebase.c
+ * task_manager_config.h
+ * timebase.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_TIMEBASE_H_
+#define	_ROOT_TASK_TIMEBASE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_TIME_BASE == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t nominal; // Timer period of the nominal tick period TASK_MGR_TIME_STEP
+    volatile uint16_t period; // Timer period of the recent tick period
+    volatile uint16_t pending; // Timer period requested for the next time slot (0 = no change)
+    volatile uint16_t scale; // Number of recent ticks per nominal tick (fixed point, TASK_MGR_TIME_BASE_Q)
+    volatile uint16_t changes; // Number of tick period changes applied
+} __attribute__((packed))task_time_base_t;
+
+// Public Time Base data structure declarations
+extern volatile task_time_base_t task_time_base; // Scheduler tick period settings
+
+/*!TASK_MGR_TICKS
+ * ***********************************************************************************************
+ * Converts a number of scheduler ticks of the nominal tick period into the number of scheduler 
+ * ticks of the recent tick period covering the same time (rounded to the nearest tick)
+ * ***********************************************************************************************/
+#define TASK_MGR_TICKS(n)   (uint16_t)((((uint32_t)(n) * task_time_base.scale) + \
+                                (1UL << (TASK_MGR_TIME_BASE_Q - 1))) >> TASK_MGR_TIME_BASE_Q)
+
+// Public Time Base Function Prototypes
+extern volatile uint16_t init_TaskTimeBase(void);
+extern volatile uint16_t task_TimeBaseSet(volatile uint16_t period);
+extern volatile uint16_t task_TimeBaseRestore(void);
+extern volatile uint16_t task_TimeBaseClockChange(void);
+extern volatile uint16_t task_TimeBaseUpdate(void);
+
+#else
+
+#define TASK_MGR_TICKS(n)   (n) // Tick period is fixed to TASK_MGR_TIME_STEP
+
+#endif  /* USE_TASK_MANAGER_TIME_BASE */
+
+#endif	/* _ROOT_TASK_TIMEBASE_H_ */
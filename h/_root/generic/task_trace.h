@@ -0,0 +1,146 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_trace.h
+ *****************************************************************************
+ * File:   task_trace.h
+ *
+ * Summary:
+ * Trace points recording events into a RAM ring buffer
+ *
+ * Description:	
+ * Trace points record 32-bit events consisting of a timestamp, an event ID and
+ * an 8-bit argument into a ring buffer (see USE_TASK_MANAGER_TRACE). The trace
+ * level of each trace point is filtered at compile time. Disabled trace points 
+ * are removed by the preprocessor.
+ * 
+ * Example:
+ *      TRACE_USER(TRACE_EVT_USER + 1, (uint8_t)counter);
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_trace.c
+ * task_manager_config.h
+ * support/trace/trace_decode.py
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_TRACE_H_
+#define	_ROOT_TASK_TRACE_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+/*!TRACE_EVENT_e
+ * ***********************************************************************************************
+ * Description:
+ * Event IDs of trace records. IDs from TRACE_EVT_USER upwards are available for user trace 
+ * points. The host-side decoder needs to be kept in sync with this list.
+ * ***********************************************************************************************/
+
+typedef enum {
+    TRACE_EVT_TASK_START    = 0x01, // Task is called by the task manager (arg = task ID)
+    TRACE_EVT_TASK_END      = 0x02, // Task has returned (arg = low byte of the return value)
+    TRACE_EVT_OP_MODE       = 0x03, // Operation mode switch-over (arg = operation mode index of type OP_MODE_INDEX_e)
+    TRACE_EVT_FAULT_TRIP    = 0x04, // Fault object has tripped (arg = fault object ID)
+    TRACE_EVT_FAULT_RELEASE = 0x05, // Fault object has been released (arg = fault object ID)
+    TRACE_EVT_TRAP          = 0x06, // CPU trap (arg = bit position of the trap ID of type TRAP_ID_e, 1 = bit #0)
+    TRACE_EVT_ISR_ENTRY     = 0x07, // Interrupt service routine entry (arg = ISR ID of type TRACE_ISR_e)
+    TRACE_EVT_ISR_EXIT      = 0x08, // Interrupt service routine exit (arg = ISR ID of type TRACE_ISR_e)
+    TRACE_EVT_USER          = 0x80  // First event ID of user trace points
+}TRACE_EVENT_e;
+
+typedef enum {
+    TRACE_ISR_SCHEDULER     = 0x01, // Task manager timer interrupt (interrupt scheduler mode)
+    TRACE_ISR_RT_TIER       = 0x02, // Real-time tier timer interrupt
+    TRACE_ISR_CVMC_VOUT     = 0x03  // Output voltage control loop interrupt
+}TRACE_ISR_e;
+
+/*!Trace Points
+ * ***********************************************************************************************
+ * Description:
+ * Trace point macros of each trace level. Trace points above TRACE_LEVEL expand to nothing.
+ * ***********************************************************************************************/
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_FAULT)
+  #define TRACE_FAULT(event, arg)   { trace_Record((event), (arg)); }
+#else
+  #define TRACE_FAULT(event, arg)   { }
+#endif
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_MODE)
+  #define TRACE_MODE(event, arg)    { trace_Record((event), (arg)); }
+#else
+  #define TRACE_MODE(event, arg)    { }
+#endif
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_TASK)
+  #define TRACE_TASK(event, arg)    { trace_Record((event), (arg)); }
+#else
+  #define TRACE_TASK(event, arg)    { }
+#endif
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_ALL)
+  #define TRACE_ISR(event, arg)     { trace_Record((event), (arg)); }
+  #define TRACE_USER(event, arg)    { trace_Record((event), (arg)); }
+#else
+  #define TRACE_ISR(event, arg)     { }
+  #define TRACE_USER(event, arg)    { }
+#endif
+
+#if (USE_TASK_MANAGER_TRACE == 1)
+
+/* Data structures */
+
+typedef struct {
+    volatile uint16_t timestamp; // Task manager timer counter value at the time of the event
+    volatile uint8_t event; // Event ID of type TRACE_EVENT_e
+    volatile uint8_t arg; // Event specific argument
+} __attribute__((packed))TRACE_RECORD_t;
+
+typedef struct {
+    volatile uint16_t head; // Index of the next record to be written
+    volatile uint16_t count; // Number of records held in the ring buffer
+    volatile uint16_t frozen; // Flag indicating that recording has been stopped by a trap (1) or is running (0)
+    volatile uint16_t size; // Number of records of the ring buffer (read by the host-side decoder)
+    volatile TRACE_RECORD_t record[TRACE_BUFFER_SIZE]; // Ring buffer
+} __attribute__((packed))TRACE_BUFFER_t;
+
+// Public trace buffer declaration
+extern volatile TRACE_BUFFER_t __attribute__((__persistent__))trace;
+
+// Public trace function prototypes
+extern volatile uint16_t init_Trace(volatile uint16_t power_on_reset);
+extern volatile uint16_t trace_Record(volatile uint16_t event, volatile uint16_t arg);
+extern volatile uint16_t trace_Freeze(void);
+
+#endif  /* USE_TASK_MANAGER_TRACE */
+
+#endif	/* _ROOT_TASK_TRACE_H_ */
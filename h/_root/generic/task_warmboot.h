@@ -0,0 +1,114 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_warmboot.h
+ *****************************************************************************
+ * File:   task_warmboot.h
+ *
+ * Summary:
+ * Warm boot snapshot for fast recovery after software and watchdog resets
+ *
+ * Description:	
+ * The warm boot snapshot holds the oscillator, application and fault object
+ * configuration captured after the startup sequence has been completed. It 
+ * is located in persistent RAM and protected by a Fletcher-16 checksum 
+ * (see USE_TASK_MANAGER_WARM_BOOT).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_warmboot.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_WARMBOOT_H_
+#define	_ROOT_TASK_WARMBOOT_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+#include "apl/config/application.h"
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+
+/* Data structures */
+
+#define WARM_BOOT_SIGNATURE         0x5742  // Snapshot signature ("WB")
+#define WARM_BOOT_FREQUENCY_WORDS   (sizeof(system_frequencies) >> 1) // Size of the system frequencies data structure in words
+#define WARM_BOOT_TIMING_WORDS      (sizeof(CONTROL_SWITCHING_TIMING_SETTINGS_t) >> 1) // Size of the timing settings in words
+
+typedef struct {
+    volatile uint16_t osccon; // Oscillator control register (current oscillator selection and PLL lock status only)
+    volatile uint16_t clkdiv; // Clock divider register
+    volatile uint16_t pllfbd; // PLL feedback divider register
+    volatile uint16_t plldiv; // PLL output divider register
+    volatile uint16_t aclkcon1; // Auxiliary clock control register
+    volatile uint16_t apllfbd1; // Auxiliary PLL feedback divider register
+    volatile uint16_t aplldiv1; // Auxiliary PLL output divider register
+} __attribute__((packed))WARM_BOOT_OSCILLATOR_t; // Oscillator register settings
+
+typedef struct {
+    volatile uint16_t trip_level; // Input signal fault trip level/fault trip point
+    volatile uint16_t trip_cnt_threshold; // Fault counter threshold triggering fault exception
+    volatile uint16_t reset_level; // Input signal fault reset level/fault reset point
+    volatile uint16_t reset_cnt_threshold; // Fault counter threshold resetting fault exception
+    volatile uint16_t fltchken; // Fault check enable bit
+} __attribute__((packed))WARM_BOOT_FAULT_CONFIG_t; // Fault object configuration
+
+typedef struct {
+    volatile uint16_t signature; // Snapshot signature (WARM_BOOT_SIGNATURE)
+    volatile WARM_BOOT_OSCILLATOR_t oscillator; // Oscillator register settings
+    volatile uint16_t frequencies[WARM_BOOT_FREQUENCY_WORDS]; // Copy of the system frequencies data structure
+    volatile uint16_t timing[WARM_BOOT_TIMING_WORDS]; // Copy of the application switching timing settings
+    volatile uint16_t fault_objects; // Number of captured fault object configurations
+    volatile WARM_BOOT_FAULT_CONFIG_t fault[WARM_BOOT_FAULT_OBJECTS_MAX]; // Fault object configurations
+    volatile uint16_t checksum; // Fletcher-16 checksum across all preceding words
+} __attribute__((packed))WARM_BOOT_SNAPSHOT_t; // Warm boot snapshot located in persistent RAM
+
+typedef struct {
+    volatile bool active; // Flag indicating that the recent boot is a warm boot
+    volatile bool clock_valid; // Flag indicating that the oscillator configuration is still valid
+    volatile bool captured; // Flag indicating that the snapshot has been captured after the recent boot
+    volatile uint16_t attempts; // Number of successive warm boots without completed startup sequence
+} WARM_BOOT_STATUS_t; // Warm boot status
+
+// Public warm boot data structure declarations
+extern volatile WARM_BOOT_SNAPSHOT_t __attribute__((__persistent__))warm_boot_snapshot;
+extern volatile WARM_BOOT_STATUS_t __attribute__((__persistent__))warm_boot;
+
+// Public warm boot function prototypes
+extern volatile uint16_t warm_boot_Check(void);
+extern volatile uint16_t warm_boot_Capture(void);
+extern volatile uint16_t warm_boot_Invalidate(void);
+extern volatile uint16_t warm_boot_RestoreClock(void);
+extern volatile uint16_t warm_boot_Restore(void);
+
+#endif  /* USE_TASK_MANAGER_WARM_BOOT */
+
+#endif	/* _ROOT_TASK_WARMBOOT_H_ */
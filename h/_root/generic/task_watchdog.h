@@ -0,0 +1,101 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_watchdog.h
+ *****************************************************************************
+ * File:   task_watchdog.h
+ *
+ * Summary:
+ * Windowed watchdog timer service with per-task check-ins
+ *
+ * Description:	
+ * The watchdog timer is serviced by the scheduler and only cleared within 
+ * the watchdog window when all check-ins of the tasks registered in 
+ * WDT_CHECKIN_REGISTRY have arrived (see USE_TASK_MANAGER_WATCHDOG).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_watchdog.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _ROOT_TASK_WATCHDOG_H_
+#define	_ROOT_TASK_WATCHDOG_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/config/task_manager_config.h"
+
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+/* Data structures */
+
+#define WDT_CHECKIN_NONE    0xFFFF  // No task has missed its check-in
+
+typedef struct {
+    uint16_t task_id; // ID of the task checking in (see task_id_no_e)
+    uint16_t op_modes; // Operation modes in which the check-in is expected (OR-combination of OP_MODE_xxx)
+} wdt_checkin_descriptor_t;
+
+typedef struct {
+    volatile uint16_t ticks; // Scheduler ticks since the most recent watchdog clear
+    volatile uint16_t checkin; // Check-in bits received in the recent window
+    volatile uint16_t expected; // Check-in bits expected in the recent window
+    volatile uint16_t clear_count; // Number of watchdog clears since startup
+} __attribute__((packed))task_wdt_status_t;
+
+typedef struct {
+    volatile uint16_t missed; // Check-in bits missing when the most recent window closed
+    volatile uint16_t task_id; // ID of the first task which missed its check-in (WDT_CHECKIN_NONE = none)
+    volatile uint16_t op_mode; // Operation mode active when the window closed
+    volatile uint16_t count; // Number of missed windows since the last power-on reset
+} __attribute__((packed))task_wdt_diag_t;
+
+// Public watchdog data structure declarations
+extern volatile task_wdt_status_t task_wdt; // Watchdog service status
+extern volatile task_wdt_diag_t __attribute__((__persistent__))task_wdt_diag; // Diagnostic of the most recent missed window
+
+/*!TASK_WDT_CHECKIN
+ * ***********************************************************************************************
+ * Description:
+ * Tasks check in automatically each time they have been executed. Tasks with multiple execution 
+ * steps may additionally check in explicitly using this macro, where index is the check-in 
+ * index WDT_CHECKIN_<task_id> generated from WDT_CHECKIN_REGISTRY.
+ * ***********************************************************************************************/
+#define TASK_WDT_CHECKIN(index)     { task_wdt.checkin |= (1 << (index)); }
+
+// Public watchdog function prototypes
+extern volatile uint16_t init_TaskWatchdog(void);
+extern volatile uint16_t exec_TaskWatchdog(void);
+extern volatile uint16_t task_WatchdogModeSwitch(volatile uint16_t op_mode);
+
+#endif  /* USE_TASK_MANAGER_WATCHDOG */
+
+#endif	/* _ROOT_TASK_WATCHDOG_H_ */
@@ -36,12 +36,26 @@
 #include <stdint.h>
 
 #include "config/application.h"
+#include "config/converter.h"
 
 //Remove: #include "task_ConverterStateControl.h"
 #include "../h/apl/tasks/task_FaultHandler.h"
 #include "../h/apl/tasks/task_Idle.h"
 #include "../h/apl/tasks/task_DebugLED.h"
 #include "../h/apl/tasks/task_SystemStatus.h"
+#include "../h/apl/tasks/task_Acquisition.h"
+#include "../h/apl/tasks/task_Calibration.h"
+#include "../h/apl/tasks/task_SoftStart.h"
+#include "../h/apl/tasks/task_MsiExchange.h"
+#include "../h/apl/tasks/task_Telemetry.h"
+#include "../h/apl/tasks/task_Parameters.h"
+#include "../h/apl/tasks/task_CanInterface.h"
+#include "../h/apl/tasks/task_FrequencyResponse.h"
+#include "../h/apl/tasks/task_Scope.h"
+#include "../h/apl/resources/multiphase.h"
+#include "../h/apl/resources/feedforward.h"
+#include "../h/apl/resources/efficiency.h"
+#include "../h/apl/resources/cvmc_vout.h"
 
 /* ***********************************************************************************************
  * GLOBAL APPLICATION LAYER USER OPTIONS
@@ -131,10 +131,15 @@ typedef union {
 typedef struct {
     volatile uint16_t v_reference; // Voltage reference dummy for during soft-start control
     volatile uint16_t i_reference; // Current reference dummy for during soft-start control
-    volatile uint16_t interval;  // Soft-start step interval in state-machine ticks
+    volatile uint16_t interval;  // Soft-start step interval in scheduler ticks
     volatile uint16_t step; // Most recent soft-start step
     volatile uint16_t direction; // 0 = RAMP DOWN, 1 = RAMP UP 
     volatile bool ramp_complete; // Flag indicating if the startup ramp has been completed
+    volatile bool ramp_active; // Flag indicating that the reference is ramped by the control loop interrupt
+    volatile uint16_t counter; // Scheduler ticks elapsed in the recent step
+    volatile uint16_t v_target; // Final voltage reference at the end of the ramp-up
+    volatile uint32_t v_ramp; // Ramped voltage reference in Q16.16 format (ADC ticks)
+    volatile uint32_t v_ramp_increment; // Reference change per control loop sample in Q16.16 format
 } CONTROL_SOFT_START_t; // Settings required by the soft-start driver while the converter is ramped up
 
 typedef struct {
@@ -218,7 +223,7 @@ typedef struct {
     volatile SYSTEM_MODE_t system_mode; // system operating mode classification
     volatile CONTROL_STATUS_t ctrl_status; // control loop status information
     volatile CONTROL_SWITCHING_TIMING_SETTINGS_t timing; // PWM switch timing setup 
-    volatile APPLICATION_DATA_t data; // system voltages
+    volatile APPLICATION_DATA_t data; // system voltages (output data of the primary converter, see converter.h)
     
 }APPLICATION_t; // Data structure defining application settings, status flags and recent data
 
@@ -0,0 +1,145 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!converter.h
+ *****************************************************************************
+ * File:   converter.h
+ *
+ * Summary:
+ * Globally defines the power converter instances of the application
+ *
+ * Description:	
+ * Each power stage controlled by this firmware is represented by one instance 
+ * of CONVERTER_t. Instances hold their own control loop binding, soft-start 
+ * state machine, loop settings, feedback data and fault objects. All instances 
+ * are registered in the converter registry and laid out contiguously in the 
+ * global array converter[], which is iterated by the soft-start task. All 
+ * instances share the task scheduler and the fault engine.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * converter.c
+ * task_SoftStart.c
+ * task_FaultHandler.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_CONVERTER_H_
+#define	_APPLICATION_LAYER_CONVERTER_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/config/application.h"
+#include "apl/resources/npnz16b.h"
+
+/*!Converter Registry
+ * *****************************************************************************************************
+ * Converter Registry lists all power stages controlled by this firmware
+ * *****************************************************************************************************
+ * Each power stage is registered by one line 
+ * 
+ *   CONVERTER(id, controller, reference, v_feedback, i_feedback, outputs, v_target, ovp_trip, ovp_release)
+ * 
+ * - id:          index label of the instance in converter[]
+ * - controller:  control loop object (cNPNZ16b_t) executed by the control interrupt of this stage
+ * - reference:   reference variable of the control loop in ADC ticks
+ * - v_feedback:  output voltage feedback (ADC buffer or variable)
+ * - i_feedback:  output current feedback (ADC buffer or variable)
+ * - outputs:     function enabling/overriding the PWM outputs of this stage
+ * - v_target:    nominal output voltage reference at the end of the ramp-up in ADC ticks
+ * - ovp_trip:    output over voltage protection trip level in ADC ticks
+ * - ovp_release: output over voltage protection release level in ADC ticks
+ * 
+ * The first entry is the primary converter. Its feedback data is published in application.data 
+ * for the communication interfaces. Each additional power stage needs its own control loop 
+ * object, PWM generator and control interrupt service routine calling soft_start_Ramp() and 
+ * the control loop of its instance, e.g.
+ * 
+ *   CONVERTER(CONVERTER_VOUT2, cvmc_vout2, cvmc_vout2_reference, ADC_FAST_VOUT2_ADCBUF, ...)
+ * 
+ * For each instance the fault handler adds one output over voltage protection fault object 
+ * (label FLTOBJ_OVP_<id>) to the fault object list.
+ * *****************************************************************************************************/
+
+#define CONVERTER_REGISTRY(CONVERTER) \
+    CONVERTER(CONVERTER_VOUT, cvmc_vout, cvmc_vout_reference, ADC_FAST_VOUT_ADCBUF, application.data.i_out, \
+              multiphase_EnableOutputs, SOFT_START_V_TARGET, VOUT_OVP_TRIP, VOUT_OVP_RELEASE) /* Output voltage converter */
+
+#define CONVERTER_REGISTRY_INDEX(id, controller, reference, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) id,
+
+typedef enum {
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_INDEX)
+    CONVERTER_COUNT // Number of registered converter instances
+}CONVERTER_INDEX_e; // Index labels of converter instances in converter[]
+
+#define CONVERTER_PRIMARY               0       // Index of the primary converter instance
+
+/*!CONVERTER_t
+ * *****************************************************************************************************
+ * Summary:
+ * Power converter instance
+ * 
+ * Description:
+ * status.flags.pwm_started and status.flags.system_ready indicate the outputs of this power stage 
+ * being released and its startup sequence being complete. The operating mode substate of the 
+ * power stage is tracked by soft_start.step (see task_SoftStart.h). The system-level status 
+ * application.ctrl_status is derived from all instances.
+ * *****************************************************************************************************/
+
+typedef struct {
+    volatile uint16_t v_out; // output voltage of the power stage
+    volatile uint16_t i_out; // output current of the power stage
+} CONVERTER_DATA_t; // Real-time data of a power converter instance
+
+typedef struct {
+    volatile CONTROL_STATUS_t status; // status flags of this power stage
+    volatile CONTROL_SOFT_START_t soft_start; // soft-start/soft-stop state machine
+    volatile CONTROL_LOOP_SETTINGS_t loop; // control loop settings (nominal reference, output clamping)
+    volatile CONVERTER_DATA_t data; // most recent feedback data
+    volatile cNPNZ16b_t* controller; // control loop object of this power stage
+    volatile uint16_t* ptrReference; // reference variable of the control loop
+    volatile uint16_t* ptrVoltageFeedback; // output voltage feedback source
+    volatile uint16_t* ptrCurrentFeedback; // output current feedback source
+    volatile uint16_t (*enable_outputs)(volatile bool enable); // PWM output enable/override function
+    struct FAULT_OBJECT_s* fltobj_ovp; // output over voltage protection fault object (see task_FaultHandler.c)
+    volatile uint16_t index; // index of this instance in converter[]
+} CONVERTER_t; // Power converter instance
+
+
+// Global array of converter instances 
+extern volatile CONVERTER_t converter[CONVERTER_COUNT];
+
+// Initialization of the converter instances
+extern volatile uint16_t init_Converters(void);
+extern volatile uint16_t converter_UpdateData(void);
+
+
+#endif	/* _APPLICATION_LAYER_CONVERTER_H_ */
@@ -0,0 +1,123 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!events.h
+ *****************************************************************************
+ * File:   events.h
+ *
+ * Summary:
+ * Globally defines the events and subscribers of the event bus
+ *
+ * Description:	
+ * Events posted by the task manager, the fault handler and application 
+ * modules and the events each subscribing task is interested in are 
+ * registered here (see USE_TASK_MANAGER_EVENT_BUS and task_event.c).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_event.c
+ * task_event.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_EVENT_REGISTRY_H_
+#define	_APPLICATION_LAYER_EVENT_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+/*!Event Registry
+ * *****************************************************************************************************
+ * Event Registry lists all events which can be posted on the event bus
+ * *****************************************************************************************************
+ * Each event is registered by one line EVENT(event_id). The order of registration defines the 
+ * event ID and its bit in subscriber event masks (see EVENT_MASK()). Events posted by the task 
+ * manager and the fault handler (EVT_OP_MODE_SWITCH, EVT_STARTUP_COMPLETE, EVT_FAULT_TRIP and 
+ * EVT_FAULT_RELEASE) are required by the firmware root layer.
+ * *****************************************************************************************************/
+
+#define EVENT_REGISTRY(EVENT) \
+    EVENT(EVT_OP_MODE_SWITCH)       /* Task manager switched to the task queue of a new operating mode */ \
+    EVENT(EVT_STARTUP_COMPLETE)     /* Device and system startup sequence has been completed */ \
+    EVENT(EVT_FAULT_TRIP)           /* Fault object tripped (global fault flags and fault override updated) */ \
+    EVENT(EVT_FAULT_RELEASE)        /* Global fault flag released or system recovered from a fault */ \
+    EVENT(EVT_ADC_READY)            /* New snapshot of the slow ADC channels published (see task_Acquisition.c) */
+
+/*!task_event_id_e
+ * *****************************************************************************************************
+ * Readable event IDs generated from the event registry
+ * *****************************************************************************************************/
+#define EVENT_REGISTRY_ENUM(id)                     id,
+#define EVENT_REGISTRY_COUNT(id)                    + 1
+
+typedef enum {
+    
+    EVENT_REGISTRY(EVENT_REGISTRY_ENUM)
+
+    EVENT_COUNT // Number of registered events (has to be the last item of this list)
+            
+} task_event_id_e;
+
+#define EVENT_MASK(id)                              ((uint16_t)(1U << (id))) // Bit of event in event masks
+
+/*!Event Subscriber Registry
+ * *****************************************************************************************************
+ * Event Subscriber Registry lists all tasks taking events from the event bus
+ * *****************************************************************************************************
+ * Each subscriber is registered by one line SUBSCRIBER(subscriber_id, events), with events being 
+ * the ORed event masks of all events the subscriber is interested in. Posted events are only 
+ * delivered to subscribers which have declared the event.
+ * *****************************************************************************************************/
+
+#define EVENT_SUBSCRIBER_REGISTRY(SUBSCRIBER) \
+    SUBSCRIBER(EVENT_SUB_DEBUG_LED, EVENT_MASK(EVT_OP_MODE_SWITCH))     /* Debug LED pattern follows the operating mode */ \
+    SUBSCRIBER(EVENT_SUB_SYSTEM_STATUS, (EVENT_MASK(EVT_OP_MODE_SWITCH) | EVENT_MASK(EVT_STARTUP_COMPLETE) | \
+                EVENT_MASK(EVT_FAULT_TRIP) | EVENT_MASK(EVT_FAULT_RELEASE))) /* Startup and fault override state of the system mode */ \
+    SUBSCRIBER(EVENT_SUB_EFFICIENCY, EVENT_MASK(EVT_ADC_READY))         /* Light-load efficiency manager evaluates new output current samples */
+
+/*!task_event_subscriber_e
+ * *****************************************************************************************************
+ * Readable subscriber IDs generated from the event subscriber registry
+ * *****************************************************************************************************/
+#define EVENT_SUBSCRIBER_REGISTRY_ENUM(id, events)  id,
+#define EVENT_SUBSCRIBER_REGISTRY_COUNT(id, events) + 1
+
+typedef enum {
+    
+    EVENT_SUBSCRIBER_REGISTRY(EVENT_SUBSCRIBER_REGISTRY_ENUM)
+
+    EVENT_SUBSCRIBER_COUNT // Number of registered subscribers (has to be the last item of this list)
+            
+} task_event_subscriber_e;
+
+#if ((0 EVENT_REGISTRY(EVENT_REGISTRY_COUNT)) > 16) || ((0 EVENT_SUBSCRIBER_REGISTRY(EVENT_SUBSCRIBER_REGISTRY_COUNT)) > 16)
+  #error === the event bus supports up to 16 events and 16 subscribers ===
+#endif
+
+#endif	/* _APPLICATION_LAYER_EVENT_REGISTRY_H_ */
@@ -0,0 +1,237 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!parameters.h
+ *****************************************************************************
+ * File:   parameters.h
+ *
+ * Summary:
+ * Globally defines the runtime tunable parameters
+ *
+ * Description:	
+ * The parameter access protocol (see task_Parameters.c) allows a host to read 
+ * and write the variables registered here over the telemetry UART without 
+ * halting the core or rebuilding the firmware.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_Parameters.c
+ * task_Parameters.h
+ * telemetry.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_PARAMETER_REGISTRY_H_
+#define	_APPLICATION_LAYER_PARAMETER_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+#include "apl/apl.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/fdrv_FaultHandler.h"
+#include "_root/generic/task_benchmark.h"
+#include "_root/generic/task_trace.h"
+#include "_root/generic/task_jitter.h"
+
+// Fault objects of the task manager flow control (see task_FaultHandler.c)
+extern FAULT_OBJECT_t fltobj_CPULoadOverrun;
+extern FAULT_OBJECT_t fltobj_TaskTimeQuotaViolation;
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+extern FAULT_OBJECT_t fltobj_SlotStartLatency;
+#endif
+
+/*!Parameter Flags
+ * *****************************************************************************************************
+ * Access flags of registered parameters
+ * *****************************************************************************************************
+ * - PARAM_FLAG_READ_ONLY: write requests are rejected
+ * - PARAM_FLAG_SIGNED: value is a signed integer (two's complement)
+ * - PARAM_FLAG_ISR_SHARED: value is read by interrupt service routines. 16-bit values are written
+ *   by one atomic word write. Interrupts of priority levels 1-6 are suspended while values of 
+ *   other sizes are written
+ * - PARAM_FLAG_FAULT_LEVEL: value is a fault object setting. The fault engine is recompiled after 
+ *   the value has been written
+ * *****************************************************************************************************/
+
+#define PARAM_FLAG_NONE                 0x0000  // Read/write unsigned integer
+#define PARAM_FLAG_READ_ONLY            0x0001  // Parameter cannot be written
+#define PARAM_FLAG_SIGNED               0x0002  // Parameter is a signed integer
+#define PARAM_FLAG_ISR_SHARED           0x0004  // Parameter is accessed by interrupt service routines
+#define PARAM_FLAG_FAULT_LEVEL          0x0008  // Parameter is a fault object setting
+
+/*!Parameter Registry
+ * *****************************************************************************************************
+ * Parameter Registry lists all variables which can be accessed by the parameter access protocol
+ * *****************************************************************************************************
+ * Each parameter is registered by one line PARAM(param_id, variable, minimum, maximum, flags). 
+ * The variable has to be an integer of 1, 2 or 4 bytes. Its size is determined by sizeof(variable) (checked at compile time).
+ * Written values outside the range [minimum, maximum] are rejected.
+ * 
+ * The parameter registry is expanded at compile time into
+ * 
+ *   - the parameter ID enumeration parameter_id_e (used as parameter ID by the host)
+ *   - the constant parameter table located in program memory
+ * 
+ * Parameters are read and written by the parameter task between other tasks of the scheduler. 
+ * Values which are copied into other data structures during initialization only take effect 
+ * when the copy is refreshed (e.g. DebugLED tick rates take effect at the next operating mode 
+ * switch).
+ * 
+ * Parameters declared by BENCH_PARAM(PARAM, ...) are only registered when the on-target 
+ * micro-benchmark is enabled (see USE_TASK_MANAGER_BENCHMARK). The result of the benchmark case 
+ * written to PRM_BENCH_SELECT can be read after the next call of the benchmark task.
+ * Parameters declared by JITTER_PARAM(PARAM, ...) are only registered when the slot-start latency
+ * monitor is enabled (see USE_TASK_MANAGER_JITTER_MONITOR).
+ * Parameters declared by TRACE_PARAM(PARAM, ...) are only registered when trace points are 
+ * recorded (see USE_TASK_MANAGER_TRACE). Writing 0 to PRM_TRACE_FROZEN resumes recording after
+ * the trace has been frozen by a trap.
+ * Parameters declared by FRA_PARAM(PARAM, ...) are only registered when the online loop gain
+ * measurement is enabled (see USE_FREQUENCY_RESPONSE_ANALYZER). Writing FRA_COMMAND_START to 
+ * PRM_FRA_COMMAND starts a frequency sweep, writing FRA_COMMAND_STOP stops it.
+ * Parameters declared by EFFICIENCY_PARAM(PARAM, ...) are only registered when the light-load
+ * efficiency manager is enabled (see USE_EFFICIENCY_MANAGER). Writing 0 to PRM_EFFICIENCY_ENABLE
+ * returns the converter to the nominal switching frequency (e.g. for comparative measurements).
+ * Parameters declared by SCOPE_PARAM(PARAM, ...) are only registered when the triggered waveform
+ * capture is enabled (see USE_SCOPE). Writing SCOPE_COMMAND_READ to PRM_SCOPE_COMMAND sends the 
+ * frozen capture (PRM_SCOPE_STATE = SCOPE_STATE_FROZEN), writing SCOPE_COMMAND_ARM restarts it.
+ * *****************************************************************************************************/
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+  #define BENCH_PARAM(PARAM, id, variable, minimum, maximum, flags)    PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define BENCH_PARAM(PARAM, id, variable, minimum, maximum, flags)    /* no micro-benchmark */
+#endif
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+  #define JITTER_PARAM(PARAM, id, variable, minimum, maximum, flags)   PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define JITTER_PARAM(PARAM, id, variable, minimum, maximum, flags)   /* no jitter monitor */
+#endif
+
+#if (USE_TASK_MANAGER_TRACE == 1)
+  #define TRACE_PARAM(PARAM, id, variable, minimum, maximum, flags)    PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define TRACE_PARAM(PARAM, id, variable, minimum, maximum, flags)    /* no trace recording */
+#endif
+
+#if (USE_FREQUENCY_RESPONSE_ANALYZER == 1)
+  #define FRA_PARAM(PARAM, id, variable, minimum, maximum, flags)      PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define FRA_PARAM(PARAM, id, variable, minimum, maximum, flags)      /* no loop gain measurement */
+#endif
+
+#if (EFFICIENCY_ENABLED)
+  #define EFFICIENCY_PARAM(PARAM, id, variable, minimum, maximum, flags) PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define EFFICIENCY_PARAM(PARAM, id, variable, minimum, maximum, flags) /* fixed switching frequency */
+#endif
+
+#if (USE_SCOPE == 1)
+  #define SCOPE_PARAM(PARAM, id, variable, minimum, maximum, flags)    PARAM(id, variable, minimum, maximum, flags)
+#else
+  #define SCOPE_PARAM(PARAM, id, variable, minimum, maximum, flags)    /* no waveform capture */
+#endif
+
+#define PARAMETER_REGISTRY(PARAM) \
+    /* Fault object settings */ \
+    PARAM(PRM_FLT_CPU_LOAD_TRIP, fltobj_CPULoadOverrun.criteria.trip_level, 0, 1000, PARAM_FLAG_FAULT_LEVEL) \
+    PARAM(PRM_FLT_CPU_LOAD_RESET, fltobj_CPULoadOverrun.criteria.reset_level, 0, 1000, PARAM_FLAG_FAULT_LEVEL) \
+    PARAM(PRM_FLT_CPU_LOAD_TRIP_CNT, fltobj_CPULoadOverrun.criteria.trip_cnt_threshold, 1, 1000, PARAM_FLAG_FAULT_LEVEL) \
+    PARAM(PRM_FLT_QUOTA_TRIP, fltobj_TaskTimeQuotaViolation.criteria.trip_level, 0, 0xFFFF, PARAM_FLAG_FAULT_LEVEL) \
+    JITTER_PARAM(PARAM, PRM_FLT_SLOT_LATENCY_TRIP, fltobj_SlotStartLatency.criteria.trip_level, 0, 0xFFFF, PARAM_FLAG_FAULT_LEVEL) \
+    \
+    /* Output voltage control loop (active when gain scheduling is disabled) */ \
+    PARAM(PRM_CVMC_VOUT_A1, cvmc_vout_ACoefficients[0], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_A2, cvmc_vout_ACoefficients[1], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_A3, cvmc_vout_ACoefficients[2], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_B0, cvmc_vout_BCoefficients[0], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_B1, cvmc_vout_BCoefficients[1], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_B2, cvmc_vout_BCoefficients[2], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_B3, cvmc_vout_BCoefficients[3], INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_MIN_OUTPUT, cvmc_vout.MinOutput, INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    PARAM(PRM_CVMC_VOUT_MAX_OUTPUT, cvmc_vout.MaxOutput, INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    \
+    /* DebugLED timing */ \
+    PARAM(PRM_LED_TICK_RATE_DEFAULT, taskDebugLED_tick_rate_default, 1, 30000, PARAM_FLAG_NONE) \
+    PARAM(PRM_LED_TICK_RATE_FAULT, taskDebugLED_tick_rate_fault, 1, 30000, PARAM_FLAG_NONE) \
+    \
+    /* Status information */ \
+    PARAM(PRM_CPU_LOAD_PEAK, task_mgr.cpu_load.peak, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    JITTER_PARAM(PARAM, PRM_SLOT_LATENCY_MAX, slot_profile.maximum, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    JITTER_PARAM(PARAM, PRM_SLOT_LATE_COUNT, slot_profile.late, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    JITTER_PARAM(PARAM, PRM_SLOT_TIME_MAX, slot_profile.slot_time_max, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    \
+    /* Micro-benchmark results in CPU cycles */ \
+    BENCH_PARAM(PARAM, PRM_BENCH_SELECT, bench.select, 0, (BENCH_CASE_COUNT - 1), PARAM_FLAG_NONE) \
+    BENCH_PARAM(PARAM, PRM_BENCH_MINIMUM, bench.view.minimum, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    BENCH_PARAM(PARAM, PRM_BENCH_MAXIMUM, bench.view.maximum, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    BENCH_PARAM(PARAM, PRM_BENCH_AVERAGE, bench.view.average, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    BENCH_PARAM(PARAM, PRM_BENCH_SAMPLES, bench.view.samples, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    BENCH_PARAM(PARAM, PRM_BENCH_OVERHEAD, bench.overhead, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    \
+    /* Online loop gain measurement */ \
+    FRA_PARAM(PARAM, PRM_FRA_COMMAND, fra.command, FRA_COMMAND_NONE, FRA_COMMAND_STOP, PARAM_FLAG_NONE) \
+    FRA_PARAM(PARAM, PRM_FRA_AMPLITUDE, fra.amplitude, 1, FRA_AMPLITUDE_MAX, PARAM_FLAG_ISR_SHARED) \
+    FRA_PARAM(PARAM, PRM_FRA_POINT, fra.point, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    \
+    /* Light-load efficiency manager */ \
+    EFFICIENCY_PARAM(PARAM, PRM_EFFICIENCY_ENABLE, efficiency.enable, 0, 1, PARAM_FLAG_NONE) \
+    EFFICIENCY_PARAM(PARAM, PRM_EFFICIENCY_MODE, efficiency.mode, EFFICIENCY_MODE_FIXED, EFFICIENCY_MODE_BURST, PARAM_FLAG_READ_ONLY) \
+    EFFICIENCY_PARAM(PARAM, PRM_EFFICIENCY_TRANSITIONS, efficiency.transitions, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    EFFICIENCY_PARAM(PARAM, PRM_EFFICIENCY_BURSTS, efficiency.bursts, 0, 0xFFFF, PARAM_FLAG_READ_ONLY) \
+    \
+    /* Triggered waveform capture */ \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_COMMAND, scope.command, SCOPE_COMMAND_NONE, SCOPE_COMMAND_STOP, PARAM_FLAG_NONE) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_TRIGGER, scope.trigger, SCOPE_TRIGGER_NONE, SCOPE_TRIGGER_OP_MODE, PARAM_FLAG_ISR_SHARED) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_CHANNEL, scope.channel, 0, (SCOPE_CHANNEL_COUNT - 1), PARAM_FLAG_ISR_SHARED) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_LEVEL, scope.level, INT16_MIN, INT16_MAX, (PARAM_FLAG_SIGNED | PARAM_FLAG_ISR_SHARED)) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_DECIMATION, scope.decimation, 1, 0xFFFF, PARAM_FLAG_ISR_SHARED) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_PRETRIGGER, scope.pretrigger, 1, (SCOPE_DEPTH - 2), PARAM_FLAG_NONE) \
+    SCOPE_PARAM(PARAM, PRM_SCOPE_STATE, scope.state, SCOPE_STATE_IDLE, SCOPE_STATE_READOUT, PARAM_FLAG_READ_ONLY) \
+    \
+    /* Trace recording */ \
+    TRACE_PARAM(PARAM, PRM_TRACE_FROZEN, trace.frozen, 0, 1, PARAM_FLAG_NONE) \
+    TRACE_PARAM(PARAM, PRM_TRACE_COUNT, trace.count, 0, 0xFFFF, PARAM_FLAG_READ_ONLY)
+
+/*!parameter_id_e
+ * *****************************************************************************************************
+ * Readable parameter IDs generated from the parameter registry
+ * *****************************************************************************************************/
+#define PARAMETER_REGISTRY_ENUM(id, variable, minimum, maximum, flags)  id,
+
+typedef enum {
+    
+    PARAMETER_REGISTRY(PARAMETER_REGISTRY_ENUM)
+
+    PARAMETER_COUNT // Number of registered parameters (has to be the last item of this list)
+            
+} parameter_id_e;
+
+#endif	/* _APPLICATION_LAYER_PARAMETER_REGISTRY_H_ */
@@ -0,0 +1,94 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!scope.h
+ *****************************************************************************
+ * File:   scope.h
+ *
+ * Summary:
+ * Globally defines the channels recorded by the waveform capture
+ *
+ * Description:	
+ * The waveform capture records the variables registered here in each control 
+ * loop interrupt (or each n-th interrupt) into a RAM buffer and sends the 
+ * captured waveforms as telemetry response frames (see task_Scope.c).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_Scope.c
+ * task_Scope.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_SCOPE_REGISTRY_H_
+#define	_APPLICATION_LAYER_SCOPE_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+/*!Scope Registry
+ * *****************************************************************************************************
+ * Scope Registry lists all variables which are recorded in each sample of the waveform capture
+ * *****************************************************************************************************
+ * Each channel is registered by one line CHANNEL(channel_id, variable). The variable has to be a 
+ * 16-bit value. Signed values are recorded in two's complement. Registers and variables are read 
+ * directly by the control loop interrupt service routine after the control loop has been executed.
+ * 
+ * The scope registry is expanded at compile time into
+ * 
+ *   - the channel ID enumeration scope_channel_id_e (used as trigger channel by the host)
+ *   - the copy instructions recording one sample in the control loop interrupt (SCOPE_SAMPLE())
+ * 
+ * Each sample holds all registered channels in order of registration. Every registered channel 
+ * adds two bytes of RAM per sample of the capture depth (see SCOPE_DEPTH) and one word copy to 
+ * the control loop interrupt while a capture is recorded. Each telemetry response frame carries at 
+ * least one sample of up to ten registered channels (see SCOPE_SAMPLES_PER_FRAME).
+ * *****************************************************************************************************/
+
+#define SCOPE_REGISTRY(CHANNEL) \
+    CHANNEL(SCOPE_CH_VOUT, CVMC_VOUT_ADC_BUFFER)                    /* Output voltage feedback in ADC ticks */ \
+    CHANNEL(SCOPE_CH_IOUT, ADC_SLOW_ADCBUF(ADC_SLOW_IOUT))          /* Most recent output current conversion in ADC ticks */ \
+    CHANNEL(SCOPE_CH_ERROR, cvmc_vout_ErrorHistory[0])              /* Most recent control error of the output voltage loop (signed) */ \
+    CHANNEL(SCOPE_CH_DUTY, CVMC_VOUT_PWM_DUTY_CYCLE)                /* Duty cycle in PWM ticks */
+
+/*!scope_channel_id_e
+ * *****************************************************************************************************
+ * Readable channel IDs generated from the scope registry
+ * *****************************************************************************************************/
+#define SCOPE_REGISTRY_ENUM(id, variable)           id,
+
+typedef enum {
+    
+    SCOPE_REGISTRY(SCOPE_REGISTRY_ENUM)
+
+    SCOPE_CHANNEL_COUNT // Number of registered channels (has to be the last item of this list)
+            
+} scope_channel_id_e;
+
+#endif	/* _APPLICATION_LAYER_SCOPE_REGISTRY_H_ */
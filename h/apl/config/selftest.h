@@ -0,0 +1,110 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!selftest.h
+ *****************************************************************************
+ * File:   selftest.h
+ *
+ * Summary:
+ * Globally defines the memory regions skipped by the run-time self-test
+ *
+ * Description:	
+ * The run-time self-test covers the application image in program memory by
+ * a CRC and the data memory below the stack by a March test (see 
+ * task_selftest.c). Program memory written at runtime and data memory 
+ * accessed by DMA or peripheral bus masters are registered here and skipped.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_selftest.c
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_SELFTEST_REGISTRY_H_
+#define	_APPLICATION_LAYER_SELFTEST_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+#include "_root/config/fault_handler_config.h"
+#include "_root/generic/fdrv_FaultLog.h"
+#include "hal/initialization/init_uart.h"
+#include "hal/initialization/init_can.h"
+#include "apl/tasks/task_Telemetry.h"
+#include "apl/tasks/task_Calibration.h"
+
+/*!Flash Exclusion Registry
+ * *****************************************************************************************************
+ * Flash Exclusion Registry lists all program memory regions which are written at runtime
+ * *****************************************************************************************************
+ * Each region is registered by one line REGION(address, length) with
+ * 
+ *  - address: program memory address of the first instruction word of the region (32-bit)
+ *  - length:  length of the region in program counter units (two per instruction word)
+ * 
+ * Instruction words within registered regions are not added to the flash CRC. Addresses are read 
+ * when a pass is started and may be run-time variables initialized during the startup sequence.
+ * Regions only existing in some builds are wrapped by SELF_TEST_FAULT_LOG_REGION(REGION, ...) or 
+ * SELF_TEST_CALIBRATION_REGION(REGION, ...), which only add the region when the program memory 
+ * fault log (see USE_FAULT_LOG_FLASH) or the calibration record page (see 
+ * USE_SENSE_CALIBRATION_FLASH) is enabled.
+ * *****************************************************************************************************/
+
+#if (USE_FAULT_LOG == 1) && (USE_FAULT_LOG_FLASH == 1)
+  #define SELF_TEST_FAULT_LOG_REGION(REGION, ...)       REGION(__VA_ARGS__)
+#else
+  #define SELF_TEST_FAULT_LOG_REGION(REGION, ...)
+#endif
+
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+  #define SELF_TEST_CALIBRATION_REGION(REGION, ...)     REGION(__VA_ARGS__)
+#else
+  #define SELF_TEST_CALIBRATION_REGION(REGION, ...)
+#endif
+
+#define SELF_TEST_FLASH_EXCLUDE_REGISTRY(REGION) \
+    SELF_TEST_FAULT_LOG_REGION(REGION, fault_log_flash_base, (FAULT_LOG_FLASH_PAGES * FAULT_LOG_FLASH_PAGE_SIZE))  /* Fault event log */ \
+    SELF_TEST_CALIBRATION_REGION(REGION, calibration_flash_base, CALIBRATION_FLASH_PAGE_SIZE)                     /* Sense offset calibration record */
+
+/*!RAM Exclusion Registry
+ * *****************************************************************************************************
+ * RAM Exclusion Registry lists all data memory buffers accessed by DMA or peripheral bus masters
+ * *****************************************************************************************************
+ * Each buffer is registered by one line BUFFER(variable). Data memory blocks overlapping a 
+ * registered buffer are not tested, as DMA transfers are not held off while a block is tested.
+ * The stack is not covered by the RAM March test and does not need to be registered.
+ * *****************************************************************************************************/
+
+#define SELF_TEST_RAM_EXCLUDE_REGISTRY(BUFFER) \
+    BUFFER(uart_rx_buffer)          /* UART receive ring buffer written by DMA channel #1 */ \
+    BUFFER(telemetry_frame)         /* Telemetry frames read by DMA channel #0 */ \
+    BUFFER(can_message_ram)         /* Message object RAM of the CAN FD module */
+
+#endif	/* _APPLICATION_LAYER_SELFTEST_REGISTRY_H_ */
@@ -55,6 +55,7 @@
  * INCLUDE OF HEADERS ALSO CONTAINING GLOBALLY AVAILABLE FUNCTION CALLS
  * ***********************************************************************************************/
 #include "apl/apl.h"
+#include "_root/generic/task_benchmark.h"
 
 /* *****************************************************************************************************
  * Prototypes of external function used in task lists
@@ -72,50 +73,187 @@
 
 /* Prototypes of additional initialization task functions */
 
-/*!Task Table
+/*!Task Registry
  * *****************************************************************************************************
- * Task Table lists all tasks which will be called by the task manager
+ * Task Registry lists all tasks which will be called by the task manager
  * *****************************************************************************************************
- * This is the list which defines ALL available tasks as enumerated items of an array.
- * These enumerations will be combined freely in so called Task Flow Lists which will then be called
- * by the manager's function calls from the main loop
+ * This is the list which defines ALL available tasks. Each task is registered by one line
+ * TASK(task_id, function), combining the readable task ID with the function executed.
+ * 
+ * The task registry is expanded at compile time into
+ * 
+ *   - the task ID enumeration task_id_no_e (used to compose task queues)
+ *   - the constant dispatch table Task_Table[] located in program memory (PSV)
+ * 
+ * Both are therefore always in sync. Tasks are enumerated in order of appearance. 
+ * TASK_IDLE has to remain the last entry of this list.
  * *****************************************************************************************************/
 
-extern volatile uint16_t(*Task_Table[])(void);
+#define TASK_REGISTRY(TASK) \
+    /* Cross-function modules */ \
+    TASK(TASK_INIT_APPLICATION_SETTINGS, init_ApplicationSettings)  /* Task initializing system-wide application data structure */ \
+    TASK(TASK_INIT_FAULT_OBJECTS, init_FaultObjects)                /* Task initializing default and user defined fault objects */ \
+    TASK(TASK_CAPTURE_SYSTEM_STATUS, exec_CaptureSystemStatus)      /* Captures detection signals and analyzes voltages to determine the operating mode */ \
+    TASK(TASK_INIT_ACQUISITION, init_Acquisition)                   /* Task resetting the slow ADC channel snapshot */ \
+    TASK(TASK_ACQUISITION, exec_Acquisition)                        /* Collects the slow ADC channels into the double-buffered snapshot */ \
+    TASK(TASK_INIT_CALIBRATION, init_Calibration)                   /* Task loading and applying the stored sense offsets */ \
+    TASK(TASK_CALIBRATION, exec_Calibration)                        /* Measures and stores the sense offsets while the power stage is turned off */ \
+    TASK(TASK_SOFT_START, exec_SoftStart)                           /* Soft-start/soft-stop state machine of the power converter */ \
+    TASK(TASK_INIT_MSI_EXCHANGE, init_MsiExchange)                  /* Task initializing the master/slave core data exchange */ \
+    TASK(TASK_MSI_EXCHANGE, exec_MsiExchange)                       /* Exchanges data between master and slave core through the MSI mailboxes */ \
+    TASK(TASK_INIT_TELEMETRY, init_Telemetry)                       /* Task initializing the binary telemetry data stream */ \
+    TASK(TASK_TELEMETRY, exec_Telemetry)                            /* Sends one telemetry snapshot frame via UART DMA */ \
+    TASK(TASK_INIT_PARAMETERS, init_Parameters)                     /* Task initializing the runtime parameter access protocol */ \
+    TASK(TASK_PARAMETERS, exec_Parameters)                          /* Executes one received parameter read/write request */ \
+    TASK(TASK_INIT_CAN_INTERFACE, init_CanInterface)                /* Task initializing the CAN FD status and command interface */ \
+    TASK(TASK_CAN_INTERFACE, exec_CanInterface)                     /* Publishes the CAN status message and executes CAN commands */ \
+    TASK(TASK_BENCHMARK, exec_TaskBenchmark)                        /* Samples the micro-benchmark of the framework hot paths */ \
+    TASK(TASK_INIT_FREQUENCY_RESPONSE, init_FrequencyResponse)      /* Task initializing the online loop gain measurement */ \
+    TASK(TASK_FREQUENCY_RESPONSE, exec_FrequencyResponse)           /* Evaluates and sends the loop gain of each point of a frequency sweep */ \
+    TASK(TASK_SCOPE, exec_Scope)                                    /* Executes waveform capture commands and sends frozen captures */ \
+    \
+    /* ===== USER FUNCTIONS LIST ===== */ \
+    \
+    /* Chip level initialization */ \
+    TASK(TASK_LAUNCH_OSCILLATOR, launch_oscillator) /* Task polling the deferred PLL lock (see USE_DEFERRED_CLOCK_STARTUP) */ \
+    TASK(TASK_INIT_GPIO, init_gpio)                 /* Task initializing the chip GPIOs */ \
+    TASK(TASK_INIT_IRQ, init_irq)                   /* Task initializing the interrupt controller */ \
+    TASK(TASK_INIT_DSP, initialize_dsp)             /* Task initializing the digital signal controller */ \
+    TASK(TASK_INIT_ADC, init_adc)                   /* Task initializing the ADC acquisition pipeline */ \
+    TASK(TASK_LAUNCH_ADC, launch_adc)               /* Task powering up the ADC cores */ \
+    TASK(TASK_INIT_PWM, init_pwm)                   /* Task initializing the high-resolution PWM generator */ \
+    TASK(TASK_LAUNCH_PWM, launch_pwm)               /* Task starting the PWM generator (outputs overridden) */ \
+    TASK(TASK_INIT_UART, init_uart)                 /* Task initializing the telemetry UART and its DMA channel */ \
+    TASK(TASK_INIT_CAN, init_can)                   /* Task initializing the CAN FD module */ \
+    \
+    /* Board level initialization */ \
+    TASK(TASK_INIT_DebugLED, init_taskDebugLED)     /* initialize DebugLED task */ \
+    TASK(TASK_DGBLED, task_DebugLED)                /* run DebugLED task */ \
+    \
+    /* Add System function / Special function initialization */ \
+    TASK(TASK_INIT_CVMC_VOUT, cvmc_vout_Init)       /* Task initializing the output voltage control loop */ \
+    TASK(TASK_CVMC_VOUT_GAIN_SCHEDULER, cvmc_vout_GainScheduler) /* Task switching the output voltage control loop coefficient banks */ \
+    TASK(TASK_INIT_MULTIPHASE, multiphase_Init)     /* Task initializing the phase descriptors of the interleaved converter */ \
+    TASK(TASK_MULTIPHASE_PHASE_MANAGER, multiphase_PhaseManager) /* Task shedding/adding converter phases depending on load */ \
+    TASK(TASK_FEEDFORWARD, feedforward_Update)      /* Task interpolating the feed-forward gain and dead-time compensation */ \
+    TASK(TASK_EFFICIENCY_MANAGER, efficiency_Manager) /* Task selecting switching frequency and burst mode depending on load */ \
+    \
+    /* ===== END OF USER FUNCTIONS ===== */ \
+    \
+    /* Empty task used as internal task execution timing buffer */ \
+    TASK(TASK_IDLE, task_Idle)                      /* Default task not performing any action but occupying a task time frame */
 
 /*!task_id_no_e
  * *****************************************************************************************************
  * The task_id_no_e enum is for easy addressing task-items from Task_Table using readable 
- * defines instead of indices. 
+ * defines instead of indices. It is generated from the task registry.
  * *****************************************************************************************************/
+#define TASK_REGISTRY_ENUM(id, function)        id,
+
 typedef enum {
     
-    
-    // Cross-function modules
-    TASK_INIT_APPLICATION_SETTINGS, // Task initializing system-wide application data structure
-    TASK_INIT_FAULT_OBJECTS,        // Task initializing default and user defined fault objects
-    TASK_CAPTURE_SYSTEM_STATUS,     // Captures detection signals and analyzes voltages to determine the operating mode
+    TASK_REGISTRY(TASK_REGISTRY_ENUM)
 
-    /* ===== USER FUNCTIONS LIST ===== */
+    TASK_TABLE_SIZE // Number of registered tasks (has to be the last item of this list)
             
-    // Chip level initialization
-    TASK_INIT_GPIO, // Task initializing the chip GPIOs
-    TASK_INIT_IRQ, // Task initializing the interrupt controller
-    TASK_INIT_DSP, // Task initializing the digital signal controller
-        
-    // Board level initialization
-    TASK_INIT_DebugLED,          // initialize DebugLED task
-    TASK_DGBLED,               // run DebugLED task
+} task_id_no_e;
+
+/*!Task Table
+ * *****************************************************************************************************
+ * Constant dispatch table generated from the task registry
+ * *****************************************************************************************************/
+
+extern volatile uint16_t (* const Task_Table[TASK_TABLE_SIZE])(void);
+
+/*!Real-Time Task Registry
+ * *****************************************************************************************************
+ * Real-Time Task Registry lists all tasks which will be called by the real-time task tier
+ * *****************************************************************************************************
+ * Real-time tasks are executed by the interrupt service routine of the real-time tier timer 
+ * (see USE_TASK_MANAGER_RT_TIER in task_manager_config.h) preempting all cooperative tasks. 
+ * Each task is registered by one line RT_TASK(id, function, period, phase, deadline):
+ * 
+ *   - id:       readable real-time task ID (index into rt_task_status[])
+ *   - function: task function of type uint16_t (void)
+ *   - period:   call period in real-time tier ticks
+ *   - phase:    tier tick of the first call (0 ... period-1)
+ *   - deadline: latest completion time after the release of the tier tick in [sec]
+ * 
+ * Tasks are executed in order of registration. The first entry has the highest priority.
+ * Real-time task functions have to be short and must not call functions of the cooperative 
+ * task queues.
+ * 
+ * Example:
+ *   RT_TASK(RT_TASK_SOFT_START, task_SoftStart, 1, 0, 20.0e-6)
+ * *****************************************************************************************************/
 
-    // Add System function / Special function initialization
+#define RT_TASK_REGISTRY(RT_TASK) \
+    /* add real-time tasks here */
 
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+#define RT_TASK_REGISTRY_ENUM(id, function, period, phase, deadline)  id,
+
+typedef enum {
+    
+    RT_TASK_REGISTRY(RT_TASK_REGISTRY_ENUM)
+    
+    RT_TASK_TABLE_SIZE // Number of registered real-time tasks (has to be the last item of this list)
             
-    /* ===== END OF USER FUNCTIONS ===== */
+} rt_task_id_no_e;
 
-    // Empty task used as internal task execution timing buffer
-    TASK_IDLE  // Default task not performing any action but occupying a task time frame
+extern const rt_task_descriptor_t rt_task_table[RT_TASK_TABLE_SIZE];
 
-} task_id_no_e;
+#endif
+
+/*!Watchdog Check-In Registry
+ * *****************************************************************************************************
+ * Watchdog Check-In Registry lists all tasks which have to check in before the watchdog timer 
+ * is cleared
+ * *****************************************************************************************************
+ * When the windowed watchdog service is enabled (see USE_TASK_MANAGER_WATCHDOG in 
+ * task_manager_config.h), the watchdog timer is only cleared when all tasks registered here, 
+ * which are expected in the recent operation mode, have been executed successfully within the 
+ * recent watchdog window. Each check-in is registered by one line CHECKIN(task_id, op_modes):
+ * 
+ *   - task_id:  ID of the task checking in (see task_id_no_e)
+ *   - op_modes: OR-combination of all operation modes in which this task is executed
+ * 
+ * Up to 16 check-ins can be registered. The check-in index of each task is generated as 
+ * WDT_CHECKIN_<task_id>.
+ * *****************************************************************************************************/
+
+#if (FUNCTION_LED_HARDWARE == 1)
+#define WDT_CHECKIN_REGISTRY(CHECKIN) \
+    CHECKIN(TASK_IDLE, (OP_MODE_DEVICE_STARTUP | OP_MODE_SYSTEM_STARTUP | OP_MODE_IDLE | \
+                        OP_MODE_NORMAL | OP_MODE_FAULT | OP_MODE_STANDBY)) /* Idle task checks in when the function LED runs in hardware */
+#else
+#define WDT_CHECKIN_REGISTRY(CHECKIN) \
+    CHECKIN(TASK_DGBLED, (OP_MODE_DEVICE_STARTUP | OP_MODE_SYSTEM_STARTUP | OP_MODE_IDLE | \
+                          OP_MODE_NORMAL | OP_MODE_FAULT | OP_MODE_STANDBY)) /* DebugLED task runs in all queues but boot */
+#endif
+
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+#define WDT_CHECKIN_REGISTRY_ENUM(id, op_modes)     WDT_CHECKIN_##id,
+#define WDT_CHECKIN_REGISTRY_COUNT(id, op_modes)    +1
+
+typedef enum {
+    
+    WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_ENUM)
+    
+    WDT_CHECKIN_TABLE_SIZE // Number of registered check-ins (has to be the last item of this list)
+            
+} wdt_checkin_id_no_e;
+
+#if ((0 WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_COUNT)) > 16)
+    #error === watchdog check-in registry holds more than 16 entries ===
+#endif
+
+extern const wdt_checkin_descriptor_t wdt_checkin_table[WDT_CHECKIN_TABLE_SIZE];
+extern const uint16_t wdt_checkin_task_mask[TASK_TABLE_SIZE];
+
+#endif
 
 /*!Task Queues
  *  *****************************************************************************************************
@@ -124,32 +262,309 @@ typedef enum {
  * These queues are used to establish any order of the registered tasks to be executed.
  * As the task manager is running on a fixed tick rate, more critical tasks might be called
  * multiple times while less critical ones might only be called once.
+ * 
+ * Each entry is declared by ENTRY(task_id, period, phase). Period and phase are only
+ * evaluated when multi-rate task queues are enabled (see USE_TASK_MANAGER_MULTI_RATE_QUEUES).
+ * All queues below are declared as step sequences ENTRY(task_id, n, i) with n being the number
+ * of declared entries and i being the step index of the entry. Each queue thus executes the 
+ * same task sequence in single-rate and in multi-rate mode.
+ * 
+ * The queue lists are expanded at compile time into constant queue arrays located in program 
+ * memory (see tasks.c) and into the related queue size constants TASK_QUEUE_xxx_SIZE.
+ * Please refer to tasks.c for a description of each task queue.
+ * 
+ * Entries declared by CONTROL_CORE_ENTRY(ENTRY, task_id, period, phase) are only added to the 
+ * queues of the core executing the control loops. They are removed from the master core 
+ * queues when dual-core partitioning is enabled. Entries declared by MSI_ENTRY(ENTRY, ...) are 
+ * only added when the master/slave core data exchange is active (see msi_exchange_config.h).
+ * Entries declared by TELEMETRY_ENTRY(ENTRY, ...) are only added when the telemetry data stream 
+ * is enabled (see USE_TELEMETRY). The telemetry stream is always sent by the master core.
+ * Entries declared by PARAMETER_ENTRY(ENTRY, ...) are only added when the runtime parameter
+ * access protocol is enabled in addition (see USE_PARAMETER_ACCESS). Entries declared by 
+ * CAN_ENTRY(ENTRY, ...) are only added when the CAN FD interface is enabled (see USE_CAN).
+ * Entries declared by BENCH_ENTRY(ENTRY, ...) are only added when the on-target micro-benchmark
+ * is enabled (see USE_TASK_MANAGER_BENCHMARK). Entries declared by CALIBRATION_ENTRY(ENTRY, ...)
+ * are only added to the queues of the control core when the sense offset calibration is enabled 
+ * (see USE_SENSE_CALIBRATION). Entries declared by FRA_ENTRY(ENTRY, ...) are only added when the
+ * online loop gain measurement is enabled (see USE_FREQUENCY_RESPONSE_ANALYZER). Entries declared
+ * by FEEDFORWARD_ENTRY(ENTRY, ...) are only added to the queues of the control core when the 
+ * feed-forward stage of the output voltage control loop is enabled (see feedforward.h). Entries
+ * declared by DEBUG_LED_ENTRY(ENTRY, ...) are removed when the function LED pattern is generated
+ * by the SCCP module (see USE_FUNCTION_LED_HARDWARE). Entries declared by EFFICIENCY_ENTRY(ENTRY, ...)
+ * are only added to the queues of the control core when the light-load efficiency manager is 
+ * enabled (see USE_EFFICIENCY_MANAGER). Entries declared by SCOPE_ENTRY(ENTRY, ...) are only added
+ * when the triggered waveform capture is enabled (see USE_SCOPE).
  * *****************************************************************************************************/
 
-extern volatile uint16_t task_queue_boot[];
-extern volatile uint16_t task_queue_boot_size;
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+  #define CONTROL_CORE_ENTRY(ENTRY, id, period, phase)  /* executed by the slave core */
+#else
+  #define CONTROL_CORE_ENTRY(ENTRY, id, period, phase)  ENTRY(id, period, phase)
+#endif
+
+#if (MSI_CORE_ROLE != MSI_ROLE_NONE)
+  #define MSI_ENTRY(ENTRY, id, period, phase)           ENTRY(id, period, phase)
+#else
+  #define MSI_ENTRY(ENTRY, id, period, phase)           /* no master/slave core data exchange */
+#endif
+
+#if ((USE_TELEMETRY == 1) && (MSI_CORE_ROLE != MSI_ROLE_SLAVE))
+  #define TELEMETRY_ENTRY(ENTRY, id, period, phase)     ENTRY(id, period, phase)
+#else
+  #define TELEMETRY_ENTRY(ENTRY, id, period, phase)     /* no telemetry data stream */
+#endif
+
+#if (USE_PARAMETER_ACCESS == 1)
+  #define PARAMETER_ENTRY(ENTRY, id, period, phase)     TELEMETRY_ENTRY(ENTRY, id, period, phase)
+#else
+  #define PARAMETER_ENTRY(ENTRY, id, period, phase)     /* no runtime parameter access */
+#endif
+
+#if ((USE_CAN == 1) && (MSI_CORE_ROLE != MSI_ROLE_SLAVE))
+  #define CAN_ENTRY(ENTRY, id, period, phase)           ENTRY(id, period, phase)
+#else
+  #define CAN_ENTRY(ENTRY, id, period, phase)           /* no CAN FD interface */
+#endif
+
+#if (USE_SENSE_CALIBRATION == 1)
+  #define CALIBRATION_ENTRY(ENTRY, id, period, phase)   CONTROL_CORE_ENTRY(ENTRY, id, period, phase)
+#else
+  #define CALIBRATION_ENTRY(ENTRY, id, period, phase)   /* no sense offset calibration */
+#endif
+
+#if (USE_FREQUENCY_RESPONSE_ANALYZER == 1)
+  #define FRA_ENTRY(ENTRY, id, period, phase)           PARAMETER_ENTRY(ENTRY, id, period, phase)
+#else
+  #define FRA_ENTRY(ENTRY, id, period, phase)           /* no loop gain measurement */
+#endif
+
+#if (USE_SCOPE == 1)
+  #define SCOPE_ENTRY(ENTRY, id, period, phase)         PARAMETER_ENTRY(ENTRY, id, period, phase)
+#else
+  #define SCOPE_ENTRY(ENTRY, id, period, phase)         /* no waveform capture */
+#endif
+
+#if (FEEDFORWARD_ENABLED)
+  #define FEEDFORWARD_ENTRY(ENTRY, id, period, phase)   CONTROL_CORE_ENTRY(ENTRY, id, period, phase)
+#else
+  #define FEEDFORWARD_ENTRY(ENTRY, id, period, phase)   /* no feed-forward stage */
+#endif
+
+#if (FUNCTION_LED_HARDWARE == 1)
+  #define DEBUG_LED_ENTRY(ENTRY, id, period, phase)     /* function LED runs in hardware */
+#else
+  #define DEBUG_LED_ENTRY(ENTRY, id, period, phase)     ENTRY(id, period, phase)
+#endif
+
+#if (EFFICIENCY_ENABLED)
+  #define EFFICIENCY_ENTRY(ENTRY, id, period, phase)    CONTROL_CORE_ENTRY(ENTRY, id, period, phase)
+#else
+  #define EFFICIENCY_ENTRY(ENTRY, id, period, phase)    /* fixed switching frequency */
+#endif
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+  #define BENCH_ENTRY(ENTRY, id, period, phase)         ENTRY(id, period, phase)
+#else
+  #define BENCH_ENTRY(ENTRY, id, period, phase)         /* no micro-benchmark */
+#endif
 
-extern volatile uint16_t task_queue_device_startup[];
-extern volatile uint16_t task_queue_device_startup_size;
+#define TASK_QUEUE_BOOT(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_INIT_MSI_EXCHANGE, 6, 0)                  /* Step #0 (starts the slave core booting in parallel) */ \
+    ENTRY(TASK_INIT_GPIO, 6, 1)                                     /* Step #1 */ \
+    ENTRY(TASK_INIT_APPLICATION_SETTINGS, 6, 2)                     /* Step #2 */ \
+    ENTRY(TASK_INIT_FAULT_OBJECTS, 6, 3)                            /* Step #3 */ \
+    ENTRY(TASK_LAUNCH_OSCILLATOR, 6, 4)                             /* Step #4 (holds the queue until both PLLs have locked) */ \
+    ENTRY(TASK_IDLE, 6, 5)                                          /* empty task used as task list execution time buffer */
 
-extern volatile uint16_t task_queue_system_startup[];
-extern volatile uint16_t task_queue_system_startup_size;
+#define TASK_QUEUE_DEVICE_STARTUP(ENTRY) \
+    ENTRY(TASK_INIT_DSP, 18, 0)                                     /* Step #0 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_PWM, 18, 1)                 /* Step #1 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_ADC, 18, 2)                 /* Step #2 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_LAUNCH_ADC, 18, 3)               /* Step #3 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_LAUNCH_PWM, 18, 4)               /* Step #4 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_ACQUISITION, 18, 5)         /* Step #5 */ \
+    CALIBRATION_ENTRY(ENTRY, TASK_INIT_CALIBRATION, 18, 6)          /* Step #6 */ \
+    CALIBRATION_ENTRY(ENTRY, TASK_CALIBRATION, 18, 7)               /* Step #7 (holds the queue until the sense offsets have been measured) */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_MULTIPHASE, 18, 8)          /* Step #8 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_CVMC_VOUT, 18, 9)           /* Step #9 */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_INIT_UART, 18, 10)                  /* Step #10 */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_INIT_TELEMETRY, 18, 11)             /* Step #11 */ \
+    PARAMETER_ENTRY(ENTRY, TASK_INIT_PARAMETERS, 18, 12)            /* Step #12 */ \
+    FRA_ENTRY(ENTRY, TASK_INIT_FREQUENCY_RESPONSE, 18, 13)          /* Step #13 */ \
+    CAN_ENTRY(ENTRY, TASK_INIT_CAN, 18, 14)                         /* Step #14 */ \
+    CAN_ENTRY(ENTRY, TASK_INIT_CAN_INTERFACE, 18, 15)               /* Step #15 */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 18, 16)                     /* Step #16 */ \
+    ENTRY(TASK_IDLE, 18, 17)                                        /* empty task used as task list execution time buffer */
 
-extern volatile uint16_t task_queue_idle[];
-extern volatile uint16_t task_queue_idle_size;
+#define TASK_QUEUE_SYSTEM_STARTUP(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_MSI_EXCHANGE, 10, 0)                      /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_ACQUISITION, 10, 1)              /* Step #0 */ \
+    FEEDFORWARD_ENTRY(ENTRY, TASK_FEEDFORWARD, 10, 2)               /* feed-forward gain of the recent input voltage */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_SOFT_START, 10, 3)               /* Step #1 */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 10, 4)                      /* Step #2 */ \
+    CAN_ENTRY(ENTRY, TASK_CAN_INTERFACE, 10, 5)                     /* CAN status/commands */ \
+    PARAMETER_ENTRY(ENTRY, TASK_PARAMETERS, 10, 6)                  /* parameter request (response sent by the next telemetry frame) */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_TELEMETRY, 10, 7)                   /* telemetry frame */ \
+    SCOPE_ENTRY(ENTRY, TASK_SCOPE, 10, 8)                           /* waveform capture (frames sent by the next telemetry frame) */ \
+    ENTRY(TASK_IDLE, 10, 9)                                         /* empty task used as task list execution time buffer */
+
+#define TASK_QUEUE_IDLE(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_MSI_EXCHANGE, 9, 0)                       /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_ACQUISITION, 9, 1)               /* Step #0 */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 9, 2)                       /* Step #1 */ \
+    BENCH_ENTRY(ENTRY, TASK_BENCHMARK, 9, 3)                        /* micro-benchmark samples (BENCH_BATCH per call) */ \
+    CAN_ENTRY(ENTRY, TASK_CAN_INTERFACE, 9, 4)                      /* CAN status/commands */ \
+    PARAMETER_ENTRY(ENTRY, TASK_PARAMETERS, 9, 5)                   /* parameter request (response sent by the next telemetry frame) */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_TELEMETRY, 9, 6)                    /* telemetry frame */ \
+    SCOPE_ENTRY(ENTRY, TASK_SCOPE, 9, 7)                            /* waveform capture (frames sent by the next telemetry frame) */ \
+    ENTRY(TASK_IDLE, 9, 8)                                          /* empty task used as task list execution time buffer */
+
+#define TASK_QUEUE_NORMAL(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_MSI_EXCHANGE, 14, 0)                      /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_ACQUISITION, 14, 1)              /* Step #0 */ \
+    FEEDFORWARD_ENTRY(ENTRY, TASK_FEEDFORWARD, 14, 2)               /* feed-forward gain of the recent input voltage */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 14, 3)                      /* Step #1 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_CVMC_VOUT_GAIN_SCHEDULER, 14, 4) /* Step #2 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_MULTIPHASE_PHASE_MANAGER, 14, 5) /* Step #3 */ \
+    EFFICIENCY_ENTRY(ENTRY, TASK_EFFICIENCY_MANAGER, 14, 6)         /* switching frequency/burst mode by load */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_SOFT_START, 14, 7)               /* Step #4 (soft-stop) */ \
+    CAN_ENTRY(ENTRY, TASK_CAN_INTERFACE, 14, 8)                     /* CAN status/commands */ \
+    PARAMETER_ENTRY(ENTRY, TASK_PARAMETERS, 14, 9)                  /* parameter request (response sent by the next telemetry frame) */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_TELEMETRY, 14, 10)                  /* telemetry frame */ \
+    FRA_ENTRY(ENTRY, TASK_FREQUENCY_RESPONSE, 14, 11)               /* loop gain measurement (result sent by the next telemetry frame) */ \
+    SCOPE_ENTRY(ENTRY, TASK_SCOPE, 14, 12)                          /* waveform capture (frames sent by the next telemetry frame) */ \
+    ENTRY(TASK_IDLE, 14, 13)                                        /* empty task used as task list execution time buffer */
+
+#define TASK_QUEUE_FAULT(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_MSI_EXCHANGE, 8, 0)                       /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_ACQUISITION, 8, 1)               /* Step #0 */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 8, 2)                       /* Step #1 */ \
+    CAN_ENTRY(ENTRY, TASK_CAN_INTERFACE, 8, 3)                      /* CAN status/commands */ \
+    PARAMETER_ENTRY(ENTRY, TASK_PARAMETERS, 8, 4)                   /* parameter request (response sent by the next telemetry frame) */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_TELEMETRY, 8, 5)                    /* telemetry frame */ \
+    SCOPE_ENTRY(ENTRY, TASK_SCOPE, 8, 6)                            /* waveform capture (frames sent by the next telemetry frame) */ \
+    ENTRY(TASK_IDLE, 8, 7)                                          /* empty task used as task list execution time buffer */
+
+#define TASK_QUEUE_STANDBY(ENTRY) \
+    MSI_ENTRY(ENTRY, TASK_MSI_EXCHANGE, 8, 0)                       /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_ACQUISITION, 8, 1)               /* Step #0 */ \
+    DEBUG_LED_ENTRY(ENTRY, TASK_DGBLED, 8, 2)                       /* Step #1 */ \
+    CAN_ENTRY(ENTRY, TASK_CAN_INTERFACE, 8, 3)                      /* CAN status/commands */ \
+    PARAMETER_ENTRY(ENTRY, TASK_PARAMETERS, 8, 4)                   /* parameter request (response sent by the next telemetry frame) */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_TELEMETRY, 8, 5)                    /* telemetry frame */ \
+    SCOPE_ENTRY(ENTRY, TASK_SCOPE, 8, 6)                            /* waveform capture (frames sent by the next telemetry frame) */ \
+    ENTRY(TASK_IDLE, 8, 7)                                          /* empty task used as task list execution time buffer */
+
+// The warm boot task queue is executed once in one sequence before the task manager is started 
+// and replaces the boot and device startup task queues after a warm boot (see USE_TASK_MANAGER_WARM_BOOT).
+// Period and phase are not evaluated.
+#define TASK_QUEUE_WARM_BOOT(ENTRY) \
+    ENTRY(TASK_INIT_GPIO, 1, 0)                                     /* Step #0 */ \
+    ENTRY(TASK_INIT_APPLICATION_SETTINGS, 1, 0)                     /* Step #1 */ \
+    ENTRY(TASK_INIT_DSP, 1, 0)                                      /* Step #2 */ \
+    MSI_ENTRY(ENTRY, TASK_INIT_MSI_EXCHANGE, 1, 0)                  /* master/slave data exchange */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_PWM, 1, 0)                  /* Step #3 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_ADC, 1, 0)                  /* Step #4 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_LAUNCH_ADC, 1, 0)                /* Step #5 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_LAUNCH_PWM, 1, 0)                /* Step #6 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_ACQUISITION, 1, 0)          /* Step #7 */ \
+    CALIBRATION_ENTRY(ENTRY, TASK_INIT_CALIBRATION, 1, 0)           /* Step #8 (stored sense offsets, no averaging) */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_MULTIPHASE, 1, 0)           /* Step #9 */ \
+    CONTROL_CORE_ENTRY(ENTRY, TASK_INIT_CVMC_VOUT, 1, 0)            /* Step #10 */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_INIT_UART, 1, 0)                    /* Step #11 */ \
+    TELEMETRY_ENTRY(ENTRY, TASK_INIT_TELEMETRY, 1, 0)               /* Step #12 */ \
+    PARAMETER_ENTRY(ENTRY, TASK_INIT_PARAMETERS, 1, 0)              /* Step #13 */ \
+    FRA_ENTRY(ENTRY, TASK_INIT_FREQUENCY_RESPONSE, 1, 0)            /* Step #14 */ \
+    CAN_ENTRY(ENTRY, TASK_INIT_CAN, 1, 0)                           /* Step #15 */ \
+    CAN_ENTRY(ENTRY, TASK_INIT_CAN_INTERFACE, 1, 0)                 /* Step #16 */
+
+// Queue list expansion helpers
+#define TASK_QUEUE_ITEM(id, period, phase)      TASK_QUEUE_ENTRY(id, period, phase),
+#define TASK_QUEUE_COUNT(id, period, phase)     +1
+#define TASK_QUEUE_ID(id, period, phase)        (id),
+
+#define TASK_QUEUE_BOOT_SIZE            (0 TASK_QUEUE_BOOT(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_DEVICE_STARTUP_SIZE  (0 TASK_QUEUE_DEVICE_STARTUP(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_SYSTEM_STARTUP_SIZE  (0 TASK_QUEUE_SYSTEM_STARTUP(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_IDLE_SIZE            (0 TASK_QUEUE_IDLE(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_NORMAL_SIZE          (0 TASK_QUEUE_NORMAL(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_FAULT_SIZE           (0 TASK_QUEUE_FAULT(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_STANDBY_SIZE         (0 TASK_QUEUE_STANDBY(TASK_QUEUE_COUNT))
+#define TASK_QUEUE_WARM_BOOT_SIZE       (0 TASK_QUEUE_WARM_BOOT(TASK_QUEUE_COUNT))
+
+/*!Task Queue Step Sequence Check
+ * Task queues declare their entries as ENTRY(task_id, n, i) with n being the number of entries
+ * of the queue and i being the step index (0 ... n-1, ascending in order of appearance). The checks below assert equal periods and distinct phases within
+ * the range of the period. Entries removed by the configuration leave gaps in the step index, 
+ * which is allowed.
+ */
+#define TASK_QUEUE_CHECK_PERIOD(id, period, phase)      +(period)
+#define TASK_QUEUE_CHECK_PERIOD_SQR(id, period, phase)  +((period) * (period))
+#define TASK_QUEUE_CHECK_PHASE_SUM(id, period, phase)   +(1UL << (phase))
+#define TASK_QUEUE_CHECK_PHASE_OR(id, period, phase)    |(1UL << (phase))
+#define TASK_QUEUE_CHECK_RANGE(id, period, phase)       +((phase) >= (period))
+
+#define TASK_QUEUE_IS_SEQUENCE(QUEUE) ( \
+    ((0 QUEUE(TASK_QUEUE_CHECK_RANGE)) == 0) && \
+    ((0 QUEUE(TASK_QUEUE_CHECK_PHASE_SUM)) == (0 QUEUE(TASK_QUEUE_CHECK_PHASE_OR))) && \
+    (((0 QUEUE(TASK_QUEUE_COUNT)) * (0 QUEUE(TASK_QUEUE_CHECK_PERIOD_SQR))) == \
+        ((0 QUEUE(TASK_QUEUE_CHECK_PERIOD)) * (0 QUEUE(TASK_QUEUE_CHECK_PERIOD)))) )
+
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_BOOT)
+  #error boot task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_DEVICE_STARTUP)
+  #error device startup task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_SYSTEM_STARTUP)
+  #error system startup task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_IDLE)
+  #error idle task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_NORMAL)
+  #error normal task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_FAULT)
+  #error fault task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+#if !TASK_QUEUE_IS_SEQUENCE(TASK_QUEUE_STANDBY)
+  #error standby task queue entries must be declared as ENTRY(task_id, n, i) with distinct step indices i < n
+#endif
+
+extern const task_queue_item_t task_queue_boot[TASK_QUEUE_BOOT_SIZE];
+extern const task_queue_item_t task_queue_device_startup[TASK_QUEUE_DEVICE_STARTUP_SIZE];
+extern const task_queue_item_t task_queue_system_startup[TASK_QUEUE_SYSTEM_STARTUP_SIZE];
+extern volatile uint16_t task_queue_init_system_startup(void);
+
+extern const task_queue_item_t task_queue_idle[TASK_QUEUE_IDLE_SIZE];
 extern volatile uint16_t task_queue_init_idle(void);
 
-extern volatile uint16_t task_queue_normal[];
-extern volatile uint16_t task_queue_normal_size;
+extern const task_queue_item_t task_queue_normal[TASK_QUEUE_NORMAL_SIZE];
 extern volatile uint16_t task_queue_init_normal(void);
 
-extern volatile uint16_t task_queue_fault[];
-extern volatile uint16_t task_queue_fault_size;
+extern const task_queue_item_t task_queue_fault[TASK_QUEUE_FAULT_SIZE];
 extern volatile uint16_t task_queue_init_fault(void);
 
-extern volatile uint16_t task_queue_standby[];
-extern volatile uint16_t task_queue_standby_size;
+extern const task_queue_item_t task_queue_standby[TASK_QUEUE_STANDBY_SIZE];
 extern volatile uint16_t task_queue_init_standby(void);
+extern volatile uint16_t task_queue_exit_standby(void);
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+extern const uint16_t task_queue_warm_boot[TASK_QUEUE_WARM_BOOT_SIZE];
+#endif
+
+/*!Operation Mode Table
+ *  *****************************************************************************************************
+ * Operation Mode Descriptor Table
+ * *****************************************************************************************************
+ * This table assigns task queue, switch-over function, follow-up mode and flags to each operation
+ * mode. It is indexed by the bit position of the operation mode (see OP_MODE_INDEX_e). User 
+ * defined operation modes OP_MODE_USER_1 ... OP_MODE_USER_9 are registered by adding a descriptor
+ * at their respective index. Please refer to tasks.c.
+ * *****************************************************************************************************/
+
+extern const task_op_mode_descriptor_t task_op_mode_table[OP_MODE_TABLE_SIZE];
 
 #endif	/* _APPLICATION_LAYER_TASK_FLOW_QUEUES_H_ */
 
@@ -0,0 +1,176 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!telemetry.h
+ *****************************************************************************
+ * File:   telemetry.h
+ *
+ * Summary:
+ * Globally defines the contents of the telemetry data stream
+ *
+ * Description:	
+ * The telemetry task takes snapshots of the variables registered here and 
+ * streams them as framed binary packets over the UART (see task_Telemetry.c).
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_Telemetry.c
+ * task_Telemetry.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_TELEMETRY_REGISTRY_H_
+#define	_APPLICATION_LAYER_TELEMETRY_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+#include "apl/apl.h"
+#include "_root/generic/task_manager.h"
+
+/*!Telemetry Registry
+ * *****************************************************************************************************
+ * Telemetry Registry lists all variables which are captured in each telemetry data frame
+ * *****************************************************************************************************
+ * Each variable is registered by one line FIELD(field_id, variable). The variable can be of any 
+ * type including data structures. Its size is determined by sizeof(variable).
+ * 
+ * The telemetry registry is expanded at compile time into
+ * 
+ *   - the field ID enumeration telemetry_field_id_e
+ *   - the constant field address and field size tables located in program memory
+ *   - the constant schema table, which is transmitted in schema frames
+ * 
+ * The payload of a data frame holds all registered variables in order of registration in the
+ * little endian byte order of the device. All variables are copied into a snapshot buffer 
+ * before the frame is encoded. Variables updated by interrupt service routines are only 
+ * consistent on word level, unless their writer brackets its updates by the seqlock 
+ * TELEMETRY_SEQLOCK (see task_exchange.h). The snapshot is then repeated until no update 
+ * occurred while it was taken.
+ * When the registry is changed, TELEMETRY_SCHEMA_VERSION needs to be incremented.
+ * *****************************************************************************************************/
+
+#define TELEMETRY_SCHEMA_VERSION        2       // Version of the telemetry registry
+
+#if (CVMC_VOUT_CYCLE_METER == 1)
+  #define CYCLE_METER_FIELD(FIELD, id, variable)    FIELD(id, variable)
+  #define TELEMETRY_SEQLOCK             cvmc_vout_cycles_lock // Seqlock of the control loop interrupt service routine
+#else
+  #define CYCLE_METER_FIELD(FIELD, id, variable)    /* no cycle meter */
+#endif
+
+#define TELEMETRY_REGISTRY(FIELD) \
+    FIELD(TLM_OP_MODE, task_mgr.op_mode.mode)                       /* Recent operating mode of the task manager */ \
+    FIELD(TLM_PROC_CODE, task_mgr.proc_code)                        /* Most recent task manager process code */ \
+    FIELD(TLM_TASK_MGR_STATUS, task_mgr.status)                     /* Task manager status flags */ \
+    FIELD(TLM_CPU_LOAD, task_mgr.cpu_load.load)                     /* CPU load of the recent time slot in [10x %] */ \
+    FIELD(TLM_CPU_PEAK, task_mgr.cpu_load.peak)                     /* CPU utilization peak in [10x %] */ \
+    FIELD(TLM_CTRL_STATUS, application.ctrl_status)                 /* Control status flags */ \
+    FIELD(TLM_SOFT_START_STEP, converter[CONVERTER_PRIMARY].soft_start.step) /* Most recent soft-start step of the primary converter */ \
+    FIELD(TLM_APPLICATION_DATA, application.data)                   /* Input/output voltages, currents and temperature */ \
+    CYCLE_METER_FIELD(FIELD, TLM_CTRL_CYCLES, cvmc_vout_cycles)     /* Recent/maximum CPU cycles and iterations of the control loop */
+
+/*!telemetry_field_id_e
+ * *****************************************************************************************************
+ * Readable field IDs generated from the telemetry registry
+ * *****************************************************************************************************/
+#define TELEMETRY_REGISTRY_ENUM(id, variable)       id,
+#define TELEMETRY_REGISTRY_SIZE(id, variable)       + sizeof(variable)
+
+typedef enum {
+    
+    TELEMETRY_REGISTRY(TELEMETRY_REGISTRY_ENUM)
+
+    TELEMETRY_FIELD_COUNT // Number of registered fields (has to be the last item of this list)
+            
+} telemetry_field_id_e;
+
+#define TELEMETRY_PAYLOAD_SIZE          (0 TELEMETRY_REGISTRY(TELEMETRY_REGISTRY_SIZE)) // Data frame payload size in bytes
+
+
+/*!Telemetry Frame Settings
+ * *****************************************************************************************************
+ * Settings of the telemetry data stream
+ * *****************************************************************************************************
+ * Description:
+ * Each frame is built from a raw packet
+ * 
+ *   [type (8-bit)][sequence (8-bit)][tick (16-bit)][payload][CRC-16 (16-bit)]
+ * 
+ * encoded by Consistent Overhead Byte Stuffing (COBS) and terminated by a 0x00 delimiter. By 
+ * design the encoded frame contains no other zero bytes, allowing a host to resynchronize on 
+ * the next delimiter after any lost byte. The CRC-16/CCITT-FALSE (polynomial 0x1021, init 0xFFFF) 
+ * covers all raw bytes before the CRC, transmitted high byte first. The sequence counter is
+ * incremented with every frame, the tick is the task manager scheduler tick counter captured 
+ * when the snapshot was taken. 
+ * 
+ * Payload of frame type TELEMETRY_FRAME_DATA: all registered variables in registry order
+ * Payload of frame type TELEMETRY_FRAME_SCHEMA: [version (16-bit)][field count (16-bit)] 
+ *   followed by the size in bytes of each field (16-bit each) in registry order
+ * Payload of frame type TELEMETRY_FRAME_RESPONSE: up to TELEMETRY_RESPONSE_SIZE bytes handed 
+ *   over by telemetry_Respond() (e.g. parameter access responses, see task_Parameters.h, loop 
+ *   gain measurement results, see task_FrequencyResponse.h, or waveform captures, see task_Scope.h).
+ *   Response frames are sent instead of the next data frame.
+ * 
+ * Frame rate:
+ * One frame is sent per call of the telemetry task. In single-rate mode the task is called once 
+ * per pass of the active task queue, i.e. every TASK_QUEUE_xxx_SIZE scheduler ticks (e.g. every 
+ * 8 to 14 ticks or 0.8 to 1.4 ms with all optional tasks enabled). In multi-rate mode it is called
+ * every <period> ticks of its queue entry. It has to be ensured that one frame of up to 
+ * TELEMETRY_FRAME_SIZE bytes (10 bits per byte) can be transmitted at UART_BAUDRATE within the 
+ * shortest call interval of all queues. Otherwise frames will be skipped (see telemetry.overruns).
+ * 
+ * Settings:
+ * - TELEMETRY_SCHEMA_INTERVAL: Number of data frames after which a schema frame is inserted
+ * 
+ * See also:
+ * UART_BAUDRATE
+ * *****************************************************************************************************/
+
+#define TELEMETRY_SCHEMA_INTERVAL       250     // Number of data frames between two schema frames
+
+#define TELEMETRY_FRAME_DATA            0x01    // Frame type ID of data frames
+#define TELEMETRY_FRAME_SCHEMA          0x02    // Frame type ID of schema frames
+#define TELEMETRY_FRAME_RESPONSE        0x03    // Frame type ID of response frames
+
+#define TELEMETRY_RESPONSE_SIZE         24      // Maximum response frame payload size in bytes
+
+#define TELEMETRY_HEADER_SIZE           4       // Frame type, sequence and tick in bytes
+#define TELEMETRY_CRC_SIZE              2       // CRC-16 in bytes
+#define TELEMETRY_SCHEMA_SIZE           (4 + (2 * TELEMETRY_FIELD_COUNT)) // Schema frame payload size in bytes
+
+#define TELEMETRY_MAX(a, b)             (((a) > (b)) ? (a) : (b))
+#define TELEMETRY_RAW_SIZE              (TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE + \
+                                        TELEMETRY_MAX(TELEMETRY_MAX(TELEMETRY_SCHEMA_SIZE, TELEMETRY_PAYLOAD_SIZE), \
+                                        TELEMETRY_RESPONSE_SIZE)) // Largest raw packet size in bytes
+
+// COBS adds one code byte per started block of 254 bytes plus the 0x00 frame delimiter
+#define TELEMETRY_FRAME_SIZE            (TELEMETRY_RAW_SIZE + (TELEMETRY_RAW_SIZE / 254) + 2)
+
+#endif	/* _APPLICATION_LAYER_TELEMETRY_REGISTRY_H_ */
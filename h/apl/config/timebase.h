@@ -0,0 +1,98 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!timebase.h
+ *****************************************************************************
+ * File:   timebase.h
+ *
+ * Summary:
+ * Globally defines the values scaled with the scheduler tick period
+ *
+ * Description:	
+ * When the scheduler tick period is changed at runtime (see 
+ * USE_TASK_MANAGER_TIME_BASE), all values registered here are scaled with 
+ * the new tick period.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_timebase.c
+ * task_timebase.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef _APPLICATION_LAYER_TIME_BASE_REGISTRY_H_
+#define	_APPLICATION_LAYER_TIME_BASE_REGISTRY_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+#include "_root/generic/task_manager.h"
+#include "_root/generic/fdrv_FaultHandler.h"
+#include "_root/generic/task_jitter.h"
+
+// Fault objects of the task manager flow control (see task_FaultHandler.c)
+extern FAULT_OBJECT_t fltobj_TaskTimeQuotaViolation;
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+extern FAULT_OBJECT_t fltobj_SlotStartLatency;
+#endif
+
+/*!Time Base Registry
+ * *****************************************************************************************************
+ * Time Base Registry lists all 16-bit values given in system timer ticks
+ * *****************************************************************************************************
+ * Each value is registered by one line COUNTS(variable). When the scheduler tick period changes, 
+ * registered values are scaled by the ratio of the new and the previous timer period. This 
+ * applies to fault object levels derived from the task time quota (timer period) and to results
+ * of timer captures compared against these levels.
+ * 
+ * Intervals given in scheduler ticks are not registered here. They are converted by 
+ * TASK_MGR_TICKS() where they are used.
+ * 
+ * Values declared by JITTER_COUNTS(COUNTS, ...) are only registered when the slot-start latency 
+ * monitor is enabled (see USE_TASK_MANAGER_JITTER_MONITOR).
+ * *****************************************************************************************************/
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+  #define JITTER_COUNTS(COUNTS, variable)   COUNTS(variable)
+#else
+  #define JITTER_COUNTS(COUNTS, variable)   /* no jitter monitor */
+#endif
+
+#define TIME_BASE_REGISTRY(COUNTS) \
+    /* Task time quota violation */ \
+    COUNTS(fltobj_TaskTimeQuotaViolation.criteria.trip_level) \
+    COUNTS(fltobj_TaskTimeQuotaViolation.criteria.reset_level) \
+    \
+    /* Slot-start latency */ \
+    JITTER_COUNTS(COUNTS, slot_profile.limit) \
+    JITTER_COUNTS(COUNTS, fltobj_SlotStartLatency.criteria.trip_level) \
+    JITTER_COUNTS(COUNTS, fltobj_SlotStartLatency.criteria.reset_level)
+
+#endif	/* _APPLICATION_LAYER_TIME_BASE_REGISTRY_H_ */
@@ -0,0 +1,321 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!cvmc_vout.h
+ * ***************************************************************************
+ * File:   cvmc_vout.h
+ * Author: M91406
+ * 
+ * Summary:
+ * Output voltage mode control loop (3P3Z compensator)
+ * 
+ * Description:
+ * This header declares the output voltage control loop designed in the 
+ * z-Domain Control Loop Designer project h/hal/config/cvmc_vout.dcld. The 
+ * filter settings of the [ControlSetup] section of the project file are 
+ * listed below. The compensator coefficients are derived from these settings 
+ * at build time by bilinear transformation and scaled into Q15 format using 
+ * dual bit-shift scaling (separate scalers for A- and B-coefficients). 
+ * 
+ * Please note:
+ * When the control loop design is changed in the Control Loop Designer, the 
+ * filter settings below need to be updated accordingly.
+ * 
+ * The compensator is executed by the ADC interrupt service routine of the 
+ * feedback input declared below (see isr_adc.c). The function 
+ * cvmc_vout_Update() uses the DSP engine accumulators and requires the DSP 
+ * core configuration set by initialize_dsp() (fractional mode, accumulator
+ * saturation and unbiased rounding).
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APL_RESOURCES_CVMC_VOUT_H
+#define	APL_RESOURCES_CVMC_VOUT_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/resources/npnz16b.h"
+#include "hal/initialization/init_adc.h"
+#include "hal/initialization/init_pwm.h"
+#include "apl/resources/multiphase.h"
+#include "apl/resources/feedforward.h"
+#include "apl/resources/efficiency.h"
+#include "mcal/config/devcfg_irq.h"
+#include "_root/generic/task_exchange.h"
+
+
+/* ***********************************************************************************************
+ * FILTER SETTINGS (cvmc_vout.dcld, [ControlSetup])
+ * ***********************************************************************************************/
+
+#define CVMC_VOUT_SAMPLING_FREQUENCY    (float)(300.0e+3)   // SamplingFrequency
+#define CVMC_VOUT_FP0                   (float)(1.0e+3)     // FrequencyP0 (integrator crossover frequency)
+#define CVMC_VOUT_FP1                   (float)(110.0e+3)   // FrequencyP1
+#define CVMC_VOUT_FZ1                   (float)(1.2e+3)     // FrequencyZ1
+#define CVMC_VOUT_FP2                   (float)(150.0e+3)   // FrequencyP2
+#define CVMC_VOUT_FZ2                   (float)(2.5e+3)     // FrequencyZ2
+#define CVMC_VOUT_INPUT_RESOLUTION      12                  // InputDataResolution
+#define CVMC_VOUT_BIDIRECTIONAL         1                   // BiDirectionalFeedback
+
+/* ***********************************************************************************************
+ * HARDWARE BINDING
+ * ***********************************************************************************************/
+
+#define CVMC_VOUT_ADC_BUFFER            ADC_FAST_VOUT_ADCBUF // ADC buffer register of the output voltage feedback
+#define CVMC_VOUT_ADC_IF                ADC_FAST_VOUT_IF     // ADC interrupt flag bit of the output voltage feedback
+#define CVMC_VOUT_ADC_IE                ADC_FAST_VOUT_IE     // ADC interrupt enable bit of the output voltage feedback
+#define CVMC_VOUT_ADC_IP                ADC_FAST_VOUT_IP     // ADC interrupt priority of the output voltage feedback
+#define _CVMC_VOUT_ADC_Interrupt        _ADC_FAST_VOUT_Interrupt // ADC interrupt vector executing the control loop
+#define CVMC_VOUT_ISR_PRIORITY          IRQ_PRIORITY_CONTROL // Control loop interrupt priority (see devcfg_irq.h)
+#if (CONVERTER_PHASES > 1)
+#define CVMC_VOUT_PWM_DUTY_CYCLE        multiphase.duty_cycle // Common duty cycle distributed to all phases (see multiphase.h)
+#else
+#define CVMC_VOUT_PWM_DUTY_CYCLE        PWM_DUTY_CYCLE // PWM duty cycle register controlled by the loop (latched at next SOC)
+#endif
+
+#define CVMC_VOUT_INPUT_OFFSET          0           // Feedback offset in ADC ticks (bi-directional feedback)
+#define CVMC_VOUT_CYCLE_METER           1           // Enable/Disable CPU cycle measurement of each loop iteration
+
+/*!CVMC_VOUT_IMPLEMENTATION
+ * ***********************************************************************************************
+ * Description:
+ * Selects the implementation executing the control loop in the ADC interrupt service routine.
+ * 
+ * Settings:
+ * - NPNZ16B_IMPLEMENTATION_ASM: the interrupt service routine runs on the alternate working 
+ *   register set assigned to CVMC_VOUT_CONTEXT_IPL and calls the assembly kernel 
+ *   npnz16b_Update3p3z(). The compiler does not save/restore working registers on interrupt 
+ *   entry. Worst-case kernel execution time: 73 instruction cycles (see npnz16b_3p3z.s)
+ * - NPNZ16B_IMPLEMENTATION_C: the interrupt service routine calls cvmc_vout_Update() with 
+ *   standard context save/restore
+ * 
+ * CVMC_VOUT_CONTEXT_IPL needs to match the interrupt priority level assigned to the alternate 
+ * working register set by the CTXTx configuration bits (see config_bits_P33CK.c/config_bits_P33CH.c)
+ * 
+ * See also:
+ * CVMC_VOUT_ISR_PRIORITY, CVMC_VOUT_CYCLE_METER
+ * ***********************************************************************************************/
+#define CVMC_VOUT_IMPLEMENTATION        NPNZ16B_IMPLEMENTATION_ASM  // Control loop implementation
+#define CVMC_VOUT_CONTEXT_IPL           IRQ_CONTEXT_1_IPL // IPL of alternate working register set #1 (CTXT1 = IPL5)
+
+#if (CVMC_VOUT_IMPLEMENTATION == NPNZ16B_IMPLEMENTATION_ASM)
+  #if (CVMC_VOUT_ISR_PRIORITY != CVMC_VOUT_CONTEXT_IPL)
+    #error "CVMC_VOUT: assembly implementation requires the ISR priority of the alternate working register set"
+  #endif
+  #define CVMC_VOUT_UPDATE(controller)  npnz16b_Update3p3z(controller)
+#else
+  #define CVMC_VOUT_UPDATE(controller)  cvmc_vout_Update(controller)
+#endif
+
+/*!CVMC_VOUT_GAIN_SCHEDULING
+ * ***********************************************************************************************
+ * Description:
+ * Enables coefficient banks selected by the operating point. The gain of a voltage mode 
+ * controlled buck converter plant is proportional to the input voltage. Each bank therefore 
+ * uses the pole/zero placement of cvmc_vout.dcld with the compensator gain scaled by the ratio 
+ * of the design input voltage and the bank input voltage (center of the bank range). 
+ * 
+ * The scheduling variable is read by the task cvmc_vout_GainScheduler() and is compared against 
+ * the upper thresholds of the banks with hysteresis. Bank switch-overs are performed by an
+ * atomic swap of the coefficient pointers between two ADC samples (see npnz16b_SelectBank()).
+ * 
+ * Settings:
+ * - CVMC_VOUT_GAIN_SCHEDULING: 0 = fixed coefficients, 1 = coefficient banks enabled
+ * - CVMC_VOUT_GS_BUMPLESS: 0 = histories are kept, 1 = bumpless transfer at switch-over
+ * - CVMC_VOUT_GS_SOURCE: scheduling variable (e.g. application.data.v_in or application.data.i_out)
+ * - CVMC_VOUT_GS_SCALER: ticks per unit of the scheduling variable
+ * - CVMC_VOUT_GS_THRESHOLD_x: upper operating point limit of bank x
+ * 
+ * A common B-term post-shift is determined for all banks from the largest gain factor, so that
+ * all banks can be executed by the C and assembly implementation without further scaling.
+ * 
+ * Please note:
+ * Input voltage gain scheduling is replaced by the input voltage feed-forward stage when 
+ * FEEDFORWARD_VIN is enabled (see feedforward.h). Both cannot be enabled at the same time.
+ * 
+ * See also:
+ * npnz16b_SelectBank(), npnz16b_GainScheduler()
+ * ***********************************************************************************************/
+#define CVMC_VOUT_GAIN_SCHEDULING       0           // Enable/Disable gain scheduled coefficient banks
+#define CVMC_VOUT_GS_BUMPLESS           1           // Enable/Disable bumpless transfer at bank switch-over
+
+#define CVMC_VOUT_GS_SOURCE             application.data.v_in // Scheduling variable (input voltage)
+#define CVMC_VOUT_GS_SCALER             ((float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Scheduling variable ticks per volt
+#define CVMC_VOUT_GS_DESIGN_POINT       VIN_NOMINAL // Input voltage of the cvmc_vout.dcld design in [V]
+
+#define CVMC_VOUT_GS_BANKS              3           // Number of coefficient banks
+#define CVMC_VOUT_GS_DEFAULT_BANK       2           // Bank covering the design point (loaded at startup)
+#define CVMC_VOUT_GS_THRESHOLD_0        15.000      // Upper input voltage of bank #0 in [V]
+#define CVMC_VOUT_GS_THRESHOLD_1        18.500      // Upper input voltage of bank #1 in [V]
+#define CVMC_VOUT_GS_THRESHOLD_2        VIN_MAXIMUM // Upper input voltage of bank #2 in [V]
+#define CVMC_VOUT_GS_HYSTERESIS         0.250       // Switch-over hysteresis in [V]
+
+#define CVMC_VOUT_GS_GAIN_0             (CVMC_VOUT_GS_DESIGN_POINT / ((VIN_MINIMUM + CVMC_VOUT_GS_THRESHOLD_0) / 2.0))
+#define CVMC_VOUT_GS_GAIN_1             (CVMC_VOUT_GS_DESIGN_POINT / ((CVMC_VOUT_GS_THRESHOLD_0 + CVMC_VOUT_GS_THRESHOLD_1) / 2.0))
+#define CVMC_VOUT_GS_GAIN_2             (CVMC_VOUT_GS_DESIGN_POINT / ((CVMC_VOUT_GS_THRESHOLD_1 + CVMC_VOUT_GS_THRESHOLD_2) / 2.0))
+
+#define CVMC_VOUT_GS_TICKS(x)           (uint16_t)((float)(x) * CVMC_VOUT_GS_SCALER) // Conversion into scheduling variable ticks
+
+#if ((CVMC_VOUT_GAIN_SCHEDULING == 1) && (FEEDFORWARD_VIN == 1))
+  #error "CVMC_VOUT: input voltage gain scheduling and input voltage feed-forward cannot be enabled at the same time"
+#endif
+
+#if (CVMC_VOUT_GAIN_SCHEDULING == 1)
+  #define CVMC_VOUT_GS_GAIN_MAX         CVMC_VOUT_GS_GAIN_0 // Largest gain factor (lowest input voltage)
+#else
+  #define CVMC_VOUT_GS_GAIN_MAX         1.0
+#endif
+
+/* ***********************************************************************************************
+ * COEFFICIENTS
+ * ***********************************************************************************************
+ * H(s) = (wp0 / s) * (1 + s/wz1) * (1 + s/wz2) / ((1 + s/wp1) * (1 + s/wp2))
+ * 
+ * Each first order term is transformed into (a + b z^-1) / (1 + z^-1). The (1 + z^-1) terms of 
+ * poles and zeros cancel out, resulting in
+ * 
+ * H(z) = (wp0 / k) * (1 + z^-1) * Z1(z) * Z2(z) / ((1 - z^-1) * P1(z) * P2(z))
+ * 
+ * y[n] = B0 e[n] + B1 e[n-1] + B2 e[n-2] + B3 e[n-3] + A1 y[n-1] + A2 y[n-2] + A3 y[n-3]
+ * ***********************************************************************************************/
+
+#define CVMC_VOUT_PI                    3.14159265358979
+#define CVMC_VOUT_K                     (2.0 * CVMC_VOUT_SAMPLING_FREQUENCY)
+#define CVMC_VOUT_WP0                   (2.0 * CVMC_VOUT_PI * CVMC_VOUT_FP0)
+#define CVMC_VOUT_WP1                   (2.0 * CVMC_VOUT_PI * CVMC_VOUT_FP1)
+#define CVMC_VOUT_WZ1                   (2.0 * CVMC_VOUT_PI * CVMC_VOUT_FZ1)
+#define CVMC_VOUT_WP2                   (2.0 * CVMC_VOUT_PI * CVMC_VOUT_FP2)
+#define CVMC_VOUT_WZ2                   (2.0 * CVMC_VOUT_PI * CVMC_VOUT_FZ2)
+
+// First order terms at k = 2 x sampling frequency
+#define CVMC_VOUT_Z1A_K(k)              NPNZ16B_TUSTIN_A((k), CVMC_VOUT_WZ1)
+#define CVMC_VOUT_Z1B_K(k)              NPNZ16B_TUSTIN_B((k), CVMC_VOUT_WZ1)
+#define CVMC_VOUT_Z2A_K(k)              NPNZ16B_TUSTIN_A((k), CVMC_VOUT_WZ2)
+#define CVMC_VOUT_Z2B_K(k)              NPNZ16B_TUSTIN_B((k), CVMC_VOUT_WZ2)
+#define CVMC_VOUT_P1A_K(k)              NPNZ16B_TUSTIN_A((k), CVMC_VOUT_WP1)
+#define CVMC_VOUT_P1B_K(k)              NPNZ16B_TUSTIN_B((k), CVMC_VOUT_WP1)
+#define CVMC_VOUT_P2A_K(k)              NPNZ16B_TUSTIN_A((k), CVMC_VOUT_WP2)
+#define CVMC_VOUT_P2B_K(k)              NPNZ16B_TUSTIN_B((k), CVMC_VOUT_WP2)
+
+// Numerator (1 + z^-1) * Z1(z) * Z2(z) * wp0 / k
+#define CVMC_VOUT_N0_K(k)               (CVMC_VOUT_Z1A_K(k) * CVMC_VOUT_Z2A_K(k))
+#define CVMC_VOUT_N1_K(k)               ((CVMC_VOUT_Z1A_K(k) * CVMC_VOUT_Z2B_K(k)) + (CVMC_VOUT_Z1B_K(k) * CVMC_VOUT_Z2A_K(k)))
+#define CVMC_VOUT_N2_K(k)               (CVMC_VOUT_Z1B_K(k) * CVMC_VOUT_Z2B_K(k))
+#define CVMC_VOUT_GAIN_K(k)             (CVMC_VOUT_WP0 / (k))
+
+// Denominator (1 - z^-1) * P1(z) * P2(z)
+#define CVMC_VOUT_D0_K(k)               (CVMC_VOUT_P1A_K(k) * CVMC_VOUT_P2A_K(k))
+#define CVMC_VOUT_D1_K(k)               ((CVMC_VOUT_P1A_K(k) * CVMC_VOUT_P2B_K(k)) + (CVMC_VOUT_P1B_K(k) * CVMC_VOUT_P2A_K(k)))
+#define CVMC_VOUT_D2_K(k)               (CVMC_VOUT_P1B_K(k) * CVMC_VOUT_P2B_K(k))
+
+#define CVMC_VOUT_B0_K(k)               (CVMC_VOUT_GAIN_K(k) * CVMC_VOUT_N0_K(k) / CVMC_VOUT_D0_K(k))
+#define CVMC_VOUT_B1_K(k)               (CVMC_VOUT_GAIN_K(k) * (CVMC_VOUT_N0_K(k) + CVMC_VOUT_N1_K(k)) / CVMC_VOUT_D0_K(k))
+#define CVMC_VOUT_B2_K(k)               (CVMC_VOUT_GAIN_K(k) * (CVMC_VOUT_N1_K(k) + CVMC_VOUT_N2_K(k)) / CVMC_VOUT_D0_K(k))
+#define CVMC_VOUT_B3_K(k)               (CVMC_VOUT_GAIN_K(k) * CVMC_VOUT_N2_K(k) / CVMC_VOUT_D0_K(k))
+
+#define CVMC_VOUT_A1_K(k)               (-(CVMC_VOUT_D1_K(k) - CVMC_VOUT_D0_K(k)) / CVMC_VOUT_D0_K(k))
+#define CVMC_VOUT_A2_K(k)               (-(CVMC_VOUT_D2_K(k) - CVMC_VOUT_D1_K(k)) / CVMC_VOUT_D0_K(k))
+#define CVMC_VOUT_A3_K(k)               (CVMC_VOUT_D2_K(k) / CVMC_VOUT_D0_K(k))
+
+#define CVMC_VOUT_B_MAX_K(k)            NPNZ16B_MAX(NPNZ16B_MAX(NPNZ16B_ABS(CVMC_VOUT_B0_K(k)), NPNZ16B_ABS(CVMC_VOUT_B1_K(k))), \
+                                                    NPNZ16B_MAX(NPNZ16B_ABS(CVMC_VOUT_B2_K(k)), NPNZ16B_ABS(CVMC_VOUT_B3_K(k))))
+#define CVMC_VOUT_A_MAX_K(k)            NPNZ16B_MAX(NPNZ16B_MAX(NPNZ16B_ABS(CVMC_VOUT_A1_K(k)), NPNZ16B_ABS(CVMC_VOUT_A2_K(k))), \
+                                                    NPNZ16B_ABS(CVMC_VOUT_A3_K(k)))
+
+// Coefficients at the nominal sampling frequency
+#define CVMC_VOUT_B0                    CVMC_VOUT_B0_K(CVMC_VOUT_K)
+#define CVMC_VOUT_B1                    CVMC_VOUT_B1_K(CVMC_VOUT_K)
+#define CVMC_VOUT_B2                    CVMC_VOUT_B2_K(CVMC_VOUT_K)
+#define CVMC_VOUT_B3                    CVMC_VOUT_B3_K(CVMC_VOUT_K)
+#define CVMC_VOUT_A1                    CVMC_VOUT_A1_K(CVMC_VOUT_K)
+#define CVMC_VOUT_A2                    CVMC_VOUT_A2_K(CVMC_VOUT_K)
+#define CVMC_VOUT_A3                    CVMC_VOUT_A3_K(CVMC_VOUT_K)
+
+/*!CVMC_VOUT_REDUCED_FREQUENCY
+ * ***********************************************************************************************
+ * Description:
+ * Coefficients of the reduced switching frequency operating point of the efficiency manager 
+ * (see efficiency.h). The control loop is sampled once per switching period, hence the filter 
+ * settings above are transformed at the reduced sampling frequency. The B-coefficients are 
+ * scaled by the ratio of reduced and nominal switching period, as the same duty ratio requires 
+ * this factor more PWM ticks. A common post-shift is determined for both operating points.
+ * ***********************************************************************************************/
+#define CVMC_VOUT_K_REDUCED             (2.0 * (float)EFFICIENCY_REDUCED_FREQUENCY)
+#define CVMC_VOUT_GAIN_REDUCED          EFFICIENCY_PERIOD_RATIO
+
+#if (EFFICIENCY_ENABLED)
+  #define CVMC_VOUT_B_MAX_REDUCED       (CVMC_VOUT_GAIN_REDUCED * CVMC_VOUT_B_MAX_K(CVMC_VOUT_K_REDUCED))
+  #define CVMC_VOUT_A_MAX_REDUCED       CVMC_VOUT_A_MAX_K(CVMC_VOUT_K_REDUCED)
+#else
+  #define CVMC_VOUT_B_MAX_REDUCED       0.0
+  #define CVMC_VOUT_A_MAX_REDUCED       0.0
+#endif
+
+#if ((CVMC_VOUT_GAIN_SCHEDULING == 1) && (EFFICIENCY_ENABLED))
+  #error "CVMC_VOUT: gain scheduling and the efficiency manager cannot be enabled at the same time"
+#endif
+
+// Dual bit-shift scaling
+#define CVMC_VOUT_B_MAX                 NPNZ16B_MAX((CVMC_VOUT_GS_GAIN_MAX * CVMC_VOUT_B_MAX_K(CVMC_VOUT_K)), CVMC_VOUT_B_MAX_REDUCED)
+#define CVMC_VOUT_A_MAX                 NPNZ16B_MAX(CVMC_VOUT_A_MAX_K(CVMC_VOUT_K), CVMC_VOUT_A_MAX_REDUCED)
+#define CVMC_VOUT_POSTSHIFT_B           NPNZ16B_SHIFT(CVMC_VOUT_B_MAX)
+#define CVMC_VOUT_POSTSHIFT_A           NPNZ16B_SHIFT(CVMC_VOUT_A_MAX)
+#define CVMC_VOUT_PRESHIFT              (15 - CVMC_VOUT_INPUT_RESOLUTION)
+
+#define CVMC_VOUT_A_COEFFICIENTS        3   // Number of A-coefficients
+#define CVMC_VOUT_B_COEFFICIENTS        4   // Number of B-coefficients
+
+/* ***********************************************************************************************
+ * PUBLIC DATA OBJECTS AND FUNCTIONS
+ * ***********************************************************************************************/
+
+extern volatile cNPNZ16b_t cvmc_vout; // Output voltage control loop object
+extern volatile int16_t __attribute__((space(xmemory))) cvmc_vout_ACoefficients[CVMC_VOUT_A_COEFFICIENTS]; // Q15 A-coefficients
+extern volatile int16_t __attribute__((space(xmemory))) cvmc_vout_BCoefficients[CVMC_VOUT_B_COEFFICIENTS]; // Q15 B-coefficients
+extern volatile int16_t __attribute__((space(ymemory))) cvmc_vout_ErrorHistory[CVMC_VOUT_B_COEFFICIENTS]; // Recent errors e[n] ... e[n-3]
+extern volatile uint16_t cvmc_vout_reference; // Output voltage reference in ADC ticks
+
+#if (EFFICIENCY_ENABLED)
+extern volatile NPNZ16B_COEFF_BANK_t cvmc_vout_efficiency_banks[EFFICIENCY_POINTS]; // Coefficient banks of the efficiency manager operating points
+#endif
+
+#if (CVMC_VOUT_GAIN_SCHEDULING == 1)
+extern volatile NPNZ16B_GAIN_SCHEDULER_t cvmc_vout_scheduler; // Gain scheduler of the control loop
+#endif
+
+#if (CVMC_VOUT_CYCLE_METER == 1)
+extern volatile NPNZ16B_CYCLE_METER_t cvmc_vout_cycles; // CPU cycles of the control loop interrupt service routine
+extern volatile SEQLOCK_t cvmc_vout_cycles_lock; // Seqlock of the cycle meter (written by the control loop interrupt service routine only)
+#endif
+
+extern volatile uint16_t cvmc_vout_Init(void);
+extern volatile uint16_t cvmc_vout_Reset(volatile cNPNZ16b_t* controller);
+extern void cvmc_vout_Update(volatile cNPNZ16b_t* controller);
+extern volatile uint16_t cvmc_vout_GainScheduler(void);
+
+
+#endif	/* APL_RESOURCES_CVMC_VOUT_H */
@@ -0,0 +1,232 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!efficiency.h
+ * ***************************************************************************
+ * File:   efficiency.h
+ * Author: M91406
+ * 
+ * Summary:
+ * Light-load efficiency manager (adaptive switching frequency and burst mode)
+ * 
+ * Description:
+ * Switching losses are proportional to the switching frequency and dominate 
+ * the losses of the power stage at light load. The efficiency manager task 
+ * efficiency_Manager() compares the output current (slow channel, 
+ * application.data.i_out) against the thresholds below and moves the 
+ * converter between three operating modes:
+ * 
+ * - EFFICIENCY_MODE_FIXED: nominal switching frequency SWITCHING_FREQUENCY
+ * - EFFICIENCY_MODE_REDUCED: reduced switching frequency EFFICIENCY_REDUCED_FREQUENCY
+ * - EFFICIENCY_MODE_BURST: reduced switching frequency with pulse skipping
+ * 
+ * Each switching frequency is described by an operating point holding the 
+ * switching period, the duty cycle limits, the ADC trigger positions and the
+ * coefficient bank of the output voltage control loop. The control loop is 
+ * sampled once per switching period. The reduced frequency bank is therefore 
+ * derived from the filter settings of cvmc_vout.h at the reduced sampling 
+ * frequency and its compensator gain is scaled by the ratio of both periods 
+ * to maintain the loop gain in PWM ticks (see cvmc_vout.c).
+ * 
+ * Operating points are switched by efficiency_SetMode() in one atomic step
+ * between two ADC samples (DISI): coefficient pointers, control history, 
+ * output clamping limits, ADC triggers and the timing of all PWM generators 
+ * are updated together and the new PWM timing is latched at the next start
+ * of cycle (see multiphase_SetPeriod()).
+ * 
+ * In burst mode, EFFICIENCY_BURST_SKIP() is evaluated by the control loop 
+ * interrupt service routine before each loop iteration. The outputs of all 
+ * active phases are overridden as soon as the output voltage exceeds the 
+ * reference by EFFICIENCY_BURST_STOP and are released again when it drops 
+ * below the reference by EFFICIENCY_BURST_RESTART. The control loop is not 
+ * executed while pulses are skipped and resumes from its recent output with 
+ * the next burst. Outputs are only released while the converter outputs are
+ * enabled (multiphase.outputs_enable), hence a shutdown is never overridden.
+ * 
+ * The converter returns to EFFICIENCY_MODE_FIXED immediately when the load
+ * or the operating state requires it: during soft-start and soft-stop, while
+ * a loop gain measurement is active, when the efficiency manager is disabled
+ * and each time the converter is restarted (see init_SoftStart()).
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APL_RESOURCES_EFFICIENCY_H
+#define	APL_RESOURCES_EFFICIENCY_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hal/config/syscfg_scaling.h"
+#include "hal/config/syscfg_limits.h"
+#include "hal/initialization/init_pwm.h"
+#include "hal/initialization/init_adc.h"
+#include "apl/resources/npnz16b.h"
+#include "apl/resources/multiphase.h"
+
+
+/*!USE_EFFICIENCY_MANAGER
+ * ***********************************************************************************************
+ * Description:
+ * Enables the light-load efficiency manager. Reduced frequency and burst mode are entered when
+ * the output current has been below their entry level for EFFICIENCY_DELAY consecutive calls of
+ * the efficiency manager. They are left immediately when the output current exceeds their exit 
+ * level to support load steps. The exit levels need to be higher than the entry levels to 
+ * provide hysteresis. 
+ * 
+ * Reduced frequency and burst mode are only entered while a single phase is active. The exit 
+ * level of the reduced frequency mode therefore needs to be lower than the per-phase current 
+ * adding one phase (see MULTIPHASE_SHEDDING). The exit level of the burst mode needs to be lower 
+ * than the entry level of the reduced frequency mode. EFFICIENCY_REDUCED_FREQUENCY has to be lower 
+ * than SWITCHING_FREQUENCY and its period has to fit into the 16-bit PWM period register. 
+ * 
+ * Settings:
+ * - USE_EFFICIENCY_MANAGER: 0 = fixed switching frequency, 1 = efficiency manager enabled
+ * - EFFICIENCY_REDUCED_FREQUENCY: switching frequency of the reduced frequency mode in [Hz]
+ * - EFFICIENCY_REDUCED_ENTER/EXIT: output current entering/leaving the reduced frequency mode in [A]
+ * - EFFICIENCY_BURST: 0 = no pulse skipping, 1 = burst mode enabled
+ * - EFFICIENCY_BURST_ENTER/EXIT: output current entering/leaving the burst mode in [A]
+ * - EFFICIENCY_DELAY: number of efficiency manager calls below an entry level before it is entered
+ * ***********************************************************************************************/
+#define USE_EFFICIENCY_MANAGER          1           // Enable/Disable light-load efficiency manager
+
+#define EFFICIENCY_REDUCED_FREQUENCY    150e+3      // Reduced switching frequency in [Hz]
+#define EFFICIENCY_REDUCED_ENTER        0.800       // Output current entering the reduced frequency mode in [A]
+#define EFFICIENCY_REDUCED_EXIT         1.200       // Output current leaving the reduced frequency mode in [A]
+
+#define EFFICIENCY_BURST                1           // Enable/Disable burst mode (pulse skipping)
+#define EFFICIENCY_BURST_ENTER          0.150       // Output current entering the burst mode in [A]
+#define EFFICIENCY_BURST_EXIT           0.300       // Output current leaving the burst mode in [A]
+
+#define EFFICIENCY_DELAY                50          // Efficiency manager calls below an entry level before entering
+
+/*!EFFICIENCY_BURST_BAND
+ * ***********************************************************************************************
+ * Description:
+ * Output voltage band of the burst mode around the recent control loop reference. Pulses are 
+ * skipped as soon as the output voltage exceeds the reference by EFFICIENCY_BURST_STOP and 
+ * resume when the output voltage drops below the reference by EFFICIENCY_BURST_RESTART. The 
+ * output voltage ripple in burst mode is approximately the sum of both levels.
+ * 
+ * Settings:
+ * - EFFICIENCY_BURST_STOP: output voltage above the reference stopping the pulses in [V]
+ * - EFFICIENCY_BURST_RESTART: output voltage below the reference restarting the pulses in [V]
+ * ***********************************************************************************************/
+#define EFFICIENCY_BURST_STOP           0.050       // Output voltage above the reference stopping the pulses in [V]
+#define EFFICIENCY_BURST_RESTART        0.020       // Output voltage below the reference restarting the pulses in [V]
+
+/*!EFFICIENCY_TRIGGER
+ * ***********************************************************************************************
+ * Description:
+ * ADC trigger positions of the reduced frequency operating point. Trigger positions are counted
+ * from the start of cycle, hence the nominal positions ADC_FAST_TRIGGER and ADC_SLOW_TRIGGER 
+ * sample at the same instant of the on-time. They can be moved when the sampling instant needs 
+ * to follow the longer on-time (e.g. to the center of the on-time).
+ * 
+ * Please note:
+ * The slow channels are sampled every ADC_SLOW_TRIGGER_POSTSCALER + 1 switching periods. Their
+ * update rate is reduced by the ratio of both switching frequencies at reduced frequency.
+ * ***********************************************************************************************/
+#define EFFICIENCY_REDUCED_FAST_TRIGGER ADC_FAST_TRIGGER // Fast channel trigger position at reduced frequency in PWM ticks
+#define EFFICIENCY_REDUCED_SLOW_TRIGGER ADC_SLOW_TRIGGER // Slow channel trigger position at reduced frequency in PWM ticks
+
+// Derived settings
+#define EFFICIENCY_ENABLED              (USE_EFFICIENCY_MANAGER == 1)
+#define EFFICIENCY_BURST_ENABLED        ((USE_EFFICIENCY_MANAGER == 1) && (EFFICIENCY_BURST == 1))
+
+#define EFFICIENCY_REDUCED_PERIOD       ((uint16_t)(((float)((1.0/(float)(EFFICIENCY_REDUCED_FREQUENCY))/T_ACLK)-1))) // Reduced switching period in PWM ticks
+#define EFFICIENCY_REDUCED_DUTY_MIN     (uint16_t)(((float)DUTY_RATIO_MIN * (float)EFFICIENCY_REDUCED_PERIOD) + (PWM_DEAD_TIME_LE + PWM_DEAD_TIME_FE)) // Minimum duty cycle at reduced frequency
+#define EFFICIENCY_REDUCED_DUTY_MAX     (uint16_t)((float)DUTY_RATIO_MAX * (float)EFFICIENCY_REDUCED_PERIOD) // Maximum duty cycle at reduced frequency
+#define EFFICIENCY_PERIOD_RATIO         ((float)EFFICIENCY_REDUCED_PERIOD / (float)PWM_PERIOD) // Ratio of reduced and nominal switching period
+
+#define EFFICIENCY_CURRENT_TICKS(x)     (uint16_t)((float)(x) * (float)IOUT_SCALER_RATIO_I2V * (float)ADC_SLOW_SCALER) // Conversion into slow channel ticks
+#define EFFICIENCY_VOLTAGE_TICKS(x)     (int16_t)((float)(x) * (float)VOUT_DIVIDER_RATIO * (float)ADC_SCALER) // Conversion into fast channel ticks
+#define EFFICIENCY_REDUCED_ENTER_TICKS  EFFICIENCY_CURRENT_TICKS(EFFICIENCY_REDUCED_ENTER)
+#define EFFICIENCY_REDUCED_EXIT_TICKS   EFFICIENCY_CURRENT_TICKS(EFFICIENCY_REDUCED_EXIT)
+#define EFFICIENCY_BURST_ENTER_TICKS    EFFICIENCY_CURRENT_TICKS(EFFICIENCY_BURST_ENTER)
+#define EFFICIENCY_BURST_EXIT_TICKS     EFFICIENCY_CURRENT_TICKS(EFFICIENCY_BURST_EXIT)
+#define EFFICIENCY_BURST_STOP_TICKS     EFFICIENCY_VOLTAGE_TICKS(EFFICIENCY_BURST_STOP)
+#define EFFICIENCY_BURST_RESTART_TICKS  EFFICIENCY_VOLTAGE_TICKS(EFFICIENCY_BURST_RESTART)
+
+/* ***********************************************************************************************
+ * DATA TYPES
+ * ***********************************************************************************************/
+
+typedef enum {
+    EFFICIENCY_MODE_FIXED   = 0,    // Nominal switching frequency
+    EFFICIENCY_MODE_REDUCED = 1,    // Reduced switching frequency
+    EFFICIENCY_MODE_BURST   = 2     // Reduced switching frequency with pulse skipping
+} EFFICIENCY_MODE_e; // Operating modes of the efficiency manager
+
+typedef enum {
+    EFFICIENCY_POINT_NOMINAL = 0,   // Operating point at SWITCHING_FREQUENCY
+    EFFICIENCY_POINT_REDUCED = 1,   // Operating point at EFFICIENCY_REDUCED_FREQUENCY
+    EFFICIENCY_POINTS               // Number of operating points
+} EFFICIENCY_POINT_e; // Operating points of the efficiency manager
+
+typedef struct {
+    volatile uint16_t period;               // Switching period in PWM ticks
+    volatile int16_t minimum;               // Duty cycle minimum in PWM ticks
+    volatile int16_t maximum;               // Duty cycle maximum in PWM ticks
+    volatile uint16_t fast_trigger;         // Fast channel trigger position in PWM ticks
+    volatile uint16_t slow_trigger;         // Slow channel trigger position in PWM ticks
+    volatile NPNZ16B_COEFF_BANK_t* bank;    // Coefficient bank of the output voltage control loop
+} EFFICIENCY_POINT_t; // Operating point of one switching frequency
+
+typedef struct {
+    volatile EFFICIENCY_MODE_e mode;        // Recent operating mode
+    volatile uint16_t counter;              // Number of efficiency manager calls below the next entry level
+    volatile uint16_t transitions;          // Number of operating point transitions
+    volatile uint16_t bursts;               // Number of bursts (pulse skipping periods ended)
+    volatile bool enable;                   // Enable/Disable reduced frequency and burst mode
+    volatile bool burst_active;             // Burst mode is evaluated by the control loop interrupt
+    volatile bool skipping;                 // Pulses are recently skipped
+} EFFICIENCY_t; // Light-load efficiency manager
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile EFFICIENCY_t efficiency;
+
+extern volatile uint16_t efficiency_Reset(void);
+extern volatile uint16_t efficiency_SetMode(volatile EFFICIENCY_MODE_e mode);
+extern volatile uint16_t efficiency_Manager(void);
+extern volatile uint16_t efficiency_BurstSample(void);
+
+/*!EFFICIENCY_BURST_SKIP
+ * ***********************************************************************************************
+ * Description:
+ * Evaluated by the control loop interrupt service routine before each loop iteration. Returns 
+ * true while pulses are skipped. When burst mode is not active, the cost is one flag test per 
+ * control loop sample. When EFFICIENCY_BURST_ENABLED is false, the macro expands to a constant
+ * and the control loop interrupt is unchanged.
+ * ***********************************************************************************************/
+#if (EFFICIENCY_BURST_ENABLED)
+  #define EFFICIENCY_BURST_SKIP()       ((efficiency.burst_active) && (efficiency_BurstSample()))
+#else
+  #define EFFICIENCY_BURST_SKIP()       (false)
+#endif
+
+#endif	/* APL_RESOURCES_EFFICIENCY_H */
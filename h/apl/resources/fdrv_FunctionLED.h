@@ -36,6 +36,7 @@
  * 
  * History:
  * 05/03/2018	File created
+ * 10/14/2026   added hardware LED driver based on a SCCP output compare module
  * ***************************************************************************/
 
 // This is a guard condition so that contents of this file are not included
@@ -46,6 +47,74 @@
 #include <xc.h> // include processor files - each processor file is guarded.  
 #include <stdint.h>
 
+#include "mcal/mcal.h"
+#include "mcal/config/devcfg_irq.h"
+
+
+/*!USE_FUNCTION_LED_HARDWARE
+ * ***********************************************************************************************
+ * Description:
+ * When enabled, the function LED pattern is generated by a SCCP module in 32-bit output compare
+ * mode instead of the DebugLED task. The LED pin is mapped to the SCCP output through the 
+ * peripheral pin select (PPS) and the module is only reconfigured when the operating mode has
+ * changed (see exec_DebugLEDHardware). The DebugLED task is removed from all task queues and 
+ * the LED keeps blinking in its recent pattern even when the main loop stalls.
+ * 
+ * Blink intervals are given in scheduler ticks (see FUNCTION_LED_CONFIG_t) and are converted
+ * into SCCP timer counts by the recent scheduler timer period. The SCCP timer is clocked by the
+ * instruction clock, which keeps the pattern in sync with operating modes running at a reduced
+ * CPU clock or tick period (e.g. standby). 
+ * 
+ * The following patterns are generated:
+ * 
+ *   - LEDCTRL_MODE_TOGGLE and symmetric LEDCTRL_MODE_DUTY_RATIO: the output toggles on every 
+ *     timer period without any CPU interaction
+ *   - asymmetric LEDCTRL_MODE_DUTY_RATIO: the compare interrupt alternates the timer period 
+ *     between on-time and off-time once per edge (see FUNCTION_LED_ISR_PRIORITY)
+ *   - LEDCTRL_MODE_ALWAYS_ON/ALWAYS_OFF: the output is statically driven to the on/off level
+ * 
+ * Please note:
+ * The hardware driver requires a remappable LED pin (see DBGLED_RP in the pin map of the 
+ * hardware platform). On platforms without remappable LED pin the DebugLED task is used.
+ * The LED pin status flags of taskDebugLED_config do not detect pin failures as the pin latch
+ * is not used while the SCCP module is driving the pin.
+ * 
+ * Settings:
+ * FUNCTION_LED_PPSOUT_OCM: PPS output function code of the SCCP output compare pin
+ * FUNCTION_LED_ISR_PRIORITY: priority of the compare interrupt of asymmetric duty ratios
+ * 
+ * See also:
+ * fled_HardwareInit, fled_HardwareApply, exec_DebugLEDHardware
+ * ***********************************************************************************************/
+
+#define USE_FUNCTION_LED_HARDWARE       1       // Enable/Disable the SCCP based function LED driver
+
+#if (USE_FUNCTION_LED_HARDWARE == 1) && defined (DBGLED_RP)
+  #define FUNCTION_LED_HARDWARE         1       // LED pattern is generated by the SCCP module
+#else
+  #define FUNCTION_LED_HARDWARE         0       // LED pattern is generated by the DebugLED task
+#endif
+
+#if (FUNCTION_LED_HARDWARE == 1)
+
+  #define FUNCTION_LED_RP               DBGLED_RP   // Remappable pin of the function LED
+  #define FUNCTION_LED_RD               DBGLED_RD   // Port register bit of the function LED pin
+  #define FUNCTION_LED_PPSOUT_OCM       17          // PPS output function code of SCCP2 output OCM2 (see device data sheet)
+  #define FUNCTION_LED_ISR_PRIORITY     IRQ_PRIORITY_SCHEDULER // Lowest priority level (see devcfg_irq.h)
+
+  // SCCP output compare modes (CCPxCON1L.MOD)
+  #define FUNCTION_LED_CCP_MOD_HIGH     0b0001      // Output is driven high on compare match
+  #define FUNCTION_LED_CCP_MOD_LOW      0b0010      // Output is driven low on compare match
+  #define FUNCTION_LED_CCP_MOD_TOGGLE   0b0011      // Output toggles on compare match
+  #define FUNCTION_LED_CCP_MOD_STATIC(level)  (((level) == PINSTATE_HIGH) ? \
+                                        FUNCTION_LED_CCP_MOD_HIGH : FUNCTION_LED_CCP_MOD_LOW)
+
+  #if IRQ_IPL_FAST(FUNCTION_LED_ISR_PRIORITY)
+    #error === function LED compare interrupt must not share a fast interrupt priority level ===
+  #endif
+
+#endif
+
 
 /* ***********************************************************************************************
  * DECLARATIONS
@@ -113,11 +182,24 @@ typedef struct
     volatile uint16_t counter;  // internal tick counter
 }FUNCTION_LED_CONFIG_t;
 
+typedef struct
+{
+    volatile uint32_t on_counts;  // SCCP timer counts of the LED on-time
+    volatile uint32_t off_counts;  // SCCP timer counts of the LED off-time
+}FUNCTION_LED_HARDWARE_t;
+
 
 /* ***********************************************************************************************
  * PROTOTYPES
  * ***********************************************************************************************/
-// (none)
+#if (FUNCTION_LED_HARDWARE == 1)
+
+extern volatile FUNCTION_LED_HARDWARE_t fled_hardware;
+
+extern volatile uint16_t fled_HardwareInit(void);
+extern volatile uint16_t fled_HardwareApply(volatile FUNCTION_LED_CONFIG_t* config);
+
+#endif
 
 
 #endif	/* APL_FUNCTION_DRIVER_ON_BOARD_LED_H */
@@ -0,0 +1,182 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!feedforward.h
+ * ***************************************************************************
+ * File:   feedforward.h
+ * Author: M91406
+ * 
+ * Summary:
+ * Input voltage feed-forward and dead-time compensation of the output voltage 
+ * control loop
+ * 
+ * Description:
+ * The gain of a voltage mode controlled buck converter plant is proportional 
+ * to the input voltage. When the feed-forward stage is enabled, the output 
+ * voltage control loop writes a normalized control output, which is scaled 
+ * into the PWM duty cycle by the ratio of the design input voltage and the 
+ * recent input voltage:
+ * 
+ *   duty = (control output x gain(v_in)) >> FEEDFORWARD_GAIN_SHIFT + dead_time(i_out)
+ * 
+ * Input voltage steps therefore change the duty cycle immediately instead of 
+ * being compensated by the control loop, and the loop gain remains constant 
+ * across the input voltage range. 
+ * 
+ * The reciprocal of the input voltage and the dead-time compensation are read 
+ * from lookup tables generated at compile time. The task feedforward_Update() 
+ * interpolates both tables once per scheduler tick. feedforward_Apply() is 
+ * called by the control loop interrupt service routine after each loop 
+ * iteration and executes one multiplication and one addition, without any 
+ * division in the interrupt service routine.
+ * 
+ * The feed-forward stage replaces the input voltage gain scheduling of the
+ * control loop (see CVMC_VOUT_GAIN_SCHEDULING). Both cannot be enabled at
+ * the same time.
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APL_RESOURCES_FEEDFORWARD_H
+#define	APL_RESOURCES_FEEDFORWARD_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hal/config/syscfg_scaling.h"
+#include "hal/config/syscfg_limits.h"
+#include "hal/initialization/init_pwm.h"
+#include "apl/resources/npnz16b.h"
+
+
+/*!FEEDFORWARD_VIN
+ * ***********************************************************************************************
+ * Description:
+ * Input voltage normalization. The lookup table holds FEEDFORWARD_VIN_LUT_SIZE + 1 gain factors
+ * VIN_NOMINAL / v_in in Q14 format at equidistant input voltages between FEEDFORWARD_VIN_LUT_START 
+ * and FEEDFORWARD_VIN_LUT_STOP. Input voltages outside this range use the first or last entry.
+ * 
+ * The table position is calculated by a multiplication of the input voltage above the table 
+ * start with the constant scaler FEEDFORWARD_VIN_LUT_SCALER. The upper 16 bits of the product
+ * hold the table index (bits 15-8) and the interpolation fraction (bits 7-0).
+ * 
+ * Settings:
+ * - FEEDFORWARD_VIN: 0 = control output is written into the duty cycle, 1 = feed-forward enabled
+ * - FEEDFORWARD_VIN_LUT_START: lowest input voltage of the table in [V]
+ * - FEEDFORWARD_VIN_LUT_STOP: highest input voltage of the table in [V]
+ * 
+ * Please note:
+ * The gain factor at FEEDFORWARD_VIN_LUT_START has to be below 2.0 (Q14 format), hence 
+ * FEEDFORWARD_VIN_LUT_START has to be higher than VIN_NOMINAL / 2. Entries exceeding the 
+ * number range are limited to INT16_MAX.
+ * ***********************************************************************************************/
+#define FEEDFORWARD_VIN                 1           // Enable/Disable input voltage feed-forward
+#define FEEDFORWARD_VIN_LUT_START       (0.9 * VIN_MINIMUM) // Lowest table input voltage in [V]
+#define FEEDFORWARD_VIN_LUT_STOP        (1.1 * VIN_MAXIMUM) // Highest table input voltage in [V]
+
+#define FEEDFORWARD_VIN_LUT_SIZE        32          // Number of table intervals (fixed by FEEDFORWARD_LUT_32())
+#define FEEDFORWARD_GAIN_SHIFT          14          // Gain factors are in Q14 format
+#define FEEDFORWARD_GAIN_UNITY          (int16_t)(1 << FEEDFORWARD_GAIN_SHIFT) // Gain factor 1.0
+
+#define FEEDFORWARD_VIN_TICKS(x)        ((float)(x) * (float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Conversion into slow channel ticks
+#define FEEDFORWARD_VIN_LUT_START_TICKS (uint16_t)FEEDFORWARD_VIN_TICKS(FEEDFORWARD_VIN_LUT_START)
+#define FEEDFORWARD_VIN_LUT_RANGE_TICKS (uint16_t)(FEEDFORWARD_VIN_TICKS(FEEDFORWARD_VIN_LUT_STOP) - FEEDFORWARD_VIN_TICKS(FEEDFORWARD_VIN_LUT_START))
+#define FEEDFORWARD_VIN_LUT_SCALER      (uint32_t)(((float)FEEDFORWARD_VIN_LUT_SIZE * 16777216.0) / \
+                                        (FEEDFORWARD_VIN_TICKS(FEEDFORWARD_VIN_LUT_STOP) - FEEDFORWARD_VIN_TICKS(FEEDFORWARD_VIN_LUT_START)))
+
+// Gain factor of table entry n in Q14 format
+#define FEEDFORWARD_VIN_LUT_VOLTAGE(n)  ((float)FEEDFORWARD_VIN_LUT_START + \
+                                        ((float)(n) * ((float)FEEDFORWARD_VIN_LUT_STOP - (float)FEEDFORWARD_VIN_LUT_START) / (float)FEEDFORWARD_VIN_LUT_SIZE))
+#define FEEDFORWARD_VIN_LUT_GAIN(n)     (((((float)VIN_NOMINAL / FEEDFORWARD_VIN_LUT_VOLTAGE(n)) * (float)FEEDFORWARD_GAIN_UNITY) < (float)INT16_MAX) ? \
+                                        (int16_t)(((float)VIN_NOMINAL / FEEDFORWARD_VIN_LUT_VOLTAGE(n)) * (float)FEEDFORWARD_GAIN_UNITY) : INT16_MAX)
+
+/*!FEEDFORWARD_DEAD_TIME
+ * ***********************************************************************************************
+ * Description:
+ * Dead-time compensation. During the dead time at the rising edge of PWMxH, the switch node 
+ * remains low as long as the inductor current at the beginning of the switching period is 
+ * positive, which reduces the effective duty cycle by the dead time PWM_DEAD_TIME_H. At zero 
+ * load the inductor current at this instant is negative (half of the current ripple) and the 
+ * switch node commutates during the dead time without duty cycle loss. 
+ * 
+ * The compensation therefore rises linearly from zero at zero load to PWM_DEAD_TIME_H at the 
+ * load current FEEDFORWARD_DT_CURRENT_FULL (half of the current ripple at the nominal operating 
+ * point times the number of phases) and is constant above. The lookup table holds 
+ * FEEDFORWARD_DT_LUT_SIZE + 1 compensation values in PWM ticks at equidistant output currents 
+ * between zero and IOUT_MAXIMUM. The table position is calculated like the input voltage 
+ * table position (see FEEDFORWARD_VIN).
+ * 
+ * Settings:
+ * - FEEDFORWARD_DEAD_TIME: 0 = no dead-time compensation, 1 = dead-time compensation enabled
+ * ***********************************************************************************************/
+#define FEEDFORWARD_DEAD_TIME           1           // Enable/Disable dead-time compensation
+
+#define FEEDFORWARD_DT_LUT_SIZE         16          // Number of table intervals (fixed by FEEDFORWARD_LUT_16())
+#define FEEDFORWARD_DT_RIPPLE_CURRENT   (((float)VIN_NOMINAL - (float)VOUT_NOMINAL) * ((float)VOUT_NOMINAL / (float)VIN_NOMINAL) / \
+                                        ((float)INDUCTANCE * 1.0e-6 * (float)SWITCHING_FREQUENCY)) // Peak-to-peak phase current ripple in [A]
+#define FEEDFORWARD_DT_CURRENT_FULL     (0.5 * FEEDFORWARD_DT_RIPPLE_CURRENT * (float)CONVERTER_PHASES) // Output current of full compensation in [A]
+
+#define FEEDFORWARD_IOUT_TICKS(x)       ((float)(x) * (float)IOUT_SCALER_RATIO_I2V * (float)ADC_SLOW_SCALER) // Conversion into slow channel ticks
+#define FEEDFORWARD_DT_LUT_RANGE_TICKS  (uint16_t)FEEDFORWARD_IOUT_TICKS(IOUT_MAXIMUM)
+#define FEEDFORWARD_DT_LUT_SCALER       (uint32_t)(((float)FEEDFORWARD_DT_LUT_SIZE * 16777216.0) / FEEDFORWARD_IOUT_TICKS(IOUT_MAXIMUM))
+
+// Dead-time compensation of table entry n in PWM ticks
+#define FEEDFORWARD_DT_LUT_CURRENT(n)   ((float)(n) * (float)IOUT_MAXIMUM / (float)FEEDFORWARD_DT_LUT_SIZE)
+#define FEEDFORWARD_DT_LUT_TICKS(n)     ((FEEDFORWARD_DT_LUT_CURRENT(n) < FEEDFORWARD_DT_CURRENT_FULL) ? \
+                                        (int16_t)((float)PWM_DEAD_TIME_H * FEEDFORWARD_DT_LUT_CURRENT(n) / FEEDFORWARD_DT_CURRENT_FULL) : \
+                                        (int16_t)PWM_DEAD_TIME_H)
+
+// Compile-time table generation (ENTRY(n) is expanded for n = 0 ... size)
+#define FEEDFORWARD_LUT_8(ENTRY, n)     ENTRY((n)+0), ENTRY((n)+1), ENTRY((n)+2), ENTRY((n)+3), \
+                                        ENTRY((n)+4), ENTRY((n)+5), ENTRY((n)+6), ENTRY((n)+7),
+#define FEEDFORWARD_LUT_16(ENTRY)       FEEDFORWARD_LUT_8(ENTRY, 0) FEEDFORWARD_LUT_8(ENTRY, 8) ENTRY(16)
+#define FEEDFORWARD_LUT_32(ENTRY)       FEEDFORWARD_LUT_8(ENTRY, 0) FEEDFORWARD_LUT_8(ENTRY, 8) \
+                                        FEEDFORWARD_LUT_8(ENTRY, 16) FEEDFORWARD_LUT_8(ENTRY, 24) ENTRY(32)
+
+#define FEEDFORWARD_ENABLED             ((FEEDFORWARD_VIN == 1) || (FEEDFORWARD_DEAD_TIME == 1))
+
+/* ***********************************************************************************************
+ * DATA TYPES
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint16_t control_output;       // Normalized control loop output (target of the control loop)
+    volatile int16_t gain;                  // Recent input voltage gain factor (Q14)
+    volatile int16_t dead_time;             // Recent dead-time compensation in PWM ticks
+    volatile uint16_t* ptrTarget;           // Duty cycle written by the feed-forward stage
+    volatile cNPNZ16b_t* ptrController;     // Control loop object providing the duty cycle limits
+} FEEDFORWARD_t; // Feed-forward stage of the output voltage control loop
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile FEEDFORWARD_t feedforward;
+
+extern volatile uint16_t feedforward_Init(volatile cNPNZ16b_t* controller, volatile uint16_t* ptrTarget);
+extern volatile uint16_t feedforward_Update(void);
+extern volatile uint16_t feedforward_Apply(void);
+extern volatile int16_t feedforward_Normalize(volatile int16_t duty);
+
+#endif	/* APL_RESOURCES_FEEDFORWARD_H */
@@ -0,0 +1,162 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!multiphase.h
+ * ***************************************************************************
+ * File:   multiphase.h
+ * Author: M91406
+ * 
+ * Summary:
+ * Multi-phase interleaved converter support
+ * 
+ * Description:
+ * This header declares the phase descriptors of an interleaved power converter 
+ * with CONVERTER_PHASES phases (see syscfg_scaling.h). Each phase is described
+ * by the PWM generator registers driving its switches and the ADC buffer of 
+ * its current sense feedback. 
+ * 
+ * The output voltage control loop writes its output into the common duty cycle
+ * multiphase.duty_cycle. multiphase_Distribute() is called by the control loop
+ * interrupt service routine after each loop iteration and writes the common 
+ * duty cycle plus an individual current sharing correction into the duty cycle 
+ * registers of all active phases.
+ * 
+ * The phase manager task multiphase_PhaseManager() sheds phases at light load
+ * and adds them back when the load current increases. The phase shift between 
+ * the remaining phases is recalculated to PERIOD / active phases.
+ * 
+ * The switching period of all phases is changed at runtime by multiphase_SetPeriod()
+ * (see efficiency.h). Phase shifts are always derived from the recent period.
+ * 
+ * When CONVERTER_PHASES is set to 1, the control loop writes directly into the
+ * PWM duty cycle register and the functions of this module have no effect.
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APL_RESOURCES_MULTIPHASE_H
+#define	APL_RESOURCES_MULTIPHASE_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hal/config/syscfg_scaling.h"
+#include "hal/initialization/init_pwm.h"
+#include "hal/initialization/init_adc.h"
+
+
+/*!MULTIPHASE_SHARING
+ * ***********************************************************************************************
+ * Description:
+ * Current sharing between active phases. In each control loop iteration the deviation of each 
+ * phase current from the average of all active phase currents is integrated. The integrator 
+ * output is added to the common duty cycle of this phase:
+ * 
+ *   correction[k] += ((sum of phase currents) - (active phases x phase current[k])) >> SHIFT
+ * 
+ * The deviation is multiplied by the number of active phases instead of dividing the phase 
+ * current sum to avoid a division in the interrupt service routine.
+ * 
+ * Settings:
+ * - MULTIPHASE_SHARING: 0 = common duty cycle only, 1 = current sharing enabled
+ * - MULTIPHASE_SHARING_SHIFT: integrator gain (2^-SHIFT PWM ticks per ADC tick and iteration)
+ * - MULTIPHASE_CORRECTION_LIMIT: maximum correction of one phase in PWM ticks
+ * ***********************************************************************************************/
+#define MULTIPHASE_SHARING              1           // Enable/Disable phase current sharing
+#define MULTIPHASE_SHARING_SHIFT        8           // Current sharing integrator gain
+#define MULTIPHASE_CORRECTION_RATIO     0.020       // Maximum correction as ratio of the switching period
+#define MULTIPHASE_CORRECTION_LIMIT     (int16_t)((float)MULTIPHASE_CORRECTION_RATIO * (float)PWM_PERIOD) // Maximum correction in PWM ticks
+
+/*!MULTIPHASE_SHEDDING
+ * ***********************************************************************************************
+ * Description:
+ * Phase shedding at light load. The phase manager compares the output current (slow channel,
+ * application.data.i_out) against per-phase current levels:
+ * 
+ * - A phase is added as soon as the output current exceeds (active phases x ADD_CURRENT)
+ * - A phase is shed when the output current has been below ((active phases - 1) x SHED_CURRENT)
+ *   for MULTIPHASE_SHED_DELAY consecutive calls of the phase manager
+ * 
+ * MULTIPHASE_SHED_CURRENT needs to be lower than MULTIPHASE_ADD_CURRENT to provide hysteresis.
+ * Phases are shed from the last phase downwards; phase #1 is always active.
+ * 
+ * Settings:
+ * - MULTIPHASE_SHEDDING: 0 = all phases are always active, 1 = phase shedding enabled
+ * - MULTIPHASE_SHED_CURRENT: per-phase current below which one phase is shed in [A]
+ * - MULTIPHASE_ADD_CURRENT: per-phase current above which one phase is added in [A]
+ * - MULTIPHASE_SHED_DELAY: number of phase manager calls before a phase is shed
+ * ***********************************************************************************************/
+#define MULTIPHASE_SHEDDING             1           // Enable/Disable phase shedding
+#define MULTIPHASE_SHED_CURRENT         1.500       // Per-phase output current shedding one phase in [A]
+#define MULTIPHASE_ADD_CURRENT          2.500       // Per-phase output current adding one phase in [A]
+#define MULTIPHASE_SHED_DELAY           50          // Phase manager calls below shedding level before shedding
+
+#define MULTIPHASE_CURRENT_TICKS(x)     (uint16_t)((float)(x) * (float)IOUT_SCALER_RATIO_I2V * (float)ADC_SLOW_SCALER) // Conversion into slow channel ticks
+#define MULTIPHASE_SHED_TICKS           MULTIPHASE_CURRENT_TICKS(MULTIPHASE_SHED_CURRENT)
+#define MULTIPHASE_ADD_TICKS            MULTIPHASE_CURRENT_TICKS(MULTIPHASE_ADD_CURRENT)
+
+/* ***********************************************************************************************
+ * DATA TYPES
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint16_t* ptrDutyCycle;        // Pointer to the duty cycle register PGxDC
+    volatile uint16_t* ptrPeriod;           // Pointer to the period register PGxPER
+    volatile uint16_t* ptrTriggerC;         // Pointer to PGxTRIGC (start of the following phase)
+    volatile uint16_t* ptrStatus;           // Pointer to the status register PGxSTAT
+    volatile uint16_t* ptrIOCONL;           // Pointer to the output control register PGxIOCONL
+    volatile uint16_t* ptrCurrentSense;     // Pointer to the ADC buffer of the phase current
+    volatile int32_t sharing_integrator;    // Current sharing integrator
+    volatile int16_t correction;            // Duty cycle correction in PWM ticks
+    volatile bool enabled;                  // Phase is active
+} MULTIPHASE_PHASE_t; // Descriptor of one converter phase
+
+typedef struct {
+    volatile MULTIPHASE_PHASE_t phase[CONVERTER_PHASES]; // Phase descriptors
+    volatile uint16_t duty_cycle;           // Common duty cycle (control loop output)
+    volatile int16_t minimum;               // Duty cycle minimum of each phase
+    volatile int16_t maximum;               // Duty cycle maximum of each phase
+    volatile uint16_t period;               // Recent switching period of all phases in PWM ticks
+    volatile uint16_t active;               // Number of active phases
+    volatile uint16_t phase_shift;          // Recent phase shift between active phases in PWM ticks
+    volatile uint16_t shed_counter;         // Number of phase manager calls below the shedding level
+    volatile bool sharing_enable;           // Enable/Disable current sharing
+    volatile bool shedding_enable;          // Enable/Disable phase shedding
+    volatile bool outputs_enable;           // Outputs of active phases are driven by the PWM generators
+} MULTIPHASE_t; // Interleaved converter
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile MULTIPHASE_t multiphase;
+
+extern volatile uint16_t multiphase_Init(void);
+extern volatile uint16_t multiphase_Distribute(void);
+extern volatile uint16_t multiphase_SetActivePhases(volatile uint16_t phases);
+extern volatile uint16_t multiphase_SetPeriod(volatile uint16_t period, volatile int16_t minimum, volatile int16_t maximum);
+extern volatile uint16_t multiphase_EnableOutputs(volatile bool enable);
+extern volatile uint16_t multiphase_PhaseManager(void);
+
+#endif	/* APL_RESOURCES_MULTIPHASE_H */
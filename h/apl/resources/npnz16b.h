@@ -0,0 +1,157 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!npnz16b.h
+ * ***************************************************************************
+ * File:   npnz16b.h
+ * Author: M91406
+ * 
+ * Summary:
+ * Generic data structure of 16-bit fixed point nPnZ compensators
+ * 
+ * Description:
+ * This header declares the generic controller object of discrete nPnZ 
+ * compensators operating on 16-bit fixed point data in Q15 format as exported 
+ * by the z-Domain Control Loop Designer (DCLD). Each compensator instance 
+ * is declared in its own header (e.g. cvmc_vout.h) holding the filter 
+ * coefficients and histories, which are linked to this object by pointers.
+ * 
+ * History:
+ * 10/14/2026	File created
+ * ***************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APL_RESOURCES_NPNZ16B_H
+#define	APL_RESOURCES_NPNZ16B_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+// Control loop implementation options
+#define NPNZ16B_IMPLEMENTATION_C    0   // Control loop is executed by the C update function of the loop
+#define NPNZ16B_IMPLEMENTATION_ASM  1   // Control loop is executed by the assembly kernel npnz16b_Update3p3z()
+
+#define NPNZ16B_Q15_SCALER          32767.0 // Scaler of floating point values into Q15 format
+
+// Bilinear transformation of a normalized first order term (1 + s/w) into the z-domain factor
+// (a + b z^-1) / (1 + z^-1), where k = 2 * sampling frequency
+#define NPNZ16B_TUSTIN_A(k, w)      (1.0 + ((k) / (w)))
+#define NPNZ16B_TUSTIN_B(k, w)      (1.0 - ((k) / (w)))
+
+// Constant expression helpers for the coefficient scaling
+#define NPNZ16B_ABS(x)              (((x) < 0.0) ? -(x) : (x))
+#define NPNZ16B_MAX(a, b)           (((a) > (b)) ? (a) : (b))
+#define NPNZ16B_SHIFT(m)            (((m) < 1.0) ? 0 : ((m) < 2.0) ? 1 : ((m) < 4.0) ? 2 : \
+                                     ((m) < 8.0) ? 3 : ((m) < 16.0) ? 4 : ((m) < 32.0) ? 5 : \
+                                     ((m) < 64.0) ? 6 : ((m) < 128.0) ? 7 : 8)
+#define NPNZ16B_Q15(x, shift)       (int16_t)(((x) / (float)(1 << (shift))) * NPNZ16B_Q15_SCALER + \
+                                     (((x) < 0.0) ? -0.5 : 0.5))
+
+typedef struct{
+	volatile bool lower_saturation_event:1;	// Bit #0:  Flag indicating the output has been clamped to the minimum
+	volatile bool upper_saturation_event:1;	// Bit #1:  Flag indicating the output has been clamped to the maximum
+	volatile unsigned :1;	// Bit #2:  (reserved)
+	volatile unsigned :1;	// Bit #3:  (reserved)
+	volatile unsigned :1;	// Bit #4:  (reserved)
+	volatile unsigned :1;	// Bit #5:  (reserved)
+	volatile unsigned :1;	// Bit #6:  (reserved)
+	volatile unsigned :1;	// Bit #7:  (reserved)
+	volatile unsigned :1;	// Bit #8:  (reserved)
+	volatile unsigned :1;	// Bit #9:  (reserved)
+	volatile unsigned :1;	// Bit #10: (reserved)
+	volatile unsigned :1;	// Bit #11: (reserved)
+	volatile unsigned :1;	// Bit #12: (reserved)
+	volatile unsigned :1;	// Bit #13: (reserved)
+	volatile unsigned :1;	// Bit #14: (reserved)
+	volatile bool enable:1;	// Bit #15: Enables/disables the compensator
+} __attribute__((packed))NPNZ16B_STATUS_BIT_FIELD_t;
+
+typedef union 
+{
+	volatile uint16_t value; // buffer for 16-bit word read/write operations
+	volatile NPNZ16B_STATUS_BIT_FIELD_t flags; // data structure for single bit addressing operations
+} NPNZ16B_STATUS_t;
+
+typedef struct {
+    volatile NPNZ16B_STATUS_t status; // Status word of the compensator
+    volatile uint16_t* ptrSourceRegister; // Pointer to the feedback source register (e.g. ADC buffer)
+    volatile uint16_t* ptrTargetRegister; // Pointer to the control output target register (e.g. PWM duty cycle)
+    volatile uint16_t* ptrControlReference; // Pointer to the control reference variable
+    volatile int16_t* ptrACoefficients; // Pointer to the A-coefficients (control history) located in X-space
+    volatile int16_t* ptrBCoefficients; // Pointer to the B-coefficients (error history) located in X-space
+    volatile int16_t* ptrControlHistory; // Pointer to the control history located in Y-space
+    volatile int16_t* ptrErrorHistory; // Pointer to the error history located in Y-space
+    volatile uint16_t ACoefficientsArraySize; // Number of A-coefficients
+    volatile uint16_t BCoefficientsArraySize; // Number of B-coefficients
+    volatile int16_t normPreShift; // Normalization of the feedback value into Q15 (left shift)
+    volatile int16_t normPostShiftA; // Scaling of the A-term result (left shift)
+    volatile int16_t normPostShiftB; // Scaling of the B-term result (left shift)
+    volatile int16_t InputOffset; // Feedback offset subtracted from the source value (bi-directional feedback)
+    volatile int16_t MinOutput; // Control output clamping minimum (anti-windup)
+    volatile int16_t MaxOutput; // Control output clamping maximum (anti-windup)
+} __attribute__((packed))cNPNZ16b_t; // Generic nPnZ controller object
+
+typedef struct {
+    volatile int16_t* ptrACoefficients; // Pointer to the A-coefficients of this operating point (X-space)
+    volatile int16_t* ptrBCoefficients; // Pointer to the B-coefficients of this operating point (X-space)
+    volatile uint16_t upper_threshold; // Upper limit of the operating point range (scheduling variable value)
+} __attribute__((packed))NPNZ16B_COEFF_BANK_t; // Coefficient bank of one operating point
+
+typedef struct {
+    volatile bool enable; // Enables/disables the gain scheduler
+    volatile bool bumpless; // Enables bumpless transfer of the histories when coefficient banks are switched
+    volatile uint16_t* ptrSchedulingVariable; // Pointer to the scheduling variable (e.g. input voltage or load current)
+    volatile NPNZ16B_COEFF_BANK_t* ptrBanks; // Pointer to the list of coefficient banks in ascending operating point order
+    volatile uint16_t banks; // Number of coefficient banks
+    volatile uint16_t hysteresis; // Hysteresis around bank thresholds (scheduling variable value)
+    volatile uint16_t active; // Index of the recently active coefficient bank
+    volatile uint16_t switch_count; // Number of coefficient bank switch-overs
+} __attribute__((packed))NPNZ16B_GAIN_SCHEDULER_t; // Gain scheduler selecting coefficient banks by operating point
+
+typedef struct {
+    volatile uint16_t cycles; // CPU cycles of the most recent control loop iteration
+    volatile uint16_t maximum; // Longest control loop iteration in CPU cycles
+    volatile uint32_t count; // Number of control loop iterations
+} __attribute__((packed))NPNZ16B_CYCLE_METER_t; // Control loop execution time report
+
+
+/* ***********************************************************************************************
+ * PUBLIC FUNCTIONS
+ * ***********************************************************************************************/
+
+extern volatile uint16_t npnz16b_SelectBank(volatile cNPNZ16b_t* controller, 
+                volatile NPNZ16B_COEFF_BANK_t* bank, volatile bool bumpless);
+extern volatile uint16_t npnz16b_GainScheduler(volatile cNPNZ16b_t* controller, 
+                volatile NPNZ16B_GAIN_SCHEDULER_t* scheduler);
+
+// Hand-optimized 3P3Z kernel (npnz16b_3p3z.s) for control loop ISRs running on an alternate 
+// working register set. The controller object needs to provide 3 A- and 4 B-coefficients.
+extern void npnz16b_Update3p3z(volatile cNPNZ16b_t* controller);
+
+
+#endif	/* APL_RESOURCES_NPNZ16B_H */
@@ -0,0 +1,70 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Acquisition.h
+ * *****************************************************************************
+ * File:   task_Acquisition.h
+ * Author: M91406
+ *
+ * Description:
+ * Double-buffered snapshot of the slow ADC channels. The slow channels are 
+ * converted by the shared ADC core without interrupts (see init_adc.h). This 
+ * task collects the results of each completed scan into the inactive snapshot 
+ * buffer and swaps the buffer index when the snapshot is complete. Readers 
+ * always access a consistent set of samples of the same scan through 
+ * adc_acquisition.buffer[adc_acquisition.active].
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_ACQUISITION_H
+#define	APPLICATION_LAYER_TASK_ACQUISITION_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+
+typedef struct {
+    volatile uint16_t v_in;  // input voltage ADC result (ADC_SLOW_RESOLUTION)
+    volatile uint16_t i_in;  // input current ADC result (ADC_SLOW_RESOLUTION)
+    volatile uint16_t i_out;  // output current ADC result (ADC_SLOW_RESOLUTION)
+    volatile uint16_t temperature; // board temperature ADC result (ADC_SLOW_RESOLUTION)
+} ADC_SNAPSHOT_t; // Set of slow channel samples of one scan
+
+typedef struct {
+    volatile ADC_SNAPSHOT_t buffer[2]; // snapshot buffers
+    volatile uint16_t active; // index of the buffer holding the most recent complete snapshot
+    volatile uint16_t count; // number of completed snapshots
+    volatile uint16_t pending; // number of task calls without completed scan
+} ADC_ACQUISITION_t; // Double-buffered snapshot of the slow ADC channels
+
+extern volatile ADC_ACQUISITION_t adc_acquisition;
+
+/* prototypes */
+extern volatile uint16_t init_Acquisition(void);
+extern volatile uint16_t exec_Acquisition(void);
+
+#endif	/* APPLICATION_LAYER_TASK_ACQUISITION_H */
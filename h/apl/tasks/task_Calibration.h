@@ -0,0 +1,153 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Calibration.h
+ * *****************************************************************************
+ * File:   task_Calibration.h
+ * Author: M91406
+ *
+ * Description:
+ * Self-calibration of the sense offsets at startup. While the power stage is 
+ * turned off (PWM generators running with overridden outputs), the current 
+ * sense channels and the output voltage feedback of each converter instance 
+ * are sampled and averaged. The averages are used as zero offsets:
+ * 
+ *   - i_in, i_out: slow channels averaged by the ADC digital filters (see 
+ *     ADC_SLOW_FILTER_MODE). The offsets are removed from the slow channel 
+ *     results by exec_Acquisition().
+ *   - v_out: output voltage feedback of each converter instance averaged by 
+ *     software. The offset is stored in converter[].loop.feedback_offset and 
+ *     added to the control loop reference, which leaves the control loop 
+ *     interrupt unchanged.
+ * 
+ * The input voltage cannot be calibrated while the power source is connected 
+ * and keeps the offset VIN_FB_OFFSET declared in syscfg_scaling.h.
+ * 
+ * Offsets exceeding CALIBRATION_OFFSET_MAX (e.g. pre-biased output or sense 
+ * circuit failure) are rejected and the previous offsets remain in use. After 
+ * a successful calibration, the offsets are written into a reserved program 
+ * memory page when no valid record exists or when one offset deviates from 
+ * the stored record by more than CALIBRATION_STORE_DEVIATION. After a warm 
+ * boot, init_Calibration() loads the stored record and the averaging is 
+ * skipped (see TASK_QUEUE_WARM_BOOT).
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_CALIBRATION_H
+#define	APPLICATION_LAYER_TASK_CALIBRATION_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+#include "apl/config/converter.h"
+#include "_root/generic/task_resumable.h"
+
+/*!Sense Offset Calibration Settings
+ * ***********************************************************************************************
+ * Description:
+ * CALIBRATION_SAMPLES_LOG2: number of averaged samples per channel (2^n). One sample is one 
+ *      digital filter result of the slow channels, resp. one reading of the output voltage 
+ *      feedback per task call.
+ * CALIBRATION_TIMEOUT: number of task calls after which an incomplete calibration is aborted
+ * CALIBRATION_SLOW_OFFSET_MAX: maximum accepted offset of the slow channels in ADC ticks
+ * CALIBRATION_FAST_OFFSET_MAX: maximum accepted offset of the output voltage feedback in ADC ticks
+ * CALIBRATION_STORE_DEVIATION: offset deviation in ADC ticks from the stored record, above which
+ *      the record is rewritten (limits the number of program memory erase cycles)
+ * 
+ * Please note:
+ * Program memory is only accessible by the master core. On the slave core 
+ * (USE_SENSE_CALIBRATION_FLASH = 0) offsets are not stored and warm boots use the 
+ * default offsets declared in syscfg_scaling.h.
+ * ***********************************************************************************************/
+
+#define CALIBRATION_SAMPLES_LOG2        4       // 16 samples per channel
+#define CALIBRATION_SAMPLES             (1 << CALIBRATION_SAMPLES_LOG2)
+#define CALIBRATION_TIMEOUT             2000    // Abort after 2000 task calls
+#define CALIBRATION_SLOW_OFFSET_MAX     (uint16_t)((1UL << ADC_SLOW_RESOLUTION) >> 5) // 3.1% of full scale
+#define CALIBRATION_FAST_OFFSET_MAX     (uint16_t)((1UL << ADC_RESOLUTION) >> 5)      // 3.1% of full scale
+#define CALIBRATION_STORE_DEVIATION     4       // Rewrite the stored record when an offset moved by more than 4 ticks
+
+#if (defined (__P33SMPS_CH_SLV__) || (USE_SENSE_CALIBRATION == 0))
+  #define USE_SENSE_CALIBRATION_FLASH   0       // Slave core has no access to program memory (no page reserved when disabled)
+#else
+  #define USE_SENSE_CALIBRATION_FLASH   1       // Enable/Disable storing the calibration record in program memory
+#endif
+
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+  #define CALIBRATION_FLASH_PAGE_SIZE   0x0800  // Program memory page size in PC units (1024 instruction words)
+#endif
+
+#define CALIBRATION_SIGNATURE           0x4341  // Calibration record signature ("CA")
+
+// Removes a sense offset from an ADC result (results below the offset return zero)
+#define CALIBRATION_REMOVE_OFFSET(value, offset)    (((value) > (offset)) ? ((value) - (offset)) : 0)
+
+typedef struct {
+    volatile uint16_t i_in;     // input current sense offset (ADC_SLOW_RESOLUTION)
+    volatile uint16_t i_out;    // output current sense offset (ADC_SLOW_RESOLUTION)
+    volatile uint16_t v_out[CONVERTER_COUNT]; // output voltage feedback offset of each converter (ADC_RESOLUTION)
+} SENSE_OFFSETS_t; // Set of sense offsets in ADC ticks
+
+#define CALIBRATION_OFFSET_WORDS        (sizeof(SENSE_OFFSETS_t) >> 1) // Size of the offset set in words
+#define CALIBRATION_RECORD_WORDS        ((CALIBRATION_OFFSET_WORDS + 3) & 0xFFFE) // signature + offsets + check word, padded to double-words
+
+typedef struct {
+    volatile bool complete :1;  // Bit #0: offsets have been measured after the recent cold boot
+    volatile bool restored :1;  // Bit #1: offsets have been loaded from the stored record
+    volatile bool stored :1;    // Bit #2: the stored record has been (re)written after the recent calibration
+    volatile bool rejected :1;  // Bit #3: measured offsets exceeded the accepted range
+    volatile bool timeout :1;   // Bit #4: calibration did not complete within CALIBRATION_TIMEOUT
+    volatile unsigned :11;      // Bit #5-15: (reserved)
+} __attribute__((packed))CALIBRATION_STATUS_FLAGS_t; // Calibration status flags
+
+typedef union {
+    volatile uint16_t value; // 16-bit wide access to status bit field
+    volatile CALIBRATION_STATUS_FLAGS_t flags; // single bit access to status bit field
+} CALIBRATION_STATUS_t; // Calibration status
+
+typedef struct {
+    volatile CALIBRATION_STATUS_t status; // Calibration status
+    volatile TASK_PT_t pt; // Resume point of the calibration sequence (see task_resumable.h)
+    volatile SENSE_OFFSETS_t offset; // Offsets in use
+    volatile uint32_t sum_i_in; // Sample accumulator of the input current sense
+    volatile uint32_t sum_i_out; // Sample accumulator of the output current sense
+    volatile uint32_t sum_v_out[CONVERTER_COUNT]; // Sample accumulators of the output voltage feedback
+    volatile uint16_t samples; // Number of accumulated samples
+    volatile uint16_t ticks; // Number of task calls of the recent calibration
+    volatile uint16_t step; // Double-word write step of the calibration record
+} SENSE_CALIBRATION_t; // Sense offset calibration data
+
+extern volatile SENSE_CALIBRATION_t sense_calibration;
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+extern volatile uint32_t calibration_flash_base; // program memory address of the calibration record page
+#endif
+
+/* prototypes */
+extern volatile uint16_t init_Calibration(void);
+extern volatile uint16_t exec_Calibration(void);
+
+#endif	/* APPLICATION_LAYER_TASK_CALIBRATION_H */
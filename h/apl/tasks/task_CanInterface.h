@@ -0,0 +1,116 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_CanInterface.h
+ * *****************************************************************************
+ * File:   task_CanInterface.h
+ * Author: M91406
+ *
+ * Description:
+ * Rack-level CAN FD status and command interface. The CAN interface task 
+ * publishes the status message CAN_STATUS_MESSAGE_t with the standard ID 
+ * CAN_ID_STATUS every CAN_PUBLISH_PERIOD. When one of the status words 
+ * changes, the message is sent immediately, but not more often than every 
+ * CAN_PUBLISH_MIN_INTERVAL. Analog values are only sent periodically, keeping 
+ * the bus load low when many nodes share the same bus.
+ * 
+ * Command messages sent to CAN_ID_COMMAND or CAN_ID_COMMAND_BROADCAST request 
+ * a system mode. The request overrides the locally detected system mode in 
+ * exec_CaptureSystemStatus(). Transitions of task_mgr.op_mode are therefore 
+ * still subject to the startup and fault override rules of css_SetSystemMode(). 
+ * When no command has been received within CAN_COMMAND_TIMEOUT, the request is 
+ * released and the locally detected system mode applies again.
+ * 
+ * Command message payload: [command (8-bit)][argument (16-bit)]
+ * 
+ * - CAN_CMD_RELEASE: releases remote control (no argument)
+ * - CAN_CMD_SYSTEM_MODE: requests the system mode given by the argument 
+ *   (SYSTEM_MODE_OFF, SYSTEM_MODE_ON or SYSTEM_MODE_STANDBY)
+ * - CAN_CMD_HEARTBEAT: refreshes the command timeout (no argument)
+ * 
+ * The interface is operated by polling without any interrupts (see init_can.h).
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_CAN_INTERFACE_H
+#define	APPLICATION_LAYER_TASK_CAN_INTERFACE_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+
+#define CAN_PUBLISH_PERIOD          100.0e-3    // Period of status messages in [sec]
+#define CAN_PUBLISH_MIN_INTERVAL    10.0e-3     // Minimum interval between two status messages in [sec]
+#define CAN_COMMAND_TIMEOUT         1.0         // Remote control timeout in [sec]
+
+// Intervals are counted in scheduler ticks, independent of the position of the task in the task queues
+#define CAN_PUBLISH_PERIOD_TICKS    (uint16_t)(CAN_PUBLISH_PERIOD / (float)TASK_MGR_TIME_STEP)
+#define CAN_PUBLISH_MIN_TICKS       (uint16_t)(CAN_PUBLISH_MIN_INTERVAL / (float)TASK_MGR_TIME_STEP)
+#define CAN_COMMAND_TIMEOUT_TICKS   (uint16_t)(CAN_COMMAND_TIMEOUT / (float)TASK_MGR_TIME_STEP)
+
+#define CAN_CMD_RELEASE             0x00        // Command: release remote control
+#define CAN_CMD_SYSTEM_MODE         0x01        // Command: request system mode
+#define CAN_CMD_HEARTBEAT           0x02        // Command: refresh remote control timeout
+
+#define CAN_STATUS_WORDS            5           // Number of status words triggering an immediate status message
+
+/*!CAN_STATUS_MESSAGE_t
+ * ***********************************************************************************************
+ * Payload of the status message (little endian). The first CAN_STATUS_WORDS words are status 
+ * words, which are monitored for changes.
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint16_t system_status; // application.system_status
+    volatile uint16_t system_mode; // application.system_mode
+    volatile uint16_t op_mode; // task_mgr.op_mode.mode
+    volatile uint16_t ctrl_status; // application.ctrl_status
+    volatile uint16_t task_mgr_status; // task_mgr.status (global fault flags)
+    volatile APPLICATION_DATA_t data; // application.data
+} __attribute__((packed)) CAN_STATUS_MESSAGE_t;
+
+/*!CAN_INTERFACE_t
+ * ***********************************************************************************************
+ * Status of the CAN interface
+ * ***********************************************************************************************/
+typedef struct {
+    volatile bool remote_control; // Flag indicating that the system mode is requested by the supervisor
+    volatile uint16_t system_mode_request; // System mode requested by the supervisor
+    volatile uint16_t command_timeout; // Remaining scheduler ticks until remote control is released
+    volatile uint16_t publish_counter; // Scheduler ticks since the most recent status message
+    volatile uint16_t messages; // Number of sent status messages (wraps around)
+    volatile uint16_t commands; // Number of received command messages (wraps around)
+    volatile uint16_t tx_overruns; // Number of status messages not sent due to a full transmit FIFO
+    volatile CAN_STATUS_MESSAGE_t published; // Most recently sent status message
+} CAN_INTERFACE_t;
+
+extern volatile CAN_INTERFACE_t can_interface;
+
+/* prototypes */
+extern volatile uint16_t init_CanInterface(void);
+extern volatile uint16_t exec_CanInterface(void);
+
+#endif	/* APPLICATION_LAYER_TASK_CAN_INTERFACE_H */
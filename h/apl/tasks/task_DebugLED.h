@@ -62,6 +62,8 @@
 #define DEBUG_LED_INIT_OUTPUT   DBGLED_INIT_OUTPUT
 
 extern volatile FUNCTION_LED_CONFIG_t taskDebugLED_config;
+extern volatile uint16_t taskDebugLED_tick_rate_default; // on-time during normal operation in task calls
+extern volatile uint16_t taskDebugLED_tick_rate_fault; // on-time during critical fault conditions in task calls
 
 /* ***********************************************************************************************
  * PROTOTYPES
@@ -69,6 +71,10 @@ extern volatile FUNCTION_LED_CONFIG_t taskDebugLED_config;
 extern volatile uint16_t init_taskDebugLED(void);
 extern volatile uint16_t task_DebugLED(void);
 
+#if (FUNCTION_LED_HARDWARE == 1)
+extern volatile uint16_t exec_DebugLEDHardware(void);
+#endif
+
 
 #endif	/* APL_TASK_DBGLED_H */
 
@@ -35,12 +35,28 @@
  * as the fault objects listed in fault_object_list[]! 
  * ***********************************************************************************************/
 
+#define CONVERTER_REGISTRY_FLTOBJ_OVP(id, controller, reference, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) \
+    FLTOBJ_OVP_##id,
+
 typedef enum {
     FLTOBJ_CPU_LOAD_OVERRUN, // CPU load counter exceeds task period => not enough bandwidth
     FLTOBJ_TASK_EXECUTION_FAILURE, // Fault object Task Execution Failure
     FLTOBJ_TASK_TIME_QUOTA_VIOLATION, // Fault object Task Time Quota Violation
+    #if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+    FLTOBJ_SLOT_START_LATENCY, // Fault object Scheduler Slot-Start Latency
+    #endif
+    #if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+    FLTOBJ_STACK_USAGE_WARNING, // Fault object Stack Usage Warning
+    FLTOBJ_STACK_USAGE_CRITICAL, // Fault object Stack Usage Critical
+    #endif
+    #if (USE_TASK_MANAGER_SELF_TEST == 1)
+    FLTOBJ_FLASH_CRC_FAILURE, // Fault object Flash CRC Failure
+    FLTOBJ_RAM_TEST_FAILURE, // Fault object RAM March Test Failure
+    #endif
+        
+    FLTOBJ_POWER_SOURCE_FAILURE,
         
-    FLTOBJ_POWER_SOURCE_FAILURE
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_FLTOBJ_OVP) // Output Over Voltage Protection of each converter instance
 //    FLTOBJ_SOFT_START, // Fault object Soft-Start Failure
         
 //    FLTOBJ_UVLO, // Fault object Under Voltage Lock-Out
@@ -51,6 +67,28 @@ typedef enum {
 //    FLTOBJ_OTP  // Fault object Over Temperature Protection
 }fault_object_index_e;
 
+/*!fault_group_index
+ * ***********************************************************************************************
+ * Description:
+ * The enumeration fault_group_index provides the labels of all fault groups in fault_group[]. 
+ * Each fault object is assigned to one of these groups by its group setting. Each converter 
+ * instance of the converter registry gets its own group FLTGRP_<id>, which allows to test 
+ * the health of a single power stage by FAULT_GROUP_HEALTHY(FLTGRP_<id>).
+ * 
+ * Please note:
+ * Each group holds up to FAULT_GROUP_MEMBERS_MAX fault objects.
+ * ***********************************************************************************************/
+
+#define CONVERTER_REGISTRY_FLTGRP(id, controller, reference, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) \
+    FLTGRP_##id,
+
+typedef enum {
+    FLTGRP_TASK_MANAGER, // Fault objects of the task manager flow control
+    FLTGRP_SYSTEM, // System-level fault objects (e.g. power source)
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_FLTGRP) // Fault objects of each converter instance
+    FAULT_GROUP_COUNT // Number of fault groups (has to be the last item of this list)
+}fault_group_index_e;
+
 
 /*
 typedef enum
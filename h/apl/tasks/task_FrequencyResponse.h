@@ -0,0 +1,207 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_FrequencyResponse.h
+ * *****************************************************************************
+ * File:   task_FrequencyResponse.h
+ * Author: M91406
+ *
+ * Description:
+ * Online loop gain measurement of the output voltage control loop (frequency
+ * response analyzer). While the converter is running at its nominal reference,
+ * a sinusoidal perturbation d is added to the control loop reference in each
+ * control loop interrupt. The loop then sees the error e = d - y, with y being
+ * the AC component of the output voltage feedback. The loop gain at the
+ * frequency of the perturbation results from the fundamentals of both signals:
+ *
+ *   L(f) = Y(f) / E(f) = Y(f) / (D(f) - Y(f))
+ *
+ * The fundamentals D(f) and Y(f) are measured by single-bin DFT accumulators
+ * in the control loop interrupt (four multiply-accumulate operations per
+ * sample). Sine and cosine are read from a constant table in program memory,
+ * addressed by a 32-bit phase accumulator. Gain and phase are calculated by
+ * exec_FrequencyResponse() in task context, which also steps the frequency
+ * through a logarithmic sweep and sends each result as telemetry response
+ * frame (see below).
+ *
+ * A sweep is started and stopped by writing FRA_COMMAND_START or FRA_COMMAND_STOP
+ * to parameter PRM_FRA_COMMAND (see parameters.h). A sweep is aborted when the
+ * converter leaves SOFT_START_STEP_COMPLETE (e.g. soft-stop or fault).
+ *
+ * Response payload (telemetry frame type TELEMETRY_FRAME_RESPONSE):
+ *
+ *   [FRA_RESPONSE_POINT (8-bit)][point index (8-bit)][status (8-bit)]
+ *   [frequency in 0.1 Hz (32-bit)][gain in 0.01 dB (16-bit)][phase in 0.01 degree (16-bit)]
+ *
+ * The sweep is terminated by a frame of status FRA_STATUS_SWEEP_COMPLETE or
+ * FRA_STATUS_ABORTED with the number of measured points as point index. All
+ * multi-byte values are little endian and signed except the frequency.
+ *
+ * When USE_FREQUENCY_RESPONSE_ANALYZER = 0, FRA_SAMPLE() expands to nothing and
+ * the control loop interrupt is unchanged. While no sweep is active, the cost
+ * is one flag test per control loop sample.
+ *
+ * Revision history:
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef APPLICATION_LAYER_TASK_FREQUENCY_RESPONSE_H
+#define	APPLICATION_LAYER_TASK_FREQUENCY_RESPONSE_H
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+#include "_root/config/msi_exchange_config.h"
+
+#if ((USE_FREQUENCY_RESPONSE_ANALYZER == 1) && (MSI_CORE_ROLE != MSI_ROLE_NONE))
+  #error "The frequency response analyzer requires the control loop and the telemetry stream on the same core (USE_DUAL_CORE_PARTITIONING = 0)"
+#endif
+
+/*!Frequency Response Analyzer Settings
+ * ***********************************************************************************************
+ * Description:
+ * FRA_AMPLITUDE: default perturbation amplitude in ADC ticks (can be changed by PRM_FRA_AMPLITUDE)
+ * FRA_AMPLITUDE_MAX: maximum accepted perturbation amplitude in ADC ticks
+ * FRA_FREQUENCY_START: frequency of the first point of the sweep in Hz
+ * FRA_FREQUENCY_STOP: maximum frequency of the sweep in Hz
+ * FRA_POINTS_PER_DECADE: number of logarithmically spaced points per decade
+ * FRA_SETTLE_PERIODS: number of perturbation periods before the response is measured
+ * FRA_MEASURE_PERIODS: number of perturbation periods accumulated per point
+ * FRA_PRODUCT_SHIFT: right shift of each product before it is accumulated
+ *
+ * Please note:
+ * The number of accumulated samples per point is limited to 65535 to prevent accumulator
+ * overflows. At low frequencies, the number of measured periods is reduced accordingly
+ * (down to one period at FRA_FREQUENCY_START >= 5 Hz at 300 kHz sampling frequency).
+ * The perturbation has to be small enough to keep the converter within its linear range
+ * (no duty cycle clamping, no current limit).
+ * ***********************************************************************************************/
+
+#define FRA_AMPLITUDE                   20      // Perturbation amplitude of 20 ADC ticks
+#define FRA_AMPLITUDE_MAX               200     // Perturbations larger than 200 ADC ticks are rejected
+#define FRA_FREQUENCY_START             (float)(100.0)      // First point at 100 Hz
+#define FRA_FREQUENCY_STOP              (float)(30.0e+3)    // Last point at or below 30 kHz (1/10 of the sampling frequency)
+#define FRA_POINTS_PER_DECADE           10      // 10 points per decade
+#define FRA_SETTLE_PERIODS              4       // 4 periods of settling time per point
+#define FRA_MEASURE_PERIODS             8       // 8 periods measured per point
+#define FRA_PRODUCT_SHIFT               12      // Products of 12-bit ADC tick and Q15 sine are scaled to Q3
+
+#define FRA_SAMPLES_MAX                 65535UL // Maximum number of samples accumulated per point
+#define FRA_FREQUENCY_RATIO             (float)(pow(10.0, (1.0 / (float)FRA_POINTS_PER_DECADE))) // Frequency step between two points
+#define FRA_SINE_TABLE_SIZE             256     // Number of samples per period of the sine table
+#define FRA_COSINE_OFFSET               (FRA_SINE_TABLE_SIZE >> 2) // Table offset of the cosine (90 degree)
+
+#if ((FRA_SETTLE_PERIODS < 1) || (FRA_MEASURE_PERIODS < 1))
+  #error "FRA: settle and measure periods have to be at least 1"
+#endif
+
+#define FRA_COMMAND_NONE                0       // No command pending
+#define FRA_COMMAND_START               1       // Start a frequency sweep
+#define FRA_COMMAND_STOP                2       // Stop the active frequency sweep
+
+#define FRA_RESPONSE_POINT              0x20    // Response type of frequency response frames
+
+#define FRA_STATUS_OK                   0x00    // Gain and phase of the point are valid
+#define FRA_STATUS_INVALID              0x01    // No error signal measured (gain and phase are invalid)
+#define FRA_STATUS_SWEEP_COMPLETE       0x02    // End of the sweep (all points measured)
+#define FRA_STATUS_ABORTED              0x03    // Sweep has been stopped or the converter left steady state
+
+/*!FRA_STATE_e
+ * ***********************************************************************************************
+ * Description:
+ * - FRA_STATE_IDLE: no sweep active, the control loop uses its unperturbed reference
+ * - FRA_STATE_SETTLE: perturbation is injected, the response has not settled yet
+ * - FRA_STATE_MEASURE: perturbation is injected and its response is accumulated
+ * - FRA_STATE_EVALUATE: the point has been measured, the perturbation is suspended until
+ *   exec_FrequencyResponse() has sent the result and started the next point
+ *
+ * The control loop interrupt only advances SETTLE to MEASURE and MEASURE to EVALUATE. All
+ * other transitions are performed by exec_FrequencyResponse() while the interrupt leaves
+ * the measurement data untouched (FRA_STATE_IDLE, FRA_STATE_EVALUATE).
+ * ***********************************************************************************************/
+typedef enum {
+    FRA_STATE_IDLE     = 0, // No sweep active
+    FRA_STATE_SETTLE   = 1, // Waiting for the response to settle
+    FRA_STATE_MEASURE  = 2, // Accumulating the fundamentals
+    FRA_STATE_EVALUATE = 3  // Calculating and sending the result of the recent point
+} FRA_STATE_e; // States of the frequency response measurement
+
+typedef struct {
+    volatile int32_t re; // Real part (sum of sample x cosine)
+    volatile int32_t im; // Imaginary part (negative sum of sample x sine)
+} FRA_DFT_t; // Single-bin DFT accumulator
+
+typedef struct {
+    volatile bool active :1;    // Bit #0: sweep is active (control loop reference is perturbed)
+    volatile bool aborted :1;   // Bit #1: sweep has been aborted by the control loop interrupt
+    volatile bool pending :1;   // Bit #2: result of the recent point has not been sent yet
+    volatile unsigned :13;      // Bit #3-15: (reserved)
+} __attribute__((packed))FRA_STATUS_FLAGS_t; // Frequency response analyzer status flags
+
+typedef union {
+    volatile uint16_t value; // 16-bit wide access to status bit field
+    volatile FRA_STATUS_FLAGS_t flags; // single bit access to status bit field
+} FRA_STATUS_t; // Frequency response analyzer status
+
+typedef struct {
+    volatile FRA_STATUS_t status; // Frequency response analyzer status
+    volatile uint16_t state; // Recent state of the measurement of type FRA_STATE_e
+    volatile uint16_t command; // Pending command (FRA_COMMAND_xxx)
+    volatile uint16_t amplitude; // Perturbation amplitude in ADC ticks
+    volatile uint16_t point; // Index of the recent point
+    volatile uint16_t periods; // Remaining perturbation periods of the recent state
+    volatile uint16_t measure_periods; // Number of measured perturbation periods of the recent point
+    volatile uint32_t phase; // Phase accumulator (full period = 2^32)
+    volatile uint32_t increment; // Phase increment per control loop sample
+    volatile FRA_DFT_t injection; // Fundamental of the perturbation
+    volatile FRA_DFT_t response; // Fundamental of the output voltage feedback
+    volatile uint16_t* ptrReference; // Unperturbed reference of the control loop
+    volatile uint16_t reference; // Perturbed reference read by the control loop
+    volatile float frequency; // Frequency of the recent point in Hz
+    volatile int16_t loop_gain; // Loop gain of the recent point in 0.01 dB
+    volatile int16_t loop_phase; // Loop phase of the recent point in 0.01 degree
+    volatile uint8_t result; // Status of the recent point (FRA_STATUS_xxx)
+} FREQUENCY_RESPONSE_t; // Frequency response analyzer data
+
+extern volatile FREQUENCY_RESPONSE_t fra;
+
+/*!FRA_SAMPLE
+ * ***********************************************************************************************
+ * Description:
+ * Called by the control loop interrupt before the control loop is executed. Expands to nothing
+ * when the frequency response analyzer is disabled.
+ * ***********************************************************************************************/
+#if (USE_FREQUENCY_RESPONSE_ANALYZER == 1)
+  #define FRA_SAMPLE()      { if (fra.status.flags.active) { fra_Sample(); } }
+#else
+  #define FRA_SAMPLE()      /* no frequency response analyzer */
+#endif
+
+/* prototypes */
+extern volatile uint16_t init_FrequencyResponse(void);
+extern volatile uint16_t exec_FrequencyResponse(void);
+extern volatile uint16_t fra_Sample(void);
+
+#endif	/* APPLICATION_LAYER_TASK_FREQUENCY_RESPONSE_H */
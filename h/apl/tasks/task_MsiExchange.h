@@ -0,0 +1,58 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_MsiExchange.h
+ * *****************************************************************************
+ * File:   task_MsiExchange.h
+ * Author: M91406
+ *
+ * Description:
+ * Application data mapping of the master/slave core data exchange. On the 
+ * master core this task publishes the command flags derived from the task 
+ * manager and fault handler and copies the most recent feedback data of the 
+ * slave core into the application data structure. Hence, system status 
+ * capture and fault handler on the master core operate on the same data as
+ * in single core builds. On the slave core this task publishes the feedback 
+ * data and executes the commands of the master core.
+ * 
+ * When dual-core partitioning is disabled, both task functions return 
+ * immediately and their task queue entries are removed (see MSI_ENTRY in 
+ * tasks.h).
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_MSI_EXCHANGE_H
+#define	APPLICATION_LAYER_TASK_MSI_EXCHANGE_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "_root/generic/msi_exchange.h"
+
+extern volatile uint16_t init_MsiExchange(void);
+extern volatile uint16_t exec_MsiExchange(void);
+
+#endif	/* APPLICATION_LAYER_TASK_MSI_EXCHANGE_H */
@@ -0,0 +1,103 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Parameters.h
+ * *****************************************************************************
+ * File:   task_Parameters.h
+ * Author: M91406
+ *
+ * Description:
+ * Runtime parameter access protocol. A host sends request packets to the 
+ * telemetry UART, which are received into a ring buffer by DMA. The parameter 
+ * task decodes one request per call, executes it on the parameter table 
+ * generated from the parameter registry (parameters.h) and returns the result 
+ * as telemetry response frame. 
+ * 
+ * Requests use the same framing as the telemetry stream (COBS encoded, 0x00 
+ * terminated, CRC-16/CCITT-FALSE transmitted high byte first):
+ * 
+ *   [type (8-bit)][sequence (8-bit)][parameter ID (16-bit)][value (1, 2 or 4 bytes)][CRC-16]
+ * 
+ * - PARAM_REQUEST_READ: reads the parameter value (no value field)
+ * - PARAM_REQUEST_WRITE: writes the parameter value and returns the value read back
+ * - PARAM_REQUEST_INFO: returns the parameter descriptor (no value field)
+ * 
+ * Response payload (telemetry frame type TELEMETRY_FRAME_RESPONSE):
+ * 
+ *   [request type (8-bit)][request sequence (8-bit)][status (8-bit)][parameter ID (16-bit)][data]
+ * 
+ * Data of read and write responses is the parameter value. Data of information responses is 
+ * [size (8-bit)][flags (8-bit)][minimum (32-bit)][maximum (32-bit)]. All multi-byte values are 
+ * little endian except the CRC. Requests with invalid CRC are discarded without response.
+ * 
+ * Each request is completed by the parameter task before any other task is called. Hence,
+ * tasks always read either the old or the new value of a parameter.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_PARAMETERS_H
+#define	APPLICATION_LAYER_TASK_PARAMETERS_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+
+#define PARAM_REQUEST_READ              0x10    // Request type: read parameter value
+#define PARAM_REQUEST_WRITE             0x11    // Request type: write parameter value
+#define PARAM_REQUEST_INFO              0x12    // Request type: read parameter descriptor
+
+#define PARAM_STATUS_OK                 0x00    // Request has been executed successfully
+#define PARAM_STATUS_UNKNOWN_REQUEST    0x01    // Request type is not supported
+#define PARAM_STATUS_UNKNOWN_ID         0x02    // Parameter ID is not registered
+#define PARAM_STATUS_READ_ONLY          0x03    // Parameter cannot be written
+#define PARAM_STATUS_OUT_OF_RANGE       0x04    // Written value exceeds the parameter range
+#define PARAM_STATUS_INVALID_LENGTH     0x05    // Value size does not match the parameter size
+
+#define PARAM_REQUEST_SIZE              16      // Maximum raw request size in bytes (incl. CRC)
+
+/*!PARAMETER_STATUS_t
+ * ***********************************************************************************************
+ * Status of the parameter access protocol
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint16_t requests;     // Number of executed requests (wraps around)
+    volatile uint16_t rejected;     // Number of discarded request frames (CRC or framing errors)
+    volatile uint16_t writes;       // Number of successful parameter writes (wraps around)
+    volatile uint16_t rx_read;      // Read position in the UART receive ring buffer
+    volatile uint16_t length;       // Number of decoded bytes of the recent request frame
+    volatile uint8_t code;          // Recent COBS code byte
+    volatile uint8_t block;         // Remaining bytes of the recent COBS block
+    volatile bool overflow;         // Flag indicating that the recent request frame is too long
+} PARAMETER_STATUS_t;
+
+extern volatile PARAMETER_STATUS_t parameters;
+
+/* prototypes */
+extern volatile uint16_t init_Parameters(void);
+extern volatile uint16_t exec_Parameters(void);
+
+#endif	/* APPLICATION_LAYER_TASK_PARAMETERS_H */
@@ -0,0 +1,254 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Scope.h
+ * *****************************************************************************
+ * File:   task_Scope.h
+ * Author: M91406
+ *
+ * Description:
+ * Triggered waveform capture ("scope mode") of the output voltage control loop. 
+ * While a capture is recorded, the control loop interrupt copies all channels 
+ * of the scope registry (see scope.h) into a ring buffer of SCOPE_DEPTH samples,
+ * in every interrupt or in every n-th interrupt (PRM_SCOPE_DECIMATION). When the
+ * first PRM_SCOPE_PRETRIGGER samples have been recorded, the capture waits for 
+ * its trigger:
+ *
+ *   - SCOPE_TRIGGER_RISING/FALLING: the channel PRM_SCOPE_CHANNEL crosses the 
+ *     signed level PRM_SCOPE_LEVEL in the selected direction
+ *   - SCOPE_TRIGGER_FAULT: a fault object trips (see fdrv_FaultHandler.c)
+ *   - SCOPE_TRIGGER_OP_MODE: the task manager switches its operating mode 
+ *   - SCOPE_COMMAND_FORCE: the capture is triggered by the host
+ *
+ * After the trigger, the ring buffer is filled up with post-trigger samples and
+ * frozen. The frozen capture is kept until it is read by writing SCOPE_COMMAND_READ 
+ * to parameter PRM_SCOPE_COMMAND (see parameters.h). exec_Scope() then sends 
+ * the capture as sequence of telemetry response frames and re-arms the capture 
+ * with the recent settings. The trigger source and the number of pretrigger
+ * samples take effect with the next SCOPE_COMMAND_ARM. When SCOPE_AUTO_ARM = 1, the capture is armed at startup 
+ * (fault trigger by default), so that the waveforms around the first fault trip 
+ * are available in production without host interaction.
+ *
+ * Response payload (telemetry frame type TELEMETRY_FRAME_RESPONSE):
+ *
+ *   [SCOPE_RESPONSE_HEADER (8-bit)][channel count (8-bit)][depth (16-bit)]
+ *   [pretrigger samples (16-bit)][decimation (16-bit)][trigger source (8-bit)]
+ *   [trigger argument (16-bit)]
+ *
+ *   [SCOPE_RESPONSE_DATA (8-bit)][index of the first sample (16-bit)]
+ *   followed by up to SCOPE_SAMPLES_PER_FRAME samples of all channels 
+ *   in registry order (16-bit each)
+ *
+ * Samples are numbered from the oldest sample (index 0). The trigger sample has
+ * the index of the pretrigger samples. The trigger argument is the ID of the 
+ * tripped fault object or the index of the new operating mode. All multi-byte 
+ * values are little endian.
+ *
+ * When USE_SCOPE = 0, SCOPE_SAMPLE() and SCOPE_EVENT() expand to nothing and the 
+ * control loop interrupt is unchanged. While no capture is recorded, the cost is
+ * one flag test per control loop sample. Each recorded sample costs the channel
+ * copies plus a prescaler, pointer and counter update. The trigger function is 
+ * only called while a threshold or an event trigger is evaluated and once per
+ * state change.
+ *
+ * Revision history:
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.
+#ifndef APPLICATION_LAYER_TASK_SCOPE_H
+#define	APPLICATION_LAYER_TASK_SCOPE_H
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+#include "_root/config/msi_exchange_config.h"
+#include "apl/config/scope.h"
+
+#if ((USE_SCOPE == 1) && (MSI_CORE_ROLE != MSI_ROLE_NONE))
+  #error "The waveform capture requires the control loop and the telemetry stream on the same core (USE_DUAL_CORE_PARTITIONING = 0)"
+#endif
+
+/*!Waveform Capture Settings
+ * ***********************************************************************************************
+ * Description:
+ * SCOPE_DEPTH: number of samples of the capture buffer (RAM: 2 x SCOPE_CHANNEL_COUNT x SCOPE_DEPTH bytes)
+ * SCOPE_PRETRIGGER: default number of samples recorded before the trigger (PRM_SCOPE_PRETRIGGER)
+ * SCOPE_DECIMATION: default number of control loop interrupts per sample (PRM_SCOPE_DECIMATION)
+ * SCOPE_TRIGGER_DEFAULT: default trigger source (PRM_SCOPE_TRIGGER)
+ * SCOPE_AUTO_ARM: 1 = the capture is armed at startup, 0 = the capture is armed by the host
+ *
+ * Please note:
+ * At 300 kHz sampling frequency, 256 samples cover 853 us without decimation. 
+ * ***********************************************************************************************/
+
+#define SCOPE_DEPTH                     256     // 256 samples per channel
+#define SCOPE_PRETRIGGER                64      // 64 samples before the trigger
+#define SCOPE_DECIMATION                1       // One sample per control loop interrupt
+#define SCOPE_TRIGGER_DEFAULT           SCOPE_TRIGGER_FAULT // Capture the waveforms around a fault trip
+#define SCOPE_AUTO_ARM                  1       // Capture is armed at startup
+
+#if ((SCOPE_PRETRIGGER < 1) || (SCOPE_PRETRIGGER > (SCOPE_DEPTH - 2)))
+  #error "Scope: the number of pretrigger samples has to be within [1, SCOPE_DEPTH - 2]"
+#endif
+#if (SCOPE_DECIMATION < 1)
+  #error "Scope: the decimation has to be at least 1"
+#endif
+
+#define SCOPE_COMMAND_NONE              0       // No command pending
+#define SCOPE_COMMAND_ARM               1       // Restart the capture with the recent settings
+#define SCOPE_COMMAND_FORCE             2       // Trigger the armed capture immediately
+#define SCOPE_COMMAND_READ              3       // Send the frozen capture
+#define SCOPE_COMMAND_STOP              4       // Stop recording
+
+#define SCOPE_TRIGGER_NONE              0       // No trigger source (capture is only frozen by SCOPE_COMMAND_FORCE)
+#define SCOPE_TRIGGER_RISING            1       // Trigger channel rises to or above the trigger level
+#define SCOPE_TRIGGER_FALLING           2       // Trigger channel falls below the trigger level
+#define SCOPE_TRIGGER_FAULT             3       // Fault object trip
+#define SCOPE_TRIGGER_OP_MODE           4       // Operating mode switch of the task manager
+#define SCOPE_TRIGGER_MANUAL            5       // Triggered by SCOPE_COMMAND_FORCE (trigger source only)
+
+#define SCOPE_RESPONSE_HEADER           0x30    // Response type of the capture header frame
+#define SCOPE_RESPONSE_DATA             0x31    // Response type of capture data frames
+
+#define SCOPE_DATA_HEADER_SIZE          3       // Response type and sample index in bytes
+#define SCOPE_SAMPLES_PER_FRAME         ((TELEMETRY_RESPONSE_SIZE - SCOPE_DATA_HEADER_SIZE) / (2 * SCOPE_CHANNEL_COUNT)) // Samples per data frame
+
+#define SCOPE_STATUS_RECORDING          0x0001  // Status bit mask of the recording flag
+#define SCOPE_STATUS_TRIGGER_MASK       0x000C  // Status bit mask of the threshold and event flags
+
+/*!SCOPE_STATE_e
+ * ***********************************************************************************************
+ * Description:
+ * - SCOPE_STATE_IDLE: no capture recorded
+ * - SCOPE_STATE_PRETRIGGER: samples are recorded, the pretrigger history is not complete yet
+ * - SCOPE_STATE_ARMED: samples are recorded, the trigger is evaluated after each sample
+ * - SCOPE_STATE_TRIGGERED: samples are recorded until the buffer holds the post-trigger samples
+ * - SCOPE_STATE_FROZEN: the capture is complete and kept until it is read
+ * - SCOPE_STATE_READOUT: the capture is sent by exec_Scope()
+ *
+ * The control loop interrupt advances PRETRIGGER to ARMED, ARMED to TRIGGERED and TRIGGERED to 
+ * FROZEN. All other transitions are performed by exec_Scope() while the interrupt leaves the 
+ * capture buffer untouched (recording flag cleared).
+ * ***********************************************************************************************/
+typedef enum {
+    SCOPE_STATE_IDLE        = 0, // No capture recorded
+    SCOPE_STATE_PRETRIGGER  = 1, // Recording the pretrigger history
+    SCOPE_STATE_ARMED       = 2, // Waiting for the trigger
+    SCOPE_STATE_TRIGGERED   = 3, // Recording the post-trigger samples
+    SCOPE_STATE_FROZEN      = 4, // Capture complete, waiting for readout
+    SCOPE_STATE_READOUT     = 5  // Sending the capture
+} SCOPE_STATE_e; // States of the waveform capture
+
+typedef struct {
+    volatile bool recording :1; // Bit #0: samples are recorded by the control loop interrupt
+    volatile bool above :1;     // Bit #1: trigger channel has been at or above the trigger level in the recent sample
+    volatile bool threshold :1; // Bit #2: threshold trigger is evaluated after each sample
+    volatile bool event :1;     // Bit #3: event trigger is pending (fault trip, operating mode switch or forced)
+    volatile bool header :1;    // Bit #4: capture header frame has not been sent yet
+    volatile unsigned :11;      // Bit #5-15: (reserved)
+} __attribute__((packed))SCOPE_STATUS_FLAGS_t; // Waveform capture status flags
+
+typedef union {
+    volatile uint16_t value; // 16-bit wide access to status bit field
+    volatile SCOPE_STATUS_FLAGS_t flags; // single bit access to status bit field
+} SCOPE_STATUS_t; // Waveform capture status
+
+typedef struct {
+    volatile SCOPE_STATUS_t status; // Waveform capture status
+    volatile uint16_t state; // Recent state of the capture of type SCOPE_STATE_e
+    volatile uint16_t command; // Pending command (SCOPE_COMMAND_xxx)
+    volatile uint16_t trigger; // Trigger source of the next capture (SCOPE_TRIGGER_xxx)
+    volatile uint16_t channel; // Channel evaluated by threshold triggers (scope_channel_id_e)
+    volatile int16_t level; // Trigger level of threshold triggers
+    volatile uint16_t decimation; // Number of control loop interrupts per sample
+    volatile uint16_t pretrigger; // Number of samples recorded before the trigger
+    volatile uint16_t post; // Number of samples recorded after the trigger sample (latched when the capture is armed)
+    volatile uint16_t prescaler; // Remaining control loop interrupts until the next sample
+    volatile uint16_t remaining; // Remaining samples until the next state change
+    volatile uint16_t source; // Trigger source of the recent capture (SCOPE_TRIGGER_xxx)
+    volatile uint16_t argument; // Fault object ID or operating mode index of the recent event trigger
+    volatile uint16_t read_index; // Index of the next sample sent by the readout
+    volatile uint16_t* ptrWrite; // Next sample written by the control loop interrupt (oldest sample of a frozen capture)
+} SCOPE_t; // Waveform capture data
+
+extern volatile SCOPE_t scope;
+extern volatile uint16_t scope_buffer[SCOPE_DEPTH * SCOPE_CHANNEL_COUNT];
+
+/*!SCOPE_SAMPLE
+ * ***********************************************************************************************
+ * Description:
+ * Called by the control loop interrupt after the control loop has been executed. Records one 
+ * sample of all registered channels in each SCOPE_DECIMATION-th call while the recording flag is 
+ * set. scope_Sample() is only called when the remaining samples of the recent state have been 
+ * recorded or while a trigger is evaluated. Expands to nothing when the waveform capture is 
+ * disabled.
+ * ***********************************************************************************************/
+#define SCOPE_REGISTRY_RECORD(id, variable)     *_ptr++ = (uint16_t)(variable);
+
+#if (USE_SCOPE == 1)
+  #define SCOPE_SAMPLE() { \
+        if (scope.status.flags.recording) { \
+            if (--scope.prescaler == 0) { \
+                volatile uint16_t* _sample = scope.ptrWrite; \
+                volatile uint16_t* _ptr = _sample; \
+                scope.prescaler = scope.decimation; \
+                SCOPE_REGISTRY(SCOPE_REGISTRY_RECORD) \
+                if (_ptr == &scope_buffer[SCOPE_DEPTH * SCOPE_CHANNEL_COUNT]) { _ptr = &scope_buffer[0]; } \
+                scope.ptrWrite = _ptr; \
+                if ((--scope.remaining == 0) || (scope.status.value & SCOPE_STATUS_TRIGGER_MASK)) \
+                { scope_Sample(_sample); } \
+            } \
+        } \
+    }
+#else
+  #define SCOPE_SAMPLE()      /* no waveform capture */
+#endif
+
+/*!SCOPE_EVENT
+ * ***********************************************************************************************
+ * Description:
+ * Called by the fault handler on fault trips (SCOPE_TRIGGER_FAULT) and by the task manager on 
+ * operating mode switches (SCOPE_TRIGGER_OP_MODE). Hands over the event to the control loop 
+ * interrupt when the capture is armed for this trigger source. The argument is reported by the 
+ * capture header frame. Expands to nothing when the waveform capture is disabled.
+ * ***********************************************************************************************/
+#if (USE_SCOPE == 1)
+  #define SCOPE_EVENT(trigger_source, trigger_argument) { \
+        if ((scope.state == SCOPE_STATE_ARMED) && (scope.trigger == (trigger_source)) && \
+            (!scope.status.flags.event)) { \
+            scope.source = (trigger_source); \
+            scope.argument = (uint16_t)(trigger_argument); \
+            scope.status.flags.event = true; \
+        } \
+    }
+#else
+  #define SCOPE_EVENT(trigger_source, trigger_argument)   /* no waveform capture */
+#endif
+
+/* prototypes */
+extern volatile uint16_t exec_Scope(void);
+extern volatile uint16_t scope_Sample(volatile uint16_t* sample);
+
+#endif	/* APPLICATION_LAYER_TASK_SCOPE_H */
@@ -0,0 +1,111 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_SoftStart.h
+ * *****************************************************************************
+ * File:   task_SoftStart.h
+ * Author: M91406
+ *
+ * Description:
+ * Soft-start and soft-stop state machines of the power converter instances 
+ * driven by converter[n].soft_start (CONTROL_SOFT_START_t). The state machine 
+ * task runs from the scheduler, steps all instances and sequences delays, 
+ * pre-bias detection and the handover into OP_MODE_NORMAL. The reference ramp itself is executed by the control 
+ * loop interrupt (soft_start_Ramp()) in fixed-point steps, resulting in one 
+ * reference step per control loop sample instead of one step per scheduler 
+ * tick.
+ * 
+ * All delays and ramp increments are derived at compile time from the startup
+ * timing in syscfg_startup.h, TASK_MGR_TIME_STEP and SWITCHING_FREQUENCY.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_SOFT_START_H
+#define	APPLICATION_LAYER_TASK_SOFT_START_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+#include "apl/config/converter.h"
+
+/*!Soft-Start Sequence
+ * ***********************************************************************************************
+ * Description:
+ * The soft-start task steps each converter instance through the following states 
+ * (converter[n].soft_start.step):
+ * 
+ * - SOFT_START_STEP_INITIALIZE: outputs are overridden, control loop disabled
+ * - SOFT_START_STEP_POWER_ON_DELAY: waits POWER_ON_DELAY after the ADC has become active
+ * - SOFT_START_STEP_PRE_BIAS: measures the output voltage. When the output is pre-biased above 
+ *   VOUT_PREBIAS_MINIMUM, the ramp starts at the measured voltage and the control history is 
+ *   preloaded with the duty cycle matching VOUT/VIN, so the converter neither discharges nor 
+ *   overcharges the output when the outputs are released
+ * - SOFT_START_STEP_RAMP_UP: the control loop interrupt ramps the reference to its target
+ * - SOFT_START_STEP_POWER_GOOD_DELAY: waits POWER_GOOD_DELAY, then sets ramp_complete. When 
+ *   all instances have completed their startup, the task manager is switched into OP_MODE_NORMAL
+ * - SOFT_START_STEP_COMPLETE: converter is running at its nominal reference
+ * - SOFT_START_STEP_RAMP_DOWN: soft-stop requested by soft_start_Stop(); the control loop 
+ *   interrupt ramps the reference down to zero
+ * - SOFT_START_STEP_OFF: outputs are overridden, control loop disabled
+ * 
+ * The reference is ramped in Q16.16 format. The increment per control loop sample is:
+ * 
+ *   SOFT_START_RAMP_UP_INCREMENT(v_target) = (v_target << 16) / RAMP_UP_PERIOD_TICKS
+ * 
+ * with v_target being the reference of the converter instance at the end of the ramp-up
+ * 
+ * See also:
+ * POWER_ON_DELAY, RAMP_UP_PERIOD, RAMP_DOWN_PERIOD, POWER_GOOD_DELAY in syscfg_startup.h
+ * ***********************************************************************************************/
+#define SOFT_START_STEP_INITIALIZE          0   // Reset of the soft-start state machine
+#define SOFT_START_STEP_POWER_ON_DELAY      1   // Delay before the converter is started
+#define SOFT_START_STEP_PRE_BIAS            2   // Pre-bias detection and loop preload
+#define SOFT_START_STEP_RAMP_UP             3   // Reference ramp-up (control loop interrupt)
+#define SOFT_START_STEP_POWER_GOOD_DELAY    4   // Delay before power good is signaled
+#define SOFT_START_STEP_COMPLETE            5   // Startup has been completed
+#define SOFT_START_STEP_RAMP_DOWN           6   // Reference ramp-down (control loop interrupt)
+#define SOFT_START_STEP_OFF                 7   // Converter has been shut down
+
+#define SOFT_START_RAMP_DOWN                0   // converter[n].soft_start.direction: ramp down
+#define SOFT_START_RAMP_UP                  1   // converter[n].soft_start.direction: ramp up
+
+#define SOFT_START_V_TARGET                 VOUT_FB_REF_ADC // Default voltage reference at the end of the ramp-up in ADC ticks
+#define SOFT_START_RAMP_UP_INCREMENT(v_target)   (uint32_t)(((uint32_t)(v_target) << 16) / RAMP_UP_PERIOD_TICKS) // Q16.16 ramp-up step per sample
+#define SOFT_START_RAMP_DOWN_INCREMENT(v_target) (uint32_t)(((uint32_t)(v_target) << 16) / RAMP_DOWN_PERIOD_TICKS) // Q16.16 ramp-down step per sample
+#define SOFT_START_PREBIAS_THRESHOLD        (uint16_t)((float)VOUT_PREBIAS_MINIMUM * (float)VOUT_DIVIDER_RATIO * (float)ADC_SCALER) // Pre-bias detection level in ADC ticks
+
+// Duty cycle matching VOUT/VIN: duty = v_out [fast ADC ticks] * FACTOR / v_in [slow ADC ticks]
+#define SOFT_START_PREBIAS_DUTY_FACTOR      (uint16_t)((float)PWM_PERIOD * ((float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) / \
+                                            ((float)VOUT_DIVIDER_RATIO * (float)ADC_SCALER))
+
+/* prototypes */
+extern volatile uint16_t init_SoftStart(void);
+extern volatile uint16_t exec_SoftStart(void);
+extern volatile uint16_t soft_start_Stop(volatile CONVERTER_t* conv);
+extern volatile uint16_t soft_start_Ramp(volatile CONVERTER_t* conv);
+
+#endif	/* APPLICATION_LAYER_TASK_SOFT_START_H */
@@ -0,0 +1,82 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Telemetry.h
+ * *****************************************************************************
+ * File:   task_Telemetry.h
+ * Author: M91406
+ *
+ * Description:
+ * Binary telemetry data stream. Each call of the telemetry task copies the 
+ * variables listed in the telemetry registry (telemetry.h) into a snapshot 
+ * buffer, which allows the copy to be repeated when it has been interrupted 
+ * by a writer. The snapshot is then CRC-protected and COBS encoded in one 
+ * pass into the free frame buffer. Frames are built alternatingly in two frame
+ * buffers and transmitted directly from these buffers by the UART DMA channel. 
+ * Hence, the CPU only spends the time of the snapshot copy and the encoding 
+ * pass while the previous frame is still being transmitted.
+ * Other modules can hand over short response packets by telemetry_Respond(),
+ * which are sent with priority in the next telemetry time slot.
+ * 
+ * When the telemetry stream is disabled (USE_TELEMETRY = 0), both task 
+ * functions return immediately and their task queue entries are removed 
+ * (see TELEMETRY_ENTRY in tasks.h).
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef APPLICATION_LAYER_TASK_TELEMETRY_H
+#define	APPLICATION_LAYER_TASK_TELEMETRY_H
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h> // include processor file for standard integer number formats
+#include <stdbool.h> // include processor file for standard boolean number formats (e.g. true and flase))
+
+#include "hal/hal.h"
+#include "apl/config/telemetry.h"
+
+/*!TELEMETRY_STATUS_t
+ * ***********************************************************************************************
+ * Status of the telemetry data stream
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint16_t frames;       // Number of transmitted frames (wraps around)
+    volatile uint16_t overruns;     // Number of skipped frames due to a busy UART (wraps around)
+    volatile uint16_t schema_counter; // Data frame counter of the schema frame interval
+    volatile uint8_t sequence;      // Sequence counter of the most recent frame
+    volatile uint8_t write;         // Index of the frame buffer to be written next
+    volatile bool pending;          // Flag indicating that the frame buffer <write> is waiting for transmission
+    volatile bool response_pending; // Flag indicating that a response is waiting to be framed
+} TELEMETRY_STATUS_t;
+
+extern volatile TELEMETRY_STATUS_t telemetry;
+extern volatile uint8_t telemetry_frame[2][TELEMETRY_FRAME_SIZE]; // Encoded frames sent by the UART DMA channel
+
+/* prototypes */
+extern volatile uint16_t init_Telemetry(void);
+extern volatile uint16_t exec_Telemetry(void);
+extern volatile uint16_t telemetry_Respond(volatile uint8_t* data, volatile uint16_t length);
+extern volatile uint16_t telemetry_Crc16(volatile uint8_t* data, volatile uint16_t length);
+
+#endif	/* APPLICATION_LAYER_TASK_TELEMETRY_H */
@@ -0,0 +1,201 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * **************************************************************************************
+ * File:   syscfg_fixpnt.h
+ * Author: M91406
+ * Comments: Fixed-point scaling factors of sensed signals generated at compile time
+ * Revision history: 
+ * 10/14/26   initial release
+ * **************************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_SYSTEM_FIXED_POINT_SCALING_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_SYSTEM_FIXED_POINT_SCALING_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+#include <stdint.h>
+
+#include "hal/config/syscfg_scaling.h"
+
+/*!Fixed-Point Scaling Factors
+ * ************************************************************************************************
+ * Summary:
+ * Factor/shift pairs of a scaling ratio k given as floating point constant expression
+ *
+ * Description:
+ * A scaling ratio k is represented by a normalized Q15 factor and a shift:
+ * 
+ *   k = FIXPNT_FACTOR(k) * 2^(FIXPNT_SHIFT(k) - 15)
+ * 
+ * The shift is selected so that the factor is located in the range of 16384...32767, which 
+ * maintains 15 significant bits for any ratio between 2^-15 and 2^15. Both values are 
+ * integer constants folded by the compiler. No floating point operation is executed at 
+ * runtime. A value x is scaled by one 16x16-bit multiplication and one right shift:
+ * 
+ *   y = (x * FIXPNT_FACTOR(k)) >> (15 - FIXPNT_SHIFT(k))
+ * 
+ * See also:
+ * FIXPNT_SCALE(), FIXPNT_SCALE_SIGNED(), SCALING_REGISTRY
+ * ************************************************************************************************/
+
+#define FIXPNT_Q15_MAX              32767.0     // Maximum of the normalized factor
+#define FIXPNT_POW2(s)              (((s) >= 0) ? (float)(1UL << ((s) & 0x1F)) : (1.0 / (float)(1UL << ((-(s)) & 0x1F))))
+#define FIXPNT_LIMIT(s)             (FIXPNT_POW2(s) * (FIXPNT_Q15_MAX / 32768.0)) // Upper ratio limit of shift s
+
+#define FIXPNT_SHIFT(k)             (int16_t)( \
+                                    ((float)(k) < FIXPNT_LIMIT(-15)) ? -15 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-14)) ? -14 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-13)) ? -13 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-12)) ? -12 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-11)) ? -11 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-10)) ? -10 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-9)) ? -9 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-8)) ? -8 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-7)) ? -7 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-6)) ? -6 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-5)) ? -5 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-4)) ? -4 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-3)) ? -3 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-2)) ? -2 : \
+                                    ((float)(k) < FIXPNT_LIMIT(-1)) ? -1 : \
+                                    ((float)(k) < FIXPNT_LIMIT(0)) ? 0 : \
+                                    ((float)(k) < FIXPNT_LIMIT(1)) ? 1 : \
+                                    ((float)(k) < FIXPNT_LIMIT(2)) ? 2 : \
+                                    ((float)(k) < FIXPNT_LIMIT(3)) ? 3 : \
+                                    ((float)(k) < FIXPNT_LIMIT(4)) ? 4 : \
+                                    ((float)(k) < FIXPNT_LIMIT(5)) ? 5 : \
+                                    ((float)(k) < FIXPNT_LIMIT(6)) ? 6 : \
+                                    ((float)(k) < FIXPNT_LIMIT(7)) ? 7 : \
+                                    ((float)(k) < FIXPNT_LIMIT(8)) ? 8 : \
+                                    ((float)(k) < FIXPNT_LIMIT(9)) ? 9 : \
+                                    ((float)(k) < FIXPNT_LIMIT(10)) ? 10 : \
+                                    ((float)(k) < FIXPNT_LIMIT(11)) ? 11 : \
+                                    ((float)(k) < FIXPNT_LIMIT(12)) ? 12 : \
+                                    ((float)(k) < FIXPNT_LIMIT(13)) ? 13 : \
+                                    ((float)(k) < FIXPNT_LIMIT(14)) ? 14 : \
+                                    ((float)(k) < FIXPNT_LIMIT(15)) ? 15 : \
+                                    16 )
+#define FIXPNT_FACTOR(k)            (int16_t)(((float)(k) * FIXPNT_POW2(15 - FIXPNT_SHIFT(k))) + 0.5)
+
+// Deviation of the ratio represented by the factor/shift pair from the given ratio k
+#define FIXPNT_RATIO(k)             ((float)FIXPNT_FACTOR(k) / FIXPNT_POW2(15 - FIXPNT_SHIFT(k)))
+#define FIXPNT_ERROR(k)             ((FIXPNT_RATIO(k) > (float)(k)) ? \
+                                        ((FIXPNT_RATIO(k) - (float)(k)) / (float)(k)) : \
+                                        (((float)(k) - FIXPNT_RATIO(k)) / (float)(k)))
+
+#define FIXPNT_TOLERANCE            0.001       // Maximum relative error of a generated ratio (0.1%)
+
+
+/*!Scaling Registry
+ * ************************************************************************************************
+ * Summary:
+ * Sensed signals converted between ADC ticks and integer engineering units
+ *
+ * Description:
+ * Each signal is registered by one line 
+ * 
+ *   SIGNAL(name, ticks per unit, offset ticks, full scale ticks)
+ * 
+ * The engineering unit of a signal is given by the unit of the ticks per unit ratio (e.g. 
+ * [mV] or [mA]). The registry is expanded at compile time into the integer constants
+ * 
+ *   - SCALE_<name>_T2U_FACTOR / SCALE_<name>_T2U_SHIFT: ADC ticks into engineering units
+ *   - SCALE_<name>_U2T_FACTOR / SCALE_<name>_U2T_SHIFT: engineering units into ADC ticks
+ *   - SCALE_<name>_OFFSET: sense offset in ADC ticks
+ * 
+ * and static checks, which stop the build when
+ * 
+ *   - the full scale range of a signal exceeds the 16-bit range in engineering units (overflow)
+ *   - a ratio cannot be represented within FIXPNT_TOLERANCE (resolution)
+ * 
+ * Conversions are executed by SCALE_TICKS2UNIT(name, ticks) and SCALE_UNIT2TICKS(name, value).
+ * 
+ * Please note:
+ * The slow ADC channels (input voltage, output current) run at the effective resolution of 
+ * the oversampling filter (see ADC_SLOW_SCALER).
+ * ************************************************************************************************/
+
+#define SCALING_VIN_TICKS_PER_MV    ((float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER / 1000.0) // Input voltage ticks per [mV]
+#define SCALING_VOUT_TICKS_PER_MV   ((float)VOUT_DIVIDER_RATIO * (float)ADC_SCALER / 1000.0) // Output voltage ticks per [mV]
+#define SCALING_IOUT_TICKS_PER_MA   ((float)IOUT_SCALER_RATIO_I2V * (float)ADC_SLOW_SCALER / 1000.0) // Output current ticks per [mA]
+
+#define SCALING_REGISTRY(SIGNAL) \
+    SIGNAL(VIN,  SCALING_VIN_TICKS_PER_MV,  VIN_FB_OFFSET,  ((1UL << ADC_SLOW_RESOLUTION) - 1)) /* Input voltage in [mV] */ \
+    SIGNAL(VOUT, SCALING_VOUT_TICKS_PER_MV, VOUT_FB_OFFSET, ((1UL << ADC_RESOLUTION) - 1))      /* Output voltage in [mV] */ \
+    SIGNAL(IOUT, SCALING_IOUT_TICKS_PER_MA, IOUT_SCALER_OFFSET_TICKS, ((1UL << ADC_SLOW_RESOLUTION) - 1)) /* Output current in [mA] */
+
+// Generated factor/shift pairs
+#define SCALING_REGISTRY_CONST(name, ticks_per_unit, offset, full_scale) \
+    SCALE_##name##_T2U_FACTOR = FIXPNT_FACTOR(1.0 / (float)(ticks_per_unit)), \
+    SCALE_##name##_T2U_SHIFT  = FIXPNT_SHIFT(1.0 / (float)(ticks_per_unit)), \
+    SCALE_##name##_U2T_FACTOR = FIXPNT_FACTOR(ticks_per_unit), \
+    SCALE_##name##_U2T_SHIFT  = FIXPNT_SHIFT(ticks_per_unit), \
+    SCALE_##name##_OFFSET     = (int16_t)(offset),
+
+enum {
+    SCALING_REGISTRY(SCALING_REGISTRY_CONST)
+};
+
+// Static checks of overflow and resolution (a failing check divides by zero, which stops the build)
+#define FIXPNT_CHECK(condition)     (1 / ((condition) ? 1 : 0))
+
+#define SCALING_REGISTRY_CHECK(name, ticks_per_unit, offset, full_scale) \
+    SCALE_##name##_OVERFLOW_CHECK       = FIXPNT_CHECK(((float)(full_scale) / (float)(ticks_per_unit)) < 65535.0), \
+    SCALE_##name##_T2U_RESOLUTION_CHECK = FIXPNT_CHECK(FIXPNT_ERROR(1.0 / (float)(ticks_per_unit)) < FIXPNT_TOLERANCE), \
+    SCALE_##name##_U2T_RESOLUTION_CHECK = FIXPNT_CHECK(FIXPNT_ERROR(ticks_per_unit) < FIXPNT_TOLERANCE),
+
+enum {
+    SCALING_REGISTRY(SCALING_REGISTRY_CHECK)
+};
+
+// Normalization of input voltage ticks (slow channel) to the output voltage feedback scale
+#define VIN2VOUT_RATIO              (((float)VOUT_DIVIDER_RATIO * (float)ADC_SCALER) / ((float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER))
+#define VIN2VOUT_NORMALIZATION      FIXPNT_FACTOR(VIN2VOUT_RATIO)   // Q15 factor of the input to output voltage feedback ratio
+#define VIN2VOUT_NORM_BSFT          FIXPNT_SHIFT(VIN2VOUT_RATIO)    // Shift of the input to output voltage feedback ratio
+
+enum { VIN2VOUT_RESOLUTION_CHECK = FIXPNT_CHECK(FIXPNT_ERROR(VIN2VOUT_RATIO) < FIXPNT_TOLERANCE) };
+
+
+/*!Fixed-Point Conversion Helpers
+ * ************************************************************************************************
+ * Summary:
+ * Integer multiply-shift conversions of the hot path
+ *
+ * Description:
+ * FIXPNT_SCALE() and FIXPNT_SCALE_SIGNED() multiply a 16-bit value by a factor/shift pair 
+ * generated by FIXPNT_FACTOR()/FIXPNT_SHIFT() and shift the 32-bit product right by 
+ * (15 - shift). As factor and shift are constants, the compiler resolves each conversion 
+ * into one 16x16-bit multiplication and a constant shift. 
+ * 
+ * SCALE_TICKS2UNIT() removes the sense offset of a registered signal before it is scaled 
+ * (readings below the offset return zero). The static overflow check of the scaling registry 
+ * guarantees that any ADC reading of a registered signal converts into the 16-bit range. 
+ * Values handed to SCALE_UNIT2TICKS() have to be within the full scale range of the signal.
+ * ************************************************************************************************/
+
+#define FIXPNT_SCALE(value, factor, shift)          (uint16_t)(((uint32_t)(uint16_t)(value) * (uint16_t)(factor)) >> (15 - (shift)))
+#define FIXPNT_SCALE_SIGNED(value, factor, shift)   (int16_t)(((int32_t)(int16_t)(value) * (int16_t)(factor)) >> (15 - (shift)))
+
+#define SCALE_TICKS2UNIT(name, ticks)   FIXPNT_SCALE( \
+                                            (((int16_t)(ticks) > SCALE_##name##_OFFSET) ? ((int16_t)(ticks) - SCALE_##name##_OFFSET) : 0), \
+                                            SCALE_##name##_T2U_FACTOR, SCALE_##name##_T2U_SHIFT)
+#define SCALE_UNIT2TICKS(name, value)   (uint16_t)(FIXPNT_SCALE((value), SCALE_##name##_U2T_FACTOR, SCALE_##name##_U2T_SHIFT) + SCALE_##name##_OFFSET)
+
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_SYSTEM_FIXED_POINT_SCALING_H_ */
@@ -44,30 +44,30 @@
 
 #define VIN_MINIMUM             12.000       // input voltage minimum (Under-Voltage-Lockout-Level)
 #define VIN_MINIMUM_HYST        0.500        // input voltage minimum (Under-Voltage-Lockout Hysteresis Level)
-#define VIN_UVLO_TRIP           (uint16_t)(VIN_MINIMUM * VIN_DIVIDER_RATIO * ADC_SCALER) // Input voltage sense ADC ticks
-#define VIN_UVLO_RELEASE        (uint16_t)((VIN_MINIMUM + VIN_MINIMUM_HYST) * VIN_DIVIDER_RATIO * ADC_SCALER) // Input voltage sense ADC ticks
+#define VIN_UVLO_TRIP           (uint16_t)(VIN_MINIMUM * VIN_DIVIDER_RATIO * ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
+#define VIN_UVLO_RELEASE        (uint16_t)((VIN_MINIMUM + VIN_MINIMUM_HYST) * VIN_DIVIDER_RATIO * ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
 
 #define VIN_NOMINAL             19.800       // Nominal input voltage in [V]
-#define VIN_FB_REF_ADC          (uint16_t)((float)VIN_DIVIDER_RATIO * (float)VIN_NOMINAL * ADC_SCALER)   // Input voltage feedback in ADC ticks
+#define VIN_FB_REF_ADC          (uint16_t)((float)VIN_DIVIDER_RATIO * (float)VIN_NOMINAL * ADC_SLOW_SCALER)   // Input voltage feedback in ADC ticks
 
 #define VIN_MAXIMUM             22.000      // input voltage maximum (Under-Voltage-Lockout-Level)
 #define VIN_MAXIMUM_HYST        0.500       // input voltage maximum (Under-Voltage-Lockout Hysteresis Level)
-#define VIN_OVLO_TRIP           (uint16_t)((float)VIN_MAXIMUM * (float)VIN_DIVIDER_RATIO * (float)ADC_SCALER) // Input voltage sense ADC ticks
-#define VIN_OVLO_RELEASE        (uint16_t)(((float)VIN_MAXIMUM - (float)VIN_MAXIMUM_HYST) * (float)VIN_DIVIDER_RATIO * (float)ADC_SCALER) // Input voltage sense ADC ticks
+#define VIN_OVLO_TRIP           (uint16_t)((float)VIN_MAXIMUM * (float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
+#define VIN_OVLO_RELEASE        (uint16_t)(((float)VIN_MAXIMUM - (float)VIN_MAXIMUM_HYST) * (float)VIN_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
 
 
 #define V_DCLINK_MINIMUM       12.000       // input voltage minimum (Under-Voltage-Lockout-Level)
 #define V_DCLINK_MINIMUM_HYST  0.500        // input voltage minimum (Under-Voltage-Lockout Hysteresis Level)
-#define V_DCLINK_UVLO_TRIP     (uint16_t)(V_DCLINK_MINIMUM * V_DCLINK_DIVIDER_RATIO * ADC_SCALER) // Input voltage sense ADC ticks
-#define V_DCLINK_UVLO_RELEASE  (uint16_t)((V_DCLINK_MINIMUM + V_DCLINK_MINIMUM_HYST) * V_DCLINK_DIVIDER_RATIO * ADC_SCALER) // Input voltage sense ADC ticks
+#define V_DCLINK_UVLO_TRIP     (uint16_t)(V_DCLINK_MINIMUM * V_DCLINK_DIVIDER_RATIO * ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
+#define V_DCLINK_UVLO_RELEASE  (uint16_t)((V_DCLINK_MINIMUM + V_DCLINK_MINIMUM_HYST) * V_DCLINK_DIVIDER_RATIO * ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
 
 #define V_DCLINK_NOMINAL       19.800       // Nominal input voltage in [V]
-#define V_DCLINK_FB_REF_ADC    (uint16_t)((float)VIN_DIVIDER_RATIO * (float)V_DCLINK_NOMINAL * ADC_SCALER)   // Input voltage feedback in ADC ticks
+#define V_DCLINK_FB_REF_ADC    (uint16_t)((float)VIN_DIVIDER_RATIO * (float)V_DCLINK_NOMINAL * ADC_SLOW_SCALER)   // Input voltage feedback in ADC ticks
 
 #define V_DCLINK_MAXIMUM       22.000      // input voltage maximum (Under-Voltage-Lockout-Level)
 #define V_DCLINK_MAXIMUM_HYST  0.500       // input voltage maximum (Under-Voltage-Lockout Hysteresis Level)
-#define V_DCLINK_OVLO_TRIP     (uint16_t)((float)V_DCLINK_MAXIMUM * (float)V_DCLINK_DIVIDER_RATIO * (float)ADC_SCALER) // Input voltage sense ADC ticks
-#define V_DCLINK_OVLO_RELEASE  (uint16_t)(((float)V_DCLINK_MAXIMUM - (float)V_DCLINK_MAXIMUM_HYST) * (float)V_DCLINK_DIVIDER_RATIO * (float)ADC_SCALER) // Input voltage sense ADC ticks
+#define V_DCLINK_OVLO_TRIP     (uint16_t)((float)V_DCLINK_MAXIMUM * (float)V_DCLINK_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
+#define V_DCLINK_OVLO_RELEASE  (uint16_t)(((float)V_DCLINK_MAXIMUM - (float)V_DCLINK_MAXIMUM_HYST) * (float)V_DCLINK_DIVIDER_RATIO * (float)ADC_SLOW_SCALER) // Input voltage sense ADC ticks (slow channel resolution)
 
 
 #define VOUT_MINIMUM         6.000       // input voltage minimum (Under-Voltage-Lockout-Level)
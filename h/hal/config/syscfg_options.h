@@ -34,7 +34,32 @@
 
 
 #define USE_I2C             0       // This option enables/disables I2C communication
-#define USE_UART            0       // This option enables/disables UART communication
+#define USE_UART            1       // This option enables/disables UART communication
+#define USE_TELEMETRY       1       // This option enables/disables the binary telemetry data stream (requires USE_UART = 1)
+#define USE_PARAMETER_ACCESS 1      // This option enables/disables the runtime parameter access protocol (requires USE_TELEMETRY = 1)
+#define USE_CAN             0       // This option enables/disables the CAN FD status and command interface (pins see init_can.h)
+#define USE_SENSE_CALIBRATION 1     // This option enables/disables the sense offset calibration at startup (see task_Calibration.h)
+#define USE_FREQUENCY_RESPONSE_ANALYZER 1 // This option enables/disables the online loop gain measurement (see task_FrequencyResponse.h)
+#define USE_SCOPE           1       // This option enables/disables the triggered waveform capture of the control loop (see task_Scope.h)
+
+#if ((USE_TELEMETRY == 1) && (USE_UART == 0))
+  #error "The telemetry data stream requires USE_UART = 1"
+#endif
+#if ((USE_PARAMETER_ACCESS == 1) && (USE_TELEMETRY == 0))
+  #error "The parameter access protocol requires USE_TELEMETRY = 1"
+#endif
+#if ((USE_FREQUENCY_RESPONSE_ANALYZER == 1) && (USE_PARAMETER_ACCESS == 0))
+  #error "The frequency response analyzer requires USE_PARAMETER_ACCESS = 1"
+#endif
+#if ((USE_SCOPE == 1) && (USE_PARAMETER_ACCESS == 0))
+  #error "The waveform capture requires USE_PARAMETER_ACCESS = 1"
+#endif
+
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_DEFERRED_CLOCK_STARTUP 0        // Slave core tick is coupled to the master core (no runtime time base)
+#else
+#define USE_DEFERRED_CLOCK_STARTUP 1        // This option enables/disables PLL lock polling by the boot task queue (see init_fosc.h)
+#endif
 
 #define USE_DEBUG_PIN		1       // This option enables/disables the Debug Pin
 #define DEBUG_PIN_MODE      DBG_MODE_GPIO   // This option selects the Debug Mode GPIO, DAC or PWM
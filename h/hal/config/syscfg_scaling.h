@@ -52,10 +52,7 @@
     #define VOUT_DIVIDER_R1             8200        // Resitance of upper voltage divider resistor in Ohm
     #define VOUT_DIVIDER_R2             2050        // Resitance of lower voltage divider resistor in Ohm
     #define VOUT_AMP_GAIN               1.000       // Gain factor or additional op-amp (set to 1.0 if none is used)
-    #define VOUT_SENSE_OFFSET           0.000       // Output voltage sense offset
-
-    #define VIN2VOUT_NORMALIZATION      0x7fff      //(int16_t)(ceiling(log(VOUT_DIVIDER_RATIO/VIN_DIVIDER_RATIO)))
-    #define VIN2VOUT_NORM_BSFT          1
+    #define VOUT_SENSE_OFFSET           0.000       // Output voltage sense offset (default until calibrated, see USE_SENSE_CALIBRATION)
 
     #define CS_AMP_GAIN                 20.000      // Current sense amplifier gain in [V/V]
     #define CS_SHUNT_RESISTANCE         10.0e-3     // Current sense resistor value in [Ohm]
@@ -63,10 +60,11 @@
     #define CS_COMMON_MODE_V_MIN        2.500       // Common mode minimum voltage at which the amplifier starts to provide an output signal
 
     #define IOUT_IS_BI_DIRECTIONAL      false       // Current sens is (0=uni-directional, 1=bi-directional)
-    #define IOUT_FEEDBACK_OFFSET        0.000       // Current sense zero offset 
+    #define IOUT_FEEDBACK_OFFSET        0.000       // Current sense zero offset (default until calibrated, see USE_SENSE_CALIBRATION)
 
     // System Settings
     #define SWITCHING_FREQUENCY         300e+3      // Nominal switching frequency per converter phase in [Hz]
+    #define CONVERTER_PHASES            1           // Number of interleaved converter phases (1...4)
     #define PWM_DEAD_TIME_RISING        20e-9       // Nominal dead time at the leading edge in [ns]
     #define PWM_DEAD_TIME_FALLING       60e-9       // Nominal dead time at the falling edge in [ns]
     #define LEADING_EDGE_BLANKING_PER   150e-9		// Leading Edge Blanking period in nanoseconds
@@ -97,10 +95,7 @@
     #define VOUT_DIVIDER_R1             8200        // Resitance of upper voltage divider resistor in Ohm
     #define VOUT_DIVIDER_R2             2050        // Resitance of lower voltage divider resistor in Ohm
     #define VOUT_AMP_GAIN               1.000       // Gain factor or additional op-amp (set to 1.0 if none is used)
-    #define VOUT_SENSE_OFFSET           0.000       // Output voltage sense offset
-
-    #define VIN2VOUT_NORMALIZATION      0x7fff      //(int16_t)(ceiling(log(VOUT_DIVIDER_RATIO/VIN_DIVIDER_RATIO)))
-    #define VIN2VOUT_NORM_BSFT          1
+    #define VOUT_SENSE_OFFSET           0.000       // Output voltage sense offset (default until calibrated, see USE_SENSE_CALIBRATION)
 
     #define CS_AMP_GAIN                 20.000      // Current sense amplifier gain in [V/V]
     #define CS_SHUNT_RESISTANCE         10.0e-3     // Current sense resistor value in [Ohm]
@@ -108,10 +103,11 @@
     #define CS_COMMON_MODE_V_MIN        2.500       // Common mode minimum voltage at which the amplifier starts to provide an output signal
 
     #define IOUT_IS_BI_DIRECTIONAL      false       // Current sens is (0=uni-directional, 1=bi-directional)
-    #define IOUT_FEEDBACK_OFFSET        0.000       // Current sense zero offset 
+    #define IOUT_FEEDBACK_OFFSET        0.000       // Current sense zero offset (default until calibrated, see USE_SENSE_CALIBRATION)
 
     // System Settings
     #define SWITCHING_FREQUENCY         300e+3      // Nominal switching frequency per converter phase in [Hz]
+    #define CONVERTER_PHASES            1           // Number of interleaved converter phases (1...4)
     #define PWM_DEAD_TIME_RISING        20e-9       // Nominal dead time at the leading edge in [ns]
     #define PWM_DEAD_TIME_FALLING       60e-9       // Nominal dead time at the falling edge in [ns]
     #define LEADING_EDGE_BLANKING_PER   150e-9		// Leading Edge Blanking period in nanoseconds
@@ -154,6 +150,30 @@
 #define PWM_DEAD_TIME_LE            ((uint16_t)((uint16_t)(((float)(PWM_DEAD_TIME_RISING))/((float)(T_ACLK))) >> PWM_PCLKDIV_PRIMARY) & REG_DTRx_VALID_BIT_MSK)
 #define PWM_DEAD_TIME_FE            ((uint16_t)((uint16_t)(((float)(PWM_DEAD_TIME_FALLING))/((float)(T_ACLK))) >> PWM_PCLKDIV_PRIMARY) & REG_ALTDTRx_VALID_BIT_MSK)
 
+// ADC reference and resolution used to translate feedback voltages into ADC ticks
+#ifndef ADC_SCALER
+#define ADC_REFERENCE               3.300       // ADC reference voltage in [V]
+#define ADC_RESOLUTION              12          // ADC resolution in [bit]
+#define ADC_SCALER                  (float)((float)(1 << ADC_RESOLUTION) / (float)ADC_REFERENCE) // ADC ticks per [V]
+#endif
+
+// Digital filter of the slow ADC channels (see init_adc.h)
+#define ADC_FILTER_NONE             0           // Slow channel results are read directly from the ADC buffers
+#define ADC_FILTER_OVERSAMPLING     1           // Hardware oversampling (4x/16x/64x/256x add 1/2/3/4 bits of resolution)
+#define ADC_FILTER_AVERAGING        2           // Hardware averaging (2x...256x, resolution remains unchanged)
+
+#define ADC_SLOW_FILTER_MODE        ADC_FILTER_OVERSAMPLING // Digital filter mode of the slow channels
+#define ADC_SLOW_FILTER_RATIO       16          // Number of conversions per filter result
+
+#if (ADC_SLOW_FILTER_MODE == ADC_FILTER_OVERSAMPLING)
+  #define ADC_SLOW_EXTRA_BITS       ((ADC_SLOW_FILTER_RATIO == 256) ? 4 : (ADC_SLOW_FILTER_RATIO == 64) ? 3 : \
+                                     (ADC_SLOW_FILTER_RATIO == 16) ? 2 : 1) // Additional bits of resolution
+#else
+  #define ADC_SLOW_EXTRA_BITS       0
+#endif
+#define ADC_SLOW_RESOLUTION         (ADC_RESOLUTION + ADC_SLOW_EXTRA_BITS) // Effective resolution of slow channels in [bit]
+#define ADC_SLOW_SCALER             (float)((float)(1UL << ADC_SLOW_RESOLUTION) / (float)ADC_REFERENCE) // Slow channel ticks per [V]
+
 // Macros calculating register values based on the physical values given above
 
 #define VIN_DIVIDER_RATIO           (float)((float)VIN_AMP_GAIN * ((float)VIN_DIVIDER_R2) / ((float)(VIN_DIVIDER_R1 + VIN_DIVIDER_R2)))
@@ -36,19 +36,23 @@
 #include <math.h>
 #include "_root/config/task_manager_config.h"
 #include "apl/config/tasks.h"
+#include "hal/config/syscfg_scaling.h"
 
 // Soft-Start Timing
 #define POWER_ON_DELAY   300.0e-3  // Power On Delay in [sec]
 #define RAMP_UP_PERIOD   50.0e-3  // Voltage Ramp-Up Period in [sec]
 #define POWER_GOOD_DELAY 100.0e-3  // Power Good Delay in [sec]
+#define RAMP_DOWN_PERIOD 20.0e-3  // Voltage Ramp-Down Period (soft-stop) in [sec]
 
-//#define POWER_ON_DELAY_TICKS    (uint16_t)(((float)POWER_ON_DELAY / (float)TASK_MGR_TIME_STEP)/ ((float)(task_queue_system_startup_size)))
-//#define RAMP_UP_PERIOD_TICKS    (uint16_t)(((float)RAMP_UP_PERIOD / (float)TASK_MGR_TIME_STEP) / ((float)(task_queue_system_startup_size)))
-//#define POWER_GOOD_DELAY_TICKS  (uint16_t)(((float)POWER_GOOD_DELAY / (float)TASK_MGR_TIME_STEP) / ((float)(task_queue_system_startup_size)))
+#define VOUT_PREBIAS_MINIMUM  0.500 // Output voltage above which the converter starts into a pre-biased output in [V]
 
-#define POWER_ON_DELAY_TICKS    (uint16_t)(((float)POWER_ON_DELAY / (float)TASK_MGR_TIME_STEP)/ ((float)(task_queue_ac_supply_size)))
-#define RAMP_UP_PERIOD_TICKS    (uint16_t)(((float)RAMP_UP_PERIOD / (float)TASK_MGR_TIME_STEP) / ((float)(task_queue_ac_supply_size)))
-#define POWER_GOOD_DELAY_TICKS  (uint16_t)(((float)POWER_GOOD_DELAY / (float)TASK_MGR_TIME_STEP) / ((float)(task_queue_ac_supply_size)))
+// Delays are counted in scheduler ticks by the soft-start task, independent of its position in the task queues
+#define POWER_ON_DELAY_TICKS    (uint16_t)((float)POWER_ON_DELAY / (float)TASK_MGR_TIME_STEP)
+#define POWER_GOOD_DELAY_TICKS  (uint16_t)((float)POWER_GOOD_DELAY / (float)TASK_MGR_TIME_STEP)
+
+// Ramps are executed by the control loop interrupt, which is called once per switching period
+#define RAMP_UP_PERIOD_TICKS    (uint32_t)((float)RAMP_UP_PERIOD * (float)SWITCHING_FREQUENCY) // Ramp-up period in control loop samples
+#define RAMP_DOWN_PERIOD_TICKS  (uint32_t)((float)RAMP_DOWN_PERIOD * (float)SWITCHING_FREQUENCY) // Ramp-down period in control loop samples
 
 
 #endif	/* _HARDWARE_ABSTRACTION_LAYER_SYSTEM_STARTUP_H_ */
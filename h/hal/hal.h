@@ -37,6 +37,7 @@
 
 #include "hal/config/syscfg_limits.h"
 #include "hal/config/syscfg_scaling.h"
+#include "hal/config/syscfg_fixpnt.h"
 #include "hal/config/syscfg_options.h"
 #include "hal/config/syscfg_startup.h"
 
@@ -44,7 +45,12 @@
 #include "hal/initialization/init_irq.h"
 #include "hal/initialization/init_dsp.h"
 #include "hal/initialization/init_timer.h"
+#include "hal/initialization/init_adc.h"
+#include "hal/initialization/init_pwm.h"
 #include "hal/initialization/init_fosc.h"
+#include "hal/initialization/init_uart.h"
+#include "hal/initialization/init_can.h"
+#include "hal/initialization/init_standby.h"
 
 
 
@@ -0,0 +1,195 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!init_adc.h
+ * *************************************************************************** 
+ * File:   init_adc.h
+ * Author: M91406
+ *
+ * Description:
+ * Configuration of the high-speed ADC acquisition pipeline. Fast channels are
+ * converted by dedicated ADC cores and raise the interrupt executing the related 
+ * control loop. Slow channels are converted by the shared ADC core without 
+ * interrupts and are collected by the acquisition task (see task_Acquisition.c).
+ * 
+ * All conversions are triggered by the PWM generator of the power converter. 
+ * Trigger positions are derived from ADC_TRIGGER_OFFSET (propagation delays of the
+ * feedback signals) and CS_PROPAGATION_DELAY (current sense signal phase shift) 
+ * declared in syscfg_scaling.h.
+ * 
+ * History:
+ * 10/14/26     Initial version
+ * ***************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_ADC_INITIALIZATION_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_ADC_INITIALIZATION_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/config/syscfg_scaling.h"
+#include "hal/initialization/init_pwm.h"
+    
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+// ADC trigger sources (TRGSRC) of PWM generator #1
+#define ADC_TRGSRC_NONE             0b00000     // No trigger enabled
+#define ADC_TRGSRC_PWM1_TRIG1       0b00100     // PWM Generator 1 ADC Trigger 1
+#define ADC_TRGSRC_PWM1_TRIG2       0b00101     // PWM Generator 1 ADC Trigger 2
+#define ADC_TRGSRC_PWM_TRIG2(n)     (ADC_TRGSRC_PWM1_TRIG2 + (((n)-1) << 1)) // PWM Generator n ADC Trigger 2
+
+/*!ADC Acquisition Settings
+ * ***********************************************************************************************
+ * Description:
+ * Fast channels are sampled in every switching period by PWM Trigger 2, which is driven by the
+ * trigger compare event PGxTRIGA placed at ADC_TRIG_OFFSET after the start of the period. 
+ * 
+ * Slow channels are sampled by PWM Trigger 1, which is driven by the trigger compare event 
+ * PGxTRIGB placed at ADC_TRIG_OFFSET + IOUT_PROPAGATION_DELAY. The PWM ADC Trigger 1 postscaler 
+ * reduces the sample rate of the slow channels to one scan every ADC_SLOW_TRIGGER_POSTSCALER + 1 
+ * switching periods. Slow channels do not raise interrupts.
+ * 
+ * Settings:
+ * - ADC_PWM_TRIGA/TRIGB/EVTL/EVTH: PWM generator registers used to trigger the ADC
+ * - ADC_FAST_VOUT_xxx: analog input, buffer and interrupt of the fast channel
+ * - ADC_FAST_VOUT_CORE: dedicated ADC core index or ADC_CORE_SHARED
+ * - ADC_SLOW_xxx: pin label (see board pinmap header) of each slow channel
+ * - ADC_SLOW_TRIGGER_POSTSCALER: number of switching periods skipped between two slow scans (0-31)
+ * 
+ * Digital Filters:
+ * When ADC_SLOW_FILTER_MODE (syscfg_scaling.h) is not ADC_FILTER_NONE, each slow channel is
+ * routed to one of the hardware digital filters of the ADC module. The filter accumulates 
+ * ADC_SLOW_FILTER_RATIO conversions into one result of ADC_SLOW_RESOLUTION bits without CPU 
+ * interaction. The acquisition task only processes one new value per filter period:
+ * 
+ *   update rate = SWITCHING_FREQUENCY / ((ADC_SLOW_TRIGGER_POSTSCALER + 1) * ADC_SLOW_FILTER_RATIO)
+ * 
+ * (e.g. 300 kHz / (8 * 16) = 2.3 kHz). As the noise is removed before the values are compared 
+ * against the limits in syscfg_limits.h, fault objects monitoring slow channels can use 
+ * shorter trip counts.
+ * 
+ * - ADC_SLOW_xxx_FILTER: digital filter index assigned to the slow channel
+ * 
+ * Phase Currents:
+ * When CONVERTER_PHASES is greater than 1, the current of each converter phase is sampled by 
+ * ADC Trigger 2 of the PWM generator of this phase at ADC_FAST_TRIGGER after its own start of 
+ * cycle. Phase currents are converted by the shared core without interrupts and are read by 
+ * the current sharing routine executed in the control loop interrupt (see multiphase.c).
+ * 
+ * - ADC_PHASE_CS_n: pin label of the current sense feedback of phase n
+ * 
+ * See also:
+ * ADC_TRIGGER_OFFSET, CS_PROPAGATION_DELAY, ADC_SLOW_FILTER_MODE in syscfg_scaling.h
+ * ***********************************************************************************************/
+
+#define ADC_PWM_TRIGA               PG1TRIGA    // PWM trigger compare register of fast channels
+#define ADC_PWM_TRIGB               PG1TRIGB    // PWM trigger compare register of slow channels
+#define ADC_PWM_EVTLbits            PG1EVTLbits // PWM event register (ADC Trigger 1 routing and postscaler)
+#define ADC_PWM_EVTHbits            PG1EVTHbits // PWM event register (ADC Trigger 2 routing)
+
+#define ADC_FAST_TRIGGER            (uint16_t)(ADC_TRIG_OFFSET) // Trigger position of fast channels in PWM ticks
+#define ADC_SLOW_TRIGGER            (uint16_t)(ADC_TRIG_OFFSET + (IOUT_PROPAGATION_DELAY >> PWM_PCLKDIV_PRIMARY)) // Trigger position of slow channels in PWM ticks
+#if (ADC_SLOW_FILTER_MODE == ADC_FILTER_NONE)
+#define ADC_SLOW_TRIGGER_POSTSCALER 31          // Slow channels are sampled every 32nd switching period
+#else
+#define ADC_SLOW_TRIGGER_POSTSCALER 7           // Slow channels are sampled every 8th switching period (decimated by the digital filter)
+#endif
+
+// Fast channel (interrupt driven, executes the output voltage control loop)
+#define ADC_FAST_VOUT_AN_INPUT      ECP12_ADC_AN_INPUT  // Output voltage feedback input number
+#define ADC_FAST_VOUT_ADCBUF        ECP12_ADCBUF        // ADC buffer register
+#define ADC_FAST_VOUT_IF            ECP12_ADC_IF        // Interrupt flag bit
+#define ADC_FAST_VOUT_IE            ECP12_ADC_IE        // Interrupt enable bit
+#define ADC_FAST_VOUT_IP            ECP12_ADC_IP        // Interrupt priority
+#define ADC_FAST_VOUT_ANIE          ECP12_ADC_ANIE      // ADC common interrupt enable bit
+#define ADC_FAST_VOUT_INIT_ANALOG   ECP12_INIT_ANALOG   // Analog pin initialization
+#define _ADC_FAST_VOUT_Interrupt    _ECP12_ADC_Interrupt // Interrupt vector
+
+// Slow channels (shared core, no interrupts)
+#if defined (__MA330048_P33CK_R30__)
+
+    #define ADC_FAST_VOUT_CORE          0           // Dedicated ADC core #0 (AN0)
+    
+    #define ADC_SLOW_VIN                ECP03       // Input voltage feedback
+    #define ADC_SLOW_IIN                ECP05       // Input current feedback
+    #define ADC_SLOW_IOUT               ECP04       // Output current feedback
+    #define ADC_SLOW_TEMP               ECP08       // Board temperature sensor
+
+#elif defined (__MA330045_P33CH_R10__)
+
+    #define ADC_FAST_VOUT_CORE          ADC_CORE_SHARED // Converted by the shared ADC core (AN3)
+    
+    #define ADC_SLOW_VIN                ECP03       // Input voltage feedback
+    #define ADC_SLOW_IIN                ECP05       // Input current feedback
+    #define ADC_SLOW_IOUT               ECP10       // Output current feedback
+    #define ADC_SLOW_TEMP               ECP14       // Board temperature sensor
+
+#endif
+
+// Phase current channels of interleaved converters (shared core, no interrupts)
+#if defined (__MA330048_P33CK_R30__)
+
+    #define ADC_PHASE_CS_1              ECP13       // Current sense feedback of phase #1
+    #define ADC_PHASE_CS_2              ECP15       // Current sense feedback of phase #2
+    #define ADC_PHASE_CS_3              ECP17       // Current sense feedback of phase #3
+    #define ADC_PHASE_CS_4              ECP18       // Current sense feedback of phase #4
+
+#elif defined (__MA330045_P33CH_R10__)
+
+    #define ADC_PHASE_CS_1              ECP13       // Current sense feedback of phase #1
+    #define ADC_PHASE_CS_2              ECP15       // Current sense feedback of phase #2
+    #define ADC_PHASE_CS_3              ECP06       // Current sense feedback of phase #3
+    #define ADC_PHASE_CS_4              ECP11       // Current sense feedback of phase #4
+
+#endif
+
+#define ADC_CORE_SHARED             0xFFFF      // Channel is converted by the shared ADC core
+
+// Digital filters of the slow channels
+#define ADC_SLOW_VIN_FILTER         0           // ADFL0CON/ADFL0DAT
+#define ADC_SLOW_IIN_FILTER         1           // ADFL1CON/ADFL1DAT
+#define ADC_SLOW_IOUT_FILTER        2           // ADFL2CON/ADFL2DAT
+#define ADC_SLOW_TEMP_FILTER        3           // ADFL3CON/ADFL3DAT
+
+#define ADC_FILTER_CON(x)           ADC_SLOW_CONCAT(ADC_SLOW_CONCAT(ADFL, x), CON) // Filter control register
+#define ADC_FILTER_DAT(x)           ADC_SLOW_CONCAT(ADC_SLOW_CONCAT(ADFL, x), DAT) // Filter result register
+#define ADC_FILTER_RDY              0x0100      // ADFLxCON: RDY (filter result ready)
+
+// Pin label concatenation helpers of the slow channel declarations
+#define ADC_SLOW_AN_INPUT(pin)      ADC_SLOW_CONCAT(pin, _ADC_AN_INPUT)
+#define ADC_SLOW_ADCBUF(pin)        ADC_SLOW_CONCAT(pin, _ADCBUF)
+#define ADC_SLOW_INIT_ANALOG(pin)   ADC_SLOW_CONCAT(pin, _INIT_ANALOG)
+#define ADC_SLOW_CONCAT(pin, item)  ADC_SLOW_CONCAT_(pin, item)
+#define ADC_SLOW_CONCAT_(pin, item) pin##item
+
+#define ADC_CORE_POWER_UP_TIMEOUT   5000        // Timeout counter of the ADC core power-up (polling loop) 
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile uint16_t init_adc(void);
+extern volatile uint16_t launch_adc(void);
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_ADC_INITIALIZATION_H_ */
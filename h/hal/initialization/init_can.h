@@ -0,0 +1,110 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!init_can.h
+ * *************************************************************************** 
+ * File:   init_can.h
+ * Author: M91406
+ *
+ * Description:
+ * Configuration of the CAN FD module used as rack-level status and command 
+ * interface. Message objects are located in a message RAM section in data 
+ * memory, which is read and written by the CAN FD module directly. The CPU 
+ * only copies the payload of one message object when a message is queued or 
+ * read, the module is operated without interrupts.
+ * 
+ * - FIFO1: transmit FIFO of CAN_TX_FIFO_DEPTH message objects of CAN_TX_PAYLOAD_SIZE bytes
+ * - FIFO2: receive FIFO of CAN_RX_FIFO_DEPTH message objects of CAN_RX_PAYLOAD_SIZE bytes 
+ *   receiving the standard frames accepted by filter 0 (CAN_ID_COMMAND) and filter 1 
+ *   (CAN_ID_COMMAND_BROADCAST)
+ * 
+ * The nominal (arbitration) bit rate is CAN_NOMINAL_BITRATE, the data phase bit rate is 
+ * CAN_DATA_BITRATE (bit rate switching). Bit timings are derived from CAN_CLOCK_FREQUENCY.
+ * 
+ * History:
+ * 10/14/26     Initial version
+ * ***************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_CAN_INITIALIZATION_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_CAN_INITIALIZATION_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+    
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+// Board specific pin assignment of the CAN transceiver (has to be adapted to the board in use)
+#define CAN_TX_RP                   46          // Number of Remappable Pin of CAN1 TX
+#define CAN_RX_RP                   47          // Number of Remappable Pin of CAN1 RX
+#define CAN_PPSOUT_C1TX             21          // PPS output function code of CAN1 TX (see device data sheet)
+#define CAN_PPSIN_C1RX              RPINR26bits.CAN1RXR // PPS input selection register of CAN1 RX
+
+// CAN FD clock and bit rates
+#define CAN_CLOCK_FREQUENCY         40000000UL  // CAN FD module clock in [Hz] (see CAN_CANCLKCON_INIT)
+#define CAN_NOMINAL_BITRATE         500000UL    // Nominal bit rate in [bit/s]
+#define CAN_DATA_BITRATE            2000000UL   // Data phase bit rate in [bit/s]
+#define CAN_NOMINAL_SAMPLE_POINT    0.8         // Nominal bit rate sample point
+#define CAN_DATA_SAMPLE_POINT       0.8         // Data phase bit rate sample point
+
+#define CAN_NOMINAL_TQ              (CAN_CLOCK_FREQUENCY / CAN_NOMINAL_BITRATE) // Time quanta per nominal bit (BRP = 1)
+#define CAN_NOMINAL_TSEG1           (uint16_t)((float)CAN_NOMINAL_TQ * CAN_NOMINAL_SAMPLE_POINT - 1) // Time quanta of PROP+PHSEG1
+#define CAN_NOMINAL_TSEG2           (uint16_t)(CAN_NOMINAL_TQ - 1 - CAN_NOMINAL_TSEG1) // Time quanta of PHSEG2
+#define CAN_DATA_TQ                 (CAN_CLOCK_FREQUENCY / CAN_DATA_BITRATE) // Time quanta per data phase bit (BRP = 1)
+#define CAN_DATA_TSEG1              (uint16_t)((float)CAN_DATA_TQ * CAN_DATA_SAMPLE_POINT - 1) // Time quanta of PROP+PHSEG1
+#define CAN_DATA_TSEG2              (uint16_t)(CAN_DATA_TQ - 1 - CAN_DATA_TSEG1) // Time quanta of PHSEG2
+
+// Message objects
+#define CAN_TX_FIFO_DEPTH           4           // Number of transmit message objects
+#define CAN_TX_PAYLOAD_SIZE         24          // Payload size of transmit message objects in bytes
+#define CAN_TX_PLSIZE               0b100       // FIFO payload size setting of 24 bytes
+#define CAN_RX_FIFO_DEPTH           4           // Number of receive message objects
+#define CAN_RX_PAYLOAD_SIZE         8           // Payload size of receive message objects in bytes
+#define CAN_RX_PLSIZE               0b000       // FIFO payload size setting of 8 bytes
+#define CAN_MSG_HEADER_SIZE         8           // Size of message object headers in bytes
+
+#define CAN_MESSAGE_RAM_SIZE        ((CAN_TX_FIFO_DEPTH * (CAN_MSG_HEADER_SIZE + CAN_TX_PAYLOAD_SIZE)) + \
+                                    (CAN_RX_FIFO_DEPTH * (CAN_MSG_HEADER_SIZE + CAN_RX_PAYLOAD_SIZE)))
+
+// Node addressing
+#define CAN_NODE_ID                 0x01        // Node address of this converter in the rack (1 ... 127)
+#define CAN_ID_STATUS_BASE          0x100       // Standard ID base of status messages
+#define CAN_ID_COMMAND_BASE         0x200       // Standard ID base of command messages
+#define CAN_ID_STATUS               (CAN_ID_STATUS_BASE + CAN_NODE_ID)  // Standard ID of status messages sent by this node
+#define CAN_ID_COMMAND              (CAN_ID_COMMAND_BASE + CAN_NODE_ID) // Standard ID of command messages to this node
+#define CAN_ID_COMMAND_BROADCAST    (CAN_ID_COMMAND_BASE)               // Standard ID of command messages to all nodes
+
+#define CAN_MODE_TIMEOUT            5000        // Timeout of operating mode switch-overs in polling loop cycles
+
+extern volatile uint16_t can_message_ram[CAN_MESSAGE_RAM_SIZE >> 1]; // Message object RAM accessed by the CAN FD module
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile uint16_t init_can(void);
+extern volatile uint16_t can_Transmit(volatile uint16_t sid, volatile uint8_t* data, volatile uint16_t length);
+extern volatile uint16_t can_Receive(volatile uint16_t* sid, volatile uint8_t* data, volatile uint16_t* length);
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_CAN_INITIALIZATION_H_ */
@@ -34,11 +34,66 @@
 #include <stdint.h>
 #include "mcal/mcal.h"
 
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+/*!Deferred Clock Startup
+ * ***********************************************************************************************
+ * When USE_DEFERRED_CLOCK_STARTUP is enabled, CLOCK_Initialize() only configures the main PLL 
+ * and the auxiliary PLL, requests the CPU oscillator switch-over to FRC+PLL and returns without 
+ * waiting for any PLL to lock. Both PLLs lock in parallel while the scheduler starts up and 
+ * executes the boot task queue at the FRC clock. 
+ * 
+ * The boot task TASK_LAUNCH_OSCILLATOR polls the switch-over and the auxiliary PLL lock once 
+ * per scheduler tick, holding the boot task queue at its position until both are completed. 
+ * As soon as the CPU runs at FRC+PLL, the system frequencies and the scheduler time base are
+ * updated to the new CPU clock. The device startup task queue, which initializes the PWM and 
+ * ADC modules clocked by the auxiliary PLL, is only loaded after both PLLs have locked.
+ * 
+ * The PLL settings below have to match the settings used by init_oscillator() and 
+ * init_aux_oscillator(), which are still used when USE_DEFERRED_CLOCK_STARTUP = 0 and during 
+ * warm boots.
+ * ***********************************************************************************************/
+
+#define OSC_FRC_FREQUENCY           8000000UL   // Nominal FRC oscillator frequency in [Hz]
+
+#if defined (__P33SMPS_CK__) || defined (__P33SMPS_CH_SLV__)
+#define OSC_DEFERRED_PLL_M          100         // PLL feedback divider (FVCO = 800 MHz, FOSC = 200 MHz, 100 MIPS)
+#else
+#define OSC_DEFERRED_PLL_M          90          // PLL feedback divider (FVCO = 720 MHz, FOSC = 180 MHz, 90 MIPS)
+#endif
+#define OSC_DEFERRED_PLL_N1         1           // PLL input (prescaler) divider
+#define OSC_DEFERRED_PLL_N2         2           // PLL output divider #1
+#define OSC_DEFERRED_PLL_N3         1           // PLL output divider #2
+
+#define OSC_DEFERRED_APLL_M         125         // Auxiliary PLL feedback divider (AFVCO = 1000 MHz)
+#define OSC_DEFERRED_APLL_N1        1           // Auxiliary PLL input (prescaler) divider
+#define OSC_DEFERRED_APLL_N2        2           // Auxiliary PLL output divider #1 (AFPLLO = 500 MHz)
+#define OSC_DEFERRED_APLL_N3        1           // Auxiliary PLL output divider #2
+
+#define OSC_NOSC_FRCPLL             0b001       // New oscillator selection: FRC oscillator with PLL
+
+#define OSC_DEFERRED_TIMEOUT        100         // Maximum number of scheduler ticks TASK_LAUNCH_OSCILLATOR waits for both PLLs
+
+typedef struct {
+    volatile uint16_t main_ready; // Flag indicating the CPU oscillator switch-over to FRC+PLL has completed
+    volatile uint16_t aux_ready; // Flag indicating the auxiliary PLL has locked
+    volatile uint16_t main_ticks; // Number of scheduler ticks until the CPU oscillator switch-over has completed
+    volatile uint16_t aux_ticks; // Number of scheduler ticks until the auxiliary PLL has locked
+    volatile uint16_t ticks; // Number of scheduler ticks TASK_LAUNCH_OSCILLATOR has been waiting
+} __attribute__((packed))OSC_STARTUP_t;
+
+extern volatile OSC_STARTUP_t osc_startup;
+
 /* ***********************************************************************************************
  * PROTOTYPES
  * ***********************************************************************************************/
 extern volatile uint16_t init_oscillator(void);
 extern volatile uint16_t init_aux_oscillator(void);
+extern volatile uint16_t init_oscillator_deferred(void);
+extern volatile uint16_t init_aux_oscillator_deferred(void);
+extern volatile uint16_t launch_oscillator(void);
 
 #endif	/* _HARDWARE_ABSTRACTION_LAYER_OSCILLATOR_INITIALIZATION_H_ */
 
@@ -0,0 +1,149 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!init_pwm.h
+ * *************************************************************************** 
+ * File:   init_pwm.h
+ * Author: M91406
+ *
+ * Description:
+ * Configuration of the high-resolution PWM generator driving the power converter. All 
+ * register values are derived at compile time from the switching timing constants declared 
+ * in syscfg_scaling.h (SWITCHING_FREQUENCY, PWM_DEAD_TIME_RISING/FALLING, 
+ * LEADING_EDGE_BLANKING_PER, T_ACLK) and the duty ratio limits declared in syscfg_limits.h. 
+ * No floating point operation is executed at runtime.
+ * 
+ * History:
+ * 10/14/26     Initial version
+ * ***************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_PWM_INITIALIZATION_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_PWM_INITIALIZATION_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/config/syscfg_scaling.h"
+#include "hal/config/syscfg_limits.h"
+    
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+/*!PWM Generator Settings
+ * ***********************************************************************************************
+ * Description:
+ * The PWM generator runs in independent edge mode with complementary outputs, clocked by the 
+ * auxiliary PLL output (AFPLLO) in high-resolution mode (250 ps per tick). 
+ * 
+ * Duty cycle updates:
+ * PWM_DUTY_CYCLE is the only register written by the control loop. The update trigger of the 
+ * generator is set to 'write of PGxDC', which sets the update request bit automatically while 
+ * the update mode 'SOC update' latches the new value at the start of the next switching period. 
+ * A duty cycle update is therefore a single register write without read-modify-write of 
+ * status bits and without risk of mixing old and new timing values within one cycle.
+ * 
+ * Outputs:
+ * init_pwm() enables the output override with both outputs driven low. launch_pwm() starts
+ * the generator, which generates the ADC triggers, while the outputs remain overridden until 
+ * PWM_OUTPUTS_RELEASE is executed.
+ * 
+ * - PWM_PERIOD: switching period in PWM ticks
+ * - PWM_DUTY_CYCLE_INIT/MIN/MAX: initial duty cycle and clamping limits in PWM ticks
+ * - PWM_DEAD_TIME_H/L: dead time at the rising/falling edge of the PWMxH output in PWM ticks
+ * - PWM_LEB_PERIOD: leading edge blanking period in PWM ticks
+ * 
+ * Interleaving:
+ * When CONVERTER_PHASES (syscfg_scaling.h) is greater than 1, one PWM generator is configured
+ * per converter phase (see PWM_PHASE_GENERATOR_n). The generator of phase #1 is self-triggered, 
+ * each following generator is started by the PGxTRIGC compare event of the generator of the 
+ * previous phase. The phase shift between two neighboring phases is therefore set by a single 
+ * register (PGxTRIGC of the preceding phase), which allows the phase shift to be changed at 
+ * runtime when phases are shed (see multiphase.c).
+ * 
+ * - PWM_PHASE_SHIFT: nominal phase shift between neighboring phases in PWM ticks
+ * - PWM_PGx(reg, n): access to register 'reg' of PWM generator n (e.g. PWM_PGx(DC, 2) = PG2DC)
+ * 
+ * See also:
+ * SWITCHING_PERIOD, PWM_DEAD_TIME_LE, PWM_DEAD_TIME_FE, LEB_PERIOD in syscfg_scaling.h
+ * DUTY_RATIO_INIT_REG, DUTY_RATIO_MIN_REG, DUTY_RATIO_MAX_REG in syscfg_limits.h
+ * ***********************************************************************************************/
+
+#if defined (__MA330048_P33CK_R30__)
+    #define PWM_CHANNEL             ECP45_PGx_CHANNEL   // PWM generator index
+    #define PWM_PERIOD_REGISTER     ECP45_PGx_PER       // PWM generator period register
+    #define PWM_PHASE_REGISTER      ECP45_PGx_PHASE     // PWM generator phase register
+    #define PWM_DUTY_CYCLE          ECP45_PGx_DC        // PWM generator duty cycle register
+#elif defined (__MA330045_P33CH_R10__)
+    #define PWM_CHANNEL             ECP35_PGx_CHANNEL   // PWM generator index
+    #define PWM_PERIOD_REGISTER     ECP35_PGx_PER       // PWM generator period register
+    #define PWM_PHASE_REGISTER      ECP35_PGx_PHASE     // PWM generator phase register
+    #define PWM_DUTY_CYCLE          ECP35_PGx_DC        // PWM generator duty cycle register
+#endif
+
+#define PWM_PERIOD                  (uint16_t)(SWITCHING_PERIOD) // Switching period in PWM ticks
+#define PWM_PHASE                   0           // Phase register setting in PWM ticks
+#define PWM_PHASE_SHIFT             (uint16_t)(PWM_PERIOD / CONVERTER_PHASES) // Phase shift between neighboring phases in PWM ticks
+#define PWM_DUTY_CYCLE_INIT         (uint16_t)(DUTY_RATIO_INIT_REG) // Initial duty cycle in PWM ticks
+#define PWM_DUTY_CYCLE_MIN          (uint16_t)(DUTY_RATIO_MIN_REG + (PWM_DEAD_TIME_LE + PWM_DEAD_TIME_FE)) // Minimum duty cycle in PWM ticks
+#define PWM_DUTY_CYCLE_MAX          (uint16_t)(DUTY_RATIO_MAX_REG) // Maximum duty cycle in PWM ticks
+#define PWM_DEAD_TIME_H             (uint16_t)(PWM_DEAD_TIME_LE) // Dead time at the rising edge of PWMxH
+#define PWM_DEAD_TIME_L             (uint16_t)(PWM_DEAD_TIME_FE) // Dead time at the falling edge of PWMxH
+#define PWM_LEB_PERIOD              (uint16_t)(LEB_PERIOD) // Leading edge blanking period in PWM ticks
+
+// Output override of the PWM generator (single register writes)
+#define PWM_OUTPUTS_HOLD            { PG1IOCONL |= PWM_IOCONL_OVREN; }   // Override both outputs to LOW
+#define PWM_OUTPUTS_RELEASE         { PG1IOCONL &= ~PWM_IOCONL_OVREN; }  // Hand outputs over to the PWM generator
+#define PWM_IOCONL_OVREN            0x3000      // PGxIOCONL: OVRENH | OVRENL
+
+// PWM generators of the interleaved converter phases
+#if defined (__MA330048_P33CK_R30__)
+    #define PWM_PHASE_GENERATOR_1   PWM_CHANNEL         // PWM generator of phase #1
+    #define PWM_PHASE_GENERATOR_2   ECP40_PGx_CHANNEL   // PWM generator of phase #2
+    #define PWM_PHASE_GENERATOR_3   ECP37_PGx_CHANNEL   // PWM generator of phase #3
+    #define PWM_PHASE_GENERATOR_4   ECP43_PGx_CHANNEL   // PWM generator of phase #4
+#elif defined (__MA330045_P33CH_R10__)
+    #define PWM_PHASE_GENERATOR_1   PWM_CHANNEL         // PWM generator of phase #1
+    #define PWM_PHASE_GENERATOR_2   2                   // PWM generator of phase #2
+    #define PWM_PHASE_GENERATOR_3   3                   // PWM generator of phase #3
+    #define PWM_PHASE_GENERATOR_4   4                   // PWM generator of phase #4
+#endif
+
+#if ((CONVERTER_PHASES < 1) || (CONVERTER_PHASES > 4))
+  #error === CONVERTER_PHASES is out of range (1...4) ===
+#endif
+
+// Access to the registers of PWM generator n by generator index (1, 2, 3, ...)
+#define PWM_PG_REG_OFFSET           0x0028      // PG1CONL to PG2CONL (80 bytes)
+#define PWM_PGx(reg, n)             (*((volatile uint16_t*)&PG1##reg + (((n)-1) * PWM_PG_REG_OFFSET)))
+#define PWM_STAT_UPDREQ             0x0008      // PGxSTAT: UPDREQ (latch new timing at next SOC)
+
+#define PWM_HRRDY_TIMEOUT           5000        // Timeout counter of the high-resolution clock ready polling loop
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile uint16_t init_pwm(void);
+extern volatile uint16_t launch_pwm(void);
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_PWM_INITIALIZATION_H_ */
@@ -0,0 +1,136 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!init_standby.h
+ * *************************************************************************** 
+ * File:   init_standby.h
+ * Author: M91406
+ *
+ * Description:
+ * Low-power standby manager. When OP_MODE_STANDBY is entered, standby_Enter() steps the CPU 
+ * down from FRC+PLL to the internal FRC oscillator without PLL (FOSC = 8 MHz, FCY = 4 MHz), 
+ * optionally stops the auxiliary PLL and gates peripherals not used in standby by setting 
+ * their Peripheral Module Disable (PMD) bits. The system frequencies, the baud rate of the 
+ * telemetry UART and the scheduler time base are re-derived at the new CPU clock.
+ * 
+ * When the task manager leaves OP_MODE_STANDBY, standby_Exit() reverses these steps before 
+ * the new operation mode is loaded. All oscillator and PLL lock polling loops are bounded by 
+ * STANDBY_WAKEUP_TIMEOUT and the number of polling cycles of the most recent and the slowest 
+ * wake-up is captured in standby_status.
+ * 
+ * Please note:
+ * - Peripherals gated by STANDBY_PMD_REGISTRY lose all their register settings. Peripherals 
+ *   used in other operation modes therefore have to declare an initialization function, which
+ *   is called after the PMD bit has been released again.
+ * - The auxiliary PLL is the clock source of the PWM and ADC modules. When it is stopped 
+ *   (STANDBY_STOP_AUX_PLL = 1), PWM outputs and ADC conversions are halted and analog values 
+ *   remain frozen at their most recent sample until the system wakes up.
+ * - Peripherals clocked by FP other than the telemetry UART are not re-configured.
+ * 
+ * History:
+ * 10/14/26     Initial version
+ * ***************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_STANDBY_INITIALIZATION_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_STANDBY_INITIALIZATION_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "mcal/mcal.h"
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_selftest.h"
+    
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+/*!USE_STANDBY_POWER_MANAGER
+ * ***********************************************************************************************
+ * Enables/disables clock scaling and peripheral module disable in OP_MODE_STANDBY. The slave 
+ * core of dual core devices is clocked by its own PLL, which is not managed by this module.
+ * ***********************************************************************************************/
+#if defined (__P33SMPS_CH_SLV__)
+#define USE_STANDBY_POWER_MANAGER       0
+#else
+#define USE_STANDBY_POWER_MANAGER       1
+#endif
+
+#define STANDBY_STOP_AUX_PLL            1           // 1 = auxiliary PLL is stopped in standby (halts PWM and ADC)
+#define STANDBY_WAKEUP_TIMEOUT          5000        // Timeout of oscillator switch-over and PLL lock in polling loop cycles
+
+#define STANDBY_NOSC_FRC                0b000       // New oscillator selection: FRC oscillator without PLL
+#define STANDBY_NOSC_FRCPLL             0b001       // New oscillator selection: FRC oscillator with PLL
+
+/*!STANDBY_PMD_REGISTRY
+ * ***********************************************************************************************
+ * Peripherals gated while the system is in standby, declared as PMD(bit, init) with
+ * 
+ *  - bit:  Peripheral Module Disable bit of the peripheral
+ *  - init: initialization function called after the peripheral has been released (NULL = none)
+ * 
+ * The default list covers peripherals not used by this firmware. Peripherals used in other 
+ * operation modes have to declare their initialization function, e.g.
+ * 
+ *  PMD(PMD1bits.U1MD, init_uart)
+ * 
+ * Bit names are device specific (see device data sheet, section Peripheral Module Disable).
+ * ***********************************************************************************************/
+#if (USE_TASK_MANAGER_SELF_TEST == 1) && (TASK_MGR_SELF_TEST_FLASH == 1) && (TASK_MGR_SELF_TEST_HW_CRC == 1)
+  #define STANDBY_PMD_CRC_INIT          task_SelfTestCrcRestart // CRC module is used by the run-time flash CRC
+#else
+  #define STANDBY_PMD_CRC_INIT          NULL
+#endif
+
+#define STANDBY_PMD_REGISTRY(PMD) \
+    PMD(PMD1bits.SPI1MD,    NULL)   /* SPI #1 */ \
+    PMD(PMD1bits.SPI2MD,    NULL)   /* SPI #2 */ \
+    PMD(PMD1bits.I2C1MD,    NULL)   /* I2C #1 */ \
+    PMD(PMD3bits.CRCMD,     STANDBY_PMD_CRC_INIT)   /* CRC generator */ \
+    PMD(PMD7bits.PTGMD,     NULL)   /* Peripheral trigger generator */ \
+    PMD(PMD8bits.CLC1MD,    NULL)   /* Configurable logic cell #1 */
+
+#if (USE_STANDBY_POWER_MANAGER == 1)
+
+typedef struct {
+    volatile uint16_t active; // Flag indicating the CPU is running at the standby clock
+    volatile uint16_t entries; // Number of standby entries
+    volatile uint16_t exits; // Number of standby exits
+    volatile uint16_t timeouts; // Number of oscillator switch-overs or PLL locks that timed out
+    volatile uint16_t switch_polls; // Polling cycles of the most recent oscillator switch-over to FRC+PLL
+    volatile uint16_t switch_polls_max; // Polling cycles of the slowest oscillator switch-over to FRC+PLL
+    volatile uint16_t apll_polls; // Polling cycles of the most recent auxiliary PLL lock
+    volatile uint16_t apll_polls_max; // Polling cycles of the slowest auxiliary PLL lock
+} __attribute__((packed))STANDBY_STATUS_t;
+
+extern volatile STANDBY_STATUS_t standby_status;
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile uint16_t standby_Enter(void);
+extern volatile uint16_t standby_Exit(void);
+
+#endif  /* USE_STANDBY_POWER_MANAGER */
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_STANDBY_INITIALIZATION_H_ */
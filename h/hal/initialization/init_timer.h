@@ -32,6 +32,8 @@
 
 #include <xc.h>
 #include <stdint.h>
+
+#include "_root/config/task_manager_config.h"
     
 /* ***********************************************************************************************
  * PROTOTYPES
@@ -39,5 +41,20 @@
 extern uint16_t init_system_timer(void);
 extern uint16_t launch_system_timer(void);
 
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+extern uint16_t init_rt_tier_timer(void);
+extern uint16_t launch_rt_tier_timer(void);
+#endif
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+extern uint16_t init_bench_timer(void);
+extern uint16_t launch_bench_timer(void);
+#endif
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+extern uint16_t init_boot_timer(void);
+extern uint16_t launch_boot_timer(void);
+#endif
+
 #endif	/* _HARDWARE_ABSTRACTION_LAYER_SYSTEM_TIMER_H_ */
 
@@ -0,0 +1,100 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!init_uart.h
+ * *************************************************************************** 
+ * File:   init_uart.h
+ * Author: M91406
+ *
+ * Description:
+ * Configuration of the UART transmitter used for the telemetry data stream. 
+ * Transmit data is moved from RAM into the UART transmit buffer by a DMA 
+ * channel triggered by the UART transmit interrupt. Once a transfer has been 
+ * started by uart_DmaTransmit(), the CPU is not involved until the frame has 
+ * been sent.
+ * 
+ * - UART_BAUDRATE: baud rate of the telemetry UART (8 data bits, no parity, 1 stop bit)
+ * - UART_DMA_xxx: DMA channel moving transmit data into the UART transmit buffer
+ * - UART_DMA_RX_xxx: DMA channel moving received data into a ring buffer in RAM. The channel 
+ *   reloads its destination address when the end of the ring buffer has been reached and runs
+ *   continuously. The write position is read from the DMA destination address register 
+ *   (see uart_DmaRxPosition()).
+ * 
+ * History:
+ * 10/14/26     Initial version
+ * ***************************************************************************/
+
+#ifndef _HARDWARE_ABSTRACTION_LAYER_UART_INITIALIZATION_H_
+#define	_HARDWARE_ABSTRACTION_LAYER_UART_INITIALIZATION_H_
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+    
+/* ***********************************************************************************************
+ * DECLARATIONS
+ * ***********************************************************************************************/
+
+#define UART_BAUDRATE               1000000     // Telemetry UART baud rate in [baud]
+
+// UART module (pins are assigned by init_gpio())
+#define UART_MODE                   U1MODE      // UART mode register
+#define UART_MODEH                  U1MODEH     // UART mode register high
+#define UART_STAH                   U1STAH      // UART status register high
+#define UART_BRG                    U1BRG       // UART baud rate generator register
+#define UART_TXREG                  U1TXREG     // UART transmit buffer register
+
+// DMA channel
+#define UART_DMA_CH                 DMACH0bits  // DMA channel control register
+#define UART_DMA_INT                DMAINT0bits // DMA channel interrupt control register
+#define UART_DMA_SRC                DMASRC0     // DMA channel source address register
+#define UART_DMA_DST                DMADST0     // DMA channel destination address register
+#define UART_DMA_CNT                DMACNT0     // DMA channel transaction counter register
+#define UART_DMA_TRIGGER            0x000C      // DMA channel trigger source: UART1 transmitter (see device data sheet)
+
+// DMA receive channel
+#define UART_DMA_RX_CH              DMACH1bits  // DMA channel control register
+#define UART_DMA_RX_INT             DMAINT1bits // DMA channel interrupt control register
+#define UART_DMA_RX_SRC             DMASRC1     // DMA channel source address register
+#define UART_DMA_RX_DST             DMADST1     // DMA channel destination address register
+#define UART_DMA_RX_CNT             DMACNT1     // DMA channel transaction counter register
+#define UART_DMA_RX_TRIGGER         0x000B      // DMA channel trigger source: UART1 receiver (see device data sheet)
+#define UART_RXREG                  U1RXREG     // UART receive buffer register
+
+#define UART_RX_BUFFER_SIZE         128         // Size of the receive ring buffer in bytes
+
+#define UART_DMA_RAM_START          0x1000      // Lower limit of the RAM address range accessible by the DMA
+#define UART_DMA_RAM_END            0xFFFF      // Upper limit of the RAM address range accessible by the DMA
+
+#define UART_DMA_BUSY               (UART_DMA_CH.CHEN) // DMA channel is transmitting a frame
+
+/* ***********************************************************************************************
+ * PROTOTYPES
+ * ***********************************************************************************************/
+extern volatile uint16_t init_uart(void);
+extern volatile uint16_t uart_DmaTransmit(volatile uint8_t* buffer, volatile uint16_t length);
+extern volatile uint16_t uart_DmaRxPosition(void);
+
+extern volatile uint8_t uart_rx_buffer[UART_RX_BUFFER_SIZE]; // Receive ring buffer written by the DMA
+
+#endif	/* _HARDWARE_ABSTRACTION_LAYER_UART_INITIALIZATION_H_ */
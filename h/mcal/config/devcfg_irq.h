@@ -67,6 +67,125 @@
                             REG_INTCON3_STAT_APLL_CLEAR \
                             )
 
+/*!Interrupt Priority Plan
+ * *****************************************************************************************************
+ * Description:
+ * Interrupt priority levels of all interrupt service routines and the context save method 
+ * derived from them. Higher numbers are higher priorities (1...7). 
+ * 
+ * Interrupt service routines running at the level assigned to an alternate working register 
+ * set (configuration bits CTXT1/CTXT2) are declared with attribute 'context'. No working 
+ * registers are saved or restored on entry and exit. At the level assigned to the shadow 
+ * registers, attribute 'shadow' saves W0...W3 and SR within one cycle (PUSH.S/POP.S). All other 
+ * levels use the standard context save. The attribute of each class is provided by 
+ * IRQ_CONTEXT_SAVE_<class> for the interrupt service routine declaration.
+ * 
+ * ISRs running on an alternate register set or the shadow registers are considered 'fast'. 
+ * Since the shadow registers are one level deep and each alternate register set is bound to 
+ * one priority level, no two interrupt classes may share a fast priority level. This rule is
+ * checked at compile time. Sharing one level would also add the execution time of the other 
+ * ISR to the entry latency of the control loop.
+ * 
+ * Please note:
+ * IRQ_CONTEXT_1_IPL and IRQ_CONTEXT_2_IPL have to match the configuration bits CTXT1 and CTXT2
+ * (see config_bits_P33CK.c/config_bits_P33CH.c). Levels set to 0 are not assigned.
+ * 
+ * See also:
+ * TASK_MGR_ISR_PRIORITY, RT_TIER_ISR_PRIORITY, CVMC_VOUT_ISR_PRIORITY
+ * *****************************************************************************************************/
+
+#define IRQ_PRIORITY_SCHEDULER       1       // Task manager scheduler timer (interrupt scheduler mode)
+#define IRQ_PRIORITY_COMMS           2       // Communication interfaces (UART, CAN)
+#define IRQ_PRIORITY_RT_TIER         3       // Real-time task tier timer
+#define IRQ_PRIORITY_ACQUISITION     4       // Slow ADC channel acquisition
+#define IRQ_PRIORITY_CONTROL         5       // Control loop ADC interrupts
+
+#define IRQ_CONTEXT_1_IPL               5       // IPL of alternate working register set #1 (CTXT1 = IPL5)
+#define IRQ_CONTEXT_2_IPL               0       // IPL of alternate working register set #2 (CTXT2 = OFF)
+#define IRQ_SHADOW_IPL                  3       // IPL using the shadow registers (0 = none)
+
+#define IRQ_IPL_ALTERNATE_SET(ipl)      (((ipl) == IRQ_CONTEXT_1_IPL) || ((ipl) == IRQ_CONTEXT_2_IPL))
+#define IRQ_IPL_SHADOW(ipl)             (((ipl) == IRQ_SHADOW_IPL) && !IRQ_IPL_ALTERNATE_SET(ipl))
+#define IRQ_IPL_FAST(ipl)               (IRQ_IPL_ALTERNATE_SET(ipl) || IRQ_IPL_SHADOW(ipl))
+
+// Context save attributes of each interrupt class
+#if IRQ_IPL_ALTERNATE_SET(IRQ_PRIORITY_SCHEDULER)
+  #define IRQ_CONTEXT_SAVE_SCHEDULER    context,    // Alternate working register set
+#elif IRQ_IPL_SHADOW(IRQ_PRIORITY_SCHEDULER)
+  #define IRQ_CONTEXT_SAVE_SCHEDULER    shadow,     // Shadow registers
+#else
+  #define IRQ_CONTEXT_SAVE_SCHEDULER                // Standard context save
+#endif
+#if IRQ_IPL_ALTERNATE_SET(IRQ_PRIORITY_COMMS)
+  #define IRQ_CONTEXT_SAVE_COMMS        context,    // Alternate working register set
+#elif IRQ_IPL_SHADOW(IRQ_PRIORITY_COMMS)
+  #define IRQ_CONTEXT_SAVE_COMMS        shadow,     // Shadow registers
+#else
+  #define IRQ_CONTEXT_SAVE_COMMS                // Standard context save
+#endif
+#if IRQ_IPL_ALTERNATE_SET(IRQ_PRIORITY_RT_TIER)
+  #define IRQ_CONTEXT_SAVE_RT_TIER      context,    // Alternate working register set
+#elif IRQ_IPL_SHADOW(IRQ_PRIORITY_RT_TIER)
+  #define IRQ_CONTEXT_SAVE_RT_TIER      shadow,     // Shadow registers
+#else
+  #define IRQ_CONTEXT_SAVE_RT_TIER                // Standard context save
+#endif
+#if IRQ_IPL_ALTERNATE_SET(IRQ_PRIORITY_ACQUISITION)
+  #define IRQ_CONTEXT_SAVE_ACQUISITION  context,    // Alternate working register set
+#elif IRQ_IPL_SHADOW(IRQ_PRIORITY_ACQUISITION)
+  #define IRQ_CONTEXT_SAVE_ACQUISITION  shadow,     // Shadow registers
+#else
+  #define IRQ_CONTEXT_SAVE_ACQUISITION                // Standard context save
+#endif
+#if IRQ_IPL_ALTERNATE_SET(IRQ_PRIORITY_CONTROL)
+  #define IRQ_CONTEXT_SAVE_CONTROL      context,    // Alternate working register set
+#elif IRQ_IPL_SHADOW(IRQ_PRIORITY_CONTROL)
+  #define IRQ_CONTEXT_SAVE_CONTROL      shadow,     // Shadow registers
+#else
+  #define IRQ_CONTEXT_SAVE_CONTROL                // Standard context save
+#endif
+
+// Static checks of the priority plan
+#if (IRQ_CONTEXT_1_IPL > 7) || (IRQ_CONTEXT_2_IPL > 7) || (IRQ_SHADOW_IPL > 7)
+  #error === alternate register set and shadow register levels have to be within 0...7 ===
+#endif
+#if (IRQ_CONTEXT_1_IPL != 0) && (IRQ_CONTEXT_1_IPL == IRQ_CONTEXT_2_IPL)
+  #error === alternate working register sets #1 and #2 are assigned to the same priority level ===
+#endif
+#if (IRQ_PRIORITY_SCHEDULER == 0) || (IRQ_PRIORITY_CONTROL > 7)
+  #error === interrupt priorities have to be within 1...7 ===
+#endif
+#if (IRQ_PRIORITY_SCHEDULER == IRQ_PRIORITY_COMMS) && IRQ_IPL_FAST(IRQ_PRIORITY_SCHEDULER)
+  #error === SCHEDULER and COMMS interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_SCHEDULER == IRQ_PRIORITY_RT_TIER) && IRQ_IPL_FAST(IRQ_PRIORITY_SCHEDULER)
+  #error === SCHEDULER and RT_TIER interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_SCHEDULER == IRQ_PRIORITY_ACQUISITION) && IRQ_IPL_FAST(IRQ_PRIORITY_SCHEDULER)
+  #error === SCHEDULER and ACQUISITION interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_SCHEDULER == IRQ_PRIORITY_CONTROL) && IRQ_IPL_FAST(IRQ_PRIORITY_SCHEDULER)
+  #error === SCHEDULER and CONTROL interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_COMMS == IRQ_PRIORITY_RT_TIER) && IRQ_IPL_FAST(IRQ_PRIORITY_COMMS)
+  #error === COMMS and RT_TIER interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_COMMS == IRQ_PRIORITY_ACQUISITION) && IRQ_IPL_FAST(IRQ_PRIORITY_COMMS)
+  #error === COMMS and ACQUISITION interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_COMMS == IRQ_PRIORITY_CONTROL) && IRQ_IPL_FAST(IRQ_PRIORITY_COMMS)
+  #error === COMMS and CONTROL interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_RT_TIER == IRQ_PRIORITY_ACQUISITION) && IRQ_IPL_FAST(IRQ_PRIORITY_RT_TIER)
+  #error === RT_TIER and ACQUISITION interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_RT_TIER == IRQ_PRIORITY_CONTROL) && IRQ_IPL_FAST(IRQ_PRIORITY_RT_TIER)
+  #error === RT_TIER and CONTROL interrupts contend at the same fast interrupt priority level ===
+#endif
+#if (IRQ_PRIORITY_ACQUISITION == IRQ_PRIORITY_CONTROL) && IRQ_IPL_FAST(IRQ_PRIORITY_ACQUISITION)
+  #error === ACQUISITION and CONTROL interrupts contend at the same fast interrupt priority level ===
+#endif
+
 
 #endif	/* _DEVICE_CONFIGURATION_IRQ_H */
 
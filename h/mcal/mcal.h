@@ -96,9 +96,9 @@ extern "C" {
 #ifndef CPU_RESET
 #define CPU_RESET		asm volatile ("RESET\n")
 #endif
-//#ifndef ALTWREG_SWAP
-//#define ALTWREG_SWAP(x)    asm volatile ( "PUSH.W W0 \n CTXTSWP #" + x + "POP.W W0 \n")
-//#endif
+#ifndef ALTWREG_SWAP
+#define ALTWREG_SWAP(x)    asm volatile ( "CTXTSWP #" #x "\n" ) // Switch to working register set x (0 = default set)
+#endif
     
 /* ***********************************************************************************************
  * PROTOTYPES
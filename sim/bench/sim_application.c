@@ -0,0 +1,472 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!sim_application.c
+ *****************************************************************************
+ * File:   sim_application.c
+ *
+ * Summary:
+ * Synthetic application of the host simulation benchmark suite
+ *
+ * Description:	
+ * This file replaces the application layer modules tasks.c, apl.c, 
+ * task_FaultHandler.c and task_SystemStatus.c in the host simulation build.
+ * 
+ * The task queues and the operation mode table are generated from the same 
+ * registries in tasks.h as the firmware, so the scheduler runs through the 
+ * real queue layout. Every entry of the task table points to the synthetic
+ * task sim_SyntheticTask(), which executes the work load selected by the 
+ * benchmark and consumes simulated CPU cycles.
+ * 
+ * The benchmark runs the scheduler back-to-back: the application status 
+ * capture called by the scheduler after each task terminates the recent 
+ * time slot, so that the scheduler never waits for the system timer and 
+ * the host time of a run only consists of scheduler dispatch overhead, 
+ * fault scan and synthetic task bodies.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * sim_application.h
+ * tasks.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "_root/config/globals.h"
+#include "apl/config/tasks.h"
+#include "sim_application.h"
+
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+    #error === host simulation build requires TASK_MGR_SCHEDULER_MODE = TASK_MGR_MODE_POLLING ===
+#endif
+#if (USE_TASK_MANAGER_RT_TIER == 1) || (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+    #error === real-time task tier and slack executor are not supported by the host simulation build ===
+#endif
+
+// Instruction cycle frequency of the simulated device
+#define SIM_FCY             100000000UL
+// Trip level of synthetic fault objects (never reached by the monitored signal)
+#define SIM_FAULT_TRIP      0xF000
+#define SIM_FAULT_RESET     0xE000
+
+/* ***********************************************************************************************
+ * Objects provided by the peripheral library and the application layer
+ * ***********************************************************************************************/
+
+volatile OSC_FREQUENCIES_t system_frequencies;
+volatile APPLICATION_t application;
+volatile TRAP_LOGGER_t __attribute__((__persistent__))traplog;
+volatile SCOPE_t scope; // Waveform capture (idle, event triggers are ignored)
+
+// Buffers and program memory regions skipped by the run-time self-test (see apl/config/selftest.h)
+volatile uint8_t uart_rx_buffer[UART_RX_BUFFER_SIZE];
+volatile uint8_t telemetry_frame[2][TELEMETRY_FRAME_SIZE];
+volatile uint16_t can_message_ram[CAN_MESSAGE_RAM_SIZE >> 1];
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+volatile uint32_t calibration_flash_base = 0x010000UL; // outside of the simulated program memory range
+#endif
+
+// Fault objects scaled with the scheduler tick period (see timebase.h)
+FAULT_OBJECT_t fltobj_TaskTimeQuotaViolation;
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+FAULT_OBJECT_t fltobj_SlotStartLatency;
+#endif
+
+volatile SIM_LOAD_t sim_load;
+
+/* private function prototypes */
+volatile uint16_t sim_SyntheticTask(void);
+inline volatile uint16_t sim_FaultObjectInit(volatile uint16_t index);
+
+/*!Task Table
+ * ***********************************************************************************************
+ * Description:
+ * All registered tasks are replaced by the synthetic task
+ * ***********************************************************************************************/
+
+#define SIM_TASK_REGISTRY_FUNCTION(id, function)    sim_SyntheticTask,
+
+volatile uint16_t (* const Task_Table[TASK_TABLE_SIZE])(void) = {
+    TASK_REGISTRY(SIM_TASK_REGISTRY_FUNCTION)
+};
+
+/*!Watchdog Check-In Tables
+ * ***********************************************************************************************/
+
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+#define WDT_CHECKIN_REGISTRY_DESCRIPTOR(id, op_modes)   { (id), (op_modes) },
+#define WDT_CHECKIN_REGISTRY_MASK(id, op_modes)         [(id)] = (1 << WDT_CHECKIN_##id),
+
+const wdt_checkin_descriptor_t wdt_checkin_table[WDT_CHECKIN_TABLE_SIZE] = {
+    WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_DESCRIPTOR)
+};
+
+const uint16_t wdt_checkin_task_mask[TASK_TABLE_SIZE] = {
+    WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_MASK)
+};
+
+#endif
+
+/*!Task Queues
+ * ***********************************************************************************************/
+
+const task_queue_item_t task_queue_boot[TASK_QUEUE_BOOT_SIZE] = {
+    TASK_QUEUE_BOOT(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_device_startup[TASK_QUEUE_DEVICE_STARTUP_SIZE] = {
+    TASK_QUEUE_DEVICE_STARTUP(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_system_startup[TASK_QUEUE_SYSTEM_STARTUP_SIZE] = {
+    TASK_QUEUE_SYSTEM_STARTUP(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_idle[TASK_QUEUE_IDLE_SIZE] = {
+    TASK_QUEUE_IDLE(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_normal[TASK_QUEUE_NORMAL_SIZE] = {
+    TASK_QUEUE_NORMAL(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_fault[TASK_QUEUE_FAULT_SIZE] = {
+    TASK_QUEUE_FAULT(TASK_QUEUE_ITEM)
+};
+
+const task_queue_item_t task_queue_standby[TASK_QUEUE_STANDBY_SIZE] = {
+    TASK_QUEUE_STANDBY(TASK_QUEUE_ITEM)
+};
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+const uint16_t task_queue_warm_boot[TASK_QUEUE_WARM_BOOT_SIZE] = {
+    TASK_QUEUE_WARM_BOOT(TASK_QUEUE_ID)
+};
+#endif
+
+/*!task_op_mode_table
+ * ***********************************************************************************************
+ * Description:
+ * Same queue sequence as the firmware without switch-over functions. The application
+ * status capture selects OP_MODE_NORMAL after the startup sequence has been completed.
+ * ***********************************************************************************************/
+
+const task_op_mode_descriptor_t task_op_mode_table[OP_MODE_TABLE_SIZE] = {
+    
+    [OP_MODE_INDEX_BOOT] = 
+        { task_queue_boot, TASK_QUEUE_BOOT_SIZE, NULL, 
+          OP_MODE_DEVICE_STARTUP, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_DEVICE_STARTUP] = 
+        { task_queue_device_startup, TASK_QUEUE_DEVICE_STARTUP_SIZE, NULL, 
+          OP_MODE_SYSTEM_STARTUP, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_SYSTEM_STARTUP] = 
+        { task_queue_system_startup, TASK_QUEUE_SYSTEM_STARTUP_SIZE, NULL, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_STARTUP_COMPLETE },
+    
+    [OP_MODE_INDEX_IDLE] = 
+        { task_queue_idle, TASK_QUEUE_IDLE_SIZE, NULL, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_NORMAL] = 
+        { task_queue_normal, TASK_QUEUE_NORMAL_SIZE, NULL, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_FAULT] = 
+        { task_queue_fault, TASK_QUEUE_FAULT_SIZE, NULL, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_FAULT_OVERRIDE },
+    
+    [OP_MODE_INDEX_STANDBY] = 
+        { task_queue_standby, TASK_QUEUE_STANDBY_SIZE, NULL, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE }
+    
+};
+
+/*!Fault Objects
+ * ***********************************************************************************************
+ * Description:
+ * The fault object list holds up to FAULT_ENGINE_OBJECTS_MAX synthetic fault objects. The 
+ * number of active objects is set by sim_FaultObjectsInit().
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_fault_signal = 0; // Signal monitored by all synthetic fault objects
+volatile FAULT_OBJECT_t sim_fault_objects[FAULT_ENGINE_OBJECTS_MAX];
+FAULT_OBJECT_DESCRIPTOR_t sim_fault_descriptors[FAULT_ENGINE_OBJECTS_MAX]; // Settings of the synthetic fault objects
+
+volatile FAULT_OBJECT_t *fault_object_list[FAULT_ENGINE_OBJECTS_MAX];
+volatile uint16_t fltobj_list_size = 0;
+
+#if (USE_FAULT_GROUPS == 1)
+#define SIM_FAULT_GROUPS    ((FAULT_ENGINE_OBJECTS_MAX + FAULT_GROUP_MEMBERS_MAX - 1) / FAULT_GROUP_MEMBERS_MAX)
+volatile FAULT_GROUP_t fault_group[SIM_FAULT_GROUPS]; // synthetic fault objects fill one group after another
+volatile uint16_t fault_group_count = SIM_FAULT_GROUPS;
+#endif
+
+/*!sim_HostCycles
+ * ***********************************************************************************************
+ * Description:
+ * Returns the host time stamp counter on x86 hosts, a nanosecond clock on all others
+ * ***********************************************************************************************/
+
+uint64_t sim_HostCycles(void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    return((uint64_t)__rdtsc());
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return(((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+const char* sim_HostCycleUnit(void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    return("TSC cycles");
+#else
+    return("ns");
+#endif
+}
+
+/*!sim_SyntheticTask
+ * ***********************************************************************************************
+ * Description:
+ * Executes sim_load.work iterations of a host work loop and consumes sim_load.cycles of
+ * simulated CPU time. The host time spent in here is accounted separately.
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_SyntheticTask(void)
+{
+    volatile uint16_t i = 0;
+    uint64_t t_start = 0;
+    
+    t_start = sim_HostCycles();
+    
+    for (i=0; i<sim_load.work; i++)
+    { sim_load.sink += i; }
+    
+    sim_CpuExecute(sim_load.cycles);
+    
+    if (sim_load.ticks > 0) // Only tasks within the benchmark run are accounted
+    {
+        sim_load.calls++;
+        sim_load.host_task += (sim_HostCycles() - t_start);
+    }
+    
+    return(1);
+}
+
+/*!sim_LoadReset
+ * ***********************************************************************************************
+ * Description:
+ * Sets the synthetic task load, fault object count and number of scheduler ticks of the next run
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_LoadReset(volatile uint16_t work, volatile uint16_t cycles, 
+                    volatile uint16_t fault_objects, volatile uint32_t ticks)
+{
+    sim_load.work = work;
+    sim_load.cycles = cycles;
+    sim_load.fault_objects = fault_objects;
+    sim_load.ticks_target = ticks;
+    sim_load.ticks = 0;
+    sim_load.calls = 0;
+    sim_load.host_start = 0;
+    sim_load.host_task = 0;
+    
+    return(1);
+}
+
+/*!sim_FaultObjectInit
+ * ***********************************************************************************************
+ * Description:
+ * Initializes a polled, software-level synthetic fault object of the FAST scan class. The 
+ * number of synthetic objects is set at runtime, hence their descriptors are located in RAM.
+ * ***********************************************************************************************/
+
+inline volatile uint16_t sim_FaultObjectInit(volatile uint16_t index)
+{
+    volatile FAULT_OBJECT_t* fltobj;
+    FAULT_OBJECT_DESCRIPTOR_t* fltdsc;
+    
+    fltobj = &sim_fault_objects[index];
+    fltdsc = &sim_fault_descriptors[index];
+    
+    fltdsc->object = &sim_fault_signal;
+    fltdsc->object_bit_mask = FAULT_OBJECT_BIT_MASK_DEFAULT;
+    fltdsc->error_code = (uint32_t)index;
+    fltdsc->id = index;
+    
+    fltdsc->fault_ratio = FAULT_LEVEL_GREATER_THAN;
+    fltdsc->trip_level = SIM_FAULT_TRIP;
+    fltdsc->trip_cnt_threshold = 1;
+    fltdsc->reset_level = SIM_FAULT_RESET;
+    fltdsc->reset_cnt_threshold = 1;
+    
+    fltdsc->classes = FLT_CLASS_NOTIFY;
+    fltdsc->status = (FAULT_SW | FLTCHK_ENABLED);
+    fltdsc->user_fault_action = NULL;
+    fltdsc->user_fault_reset = NULL;
+    
+    fltdsc->scan_class = FAULT_SCAN_CLASS_FAST;
+    fltdsc->trigger = FAULT_TRIGGER_POLLED;
+    fltdsc->hw = NULL;
+    fltdsc->filter = NULL;
+  #if (USE_FAULT_GROUPS == 1)
+    fltdsc->group = (index / FAULT_GROUP_MEMBERS_MAX);
+  #else
+    fltdsc->group = 0;
+  #endif
+    
+    fault_ObjectLoad(fltobj, fltdsc);
+    fault_object_list[index] = fltobj;
+    
+    return(1);
+}
+
+/*!sim_FaultObjectsInit
+ * ***********************************************************************************************
+ * Description:
+ * Sets up the given number of synthetic fault objects and compiles them into the fault engine
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_FaultObjectsInit(volatile uint16_t count)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    
+    if (count > FAULT_ENGINE_OBJECTS_MAX)
+    { count = FAULT_ENGINE_OBJECTS_MAX; fres = 0; }
+    
+    for (i=0; i<count; i++)
+    { fres &= sim_FaultObjectInit(i); }
+    
+    fltobj_list_size = count;
+    
+    #if (USE_FAULT_ENGINE == 1)
+    fres &= fault_EngineCompile();
+    #endif
+    
+    return(fres);
+}
+
+/* ***********************************************************************************************
+ * Application and hardware abstraction layer functions called by the root layer
+ * ***********************************************************************************************/
+
+volatile uint16_t Device_Reset(void)
+{
+    return(1);
+}
+
+uint16_t init_boot_timer(void)
+{
+    return(1); // Timer4 is advanced by the core model
+}
+
+uint16_t launch_boot_timer(void)
+{
+    return(1);
+}
+
+volatile uint16_t CLOCK_Initialize(void)
+{
+    system_frequencies.fcy = SIM_FCY;
+    system_frequencies.fp = SIM_FCY;
+    system_frequencies.fosc = (2 * SIM_FCY);
+    system_frequencies.tcy = (1.0 / (float)SIM_FCY);
+    system_frequencies.tp = (1.0 / (float)SIM_FCY);
+    
+    // System timer is running with the scheduler time step and releases the first time slot
+    TMR1 = 0;
+    PR1 = (TASK_MGR_PERIOD - 1);
+    IFS0 = 0;
+    sim_TimerExpire();
+    
+    return(1);
+}
+
+volatile uint16_t OS_Initialize(void)
+{
+    volatile uint16_t fres = 0;
+
+    fres = init_TaskManager();
+    fres &= sim_FaultObjectsInit(sim_load.fault_objects);
+    
+    #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+    fres &= warm_boot_Restore();
+    #endif
+    
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    fres &= init_TaskWatchdog();
+    #endif
+    
+    return(fres);
+}
+
+volatile uint16_t GetTrapStatus(void)
+{
+    return(1); // No traps are captured in the host simulation
+}
+
+/*!exec_CaptureSystemStatus
+ * ***********************************************************************************************
+ * Description:
+ * Called by the scheduler after every task. Selects OP_MODE_NORMAL once the startup sequence 
+ * has been completed, counts the ticks of the benchmark run and terminates the time slot.
+ * ***********************************************************************************************/
+
+volatile uint16_t exec_CaptureSystemStatus(void)
+{
+    if (task_mgr.op_mode.mode == OP_MODE_NORMAL)
+    {
+        if (sim_load.ticks == 0)
+        { sim_load.host_start = sim_HostCycles(); }
+        
+        if (++sim_load.ticks >= sim_load.ticks_target)
+        { run_scheduler = 0; } // End of benchmark run
+    }
+    else if (task_mgr.status.flags.startup_sequence_complete)
+    {
+        task_mgr.op_mode.mode = OP_MODE_NORMAL;
+    }
+    
+    sim_TimerExpire(); // The recent time slot ends here
+    
+    return(1);
+}
+
+// EOF
@@ -0,0 +1,85 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!sim_application.h
+ *****************************************************************************
+ * File:   sim_application.h
+ *
+ * Summary:
+ * Synthetic application of the host simulation benchmark suite
+ *
+ * Description:	
+ * The synthetic application replaces the application and hardware abstraction 
+ * layers of the firmware in the host simulation build. It provides the task
+ * table, task queues, operation mode table and fault object list expected by 
+ * the root layer. Every registered task is replaced by a synthetic task whose 
+ * execution time is set by the benchmark at runtime.
+ *
+ * See also:
+ * sim_application.c
+ * sim_benchmark.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _SIM_APPLICATION_H_
+#define	_SIM_APPLICATION_H_
+
+#include <stdint.h>
+
+/*!SIM_LOAD_t
+ * ***********************************************************************************************
+ * Description:
+ * Settings and accounting data of the synthetic task load. The host time spent in synthetic 
+ * task bodies is accumulated in host_task, so that it can be subtracted from the total 
+ * host time of a benchmark run to obtain the scheduler dispatch overhead.
+ * 
+ * Host time is counted in units of sim_HostCycles(), which reads the processor time stamp 
+ * counter on x86 hosts and a nanosecond clock on all other hosts.
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint16_t work; // Synthetic task load in host work loop iterations per task call
+    volatile uint16_t cycles; // Simulated CPU cycles consumed per task call
+    volatile uint16_t fault_objects; // Number of synthetic fault objects in the fault object list
+    volatile uint32_t ticks_target; // Number of OP_MODE_NORMAL scheduler ticks to run
+    volatile uint32_t ticks; // Number of OP_MODE_NORMAL scheduler ticks executed
+    volatile uint32_t calls; // Number of synthetic task calls while in OP_MODE_NORMAL
+    volatile uint64_t host_start; // Host time stamp of the first OP_MODE_NORMAL tick
+    volatile uint64_t host_task; // Host time accumulated in synthetic task bodies
+    volatile uint32_t sink; // Result of the synthetic work loop (keeps the loop alive)
+} SIM_LOAD_t;
+
+extern volatile SIM_LOAD_t sim_load;
+
+/* Public function prototypes */
+extern uint64_t sim_HostCycles(void);
+extern const char* sim_HostCycleUnit(void);
+extern volatile uint16_t sim_FaultObjectsInit(volatile uint16_t count);
+extern volatile uint16_t sim_LoadReset(volatile uint16_t work, volatile uint16_t cycles, 
+                    volatile uint16_t fault_objects, volatile uint32_t ticks);
+
+#endif	/* _SIM_APPLICATION_H_ */
+
+// EOF
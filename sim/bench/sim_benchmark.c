@@ -0,0 +1,205 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!sim_benchmark.c
+ *****************************************************************************
+ * File:   sim_benchmark.c
+ *
+ * Summary:
+ * Scheduler and fault handler cycle-accounting benchmark
+ *
+ * Description:	
+ * This host program runs the firmware scheduler exec_scheduler() through the 
+ * given number of OP_MODE_NORMAL ticks (default: 1,000,000) with the synthetic 
+ * application of sim_application.c and reports
+ * 
+ *  - the scheduler dispatch overhead per tick for different synthetic task 
+ *    loads (host time of a run minus the host time spent in task bodies)
+ *  - the cost of the fault scan exec_FaultCheckAll() for different numbers 
+ *    of fault objects and the resulting cost per fault object
+ * 
+ * All results are given in host time units (see sim_HostCycleUnit()). They
+ * do not represent dsPIC33 execution times, but reveal the complexity of
+ * scheduler and fault handler with respect to queue layout, task load and
+ * fault object count and allow comparing changes of the root layer.
+ * 
+ * Usage:
+ *      sim_benchmark [ticks]
+ *
+ * See also:
+ * sim/Makefile
+ * sim_application.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "_root/config/globals.h"
+#include "sim_application.h"
+
+// Default number of OP_MODE_NORMAL scheduler ticks of each benchmark run
+#define SIM_BENCH_TICKS_DEFAULT     1000000UL
+// Simulated CPU cycles consumed by each synthetic task call
+#define SIM_BENCH_TASK_CYCLES       1000
+// Power-on and brown-out reset flags of RCON (forces a cold boot of each run)
+#define SIM_BENCH_RCON_COLD         0x0003
+
+typedef struct {
+    uint64_t total; // Host time of the run from the first OP_MODE_NORMAL tick to the scheduler exit
+    uint64_t task; // Host time spent in synthetic task bodies
+    uint32_t ticks; // Number of OP_MODE_NORMAL ticks executed
+} SIM_BENCH_RESULT_t;
+
+/* private function prototypes */
+inline volatile uint16_t sim_BenchRun(volatile uint16_t work, volatile uint16_t fault_objects, 
+                    volatile uint32_t ticks, SIM_BENCH_RESULT_t* result);
+inline double sim_BenchFaultScan(volatile uint32_t calls);
+
+// Synthetic task loads in host work loop iterations per task call
+const uint16_t sim_bench_task_work[] = { 0, 16, 64, 256 };
+// Synthetic fault object counts
+const uint16_t sim_bench_fault_objects[] = { 0, 1, 4, 8, 16, 32, FAULT_ENGINE_OBJECTS_MAX };
+
+#define SIM_BENCH_COUNT(x)  (sizeof(x)/sizeof(x[0]))
+
+/*!sim_BenchRun
+ * ***********************************************************************************************
+ * Description:
+ * Executes one cold boot of the firmware scheduler until the given number of OP_MODE_NORMAL
+ * ticks has been executed.
+ * ***********************************************************************************************/
+
+inline volatile uint16_t sim_BenchRun(volatile uint16_t work, volatile uint16_t fault_objects, 
+                    volatile uint32_t ticks, SIM_BENCH_RESULT_t* result)
+{
+    volatile uint16_t fres = 1;
+    uint64_t t_end = 0;
+    
+    fres &= sim_LoadReset(work, SIM_BENCH_TASK_CYCLES, fault_objects, ticks);
+    
+    RCON = SIM_BENCH_RCON_COLD;
+    run_scheduler = 1;
+    
+    exec_scheduler(); // returns after the run has been terminated by the synthetic application
+    t_end = sim_HostCycles();
+    
+    result->total = (t_end - sim_load.host_start);
+    result->task = sim_load.host_task;
+    result->ticks = sim_load.ticks;
+    
+    if (result->ticks == 0) { fres = 0; }
+    
+    return(fres);
+}
+
+/*!sim_BenchFaultScan
+ * ***********************************************************************************************
+ * Description:
+ * Calls the fault scan of the recently compiled fault object list and returns the average 
+ * host time per call.
+ * ***********************************************************************************************/
+
+inline double sim_BenchFaultScan(volatile uint32_t calls)
+{
+    volatile uint32_t i = 0;
+    uint64_t t_start = 0;
+    
+    t_start = sim_HostCycles();
+    
+    for (i=0; i<calls; i++)
+    { exec_FaultCheckAll(); }
+    
+    return((double)(sim_HostCycles() - t_start) / (double)calls);
+}
+
+int main(int argc, char** argv)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    uint32_t ticks = SIM_BENCH_TICKS_DEFAULT;
+    SIM_BENCH_RESULT_t result;
+    double overhead = 0.0, scan = 0.0, scan_base = 0.0;
+    
+    if (argc > 1)
+    { ticks = (uint32_t)strtoul(argv[1], NULL, 0); }
+    if (ticks == 0)
+    { ticks = SIM_BENCH_TICKS_DEFAULT; }
+    
+    printf("Scheduler and fault handler host benchmark\n");
+    printf("  ticks per run:      %lu\n", (unsigned long)ticks);
+    printf("  tasks registered:   %u\n", (unsigned)TASK_TABLE_SIZE);
+    printf("  normal queue size:  %u\n", (unsigned)TASK_QUEUE_NORMAL_SIZE);
+    printf("  multi-rate queues:  %s\n", (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1) ? "on" : "off");
+    printf("  fault engine:       %s\n", (USE_FAULT_ENGINE == 1) ? "on" : "off");
+    printf("  host time unit:     %s\n\n", sim_HostCycleUnit());
+    
+    // Dispatch overhead at different synthetic task loads without fault objects
+    printf("Dispatch overhead (no fault objects)\n");
+    printf("  %10s %14s %14s %14s\n", "task work", "tick total", "task body", "overhead");
+    
+    for (i=0; i<SIM_BENCH_COUNT(sim_bench_task_work); i++)
+    {
+        fres &= sim_BenchRun(sim_bench_task_work[i], 0, ticks, &result);
+        overhead = ((double)(result.total - result.task) / (double)result.ticks);
+        printf("  %10u %14.1f %14.1f %14.1f\n", (unsigned)sim_bench_task_work[i], 
+                ((double)result.total / (double)result.ticks), 
+                ((double)result.task / (double)result.ticks), overhead);
+    }
+    
+    // Scheduler tick overhead and isolated fault scan cost at different fault object counts
+    printf("\nFault scan (no task work)\n");
+    printf("  %10s %14s %14s %14s\n", "objects", "tick overhead", "scan call", "per object");
+    
+    for (i=0; i<SIM_BENCH_COUNT(sim_bench_fault_objects); i++)
+    {
+        fres &= sim_BenchRun(0, sim_bench_fault_objects[i], ticks, &result);
+        overhead = ((double)(result.total - result.task) / (double)result.ticks);
+        scan = sim_BenchFaultScan(ticks);
+        
+        if (sim_bench_fault_objects[i] == 0)
+        {
+            scan_base = scan;
+            printf("  %10u %14.1f %14.1f %14s\n", 0, overhead, scan, "-");
+        }
+        else
+        {
+            printf("  %10u %14.1f %14.1f %14.2f\n", (unsigned)sim_bench_fault_objects[i], overhead, scan, 
+                    ((scan - scan_base) / (double)sim_bench_fault_objects[i]));
+        }
+    }
+    
+    if (!fres)
+    {
+        printf("\nbenchmark run failed\n");
+        return(EXIT_FAILURE);
+    }
+    
+    return(EXIT_SUCCESS);
+}
+
+// EOF
@@ -0,0 +1,251 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!sim_device.c
+ *****************************************************************************
+ * File:   sim_device.c
+ *
+ * Summary:
+ * Register-mock layer and core model of the host simulation build
+ *
+ * Description:	
+ * This file holds the special function registers declared by the mock xc.h
+ * as plain variables and emulates the XC16 built-in functions and core 
+ * instructions used by the firmware root layer.
+ * 
+ * Simulated time only advances when sim_CpuExecute() is called. Firmware code 
+ * itself executes in zero simulated time. Timer1 counts simulated CPU cycles 
+ * and sets the Timer1 interrupt flag bit (IFS0<1>) when it rolls over at PR1,
+ * like the scheduler time base on the target device.
+ * 
+ * The flash controller is modeled as blank, always-ready program memory: 
+ * table reads return 0xFFFF and write sequences complete immediately 
+ * without changing memory contents.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * xc.h (sim/mock/xc16/include)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+
+// Timer1 interrupt flag bit of dsPIC33CK devices (IFS0<1>)
+#define SIM_T1IF_MASK       0x0002
+// Software reset flag bit of the reset control register (RCON<6>)
+#define SIM_RCON_SWR_MASK   0x0040
+
+/* ***********************************************************************************************
+ * Special function registers
+ * ***********************************************************************************************/
+
+volatile uint16_t TMR1 = 0;
+volatile uint16_t PR1 = 0xFFFF;
+
+volatile uint16_t TMR4 = 0;
+
+volatile uint16_t IFS0 = 0;
+volatile uint16_t IFS1 = 0;
+volatile uint16_t IEC0 = 0;
+volatile uint16_t IEC1 = 0;
+
+volatile uint16_t RCON = 0;
+
+volatile uint16_t OSCCON = 0;
+volatile uint16_t CLKDIV = 0;
+volatile uint16_t PLLFBD = 0;
+volatile uint16_t PLLDIV = 0;
+volatile uint16_t ACLKCON1 = 0;
+volatile uint16_t APLLFBD1 = 0;
+volatile uint16_t APLLDIV1 = 0;
+
+volatile uint16_t WDTCONL = 0;
+
+volatile uint16_t NVMCON = 0;
+volatile uint16_t NVMADR = 0;
+volatile uint16_t NVMADRU = 0;
+volatile uint16_t TBLPAG = 0;
+
+volatile uint16_t LATD = 0;
+volatile uint16_t TRISD = 0xFFFF;
+
+volatile uint16_t DAC1CONL = 0;
+volatile uint16_t DAC1DATH = 0;
+volatile uint16_t DACCTRL1L = 0;
+volatile uint16_t PG1FPCIL = 0;
+volatile uint16_t PG1FPCIH = 0;
+volatile uint16_t PG1IOCONL = 0;
+
+volatile uint16_t sim_stack[SIM_STACK_WORDS];
+volatile uint16_t sim_selftest_ram[SIM_SELF_TEST_RAM_WORDS];
+
+/* ***********************************************************************************************
+ * Core model status
+ * ***********************************************************************************************/
+
+volatile uint32_t sim_cpu_cycles = 0;       // Simulated CPU cycles executed since start-up
+volatile uint16_t sim_cpu_resets = 0;       // Number of RESET instructions executed
+volatile uint32_t sim_wdt_clears = 0;       // Number of CLRWDT instructions executed
+
+/*!sim_CpuExecute
+ * ***********************************************************************************************
+ * Description:
+ * Advances simulated time by the given number of CPU cycles. Timer1 rolls over 
+ * after reaching PR1 and sets its interrupt flag bit. Timer4 (boot profiler time base) 
+ * is free running at 1:64 of the CPU clock.
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_CpuExecute(volatile uint16_t cycles)
+{
+    volatile uint32_t tmr = 0;
+    
+    sim_cpu_cycles += cycles;
+    tmr = ((uint32_t)TMR1 + cycles);
+    
+    while (tmr > PR1)
+    {
+        tmr -= ((uint32_t)PR1 + 1);
+        IFS0 |= SIM_T1IF_MASK;
+    }
+    
+    TMR1 = (uint16_t)tmr;
+    TMR4 = (uint16_t)(sim_cpu_cycles >> 6);
+    
+    return(1);
+}
+
+/*!sim_TimerExpire
+ * ***********************************************************************************************
+ * Description:
+ * Terminates the recent scheduler time slot by setting the Timer1 interrupt 
+ * flag bit without advancing simulated time. The scheduler then proceeds
+ * with the next time slot without waiting.
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_TimerExpire(void)
+{
+    IFS0 |= SIM_T1IF_MASK;
+    return(1);
+}
+
+/*!sim_CpuIdle
+ * ***********************************************************************************************
+ * Description:
+ * Emulates the PWRSAV instruction. The CPU wakes up at the next Timer1 roll-over.
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_CpuIdle(void)
+{
+    return(sim_CpuExecute((PR1 - TMR1) + 1));
+}
+
+/*!sim_CpuReset
+ * ***********************************************************************************************
+ * Description:
+ * Emulates the RESET instruction. The simulation cannot restart the firmware and 
+ * returns to the caller of the scheduler, leaving the software reset flag bit set.
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_CpuReset(void)
+{
+    RCON |= SIM_RCON_SWR_MASK;
+    sim_cpu_resets++;
+    return(1);
+}
+
+/*!sim_WatchdogClear
+ * ***********************************************************************************************
+ * Description:
+ * Emulates the CLRWDT instruction
+ * ***********************************************************************************************/
+
+volatile uint16_t sim_WatchdogClear(void)
+{
+    sim_wdt_clears++;
+    return(1);
+}
+
+/* ***********************************************************************************************
+ * XC16 built-in functions
+ * ***********************************************************************************************/
+
+// Find first one from the right: returns 1 for bit #0 ... 16 for bit #15, 0 if no bit is set
+unsigned int __builtin_ff1r(unsigned int value)
+{
+    return((unsigned int)__builtin_ffs((int)(value & 0xFFFF)));
+}
+
+// Find first one from the left: returns 1 for bit #15 ... 16 for bit #0, 0 if no bit is set
+unsigned int __builtin_ff1l(unsigned int value)
+{
+    value &= 0xFFFF;
+    if (value == 0) { return(0); }
+    return((unsigned int)(__builtin_clz(value) - 15));
+}
+
+unsigned int __builtin_tblpage(const volatile void* address)
+{
+    (void)address;
+    return(0);
+}
+
+unsigned int __builtin_tbloffset(const volatile void* address)
+{
+    return((unsigned int)((uintptr_t)address & 0xFFFF));
+}
+
+unsigned int __builtin_tblrdl(unsigned int offset)
+{
+    (void)offset;
+    return(0xFFFF); // Program memory is blank
+}
+
+unsigned int __builtin_tblrdh(unsigned int offset)
+{
+    (void)offset;
+    return(0x00FF); // Program memory is blank (phantom byte reads as zero)
+}
+
+void __builtin_tblwtl(unsigned int offset, unsigned int data)
+{
+    (void)offset;
+    (void)data;
+}
+
+void __builtin_tblwth(unsigned int offset, unsigned int data)
+{
+    (void)offset;
+    (void)data;
+}
+
+void __builtin_write_NVM(void)
+{
+    NVMCON &= 0x7FFF; // Write sequence completes immediately (WR = 0)
+}
+
+// EOF
@@ -0,0 +1,225 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!xc.h (host simulation)
+ *****************************************************************************
+ * File:   xc.h
+ *
+ * Summary:
+ * Register-mock layer replacing the XC16 device header in host simulation builds
+ *
+ * Description:	
+ * This header is found instead of the XC16 device support header when the 
+ * firmware root layer is compiled with the host compiler (gcc/clang) for the 
+ * scheduler and fault handler benchmark suite (see sim/Makefile).
+ * 
+ * Special function registers used by the root layer are declared as plain
+ * 16-bit variables located in sim_device.c. Bit field access to registers is 
+ * mapped onto the same variable, so REG and REGbits alias like on the target.
+ * 
+ * Core instructions emitted by inline assembly on the target (CLRWDT, PWRSAV, 
+ * RESET) and built-in functions of XC16 are redirected to simulation hooks 
+ * declared at the end of this file.
+ * 
+ * Only the registers accessed by the files listed in sim/Makefile are 
+ * declared. Adding further firmware modules to the host build may require 
+ * additional register declarations.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * sim_device.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _SIM_MOCK_XC_H_
+#define	_SIM_MOCK_XC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* ***********************************************************************************************
+ * Device family selection
+ * The host simulation models a single-core dsPIC33CK device
+ * ***********************************************************************************************/
+
+#define __P33SMPS_CK__
+#define __P33SMPS_CK2__
+
+/* ***********************************************************************************************
+ * XC16 attributes and address space qualifiers
+ * ***********************************************************************************************/
+
+#define __persistent__      __used__    // Persistent RAM is not cleared by the host C runtime
+#define __eds__                         // No extended data space on the host
+
+/* ***********************************************************************************************
+ * Core instruction macros
+ * ***********************************************************************************************/
+
+#define Nop()                       do{ }while(0)
+#define ClrWdt()                    sim_WatchdogClear()
+#define SET_CPU_IPL(x)              do{ (void)(x); }while(0)
+#define SET_AND_SAVE_CPU_IPL(s,x)   do{ (s) = 0; (void)(x); }while(0)
+#define RESTORE_CPU_IPL(s)          do{ (void)(s); }while(0)
+
+#define WDT_RESET       sim_WatchdogClear()     // Overrides CLRWDT instruction of mcal.h
+#define PWRSAV_IDLE     sim_CpuIdle()           // Overrides PWRSAV #1 instruction of mcal.h
+#define PWRSAV_SLEEP    sim_CpuIdle()           // Overrides PWRSAV #0 instruction of mcal.h
+#define CPU_RESET       sim_CpuReset()          // Overrides RESET instruction of mcal.h
+#define ALTWREG_SWAP(x) do{ (void)(x); }while(0) // Alternate working register sets are not modeled
+
+/* ***********************************************************************************************
+ * XC16 built-in functions
+ * ***********************************************************************************************/
+
+#define __builtin_disi(x)           do{ (void)(x); }while(0)
+
+extern unsigned int __builtin_ff1l(unsigned int value);
+extern unsigned int __builtin_ff1r(unsigned int value);
+extern unsigned int __builtin_tblpage(const volatile void* address);
+extern unsigned int __builtin_tbloffset(const volatile void* address);
+extern unsigned int __builtin_tblrdl(unsigned int offset);
+extern unsigned int __builtin_tblrdh(unsigned int offset);
+extern void __builtin_tblwtl(unsigned int offset, unsigned int data);
+extern void __builtin_tblwth(unsigned int offset, unsigned int data);
+extern void __builtin_write_NVM(void);
+
+/* ***********************************************************************************************
+ * Special function registers
+ * ***********************************************************************************************/
+
+/* Timer1 (scheduler time base) */
+extern volatile uint16_t TMR1;
+extern volatile uint16_t PR1;
+
+/* Timer4 (boot profiler time base) */
+extern volatile uint16_t TMR4;
+
+/* Interrupt controller */
+extern volatile uint16_t IFS0;
+extern volatile uint16_t IFS1;
+extern volatile uint16_t IEC0;
+extern volatile uint16_t IEC1;
+
+/* Reset control */
+extern volatile uint16_t RCON;
+
+/* Oscillator */
+extern volatile uint16_t OSCCON;
+extern volatile uint16_t CLKDIV;
+extern volatile uint16_t PLLFBD;
+extern volatile uint16_t PLLDIV;
+extern volatile uint16_t ACLKCON1;
+extern volatile uint16_t APLLFBD1;
+extern volatile uint16_t APLLDIV1;
+
+/* Watchdog timer */
+typedef struct {
+    uint16_t RUNDIV:5;
+    uint16_t CLKSEL:3;
+    uint16_t SLPDIV:5;
+    uint16_t WDTWINEN:1;
+    uint16_t :1;
+    uint16_t ON:1;
+} WDTCONLBITS;
+extern volatile uint16_t WDTCONL;
+#define WDTCONLbits (*(volatile WDTCONLBITS*)&WDTCONL)
+
+/* Flash controller */
+typedef struct {
+    uint16_t NVMOP:4;
+    uint16_t :8;
+    uint16_t SFTSWP:1;
+    uint16_t WRERR:1;
+    uint16_t WREN:1;
+    uint16_t WR:1;
+} NVMCONBITS;
+extern volatile uint16_t NVMCON;
+#define NVMCONbits (*(volatile NVMCONBITS*)&NVMCON)
+extern volatile uint16_t NVMADR;
+extern volatile uint16_t NVMADRU;
+extern volatile uint16_t TBLPAG;
+
+/* GPIO port D */
+typedef struct {
+    uint16_t LATD0:1;  uint16_t LATD1:1;  uint16_t LATD2:1;  uint16_t LATD3:1;
+    uint16_t LATD4:1;  uint16_t LATD5:1;  uint16_t LATD6:1;  uint16_t LATD7:1;
+    uint16_t LATD8:1;  uint16_t LATD9:1;  uint16_t LATD10:1; uint16_t LATD11:1;
+    uint16_t LATD12:1; uint16_t LATD13:1; uint16_t LATD14:1; uint16_t LATD15:1;
+} LATDBITS;
+extern volatile uint16_t LATD;
+#define LATDbits (*(volatile LATDBITS*)&LATD)
+
+typedef struct {
+    uint16_t TRISD0:1;  uint16_t TRISD1:1;  uint16_t TRISD2:1;  uint16_t TRISD3:1;
+    uint16_t TRISD4:1;  uint16_t TRISD5:1;  uint16_t TRISD6:1;  uint16_t TRISD7:1;
+    uint16_t TRISD8:1;  uint16_t TRISD9:1;  uint16_t TRISD10:1; uint16_t TRISD11:1;
+    uint16_t TRISD12:1; uint16_t TRISD13:1; uint16_t TRISD14:1; uint16_t TRISD15:1;
+} TRISDBITS;
+extern volatile uint16_t TRISD;
+#define TRISDbits (*(volatile TRISDBITS*)&TRISD)
+
+/* Comparator DAC and PWM fault inputs (hardware fault object bindings) */
+extern volatile uint16_t DAC1CONL;
+extern volatile uint16_t DAC1DATH;
+extern volatile uint16_t DACCTRL1L;
+extern volatile uint16_t PG1FPCIL;
+extern volatile uint16_t PG1FPCIH;
+extern volatile uint16_t PG1IOCONL;
+
+/* Stack area (stack monitor): the firmware stack is modeled by a plain array with a constant 
+ * stack pointer, as the host stack cannot be painted */
+#define SIM_STACK_WORDS                 256     // Size of the simulated stack area in words
+#define SIM_STACK_DEPTH                 32      // Simulated stack pointer offset in words
+extern volatile uint16_t sim_stack[SIM_STACK_WORDS];
+#define TASK_MGR_STACK_BASE             (&sim_stack[0])                     // Overrides __SP_init of task_manager_config.h
+#define TASK_MGR_STACK_LIMIT            (&sim_stack[SIM_STACK_WORDS - 1])   // Overrides SPLIM of task_manager_config.h
+#define TASK_MGR_STACK_POINTER          (&sim_stack[SIM_STACK_DEPTH])       // Overrides WREG15 of task_manager_config.h
+
+/* Self-test memory ranges (run-time self-test): the RAM March test runs on a plain array and the 
+ * flash CRC covers a small range of blank program memory calculated by software */
+#define SIM_SELF_TEST_RAM_WORDS         64      // Size of the simulated data memory range in words
+extern volatile uint16_t sim_selftest_ram[SIM_SELF_TEST_RAM_WORDS];
+#define TASK_MGR_SELF_TEST_RAM_START    (&sim_selftest_ram[0])                      // Overrides __DATA_BASE of task_manager_config.h
+#define TASK_MGR_SELF_TEST_RAM_END      (&sim_selftest_ram[SIM_SELF_TEST_RAM_WORDS]) // Overrides __SP_init of task_manager_config.h
+#define TASK_MGR_SELF_TEST_FLASH_START  0x000000UL  // Overrides the program memory range of task_manager_config.h
+#define TASK_MGR_SELF_TEST_FLASH_END    0x000400UL  // 512 instruction words
+#define TASK_MGR_SELF_TEST_HW_CRC       0           // The CRC module is not modeled
+
+/* ***********************************************************************************************
+ * Simulation hooks
+ * ***********************************************************************************************/
+
+extern volatile uint16_t sim_CpuExecute(volatile uint16_t cycles);
+extern volatile uint16_t sim_TimerExpire(void);
+extern volatile uint16_t sim_CpuIdle(void);
+extern volatile uint16_t sim_CpuReset(void);
+extern volatile uint16_t sim_WatchdogClear(void);
+
+#endif	/* _SIM_MOCK_XC_H_ */
+
+// EOF
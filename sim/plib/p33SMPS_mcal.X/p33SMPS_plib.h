@@ -0,0 +1,110 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!p33SMPS_plib.h (host simulation)
+ *****************************************************************************
+ * File:   p33SMPS_plib.h
+ *
+ * Summary:
+ * Peripheral library mock of the host simulation build
+ *
+ * Description:	
+ * mcal.h includes the peripheral library p33SMPS_plib.h of the p33SMPS_mcal.X 
+ * project located next to this firmware project. The host simulation build 
+ * resolves this include path to this file, which only declares the library
+ * data types and objects referenced by the headers and the root layer modules 
+ * compiled into the benchmark suite (see sim/Makefile). 
+ * 
+ * Peripheral library functions are not available in the host simulation.
+ *
+ * See also:
+ * sim/mock/xc16/include/xc.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+#ifndef _SIM_MOCK_P33SMPS_PLIB_H_
+#define	_SIM_MOCK_P33SMPS_PLIB_H_
+
+#include <stdint.h>
+
+/* ***********************************************************************************************
+ * Oscillator
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile uint32_t frc;      // Internal fast RC oscillator frequency
+    volatile uint32_t fpri;     // Primary oscillator frequency
+    volatile uint32_t fosc;     // Oscillator output frequency
+    volatile uint32_t fcy;      // Instruction cycle frequency
+    volatile uint32_t fp;       // Peripheral bus frequency
+    volatile uint32_t fpllo;    // PLL output frequency
+    volatile uint32_t fvco;     // PLL VCO frequency
+    volatile uint32_t afpllo;   // Auxiliary PLL output frequency
+    volatile uint32_t afvco;    // Auxiliary PLL VCO frequency
+    volatile float tcy;         // Instruction cycle period
+    volatile float tp;          // Peripheral bus clock period
+} OSC_FREQUENCIES_t;
+
+extern volatile OSC_FREQUENCIES_t system_frequencies;
+
+typedef enum {
+    CPU_SPEED_90_MIPS = 90,
+    CPU_SPEED_100_MIPS = 100
+} CPU_SPEED_DEFAULTS_e;
+
+typedef enum {
+    AFPLLO_500_MHZ = 500
+} AUXOSC_FREQUENCY_e;
+
+/* ***********************************************************************************************
+ * Timer
+ * ***********************************************************************************************/
+
+typedef struct {
+    volatile struct {
+        volatile unsigned ton:1, tsidl:1, tcs:1, tgate:1, tsync:1, tmwdis:1, tmwip:1, prwip:1, tecs:2, tckps:2;
+    } flags;
+    volatile uint16_t value;
+} TxCON_CONTROL_REGISTER_t;
+
+typedef enum {
+    TON_DISABLED = 0, TON_ENABLED = 1, 
+    TSIDL_RUN = 0, TSIDL_STOP = 1, 
+    TCS_INTERNAL = 0, TGATE_DISABLED = 0, TSYNC_NONE = 0, 
+    TMWDIS_ENABLED = 0, TMWIP_COMPLETE = 0, PRWIP_COMPLETE = 0, TECS_TCY = 0
+} TxCON_SETTINGS_e;
+
+/* ***********************************************************************************************
+ * Peripheral module disable
+ * ***********************************************************************************************/
+
+typedef enum {
+    PMD_POWER_ON = 0,
+    PMD_POWER_OFF = 1
+} PMD_POWER_e;
+
+#endif	/* _SIM_MOCK_P33SMPS_PLIB_H_ */
+
+// EOF
@@ -43,17 +43,108 @@ inline volatile uint16_t SetFaultCondition(volatile FAULT_OBJECT_t* fltobj);
 inline volatile uint16_t ExecFaultHandler(volatile FAULT_OBJECT_t* fltobj);
 inline volatile uint16_t ExecGlobalFaultFlagRelease(volatile uint16_t fault_class_code);
 inline volatile uint16_t ExecFaultFlagReleaseHandler(volatile FAULT_OBJECT_t* fltobj);
+#if (USE_FAULT_FILTERS == 1)
+inline volatile uint16_t fault_FilterUpdate(volatile FAULT_OBJECT_t* fltobj, volatile uint16_t value);
+inline volatile uint16_t fault_FilterReset(volatile FAULT_OBJECT_t* fltobj);
+#endif
+#if (USE_FAULT_ENGINE == 1)
+inline volatile uint16_t exec_FaultEngine(volatile uint16_t first, volatile uint16_t count);
+inline volatile uint16_t fault_EngineClassPresent(void);
+inline volatile uint16_t exec_FaultEngineEvents(volatile uint16_t* pending);
+#endif
+inline volatile uint16_t fault_ClaimPendingEvents(volatile uint16_t* pending);
+#if (USE_FAULT_GROUPS == 1)
+inline volatile uint16_t fault_GroupUpdate(volatile FAULT_OBJECT_t* fltobj);
+inline volatile uint16_t fault_GroupSummary(volatile FAULT_GROUP_t* grp);
+inline volatile uint16_t fault_GroupsRelease(void);
+#endif
 
 /*!fault_object_list_pointer
  * ***********************************************************************************************
  * Description:
  * The fault_object_list_pointer variable is used by the exec_FaultCheckSequential() function.
- * Instead of checking all fault objects at once, this routine checks one fault object  
- * declared in fault_object_list[] at a time. After the last item was checked, the 
- * fault_object_list_pointer is automatically reset and starts from fault_object_list[0].
+ * Instead of checking all SLOW scan class fault objects at once, this routine checks one fault 
+ * object compiled into fault_engine at a time until its time budget is used up. After the last 
+ * item was checked, the fault_object_list_pointer is automatically reset and starts from the 
+ * first SLOW scan class object fault_engine.slow_first.
  * ***********************************************************************************************/
 volatile uint16_t fault_object_list_pointer = 0;
 
+/*!fault_engine
+ * ***********************************************************************************************
+ * Description:
+ * Compiled fault objects evaluated by exec_FaultCheckAll() when USE_FAULT_ENGINE is enabled
+ * ***********************************************************************************************/
+#if (USE_FAULT_ENGINE == 1)
+FAULT_ENGINE_t fault_engine;
+volatile FAULT_SCAN_STATUS_t fault_scan[FAULT_SCAN_CLASS_COUNT];
+
+#define FAULT_ENGINE_GROUP_FAST     0   // polled fault objects of scan class FAULT_SCAN_CLASS_FAST
+#define FAULT_ENGINE_GROUP_SLOW     1   // polled fault objects of scan class FAULT_SCAN_CLASS_SLOW
+#define FAULT_ENGINE_GROUP_EVENT    2   // event-triggered fault objects
+#define FAULT_ENGINE_GROUP_COUNT    3   // number of fault engine groups
+
+#define FAULT_ENGINE_GROUP(fltobj)  (((fltobj)->cfg->trigger == FAULT_TRIGGER_EVENT) ? \
+                FAULT_ENGINE_GROUP_EVENT : (((fltobj)->cfg->scan_class == FAULT_SCAN_CLASS_SLOW) ? \
+                FAULT_ENGINE_GROUP_SLOW : FAULT_ENGINE_GROUP_FAST))
+#endif
+
+/*!fault_group_summary
+ * ***********************************************************************************************
+ * Description:
+ * Fault classes of all tripped fault objects of all fault groups ORed together. The summary is 
+ * updated each time the class summary of a fault group changes. fault_groups_complete is set 
+ * when all enabled fault objects of fault_object_list[] have been assigned to a fault group by 
+ * fault_GroupsBuild(). Otherwise the fault handler falls back to scanning all fault objects.
+ * ***********************************************************************************************/
+#if (USE_FAULT_GROUPS == 1)
+volatile uint16_t fault_group_summary = 0;
+volatile uint16_t fault_groups_built = 0;
+volatile uint16_t fault_groups_complete = 0;
+#endif
+
+/*!fault_pending
+ * ***********************************************************************************************
+ * Description:
+ * Pending fault event bitmap. Bit (n & 0x0F) of word (n >> 4) is set by FAULT_EVENT_RAISE(n) 
+ * when the event-triggered fault object of index n in fault_object_list[] has to be checked. 
+ * ***********************************************************************************************/
+volatile uint16_t fault_pending[FAULT_EVENT_WORDS];
+
+/*!fault_ObjectLoad
+ * ***********************************************************************************************
+ * Parameters:
+ *      FAULT_OBJECT_t* fltobj: Pointer to the fault object to be initialized
+ *      FAULT_OBJECT_DESCRIPTOR_t* cfg: Pointer to the constant settings of the fault object
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (no descriptor or no monitored object declared)
+ *      1: Success
+ * 
+ * Description:
+ * This routine assigns the constant descriptor cfg to the fault object and loads the initial 
+ * status and the default fault condition criteria from the descriptor into the fault object. 
+ * The fault counter is cleared.
+ * ***********************************************************************************************/
+volatile uint16_t fault_ObjectLoad(volatile FAULT_OBJECT_t* fltobj, const FAULT_OBJECT_DESCRIPTOR_t* cfg)
+{
+    fltobj->cfg = cfg;
+    fltobj->group_mask = 0;
+    
+    if (cfg == NULL) { return(0); }
+    
+    fltobj->status.status = cfg->status;
+    fltobj->criteria.counter = 0;
+    fltobj->criteria.fault_ratio = cfg->fault_ratio;
+    fltobj->criteria.trip_level = cfg->trip_level;
+    fltobj->criteria.trip_cnt_threshold = cfg->trip_cnt_threshold;
+    fltobj->criteria.reset_level = cfg->reset_level;
+    fltobj->criteria.reset_cnt_threshold = cfg->reset_cnt_threshold;
+    
+    return(cfg->object != NULL);
+}
+
 /*!CheckFaultCondition
  * ***********************************************************************************************
  * Parameters:
@@ -80,23 +171,56 @@ volatile uint16_t fault_object_list_pointer = 0;
 inline volatile uint16_t CheckFaultCondition(volatile FAULT_OBJECT_t* fltobj)
 {
     volatile uint16_t compare_value = 0;
+    volatile uint16_t fault_ratio = 0, trip_level = 0, reset_level = 0;
     
     // if the fault object is not initialized, exit here
-    if(fltobj->object == NULL) { return(1); }
+    if(!FAULT_OBJECT_LOADED(fltobj)) { return(1); }
+    
+  #if (USE_FAULT_HARDWARE_OBJECTS == 1)
+    // hardware fault objects mirror the comparator output
+    if(fltobj->cfg->hw != NULL)
+    {
+        if(fltobj->cfg->hw->status == NULL) { return(0); } // hardware binding not set up
+        fltobj->status.flags.fltactive = (((*fltobj->cfg->hw->status) & fltobj->cfg->hw->status_mask) != 0);
+        return(1);
+    }
+  #endif
     
     // derive value to monitor
-    compare_value = ((*fltobj->object) & (fltobj->object_bit_mask));
+    compare_value = ((*fltobj->cfg->object) & (fltobj->cfg->object_bit_mask));
+    fault_ratio = fltobj->criteria.fault_ratio;
+    trip_level = fltobj->criteria.trip_level;
+    reset_level = fltobj->criteria.reset_level;
+    
+  #if (USE_FAULT_FILTERS == 1)
+    if(fault_ratio & FAULT_LEVEL_FILTERED)
+    // slope, mean and band criteria are evaluated as "greater than" compare of the derived value
+    {
+        if((fltobj->cfg->filter == NULL) && (fault_ratio != FAULT_LEVEL_BAND)) { return(0); } // filter not set up
+        compare_value = fault_FilterUpdate(fltobj, compare_value);
+        
+        if(fault_ratio == FAULT_LEVEL_BAND)
+        { trip_level = 0; reset_level = 1; } // any distance outside of the band is a fault condition
+        else if(fault_ratio != FAULT_LEVEL_WINDOW_MEAN)
+        { // signed slopes are compared as offset binary numbers
+            compare_value ^= 0x8000; 
+            trip_level ^= 0x8000; 
+            reset_level ^= 0x8000; 
+        }
+        fault_ratio = FAULT_LEVEL_GREATER_THAN;
+    }
+  #endif
     
     // Check the given fault object on threshold violations
-    if(fltobj->criteria.fault_ratio == (FAULT_LEVEL_GREATER_THAN))
+    if(fault_ratio == (FAULT_LEVEL_GREATER_THAN))
     // if the fault level is defined to be greater than a given threshold, 
     // check for upper thresholds violation (including hysteresis when defined)
     {
         
-        if(compare_value > fltobj->criteria.trip_level)
+        if(compare_value > trip_level)
         // if the upper threshold is exceeded, set "fault present" flag
         { fltobj->status.flags.fltactive = 1; } // set "fault present" bit
-        else if(compare_value < fltobj->criteria.reset_level)
+        else if(compare_value < reset_level)
         // if the value is above the upper limit of the hysteresis of the threshold, reset fault flag
         { fltobj->status.flags.fltactive = 0; } // reset "fault present" bit
         else
@@ -104,15 +228,15 @@ inline volatile uint16_t CheckFaultCondition(volatile FAULT_OBJECT_t* fltobj)
         { Nop(); }
         
     }
-    else if (fltobj->criteria.fault_ratio == (FAULT_LEVEL_LESS_THAN))
+    else if (fault_ratio == (FAULT_LEVEL_LESS_THAN))
     // if the fault level is defined to be less than a given threshold, 
     // check for lower thresholds violation (including hysteresis when defined)
     {
         
-        if(compare_value < fltobj->criteria.trip_level)
+        if(compare_value < trip_level)
         // if the lower threshold is exceeded, set "fault present" flag
         { fltobj->status.flags.fltactive = 1; } // set "fault present" bit
-        else if(compare_value > fltobj->criteria.reset_level)
+        else if(compare_value > reset_level)
         // if the value is above the upper limit of the hysteresis of the threshold, reset fault flag
         { fltobj->status.flags.fltactive = 0; } // reset "fault present" bit
         else
@@ -120,10 +244,10 @@ inline volatile uint16_t CheckFaultCondition(volatile FAULT_OBJECT_t* fltobj)
         { Nop(); }
         
     }
-    else if (fltobj->criteria.fault_ratio == (FAULT_LEVEL_EQUAL))
+    else if (fault_ratio == (FAULT_LEVEL_EQUAL))
     // if the fault level is defined to be at a constant number/value, trigger fault (without hysteresis)
     {
-        if(compare_value == fltobj->criteria.trip_level)
+        if(compare_value == trip_level)
         // if the fault value is hit, set the fault flag and increment the fault counter
         { fltobj->status.flags.fltactive = 1; } // set "fault present" bit
         else
@@ -131,10 +255,10 @@ inline volatile uint16_t CheckFaultCondition(volatile FAULT_OBJECT_t* fltobj)
         { fltobj->status.flags.fltactive = 0; } // reset "fault present" bit
 
     }
-    else if (fltobj->criteria.fault_ratio == (FAULT_LEVEL_NOT_EQUAL))
+    else if (fault_ratio == (FAULT_LEVEL_NOT_EQUAL))
     // if the fault level is defined to be "off a constant number/value", trigger fault (without hysteresis)
     {
-        if(compare_value != fltobj->criteria.trip_level)
+        if(compare_value != trip_level)
         // if the fault value is off constant, set the fault flag and increment the fault counter
         { fltobj->status.flags.fltactive = 1; } // set "fault present" bit
         else
@@ -253,6 +377,22 @@ inline volatile uint16_t CheckCPUResetRootCause(void)
     // routines need to be installed
     
     traplog.rcon_reg.reg_block = RCON; // Copy contents of CPU RESET register into monitoring buffer
+    RCON = 0; // Clear reset flags to be able to identify the root cause of the next reset
+    
+    GetTrapStatus(); // Recover trap information captured before a soft reset
+    
+  #if (USE_FAULT_LOG == 1)
+    init_FaultLog(traplog.rcon_reg.flags.por); // Validate persistent fault log
+    fault_LogWrite(FAULT_LOG_EVENT_RESET, 0, traplog.rcon_reg.reg_block);
+  #endif
+    
+  #if (USE_TASK_MANAGER_TRACE == 1)
+    init_Trace(traplog.rcon_reg.flags.por); // Clear trace buffer unless it has been frozen by a trap
+  #endif
+    
+  #if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+    init_BootProfile(traplog.rcon_reg.flags.por); // Start boot profiler unless an interrupted boot has been recorded
+  #endif
     
     if (traplog.rcon_reg.reg_block & FLT_CPU_RESET_CLASS_CRITICAL) {
         // TODO: handle exceptions after restart 
@@ -323,24 +463,38 @@ inline volatile uint16_t CheckCPUResetRootCause(void)
  * ***********************************************************************************************/
 inline volatile uint16_t ExecFaultHandler(volatile FAULT_OBJECT_t* fltobj)
 {
-    volatile uint16_t fres = 0, log_id = 0;
+    volatile uint16_t fres = 0;
     
-    if(fltobj->classes.class & FLT_CLASS_CATASTROPHIC)
+    TRACE_FAULT(TRACE_EVT_FAULT_TRIP, fltobj->cfg->id);
+    SCOPE_EVENT(SCOPE_TRIGGER_FAULT, fltobj->cfg->id);
+    EVENT_POST(EVT_FAULT_TRIP);
+    
+  #if (USE_FAULT_LOG == 1)
+    // capture fault event with a snapshot of the monitored value
+    fault_LogWrite(FAULT_LOG_EVENT_FAULT_TRIP, fltobj->cfg->id, ((*fltobj->cfg->object) & fltobj->cfg->object_bit_mask));
+  #endif
+    
+  #if (USE_FAULT_HARDWARE_OBJECTS == 1)
+    // PWM outputs of hardware fault objects have already been shut down => switch to reset level
+    if(fltobj->cfg->hw != NULL)
+    { fault_HwTrip(fltobj); }
+  #endif
+
+    if(fltobj->cfg->classes & FLT_CLASS_CATASTROPHIC)
     {
         // if fault is of class CATASTROPHIC, force main loop to reset CPU
         task_mgr.status.flags.global_fault = 1; // setting global fault bit
         task_mgr.status.flags.fault_override = true; // setting global fault override bit
         task_mgr.op_mode.mode = OP_MODE_FAULT; // force main scheduler into fault mode
-        log_id = fltobj->id; // ToDo: Log the fault object ID in the traps data structure 
         run_scheduler = 0;
         return(1);
     }
 
     // if fault is of any other class than CATASTROPHIC, perform response. 
     // Multiple responses are supported when the multiple fault classes are specified
-    // by ORing multiple FAULT CLASSES into fltobj.classes
+    // by ORing multiple FAULT CLASSES into fltobj->cfg->classes
 
-    if(fltobj->classes.class & FLT_CLASS_CRITICAL)
+    if(fltobj->cfg->classes & FLT_CLASS_CRITICAL)
     {
         // if fault is of class CRITICAL, set error flag and force scheduler in standby mode
         task_mgr.status.flags.global_fault = 1;  // set global fault bit
@@ -348,26 +502,26 @@ inline volatile uint16_t ExecFaultHandler(volatile FAULT_OBJECT_t* fltobj)
         task_mgr.op_mode.mode = OP_MODE_FAULT; // force main scheduler into fault mode
     }
 
-    if(fltobj->classes.class & FLT_CLASS_WARNING)
+    if(fltobj->cfg->classes & FLT_CLASS_WARNING)
     {
         // if fault is of class CRITICAL, set error flag and force schedule in standby mode
         task_mgr.status.flags.global_warning = 1;   // set global warning bit 
                                                     // and don't take further action
     }
 
-    if(fltobj->classes.class & FLT_CLASS_NOTIFY)
+    if(fltobj->cfg->classes & FLT_CLASS_NOTIFY)
     {
         // if fault is of class CRITICAL, set error flag and force schedule in standby mode
         task_mgr.status.flags.global_notice = 1;  // setting global notify bit
                                                      // and don't take further action
     }
 
-    if(fltobj->classes.class & FLT_CLASS_USER_ACTION)
+    if(fltobj->cfg->classes & FLT_CLASS_USER_ACTION)
     {
         // If a user defined fault handler routine has been specified, 
         // call/execute user defined function of type uint16_t xxxx(void) only
-        if(fltobj->user_fault_action != NULL)
-        { fres = fltobj->user_fault_action(); } // Call/execute user defined function
+        if(fltobj->cfg->user_fault_action != NULL)
+        { fres = fltobj->cfg->user_fault_action(); } // Call/execute user defined function
     }        
         
     return(fres);
@@ -413,12 +567,13 @@ inline volatile uint16_t ExecGlobalFaultFlagRelease(volatile uint16_t fault_clas
     
     // if fault is of any other class than CATASTROPHIC, perform recovery from fault condition. 
     // Multiple responses are supported when multiple fault classes are specified by ORing multiple 
-    // FAULT CLASSES into fltobj.classes
+    // FAULT CLASSES into fltobj->cfg->classes
 
     if((!(fault_class_code & FLT_CLASS_CRITICAL)) && (task_mgr.status.flags.global_fault))
     {
         // if fault is of class CRITICAL, reset error flag and force scheduler in standby mode
         task_mgr.status.flags.global_fault = 0;  // reset global fault bit
+        EVENT_POST(EVT_FAULT_RELEASE);
     }
 
     if((!(fault_class_code & FLT_CLASS_WARNING)) && (task_mgr.status.flags.global_warning))
@@ -462,19 +617,780 @@ inline volatile uint16_t ExecFaultFlagReleaseHandler(volatile FAULT_OBJECT_t* fl
 {
     volatile uint16_t fres = 1;
     
+    TRACE_FAULT(TRACE_EVT_FAULT_RELEASE, fltobj->cfg->id);
+    
+  #if (USE_FAULT_HARDWARE_OBJECTS == 1)
+    // re-arm comparator and release latched PCI fault state of hardware fault objects
+    if(fltobj->cfg->hw != NULL)
+    { fres &= fault_HwRecover(fltobj); }
+  #endif
 
-    if(fltobj->classes.class & FLT_CLASS_USER_ACTION)
+    if(fltobj->cfg->classes & FLT_CLASS_USER_ACTION)
     {
         // If a user defined fault release handler routine has been specified, 
         // call/execute user defined function of type volatile uint16_t xxxx(void) only
-        if(fltobj->user_fault_reset != NULL)
-        { fres &= fltobj->user_fault_reset(); } 
+        if(fltobj->cfg->user_fault_reset != NULL)
+        { fres &= fltobj->cfg->user_fault_reset(); } 
 
     }        
 
     return(fres);
 }
 
+#if (USE_FAULT_FILTERS == 1)
+
+/*!fault_FilterUpdate
+ * ***********************************************************************************************
+ * Parameters: 
+ *      FAULT_OBJECT_t* fltobj: Pointer to a fault object with slope, mean or band criterion
+ *      uint16_t value: Most recent masked sample of the monitored value
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Derived value compared against the trip and reset levels of the fault object:
+ *          - SLOPE_RISING/FALLING: signed difference to the sample captured N checks earlier
+ *          - WINDOW_MEAN: mean of the most recent N samples
+ *          - BAND: distance outside of the band (0 = within the band)
+ * 
+ * Description:
+ * The sample leaving the window is read from the ring buffer and replaced by the most recent 
+ * sample. The slope is the difference of both samples, the running sum of the window mean is 
+ * corrected by both samples and divided by the power-of-two window length by a shift. Until 
+ * the window has been filled, slope and mean are reported as zero.
+ * The upper and lower band limits are given by trip_level and reset_level. While the fault 
+ * condition is active, both limits are moved into the band by the filter hysteresis.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_FilterUpdate(volatile FAULT_OBJECT_t* fltobj, volatile uint16_t value)
+{
+    volatile FAULT_FILTER_t* flt;
+    uint16_t oldest = 0, hi = 0, lo = 0, size = 0;
+    
+    flt = fltobj->cfg->filter;
+    
+    if (fltobj->criteria.fault_ratio == FAULT_LEVEL_BAND)
+    {
+        hi = fltobj->criteria.trip_level;
+        lo = fltobj->criteria.reset_level;
+        
+        if ((flt != NULL) && (fltobj->status.flags.fltactive))
+        { hi -= flt->hysteresis; lo += flt->hysteresis; } // hysteresis while fault condition is active
+        
+        if (value > hi) { return(value - hi); }
+        else if (value < lo) { return(lo - value); }
+        else { return(0); }
+    }
+    
+    // slope and window mean: exchange the oldest sample of the ring buffer
+    size = FAULT_FILTER_SAMPLES(flt->shift);
+    oldest = flt->buffer[flt->index];
+    flt->buffer[flt->index] = value;
+    flt->index = ((flt->index + 1) & (size - 1));
+    flt->sum += value;
+    
+    if (flt->fill < size)
+    { flt->fill++; return(0); } // window not filled yet
+    
+    flt->sum -= oldest;
+    
+    if (fltobj->criteria.fault_ratio == FAULT_LEVEL_SLOPE_RISING)
+    { return(value - oldest); }
+    else if (fltobj->criteria.fault_ratio == FAULT_LEVEL_SLOPE_FALLING)
+    { return(oldest - value); }
+    else
+    { return((uint16_t)(flt->sum >> flt->shift)); }
+    
+}
+
+/*!fault_FilterReset
+ * ***********************************************************************************************
+ * Parameters: 
+ *      FAULT_OBJECT_t* fltobj: Pointer to a fault object with slope, mean or band criterion
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (filter not set up or window length out of range)
+ *      1: Success
+ * 
+ * Description:
+ * This routine validates the fault filter of the given fault object and restarts the capture 
+ * of its sample window. 
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_FilterReset(volatile FAULT_OBJECT_t* fltobj)
+{
+    volatile FAULT_FILTER_t* flt;
+    
+    flt = fltobj->cfg->filter;
+    
+    if (flt == NULL) 
+    { return(fltobj->criteria.fault_ratio == FAULT_LEVEL_BAND); } // band criterion without hysteresis
+    
+    flt->index = 0;
+    flt->fill = 0;
+    flt->sum = 0;
+    
+    if (fltobj->criteria.fault_ratio == FAULT_LEVEL_BAND) { return(1); }
+    if ((flt->buffer == NULL) || (flt->shift > FAULT_FILTER_SHIFT_MAX)) { return(0); }
+    
+    return(1);
+}
+
+#endif  /* USE_FAULT_FILTERS */
+
+#if (USE_FAULT_ENGINE == 1)
+
+/*!fault_EngineCompile
+ * ***********************************************************************************************
+ * Parameters: 
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (unsupported compare type or fault engine capacity exceeded)
+ *      1: Success
+ * 
+ * Description:
+ * This routine compiles all initialized fault objects listed in *fault_object_list[] into the
+ * struct-of-arrays data structure fault_engine. Fault counters and fault flags of the fault 
+ * objects are taken over. Fault objects with unsupported compare type are skipped. Compiled
+ * fault objects are sorted into groups: polled FAST scan class objects first, followed by polled 
+ * SLOW scan class objects starting at index fault_engine.slow_first and event-triggered objects
+ * starting at index fault_engine.event_first.
+ * This function needs to be called every time fault levels, counter thresholds or fault classes
+ * of fault objects or the CPU clock have been changed. (task_TimeBaseUpdate() recompiles the
+ * fault engine after each change of the scheduler tick period or of the CPU clock.)
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_EngineCompile(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0, n = 0, group = 0, key = 0, mode = 0;
+    volatile FAULT_OBJECT_t* fltobj;
+    
+    fault_engine.compiled = 0;
+
+    for (i=0; i<FAULT_ENGINE_WORDS; i++)
+    {
+        fault_engine.active[i] = 0;
+        fault_engine.stat[i] = 0;
+        fault_engine.due[i] = 0;
+    }
+    
+    for (i=0; i<FAULT_EVENT_INDEX_MAX; i++)
+    { fault_engine.index[i] = 0xFFFF; }
+    
+    // Fault objects are sorted into groups: polled FAST scan class objects first, followed by 
+    // polled SLOW scan class objects and event-triggered objects
+    for (group=0; group<FAULT_ENGINE_GROUP_COUNT; group++)
+    {
+        if (group == FAULT_ENGINE_GROUP_SLOW) { fault_engine.slow_first = n; }
+        if (group == FAULT_ENGINE_GROUP_EVENT) { fault_engine.event_first = n; }
+        
+        for (i=0; i<fltobj_list_size; i++)
+        {
+            fltobj = fault_object_list[i];
+
+            // if the fault object is not initialized or does not belong to the recent group, skip it
+            if (!FAULT_OBJECT_LOADED(fltobj)) { continue; }
+            if (FAULT_ENGINE_GROUP(fltobj) != group) { continue; }
+
+            if (n >= FAULT_ENGINE_OBJECTS_MAX)
+            { fres = 0; break; } // fault engine capacity exceeded
+
+            switch (fltobj->criteria.fault_ratio)
+            {
+                case FAULT_LEVEL_GREATER_THAN:
+                    key = 0x0000; mode = FAULT_ENGINE_CMP_HYSTERESIS; break;
+                case FAULT_LEVEL_LESS_THAN:
+                    key = 0xFFFF; mode = FAULT_ENGINE_CMP_HYSTERESIS; break;
+                case FAULT_LEVEL_EQUAL:
+                    key = 0x0000; mode = FAULT_ENGINE_CMP_EQUAL; break;
+                case FAULT_LEVEL_NOT_EQUAL:
+                    key = 0x0000; mode = (FAULT_ENGINE_CMP_EQUAL | FAULT_ENGINE_CMP_INVERT); break;
+              #if (USE_FAULT_FILTERS == 1)
+                case FAULT_LEVEL_SLOPE_RISING:
+                case FAULT_LEVEL_SLOPE_FALLING: // signed slopes are compared as offset binary numbers
+                    key = 0x8000; mode = (FAULT_ENGINE_CMP_HYSTERESIS | FAULT_ENGINE_CMP_FILTER); break;
+                case FAULT_LEVEL_WINDOW_MEAN:
+                case FAULT_LEVEL_BAND:
+                    key = 0x0000; mode = (FAULT_ENGINE_CMP_HYSTERESIS | FAULT_ENGINE_CMP_FILTER); break;
+              #endif
+                default: // unknown/unsupported compare condition => skip fault object
+                    fres = 0; continue;
+            }
+        
+            fault_engine.object[n] = fltobj->cfg->object;
+            fault_engine.mask[n] = fltobj->cfg->object_bit_mask;
+            fault_engine.key[n] = key;
+            fault_engine.mode[n] = mode;
+            fault_engine.trip_level[n] = (fltobj->criteria.trip_level ^ key);
+            fault_engine.reset_level[n] = (fltobj->criteria.reset_level ^ key);
+          #if (USE_FAULT_FILTERS == 1)
+            if (mode & FAULT_ENGINE_CMP_FILTER)
+            {
+                if (!fault_FilterReset(fltobj))
+                { fres = 0; continue; } // fault filter not set up => skip fault object
+                if (fltobj->criteria.fault_ratio == FAULT_LEVEL_BAND)
+                {   // any distance outside of the band is a fault condition
+                    fault_engine.trip_level[n] = 0;
+                    fault_engine.reset_level[n] = 1;
+                }
+            }
+          #endif
+          #if (USE_FAULT_HARDWARE_OBJECTS == 1)
+            if (fltobj->cfg->hw != NULL)
+            {   // hardware fault objects mirror the comparator output (active = status bit != 0)
+                if (fltobj->cfg->hw->status == NULL)
+                { fres = 0; continue; } // hardware binding not set up => skip fault object
+                fault_engine.object[n] = fltobj->cfg->hw->status;
+                fault_engine.mask[n] = fltobj->cfg->hw->status_mask;
+                fault_engine.key[n] = 0x0000;
+                fault_engine.mode[n] = (FAULT_ENGINE_CMP_EQUAL | FAULT_ENGINE_CMP_INVERT);
+                fault_engine.trip_level[n] = 0;
+                fault_engine.reset_level[n] = 0;
+            }
+          #endif
+            fault_engine.trip_cnt_threshold[n] = fltobj->criteria.trip_cnt_threshold;
+            fault_engine.reset_cnt_threshold[n] = fltobj->criteria.reset_cnt_threshold;
+            fault_engine.counter[n] = fltobj->criteria.counter;
+            fault_engine.fault_class[n] = fltobj->cfg->classes;
+            fault_engine.fltobj[n] = fltobj;
+        
+            if (fltobj->status.flags.fltactive)
+            { fault_engine.active[n >> 4] |= (1 << (n & 0x000F)); }
+            if (fltobj->status.flags.fltstat)
+            { fault_engine.stat[n >> 4] |= (1 << (n & 0x000F)); }
+        
+            if (i < FAULT_EVENT_INDEX_MAX)
+            { fault_engine.index[i] = n; } // fault object list index to fault engine index
+            
+            n++;
+        }
+    }
+    
+    fault_engine.count = n;
+    fault_engine.compiled = 1;
+    
+    // Reset scan position and scan latency monitor
+    fault_object_list_pointer = fault_engine.slow_first;
+    for (i=0; i<FAULT_SCAN_CLASS_COUNT; i++)
+    {
+        fault_scan[i].ticks = 0;
+        fault_scan[i].latency = 0;
+        fault_scan[i].latency_max = 0;
+        fault_scan[i].passes = 0;
+    }
+    fault_scan[FAULT_SCAN_CLASS_FAST].latency = 1; // FAST class objects are checked every tick
+    fault_scan[FAULT_SCAN_CLASS_FAST].latency_max = 1;
+  #if (FAULT_SCAN_MODE == FAULT_SCAN_FULL)
+    fault_scan[FAULT_SCAN_CLASS_SLOW].latency = 1; // all fault objects are checked every tick
+    fault_scan[FAULT_SCAN_CLASS_SLOW].latency_max = 1;
+    fault_engine.slow_budget = 0;
+  #else
+    fault_engine.slow_budget = FAULT_SCAN_SLOW_BUDGET; // Convert the time budget into timer ticks of the recent CPU clock
+  #endif
+    
+  #if (USE_FAULT_GROUPS == 1)
+    fres &= fault_GroupsBuild(); // Fault group members and summaries follow the compiled fault objects
+  #endif
+    
+    return(fres);
+}
+
+/*!exec_FaultEngine
+ * ***********************************************************************************************
+ * Parameters: 
+ *      uint16_t first: Index of the first compiled fault object to be evaluated
+ *      uint16_t count: Number of compiled fault objects to be evaluated
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine evaluates a range of fault objects compiled into fault_engine. The fault 
+ * condition check and counter filter of each object are executed by the same branch-free 
+ * sequence:
+ * 
+ *      - hysteresis: active = (value > trip) | (active & !(value < reset))
+ *      - equality:   active = (value == trip) ^ invert
+ *      - counter:    counter is incremented while active != status, otherwise cleared
+ *      - status:     status toggles when counter >= threshold of the recent status
+ * 
+ * Fault objects whose fault check is disabled (fltchken = 0) are skipped. The counter is 
+ * written back to the fault object (fltobj->criteria.counter) in every evaluation. The flag 
+ * bits of the fault objects and fault groups are only written and fault handlers only called 
+ * when a flag has changed.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_FaultEngine(volatile uint16_t first, volatile uint16_t count)
+{
+    volatile uint16_t fres = 1;
+    uint16_t i = 0, last = 0, w = 0, bit_mask = 0;
+    uint16_t value = 0, act = 0, act_old = 0, act_hyst = 0, act_eq = 0, sel = 0;
+    uint16_t stat = 0, diff = 0, threshold = 0, cnt = 0, toggle = 0;
+    
+    last = (first + count);
+    if (last > fault_engine.count) { last = fault_engine.count; }
+    
+    for (i=first; i<last; i++)
+    {
+        // only test objects which have been enabled for fault testing
+        if (!fault_engine.fltobj[i]->status.flags.fltchken) { continue; }
+
+        w = (i >> 4);
+        bit_mask = (1 << (i & 0x000F));
+        
+        // derive value to monitor (LESS_THAN compares are inverted into GREATER_THAN compares)
+        value = ((*fault_engine.object[i]) & fault_engine.mask[i]);
+      #if (USE_FAULT_FILTERS == 1)
+        if (fault_engine.mode[i] & FAULT_ENGINE_CMP_FILTER)
+        { value = fault_FilterUpdate(fault_engine.fltobj[i], value); } // slope, mean and band criteria
+      #endif
+        value ^= fault_engine.key[i];
+
+        // fault condition check
+        act_old = ((fault_engine.active[w] & bit_mask) != 0);
+        act_hyst = ((value > fault_engine.trip_level[i]) | 
+                    (act_old & (value >= fault_engine.reset_level[i])));
+        act_eq = ((value == fault_engine.trip_level[i]) ^ 
+                    ((fault_engine.mode[i] & FAULT_ENGINE_CMP_INVERT) != 0));
+        sel = (0 - (fault_engine.mode[i] & FAULT_ENGINE_CMP_EQUAL)); // 0x0000 = hysteresis, 0xFFFF = equality
+        act = (((act_hyst & ~sel) | (act_eq & sel)) & 0x0001);
+
+        // fault counter filter
+        stat = ((fault_engine.stat[w] & bit_mask) != 0);
+        diff = (act ^ stat);
+        cnt = ((fault_engine.counter[i] + 1) & (0 - diff)); // count while active and status differ, otherwise reset
+        threshold = (fault_engine.trip_cnt_threshold[i] + 
+            ((fault_engine.reset_cnt_threshold[i] - fault_engine.trip_cnt_threshold[i]) & (0 - stat)));
+        toggle = (diff & (cnt >= threshold));
+        stat ^= toggle;
+        fault_engine.counter[i] = cnt;
+        fault_engine.fltobj[i]->criteria.counter = cnt; // keep fault object counter readable by users
+
+        // update packed flags
+        fault_engine.active[w] = ((fault_engine.active[w] & ~bit_mask) | (bit_mask & (0 - act)));
+        fault_engine.stat[w] = ((fault_engine.stat[w] & ~bit_mask) | (bit_mask & (0 - stat)));
+
+        // update fault object and call fault handler only when flags have changed
+        if (toggle | (act ^ act_old))
+        {
+            fault_engine.fltobj[i]->status.flags.fltactive = act;
+            fault_engine.fltobj[i]->status.flags.fltstat = stat;
+          #if (USE_FAULT_GROUPS == 1)
+            fault_GroupUpdate(fault_engine.fltobj[i]); // update flags and class summary of the fault group
+          #endif
+
+            if (toggle & stat)
+            { fres &= ExecFaultHandler(fault_engine.fltobj[i]); } // Set global fault flags and execute appropriate response
+        }
+    }
+    
+    return(fres);
+}
+
+/*!fault_EngineClassPresent
+ * ***********************************************************************************************
+ * Parameters: 
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Fault classes of all enabled fault objects with active fault status ORed together
+ * 
+ * Description:
+ * This routine tracks the global fault status by scanning the packed fault status words. 
+ * Words without active fault status are skipped with one compare.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_EngineClassPresent(void)
+{
+    uint16_t i = 0, w = 0, stat_word = 0, class_present = 0;
+    
+    for (w=0; w<FAULT_ENGINE_WORDS; w++)
+    {
+        stat_word = fault_engine.stat[w];
+        i = (w << 4);
+        
+        while (stat_word)
+        {
+            if ((stat_word & 0x0001) && (fault_engine.fltobj[i]->status.flags.fltchken))
+            { class_present |= fault_engine.fault_class[i]; }
+            stat_word >>= 1;
+            i++;
+        }
+    }
+    
+    return(class_present);
+}
+
+#if (FAULT_SCAN_MODE == FAULT_SCAN_BUDGETED)
+
+/*!exec_FaultCheckSequential
+ * ***********************************************************************************************
+ * Parameters: 
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine checks the fault objects of scan class FAULT_SCAN_CLASS_SLOW sequentially. 
+ * Starting at the recent scan position, fault objects are checked until the time budget 
+ * FAULT_SCAN_SLOW_BUDGET has been used up or all objects of the class have been checked once.
+ * The time budget is converted into timer ticks by fault_EngineCompile().
+ * At least one fault object is checked per call. When the end of the class has been reached,
+ * the number of scheduler ticks required for the complete scan is stored as scan latency of 
+ * the slow scan class.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_FaultCheckSequential(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t checked = 0, slow_count = 0, t_start = 0, t_now = 0;
+    
+    slow_count = (fault_engine.event_first - fault_engine.slow_first);
+    if (slow_count == 0) { return(1); } // no slow scan class objects
+    
+    fault_scan[FAULT_SCAN_CLASS_SLOW].ticks++;
+    t_start = TASK_MGR_TIMER_COUNTER_REGISTER;
+
+    do {
+        
+        // check next fault object
+        fres &= exec_FaultEngine(fault_object_list_pointer, 1);
+        checked++;
+        
+        // check fault_object_list_pointer overrun
+        if (++fault_object_list_pointer >= fault_engine.event_first)
+        {
+            fault_object_list_pointer = fault_engine.slow_first;
+            
+            fault_scan[FAULT_SCAN_CLASS_SLOW].latency = fault_scan[FAULT_SCAN_CLASS_SLOW].ticks;
+            if (fault_scan[FAULT_SCAN_CLASS_SLOW].latency > fault_scan[FAULT_SCAN_CLASS_SLOW].latency_max)
+            { fault_scan[FAULT_SCAN_CLASS_SLOW].latency_max = fault_scan[FAULT_SCAN_CLASS_SLOW].latency; }
+            fault_scan[FAULT_SCAN_CLASS_SLOW].passes++;
+            fault_scan[FAULT_SCAN_CLASS_SLOW].ticks = 0;
+        }
+        
+        t_now = TASK_MGR_TIMER_COUNTER_REGISTER;
+        if (t_now < t_start) { break; } // time slot has expired
+        
+    } while ((checked < slow_count) && ((t_now - t_start) < fault_engine.slow_budget));
+    
+    return(fres);
+
+}
+
+#endif  /* FAULT_SCAN_MODE */
+
+#endif  /* USE_FAULT_ENGINE */
+
+/*!fault_ClaimPendingEvents
+ * ***********************************************************************************************
+ * Parameters: 
+ *      uint16_t* pending: Pointer to an array of FAULT_EVENT_WORDS words the pending fault 
+ *          events will be moved to
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: No fault event pending
+ *      1: Fault events have been claimed
+ * 
+ * Description:
+ * This routine moves the pending fault event bitmap into the given buffer and clears it. Event 
+ * sources only set bits by single bit-set instructions. Only words with pending events are read
+ * and cleared under raised CPU priority level, so that no event raised by an interrupt service 
+ * routine gets lost.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_ClaimPendingEvents(volatile uint16_t* pending)
+{
+    volatile uint16_t w = 0, any = 0, ipl_buffer = 0;
+    
+    for (w=0; w<FAULT_EVENT_WORDS; w++)
+    {
+        pending[w] = 0;
+        
+        if (fault_pending[w])
+        {
+            SET_AND_SAVE_CPU_IPL(ipl_buffer, 7); // Hold off all interrupts for two instruction cycles
+            pending[w] = fault_pending[w];
+            fault_pending[w] = 0;
+            RESTORE_CPU_IPL(ipl_buffer);
+            any = 1;
+        }
+    }
+    
+    return(any);
+}
+
+#if (USE_FAULT_ENGINE == 1)
+
+/*!exec_FaultEngineEvents
+ * ***********************************************************************************************
+ * Parameters: 
+ *      uint16_t* pending: Pointer to the claimed pending fault event bitmap
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine evaluates event-triggered fault objects compiled into fault_engine. An object is
+ * only checked when a fault event is pending or while its fault condition is active or its fault
+ * status is set, so that fault counter filters and fault releases are handled as for polled 
+ * fault objects. Idle event-triggered fault objects cause no polling effort.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_FaultEngineEvents(volatile uint16_t* pending)
+{
+    volatile uint16_t fres = 1;
+    uint16_t i = 0, w = 0, k = 0, word = 0;
+    
+    // Map pending events from fault object list index to fault engine index
+    for (w=0; w<FAULT_EVENT_WORDS; w++)
+    {
+        word = pending[w];
+        k = (w << 4);
+        
+        while (word)
+        {
+            if ((word & 0x0001) && (fault_engine.index[k] != 0xFFFF))
+            { fault_engine.due[fault_engine.index[k] >> 4] |= (1 << (fault_engine.index[k] & 0x000F)); }
+            word >>= 1;
+            k++;
+        }
+    }
+    
+    // Check all event-triggered fault objects which are due or not idle
+    for (i=fault_engine.event_first; i<fault_engine.count; i++)
+    {
+        w = (i >> 4);
+        if ((fault_engine.due[w] | fault_engine.active[w] | fault_engine.stat[w]) & (1 << (i & 0x000F)))
+        { fres &= exec_FaultEngine(i, 1); }
+    }
+    
+    for (w=0; w<FAULT_ENGINE_WORDS; w++)
+    { fault_engine.due[w] = 0; }
+    
+    return(fres);
+}
+
+#endif  /* USE_FAULT_ENGINE */
+
+#if (USE_FAULT_GROUPS == 1)
+
+/*!fault_GroupsBuild
+ * ***********************************************************************************************
+ * Parameters: 
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (invalid group index or fault group capacity exceeded)
+ *      1: Success
+ * 
+ * Description:
+ * This routine assigns all initialized fault objects of fault_object_list[] to the fault group 
+ * given by their group setting. The member flag bit of each fault object is stored in its 
+ * group_mask. Flag words and class summaries of all groups are rebuilt from the recent flags of 
+ * their members. Fault objects which have tripped before are marked for recovery.
+ * When any enabled fault object has not been assigned to a group, fault_groups_complete is 
+ * cleared and the fault handler falls back to scanning all fault objects.
+ * This function needs to be called every time fault objects are enabled/disabled or their 
+ * fault classes or group assignments have been changed.
+ * ***********************************************************************************************/
+volatile uint16_t fault_GroupsBuild(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0, n = 0, complete = 1;
+    volatile FAULT_OBJECT_t* fltobj;
+    volatile FAULT_GROUP_t* grp;
+    
+    fault_groups_complete = 0;
+    
+    for (i=0; i<fault_group_count; i++)
+    {
+        fault_group[i].active = 0;
+        fault_group[i].stat = 0;
+        fault_group[i].classes = 0;
+        fault_group[i].recover = 0;
+        fault_group[i].members = 0;
+        for (n=0; n<FAULT_GROUP_MEMBERS_MAX; n++)
+        { fault_group[i].member[n] = NULL; }
+    }
+    
+    for (i=0; i<fltobj_list_size; i++)
+    {
+        fltobj = fault_object_list[i];
+        fltobj->group_mask = 0;
+        
+        // if the fault object is not initialized, skip it
+        if (!FAULT_OBJECT_LOADED(fltobj)) { continue; }
+        
+        if (fltobj->cfg->group >= fault_group_count)
+        {
+            if (fltobj->cfg->group != FAULT_GROUP_NONE) { fres = 0; } // invalid group index
+            if (fltobj->status.flags.fltchken) { complete = 0; }
+            continue;
+        }
+        
+        grp = &fault_group[fltobj->cfg->group];
+        
+        // find the next free member flag bit
+        for (n=0; n<FAULT_GROUP_MEMBERS_MAX; n++)
+        { if (!(grp->members & (1 << n))) { break; } }
+        
+        if (n >= FAULT_GROUP_MEMBERS_MAX)
+        {   // fault group capacity exceeded
+            fres = 0; 
+            if (fltobj->status.flags.fltchken) { complete = 0; }
+            continue; 
+        }
+        
+        fltobj->group_mask = (1 << n);
+        grp->member[n] = fltobj;
+        grp->members |= fltobj->group_mask;
+        
+        if (fltobj->status.flags.fltactive)
+        { grp->active |= fltobj->group_mask; }
+        if (fltobj->status.flags.fltstat)
+        { 
+            grp->stat |= fltobj->group_mask; 
+            grp->recover |= fltobj->group_mask;
+        }
+    }
+    
+    fault_group_summary = 0;
+    for (i=0; i<fault_group_count; i++)
+    { fres &= fault_GroupSummary(&fault_group[i]); }
+    
+    fault_groups_built = 1;
+    fault_groups_complete = complete;
+    
+    return(fres);
+}
+
+/*!fault_GroupUpdate
+ * ***********************************************************************************************
+ * Parameters: 
+ *      FAULT_OBJECT_t* fltobj: Pointer to the fault object whose flags may have changed
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine copies the fault active and fault status flags of the given fault object into 
+ * the flag words of its fault group. The class summaries are only rebuilt when the fault status 
+ * has changed. Fault objects which have tripped are marked for recovery.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_GroupUpdate(volatile FAULT_OBJECT_t* fltobj)
+{
+    volatile uint16_t fres = 1;
+    uint16_t bit_mask = 0, stat = 0;
+    volatile FAULT_GROUP_t* grp;
+    
+    bit_mask = fltobj->group_mask;
+    if (bit_mask == 0) { return(1); } // fault object is not assigned to a group
+    
+    grp = &fault_group[fltobj->cfg->group];
+    
+    if (fltobj->status.flags.fltactive)
+    { grp->active |= bit_mask; }
+    else
+    { grp->active &= ~bit_mask; }
+    
+    stat = (bit_mask & (0 - (uint16_t)fltobj->status.flags.fltstat));
+    
+    if ((grp->stat & bit_mask) != stat)
+    {
+        grp->stat = ((grp->stat & ~bit_mask) | stat);
+        grp->recover |= stat;
+        fres &= fault_GroupSummary(grp);
+    }
+    
+    return(fres);
+}
+
+/*!fault_GroupSummary
+ * ***********************************************************************************************
+ * Parameters: 
+ *      FAULT_GROUP_t* grp: Pointer to the fault group
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine rebuilds the fault class summary of the given fault group from its tripped and 
+ * enabled members and the global summary fault_group_summary from the summaries of all groups.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_GroupSummary(volatile FAULT_GROUP_t* grp)
+{
+    uint16_t i = 0, stat_word = 0, classes = 0;
+    
+    stat_word = grp->stat;
+    
+    while (stat_word)
+    {
+        if ((stat_word & 0x0001) && (grp->member[i]->status.flags.fltchken))
+        { classes |= grp->member[i]->cfg->classes; }
+        stat_word >>= 1;
+        i++;
+    }
+    
+    grp->classes = classes;
+    
+    classes = 0;
+    for (i=0; i<fault_group_count; i++)
+    { classes |= fault_group[i].classes; }
+    fault_group_summary = classes;
+    
+    return(1);
+}
+
+/*!fault_GroupsRelease
+ * ***********************************************************************************************
+ * Parameters: 
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine executes the fault release handlers of all enabled fault objects which have 
+ * tripped since the previous recovery and clears their recovery flags. Groups without tripped 
+ * members are skipped with one compare.
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_GroupsRelease(void)
+{
+    volatile uint16_t fres = 1;
+    uint16_t g = 0, i = 0, recover = 0;
+    
+    for (g=0; g<fault_group_count; g++)
+    {
+        recover = fault_group[g].recover;
+        fault_group[g].recover = 0;
+        i = 0;
+        
+        while (recover)
+        {
+            if ((recover & 0x0001) && (fault_group[g].member[i]->status.flags.fltchken))
+            { fres &= ExecFaultFlagReleaseHandler(fault_group[g].member[i]); }
+            recover >>= 1;
+            i++;
+        }
+    }
+    
+    return(fres);
+}
+
+#endif  /* USE_FAULT_GROUPS */
+
 /*!exec_FaultCheckAll
  * ***********************************************************************************************
  * Parameters: 
@@ -488,27 +1404,79 @@ inline volatile uint16_t ExecFaultFlagReleaseHandler(volatile FAULT_OBJECT_t* fl
  * Description:
  * This routine checks all fault objects listed in *fault_object_list[] in one execution cycle.
  * any fault action triggered will be executed immediately after every individual fault object 
- * check.
+ * check. When fault groups are enabled, the global fault status is taken from the fault group 
+ * summary and recovery handlers are only executed for fault objects which have tripped.
  * ***********************************************************************************************/
 inline uint16_t volatile exec_FaultCheckAll(void)
 {
     volatile uint16_t i=0, global_fault_present=0, fres=1;
+    volatile uint16_t pending[FAULT_EVENT_WORDS];
+    
+    // Claim fault events raised since the last fault check
+    fault_ClaimPendingEvents(&pending[0]);
+    
+  #if (USE_FAULT_GROUPS == 1) && (USE_FAULT_ENGINE != 1)
+    if (!fault_groups_built)
+    { fres &= fault_GroupsBuild(); }
+  #endif
+    
+#if (USE_FAULT_ENGINE == 1)
+
+    if (!fault_engine.compiled)
+    { fres &= fault_EngineCompile(); }
+    
+  #if (FAULT_SCAN_MODE == FAULT_SCAN_BUDGETED)
+    // Evaluate all FAST class fault objects and continue incremental scan of SLOW class objects
+    fres &= exec_FaultEngine(0, fault_engine.slow_first);
+    fres &= exec_FaultCheckSequential();
+  #else
+    // Evaluate all polled fault objects
+    fres &= exec_FaultEngine(0, fault_engine.event_first);
+  #endif
+    
+    // Evaluate event-triggered fault objects
+    fres &= exec_FaultEngineEvents(&pending[0]);
+    
+    // track global fault status
+  #if (USE_FAULT_GROUPS == 1)
+    if (fault_groups_complete)
+    { global_fault_present = fault_group_summary; } // incrementally updated by the fault groups
+    else
+  #endif
+    { global_fault_present |= fault_EngineClassPresent(); }
+
+#else
     
     // Scan through all fault objects for violation of fault conditions
     for (i=0; i<fltobj_list_size; i++)
     {
+        if (fault_object_list[i]->cfg == NULL) { continue; } // fault object not initialized
+        
+        // event-triggered objects are only tested when an event is pending or while they are not idle
+        if ((fault_object_list[i]->cfg->trigger == FAULT_TRIGGER_EVENT) &&
+            (!fault_object_list[i]->status.flags.fltactive) && (!fault_object_list[i]->status.flags.fltstat))
+        {
+            if ((i >= FAULT_EVENT_INDEX_MAX) || (!(pending[i >> 4] & (1 << (i & 0x000F)))))
+            { continue; }
+        }
+        
         // only test objects which have been enabled for fault testing
         if(fault_object_list[i]->status.flags.fltchken)
         {
             fres &= CheckFaultCondition(fault_object_list[i]);  // Check fault condition
             fres &= SetFaultCondition(fault_object_list[i]);    // Set fault flags and execute user fault function
+          #if (USE_FAULT_GROUPS == 1)
+            fres &= fault_GroupUpdate(fault_object_list[i]);    // Update flags and class summary of the fault group
+          #endif
 
             // track global fault status
             if(fault_object_list[i]->status.flags.fltstat)
-            { global_fault_present |= fault_object_list[i]->classes.class; }
+            { global_fault_present |= fault_object_list[i]->cfg->classes; }
 
         }
     }
+    
+#endif
 
     // Reset fault flags if no fault conditions are present
     fres &= ExecGlobalFaultFlagRelease((FAULT_OBJECT_CLASS_e)global_fault_present);
@@ -516,55 +1484,39 @@ inline uint16_t volatile exec_FaultCheckAll(void)
     // Set/reset operating mode when global fault flag has been reset 
     if((task_mgr.op_mode.mode == OP_MODE_FAULT) && (!task_mgr.status.flags.global_fault))
     { 
+      #if (USE_FAULT_LOG == 1)
+        fault_LogWrite(FAULT_LOG_EVENT_FAULT_RECOVERY, 0, 0);
+      #endif
+        
         // when recovering from active fault, check if user recovery functions have to be executed
-        for (i=0; i<fltobj_list_size; i++)
+      #if (USE_FAULT_GROUPS == 1)
+        if (fault_groups_complete)
+        { fres &= fault_GroupsRelease(); } // only fault objects which have tripped
+        else
+      #endif
         {
-            if(fault_object_list[i]->status.flags.fltchken)
-            { fres &= ExecFaultFlagReleaseHandler(fault_object_list[i]); }
-        }    
+            for (i=0; i<fltobj_list_size; i++)
+            {
+                if(fault_object_list[i]->status.flags.fltchken)
+                { fres &= ExecFaultFlagReleaseHandler(fault_object_list[i]); }
+            }    
+        }
 
         task_mgr.status.flags.fault_override = false;   // Reset global fault override flag
         task_mgr.status.flags.startup_sequence_complete = false; // Reset startup sequence complete flag
+        EVENT_POST(EVT_FAULT_RELEASE);
         task_mgr.pre_op_mode.mode = OP_MODE_FAULT;  // set pre_op_mode to provoke op-mode switch-over
         task_mgr.op_mode.mode = OP_MODE_SYSTEM_STARTUP; // set op_mode to provoke op-mode switch-over
 
     } 
         
-    return(fres);
-
-}
+  #if (USE_FAULT_LOG == 1) && (USE_FAULT_LOG_FLASH == 1)
+    // Copy fault log records into program memory in the background
+    fres &= exec_FaultLogFlush();
+  #endif
 
-/*!exec_FaultCheckSequential
- * ***********************************************************************************************
- * Parameters: 
- *      (none)
- * 
- * Return:
- *      type: uint16_t
- *      0: Failure
- *      1: Success
- * 
- * Description:
- * This routine checks one fault object listed in *fault_object_list[] sequentially, one at a time
- * and only one per function call. With every call the fault_object_list_pointer is incremented for
- * the next function call. 
- * Any fault action triggered by any of the fault objects, will be executed immediately after every 
- * individual fault object check.
- * ***********************************************************************************************/
-/*
-uint16_t volatile exec_FaultCheckSequential(void)
-{
-    volatile uint16_t fres = 0;
-    
-    // check next fault object
-    fres = CheckFaultCondition(fault_object_list[fault_object_list_pointer]);
-    fres = SetFaultCondition(fault_object_list[fault_object_list_pointer]);
-
-    // check fault_object_list_pointer overrun
-    if(fault_object_list_pointer++ >= fltobj_list_size) fault_object_list_pointer = 0;
-    
     return(fres);
 
 }
-*/
+
 /*************************************************************************************************/
@@ -0,0 +1,190 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fdrv_FaultHardware.c
+ * ****************************************************************************
+ * File:   fdrv_FaultHardware.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides functions binding fault objects to the analog
+ * comparator/DAC and PWM PCI fault logic of dsPIC33C devices. Peripheral 
+ * registers are accessed by instance index using the register block offsets
+ * of the device register map.
+ * 
+ * History:
+ * Created on October 14, 2026, 09:00 AM
+ ******************************************************************************/
+
+#include "xc.h"
+#include <stdint.h>
+#include <stddef.h>
+#include "_root/generic/fdrv_FaultHandler.h"
+
+#if (USE_FAULT_HARDWARE_OBJECTS == 1)
+
+/* Register block offsets (in words) between peripheral instances */
+#define FAULT_HW_DAC_REG_OFFSET     0x0008  // DAC1CONL to DAC2CONL (16 bytes)
+
+/* Peripheral register access by instance index */
+#define FAULT_HW_DACxCONL(n)        (*((volatile uint16_t*)&DAC1CONL + (((n)-1) * FAULT_HW_DAC_REG_OFFSET)))
+#define FAULT_HW_DACxDATH(n)        (*((volatile uint16_t*)&DAC1DATH + (((n)-1) * FAULT_HW_DAC_REG_OFFSET)))
+#define FAULT_HW_PGxFPCIL(n)        (*((volatile uint16_t*)&PG1FPCIL + (((n)-1) * FAULT_HW_PG_REG_OFFSET)))
+#define FAULT_HW_PGxFPCIH(n)        (*((volatile uint16_t*)&PG1FPCIH + (((n)-1) * FAULT_HW_PG_REG_OFFSET)))
+
+/* Register bit masks */
+#define FAULT_HW_DACCTRL1L_DACON    0b1000000000000000  // DAC module enable
+#define FAULT_HW_DACxCONL_DACEN     0b1000000000000000  // DAC/comparator instance enable
+#define FAULT_HW_DACxCONL_CMPSTAT   0b0000000010000000  // comparator output status
+#define FAULT_HW_DACxCONL_CMPPOL    0b0000000001000000  // comparator output polarity (1 = inverted)
+#define FAULT_HW_DACxCONL_INSEL     0b0000000000111000  // comparator input selection INSEL<2:0>
+#define FAULT_HW_DACxDATH_MASK      0x0FFF              // 12-bit DAC data
+#define FAULT_HW_PGxFPCIL_SWTERM    0b0000000010000000  // PCI software termination
+#define FAULT_HW_PGxFPCIL_PSS       0b0000000000011111  // PCI source selection PSS<4:0>
+#define FAULT_HW_PGxFPCIH_ACP_LATCHED 0b0000001100000000 // PCI acceptance criteria: latched
+
+/*!fault_HwBind
+ * ***********************************************************************************************
+ * Parameters:
+ *      FAULT_OBJECT_t* fltobj: Pointer to a fault object with hardware binding fltobj->cfg->hw
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine programs the comparator/DAC instance declared in the hardware binding of the 
+ * fault object with criteria.trip_level and the comparator polarity derived from 
+ * criteria.fault_ratio. The Fault PCI input of the declared PWM generator is set up to accept 
+ * the comparator output as latched fault source, which is only terminated by software. 
+ * Finally the status pointer of the binding is set to the comparator status bit, which is 
+ * mirrored by the software fault object.
+ * 
+ * This function has to be called after the fault object has been initialized and before the 
+ * fault engine gets compiled.
+ * ***********************************************************************************************/
+volatile uint16_t fault_HwBind(volatile FAULT_OBJECT_t* fltobj)
+{
+    volatile FAULT_HW_BINDING_t* hw;
+    volatile uint16_t regbuf = 0;
+    
+    if (fltobj->cfg == NULL) { return(0); }
+    hw = fltobj->cfg->hw;
+    if (hw == NULL) { return(0); }
+    if ((hw->dac_instance == 0) || (hw->pwm_instance == 0)) { return(0); }
+
+    // only GREATER_THAN and LESS_THAN comparisons can be executed by the comparator
+    if ((fltobj->criteria.fault_ratio != FAULT_LEVEL_GREATER_THAN) && 
+        (fltobj->criteria.fault_ratio != FAULT_LEVEL_LESS_THAN))
+    { return(0); }
+    
+    // Set up comparator/DAC instance (disabled while being configured)
+    FAULT_HW_DACxCONL(hw->dac_instance) &= ~FAULT_HW_DACxCONL_DACEN;
+    
+    regbuf = FAULT_HW_DACxCONL(hw->dac_instance);
+    regbuf &= ~(FAULT_HW_DACxCONL_INSEL | FAULT_HW_DACxCONL_CMPPOL);
+    regbuf |= ((hw->cmp_input << 3) & FAULT_HW_DACxCONL_INSEL);
+    if (fltobj->criteria.fault_ratio == FAULT_LEVEL_LESS_THAN)
+    { regbuf |= FAULT_HW_DACxCONL_CMPPOL; } // output is active when signal drops below the DAC level
+    FAULT_HW_DACxCONL(hw->dac_instance) = regbuf;
+
+    FAULT_HW_DACxDATH(hw->dac_instance) = (fltobj->criteria.trip_level & FAULT_HW_DACxDATH_MASK);
+    
+    // Set up PWM generator Fault PCI logic (latched, terminated by software only)
+    regbuf = FAULT_HW_PGxIOCONL(hw->pwm_instance);
+    regbuf &= ~FAULT_HW_PGxIOCONL_FLTDAT;
+    regbuf |= ((hw->fault_state << 6) & FAULT_HW_PGxIOCONL_FLTDAT);
+    FAULT_HW_PGxIOCONL(hw->pwm_instance) = regbuf;
+
+    FAULT_HW_PGxFPCIH(hw->pwm_instance) = FAULT_HW_PGxFPCIH_ACP_LATCHED;
+    FAULT_HW_PGxFPCIL(hw->pwm_instance) = (hw->pci_source & FAULT_HW_PGxFPCIL_PSS);
+    
+    // Enable comparator/DAC
+    FAULT_HW_DACxCONL(hw->dac_instance) |= FAULT_HW_DACxCONL_DACEN;
+    DACCTRL1L |= FAULT_HW_DACCTRL1L_DACON;
+    
+    // Mirror comparator output in the software fault object
+    hw->status = &FAULT_HW_DACxCONL(hw->dac_instance);
+    hw->status_mask = FAULT_HW_DACxCONL_CMPSTAT;
+    
+    return(1);
+}
+
+/*!fault_HwTrip
+ * ***********************************************************************************************
+ * Parameters:
+ *      FAULT_OBJECT_t* fltobj: Pointer to a fault object with hardware binding fltobj->cfg->hw
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by the fault handler when the fault status of a hardware fault object
+ * has been set. The PWM outputs have already been shut down by the PCI logic. The DAC is 
+ * reprogrammed with criteria.reset_level so that the comparator output only resets when the 
+ * monitored signal has returned within the release threshold.
+ * ***********************************************************************************************/
+volatile uint16_t fault_HwTrip(volatile FAULT_OBJECT_t* fltobj)
+{
+    volatile FAULT_HW_BINDING_t* hw;
+    
+    hw = fltobj->cfg->hw;
+    if ((hw == NULL) || (hw->status == NULL)) { return(0); }
+    
+    FAULT_HW_DACxDATH(hw->dac_instance) = (fltobj->criteria.reset_level & FAULT_HW_DACxDATH_MASK);
+    
+    return(1);
+}
+
+/*!fault_HwRecover
+ * ***********************************************************************************************
+ * Parameters:
+ *      FAULT_OBJECT_t* fltobj: Pointer to a fault object with hardware binding fltobj->cfg->hw
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by the fault handler when recovering from the fault mode. The DAC is 
+ * set back to criteria.trip_level and the latched PCI fault state of the PWM generator is 
+ * terminated, releasing the PWM outputs.
+ * ***********************************************************************************************/
+volatile uint16_t fault_HwRecover(volatile FAULT_OBJECT_t* fltobj)
+{
+    volatile FAULT_HW_BINDING_t* hw;
+    
+    hw = fltobj->cfg->hw;
+    if ((hw == NULL) || (hw->status == NULL)) { return(0); }
+    
+    FAULT_HW_DACxDATH(hw->dac_instance) = (fltobj->criteria.trip_level & FAULT_HW_DACxDATH_MASK);
+    FAULT_HW_PGxFPCIL(hw->pwm_instance) |= FAULT_HW_PGxFPCIL_SWTERM; // terminate latched PCI fault
+    
+    return(1);
+}
+
+#endif
+
+// EOF
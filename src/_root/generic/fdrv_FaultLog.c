@@ -0,0 +1,422 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fdrv_FaultLog.c
+ * ****************************************************************************
+ * File:   fdrv_FaultLog.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the persistent fault and trap event log. Records
+ * are written into a ring buffer in persistent RAM and flushed into reserved
+ * program memory pages with wear leveling.
+ * 
+ * History:
+ * Created on October 14, 2026, 11:00 AM
+ ******************************************************************************/
+
+#include "xc.h"
+#include <stdint.h>
+#include <stddef.h>
+#include "_root/generic/fdrv_FaultLog.h"
+#include "_root/config/globals.h"
+
+#if (USE_FAULT_LOG == 1)
+
+/* private function prototypes */
+inline volatile uint16_t fault_LogCheckWord(void);
+#if (USE_FAULT_LOG_FLASH == 1)
+inline volatile uint16_t fault_LogFlashRead(volatile uint32_t address);
+inline volatile uint16_t fault_LogFlashSlotBlank(volatile uint16_t slot);
+inline volatile uint16_t fault_LogFlashCommand(volatile uint32_t address, volatile uint16_t nvm_op, 
+                volatile uint16_t word_low, volatile uint16_t word_high);
+#endif
+
+/*!fault_log
+ * ***********************************************************************************************
+ * Description:
+ * Persistent RAM ring buffer of fault log records and its status. These variables are not 
+ * initialized by the start-up code and keep their contents across soft resets.
+ * ***********************************************************************************************/
+volatile FAULT_LOG_STATUS_t __attribute__((__persistent__))fault_log_status;
+volatile FAULT_LOG_RECORD_t __attribute__((__persistent__))fault_log[FAULT_LOG_DEPTH];
+
+#if (USE_FAULT_LOG_FLASH == 1)
+
+#define FAULT_LOG_FLASH_WORDS       (FAULT_LOG_FLASH_PAGES * (FAULT_LOG_FLASH_PAGE_SIZE >> 1)) // one 16-bit word per instruction word
+#define FAULT_LOG_FLASH_SLOTS       (FAULT_LOG_FLASH_WORDS / FAULT_LOG_RECORD_WORDS) // records in program memory
+#define FAULT_LOG_PAGE_SLOTS        ((FAULT_LOG_FLASH_PAGE_SIZE >> 1) / FAULT_LOG_RECORD_WORDS) // records per page
+#define FAULT_LOG_SLOT_SIZE         (FAULT_LOG_RECORD_WORDS << 1) // record size in PC units
+#define FAULT_LOG_DWORD_STEPS       (FAULT_LOG_RECORD_WORDS >> 1) // double-word writes per record
+
+#define FAULT_LOG_NVMOP_DWORD_WRITE 0x4001  // NVMCON: WREN = 1, NVMOP = double-word program
+#define FAULT_LOG_NVMOP_PAGE_ERASE  0x4003  // NVMCON: WREN = 1, NVMOP = page erase
+#define FAULT_LOG_NVM_LATCH_PAGE    0x00FA  // TBLPAG of the NVM write latches
+#define FAULT_LOG_PAGE_NONE         0xFFFF  // no page has been erased since reset
+
+/*!fault_log_flash
+ * ***********************************************************************************************
+ * Description:
+ * Program memory region reserved for the fault log. The region is aligned to a page boundary,
+ * not programmed by the device programmer and only written by exec_FaultLogFlush().
+ * ***********************************************************************************************/
+const uint16_t __attribute__((space(prog), aligned(FAULT_LOG_FLASH_PAGE_SIZE), noload))
+                fault_log_flash[FAULT_LOG_FLASH_WORDS];
+
+volatile uint32_t fault_log_flash_base = 0; // program memory address of fault_log_flash[]
+volatile uint16_t fault_log_flash_slot = 0; // record slot written next
+volatile uint16_t fault_log_flash_step = 0; // double-word write step of the recent record
+volatile uint16_t fault_log_flash_erased = FAULT_LOG_PAGE_NONE; // page erased most recently
+
+#endif
+
+/*!fault_LogCheckWord
+ * ***********************************************************************************************
+ * Description:
+ * Calculates the check word of the ring buffer status
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_LogCheckWord(void)
+{
+    return((uint16_t)~(fault_log_status.head ^ fault_log_status.count ^ 
+            fault_log_status.unflushed ^ fault_log_status.sequence ^ fault_log_status.dropped));
+}
+
+/*!init_FaultLog
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t power_on_reset: 1 = the device has been powered up, 0 = soft reset
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine validates the persistent RAM ring buffer. After a power-on reset or when the 
+ * check word does not match, the ring buffer is cleared. When the fault log is flushed into 
+ * program memory, the record slots are scanned for the most recent sequence number to restore
+ * the write position and the sequence counter.
+ * ***********************************************************************************************/
+volatile uint16_t init_FaultLog(volatile uint16_t power_on_reset)
+{
+    volatile uint16_t fres = 1;
+#if (USE_FAULT_LOG_FLASH == 1)
+    volatile uint16_t i = 0, seq = 0, seq_last = 0, slot_last = 0;
+    volatile bool found = false;
+#endif
+    
+    if ((power_on_reset) || (fault_log_status.check != fault_LogCheckWord()) ||
+        (fault_log_status.head > FAULT_LOG_MASK) || (fault_log_status.count > FAULT_LOG_DEPTH) ||
+        (fault_log_status.unflushed > fault_log_status.count))
+    {
+        fault_log_status.head = 0;
+        fault_log_status.count = 0;
+        fault_log_status.unflushed = 0;
+        fault_log_status.sequence = 0;
+        fault_log_status.dropped = 0;
+    }
+    
+#if (USE_FAULT_LOG_FLASH == 1)
+
+    fault_log_flash_base = (((uint32_t)__builtin_tblpage(fault_log_flash) << 16) | 
+                            (uint32_t)__builtin_tbloffset(fault_log_flash));
+    
+    // find the record with the most recent sequence number
+    for (i=0; i<FAULT_LOG_FLASH_SLOTS; i++)
+    {
+        seq = fault_LogFlashRead(fault_log_flash_base + ((uint32_t)i * FAULT_LOG_SLOT_SIZE));
+        if (seq == 0xFFFF) { continue; } // empty slot
+        
+        if ((!found) || ((int16_t)(seq - seq_last) > 0))
+        { seq_last = seq; slot_last = i; found = true; }
+    }
+    
+    if (found)
+    {
+        fault_log_flash_slot = (slot_last + 1);
+        if (fault_log_flash_slot >= FAULT_LOG_FLASH_SLOTS) { fault_log_flash_slot = 0; }
+        
+        // records in RAM continue the sequence of program memory
+        if ((fault_log_status.count == 0) || ((int16_t)(fault_log_status.sequence - seq_last) <= 0))
+        { 
+            fault_log_status.sequence = (seq_last + 1);
+            if (fault_log_status.sequence == 0xFFFF) { fault_log_status.sequence = 0; }
+        }
+    }
+    else
+    { fault_log_flash_slot = 0; }
+    
+    // when the write position is located within a page, this page has already been erased
+    if (fault_log_flash_slot % FAULT_LOG_PAGE_SLOTS)
+    { fault_log_flash_erased = (fault_log_flash_slot / FAULT_LOG_PAGE_SLOTS); }
+    else
+    { fault_log_flash_erased = FAULT_LOG_PAGE_NONE; }
+    
+    fault_log_flash_step = 0;
+    
+#endif
+
+    fault_log_status.check = fault_LogCheckWord();
+    
+    return(fres);
+}
+
+/*!fault_LogWrite
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t event: Event type of type FAULT_LOG_EVENT_e
+ *      uint16_t id:    Fault object ID or trap ID
+ *      uint16_t value: Event specific value snapshot
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (oldest record has been overwritten before being written to program memory)
+ *      1: Success
+ * 
+ * Description:
+ * This routine writes a new record into the persistent RAM ring buffer, capturing the most 
+ * recent scheduler tick counter, operating mode and process code of the task manager. When the 
+ * ring buffer is full, the oldest record is overwritten.
+ * 
+ * Please note:
+ * This routine is called by the fault handler and the trap handler. As traps do not return, 
+ * no further protection against concurrent writes is required.
+ * ***********************************************************************************************/
+volatile uint16_t fault_LogWrite(volatile uint16_t event, volatile uint16_t id, volatile uint16_t value)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t index = 0;
+    
+    index = fault_log_status.head;
+    
+    fault_log[index].sequence = fault_log_status.sequence;
+    fault_log[index].timestamp = task_mgr.tick_ctrl.counter;
+    fault_log[index].event = event;
+    fault_log[index].id = id;
+    fault_log[index].op_mode = task_mgr.op_mode.mode;
+    fault_log[index].proc_code = task_mgr.proc_code.value;
+    fault_log[index].value = value;
+    
+    fault_log_status.head = ((index + 1) & FAULT_LOG_MASK);
+    
+    fault_log_status.sequence++;
+    if (fault_log_status.sequence == 0xFFFF) { fault_log_status.sequence = 0; } // 0xFFFF marks empty slots
+    
+    if (fault_log_status.count < FAULT_LOG_DEPTH)
+    { fault_log_status.count++; }
+    
+    if (fault_log_status.unflushed < FAULT_LOG_DEPTH)
+    { fault_log_status.unflushed++; }
+    else
+    { fault_log_status.dropped++; fres = 0; } // oldest record has not been written to program memory
+    
+    fault_log_status.check = fault_LogCheckWord();
+    
+    return(fres);
+}
+
+/*!fault_LogRead
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t index: Index of the record (0 = oldest record held in RAM)
+ *      FAULT_LOG_RECORD_t* record: Pointer to the buffer the record is copied to
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (no record of this index available)
+ *      1: Success
+ * 
+ * Description:
+ * This routine copies a record of the persistent RAM ring buffer. The number of available 
+ * records is given by fault_log_status.count.
+ * ***********************************************************************************************/
+volatile uint16_t fault_LogRead(volatile uint16_t index, volatile FAULT_LOG_RECORD_t* record)
+{
+    volatile uint16_t i = 0;
+    
+    if ((record == NULL) || (index >= fault_log_status.count)) { return(0); }
+    
+    i = ((fault_log_status.head - fault_log_status.count + index) & FAULT_LOG_MASK);
+    
+    record->sequence = fault_log[i].sequence;
+    record->timestamp = fault_log[i].timestamp;
+    record->event = fault_log[i].event;
+    record->id = fault_log[i].id;
+    record->op_mode = fault_log[i].op_mode;
+    record->proc_code = fault_log[i].proc_code;
+    record->value = fault_log[i].value;
+    
+    return(1);
+}
+
+#if (USE_FAULT_LOG_FLASH == 1)
+
+/*!exec_FaultLogFlush
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine copies the oldest record not yet written to program memory into the next record 
+ * slot of fault_log_flash[]. With every call, at most one page erase or one double-word write 
+ * is executed and only when the task manager is in one of the operating modes specified by 
+ * FAULT_LOG_FLUSH_OP_MODES. The page of the write position is erased when the write position 
+ * enters a new page. Slots which are not blank (e.g. after a reset during a previous write) 
+ * are skipped. The sequence number is written last, so that incomplete records are not 
+ * recognized as most recent record.
+ * ***********************************************************************************************/
+volatile uint16_t exec_FaultLogFlush(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t index = 0, page = 0, step = 0;
+    volatile uint16_t *word;
+    volatile uint32_t address = 0;
+    
+    if (fault_log_status.unflushed == 0) { return(1); } // nothing to do
+    if (!(task_mgr.op_mode.mode & (FAULT_LOG_FLUSH_OP_MODES))) { return(1); } // converter may be running
+    if (NVMCONbits.WR) { return(1); } // previous program memory operation is still in progress
+    
+    address = (fault_log_flash_base + ((uint32_t)fault_log_flash_slot * FAULT_LOG_SLOT_SIZE));
+    
+    if (fault_log_flash_step == 0)
+    {
+        page = (fault_log_flash_slot / FAULT_LOG_PAGE_SLOTS);
+        
+        // erase page when the write position enters it
+        if (page != fault_log_flash_erased)
+        {
+            fres &= fault_LogFlashCommand((fault_log_flash_base + ((uint32_t)page * FAULT_LOG_FLASH_PAGE_SIZE)), 
+                        FAULT_LOG_NVMOP_PAGE_ERASE, 0, 0);
+            fault_log_flash_erased = page;
+            return(fres);
+        }
+        
+        // skip slots which are not blank
+        if (!fault_LogFlashSlotBlank(fault_log_flash_slot))
+        {
+            fault_log_flash_slot++;
+            if (fault_log_flash_slot >= FAULT_LOG_FLASH_SLOTS) { fault_log_flash_slot = 0; }
+            return(1);
+        }
+    }
+    
+    // write one double-word of the record (step order 1, 2, ..., n-1, 0 => sequence number last)
+    index = ((fault_log_status.head - fault_log_status.unflushed) & FAULT_LOG_MASK);
+    word = (volatile uint16_t*)&fault_log[index];
+    step = ((fault_log_flash_step + 1) % FAULT_LOG_DWORD_STEPS);
+    
+    fres &= fault_LogFlashCommand((address + ((uint32_t)step << 2)), FAULT_LOG_NVMOP_DWORD_WRITE, 
+                word[step << 1], word[(step << 1) + 1]);
+    
+    fault_log_flash_step++;
+    
+    if (fault_log_flash_step >= FAULT_LOG_DWORD_STEPS)
+    {
+        fault_log_flash_step = 0;
+        fault_log_flash_slot++;
+        if (fault_log_flash_slot >= FAULT_LOG_FLASH_SLOTS) { fault_log_flash_slot = 0; }
+        
+        fault_log_status.unflushed--;
+        fault_log_status.check = fault_LogCheckWord();
+    }
+    
+    return(fres);
+}
+
+/*!fault_LogFlashRead
+ * ***********************************************************************************************
+ * Description:
+ * Reads the lower 16-bit word of the instruction word at the given program memory address
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_LogFlashRead(volatile uint32_t address)
+{
+    volatile uint16_t tblpag_buffer = 0, data = 0;
+    
+    tblpag_buffer = TBLPAG;
+    TBLPAG = (uint16_t)(address >> 16);
+    data = __builtin_tblrdl((uint16_t)(address & 0xFFFF));
+    TBLPAG = tblpag_buffer;
+    
+    return(data);
+}
+
+/*!fault_LogFlashSlotBlank
+ * ***********************************************************************************************
+ * Description:
+ * Returns 1 if all words of the given record slot are erased
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_LogFlashSlotBlank(volatile uint16_t slot)
+{
+    volatile uint16_t i = 0;
+    volatile uint32_t address = 0;
+    
+    address = (fault_log_flash_base + ((uint32_t)slot * FAULT_LOG_SLOT_SIZE));
+    
+    for (i=0; i<FAULT_LOG_RECORD_WORDS; i++)
+    {
+        if (fault_LogFlashRead(address + ((uint32_t)i << 1)) != 0xFFFF)
+        { return(0); }
+    }
+    
+    return(1);
+}
+
+/*!fault_LogFlashCommand
+ * ***********************************************************************************************
+ * Description:
+ * Executes a program memory page erase or double-word write at the given address. For 
+ * double-word writes, the lower 16-bit words of two successive instruction words are written 
+ * (the upper bytes remain erased).
+ * ***********************************************************************************************/
+inline volatile uint16_t fault_LogFlashCommand(volatile uint32_t address, volatile uint16_t nvm_op, 
+                volatile uint16_t word_low, volatile uint16_t word_high)
+{
+    volatile uint16_t tblpag_buffer = 0;
+    
+    if (nvm_op == FAULT_LOG_NVMOP_DWORD_WRITE)
+    {
+        tblpag_buffer = TBLPAG;
+        TBLPAG = FAULT_LOG_NVM_LATCH_PAGE;
+        __builtin_tblwtl(0x0000, word_low);
+        __builtin_tblwth(0x0000, 0x00FF);
+        __builtin_tblwtl(0x0002, word_high);
+        __builtin_tblwth(0x0002, 0x00FF);
+        TBLPAG = tblpag_buffer;
+    }
+    
+    NVMADRU = (uint16_t)(address >> 16);
+    NVMADR = (uint16_t)(address & 0xFFFF);
+    NVMCON = nvm_op;
+    __builtin_write_NVM(); // unlock sequence and start operation (CPU stalls until completed)
+    
+    return(!NVMCONbits.WRERR);
+}
+
+#endif
+
+#endif
+
+// EOF
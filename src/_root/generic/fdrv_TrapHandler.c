@@ -40,6 +40,7 @@
  *													routine for better integration
  * 07/19/2016	Andreas Reiter		MCHP	1.2		Added data structure for trap monitoring
  * 05/17/2019   M91406              MCHP    1.3     Added support for dsPIC33C and removed support for C30 C Complier
+ * 10/14/2026   M91406              MCHP    1.4     Replaced blocking trap loop by configurable trap policy
  *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
  * ADDITIONAL NOTES:
@@ -47,9 +48,10 @@
  * 1. This file contains trap service routines (handlers) for hardware exceptions generated by 
  *	 the dsPIC33F device.
  *
- * 2. All trap service routines in this file simply ensure that device continuously executes code 
- *	 within the trap service routine. Users may modify the basic framework provided here to suit 
- *	 to the needs of their application.
+ * 2. All trap service routines in this file call the default trap handler, which captures the
+ *	 trap information, forces the PWM outputs into a safe state and resets the CPU within a bounded
+ *	 time (see TRAP_POLICY in fault_handler_config.h). Users may modify the basic framework 
+ *	 provided here to suit to the needs of their application.
  *
  ***************************************************************************************************/
 
@@ -63,6 +65,10 @@ uint16_t __attribute__((__persistent__))trap_counter;
 uint16_t __attribute__((__persistent__))trap_identifier;
 volatile TRAP_LOGGER_t traplog;          // data structure used as buffer for trap monitoring
 
+/* private function prototypes */
+inline void TrapSafeState(void);
+inline void TrapDelay(volatile uint16_t ticks);
+
 
 volatile uint16_t init_SoftTraps(bool accumulator_a_overflow_trap_enable, 
                 bool accumulator_b_overflow_trap_enable, 
@@ -86,8 +92,18 @@ volatile uint16_t init_SoftTraps(bool accumulator_a_overflow_trap_enable,
 // =================================================================================================
 void SaveTrapStatus()
 {
-//    trap_identifier = traplog.trap_id;
-//    traplog.count = trap_counter;
+    trap_identifier = traplog.trap_id;
+    trap_counter++;
+    traplog.count = trap_counter;
+
+  #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+    warm_boot_Invalidate(); // Enforce cold boot after a trap
+  #endif
+
+  #if (USE_FAULT_LOG == 1)
+    fault_LogWrite(FAULT_LOG_EVENT_TRAP, traplog.trap_id, (uint16_t)traplog.inttreg.reg_block);
+  #endif
+    
     return;
 }
 
@@ -98,13 +114,22 @@ void SaveTrapStatus()
 // =================================================================================================
 //
 // This routine recovers the most recent trap information from persistent variables to make
-// them available after a soft CPU reset.
+// them available after a soft CPU reset. After a power-on or brown-out reset, persistent 
+// variables hold random data and trap information is cleared.
 //
 // =================================================================================================
 volatile uint16_t GetTrapStatus()
 {
-//    traplog.trap_id = trap_identifier;
-//    trap_counter = traplog.count;
+    if ((traplog.rcon_reg.flags.por) || (traplog.rcon_reg.flags.bor))
+    {
+        trap_counter = 0;
+        trap_identifier = 0;
+        traplog.trap_flags = (TRAP_FLAG_IDENTIFIER_t){0};
+    }
+    
+    traplog.trap_id = trap_identifier;
+    traplog.count = trap_counter;
+    
     return(1);
 }
 
@@ -121,32 +146,104 @@ volatile uint16_t GetTrapStatus()
 //
 // =================================================================================================
 
+// =================================================================================================
+//
+// Trap Safe State
+//
+// =================================================================================================
+//
+// This routine overrides the outputs of all PWM generators to LOW. The override takes effect
+// immediately and is cleared by the following CPU reset.
+//
+// =================================================================================================
+inline void TrapSafeState(void)
+{
+    volatile uint16_t i = 0, regbuf = 0;
+    
+    for (i=1; i<=TRAP_POLICY_PWM_GENERATORS; i++)
+    {
+        regbuf = FAULT_HW_PGxIOCONL(i);
+        regbuf &= ~(FAULT_HW_PGxIOCONL_OVRDAT | FAULT_HW_PGxIOCONL_OSYNC);
+        regbuf |= (FAULT_HW_PGxIOCONL_OVRENH | FAULT_HW_PGxIOCONL_OVRENL | FAULT_HW_PGxIOCONL_OSYNC_IMMEDIATE);
+        FAULT_HW_PGxIOCONL(i) = regbuf;
+    }
+    
+    return;
+}
+
+// =================================================================================================
+//
+// Trap Delay
+//
+// =================================================================================================
+//
+// This routine waits for the given number of scheduler timer periods by polling the timer 
+// interrupt flag bit. As trap handlers run above all interrupt priority levels, the timer 
+// interrupt service routine is not executed. The wait for each period is bounded by a loop
+// counter in case the timer is not clocked.
+//
+// =================================================================================================
+inline void TrapDelay(volatile uint16_t ticks)
+{
+    volatile uint16_t guard = 0;
+    
+    while (ticks > 0)
+    {
+        TASK_MGR_TIMER_ISR_FLAG_REGISTER &= ~(TASK_MGR_TIMER_ISR_FLAG_BIT_MASK);
+        guard = TASK_MGR_PERIOD; // each loop iteration takes more than one instruction cycle
+
+        while ((!(TASK_MGR_TIMER_ISR_FLAG_REGISTER & TASK_MGR_TIMER_ISR_FLAG_BIT_MASK)) && (guard > 0))
+        { guard--; }
+        
+        ticks--;
+    }
+    
+    return;
+}
+
 void DefaultTrapHandler(TRAP_ID_e trap_id) {
 
-    volatile uint32_t i = 0;
+    volatile uint16_t delay = 0;
     
+    // Capture trap information
     traplog.inttreg.reg_block = INTTREG;
     traplog.trap_id = trap_id;
-    traplog.count++;
     SaveTrapStatus();
 
-    /* ToDo: EXPERIMENTAL TEST CODE */
-    
- //Remove:   _PTEN = 0;
-    while(1)
-    {
-        Nop();
-        Nop();
-        Nop();
+    // Record trap entry and preserve the trace for post-mortem analysis
+    TRACE_FAULT(TRACE_EVT_TRAP, __builtin_ff1r(trap_id)); // Trap ID bit position (1 = bit #0)
+  #if (USE_TASK_MANAGER_TRACE == 1)
+    trace_Freeze();
+  #endif
+
+    // Force PWM outputs into safe state
+    TrapSafeState();
 
-        for( i=500000; i>0; i-- );
-        for( i=500000; i>0; i-- );
-        for( i=500000; i>0; i-- );
-        for( i=500000; i>0; i-- );
+  #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    WDTCONLbits.ON = 0; // The trap policy timing is not interrupted by the watchdog timer
+  #endif
 
-        DBGLED_TOGGLE;
+    // (Re-)start scheduler timer as time base of the trap policy. The timer is reloaded with the
+    // nominal period, hence the policy delays are counted in unscaled scheduler ticks.
+    init_system_timer();
+    launch_system_timer();
+    
+    // Escalate by the number of traps since the last power-on or brown-out reset
+    if ((TRAP_POLICY_LOCKOUT_THRESHOLD > 0) && (trap_counter >= TRAP_POLICY_LOCKOUT_THRESHOLD))
+    {
+        while(1) // device remains in safe state until the next power-on or brown-out reset
+        {
+            TrapDelay(TRAP_POLICY_LOCKOUT_BLINK);
+            DBGLED_TOGGLE;
+        }
     }
-    /* ToDo: EXPERIMENTAL TEST CODE END */
+    
+    if (trap_counter >= TRAP_POLICY_BACKOFF_THRESHOLD)
+    { delay = TRAP_POLICY_BACKOFF_DELAY; }
+    else
+    { delay = TRAP_POLICY_RESET_DELAY; }
+    
+    TrapDelay(delay);
     
     CPU_RESET;
     return;
@@ -0,0 +1,285 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!msi_exchange.c
+ *****************************************************************************
+ * File:   msi_exchange.c
+ *
+ * Summary:
+ * Double-buffered master/slave core data exchange through MSI mailboxes
+ *
+ * Description:	
+ * This file holds the transfer engine of the MSI data exchange. Each core 
+ * transmits one data block through the mailbox data flow control protocol 
+ * block it owns and receives the data block of the other core. 
+ * 
+ * Writing the last register of a protocol block sets its data ready flag, 
+ * reading the last register clears it again. A data block is therefore only
+ * transmitted when the previous one has been read by the other core. A new 
+ * data set published before the previous one has been transmitted replaces 
+ * it (tx_overruns). Received data blocks are copied into the inactive receive 
+ * buffer before the buffer index is swapped.
+ * 
+ * Before any data is exchanged, the slave core signals the completion of its
+ * startup sequence by setting its slave-to-master interrupt request STMIRQ.
+ * The master core acknowledges by setting STMIACK, upon which the slave core
+ * withdraws its request and the master core clears the acknowledge again.
+ * 
+ * Please note:
+ * msi_Transfer() has to be called from one execution level only (task level 
+ * or interrupt service routine).
+ *
+ * References:
+ * dsPIC33CH Family Reference Manual, Master Slave Interface (MSI) Module
+ *
+ * See also:
+ * msi_exchange.h
+ * msi_exchange_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "_root/generic/msi_exchange.h"
+
+#if (MSI_CORE_ROLE != MSI_ROLE_NONE)
+
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+#include <libpic30.h> // required for slave core programming
+extern __eds__ unsigned char MSI_SLAVE_IMAGE[]; // slave core image linked by the project properties (Slaves)
+#endif
+
+// Master/slave data exchange data structure
+volatile MSI_EXCHANGE_t msi;
+
+/* private function prototypes */
+volatile uint16_t msi_BootHandshake(void);
+
+/*!msi_Init
+ * ***********************************************************************************************
+ * Summary:
+ * Initializes the master/slave data exchange
+ *
+ * Parameters:
+ *	(none)
+ * 
+ * Returns:
+ *   0: failure
+ *   1: success
+ * 
+ * Description:
+ * Clears all buffers and status information. On the master core the slave core image is 
+ * programmed into the slave program RAM and the slave core is started. This function is called
+ * at the beginning of the boot task queue. Hence, the slave core boots in parallel to the 
+ * remaining boot and device startup task queues of the master core.
+ * 
+ * Please note:
+ * Loading the slave program RAM blocks the master core for the time it takes to copy the 
+ * slave image. The slave core is only loaded when it is not already running (e.g. after a 
+ * warm boot of the master core).
+ * ***********************************************************************************************/
+
+volatile uint16_t msi_Init(void) {
+    
+    volatile uint16_t i = 0;
+    
+    for (i = 0; i < MSI_MAILBOX_BLOCK_SIZE; i++)
+    {
+        msi.tx[0].words[i] = 0;
+        msi.tx[1].words[i] = 0;
+        msi.rx[0].words[i] = 0;
+        msi.rx[1].words[i] = 0;
+    }
+
+    msi.tx_write = 0;
+    msi.rx_read = 0;
+    msi.tx_sequence = 0;
+    msi.rx_timeout = 0;
+    msi.tx_overruns = 0;
+    msi.status.value = 0;
+
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+    if (!MSI1CONbits.SLVEN)
+    {
+        _program_slave(1, 0, MSI_SLAVE_IMAGE);
+        _start_slave();
+    }
+#endif
+
+    msi.status.flags.enabled = true;
+    
+    return(1);
+}
+
+/*!msi_Publish
+ * ***********************************************************************************************
+ * Summary:
+ * Hands the transmit data set written by the application over to the transfer engine
+ *
+ * Parameters:
+ *	(none)
+ * 
+ * Returns:
+ *   0: failure
+ *   1: success
+ * 
+ * Description:
+ * The sequence counter is added to the data set written through msi_TxData() and the transmit
+ * buffers are swapped. The data set will be transmitted with the next call of msi_Transfer().
+ * ***********************************************************************************************/
+
+volatile uint16_t msi_Publish(void) {
+    
+    if (!msi.status.flags.enabled)
+    { return(0); }
+    
+    msi.tx[msi.tx_write].data.sequence = ++msi.tx_sequence;
+    
+    if ((msi.status.flags.tx_pending) && (msi.status.flags.remote_ready))
+    { msi.tx_overruns++; } // previous data set has not been transmitted and gets replaced
+    
+    msi.tx_write ^= 1;
+    msi.status.flags.tx_pending = true;
+    
+    return(1);
+}
+
+/*!msi_Transfer
+ * ***********************************************************************************************
+ * Summary:
+ * Transmits the most recently published data set and receives new data from the other core
+ *
+ * Parameters:
+ *	(none)
+ * 
+ * Returns:
+ *   0: failure
+ *   1: success
+ * 
+ * Description:
+ * The recently published data set is written to the transmit mailboxes if the other core has 
+ * read the previous one. When the data ready flag of the receive protocol block is set, the 
+ * receive mailboxes are copied into the inactive receive buffer and the buffers are swapped.
+ * The handshake register (last word) is read last, clearing the data ready flag.
+ * No data is exchanged until the boot handshake has been completed.
+ * ***********************************************************************************************/
+
+volatile uint16_t msi_Transfer(void) {
+    
+    volatile uint16_t i = 0;
+    volatile uint16_t index = 0;
+    volatile uint16_t* mbx;
+    
+    if (!msi.status.flags.enabled)
+    { return(0); }
+    
+    if (!msi.status.flags.remote_ready)
+    { return(msi_BootHandshake()); }
+    
+    // Transmit: the handshake register (last word) is written last, setting the data ready flag
+    if ((msi.status.flags.tx_pending) && (!MSI_TX_DATA_READY))
+    {
+        index = (msi.tx_write ^ 1);
+        mbx = MSI_TX_MAILBOX;
+        for (i = 0; i < MSI_MAILBOX_BLOCK_SIZE; i++)
+        { *mbx++ = msi.tx[index].words[i]; }
+        msi.status.flags.tx_pending = false;
+    }
+    
+    // Receive: the handshake register (last word) is read last, clearing the data ready flag
+    if (MSI_RX_DATA_READY)
+    {
+        index = (msi.rx_read ^ 1);
+        mbx = MSI_RX_MAILBOX;
+        for (i = 0; i < MSI_MAILBOX_BLOCK_SIZE; i++)
+        { msi.rx[index].words[i] = *mbx++; }
+        
+        if (msi.rx[index].data.sequence != msi.rx[msi.rx_read].data.sequence)
+        {
+            msi.rx_read = index;
+            msi.rx_timeout = 0;
+            msi.status.flags.link_active = true;
+            msi.status.flags.link_lost = false;
+            return(1);
+        }
+    }
+    
+    // Link supervision
+    if (msi.rx_timeout < MSI_LINK_TIMEOUT)
+    { msi.rx_timeout++; }
+    else
+    {
+        msi.status.flags.link_active = false;
+        msi.status.flags.link_lost = true;
+    }
+    
+    return(1);
+}
+
+/* ************************************************************************************************
+ * Boot handshake between master and slave core
+ * ************************************************************************************************/
+
+volatile uint16_t msi_BootHandshake(void) {
+    
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+    
+    if (MSI1STATbits.STMIRQ)
+    { MSI1CONbits.STMIACK = 1; } // acknowledge slave core ready request
+    else if (MSI1CONbits.STMIACK)
+    { // slave core has withdrawn its request
+        MSI1CONbits.STMIACK = 0;
+        msi.status.flags.remote_ready = true;
+        msi.rx_timeout = 0;
+        return(1);
+    }
+    
+#else
+
+    if (!SI1CONbits.STMIRQ)
+    { SI1CONbits.STMIRQ = 1; } // signal slave core ready to the master core
+    else if (SI1STATbits.STMIACK)
+    { // master core has acknowledged
+        SI1CONbits.STMIRQ = 0;
+        msi.status.flags.remote_ready = true;
+        msi.rx_timeout = 0;
+        return(1);
+    }
+    
+#endif
+
+    // boot timeout
+    if (msi.rx_timeout < MSI_BOOT_TIMEOUT)
+    { msi.rx_timeout++; }
+    else
+    { msi.status.flags.link_lost = true; }
+    
+    return(1);
+}
+
+#endif  /* MSI_CORE_ROLE */
@@ -0,0 +1,404 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_benchmark.c
+ *****************************************************************************
+ * File:   task_benchmark.c
+ *
+ * Summary:
+ * On-target micro-benchmark of the framework hot paths
+ *
+ * Description:	
+ * This file holds the benchmark task sampling the cases of BENCH_CASE_REGISTRY. 
+ * Each sample saves the state of the task manager, the fault engine and the 
+ * watchdog service, prepares the input conditions of the case variant, reads 
+ * the free running benchmark timer before and after the function under test 
+ * and restores the saved state. Only the call of the function under test is 
+ * located inside the measurement window. The CPU cycles of an empty window 
+ * are measured once during initialization and subtracted from every sample.
+ * 
+ * Please note:
+ * Minimum values are free of interrupt latencies. Maximum values include 
+ * preemptions by interrupt service routines and should therefore not be used
+ * as regression baseline.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_benchmark.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_benchmark.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_watchdog.h"
+#include "_root/generic/fdrv_FaultHandler.h"
+#include "apl/config/tasks.h"
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+
+#if (USE_FAULT_ENGINE != 1)
+  #error === the benchmark requires the fault engine (USE_FAULT_ENGINE = 1) ===
+#endif
+
+#define BENCH_CALIBRATION_SAMPLES   16  // Number of empty measurement windows of the overhead calibration
+
+/* private function prototypes */
+volatile uint16_t bench_TaskManagerTick(volatile uint16_t variant);
+volatile uint16_t bench_CheckOperationModeStatus(volatile uint16_t variant);
+volatile uint16_t bench_CaptureSystemStatus(volatile uint16_t variant);
+volatile uint16_t bench_FaultCheckAll(volatile uint16_t variant);
+inline volatile uint16_t bench_StateSave(void);
+inline volatile uint16_t bench_StateRestore(void);
+
+// Benchmark status
+volatile bench_status_t bench;
+
+// Benchmark result table
+volatile bench_result_t bench_results[BENCH_CASE_COUNT];
+
+// Benchmark case table generated from the benchmark case registry
+#define BENCH_CASE_REGISTRY_DESCRIPTOR(id, function, variant)   { &function, (variant) },
+
+const bench_case_descriptor_t bench_case_table[BENCH_CASE_COUNT] = {
+    BENCH_CASE_REGISTRY(BENCH_CASE_REGISTRY_DESCRIPTOR)
+};
+
+// Task queue dispatched by the task dispatch benchmark case
+const task_queue_item_t bench_task_queue[1] = {
+    TASK_QUEUE_ENTRY(TASK_IDLE, 1, 0)
+};
+
+// State of the framework saved before and restored after each sample
+typedef struct {
+    task_manager_settings_t task_mgr; // Task manager settings and status
+    #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    task_statistics_t task_stats; // Execution time statistics of TASK_IDLE
+    #endif
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    uint16_t countdown[TASK_MGR_QUEUE_SIZE_MAX]; // Period counters of the active multi-rate task queue
+    #endif
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    task_wdt_status_t task_wdt; // Watchdog service status
+    #endif
+    SYSTEM_MODE_t system_mode; // Application system mode classification
+    uint16_t counter[FAULT_ENGINE_OBJECTS_MAX]; // Fault engine hit counters
+    uint16_t active[FAULT_ENGINE_WORDS]; // Fault engine active flags
+    uint16_t stat[FAULT_ENGINE_WORDS]; // Fault engine status flags
+    uint16_t due[FAULT_ENGINE_WORDS]; // Fault engine pending event flags
+    uint16_t fault_pending[FAULT_EVENT_WORDS]; // Pending-fault bitmap
+    FAULT_SCAN_STATUS_t fault_scan[FAULT_SCAN_CLASS_COUNT]; // Fault scan latency monitor
+} bench_snapshot_t;
+
+volatile bench_snapshot_t bench_snapshot;
+
+#endif  /* USE_TASK_MANAGER_BENCHMARK */
+
+/*!exec_TaskBenchmark
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Takes BENCH_BATCH samples of the recent benchmark case. When BENCH_ITERATIONS samples have
+ * been taken, the average is calculated and the next benchmark case is selected. After the 
+ * last case the benchmark is complete. Each call copies the result of the benchmark case 
+ * selected by bench.select into bench.view, where it can be read by the parameter access 
+ * protocol.
+ * ***********************************************************************************************/
+volatile uint16_t exec_TaskBenchmark(void) {
+    
+    volatile uint16_t fres = 1;
+    
+    #if (USE_TASK_MANAGER_BENCHMARK == 1)
+    
+    volatile uint16_t i = 0, cycles = 0;
+    volatile bench_result_t* result;
+    
+    for (i=0; ((i<BENCH_BATCH) && (!bench.complete)); i++)
+    {
+        result = &bench_results[bench.case_index];
+        
+        // Take one sample of the recent benchmark case
+        fres &= bench_StateSave();
+        cycles = bench_case_table[bench.case_index].function(bench_case_table[bench.case_index].variant);
+        fres &= bench_StateRestore();
+        
+        if (cycles > bench.overhead)
+        { cycles -= bench.overhead; }
+        else
+        { cycles = 0; }
+        
+        if (cycles < result->minimum)
+        { result->minimum = cycles; }
+        if (cycles > result->maximum)
+        { result->maximum = cycles; }
+        
+        result->sum += cycles;
+        result->samples++;
+        
+        // Select next benchmark case
+        if (result->samples >= BENCH_ITERATIONS)
+        {
+            result->average = (uint16_t)(result->sum / result->samples);
+            bench.case_index++;
+            
+            if (bench.case_index >= BENCH_CASE_COUNT)
+            { bench.complete = true; }
+        }
+    }
+    
+    // Refresh result view
+    if (bench.select < BENCH_CASE_COUNT)
+    { bench.view = bench_results[bench.select]; }
+    
+    #endif
+    
+    return(fres);
+}
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+
+/*!init_TaskBenchmark
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Resets the benchmark result table and determines the CPU cycles of an empty measurement 
+ * window, which are subtracted from every sample. The benchmark timer has to be running when 
+ * this function is called.
+ * ***********************************************************************************************/
+inline volatile uint16_t init_TaskBenchmark(void) {
+    
+    volatile uint16_t i = 0, tstart = 0, tstop = 0;
+    
+    for (i=0; i<BENCH_CASE_COUNT; i++)
+    {
+        bench_results[i].minimum = 0xFFFF;
+        bench_results[i].maximum = 0;
+        bench_results[i].average = 0;
+        bench_results[i].samples = 0;
+        bench_results[i].sum = 0;
+    }
+    
+    // Calibrate the overhead of the measurement window
+    bench.overhead = 0xFFFF;
+    
+    for (i=0; i<BENCH_CALIBRATION_SAMPLES; i++)
+    {
+        tstart = BENCH_TIMER_COUNTER_REGISTER;
+        tstop = BENCH_TIMER_COUNTER_REGISTER;
+        
+        if ((uint16_t)(tstop - tstart) < bench.overhead)
+        { bench.overhead = (uint16_t)(tstop - tstart); }
+    }
+    
+    bench.case_index = 0;
+    bench.select = 0;
+    bench.view = bench_results[0];
+    bench.complete = false;
+    
+    return(1);
+}
+
+/*!bench_TaskManagerTick
+ * ***********************************************************************************************
+ * Measures task_manager_tick() dispatching the empty task TASK_IDLE through a task queue of a 
+ * single entry.
+ * ***********************************************************************************************/
+volatile uint16_t bench_TaskManagerTick(volatile uint16_t variant) {
+    
+    volatile uint16_t tstart = 0, tstop = 0;
+    
+    task_mgr.task_queue = bench_task_queue;
+    task_mgr.task_queue_tick_index = 0;
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    task_mgr.task_queue_items = 1;
+    task_queue_countdown[0] = 0;
+    #endif
+    
+    tstart = BENCH_TIMER_COUNTER_REGISTER;
+    task_manager_tick();
+    tstop = BENCH_TIMER_COUNTER_REGISTER;
+    
+    return((uint16_t)(tstop - tstart));
+}
+
+/*!bench_CheckOperationModeStatus
+ * ***********************************************************************************************
+ * Measures task_CheckOperationModeStatus() without operation mode change (BENCH_VARIANT_DEFAULT)
+ * or with a switch-over into the recent operation mode, reloading its task queue 
+ * (BENCH_VARIANT_SWITCH).
+ * ***********************************************************************************************/
+volatile uint16_t bench_CheckOperationModeStatus(volatile uint16_t variant) {
+    
+    volatile uint16_t tstart = 0, tstop = 0;
+    
+    if (variant == BENCH_VARIANT_SWITCH)
+    { task_mgr.pre_op_mode.mode = OP_MODE_UNKNOWN; }
+    
+    tstart = BENCH_TIMER_COUNTER_REGISTER;
+    task_CheckOperationModeStatus();
+    tstop = BENCH_TIMER_COUNTER_REGISTER;
+    
+    return((uint16_t)(tstop - tstart));
+}
+
+/*!bench_CaptureSystemStatus
+ * ***********************************************************************************************
+ * Measures exec_CaptureSystemStatus(). In the master core role this includes the time critical
+ * master/slave core data exchange.
+ * ***********************************************************************************************/
+volatile uint16_t bench_CaptureSystemStatus(volatile uint16_t variant) {
+    
+    volatile uint16_t tstart = 0, tstop = 0;
+    
+    tstart = BENCH_TIMER_COUNTER_REGISTER;
+    exec_CaptureSystemStatus();
+    tstop = BENCH_TIMER_COUNTER_REGISTER;
+    
+    return((uint16_t)(tstop - tstart));
+}
+
+/*!bench_FaultCheckAll
+ * ***********************************************************************************************
+ * Measures exec_FaultCheckAll() in the recent fault condition (BENCH_VARIANT_DEFAULT) or with 
+ * fault events pending for all event-triggered fault objects (BENCH_VARIANT_EVENTS).
+ * ***********************************************************************************************/
+volatile uint16_t bench_FaultCheckAll(volatile uint16_t variant) {
+    
+    volatile uint16_t i = 0, tstart = 0, tstop = 0;
+    
+    if (variant == BENCH_VARIANT_EVENTS)
+    {
+        for (i=0; i<FAULT_EVENT_WORDS; i++)
+        { fault_pending[i] = 0xFFFF; }
+    }
+    
+    tstart = BENCH_TIMER_COUNTER_REGISTER;
+    exec_FaultCheckAll();
+    tstop = BENCH_TIMER_COUNTER_REGISTER;
+    
+    return((uint16_t)(tstop - tstart));
+}
+
+/*!bench_StateSave
+ * ***********************************************************************************************
+ * Saves the state of the framework modified by the functions under test.
+ * ***********************************************************************************************/
+inline volatile uint16_t bench_StateSave(void) {
+    
+    volatile uint16_t i = 0;
+    
+    bench_snapshot.task_mgr = task_mgr;
+    #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    bench_snapshot.task_stats = task_stats[TASK_IDLE];
+    #endif
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    for (i=0; i<TASK_MGR_QUEUE_SIZE_MAX; i++)
+    { bench_snapshot.countdown[i] = task_queue_countdown[i]; }
+    #endif
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    bench_snapshot.task_wdt = task_wdt;
+    #endif
+    bench_snapshot.system_mode = application.system_mode;
+    
+    for (i=0; i<FAULT_ENGINE_OBJECTS_MAX; i++)
+    { bench_snapshot.counter[i] = fault_engine.counter[i]; }
+    for (i=0; i<FAULT_ENGINE_WORDS; i++)
+    {
+        bench_snapshot.active[i] = fault_engine.active[i];
+        bench_snapshot.stat[i] = fault_engine.stat[i];
+        bench_snapshot.due[i] = fault_engine.due[i];
+    }
+    for (i=0; i<FAULT_EVENT_WORDS; i++)
+    { bench_snapshot.fault_pending[i] = fault_pending[i]; }
+    for (i=0; i<FAULT_SCAN_CLASS_COUNT; i++)
+    { bench_snapshot.fault_scan[i] = fault_scan[i]; }
+    
+    return(1);
+}
+
+/*!bench_StateRestore
+ * ***********************************************************************************************
+ * Restores the state of the framework saved by bench_StateSave(). The scheduler tick counter 
+ * is preserved, as it is incremented by the system timer interrupt service routine when the 
+ * scheduler runs in interrupt mode.
+ * ***********************************************************************************************/
+inline volatile uint16_t bench_StateRestore(void) {
+    
+    volatile uint16_t i = 0, ipl_buffer = 0;
+    volatile task_tick_control_t tick_ctrl;
+    
+    SET_AND_SAVE_CPU_IPL(ipl_buffer, TASK_MGR_ISR_PRIORITY); // Hold off timer interrupt
+    tick_ctrl = task_mgr.tick_ctrl;
+    task_mgr = bench_snapshot.task_mgr;
+    task_mgr.tick_ctrl = tick_ctrl;
+    RESTORE_CPU_IPL(ipl_buffer); // Release pending timer interrupt
+    
+    #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    task_stats[TASK_IDLE] = bench_snapshot.task_stats;
+    #endif
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    for (i=0; i<TASK_MGR_QUEUE_SIZE_MAX; i++)
+    { task_queue_countdown[i] = bench_snapshot.countdown[i]; }
+    #endif
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    task_wdt = bench_snapshot.task_wdt;
+    #endif
+    application.system_mode = bench_snapshot.system_mode;
+    
+    for (i=0; i<FAULT_ENGINE_OBJECTS_MAX; i++)
+    { fault_engine.counter[i] = bench_snapshot.counter[i]; }
+    for (i=0; i<fault_engine.count; i++)
+    { fault_engine.fltobj[i]->criteria.counter = fault_engine.counter[i]; }
+    for (i=0; i<FAULT_ENGINE_WORDS; i++)
+    {
+        fault_engine.active[i] = bench_snapshot.active[i];
+        fault_engine.stat[i] = bench_snapshot.stat[i];
+        fault_engine.due[i] = bench_snapshot.due[i];
+    }
+    for (i=0; i<FAULT_EVENT_WORDS; i++)
+    { fault_pending[i] = bench_snapshot.fault_pending[i]; }
+    for (i=0; i<FAULT_SCAN_CLASS_COUNT; i++)
+    { fault_scan[i] = bench_snapshot.fault_scan[i]; }
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_BENCHMARK */
@@ -0,0 +1,383 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_bootprof.c
+ *****************************************************************************
+ * File:   task_bootprof.c
+ *
+ * Summary:
+ * Boot time profiler of startup steps and startup task queues
+ *
+ * Description:	
+ * Time since reset is accumulated from the counter of the free running boot 
+ * profiler timer. Counter increments are converted into [us] at the CPU clock 
+ * valid at the previous timestamp, so that the CPU clock may change between 
+ * two timestamps (e.g. during CLOCK_Initialize()).
+ * 
+ * Step records are allocated in a fixed order: the steps executed before the
+ * scheduler is started are followed by the entries of the task queues of 
+ * OP_MODE_BOOT, OP_MODE_DEVICE_STARTUP and OP_MODE_SYSTEM_STARTUP. Queue 
+ * entries called multiple times (e.g. while the system startup queue is 
+ * repeated until the soft-start has completed) accumulate into one record.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_bootprof.h
+ * task_manager_config.h
+ * support/bootprof/boot_report.py
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "_root/generic/task_bootprof.h"
+#include "apl/config/tasks.h"
+#include "hal/initialization/init_timer.h"
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+
+// Offsets of the step records of the startup task queues
+#define BOOT_PROF_OFFSET_BOOT               (BOOT_STEP_COUNT)
+#define BOOT_PROF_OFFSET_DEVICE_STARTUP     (BOOT_PROF_OFFSET_BOOT + TASK_QUEUE_BOOT_SIZE)
+#define BOOT_PROF_OFFSET_SYSTEM_STARTUP     (BOOT_PROF_OFFSET_DEVICE_STARTUP + TASK_QUEUE_DEVICE_STARTUP_SIZE)
+#define BOOT_PROF_STEPS                     (BOOT_PROF_OFFSET_SYSTEM_STARTUP + TASK_QUEUE_SYSTEM_STARTUP_SIZE)
+
+#if (BOOT_PROF_STEPS > BOOT_PROF_SIZE)
+  #error === BOOT_PROF_SIZE is too small to hold all startup steps and startup task queue entries ===
+#endif
+
+typedef struct {
+    volatile uint16_t active; // Flag indicating that the recent boot is being profiled
+    volatile uint16_t counter; // Timer counter value of the previous timestamp
+    volatile float tick; // Time of one timer count at the CPU clock of the previous timestamp in [us]
+    volatile float time; // Time since reset in [us]
+    volatile uint32_t mark; // Time of the end of the previous step executed before the scheduler was started in [us]
+    volatile uint32_t task_start; // Start time of the recently executed task queue entry in [us]
+} __attribute__((packed))BOOT_PROF_CLOCK_t;
+
+// Boot profile record (persistent to be readable after a soft reset interrupting the boot)
+volatile BOOT_PROFILE_t __attribute__((__persistent__))boot_profile;
+
+// Boot profiler time base
+volatile BOOT_PROF_CLOCK_t boot_prof_clock;
+
+/* private function prototypes */
+inline volatile uint32_t boot_ProfileNow(void);
+inline volatile uint16_t boot_ProfileRecord(volatile uint16_t index, volatile uint16_t id, 
+                            volatile uint32_t start, volatile uint32_t end);
+
+/*!init_BootProfile
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t power_on_reset: flag indicating that the device has been powered up (1) or has 
+ *      been reset by software (0)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Starts the boot profiler timer and clears the boot profile record. The record of a previous 
+ * boot which has been interrupted by a soft reset before its completion is preserved and the 
+ * recent boot is not profiled. This function is called by CheckCPUResetRootCause() right after
+ * reset.
+ * ***********************************************************************************************/
+volatile uint16_t init_BootProfile(volatile uint16_t power_on_reset) {
+    
+    volatile uint16_t i = 0;
+    
+    boot_prof_clock.active = false;
+    
+    if ((!power_on_reset) && (boot_profile.complete == 0) && (boot_profile.size == BOOT_PROF_SIZE))
+    { return(1); } // Preserve record of the interrupted boot
+    
+    for (i=0; i<BOOT_PROF_SIZE; i++)
+    {
+        boot_profile.step[i].id = 0;
+        boot_profile.step[i].calls = 0;
+        boot_profile.step[i].start = 0;
+        boot_profile.step[i].end = 0;
+        boot_profile.step[i].busy = 0;
+    }
+    
+    for (i=0; i<3; i++)
+    { boot_profile.mode_start[i] = 0; }
+    
+    boot_profile.complete = 0;
+    boot_profile.count = BOOT_PROF_STEPS;
+    boot_profile.size = BOOT_PROF_SIZE;
+    boot_profile.final_mode = 0;
+    boot_profile.total = 0;
+    
+    boot_prof_clock.time = 0.0;
+    boot_prof_clock.mark = 0;
+    boot_prof_clock.active = true;
+    
+    return(boot_ProfileResume());
+}
+
+/*!boot_ProfileSuspend
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Accumulates the time counted by the boot profiler timer. This function has to be called 
+ * before the profiler timer is stopped or powered off (e.g. by pmd_reset() in Device_Reset()).
+ * Profiling is continued by boot_ProfileResume().
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileSuspend(void) {
+    
+    if (boot_prof_clock.active)
+    { boot_ProfileNow(); }
+    
+    return(1);
+}
+
+/*!boot_ProfileResume
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * (Re-)starts the boot profiler timer and continues counting from the time accumulated by the
+ * most recent timestamp.
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileResume(void) {
+    
+    volatile uint16_t fres = 1;
+    
+    if (!boot_prof_clock.active)
+    { return(1); }
+    
+    fres &= init_boot_timer();
+    fres &= launch_boot_timer();
+    
+    boot_prof_clock.counter = BOOT_PROF_TIMER_COUNTER_REGISTER;
+    
+    return(fres);
+}
+
+/*!boot_ProfileActive
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Boot profiling has been completed or is disabled for the recent boot
+ *      1: The recent boot is being profiled
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileActive(void) {
+    
+    return(boot_prof_clock.active);
+}
+
+/*!boot_ProfileStep
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t step: ID of the step of type BOOT_STEP_e which has just been completed
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (unknown step ID)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Records a step executed before the scheduler is started. The step is considered to have 
+ * started at the end of the previously recorded step.
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileStep(volatile uint16_t step) {
+    
+    volatile uint32_t now = 0;
+    volatile uint16_t fres = 1;
+    
+    if (!boot_prof_clock.active)
+    { return(1); }
+    
+    if ((step < BOOT_STEP_WARM_BOOT_CHECK) || (step >= (BOOT_STEP_WARM_BOOT_CHECK + BOOT_STEP_COUNT)))
+    { return(0); }
+    
+    now = boot_ProfileNow();
+    fres &= boot_ProfileRecord((step - BOOT_STEP_WARM_BOOT_CHECK), step, boot_prof_clock.mark, now);
+    boot_prof_clock.mark = now;
+    
+    return(fres);
+}
+
+/*!boot_ProfileTaskBegin
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Captures the start time of the task queue entry about to be executed by the task manager.
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileTaskBegin(void) {
+    
+    if (boot_prof_clock.active)
+    { boot_prof_clock.task_start = boot_ProfileNow(); }
+    
+    return(1);
+}
+
+/*!boot_ProfileTaskEnd
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t index: index of the entry in the recent task queue
+ *      uint16_t task_id: task ID of the queue entry
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Records the execution time of a task queue entry of the startup operation modes. Entries
+ * of other task queues are ignored.
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileTaskEnd(volatile uint16_t index, volatile uint16_t task_id) {
+    
+    volatile uint16_t mode_index = 0, offset = 0;
+    
+    if (!boot_prof_clock.active)
+    { return(1); }
+    
+    mode_index = (uint16_t)(task_mgr.op_mode_descriptor - task_op_mode_table);
+    
+    switch (mode_index)
+    {
+        case OP_MODE_INDEX_BOOT: offset = BOOT_PROF_OFFSET_BOOT; break;
+        case OP_MODE_INDEX_DEVICE_STARTUP: offset = BOOT_PROF_OFFSET_DEVICE_STARTUP; break;
+        case OP_MODE_INDEX_SYSTEM_STARTUP: offset = BOOT_PROF_OFFSET_SYSTEM_STARTUP; break;
+        default: return(1); // Task queue of an operation mode selected by the user
+    }
+    
+    return(boot_ProfileRecord((offset + index), ((mode_index << 8) | (task_id & 0x00FF)), 
+            boot_prof_clock.task_start, boot_ProfileNow()));
+}
+
+/*!boot_ProfileMode
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t mode_index: operation mode index of type OP_MODE_INDEX_e of the new mode
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Captures the time of operation mode switch-overs. When the task manager switches to an 
+ * operation mode other than the startup modes, the total boot time is captured and profiling
+ * is completed. This function is called by the task manager at every operation mode change.
+ * ***********************************************************************************************/
+volatile uint16_t boot_ProfileMode(volatile uint16_t mode_index) {
+    
+    if (!boot_prof_clock.active)
+    { return(1); }
+    
+    if (mode_index <= OP_MODE_INDEX_SYSTEM_STARTUP)
+    { 
+        boot_profile.mode_start[mode_index] = boot_ProfileNow(); 
+    }
+    else
+    {
+        boot_profile.total = boot_ProfileNow();
+        boot_profile.final_mode = mode_index;
+        boot_profile.complete = 1;
+        boot_prof_clock.active = false; // Stop profiling
+    }
+    
+    return(1);
+}
+
+/*!boot_ProfileNow
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint32_t
+ *      Time since reset in [us]
+ * 
+ * <b>Description:</b>
+ * Accumulates the timer counts since the previous timestamp. The interval between two 
+ * timestamps must not exceed one period of the 16-bit profiler timer counter.
+ * ***********************************************************************************************/
+inline volatile uint32_t boot_ProfileNow(void) {
+    
+    volatile uint16_t counter = 0;
+    volatile uint32_t fcy = 0;
+    
+    counter = BOOT_PROF_TIMER_COUNTER_REGISTER;
+    boot_prof_clock.time += ((float)((uint16_t)(counter - boot_prof_clock.counter)) * boot_prof_clock.tick);
+    boot_prof_clock.counter = counter;
+    
+    // Update conversion factor to the recent CPU clock
+    fcy = system_frequencies.fcy;
+    if (fcy == 0)
+    { fcy = BOOT_PROF_FCY_RESET; } // System frequencies have not been determined yet
+    boot_prof_clock.tick = (((float)BOOT_PROF_TIMER_PRESCALER * 1.0e6) / (float)fcy);
+    
+    return((uint32_t)boot_prof_clock.time);
+}
+
+/*!boot_ProfileRecord
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t index: index of the step record
+ *      uint16_t id: step ID
+ *      uint32_t start: start time of the call in [us]
+ *      uint32_t end: end time of the call in [us]
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * ***********************************************************************************************/
+inline volatile uint16_t boot_ProfileRecord(volatile uint16_t index, volatile uint16_t id, 
+                            volatile uint32_t start, volatile uint32_t end) {
+    
+    volatile BOOT_PROF_STEP_t* rec = &boot_profile.step[index];
+    
+    if (rec->calls == 0)
+    { 
+        rec->id = id;
+        rec->start = start; 
+    }
+    if (rec->calls < 0xFFFF)
+    { rec->calls++; }
+    rec->end = end;
+    rec->busy += (end - start);
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_BOOT_PROFILER */
+
+// EOF
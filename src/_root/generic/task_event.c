@@ -0,0 +1,149 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_event.c
+ *****************************************************************************
+ * File:   task_event.c
+ *
+ * Summary:
+ * Publish/subscribe event bus between tasks, task manager and fault handler
+ *
+ * Description:	
+ * The event masks declared by the subscriber registry are inverted into one 
+ * subscriber bitmask per event by init_EventBus(). Posting an event copies 
+ * the subscriber bitmask of the event into its delivery word, marking the 
+ * event as undelivered for all interested subscribers. A subscriber takes 
+ * an event by testing and clearing its own bit in the delivery word of the 
+ * event. Both operations take constant time independent from the number 
+ * of registered events and subscribers.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_event.h
+ * task_manager_config.h
+ * apl/config/events.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_event.h"
+
+#if (USE_TASK_MANAGER_EVENT_BUS == 1)
+
+// Event delivery state
+volatile task_event_bus_t task_event_bus;
+
+/*!task_event_subscriptions[]
+ * ***********************************************************************************************
+ * Description:
+ * Event masks of all subscribers labeled by task_event_subscriber_e, generated from the event 
+ * subscriber registry (see apl/config/events.h).
+ * ***********************************************************************************************/
+#define EVENT_SUBSCRIBER_REGISTRY_MASK(id, events)  (uint16_t)(events),
+
+const uint16_t task_event_subscriptions[EVENT_SUBSCRIBER_COUNT] = {
+    EVENT_SUBSCRIBER_REGISTRY(EVENT_SUBSCRIBER_REGISTRY_MASK)
+};
+
+/*!init_EventBus
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Builds the subscriber bitmask of each event from the event masks of the subscriber registry 
+ * and discards all undelivered events. This function is called by init_TaskManager() before 
+ * the first event is posted.
+ * ***********************************************************************************************/
+volatile uint16_t init_EventBus(void) {
+
+    volatile uint16_t id = 0, sub = 0;
+    
+    for (id = 0; id < EVENT_COUNT; id++)
+    {
+        task_event_bus.undelivered[id] = 0;
+        task_event_bus.subscribers[id] = 0;
+        
+        for (sub = 0; sub < EVENT_SUBSCRIBER_COUNT; sub++)
+        {
+            if (task_event_subscriptions[sub] & EVENT_MASK(id))
+            { task_event_bus.subscribers[id] |= (1U << sub); }
+        }
+    }
+    
+    return(1);
+}
+
+/*!task_EventTake
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t subscriber: subscriber ID of type task_event_subscriber_e
+ *      uint16_t events: ORed event masks (EVENT_MASK()) of the events to be taken
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Event masks of all given events which have been posted since the subscriber has taken 
+ *      them the last time (0 = no event pending)
+ * 
+ * <b>Description:</b>
+ * Takes the given events of the subscriber from the event bus. Each given event costs one bit 
+ * test of its delivery word. Events are cleared while interrupts are held off, as they may be 
+ * posted by interrupt service routines.
+ * ***********************************************************************************************/
+volatile uint16_t task_EventTake(volatile uint16_t subscriber, volatile uint16_t events) {
+
+    uint16_t sub_mask = (1U << subscriber);
+    uint16_t taken = 0;
+    uint16_t id = 0;
+    uint16_t ipl_buffer = 0;
+    
+    while (events)
+    {
+        id = (__builtin_ff1r(events) - 1); // FF1R returns 1 for bit #0
+        events &= ~EVENT_MASK(id);
+        
+        if ((id < EVENT_COUNT) && (task_event_bus.undelivered[id] & sub_mask))
+        {
+            SET_AND_SAVE_CPU_IPL(ipl_buffer, 7); // Hold off all interrupts for two instruction cycles
+            task_event_bus.undelivered[id] &= ~sub_mask;
+            RESTORE_CPU_IPL(ipl_buffer);
+            taken |= EVENT_MASK(id);
+        }
+    }
+    
+    return(taken);
+}
+
+#endif  /* USE_TASK_MANAGER_EVENT_BUS */
+
+// EOF
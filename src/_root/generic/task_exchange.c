@@ -0,0 +1,485 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_exchange.c
+ *****************************************************************************
+ * File:   task_exchange.c
+ *
+ * Summary:
+ * Lock-free data exchange between interrupt service routines and tasks
+ *
+ * Description:	
+ * This file holds the access functions of the seqlock, double buffer and 
+ * single-producer/single-consumer ring buffer primitives. None of these 
+ * functions changes the CPU priority level or suspends interrupts. Data is
+ * always completely written before it is published by a single 16-bit write
+ * of a sequence counter or index and completely copied before it is released.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_exchange.h
+ * task_history.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/generic/task_exchange.h"
+
+/*!seqlock_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Resets the sequence counter and the collision counter. This function must only be called 
+ * while neither the writer nor any reader is accessing the data block.
+ * ***********************************************************************************************/
+volatile uint16_t seqlock_Init(volatile SEQLOCK_t* lock) {
+    
+    if (lock == NULL)
+    { return(0); }
+    
+    lock->sequence = 0;
+    lock->collisions = 0;
+    
+    return(1);
+}
+
+/*!seqlock_WriteBegin
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Marks the beginning of a write access to the protected data block. The sequence counter 
+ * becomes odd, which makes all readers discard the data they copy until seqlock_WriteEnd() has 
+ * been called. This function may only be called by the one writer of the data block.
+ * ***********************************************************************************************/
+inline volatile uint16_t seqlock_WriteBegin(volatile SEQLOCK_t* lock) {
+    SEQLOCK_WRITE_BEGIN(*lock);
+    return(1);
+}
+
+/*!seqlock_WriteEnd
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Marks the end of a write access to the protected data block. The sequence counter becomes 
+ * even again and differs from the value readers captured before the write access started.
+ * ***********************************************************************************************/
+inline volatile uint16_t seqlock_WriteEnd(volatile SEQLOCK_t* lock) {
+    SEQLOCK_WRITE_END(*lock);
+    return(1);
+}
+
+/*!seqlock_ReadBegin
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Recent sequence counter value, which has to be passed to seqlock_ReadRetry()
+ * 
+ * <b>Description:</b>
+ * Captures the sequence counter before the protected data block is copied.
+ * ***********************************************************************************************/
+inline volatile uint16_t seqlock_ReadBegin(volatile SEQLOCK_t* lock) {
+    return(lock->sequence);
+}
+
+/*!seqlock_ReadRetry
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ *      sequence: sequence counter value returned by seqlock_ReadBegin()
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: The data copied is consistent
+ *      1: The data block has been written while it was copied. The copy has to be repeated.
+ * 
+ * <b>Description:</b>
+ * Checks if the writer has been active since seqlock_ReadBegin() has been called. Failed 
+ * attempts are counted in the collision counter of the seqlock.
+ * ***********************************************************************************************/
+inline volatile uint16_t seqlock_ReadRetry(volatile SEQLOCK_t* lock, volatile uint16_t sequence) {
+    
+    if ((sequence & 0x0001) || (sequence != lock->sequence))
+    {
+        lock->collisions++;
+        return(1);
+    }
+    
+    return(0);
+}
+
+/*!seqlock_Write
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ *      data: pointer to the protected data block
+ *      source: pointer to the data to be written
+ *      words: number of words to be written
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Copies <words> words from <source> into the protected data block. This function may only be 
+ * called by the one writer of the data block.
+ * ***********************************************************************************************/
+volatile uint16_t seqlock_Write(volatile SEQLOCK_t* lock, volatile uint16_t* data, 
+                                volatile uint16_t* source, volatile uint16_t words) {
+    
+    volatile uint16_t i=0;
+    
+    if ((lock == NULL) || (data == NULL) || (source == NULL))
+    { return(0); }
+    
+    SEQLOCK_WRITE_BEGIN(*lock);
+    for (i=0; i<words; i++)
+    { data[i] = source[i]; }
+    SEQLOCK_WRITE_END(*lock);
+    
+    return(1);
+}
+
+/*!seqlock_Read
+ * ***********************************************************************************************
+ * Parameters:
+ *      lock: pointer to the seqlock
+ *      data: pointer to the protected data block
+ *      target: pointer to the buffer the data will be copied to
+ *      words: number of words to be copied
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter or no consistent copy within SEQLOCK_READ_RETRIES attempts
+ *      1: Consistent copy of the data block is available in <target>
+ * 
+ * <b>Description:</b>
+ * Copies <words> words of the protected data block into <target> and repeats the copy when the 
+ * writer has been active in the meantime. The reader never blocks the writer. When the call 
+ * fails, the contents of <target> are undefined.
+ * ***********************************************************************************************/
+volatile uint16_t seqlock_Read(volatile SEQLOCK_t* lock, volatile uint16_t* data, 
+                               volatile uint16_t* target, volatile uint16_t words) {
+    
+    volatile uint16_t i=0, attempt=0, sequence=0;
+    
+    if ((lock == NULL) || (data == NULL) || (target == NULL))
+    { return(0); }
+    
+    for (attempt=0; attempt<SEQLOCK_READ_RETRIES; attempt++)
+    {
+        sequence = seqlock_ReadBegin(lock);
+        for (i=0; i<words; i++)
+        { target[i] = data[i]; }
+        
+        if (!seqlock_ReadRetry(lock, sequence))
+        { return(1); }
+    }
+    
+    return(0);
+}
+
+/*!dbuf_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      dbuf: pointer to the double buffer
+ *      buffer_a: pointer to the first data block
+ *      buffer_b: pointer to the second data block
+ *      words: size of each data block in words
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Assigns the two data blocks to the double buffer, clears both blocks and selects the first 
+ * block as active.
+ * ***********************************************************************************************/
+volatile uint16_t dbuf_Init(volatile DOUBLE_BUFFER_t* dbuf, volatile uint16_t* buffer_a, 
+                            volatile uint16_t* buffer_b, volatile uint16_t words) {
+    
+    volatile uint16_t i=0;
+    
+    if ((dbuf == NULL) || (buffer_a == NULL) || (buffer_b == NULL) || (buffer_a == buffer_b))
+    { return(0); }
+    
+    for (i=0; i<words; i++)
+    { 
+        buffer_a[i] = 0;
+        buffer_b[i] = 0;
+    }
+
+    dbuf->buffer[0] = buffer_a;
+    dbuf->buffer[1] = buffer_b;
+    dbuf->words = words;
+    dbuf->active = 0;
+    dbuf->sequence = 0;
+    
+    return(1);
+}
+
+/*!dbuf_WriteBuffer
+ * ***********************************************************************************************
+ * Parameters:
+ *      dbuf: pointer to the double buffer
+ * 
+ * Return:
+ *      type: uint16_t*
+ *      Pointer to the inactive data block
+ * 
+ * <b>Description:</b>
+ * Returns the data block the writer fills with the next data set. The block is not visible to
+ * readers until dbuf_Publish() has been called. This function may only be called by the one 
+ * writer of the double buffer.
+ * ***********************************************************************************************/
+inline volatile uint16_t* dbuf_WriteBuffer(volatile DOUBLE_BUFFER_t* dbuf) {
+    return(dbuf->buffer[(dbuf->active ^ 0x0001)]);
+}
+
+/*!dbuf_Publish
+ * ***********************************************************************************************
+ * Parameters:
+ *      dbuf: pointer to the double buffer
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Makes the data block returned by dbuf_WriteBuffer() the active block by a single word write 
+ * of the active index and increments the publication counter.
+ * ***********************************************************************************************/
+inline volatile uint16_t dbuf_Publish(volatile DOUBLE_BUFFER_t* dbuf) {
+    
+    volatile uint16_t next = (dbuf->active ^ 0x0001);
+    
+    dbuf->active = next; // Publish the new data set
+    dbuf->sequence++;
+    
+    return(1);
+}
+
+/*!dbuf_ReadBuffer
+ * ***********************************************************************************************
+ * Parameters:
+ *      dbuf: pointer to the double buffer
+ * 
+ * Return:
+ *      type: uint16_t*
+ *      Pointer to the active data block
+ * 
+ * <b>Description:</b>
+ * Returns the data block holding the most recent complete data set. The block is only 
+ * guaranteed to be consistent while the reader cannot be preempted by the writer, e.g. when 
+ * the reader is an interrupt service routine and the writer a task. Readers of lower priority
+ * than the writer have to use dbuf_Read().
+ * ***********************************************************************************************/
+inline volatile uint16_t* dbuf_ReadBuffer(volatile DOUBLE_BUFFER_t* dbuf) {
+    return(dbuf->buffer[dbuf->active]);
+}
+
+/*!dbuf_Read
+ * ***********************************************************************************************
+ * Parameters:
+ *      dbuf: pointer to the double buffer
+ *      target: pointer to the buffer the data will be copied to
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter or no consistent copy within SEQLOCK_READ_RETRIES attempts
+ *      1: Consistent copy of the active data block is available in <target>
+ * 
+ * <b>Description:</b>
+ * Copies the active data block into <target>. The copy is repeated when a new data set has 
+ * been published in the meantime, as the writer may already be filling the block being copied.
+ * ***********************************************************************************************/
+volatile uint16_t dbuf_Read(volatile DOUBLE_BUFFER_t* dbuf, volatile uint16_t* target) {
+    
+    volatile uint16_t i=0, attempt=0, sequence=0;
+    volatile uint16_t* data;
+    
+    if ((dbuf == NULL) || (target == NULL))
+    { return(0); }
+    
+    for (attempt=0; attempt<SEQLOCK_READ_RETRIES; attempt++)
+    {
+        sequence = dbuf->sequence;
+        data = dbuf->buffer[dbuf->active];
+        for (i=0; i<dbuf->words; i++)
+        { target[i] = data[i]; }
+        
+        if (sequence == dbuf->sequence)
+        { return(1); }
+    }
+    
+    return(0);
+}
+
+/*!spsc_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      ring: pointer to the ring buffer
+ *      buffer: pointer to the element array of <elements> x <words> words
+ *      elements: number of elements (has to be a power of two)
+ *      words: size of each element in words
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Assigns the element array to the ring buffer and discards all elements. This function must 
+ * only be called while neither the producer nor the consumer is accessing the ring buffer.
+ * ***********************************************************************************************/
+volatile uint16_t spsc_Init(volatile SPSC_RING_t* ring, volatile uint16_t* buffer, 
+                            volatile uint16_t elements, volatile uint16_t words) {
+    
+    if ((ring == NULL) || (buffer == NULL) || (words == 0) || 
+        (elements == 0) || (elements & (elements - 1)))
+    { return(0); }
+    
+    ring->buffer = buffer;
+    ring->mask = (elements - 1);
+    ring->words = words;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+    
+    return(1);
+}
+
+/*!spsc_Push
+ * ***********************************************************************************************
+ * Parameters:
+ *      ring: pointer to the ring buffer
+ *      source: pointer to the element to be added
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Buffer full, the element has been dropped
+ *      1: Element has been added
+ * 
+ * <b>Description:</b>
+ * Copies one element into the ring buffer and publishes it by advancing the head index. This 
+ * function may only be called by the one producer of the ring buffer.
+ * ***********************************************************************************************/
+volatile uint16_t spsc_Push(volatile SPSC_RING_t* ring, volatile uint16_t* source) {
+    
+    volatile uint16_t head = ring->head;
+    volatile uint16_t i=0;
+    volatile uint16_t* element;
+    
+    if ((uint16_t)(head - ring->tail) > ring->mask)
+    {
+        ring->dropped++; // buffer full, consumer has not caught up
+        return(0);
+    }
+    
+    element = &ring->buffer[(head & ring->mask) * ring->words];
+    for (i=0; i<ring->words; i++)
+    { element[i] = source[i]; }
+    
+    ring->head = (head + 1); // Publish element
+    
+    return(1);
+}
+
+/*!spsc_Pop
+ * ***********************************************************************************************
+ * Parameters:
+ *      ring: pointer to the ring buffer
+ *      target: pointer to the buffer the oldest element will be copied to
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: No element available
+ *      1: Element has been copied and removed from the buffer
+ * 
+ * <b>Description:</b>
+ * Copies the oldest element of the ring buffer and releases it by advancing the tail index. 
+ * This function may only be called by the one consumer of the ring buffer.
+ * ***********************************************************************************************/
+volatile uint16_t spsc_Pop(volatile SPSC_RING_t* ring, volatile uint16_t* target) {
+    
+    volatile uint16_t tail = ring->tail;
+    volatile uint16_t i=0;
+    volatile uint16_t* element;
+    
+    if (tail == ring->head)
+    { return(0); }
+    
+    element = &ring->buffer[(tail & ring->mask) * ring->words];
+    for (i=0; i<ring->words; i++)
+    { target[i] = element[i]; }
+    
+    ring->tail = (tail + 1); // Release element
+    
+    return(1);
+}
+
+/*!spsc_Count
+ * ***********************************************************************************************
+ * Parameters:
+ *      ring: pointer to the ring buffer
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Number of elements available to be read
+ * ***********************************************************************************************/
+inline volatile uint16_t spsc_Count(volatile SPSC_RING_t* ring) {
+    return((uint16_t)(ring->head - ring->tail));
+}
+
+// EOF
@@ -0,0 +1,167 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_history.c
+ *****************************************************************************
+ * File:   task_history.c
+ *
+ * Summary:
+ * CPU load and task execution time history ring buffer
+ *
+ * Description:	
+ * This file holds the load history ring buffer and its access functions. 
+ * The buffer is a lock-free single-producer/single-consumer queue: the head
+ * index is only modified by the scheduler (producer) and the tail index is 
+ * only modified by the reader (consumer). A record is always completely 
+ * written before the head index is advanced and completely copied before
+ * the tail index is advanced. As 16-bit index accesses are atomic on the 
+ * dsPIC33 core, the reader may run in a task or in an interrupt service 
+ * routine without disabling interrupts.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_history.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_history.h"
+
+#if (USE_TASK_MANAGER_LOAD_HISTORY == 1)
+
+#define LOAD_HISTORY_INDEX_MASK     (TASK_MGR_LOAD_HISTORY_DEPTH - 1)
+
+// Load history ring buffer
+volatile load_history_record_t load_history[TASK_MGR_LOAD_HISTORY_DEPTH];
+
+// Load history status
+volatile load_history_status_t load_history_status;
+
+/*!task_LoadHistoryWrite
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Pushes the execution profile of the most recent scheduler tick into the ring buffer. This 
+ * function is called by the scheduler only. When the buffer is full the record is dropped.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_LoadHistoryWrite(void) {
+    
+    volatile uint16_t head = load_history_status.head;
+    volatile uint16_t index = 0;
+    
+    if ((uint16_t)(head - load_history_status.tail) >= TASK_MGR_LOAD_HISTORY_DEPTH)
+    {
+        load_history_status.dropped++; // buffer full, reader has not caught up
+        return(1);
+    }
+    
+    index = (head & LOAD_HISTORY_INDEX_MASK);
+    load_history[index].timestamp = task_mgr.tick_ctrl.counter;
+    load_history[index].task_id = task_mgr.exec_task_id;
+    load_history[index].task_time = task_mgr.task_time_ctrl.task_time;
+    load_history[index].cpu_load = task_mgr.cpu_load.load;
+    
+    load_history_status.head = (head + 1); // Publish record
+    
+    return(1);
+}
+
+/*!task_LoadHistoryRead
+ * ***********************************************************************************************
+ * Parameters:
+ *      record: pointer to the record the oldest history entry will be copied to
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: No record available
+ *      1: Record has been copied and removed from the buffer
+ * 
+ * <b>Description:</b>
+ * Pulls the oldest record from the load history ring buffer. This function may only be 
+ * called by one reader.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_LoadHistoryRead(volatile load_history_record_t* record) {
+    
+    volatile uint16_t tail = load_history_status.tail;
+    volatile uint16_t index = 0;
+    
+    if ((record == NULL) || (tail == load_history_status.head))
+    { return(0); }
+    
+    index = (tail & LOAD_HISTORY_INDEX_MASK);
+    record->timestamp = load_history[index].timestamp;
+    record->task_id = load_history[index].task_id;
+    record->task_time = load_history[index].task_time;
+    record->cpu_load = load_history[index].cpu_load;
+    
+    load_history_status.tail = (tail + 1); // Release record
+    
+    return(1);
+}
+
+/*!task_LoadHistoryCount
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      Number of records available to be read
+ * ***********************************************************************************************/
+inline volatile uint16_t task_LoadHistoryCount(void) {
+    return((uint16_t)(load_history_status.head - load_history_status.tail));
+}
+
+/*!task_LoadHistoryFlush
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Discards all records and resets the drop counter. This function must only be called while
+ * the scheduler and the reader are not accessing the buffer (e.g. during initialization).
+ * ***********************************************************************************************/
+inline volatile uint16_t task_LoadHistoryFlush(void) {
+
+    load_history_status.head = 0;
+    load_history_status.tail = 0;
+    load_history_status.dropped = 0;
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_LOAD_HISTORY */
+
+// EOF
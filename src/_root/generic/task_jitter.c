@@ -0,0 +1,199 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_jitter.c
+ *****************************************************************************
+ * File:   task_jitter.c
+ *
+ * Summary:
+ * Scheduler slot-start latency and slot phase time monitor
+ *
+ * Description:	
+ * The scheduler calls task_JitterSlotStart() right after the wait loop for the
+ * next time slot has been left and task_JitterPhaseEnd() at the end of each
+ * framework phase. Both functions capture the task manager timer counter and
+ * update the statistics in slot_profile.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_jitter.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_jitter.h"
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+
+// Slot-start latency and slot phase time statistics
+volatile slot_profile_t slot_profile;
+
+/* private function prototypes */
+inline volatile uint16_t task_JitterElapsed(volatile uint16_t start, volatile uint16_t stop);
+
+/*!task_JitterSlotStart
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Captures the timer counter as slot-start latency of the time slot which has just begun and
+ * updates minimum, maximum, histogram and late slot counter. This function is called by the 
+ * scheduler right after the wait loop has been left.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_JitterSlotStart(void) {
+    
+    volatile uint16_t latency = TASK_MGR_TIMER_COUNTER_REGISTER; // Capture first to keep the call overhead constant
+    volatile uint16_t bin = 0;
+    
+    slot_profile.timestamp = latency;
+    slot_profile.latency = latency;
+    slot_profile.slots++;
+    
+    if (latency < slot_profile.minimum) { slot_profile.minimum = latency; }
+    if (latency > slot_profile.maximum) { slot_profile.maximum = latency; }
+    if (latency > slot_profile.limit) { slot_profile.late++; }
+    
+    bin = (latency >> TASK_MGR_JITTER_HISTOGRAM_SHIFT);
+    if (bin >= TASK_MGR_JITTER_HISTOGRAM_BINS) 
+    { bin = (TASK_MGR_JITTER_HISTOGRAM_BINS - 1); } // Last bin collects all latencies beyond the histogram range
+    slot_profile.histogram[bin]++;
+    
+    return(1);
+}
+
+/*!task_JitterPhaseEnd
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t phase: framework phase which has just been completed (see SLOT_PHASE_e)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (invalid phase)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Captures the time elapsed since the end of the previous phase. When the last phase of the 
+ * time slot has been completed, the execution time of the entire time slot is updated.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_JitterPhaseEnd(volatile uint16_t phase) {
+    
+    volatile uint16_t now = TASK_MGR_TIMER_COUNTER_REGISTER;
+    volatile uint16_t i = 0, slot_time = 0;
+    volatile slot_phase_time_t* pt;
+    
+    if (phase >= SLOT_PHASE_COUNT) 
+    { return(0); }
+    
+    pt = &slot_profile.phase[phase];
+    pt->recent = task_JitterElapsed(slot_profile.timestamp, now);
+    if (pt->recent > pt->maximum) { pt->maximum = pt->recent; }
+    slot_profile.timestamp = now;
+    
+    if (phase == (SLOT_PHASE_COUNT - 1))
+    {
+        for (i=0; i<SLOT_PHASE_COUNT; i++)
+        { slot_time += slot_profile.phase[i].recent; }
+        
+        slot_profile.slot_time = slot_time;
+        if (slot_time > slot_profile.slot_time_max) 
+        { slot_profile.slot_time_max = slot_time; }
+    }
+    
+    return(1);
+}
+
+/*!task_JitterElapsed
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t start: timer counter value at the beginning of the measurement
+ *      uint16_t stop:  timer counter value at the end of the measurement
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Elapsed time in system timer ticks
+ * 
+ * <b>Description:</b>
+ * The timer counter is reset after having reached the period register value. When the stop 
+ * value has wrapped around, the remaining counts of the previous period are added.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_JitterElapsed(volatile uint16_t start, volatile uint16_t stop) {
+    
+    if (stop >= start)
+    { return(stop - start); }
+    
+    return((TASK_MGR_TIMER_PERIOD_REGISTER - start) + stop + 1);
+}
+
+/*!task_JitterReset
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Clears the jitter statistics and derives the latency limit from the recent scheduler period.
+ * This function is called by init_TaskManager() after the scheduler timer has been configured.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_JitterReset(void) {
+    
+    volatile uint16_t i = 0;
+    
+    slot_profile.latency = 0;
+    slot_profile.minimum = 0xFFFF;
+    slot_profile.maximum = 0;
+    slot_profile.late = 0;
+    slot_profile.limit = (task_mgr.task_time_ctrl.quota >> TASK_MGR_JITTER_LIMIT_SHIFT);
+    slot_profile.slots = 0;
+    
+    for (i=0; i<TASK_MGR_JITTER_HISTOGRAM_BINS; i++)
+    { slot_profile.histogram[i] = 0; }
+    
+    for (i=0; i<SLOT_PHASE_COUNT; i++)
+    {
+        slot_profile.phase[i].recent = 0;
+        slot_profile.phase[i].maximum = 0;
+    }
+    
+    slot_profile.slot_time = 0;
+    slot_profile.slot_time_max = 0;
+    slot_profile.timestamp = 0;
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_JITTER_MONITOR */
+
+// EOF
@@ -53,12 +53,38 @@
 #include "_root/config/task_manager_config.h"
 #include "_root/generic/task_manager.h"
 #include "apl/config/tasks.h"
+#include "_root/generic/task_warmboot.h"
+#include "_root/generic/task_watchdog.h"
+#include "_root/generic/task_trace.h"
+#include "_root/generic/task_bootprof.h"
+#include "_root/generic/task_jitter.h"
+#include "_root/generic/task_resumable.h"
+#include "_root/generic/task_event.h"
 
 // Private label for resetting a task queue
 #define TASK_ZERO   0   
 
 // Task Manager
-volatile task_manager_settings_t task_mgr; // Declare a data structure holding the settings of the task manager
+task_manager_settings_t __attribute__((near))task_mgr; // Declare a data structure holding the settings of the task manager
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+// Per-task execution time statistics
+volatile task_statistics_t task_stats[TASK_TABLE_SIZE];
+#endif
+
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+// Period counters of the entries of the active multi-rate task queue
+volatile uint16_t task_queue_countdown[TASK_MGR_QUEUE_SIZE_MAX];
+#endif
+
+/* private function prototypes */
+inline volatile uint16_t task_ExecuteTask(volatile uint16_t task_id);
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+inline volatile uint16_t task_UpdateStatistics(volatile uint16_t task_id, volatile uint16_t task_time);
+#endif
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+inline volatile uint16_t task_InitMultiRateQueue(void);
+#endif
 
 //------------------------------------------------------------------------------
 // execute task manager scheduler
@@ -66,28 +92,87 @@ volatile task_manager_settings_t task_mgr; // Declare a data structure holding t
 
 inline volatile uint16_t task_manager_tick(void) {
 
-    volatile uint16_t fres = 0, tbuf = 0;
+    volatile uint16_t fres = 0;
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    volatile uint16_t i = 0, slot_time = 0;
+    #endif
 
     // The task manager scheduler runs through the currently selected task queue in n steps.
     // After the last item of each queue the operation mode switch-over check is performed and the 
     // task tick index is reset to zero, which causes the first task of the queue to be called at 
     // the next scheduler tick.
 
-    // Indices 0 ... (n-1) are calling queued user tasks
-    task_mgr.exec_task_id = task_mgr.task_queue[task_mgr.task_queue_tick_index]; // Pick next task in the queue
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+
+    // In multi-rate mode all queue entries which are due in this time slot are executed
+    fres = 1;
+    
+    for (i=0; i<task_mgr.task_queue_items; i++)
+    {
+        if (task_queue_countdown[i] == 0)
+        {
+            task_queue_countdown[i] = (task_mgr.task_queue[i].period - 1); // Reload period counter
+            task_mgr.exec_task_period = task_mgr.task_queue[i].period; // Call interval of the due task
+            BOOT_PROF_TASK_BEGIN();
+            fres &= task_ExecuteTask(task_mgr.task_queue[i].task_id); // Execute due task
+            BOOT_PROF_TASK_END(i, task_mgr.task_queue[i].task_id);
+            slot_time += task_mgr.task_time_ctrl.task_time; // Accumulate time slot load
+        }
+        else
+        {
+            task_queue_countdown[i]--;
+        }
+    }
+    
+    task_mgr.task_time_ctrl.task_time = slot_time;
+    
+    #else
+    
+    // Indices 0 ... (n-1) are calling queued user tasks, each once per queue pass
+    task_mgr.exec_task_period = (task_mgr.task_queue_ubound + 1);
+    BOOT_PROF_TASK_BEGIN();
+    fres = task_ExecuteTask(task_mgr.task_queue[task_mgr.task_queue_tick_index]); // Execute next task in the queue
+    BOOT_PROF_TASK_END(task_mgr.task_queue_tick_index, task_mgr.task_queue[task_mgr.task_queue_tick_index]);
+    
+    #endif
+
+    // track maximum execution time
+    if(task_mgr.task_time_ctrl.task_time > task_mgr.task_time_ctrl.maximum)
+    {
+        task_mgr.task_time_ctrl.maximum = task_mgr.task_time_ctrl.task_time; // override maximum time buffer value
+    }
+    
+    return (fres);
+}
+
+//------------------------------------------------------------------------------
+// execute a single task with execution time measurement
+//------------------------------------------------------------------------------
+
+inline volatile uint16_t task_ExecuteTask(volatile uint16_t task_id) {
+
+    volatile uint16_t fres = 0, tbuf = 0;
+
+    task_mgr.exec_task_id = task_id; // Pick next task in the queue
 
     // Determine error code for the upcoming task
     task_mgr.proc_code.segments.op_mode = (uint8_t)(task_mgr.op_mode.mode);    // log operation mode
     task_mgr.proc_code.segments.task_id = (uint8_t)(task_mgr.exec_task_id);   // log upcoming task-ID
 
     // Capture task start time for time quota monitoring
-    task_mgr.task_time_ctrl.buffer = *task_mgr.reg_task_timer_counter; // Capture timer counter before task execution
+    task_mgr.task_time_ctrl.buffer = TASK_MGR_TIMER_COUNTER_REGISTER; // Capture timer counter before task execution
 
     // Execute next task in the queue
+    TRACE_TASK(TRACE_EVT_TASK_START, task_mgr.exec_task_id);
     fres = Task_Table[task_mgr.exec_task_id](); // Execute currently selected task
+    TRACE_TASK(TRACE_EVT_TASK_END, fres);
+    
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    task_wdt.checkin |= wdt_checkin_task_mask[task_mgr.exec_task_id]; // Watchdog check-in of the executed task
+    #endif
 
     // Capture time to determine elapsed task executing time
-    tbuf = *task_mgr.reg_task_timer_counter;
+    tbuf = TASK_MGR_TIMER_COUNTER_REGISTER;
     
     // Copy return value into process code for fault analysis
     task_mgr.proc_code.segments.retval = fres;
@@ -100,19 +185,175 @@ inline volatile uint16_t task_manager_tick(void) {
     else
     // if timer has overrun try to capture the total elapsed time
     {
-        tbuf = (*task_mgr.reg_task_timer_period - tbuf); // capture expired time until end of timer period
+        tbuf = (TASK_MGR_TIMER_PERIOD_REGISTER - tbuf); // capture expired time until end of timer period
         task_mgr.task_time_ctrl.task_time = (tbuf + task_mgr.task_time_ctrl.buffer); // add elapsed time into the new period
     }
 
-    // track maximum execution time
-    if(task_mgr.task_time_ctrl.task_time > task_mgr.task_time_ctrl.maximum)
+    #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    task_UpdateStatistics(task_mgr.exec_task_id, task_mgr.task_time_ctrl.task_time);
+    task_ResumableAccount(task_mgr.task_time_ctrl.task_time); // Add slice time to the job of a resumable task
+    #endif
+    
+    return (fres);
+}
+
+#if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+/*!task_InitMultiRateQueue
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (queue exceeds TASK_MGR_QUEUE_SIZE_MAX or holds an invalid period)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * This function is called when a new task queue has been selected. task_mgr.task_queue_ubound 
+ * is expected to hold the number of queue entries - 1. The phase offset of each entry is loaded
+ * into its period counter and task_mgr.task_queue_ubound is replaced by the length of the queue 
+ * frame (longest period in the queue) - 1.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_InitMultiRateQueue(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0, frame = 1;
+    
+    task_mgr.task_queue_items = (task_mgr.task_queue_ubound + 1);
+    
+    if (task_mgr.task_queue_items > TASK_MGR_QUEUE_SIZE_MAX)
     {
-        task_mgr.task_time_ctrl.maximum = task_mgr.task_time_ctrl.task_time; // override maximum time buffer value
+        task_mgr.task_queue_items = TASK_MGR_QUEUE_SIZE_MAX; // Ignore entries beyond the maximum queue size
+        fres = 0;
     }
     
-    return (fres);
+    for (i=0; i<task_mgr.task_queue_items; i++)
+    {
+        if (task_mgr.task_queue[i].period == 0) 
+        { 
+            task_queue_countdown[i] = 0xFFFF; // invalid entries are never called
+            fres = 0;
+        }
+        else
+        { 
+            task_queue_countdown[i] = (task_mgr.task_queue[i].phase % task_mgr.task_queue[i].period); 
+            if (task_mgr.task_queue[i].period > frame)
+            { frame = task_mgr.task_queue[i].period; }
+        }
+    }
+    
+    task_mgr.task_queue_ubound = (frame - 1);
+    
+    return(fres);
+}
+#endif
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+/*!task_UpdateStatistics
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t task_id:   ID of the task executed last
+ *      uint16_t task_time: captured execution time of this task in timer ticks
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Adds the most recent execution time to the statistics record of the given task. 
+ * The update has a constant execution time: the histogram bin is determined by the position
+ * of the most significant bit of the task time using the FF1L instruction.
+ * Counters wrap around when they overflow.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_UpdateStatistics(volatile uint16_t task_id, volatile uint16_t task_time)
+{
+    volatile task_statistics_t* tstat;
+    volatile uint16_t bin = 0;
+    
+    tstat = &task_stats[task_id];
+    tstat->calls++;
+    
+    if (task_time < tstat->minimum) { tstat->minimum = task_time; }
+    if (task_time > tstat->maximum) { tstat->maximum = task_time; }
+    
+    // Exponentially weighted moving average: avg += (x - avg) / 2^n
+    tstat->average_filter = tstat->average_filter - (tstat->average_filter >> TASK_MGR_STATS_EWMA_SHIFT) + task_time;
+    tstat->average = (uint16_t)(tstat->average_filter >> TASK_MGR_STATS_EWMA_SHIFT);
+    
+    // log2(task_time) = 16 - FF1L(task_time) (FF1L returns 1 for bit #15 and 16 for bit #0)
+    if (task_time > 0)
+    { bin = ((16 - __builtin_ff1l(task_time)) >> TASK_MGR_STATS_HISTOGRAM_SHIFT); }
+    tstat->histogram[bin]++;
+    
+    return(1);
 }
 
+/*!task_ResetStatistics
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Clears the execution time statistics records of all tasks registered in Task_Table[]
+ * ***********************************************************************************************/
+inline volatile uint16_t task_ResetStatistics(void)
+{
+    volatile uint16_t i = 0, j = 0;
+    
+    for (i=0; i<TASK_TABLE_SIZE; i++)
+    {
+        task_stats[i].calls = 0;
+        task_stats[i].minimum = 0xFFFF;
+        task_stats[i].maximum = 0;
+        task_stats[i].average = 0;
+        task_stats[i].average_filter = 0;
+        for (j=0; j<TASK_MGR_STATS_HISTOGRAM_BINS; j++)
+        { task_stats[i].histogram[j] = 0; }
+    }
+    
+    return(1);
+}
+#endif
+
+
+/*!task_UpdateCPULoad
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Derives the CPU utilization from the most recent free CPU time result task_mgr.cpu_load.load 
+ * and updates the utilization peak-hold value and decaying average. This function is called by
+ * the main loop once per scheduler tick.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_UpdateCPULoad(void)
+{
+    volatile uint16_t util = 0;
+    
+    if (task_mgr.cpu_load.load < 1000)
+    { util = (1000 - task_mgr.cpu_load.load); }
+    
+    task_mgr.cpu_load.utilization = util;
+    
+    // Peak-hold: new peaks are reported immediately, the window peak is released after the window has expired
+    if (util > task_mgr.cpu_load.peak_buffer)
+    { task_mgr.cpu_load.peak_buffer = util; }
+    if (util > task_mgr.cpu_load.peak)
+    { task_mgr.cpu_load.peak = util; }
+    
+    if (++task_mgr.cpu_load.peak_window_counter >= TASK_MGR_TICKS(TASK_MGR_CPU_LOAD_PEAK_WINDOW))
+    {
+        task_mgr.cpu_load.peak = task_mgr.cpu_load.peak_buffer;
+        task_mgr.cpu_load.peak_buffer = 0;
+        task_mgr.cpu_load.peak_window_counter = 0;
+    }
+    
+    // Exponentially weighted moving average: avg += (x - avg) / 2^n
+    task_mgr.cpu_load.average_filter = task_mgr.cpu_load.average_filter - 
+                (task_mgr.cpu_load.average_filter >> TASK_MGR_CPU_LOAD_AVERAGE_SHIFT) + util;
+    task_mgr.cpu_load.average = (uint16_t)(task_mgr.cpu_load.average_filter >> TASK_MGR_CPU_LOAD_AVERAGE_SHIFT);
+    
+    return(1);
+}
 
 //------------------------------------------------------------------------------
 // Check operation mode status and switch op mode if needed
@@ -120,118 +361,85 @@ inline volatile uint16_t task_manager_tick(void) {
 
 inline volatile uint16_t task_CheckOperationModeStatus(void) {
 
-    // Short Fix if MCC Configuration is used
-    if ((task_mgr.pre_op_mode.mode == OP_MODE_BOOT) && (task_mgr.op_mode.mode == OP_MODE_BOOT)) 
-     // Boot-up task queue is only run once
+    volatile uint16_t index = 0;
+    const task_op_mode_descriptor_t* opmd;
+
+    // Operation modes like boot, device startup and system startup are only run once.
+    // After one complete pass through their task queue, the follow-up operation mode
+    // declared in the operation mode descriptor is selected
+    if (task_mgr.pre_op_mode.mode == task_mgr.op_mode.mode) 
     {
-        task_mgr.op_mode.mode = OP_MODE_DEVICE_STARTUP;
-    } 
-    else if ((task_mgr.pre_op_mode.mode == OP_MODE_DEVICE_STARTUP) && (task_mgr.op_mode.mode == OP_MODE_DEVICE_STARTUP)) 
-    // device resources start-up task queue is only run once before ending in FAULT mode.
-    // only when all fault flags have been cleared the system will be able to enter startup-mode
-    // to enter normal operation.
-    { 
-        task_mgr.op_mode.mode = OP_MODE_SYSTEM_STARTUP; // put system into Fault mode to make sure all FAULT flags are cleared before entering normal operation
-    }
-    else if ((task_mgr.pre_op_mode.mode == OP_MODE_SYSTEM_STARTUP) && (task_mgr.op_mode.mode == OP_MODE_SYSTEM_STARTUP)) 
-    // system-level start-up task queue is only run once before ending in NORMAL mode.
-    { 
-        task_mgr.status.flags.startup_sequence_complete = true;
-        task_mgr.op_mode.mode = OP_MODE_IDLE;
+        opmd = task_mgr.op_mode_descriptor;
+
+        if ((opmd->flags & OP_MODE_FLAG_STARTUP_COMPLETE) && (!task_mgr.status.flags.startup_sequence_complete))
+        { 
+            task_mgr.status.flags.startup_sequence_complete = true; 
+            EVENT_POST(EVT_STARTUP_COMPLETE);
+        }
+
+        #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+        // Capture warm boot snapshot once the startup sequence has been completed
+        if ((task_mgr.status.flags.startup_sequence_complete) && (!warm_boot.captured))
+        { warm_boot_Capture(); }
+        #endif
+
+        if (opmd->next_mode != OP_MODE_UNKNOWN)
+        { task_mgr.op_mode.mode = opmd->next_mode; }
     }
     
-    
     // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Skip execution if operation mode has not changed
     if (task_mgr.pre_op_mode.mode != task_mgr.op_mode.mode) {
 
-        // If a change was detected, select the task queue and reset settings and flags
-        switch (task_mgr.op_mode.mode) {
-            
-            case OP_MODE_BOOT:
-                // Switch to initialization mode operation
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_boot; // Set task queue INIT
-                task_mgr.task_queue_ubound = (task_queue_boot_size-1);
-                task_mgr.op_mode_switch_over_function = 0; // Do not perform any user function during switch-over to this mode
-                break;
-
-            case OP_MODE_DEVICE_STARTUP:
-                // Switch to device startup mode operation (launching and enabling peripherals)
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_device_startup; // Set task queue DEVICE_STARTUP
-                task_mgr.task_queue_ubound = (task_queue_device_startup_size-1);
-                task_mgr.op_mode_switch_over_function = 0; // Do not perform any user function during switch-over to this mode
-                break;
-
-            case OP_MODE_SYSTEM_STARTUP:
-                // Switch to system startup mode operation (launching external systems / power sequencing / soft-start)
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_system_startup; // Set task queue SYSTEM_STARTUP
-                task_mgr.task_queue_ubound = (task_queue_system_startup_size-1);
-                task_mgr.op_mode_switch_over_function = 0; // Do not perform any user function during switch-over to this mode
-                break;
-
-            case OP_MODE_NORMAL:
-                // Switch to normal operation
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_normal; // Set task queue NORMAL
-                task_mgr.task_queue_ubound = (task_queue_normal_size-1);
-                task_mgr.op_mode_switch_over_function = &task_queue_init_normal; // Execute user function before switching to this operating mode
-                break;
-
-            case OP_MODE_FAULT:
-                // Switch to fault mode operation
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_fault; // Set task queue FAULT
-                task_mgr.task_queue_ubound = (task_queue_fault_size-1);
-                task_mgr.status.flags.fault_override = true; // set global fault override flag bit
-                task_mgr.op_mode_switch_over_function = &task_queue_init_fault; // Execute user function before switching to this operating mode
-                break;
-
-            case OP_MODE_STANDBY:
-                // Switch to standby mode operation 
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_standby; // Set task queue STANDBY
-                task_mgr.task_queue_ubound = (task_queue_standby_size-1);
-                task_mgr.op_mode_switch_over_function = &task_queue_init_standby; // Execute user function before switching to this operating mode
-                break;
-
-            default: // OP_MODE_IDLE
-                // Switch to normal operation
-                task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
-                task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
-                task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
-                task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
-                task_mgr.task_queue = task_queue_idle; // Set task queue NORMAL
-                task_mgr.task_queue_ubound = (task_queue_idle_size-1);
-                task_mgr.op_mode_switch_over_function = &task_queue_init_idle; // Execute user function before switching to this operating mode
-                break;
-                
-        }
-
+        // If a change was detected, select the operation mode descriptor by the bit position 
+        // of the new operation mode (FF1R returns 1 for bit #0 and 0 if no bit is set)
+        index = __builtin_ff1r(task_mgr.op_mode.mode);
+        
+        if (index > 0)
+        { opmd = &task_op_mode_table[index - 1]; }
+        else
+        { opmd = NULL; }
+        
+        if ((opmd == NULL) || (opmd->queue == NULL)) // Undefined operation modes run the IDLE task queue
+        { opmd = &task_op_mode_table[OP_MODE_INDEX_IDLE]; }
+
+        TRACE_MODE(TRACE_EVT_OP_MODE, (uint16_t)(opmd - task_op_mode_table));
+        SCOPE_EVENT(SCOPE_TRIGGER_OP_MODE, (opmd - task_op_mode_table));
+        BOOT_PROF_MODE((uint16_t)(opmd - task_op_mode_table));
+
+        if (task_mgr.op_mode_descriptor->leave_function != NULL) // If a leave function has been defined for the recent mode, ...
+        { task_mgr.op_mode_descriptor->leave_function(); } // Execute user function before leaving the recent operating mode
+
+        // Select the task queue and reset settings and flags
+        task_mgr.op_mode_descriptor = opmd;
+        task_mgr.exec_task_id = TASK_ZERO; // Set task ID to DEFAULT (Idle Task))
+        task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
+        task_mgr.task_time_ctrl.task_time = 0; // Reset recent task time meter result
+        task_mgr.task_time_ctrl.maximum = 0; // Reset max task time gauge
+        task_mgr.task_queue = opmd->queue; // Set task queue
+        task_mgr.task_queue_ubound = (opmd->size - 1);
+        task_mgr.op_mode_switch_over_function = opmd->switch_over_function; // User function executed before switching to this operating mode
+
+        if (opmd->flags & OP_MODE_FLAG_FAULT_OVERRIDE)
+        { task_mgr.status.flags.fault_override = true; } // set global fault override flag bit
+
+        #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+        task_InitMultiRateQueue(); // Load period counters and determine queue frame length
+        #endif
+        
+        #if (USE_TASK_MANAGER_WATCHDOG == 1)
+        task_WatchdogModeSwitch(task_mgr.op_mode.mode); // Update check-ins expected in the recent watchdog window
+        #endif
+        
+        #if (USE_TASK_MANAGER_TIME_BASE == 1)
+        task_TimeBaseRestore(); // Every operation mode starts at the nominal tick period
+        #endif
+        
         if(task_mgr.op_mode_switch_over_function != NULL) // If op-mode switch-over function has been defined, ...
         { task_mgr.op_mode_switch_over_function(); } // Execute user function before switching to this operating mode
         task_mgr.pre_op_mode.mode = task_mgr.op_mode.mode; // Sync OpMode Flags
         task_mgr.status.flags.queue_switch = true; // set queue switch flag for one queue execution loop
+        EVENT_POST(EVT_OP_MODE_SWITCH);
 
     }
     else // if operating mode has not changed, reset task queue change flag bit
@@ -258,22 +466,34 @@ inline volatile uint16_t init_TaskManager(void) {
     task_mgr.op_mode.mode = OP_MODE_BOOT; // Set operation mode to STANDBY
     task_mgr.proc_code.value = 0; // Reset process code
     task_mgr.exec_task_id = TASK_IDLE; // Set task ID to DEFAULT (IDle Task))
+    task_mgr.exec_task_period = 1; // Updated before each task call
     task_mgr.task_queue_tick_index = 0; // Reset task queue pointer
     task_mgr.task_time_ctrl.task_time = 0; // Reset maximum task time meter result
-    task_mgr.task_queue = task_queue_boot; // Set task queue INIT
-    task_mgr.task_queue_ubound = (task_queue_boot_size-1);
+    task_mgr.op_mode_descriptor = &task_op_mode_table[OP_MODE_INDEX_BOOT];
+    task_mgr.task_queue = task_mgr.op_mode_descriptor->queue; // Set task queue INIT
+    task_mgr.task_queue_ubound = (task_mgr.op_mode_descriptor->size - 1);
+    #if (USE_TASK_MANAGER_MULTI_RATE_QUEUES == 1)
+    fres &= task_InitMultiRateQueue();
+    #endif
 
     task_mgr.status.flags.queue_switch = false;
     task_mgr.status.flags.startup_sequence_complete = false;
     task_mgr.status.flags.fault_override = false;
     
+    #if (USE_TASK_MANAGER_EVENT_BUS == 1)
+    fres &= init_EventBus(); // Build subscriber bitmasks before the first event is posted
+    #endif
+    
     // Scheduler Timer Configuration
-    task_mgr.task_timer_index = TASK_MGR_TIMER_INDEX; // Index of the timer peripheral used
-    task_mgr.reg_task_timer_counter = &TASK_MGR_TIMER_COUNTER_REGISTER;
-    task_mgr.reg_task_timer_period = &TASK_MGR_TIMER_PERIOD_REGISTER;
-    task_mgr.task_time_ctrl.quota = *task_mgr.reg_task_timer_period; // Global task execution period 
-    task_mgr.reg_task_timer_irq_flag = &TASK_MGR_TIMER_ISR_FLAG_REGISTER;
-    task_mgr.task_timer_irq_flag_mask = TASK_MGR_TIMER_ISR_FLAG_BIT_MASK;
+    task_mgr.task_time_ctrl.quota = TASK_MGR_TIMER_PERIOD_REGISTER; // Global task execution period 
+    #if (USE_TASK_MANAGER_TIME_BASE == 1)
+    fres &= init_TaskTimeBase(); // Capture nominal tick period
+    #endif
+
+    // Scheduler Tick Counter
+    task_mgr.tick_ctrl.counter = 0;
+    task_mgr.tick_ctrl.executed = 0;
+    task_mgr.tick_ctrl.overrun = 0;
 
     // CPU Load Monitor Configuration
     task_mgr.cpu_load.load = 0;
@@ -281,6 +501,30 @@ inline volatile uint16_t init_TaskManager(void) {
     task_mgr.cpu_load.ticks = 0;
     task_mgr.cpu_load.loop_nomblk = TASK_MGR_CPU_LOAD_NOMBLK;
     task_mgr.cpu_load.load_factor = TASK_MGR_CPU_LOAD_FACTOR;
+    task_mgr.cpu_load.utilization = 0;
+    task_mgr.cpu_load.peak = 0;
+    task_mgr.cpu_load.peak_buffer = 0;
+    task_mgr.cpu_load.peak_window_counter = 0;
+    task_mgr.cpu_load.average = 0;
+    task_mgr.cpu_load.average_filter = 0;
+
+    #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    fres &= task_ResetStatistics();
+    #endif
+
+    #if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+    fres &= init_TaskSlackExecutor();
+    #endif
+
+    fres &= init_TaskResumable(); // Capture slice budget of resumable tasks
+
+    #if (USE_TASK_MANAGER_LOAD_HISTORY == 1)
+    fres &= task_LoadHistoryFlush();
+    #endif
+
+    #if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+    fres &= task_JitterReset();
+    #endif
 
     #if (USE_TASK_EXECUTION_CLOCKOUT_PIN == 1)
         TS_CLOCKOUT_PIN_INIT_OUTPUT;
@@ -0,0 +1,172 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_realtime.c
+ *****************************************************************************
+ * File:   task_realtime.c
+ *
+ * Summary:
+ * Interrupt-level real-time task tier
+ *
+ * Description:	
+ * This file holds the initialization and dispatch routines of the real-time
+ * task tier. The dispatcher is called by the interrupt service routine of the
+ * real-time tier timer and executes all real-time tasks which are due in the
+ * recent tier tick in order of their registration in RT_TASK_REGISTRY. 
+ * After each task the response time since the release of the tier tick is 
+ * captured and compared against the deadline of the task.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_realtime.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_realtime.h"
+#include "apl/config/tasks.h"
+
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+// Real-time tier status
+volatile rt_tier_status_t rt_tier;
+
+// Real-time task status table
+volatile rt_task_status_t rt_task_status[RT_TASK_TABLE_SIZE];
+
+/*!exec_TaskRealTimeTier
+ * ***********************************************************************************************
+ * Return:
+ *      (none)
+ * 
+ * <b>Description:</b>
+ * Real-time tier dispatcher. This function is called by the interrupt service routine of the
+ * real-time tier timer after its interrupt flag bit has been cleared. All tasks which are due 
+ * are executed in order of registration. When the timer interrupt flag bit is set again before
+ * a task has completed, the tier tick has expired and the task has missed its deadline.
+ * ***********************************************************************************************/
+void exec_TaskRealTimeTier(void) {
+    
+    volatile uint16_t i = 0, tstamp = 0;
+    
+    rt_tier.tick_counter++;
+    
+    for (i=0; i<RT_TASK_TABLE_SIZE; i++)
+    {
+        if (rt_task_status[i].countdown == 0)
+        {
+            rt_task_status[i].countdown = (rt_task_table[i].period - 1); // Reload period counter
+            rt_task_status[i].retval = rt_task_table[i].function(); // Execute real-time task
+            rt_task_status[i].calls++;
+
+            // Capture response time since tier tick release
+            if (RT_TIER_TIMER_ISR_FLAG)
+            { tstamp = 0xFFFF; } // tier tick has expired before task completion
+            else
+            { tstamp = RT_TIER_TIMER_COUNTER_REGISTER; }
+            
+            rt_task_status[i].response = tstamp;
+            
+            if (tstamp > rt_task_status[i].maximum)
+            { rt_task_status[i].maximum = tstamp; }
+            
+            if (tstamp > rt_task_status[i].deadline)
+            { 
+                rt_task_status[i].deadline_misses++;
+                rt_tier.deadline_misses++;
+            }
+        }
+        else
+        {
+            rt_task_status[i].countdown--;
+        }
+    }
+    
+    if (RT_TIER_TIMER_ISR_FLAG)
+    { rt_tier.overrun++; } // tier execution time exceeded the tier period
+    
+    return;
+}
+
+/*!init_TaskRealTimeTier
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (invalid period or deadline declared)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Initializes the real-time task status table. Deadlines are converted from [sec] into timer 
+ * ticks based on the recent CPU frequency. This function has to be called before the real-time 
+ * tier timer is started.
+ * ***********************************************************************************************/
+inline volatile uint16_t init_TaskRealTimeTier(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile float ftmp = 0.0;
+    
+    rt_tier.tick_counter = 0;
+    rt_tier.overrun = 0;
+    rt_tier.deadline_misses = 0;
+    
+    for (i=0; i<RT_TASK_TABLE_SIZE; i++)
+    {
+        if (rt_task_table[i].period == 0)
+        {
+            rt_task_status[i].countdown = 0xFFFF; // invalid entries are not called for 6.5k ticks
+            fres = 0;
+        }
+        else
+        { rt_task_status[i].countdown = (rt_task_table[i].phase % rt_task_table[i].period); }
+        
+        ftmp = (rt_task_table[i].deadline * (float)system_frequencies.fcy);
+        if ((ftmp < 1.0) || (ftmp > 65534.0))
+        { 
+            ftmp = 65534.0; // deadline exceeding timer range
+            fres = 0;
+        }
+        rt_task_status[i].deadline = (uint16_t)ftmp;
+        
+        rt_task_status[i].response = 0;
+        rt_task_status[i].maximum = 0;
+        rt_task_status[i].deadline_misses = 0;
+        rt_task_status[i].retval = 0;
+        rt_task_status[i].calls = 0;
+    }
+    
+    return(fres);
+}
+
+#endif  /* USE_TASK_MANAGER_RT_TIER */
+
+// EOF
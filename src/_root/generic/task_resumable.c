@@ -0,0 +1,210 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_resumable.c
+ *****************************************************************************
+ * File:   task_resumable.c
+ *
+ * Summary:
+ * Resumable tasks splitting long jobs across scheduler ticks
+ *
+ * Description:	
+ * This file holds the job control functions of resumable tasks and the job
+ * execution time accounting called by the task manager after each task call.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_resumable.h
+ * task_manager.c
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_resumable.h"
+
+// Slice budget of resumable tasks in timer ticks
+volatile uint16_t task_resumable_slice = 0;
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+// Context of the resumable task executed in the recent task call (NULL = regular task)
+volatile TASK_PT_t* task_pt_active = NULL;
+#endif
+
+/*!init_TaskResumable
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Converts the slice budget TASK_MGR_RESUMABLE_SLICE into timer ticks of the recent CPU clock.
+ * ***********************************************************************************************/
+inline volatile uint16_t init_TaskResumable(void) {
+    
+  #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    task_pt_active = NULL;
+  #endif
+    
+    return(task_ResumableClockChange());
+}
+
+/*!task_ResumableClockChange
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Re-derives the slice budget of resumable tasks in timer ticks from the CPU clock given in 
+ * system_frequencies. This function has to be called whenever the CPU clock has been changed 
+ * (e.g. by the deferred PLL switch-over or by the standby power manager) as the slice budget 
+ * is given in seconds and does not depend on the scheduler tick period.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_ResumableClockChange(void) {
+    
+    task_resumable_slice = TASK_MGR_RESUMABLE_SLICE;
+    
+    return(1);
+}
+
+/*!task_ResumableStart
+ * ***********************************************************************************************
+ * Parameters:
+ *      pt: pointer to the context of the resumable task
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Invalid parameter
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Starts the job of a resumable task from the beginning, regardless of its recent resume point. 
+ * The job is executed when the task is called the next time. The job statistics of previous 
+ * jobs are kept.
+ * ***********************************************************************************************/
+volatile uint16_t task_ResumableStart(volatile TASK_PT_t* pt) {
+    
+    if (pt == NULL)
+    { return(0); }
+    
+    pt->line = TASK_PT_START;
+  #if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+    pt->slices = 0;
+    pt->job_time = 0;
+  #endif
+    
+    return(1);
+}
+
+/*!task_ResumableBusy
+ * ***********************************************************************************************
+ * Parameters:
+ *      pt: pointer to the context of the resumable task
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: The job is complete
+ *      1: The job has been started and is not complete yet
+ * ***********************************************************************************************/
+inline volatile uint16_t task_ResumableBusy(volatile TASK_PT_t* pt) {
+    return((uint16_t)(pt->line != TASK_PT_COMPLETE));
+}
+
+/*!task_ResumableExpired
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Time left in the recent slice
+ *      1: The recent task call has exceeded TASK_MGR_RESUMABLE_SLICE
+ * 
+ * <b>Description:</b>
+ * Compares the time elapsed since the task manager has called the recent task, measured from 
+ * the timer counter captured before the call, against the slice budget of resumable tasks
+ * captured by task_ResumableClockChange().
+ * ***********************************************************************************************/
+inline volatile uint16_t task_ResumableExpired(void) {
+    
+    volatile uint16_t tbuf = TASK_MGR_TIMER_COUNTER_REGISTER;
+    
+    if (tbuf >= task_mgr.task_time_ctrl.buffer)
+    { tbuf = (tbuf - task_mgr.task_time_ctrl.buffer); }
+    else // timer period has expired during the task call
+    { tbuf = (tbuf + TASK_MGR_TIMER_PERIOD_REGISTER + 1 - task_mgr.task_time_ctrl.buffer); }
+    
+    return((uint16_t)(tbuf >= task_resumable_slice));
+}
+
+#if (USE_TASK_MANAGER_TASK_STATISTICS == 1)
+/*!task_ResumableAccount
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t task_time: captured execution time of the recent task call in timer ticks
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Called by the task manager after each task call. If the task executed was a resumable task, 
+ * the execution time of the recent slice is added to its job. When the job has been completed
+ * in this slice, the job time and number of slices are captured as job statistics.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_ResumableAccount(volatile uint16_t task_time) {
+    
+    volatile TASK_PT_t* pt = task_pt_active;
+    
+    if (pt == NULL)
+    { return(1); }
+    
+    task_pt_active = NULL;
+    
+    pt->slices++;
+    pt->job_time += task_time;
+    
+    if (pt->line == TASK_PT_COMPLETE)
+    {
+        pt->jobs++;
+        pt->last_slices = pt->slices;
+        pt->last_time = pt->job_time;
+        if (pt->job_time > pt->max_time)
+        { pt->max_time = pt->job_time; }
+        
+        pt->slices = 0;
+        pt->job_time = 0;
+    }
+    
+    return(1);
+}
+#endif
+
+// EOF
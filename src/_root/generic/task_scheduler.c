@@ -39,6 +39,12 @@ inline volatile uint16_t exec_scheduler(void) {
 
 #if (USE_TASK_MANAGER_TIMING_DEBUG_ARRAYS == 1)
     volatile uint16_t cnt=0;
+#endif
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+    volatile uint16_t ipl_buffer = 0;
+#endif
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_POLLING) && (TASK_MGR_CPU_LOAD_METER_MODE == TASK_MGR_CPU_LOAD_METER_TIMESTAMP)
+    volatile uint16_t free_ticks = 0;
 #endif
     volatile uint16_t fres = 0;
     
@@ -46,32 +52,127 @@ inline volatile uint16_t exec_scheduler(void) {
     // Right after system reset, first check for root-cause of previous device reset
     fres = CheckCPUResetRootCause();
 
+    #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+    // Validate the warm boot snapshot after software and watchdog timer resets
+    fres &= warm_boot_Check();
+    BOOT_PROF_STEP(BOOT_STEP_WARM_BOOT_CHECK);
+    #endif
+
     // Initialize essential chip features and peripheral modules to boot up system
     #if (EXECUTE_MCC_SYSTEM_INITIALIZE == 0)
     fres &= Device_Reset();
+    BOOT_PROF_RESUME(); // Restart boot profiler timer powered off by Device_Reset()
+    BOOT_PROF_STEP(BOOT_STEP_DEVICE_RESET);
     #endif
 
     // The User Startup Code might be required in some designs to enable 
     #if (EXECUTE_USER_STARTUP_CODE == 1)
     fres &= ExecuteUserStartupCode();
+    BOOT_PROF_STEP(BOOT_STEP_USER_STARTUP);
     #endif
     
     // Initialize essential chip features and peripheral modules to boot up system
     #if (EXECUTE_MCC_SYSTEM_INITIALIZE == 0)
     fres &= CLOCK_Initialize();
+    BOOT_PROF_STEP(BOOT_STEP_CLOCK_INIT);
+    #endif
+
+    #if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+    // Paint the unused stack area before interrupts are enabled
+    fres &= task_StackPaint();
     #endif
 
     // Initialize software layers (scheduler and essential user tasks)
     fres &= OS_Initialize();
+    BOOT_PROF_STEP(BOOT_STEP_OS_INIT);
 
     // after the basic steps, the rest of the configuration runs as part of the scheduler,
     // where execution can be monitored and faults can be properly handled.
     while (run_scheduler) 
     {
       
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+
+        // Capture free CPU time until the end of the recent time slot
+        if (task_mgr.tick_ctrl.counter == task_mgr.tick_ctrl.executed)
+        { task_mgr.cpu_load.ticks = (TASK_MGR_TIMER_PERIOD_REGISTER - TASK_MGR_TIMER_COUNTER_REGISTER); }
+        else
+        { task_mgr.cpu_load.ticks = 0; } // time slot has already expired
+        
+        task_mgr.cpu_load.load  = (uint16_t)((task_mgr.cpu_load.ticks * task_mgr.cpu_load.load_factor)>>16);
+        task_mgr.cpu_load.load_max_buffer |= task_mgr.cpu_load.load;
+        task_mgr.cpu_load.ticks = 0; // Reset CPU tick counter
+        fres &= task_UpdateCPULoad();
+        
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+        // Check a few words of the stack area for the high-water mark
+        fres &= exec_StackMonitor();
+#endif
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+        // Add a few words to the flash CRC and test one RAM block
+        fres &= exec_SelfTest();
+#endif
+
+#if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+        // Execute deferrable jobs in the remaining time of the recent time slot
+        fres &= exec_SlackJobs();
+#endif
+        
+        // Put CPU into IDLE mode until the timer interrupt releases the next time slot
+        while (task_mgr.tick_ctrl.counter == task_mgr.tick_ctrl.executed)
+        {
+            SET_AND_SAVE_CPU_IPL(ipl_buffer, TASK_MGR_ISR_PRIORITY); // Hold off timer interrupt
+            if (task_mgr.tick_ctrl.counter == task_mgr.tick_ctrl.executed)
+            { PWRSAV_IDLE; } // Pending timer interrupt wakes up CPU even if it is held off
+            RESTORE_CPU_IPL(ipl_buffer); // Release pending timer interrupt
+        }
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterSlotStart(); // Capture slot-start latency
+#endif
+
+#if (USE_TASK_EXECUTION_CLOCKOUT_PIN == 1)
+#ifdef TS_CLOCKOUT_PIN_WR
+    TS_CLOCKOUT_PIN_WR = PINSTATE_HIGH;                  // Drive debug pin high
+#endif
+#endif
+
+        // Track number of time slots lost since the last execution
+        task_mgr.tick_ctrl.overrun += (task_mgr.tick_ctrl.counter - task_mgr.tick_ctrl.executed - 1);
+        task_mgr.tick_ctrl.executed = task_mgr.tick_ctrl.counter;
+        
+#else
+        
+#if (TASK_MGR_CPU_LOAD_METER_MODE == TASK_MGR_CPU_LOAD_METER_TIMESTAMP)
+        // Capture free CPU time until the end of the recent time slot
+        if (!(TASK_MGR_TIMER_ISR_FLAG_REGISTER & TASK_MGR_TIMER_ISR_FLAG_BIT_MASK))
+        { free_ticks = (TASK_MGR_TIMER_PERIOD_REGISTER - TASK_MGR_TIMER_COUNTER_REGISTER); }
+        else
+        { free_ticks = 0; } // time slot has already expired
+#endif
+
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+        // Check a few words of the stack area for the high-water mark
+        fres &= exec_StackMonitor();
+#endif
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+        // Add a few words to the flash CRC and test one RAM block
+        fres &= exec_SelfTest();
+#endif
+
+#if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+        // Execute deferrable jobs in the remaining time of the recent time slot
+        fres &= exec_SlackJobs();
+#if (TASK_MGR_CPU_LOAD_METER_MODE == TASK_MGR_CPU_LOAD_METER_LOOP_COUNT)
+        task_mgr.cpu_load.ticks = (task_slack.consumed / task_mgr.cpu_load.loop_nomblk); // Account slack job time as free CPU time
+#endif
+#endif
+
         // Wait for timer to expire before calling the next task
         while (
-           !(*task_mgr.reg_task_timer_irq_flag & task_mgr.task_timer_irq_flag_mask)
+           !(TASK_MGR_TIMER_ISR_FLAG_REGISTER & TASK_MGR_TIMER_ISR_FLAG_BIT_MASK)
             && (task_mgr.cpu_load.ticks != task_mgr.task_time_ctrl.quota)
             )
         {
@@ -79,6 +180,10 @@ inline volatile uint16_t exec_scheduler(void) {
             task_mgr.cpu_load.ticks++;
         }
 
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterSlotStart(); // Capture slot-start latency
+#endif
+
 #if (USE_TASK_EXECUTION_CLOCKOUT_PIN == 1)
 #ifdef TS_CLOCKOUT_PIN_WR
     TS_CLOCKOUT_PIN_WR = PINSTATE_HIGH;                  // Drive debug pin high
@@ -97,15 +202,30 @@ inline volatile uint16_t exec_scheduler(void) {
         }
         else    // Task scheduling is running as expected => Continue with next task
         {   
+#if (TASK_MGR_CPU_LOAD_METER_MODE == TASK_MGR_CPU_LOAD_METER_TIMESTAMP)
+            task_mgr.cpu_load.ticks = free_ticks;   // Use free CPU time captured from the system timer
+#else
             task_mgr.cpu_load.ticks *= task_mgr.cpu_load.loop_nomblk;    // Calculate the accumulated CPU cycles
+#endif
             task_mgr.cpu_load.load  = (uint16_t)((task_mgr.cpu_load.ticks * task_mgr.cpu_load.load_factor)>>16);
             task_mgr.cpu_load.load_max_buffer |= task_mgr.cpu_load.load;
             task_mgr.cpu_load.ticks = 0; // Reset CPU tick counter
+            fres &= task_UpdateCPULoad();
 
         }
 
-        *task_mgr.reg_task_timer_irq_flag ^= task_mgr.task_timer_irq_flag_mask; // Reset timer ISR flag bit
+        TASK_MGR_TIMER_ISR_FLAG_REGISTER ^= TASK_MGR_TIMER_ISR_FLAG_BIT_MASK; // Reset timer ISR flag bit
+
+        // Increment scheduler tick counter
+        task_mgr.tick_ctrl.counter++;
+        task_mgr.tick_ctrl.executed = task_mgr.tick_ctrl.counter;
 
+#endif
+
+#if (USE_TASK_MANAGER_TIME_BASE == 1)
+        // Apply pending tick period change at the beginning of the time slot
+        fres &= task_TimeBaseUpdate();
+#endif
         
 #if ((USE_TASK_EXECUTION_CLOCKOUT_PIN == 1) && (USE_DETAILED_CLOCKOUT_PATTERN == 1))
 #ifdef TS_CLOCKOUT_PIN_WR
@@ -116,6 +236,10 @@ inline volatile uint16_t exec_scheduler(void) {
         // Call most recent task with execution time measurement
         fres = task_manager_tick();     // Step through pre-defined task lists
 
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterPhaseEnd(SLOT_PHASE_TASK);
+#endif
+
 
 #if ((USE_TASK_EXECUTION_CLOCKOUT_PIN == 1) && (USE_DETAILED_CLOCKOUT_PATTERN == 1))
 #ifdef TS_CLOCKOUT_PIN_WR
@@ -126,6 +250,10 @@ inline volatile uint16_t exec_scheduler(void) {
         // Capture the most recent system status to respond to changes in operating modes
         fres &= exec_CaptureSystemStatus();
 
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterPhaseEnd(SLOT_PHASE_STATUS);
+#endif
+
 #if ((USE_TASK_EXECUTION_CLOCKOUT_PIN == 1) && (USE_DETAILED_CLOCKOUT_PATTERN == 1))
 #ifdef TS_CLOCKOUT_PIN_WR
     TS_CLOCKOUT_PIN_WR = PINSTATE_LOW;                 // Drive debug pin low
@@ -135,6 +263,10 @@ inline volatile uint16_t exec_scheduler(void) {
         
         // call the fault handler to check all defined fault objects
         fres &= exec_FaultCheckAll();
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterPhaseEnd(SLOT_PHASE_FAULT);
+#endif
         
 #if ((USE_TASK_EXECUTION_CLOCKOUT_PIN == 1) && (USE_DETAILED_CLOCKOUT_PATTERN == 1))
 #ifdef TS_CLOCKOUT_PIN_WR
@@ -142,13 +274,16 @@ inline volatile uint16_t exec_scheduler(void) {
 #endif
 #endif
 
-        // Reset Watchdog Timer
-        // ToDo: Move swdt_reset(); out to taks queues
-        // ToDo: Add windowed WDT option to library
-        //Remove: fres &= swdt_reset();
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+        // Service windowed watchdog timer when all expected task check-ins have arrived
+        fres &= exec_TaskWatchdog();
+#endif
         
-        // Increment task table pointer
-        task_mgr.task_queue_tick_index++;
+        // Increment task table pointer unless the recent task holds the task queue at its position
+        if (task_mgr.status.flags.queue_hold)
+        { task_mgr.status.flags.queue_hold = false; }
+        else
+        { task_mgr.task_queue_tick_index++; }
 
         // if the list index is at/beyond the recent list boundary, roll-over and/or switch task list
         if ( (task_mgr.task_queue_tick_index > (task_mgr.task_queue_ubound)) ||
@@ -162,6 +297,10 @@ inline volatile uint16_t exec_scheduler(void) {
             task_mgr.task_queue_tick_index = 0; // If end of list has been reached, jump back to first item
         }
 
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+        fres &= task_JitterPhaseEnd(SLOT_PHASE_MODE);
+#endif
+
         
 #if (USE_TASK_EXECUTION_CLOCKOUT_PIN == 1)
 #ifdef TS_CLOCKOUT_PIN_WR
@@ -171,6 +310,11 @@ inline volatile uint16_t exec_scheduler(void) {
 
         
         
+#if (USE_TASK_MANAGER_LOAD_HISTORY == 1)
+        // Log execution profile of the recent scheduler tick
+        fres &= task_LoadHistoryWrite();
+#endif
+        
 #if (USE_TASK_MANAGER_TIMING_DEBUG_ARRAYS == 1)
 // In debugging mode CPU load and task time is measured and logged in two arrays
 // to examine the recent code execution profile
@@ -0,0 +1,440 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_selftest.c
+ *****************************************************************************
+ * File:   task_selftest.c
+ *
+ * Summary:
+ * Run-time flash CRC and RAM March test
+ *
+ * Description:	
+ * The scheduler calls exec_SelfTest() in the remaining time of each time 
+ * slot. Once the startup sequence has been completed, each call adds up to 
+ * TASK_MGR_SELF_TEST_FLASH_WORDS instruction words to the flash CRC and tests 
+ * one data memory block of TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS words by a 
+ * March C- sequence. No test is executed during boot. 
+ * 
+ * The flash CRC skips program memory regions registered in the flash 
+ * exclusion registry. When a pass is complete, its signature is compared to 
+ * the reference signature. The RAM March test saves the block contents in 
+ * local variables on the stack, which is not covered by the test, and holds 
+ * off all interrupts until the block has been restored. Blocks overlapping 
+ * buffers registered in the RAM exclusion registry are skipped. The data 
+ * background alternates between all-zero and checkerboard with every pass.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_selftest.h
+ * task_manager_config.h
+ * apl/config/selftest.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "_root/generic/task_selftest.h"
+#include "apl/config/selftest.h"
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+
+// Linker symbols of the memory ranges (__DATA_BASE, __SP_init, __CODE_BASE and __CODE_LENGTH)
+extern volatile uint16_t _DATA_BASE;
+extern volatile uint16_t _SP_init;
+extern const uint16_t __attribute__((space(prog))) _CODE_BASE;
+extern const uint16_t __attribute__((space(prog))) _CODE_LENGTH;
+
+// Value of a linker symbol located in program memory space
+#define SELF_TEST_LINKER_ADDRESS(symbol)    ((((uint32_t)__builtin_tblpage(symbol)) << 16) | (uint32_t)__builtin_tbloffset(symbol))
+
+#define SELF_TEST_CRC_SEED              0xFFFF  // Initial value of the CRC-16 signature
+#define SELF_TEST_CRC_POLYNOMIAL        0x1021  // CRC-16 CCITT polynomial x^16 + x^12 + x^5 + 1
+#define SELF_TEST_RAM_BACKGROUND        0x0000  // Data background of even RAM March test passes
+#define SELF_TEST_RAM_CHECKERBOARD      0x5555  // Data background of odd RAM March test passes
+
+#if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+#define SELF_TEST_CRCCONL_ENABLE        0x8000  // CRCCONL: CRCEN = 1 (CRC module enabled, FIFO and shifter reset when cleared)
+#define SELF_TEST_CRCCONH_INIT          0x0F0F  // CRCCONH: DWIDTH = 16-bit data, PLEN = 16-bit polynomial
+#define SELF_TEST_CRC_FIFO_DEPTH        8       // FIFO depth of the CRC module with 16-bit data width
+#endif
+
+// Volatile self-test status
+volatile task_selftest_status_t task_selftest;
+
+#if (TASK_MGR_SELF_TEST_FLASH == 1) && (TASK_MGR_SELF_TEST_HW_CRC == 0)
+// CRC-16 CCITT look-up table of one nibble per step
+const uint16_t selftest_crc_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+#endif
+
+/* private function prototypes */
+#if (TASK_MGR_SELF_TEST_FLASH == 1)
+inline volatile uint16_t selftest_FlashStart(void);
+inline volatile uint16_t selftest_FlashFeed(void);
+inline volatile uint16_t selftest_FlashComplete(void);
+#if (TASK_MGR_SELF_TEST_HW_CRC == 0)
+inline uint16_t selftest_Crc16Word(uint16_t crc, uint16_t data);
+#endif
+#endif
+inline volatile uint16_t selftest_RamStep(void);
+inline uint16_t selftest_RamMarch(volatile uint16_t* block, uint16_t size, uint16_t background);
+
+/*!exec_SelfTest
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Executes one step of the flash CRC and one block of the RAM March test. Both tests are halted 
+ * until the startup sequence has been completed. Test failures are not reported by the return 
+ * value but latched in task_selftest.failures.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_SelfTest(void) {
+
+    volatile uint16_t fres = 1;
+    
+    if (!task_mgr.status.flags.startup_sequence_complete)
+    { return(1); } // no test during boot and startup
+    
+  #if (TASK_MGR_SELF_TEST_FLASH == 1)
+    
+    #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+    if (PMD3bits.CRCMD == 0) // CRC module is gated in standby (pass is restarted when released)
+    #endif
+    {
+        if (task_selftest.flash_state == SELF_TEST_FLASH_FEED)
+        { fres &= selftest_FlashFeed(); }
+        #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+        else if (task_selftest.flash_state == SELF_TEST_FLASH_DRAIN)
+        {
+            // The last word is shifted within a few cycles after the FIFO has run empty
+            if (CRCCONLbits.CRCMPT)
+            { task_selftest.flash_state = SELF_TEST_FLASH_COMPLETE; }
+        }
+        #endif
+        else if (task_selftest.flash_state == SELF_TEST_FLASH_COMPLETE)
+        { fres &= selftest_FlashComplete(); }
+        else
+        { fres &= selftest_FlashStart(); }
+    }
+    
+  #endif
+
+    fres &= selftest_RamStep();
+    
+    return(fres);
+}
+
+#if (TASK_MGR_SELF_TEST_FLASH == 1)
+
+#if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+/*!task_SelfTestCrcRestart
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Discards the recent flash CRC pass. The CRC module loses its configuration and contents while 
+ * it is gated in standby. This function is called when the module is released (see 
+ * STANDBY_PMD_REGISTRY) and the next pass is started in the following time slot.
+ * ***********************************************************************************************/
+volatile uint16_t task_SelfTestCrcRestart(void) {
+
+    task_selftest.flash_state = SELF_TEST_FLASH_START;
+    
+    return(1);
+}
+#endif
+
+/*!selftest_FlashStart
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Starts a new pass of the flash CRC at the start of the program memory range. When the CRC 
+ * module is used, it is reset and configured for a CRC-16 of 16-bit data words.
+ * ***********************************************************************************************/
+inline volatile uint16_t selftest_FlashStart(void) {
+
+    task_selftest.flash_address = TASK_MGR_SELF_TEST_FLASH_START;
+    task_selftest.flash_end = TASK_MGR_SELF_TEST_FLASH_END;
+    task_selftest.flash_crc = SELF_TEST_CRC_SEED;
+    
+  #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+    CRCCONL = 0; // disable module and reset FIFO and shifter
+    CRCCONH = SELF_TEST_CRCCONH_INIT;
+    CRCXORL = SELF_TEST_CRC_POLYNOMIAL;
+    CRCXORH = 0;
+    CRCWDATL = SELF_TEST_CRC_SEED;
+    CRCWDATH = 0;
+    CRCCONL = SELF_TEST_CRCCONL_ENABLE;
+    CRCCONLbits.CRCGO = 1; // shift data words as soon as they are written to the FIFO
+  #endif
+    
+    task_selftest.flash_state = SELF_TEST_FLASH_FEED;
+    
+    return(1);
+}
+
+/*!selftest_FlashFeed
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Adds up to TASK_MGR_SELF_TEST_FLASH_WORDS instruction words to the CRC of the recent pass. 
+ * Words within regions of the flash exclusion registry are skipped. When the CRC module is used,
+ * feeding is paused until the next time slot when the FIFO cannot take another instruction word.
+ * ***********************************************************************************************/
+inline volatile uint16_t selftest_FlashFeed(void) {
+
+    uint16_t words = TASK_MGR_SELF_TEST_FLASH_WORDS;
+    uint16_t tblpag_buffer = 0;
+    uint16_t data_low = 0, data_high = 0;
+    uint32_t address = task_selftest.flash_address;
+    
+    // Skips the remainder of a registered region
+    #define SELF_TEST_FLASH_SKIP(start, length) \
+        if ((address >= (uint32_t)(start)) && (address < ((uint32_t)(start) + (uint32_t)(length)))) \
+        { address = ((uint32_t)(start) + (uint32_t)(length)); continue; }
+    
+    while (words--)
+    {
+        if (address >= task_selftest.flash_end)
+        { 
+          #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+            task_selftest.flash_state = SELF_TEST_FLASH_DRAIN;
+          #else
+            task_selftest.flash_state = SELF_TEST_FLASH_COMPLETE;
+          #endif
+            break;
+        }
+        
+        SELF_TEST_FLASH_EXCLUDE_REGISTRY(SELF_TEST_FLASH_SKIP)
+        
+      #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+        if (CRCCONLbits.VWORD > (SELF_TEST_CRC_FIFO_DEPTH - 2))
+        { break; } // FIFO cannot take both words of the instruction word
+      #endif
+        
+        tblpag_buffer = TBLPAG;
+        TBLPAG = (uint16_t)(address >> 16);
+        data_low = __builtin_tblrdl((uint16_t)(address & 0x0000FFFF));
+        data_high = __builtin_tblrdh((uint16_t)(address & 0x0000FFFF));
+        TBLPAG = tblpag_buffer;
+        
+      #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+        CRCDATL = data_low;
+        CRCDATL = data_high;
+      #else
+        task_selftest.flash_crc = selftest_Crc16Word(
+                selftest_Crc16Word(task_selftest.flash_crc, data_low), data_high);
+      #endif
+        
+        address += 2; // next instruction word
+    }
+    
+    task_selftest.flash_address = address;
+    
+    return(1);
+}
+
+/*!selftest_FlashComplete
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Publishes the signature of the completed pass and compares it to the reference signature. 
+ * Unless the expected signature is declared by TASK_MGR_SELF_TEST_FLASH_CRC, the reference is 
+ * captured by the first pass after reset. A deviation latches SELF_TEST_FAILURE_FLASH.
+ * ***********************************************************************************************/
+inline volatile uint16_t selftest_FlashComplete(void) {
+
+  #if (TASK_MGR_SELF_TEST_HW_CRC == 1)
+    task_selftest.flash_signature = CRCWDATL;
+    CRCCONL = 0; // disable module until the next pass
+  #else
+    task_selftest.flash_signature = task_selftest.flash_crc;
+  #endif
+    
+  #if defined (TASK_MGR_SELF_TEST_FLASH_CRC)
+    task_selftest.flash_reference = TASK_MGR_SELF_TEST_FLASH_CRC;
+  #else
+    if (task_selftest.flash_passes == 0)
+    { task_selftest.flash_reference = task_selftest.flash_signature; } // first pass captures the reference
+  #endif
+    
+    if (task_selftest.flash_signature != task_selftest.flash_reference)
+    { task_selftest.failures |= SELF_TEST_FAILURE_FLASH; }
+    
+    if (task_selftest.flash_passes < 0xFFFF)
+    { task_selftest.flash_passes++; }
+    
+    task_selftest.flash_state = SELF_TEST_FLASH_START;
+    
+    return(1);
+}
+
+#if (TASK_MGR_SELF_TEST_HW_CRC == 0)
+/*!selftest_Crc16Word
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      CRC-16 including the given data word
+ * 
+ * <b>Description:</b>
+ * Adds one 16-bit data word to the CRC-16 (MSB first, one nibble per step).
+ * ***********************************************************************************************/
+inline uint16_t selftest_Crc16Word(uint16_t crc, uint16_t data) {
+
+    uint16_t i = 0;
+    
+    crc ^= data;
+    for (i = 0; i < 4; i++)
+    { crc = (uint16_t)((crc << 4) ^ selftest_crc_table[(crc >> 12) & 0x000F]); }
+    
+    return(crc);
+}
+#endif
+
+#endif  /* TASK_MGR_SELF_TEST_FLASH */
+
+/*!selftest_RamStep
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Tests the next data memory block of the RAM March test range. Blocks overlapping a buffer of 
+ * the RAM exclusion registry are skipped. When the end of the range has been reached, the next 
+ * pass is started at the start of the range with the alternate data background. A failing block
+ * latches SELF_TEST_FAILURE_RAM and the address of the first failing block.
+ * ***********************************************************************************************/
+inline volatile uint16_t selftest_RamStep(void) {
+
+    volatile uint16_t* block = task_selftest.ram_block;
+    volatile uint16_t* start = TASK_MGR_SELF_TEST_RAM_START;
+    volatile uint16_t* end = TASK_MGR_SELF_TEST_RAM_END;
+    uint16_t size = TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS;
+    uint16_t background = 0;
+    
+    if (block == NULL)
+    { block = start; } // first pass after reset
+    else if (block >= end)
+    { 
+        block = start; // start next pass
+        task_selftest.ram_passes++;
+    }
+    
+    if ((uint16_t)(end - block) < size)
+    { size = (uint16_t)(end - block); } // last block of the range
+    
+    task_selftest.ram_block = (block + size);
+    
+    // Skips blocks overlapping a registered buffer
+    #define SELF_TEST_RAM_SKIP(buffer) \
+        if (((volatile uint8_t*)block < ((volatile uint8_t*)&(buffer) + sizeof(buffer))) && \
+            ((volatile uint8_t*)(block + size) > (volatile uint8_t*)&(buffer))) \
+        { return(1); }
+    
+    SELF_TEST_RAM_EXCLUDE_REGISTRY(SELF_TEST_RAM_SKIP)
+    
+    if (task_selftest.ram_passes & 0x0001)
+    { background = SELF_TEST_RAM_CHECKERBOARD; }
+    else
+    { background = SELF_TEST_RAM_BACKGROUND; }
+    
+    if (!selftest_RamMarch(block, size, background))
+    {
+        if (task_selftest.ram_failure == NULL)
+        { task_selftest.ram_failure = block; }
+        task_selftest.failures |= SELF_TEST_FAILURE_RAM;
+    }
+    
+    return(1);
+}
+
+/*!selftest_RamMarch
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (at least one word did not read back as written)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Saves the given data memory block, tests it by the March C- sequence 
+ * 
+ *   up(w0); up(r0,w1); up(r1,w0); down(r0,w1); down(r1,w0); down(r0)
+ * 
+ * with 0 = data background and 1 = inverted data background, and restores the block while it 
+ * reads the final element. All interrupts are held off while the block is tested. 
+ * ***********************************************************************************************/
+inline uint16_t selftest_RamMarch(volatile uint16_t* block, uint16_t size, uint16_t background) {
+
+    uint16_t buffer[TASK_MGR_SELF_TEST_RAM_BLOCK_WORDS];
+    uint16_t inverse = (uint16_t)(~background);
+    uint16_t deviation = 0;
+    uint16_t ipl_buffer = 0;
+    uint16_t i = 0;
+    
+    SET_AND_SAVE_CPU_IPL(ipl_buffer, 7); // Hold off all interrupts while the block is tested
+    
+    for (i = 0; i < size; i++)
+    { buffer[i] = block[i]; block[i] = background; } // save, up(w0)
+    for (i = 0; i < size; i++)
+    { deviation |= (block[i] ^ background); block[i] = inverse; } // up(r0,w1)
+    for (i = 0; i < size; i++)
+    { deviation |= (block[i] ^ inverse); block[i] = background; } // up(r1,w0)
+    for (i = size; i > 0; i--)
+    { deviation |= (block[i - 1] ^ background); block[i - 1] = inverse; } // down(r0,w1)
+    for (i = size; i > 0; i--)
+    { deviation |= (block[i - 1] ^ inverse); block[i - 1] = background; } // down(r1,w0)
+    for (i = size; i > 0; i--)
+    { deviation |= (block[i - 1] ^ background); block[i - 1] = buffer[i - 1]; } // down(r0), restore
+    
+    RESTORE_CPU_IPL(ipl_buffer);
+    
+    return(deviation == 0);
+}
+
+#endif  /* USE_TASK_MANAGER_SELF_TEST */
+
+// EOF
@@ -0,0 +1,194 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_slack.c
+ *****************************************************************************
+ * File:   task_slack.c
+ *
+ * Summary:
+ * Background slack executor for deferrable jobs
+ *
+ * Description:	
+ * This file holds the slack job queue and its executor. Jobs are posted by 
+ * tasks of the cooperative task queues and are executed by the main loop in
+ * the time left until the next scheduler tick. Each job is called repeatedly
+ * with a pointer to its parameter until it returns SLACK_JOB_COMPLETE. A job
+ * chunk is only started if the remaining time until the next tick exceeds the 
+ * declared worst-case chunk execution time plus the guard time. Hence, slack
+ * jobs never delay the execution of the next task queue time slot.
+ * 
+ * Please note:
+ * Jobs have to be posted from the main loop (task level) only. The queue is not
+ * protected against concurrent access from interrupt service routines.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_slack.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_slack.h"
+
+#if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+
+#define SLACK_QUEUE_INDEX_MASK  (TASK_MGR_SLACK_QUEUE_SIZE - 1)
+
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+  #define SLACK_TICK_PENDING    (task_mgr.tick_ctrl.counter != task_mgr.tick_ctrl.executed)
+#else
+  #define SLACK_TICK_PENDING    (TASK_MGR_TIMER_ISR_FLAG_REGISTER & TASK_MGR_TIMER_ISR_FLAG_BIT_MASK)
+#endif
+
+// Slack job ring buffer
+volatile slack_job_t slack_queue[TASK_MGR_SLACK_QUEUE_SIZE];
+
+// Slack executor status
+volatile task_slack_status_t task_slack;
+
+/*!task_PostSlackJob
+ * ***********************************************************************************************
+ * Parameters:
+ *      function: job chunk function to be called
+ *      param:    initial value of the job parameter passed to the job function
+ *      wcet:     worst-case execution time of one job chunk in system timer ticks
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (queue full or job chunk would never fit into a time slot)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Adds a deferrable job to the slack job queue. 
+ * ***********************************************************************************************/
+inline volatile uint16_t task_PostSlackJob(volatile uint16_t (*function)(volatile uint16_t* param), 
+                    volatile uint16_t param, volatile uint16_t wcet) {
+    
+    volatile uint16_t index = 0;
+    
+    if ( (function == NULL) ||
+         ((uint16_t)(task_slack.head - task_slack.tail) >= TASK_MGR_SLACK_QUEUE_SIZE) ||
+         ((uint32_t)wcet + (uint32_t)task_slack.guard >= (uint32_t)TASK_MGR_TIMER_PERIOD_REGISTER) )
+    {
+        task_slack.dropped++;
+        return(0);
+    }
+
+    index = (task_slack.head & SLACK_QUEUE_INDEX_MASK);
+    slack_queue[index].function = function;
+    slack_queue[index].param = param;
+    slack_queue[index].wcet = wcet;
+    task_slack.head++; // Publish job after its descriptor has been written
+    
+    return(1);
+}
+
+/*!exec_SlackJobs
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Executes chunks of pending slack jobs in order of posting as long as the remaining time until 
+ * the next scheduler tick exceeds the worst-case chunk execution time plus the guard time. 
+ * The number of system timer ticks consumed is stored in task_slack.consumed.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_SlackJobs(void) {
+
+    volatile uint16_t index = 0;
+    volatile uint16_t t_start = 0, t_stop = 0, remaining = 0;
+    
+    task_slack.consumed = 0;
+    
+    if (task_slack.head == task_slack.tail)
+    { return(1); } // no job pending
+    
+    t_start = TASK_MGR_TIMER_COUNTER_REGISTER;
+    
+    while (task_slack.head != task_slack.tail)
+    {
+        if (SLACK_TICK_PENDING)
+        { break; } // time slot has already expired
+        
+        index = (task_slack.tail & SLACK_QUEUE_INDEX_MASK);
+        remaining = (TASK_MGR_TIMER_PERIOD_REGISTER - TASK_MGR_TIMER_COUNTER_REGISTER);
+        
+        if (remaining <= (slack_queue[index].wcet + task_slack.guard))
+        { break; } // not enough time left for the next chunk
+        
+        task_slack.chunks++;
+        if (slack_queue[index].function(&slack_queue[index].param) == SLACK_JOB_COMPLETE) 
+        {
+            task_slack.tail++;  // Remove completed job from queue
+            task_slack.completed++;
+        }
+    }
+    
+    t_stop = TASK_MGR_TIMER_COUNTER_REGISTER;
+    
+    if (t_stop < t_start) // timer has rolled over
+    { task_slack.consumed = (TASK_MGR_TIMER_PERIOD_REGISTER + 1 - t_start + t_stop); }
+    else
+    { task_slack.consumed = (t_stop - t_start); }
+    
+    return(1);
+}
+
+/*!init_TaskSlackExecutor
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Clears the slack job queue and the slack executor status.
+ * ***********************************************************************************************/
+inline volatile uint16_t init_TaskSlackExecutor(void) {
+
+    task_slack.head = 0;
+    task_slack.tail = 0;
+    task_slack.guard = TASK_MGR_SLACK_GUARD;
+    task_slack.consumed = 0;
+    task_slack.dropped = 0;
+    task_slack.chunks = 0;
+    task_slack.completed = 0;
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_SLACK_EXECUTOR */
+
+// EOF
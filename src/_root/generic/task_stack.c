@@ -0,0 +1,168 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_stack.c
+ *****************************************************************************
+ * File:   task_stack.c
+ *
+ * Summary:
+ * Stack usage high-water mark monitor
+ *
+ * Description:	
+ * The scheduler calls task_StackPaint() before the operating system is 
+ * initialized and exec_StackMonitor() in the remaining time of each time 
+ * slot. Each call checks up to TASK_MGR_STACK_SCAN_WORDS stack words, 
+ * walking down from the stack limit towards the recent high-water mark. 
+ * The first overwritten word found becomes the new high-water mark and a 
+ * new pass is started at the stack limit.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_stack.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_stack.h"
+
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+
+// Initial stack pointer address provided by the linker (__SP_init)
+extern volatile uint16_t _SP_init;
+
+// Stack usage high-water mark monitor status
+volatile task_stack_status_t task_stack;
+
+/* private function prototypes */
+inline volatile uint16_t task_StackUpdateUsage(void);
+
+/*!task_StackPaint
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (stack pointer outside of the stack area)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Fills the unused stack area from the recent stack pointer plus TASK_MGR_STACK_PAINT_MARGIN 
+ * words up to the stack limit with the fill pattern and resets the high-water mark to the 
+ * recent stack pointer. This function has to be called while interrupts are disabled, before 
+ * the scheduler is started.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_StackPaint(void) {
+
+    volatile uint16_t* ptr;
+    
+    task_stack.base = TASK_MGR_STACK_BASE;
+    task_stack.limit = TASK_MGR_STACK_LIMIT;
+    task_stack.hwm = TASK_MGR_STACK_POINTER;
+    task_stack.scan = task_stack.limit;
+    task_stack.size = (uint16_t)(task_stack.limit - task_stack.base + 1);
+    task_stack.passes = 0;
+
+    if ((task_stack.hwm < task_stack.base) || (task_stack.hwm > task_stack.limit))
+    { 
+        task_stack.scan = NULL; // stack area unknown => disable scan and report full stack
+        task_stack.usage = 100;
+        return(0); 
+    }
+    
+    for (ptr = (task_stack.hwm + TASK_MGR_STACK_PAINT_MARGIN); ptr <= task_stack.limit; ptr++)
+    { *ptr = TASK_MGR_STACK_PAINT_PATTERN; }
+
+    return(task_StackUpdateUsage());
+}
+
+/*!exec_StackMonitor
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Checks up to TASK_MGR_STACK_SCAN_WORDS stack words of the recent pass for the fill pattern. 
+ * When an overwritten word is found or the recent high-water mark is reached, the pass is 
+ * completed, the stack usage is updated and the next pass starts at the stack limit.
+ * ***********************************************************************************************/
+inline volatile uint16_t exec_StackMonitor(void) {
+
+    volatile uint16_t words = TASK_MGR_STACK_SCAN_WORDS;
+    
+    if (task_stack.scan == NULL)
+    { return(1); } // stack has not been painted
+    
+    while (words--)
+    {
+        if (task_stack.scan <= task_stack.hwm)
+        { break; } // pass reached the previous high-water mark
+        
+        if (*task_stack.scan != TASK_MGR_STACK_PAINT_PATTERN)
+        { 
+            task_stack.hwm = task_stack.scan; // highest overwritten word = new high-water mark
+            break; 
+        }
+        
+        task_stack.scan--;
+    }
+    
+    if (task_stack.scan <= task_stack.hwm)
+    {
+        task_stack.scan = task_stack.limit; // start next pass at the stack limit
+        task_stack.passes++;
+        return(task_StackUpdateUsage());
+    }
+    
+    return(1);
+}
+
+/*!task_StackUpdateUsage
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Derives used words, headroom and stack usage in percent from the recent high-water mark.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_StackUpdateUsage(void) {
+
+    task_stack.used = (uint16_t)(task_stack.hwm - task_stack.base + 1);
+    task_stack.headroom = (task_stack.size - task_stack.used);
+    task_stack.usage = (uint16_t)(((uint32_t)task_stack.used * 100) / task_stack.size);
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_STACK_MONITOR */
+
+// EOF
@@ -0,0 +1,256 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_timebase.c
+ *****************************************************************************
+ * File:   task_timebase.c
+ *
+ * Summary:
+ * Runtime configurable scheduler tick period
+ *
+ * Description:	
+ * A new tick period requested by task_TimeBaseSet() is applied by the 
+ * scheduler at the beginning of the next time slot. The task time quota, the 
+ * CPU load factor, the tick scaling factor used by TASK_MGR_TICKS() and all
+ * values registered in TIME_BASE_REGISTRY are re-derived at this point.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_timebase.h
+ * task_manager_config.h
+ * timebase.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "apl/config/timebase.h"
+
+#if (USE_TASK_MANAGER_TIME_BASE == 1)
+
+// Scheduler tick period settings
+volatile task_time_base_t task_time_base;
+
+/* private function prototypes */
+inline volatile uint16_t task_TimeBaseScaleValue(volatile uint16_t value, volatile uint16_t previous, volatile uint16_t* fres);
+
+/*!init_TaskTimeBase
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Captures the timer period of the nominal tick period. This function is called by 
+ * init_TaskManager() after the scheduler timer has been configured.
+ * ***********************************************************************************************/
+inline volatile uint16_t init_TaskTimeBase(void) {
+    
+    task_time_base.nominal = TASK_MGR_TIMER_PERIOD_REGISTER;
+    task_time_base.period = task_time_base.nominal;
+    task_time_base.pending = 0;
+    task_time_base.scale = (1 << TASK_MGR_TIME_BASE_Q);
+    task_time_base.changes = 0;
+    
+    return(1);
+}
+
+/*!task_TimeBaseSet
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t period: timer period of the new tick period (see TASK_MGR_TIME_BASE_PERIOD)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (period is out of range)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Requests a new scheduler tick period. The tick period has to be longer than 
+ * TASK_MGR_TIME_STEP_MIN and must not exceed the nominal tick period by more than the tick 
+ * scaling factor can represent. The new tick period takes effect at the beginning of the next 
+ * time slot.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_TimeBaseSet(volatile uint16_t period) {
+    
+    if (period < TASK_MGR_TIME_BASE_PERIOD(TASK_MGR_TIME_STEP_MIN))
+    { return(0); }
+    
+    if (((uint32_t)task_time_base.nominal << TASK_MGR_TIME_BASE_Q) < period)
+    { return(0); } // Tick scaling factor would become zero
+    
+    task_time_base.pending = period;
+    
+    return(1);
+}
+
+/*!task_TimeBaseRestore
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Requests the nominal tick period. This function is called by the task manager whenever the
+ * operation mode changes, before the switch-over function of the new operation mode is called.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_TimeBaseRestore(void) {
+    
+    task_time_base.pending = task_time_base.nominal;
+    
+    return(1);
+}
+
+/*!task_TimeBaseClockChange
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (value saturated)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Converts the time base to a new CPU clock. This function has to be called right after the 
+ * CPU clock has been changed and system_frequencies has been updated. The nominal tick period 
+ * is re-derived from TASK_MGR_PERIOD and the recent tick period is converted into timer 
+ * counts of the new clock, keeping its duration. A pending tick period request is converted
+ * instead of the recent tick period. Other than task_TimeBaseSet(), the change is applied 
+ * immediately as the timer already counts at the new clock.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_TimeBaseClockChange(void) {
+    
+    volatile uint16_t previous = task_time_base.nominal;
+    volatile uint32_t period = 0;
+    
+    task_time_base.nominal = TASK_MGR_PERIOD;
+    
+    if (task_time_base.pending != 0) // Convert pending request or recent tick period
+    { period = task_time_base.pending; }
+    else
+    { period = task_time_base.period; }
+    
+    period = (((period * task_time_base.nominal) + (previous >> 1)) / previous);
+    if (period > 0xFFFF)
+    { period = 0xFFFF; }
+    
+    task_time_base.pending = (uint16_t)period;
+    
+    return(task_TimeBaseUpdate());
+}
+
+/*!task_TimeBaseUpdate
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Applies a pending tick period change. This function is called by the scheduler once per tick
+ * right after the time slot has begun, while the timer counter is still far below the new 
+ * period. Timer captures of the recent time slot which are compared against task time quota 
+ * dependent levels are cleared to prevent false fault trips when the tick period decreases.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_TimeBaseUpdate(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t previous = task_time_base.period;
+    volatile uint16_t period = task_time_base.pending;
+    volatile uint16_t scale = 0;
+    
+    if (period == 0)
+    { return(1); }
+    
+    task_time_base.pending = 0;
+    
+    scale = (uint16_t)((((uint32_t)task_time_base.nominal << TASK_MGR_TIME_BASE_Q) + 
+                                (period >> 1)) / period);
+    
+    if ((period == previous) && (scale == task_time_base.scale))
+    { return(1); }
+    
+    // Apply new timer period
+    if (TASK_MGR_TIMER_COUNTER_REGISTER >= period)
+    { TASK_MGR_TIMER_COUNTER_REGISTER = 0; }
+    TASK_MGR_TIMER_PERIOD_REGISTER = period;
+    
+    task_time_base.period = period;
+    task_time_base.scale = scale;
+    task_time_base.changes++;
+    
+    // Re-derive task manager settings depending on the timer period
+    task_mgr.task_time_ctrl.quota = period;
+    task_mgr.task_time_ctrl.maximum = 0;
+    task_mgr.cpu_load.load_factor = ((uint32_t)1000 << 16) / period;
+    
+    // Scale all registered values given in system timer ticks
+    // (values are scaled by value as registered values may be members of packed data structures)
+    #define TIME_BASE_REGISTRY_SCALE(variable)  variable = task_TimeBaseScaleValue(variable, previous, &fres);
+    TIME_BASE_REGISTRY(TIME_BASE_REGISTRY_SCALE)
+    
+    #if (USE_FAULT_ENGINE == 1)
+    fres &= fault_EngineCompile(); // Recompile fault engine with the scaled fault levels
+    #endif
+    
+    return(fres);
+}
+
+/*!task_TimeBaseScaleValue
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t value: value given in system timer ticks
+ *      uint16_t previous: previous timer period
+ *      uint16_t* fres: result flag, cleared when the value saturates
+ * 
+ * Return:
+ *      type: uint16_t
+ *      Value scaled by the ratio of the recent and the previous timer period
+ * 
+ * <b>Description:</b>
+ * Scales the value by the ratio of the recent and the previous timer period (rounded to the 
+ * nearest timer tick). Results exceeding the 16-bit range are saturated to 0xFFFF.
+ * ***********************************************************************************************/
+inline volatile uint16_t task_TimeBaseScaleValue(volatile uint16_t value, volatile uint16_t previous, volatile uint16_t* fres) {
+    
+    volatile uint32_t result = 0;
+    
+    result = ((((uint32_t)value * task_time_base.period) + (previous >> 1)) / previous);
+    
+    if (result > 0xFFFF)
+    { 
+        *fres = 0;
+        return(0xFFFF);
+    }
+    
+    return((uint16_t)result);
+}
+
+#endif  /* USE_TASK_MANAGER_TIME_BASE */
+
+// EOF
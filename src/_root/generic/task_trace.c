@@ -0,0 +1,157 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_trace.c
+ *****************************************************************************
+ * File:   task_trace.c
+ *
+ * Summary:
+ * Trace points recording events into a RAM ring buffer
+ *
+ * Description:	
+ * This file holds the recording routine called by all enabled trace points 
+ * of task_trace.h. Trace points may be located in interrupt service routines 
+ * of any priority. The timestamp is captured and the next ring buffer record 
+ * is claimed while interrupts are held off, so that the records of preempting 
+ * trace points are always stored in chronological order.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_trace.h
+ * task_manager_config.h
+ * support/trace/trace_decode.py
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_trace.h"
+
+#if (USE_TASK_MANAGER_TRACE == 1)
+
+// Trace ring buffer (persistent to be readable after the soft reset following a trap)
+volatile TRACE_BUFFER_t __attribute__((__persistent__))trace;
+
+/*!trace_Record
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t event: event ID of type TRACE_EVENT_e
+ *      uint16_t arg: event specific argument (only the low byte is recorded)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (trace buffer is frozen)
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Writes one trace record into the ring buffer. When the ring buffer is full, the oldest 
+ * record is overwritten. This function is called by the trace point macros and should not be 
+ * called directly.
+ * ***********************************************************************************************/
+volatile uint16_t trace_Record(volatile uint16_t event, volatile uint16_t arg) {
+    
+    volatile uint16_t index = 0, tstamp = 0, ipl_buffer = 0;
+    
+    if (trace.frozen)
+    { return(0); }
+    
+    SET_AND_SAVE_CPU_IPL(ipl_buffer, 7); // Hold off all interrupts while the record is claimed
+    tstamp = TASK_MGR_TIMER_COUNTER_REGISTER;
+    index = (trace.head & (TRACE_BUFFER_SIZE - 1));
+    trace.head = ((index + 1) & (TRACE_BUFFER_SIZE - 1));
+    if (trace.count < TRACE_BUFFER_SIZE)
+    { trace.count++; }
+    RESTORE_CPU_IPL(ipl_buffer);
+    
+    trace.record[index].timestamp = tstamp;
+    trace.record[index].event = (uint8_t)event;
+    trace.record[index].arg = (uint8_t)arg;
+    
+    return(1);
+}
+
+/*!trace_Freeze
+ * ***********************************************************************************************
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Stops recording. The recent contents of the ring buffer are preserved until trace.frozen is
+ * cleared. This function is called by the default trap handler.
+ * ***********************************************************************************************/
+volatile uint16_t trace_Freeze(void) {
+    
+    trace.frozen = 1;
+    
+    return(1);
+}
+
+/*!init_Trace
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t power_on_reset: flag indicating that the device has been powered up (1) or has 
+ *      been reset by software (0)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * <b>Description:</b>
+ * Clears the ring buffer. A ring buffer frozen before a soft reset is preserved for post-mortem
+ * analysis. Contents of persistent RAM are undefined after a power-on reset or when the buffer
+ * status is invalid, which always leads to a cleared ring buffer.
+ * ***********************************************************************************************/
+volatile uint16_t init_Trace(volatile uint16_t power_on_reset) {
+    
+    volatile uint16_t i = 0;
+    
+    if ((power_on_reset) || (trace.frozen != 1) || (trace.head >= TRACE_BUFFER_SIZE) ||
+        (trace.count > TRACE_BUFFER_SIZE) || (trace.size != TRACE_BUFFER_SIZE))
+    {
+        for (i=0; i<TRACE_BUFFER_SIZE; i++)
+        {
+            trace.record[i].timestamp = 0;
+            trace.record[i].event = 0;
+            trace.record[i].arg = 0;
+        }
+        
+        trace.head = 0;
+        trace.count = 0;
+        trace.frozen = 0;
+        trace.size = TRACE_BUFFER_SIZE;
+    }
+    
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_TRACE */
@@ -0,0 +1,352 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_warmboot.c
+ *****************************************************************************
+ * File:   task_warmboot.c
+ *
+ * Summary:
+ * Warm boot snapshot for fast recovery after software and watchdog resets
+ *
+ * Description:	
+ * This file holds the warm boot snapshot and the functions capturing, 
+ * validating and restoring it. The snapshot is captured once the startup 
+ * sequence has been completed and is validated right after the reset root 
+ * cause has been analyzed. 
+ * 
+ * A warm boot is only performed after a software reset or a watchdog timer 
+ * time-out when no critical reset flag is set, when the snapshot has not been 
+ * invalidated by a trap and when fewer than WARM_BOOT_RETRY_LIMIT successive 
+ * warm boots have failed to complete the startup sequence. In all other cases 
+ * the regular cold boot is executed.
+ * 
+ * Please note:
+ * Oscillator and PLL registers are reset by every device reset. The oscillator
+ * configuration is therefore only skipped when the recent register settings 
+ * still match the snapshot, e.g. when the configuration bits select the 
+ * oscillator and PLL settings used by the application.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_warmboot.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "apl/config/tasks.h"
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+
+#define WARM_BOOT_RCON_WARM     0b0000000001010000  // RCON: SWR, WDTO
+#define WARM_BOOT_RCON_COLD     0b1100001010000011  // RCON: TRAPR, IOPUWR, CM, EXTR, BOR, POR
+#define WARM_BOOT_OSCCON_MASK   0b0111000000100000  // OSCCON: COSC, LOCK
+
+/* private function prototypes */
+inline volatile uint16_t warm_boot_Checksum(void);
+inline volatile uint16_t warm_boot_OscillatorMatch(void);
+
+/*!warm_boot_snapshot
+ * ***********************************************************************************************
+ * Description:
+ * Snapshot and status of the warm boot. These variables are not initialized by the start-up code
+ * and keep their contents across soft resets.
+ * ***********************************************************************************************/
+volatile WARM_BOOT_SNAPSHOT_t __attribute__((__persistent__))warm_boot_snapshot;
+volatile WARM_BOOT_STATUS_t __attribute__((__persistent__))warm_boot;
+
+/*!warm_boot_Checksum
+ * ***********************************************************************************************
+ * Description:
+ * Calculates the Fletcher-16 checksum across all bytes of the snapshot preceding the checksum
+ * ***********************************************************************************************/
+inline volatile uint16_t warm_boot_Checksum(void)
+{
+    volatile uint8_t* ptr = (volatile uint8_t*)&warm_boot_snapshot;
+    volatile uint16_t i = 0, sum1 = 0, sum2 = 0;
+    
+    for (i = 0; i < offsetof(WARM_BOOT_SNAPSHOT_t, checksum); i++)
+    {
+        sum1 += ptr[i];
+        if (sum1 >= 255) { sum1 -= 255; }
+        sum2 += sum1;
+        if (sum2 >= 255) { sum2 -= 255; }
+    }
+    
+    return((sum2 << 8) | sum1);
+}
+
+/*!warm_boot_OscillatorMatch
+ * ***********************************************************************************************
+ * Description:
+ * Compares the recent oscillator register settings with the snapshot. Returns 1 when the 
+ * oscillator and PLL configuration is still valid.
+ * ***********************************************************************************************/
+inline volatile uint16_t warm_boot_OscillatorMatch(void)
+{
+    return( ((OSCCON & WARM_BOOT_OSCCON_MASK) == warm_boot_snapshot.oscillator.osccon) &&
+            (CLKDIV == warm_boot_snapshot.oscillator.clkdiv) &&
+            (PLLFBD == warm_boot_snapshot.oscillator.pllfbd) &&
+            (PLLDIV == warm_boot_snapshot.oscillator.plldiv) &&
+            (ACLKCON1 == warm_boot_snapshot.oscillator.aclkcon1) &&
+            (APLLFBD1 == warm_boot_snapshot.oscillator.apllfbd1) &&
+            (APLLDIV1 == warm_boot_snapshot.oscillator.aplldiv1) );
+}
+
+/*!warm_boot_Check
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine evaluates the reset flags captured in traplog.rcon_reg by CheckCPUResetRootCause()
+ * and validates the snapshot. If a warm boot can be performed, the warm boot status flag 
+ * warm_boot.active is set. When no warm boot is possible, the regular boot process is executed.
+ * ***********************************************************************************************/
+volatile uint16_t warm_boot_Check(void)
+{
+    volatile uint16_t rcon = traplog.rcon_reg.reg_block;
+
+    warm_boot.active = false;
+    warm_boot.clock_valid = false;
+    warm_boot.captured = false;
+    
+    // After power-on and brown-out resets the persistent RAM holds random data
+    if ((traplog.rcon_reg.flags.por) || (traplog.rcon_reg.flags.bor))
+    {
+        warm_boot.attempts = 0;
+        warm_boot_Invalidate();
+        return(1);
+    }
+    
+    // Only software resets and watchdog timer time-outs are recovered by a warm boot
+    if (!(rcon & WARM_BOOT_RCON_WARM) || (rcon & WARM_BOOT_RCON_COLD))
+    { return(1); }
+    
+    // Enforce a cold boot when previous warm boots did not complete the startup sequence
+    if (warm_boot.attempts >= WARM_BOOT_RETRY_LIMIT)
+    {
+        warm_boot.attempts = 0;
+        warm_boot_Invalidate();
+        return(1);
+    }
+    
+    if ((warm_boot_snapshot.signature != WARM_BOOT_SIGNATURE) ||
+        (warm_boot_snapshot.fault_objects > WARM_BOOT_FAULT_OBJECTS_MAX) ||
+        (warm_boot_snapshot.checksum != warm_boot_Checksum()))
+    { return(1); }
+
+    warm_boot.attempts++;
+    warm_boot.active = true;
+    
+    return(1);
+}
+
+/*!warm_boot_Capture
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine captures the recent oscillator settings, system frequencies, application timing 
+ * settings and fault object configurations in the snapshot. It is called by the task manager 
+ * when the startup sequence has been completed and may be called by user code at any time
+ * after settings have been changed.
+ * ***********************************************************************************************/
+volatile uint16_t warm_boot_Capture(void)
+{
+    volatile uint16_t i = 0, n = 0;
+    volatile uint16_t* ptr;
+    
+    // The snapshot is invalid until it has been completely written
+    warm_boot_snapshot.signature = 0;
+    
+    warm_boot_snapshot.oscillator.osccon = (OSCCON & WARM_BOOT_OSCCON_MASK);
+    warm_boot_snapshot.oscillator.clkdiv = CLKDIV;
+    warm_boot_snapshot.oscillator.pllfbd = PLLFBD;
+    warm_boot_snapshot.oscillator.plldiv = PLLDIV;
+    warm_boot_snapshot.oscillator.aclkcon1 = ACLKCON1;
+    warm_boot_snapshot.oscillator.apllfbd1 = APLLFBD1;
+    warm_boot_snapshot.oscillator.aplldiv1 = APLLDIV1;
+    
+    ptr = (volatile uint16_t*)&system_frequencies;
+    for (i = 0; i < WARM_BOOT_FREQUENCY_WORDS; i++)
+    { warm_boot_snapshot.frequencies[i] = ptr[i]; }
+    
+    ptr = (volatile uint16_t*)&application.timing;
+    for (i = 0; i < WARM_BOOT_TIMING_WORDS; i++)
+    { warm_boot_snapshot.timing[i] = ptr[i]; }
+    
+    n = fltobj_list_size;
+    if (n > WARM_BOOT_FAULT_OBJECTS_MAX) { n = WARM_BOOT_FAULT_OBJECTS_MAX; }
+    
+    for (i = 0; i < n; i++)
+    {
+        warm_boot_snapshot.fault[i].trip_level = fault_object_list[i]->criteria.trip_level;
+        warm_boot_snapshot.fault[i].trip_cnt_threshold = fault_object_list[i]->criteria.trip_cnt_threshold;
+        warm_boot_snapshot.fault[i].reset_level = fault_object_list[i]->criteria.reset_level;
+        warm_boot_snapshot.fault[i].reset_cnt_threshold = fault_object_list[i]->criteria.reset_cnt_threshold;
+        warm_boot_snapshot.fault[i].fltchken = fault_object_list[i]->status.flags.fltchken;
+    }
+    warm_boot_snapshot.fault_objects = n;
+    
+    warm_boot_snapshot.signature = WARM_BOOT_SIGNATURE;
+    warm_boot_snapshot.checksum = warm_boot_Checksum();
+    
+    warm_boot.attempts = 0;
+    warm_boot.captured = true;
+    
+    return(1);
+}
+
+/*!warm_boot_Invalidate
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine invalidates the snapshot, enforcing a cold boot after the next reset. It is 
+ * called when a trap has been detected.
+ * ***********************************************************************************************/
+volatile uint16_t warm_boot_Invalidate(void)
+{
+    warm_boot_snapshot.signature = 0;
+    return(1);
+}
+
+/*!warm_boot_RestoreClock
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by CLOCK_Initialize(). During a warm boot where the recent oscillator 
+ * register settings still match the snapshot, the system frequencies data structure is restored
+ * from the snapshot and the flag warm_boot.clock_valid is set. The oscillator configuration 
+ * and PLL lock wait can then be skipped.
+ * ***********************************************************************************************/
+volatile uint16_t warm_boot_RestoreClock(void)
+{
+    volatile uint16_t i = 0;
+    volatile uint16_t* ptr;
+
+    warm_boot.clock_valid = false;
+    
+    if ((!warm_boot.active) || (!warm_boot_OscillatorMatch()))
+    { return(1); }
+    
+    ptr = (volatile uint16_t*)&system_frequencies;
+    for (i = 0; i < WARM_BOOT_FREQUENCY_WORDS; i++)
+    { ptr[i] = warm_boot_snapshot.frequencies[i]; }
+    
+    warm_boot.clock_valid = true;
+    
+    return(1);
+}
+
+/*!warm_boot_Restore
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by OS_Initialize() after the task manager and the fault objects have 
+ * been initialized. During a warm boot, the tasks of the warm boot task queue are executed, 
+ * application timing settings and fault object configurations are restored from the snapshot 
+ * and the task manager is switched directly into OP_MODE_SYSTEM_STARTUP.
+ * ***********************************************************************************************/
+volatile uint16_t warm_boot_Restore(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0, n = 0;
+    volatile uint16_t* ptr;
+    
+    if (!warm_boot.active)
+    { return(1); }
+
+    // Execute initialization tasks required after the CPU reset
+    for (i = 0; i < TASK_QUEUE_WARM_BOOT_SIZE; i++)
+    { fres &= Task_Table[task_queue_warm_boot[i]](); }
+    
+    ptr = (volatile uint16_t*)&application.timing;
+    for (i = 0; i < WARM_BOOT_TIMING_WORDS; i++)
+    { ptr[i] = warm_boot_snapshot.timing[i]; }
+    
+    n = warm_boot_snapshot.fault_objects;
+    if (n > fltobj_list_size) { n = fltobj_list_size; }
+    
+    for (i = 0; i < n; i++)
+    {
+        fault_object_list[i]->criteria.trip_level = warm_boot_snapshot.fault[i].trip_level;
+        fault_object_list[i]->criteria.trip_cnt_threshold = warm_boot_snapshot.fault[i].trip_cnt_threshold;
+        fault_object_list[i]->criteria.reset_level = warm_boot_snapshot.fault[i].reset_level;
+        fault_object_list[i]->criteria.reset_cnt_threshold = warm_boot_snapshot.fault[i].reset_cnt_threshold;
+        fault_object_list[i]->status.flags.fltchken = warm_boot_snapshot.fault[i].fltchken;
+    }
+
+  #if (USE_FAULT_ENGINE == 1)
+    fres &= fault_EngineCompile(); // Recompile fault engine with the restored fault object settings
+  #endif
+    
+    // Skip boot and device startup task queues
+    task_mgr.op_mode.mode = OP_MODE_SYSTEM_STARTUP;
+    fres &= task_CheckOperationModeStatus();
+    
+    return(fres);
+}
+
+#endif  /* USE_TASK_MANAGER_WARM_BOOT */
@@ -0,0 +1,227 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_watchdog.c
+ *****************************************************************************
+ * File:   task_watchdog.c
+ *
+ * Summary:
+ * Windowed watchdog timer service with per-task check-ins
+ *
+ * Description:	
+ * This file holds the windowed watchdog timer service executed by the 
+ * scheduler once per tick. Check-ins are collected by the task manager in 
+ * task_wdt.checkin using the constant check-in bit mask of the executed task. 
+ * The watchdog timer is cleared within the window limits derived from the 
+ * watchdog configuration bits when all expected check-ins have arrived. 
+ * Missed windows are captured in a persistent diagnostic record naming the 
+ * first task which missed its check-in.
+ * 
+ * Please note:
+ * Per scheduler tick only the tick counter is incremented and compared with 
+ * the window limits. Expected check-ins are only determined when a window 
+ * starts or when the operation mode changes.
+ *
+ * References:
+ * -
+ *
+ * See also:
+ * task_watchdog.h
+ * task_manager_config.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "_root/config/globals.h"
+#include "apl/config/tasks.h"
+
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+/* private function prototypes */
+inline volatile uint16_t task_WatchdogExpected(volatile uint16_t op_mode);
+inline volatile uint16_t task_WatchdogMissed(void);
+
+volatile task_wdt_status_t task_wdt; // Watchdog service status
+
+/*!task_wdt_diag
+ * ***********************************************************************************************
+ * Description:
+ * Diagnostic record of the most recent missed watchdog window. This variable is not initialized 
+ * by the start-up code and keeps its contents across the watchdog timer reset.
+ * ***********************************************************************************************/
+volatile task_wdt_diag_t __attribute__((__persistent__))task_wdt_diag;
+
+/*!task_WatchdogExpected
+ * ***********************************************************************************************
+ * Description:
+ * Returns the check-in bits expected in the given operation mode
+ * ***********************************************************************************************/
+inline volatile uint16_t task_WatchdogExpected(volatile uint16_t op_mode)
+{
+    volatile uint16_t i = 0, expected = 0;
+    
+    for (i = 0; i < WDT_CHECKIN_TABLE_SIZE; i++)
+    {
+        if (wdt_checkin_table[i].op_modes & op_mode)
+        { expected |= (1 << i); }
+    }
+    
+    return(expected);
+}
+
+/*!task_WatchdogMissed
+ * ***********************************************************************************************
+ * Description:
+ * Captures the missing check-ins of the recent window in the persistent diagnostic record
+ * ***********************************************************************************************/
+inline volatile uint16_t task_WatchdogMissed(void)
+{
+    volatile uint16_t index = 0;
+
+    task_wdt_diag.missed = (task_wdt.expected & ~task_wdt.checkin);
+    task_wdt_diag.op_mode = task_mgr.op_mode.mode;
+    task_wdt_diag.count++;
+    
+    // FF1R returns 1 for bit #0 and 0 if no bit is set
+    index = __builtin_ff1r(task_wdt_diag.missed);
+    if (index > 0)
+    { task_wdt_diag.task_id = wdt_checkin_table[index - 1].task_id; }
+    else
+    { task_wdt_diag.task_id = WDT_CHECKIN_NONE; }
+
+  #if (USE_FAULT_LOG == 1)
+    fault_LogWrite(FAULT_LOG_EVENT_WATCHDOG, task_wdt_diag.task_id, task_wdt_diag.missed);
+  #endif
+    
+    return(0);
+}
+
+/*!init_TaskWatchdog
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine resets the watchdog service status, validates the persistent diagnostic record 
+ * and enables the watchdog timer. The diagnostic record is cleared after power-on and brown-out
+ * resets and kept after all other resets.
+ * ***********************************************************************************************/
+volatile uint16_t init_TaskWatchdog(void)
+{
+    if ((traplog.rcon_reg.flags.por) || (traplog.rcon_reg.flags.bor))
+    {
+        task_wdt_diag.missed = 0;
+        task_wdt_diag.task_id = WDT_CHECKIN_NONE;
+        task_wdt_diag.op_mode = 0;
+        task_wdt_diag.count = 0;
+    }
+    
+    task_wdt.ticks = 0;
+    task_wdt.checkin = 0;
+    task_wdt.expected = task_WatchdogExpected(task_mgr.op_mode.mode);
+    task_wdt.clear_count = 0;
+    
+    WDT_RESET;
+    WDTCONLbits.ON = 1; // Enable watchdog timer (FWDTEN = ON_SW)
+    
+    return(1);
+}
+
+/*!exec_TaskWatchdog
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (window has closed with check-ins missing)
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by the scheduler once per tick. The watchdog timer is cleared when 
+ * the watchdog window is open and all expected check-ins have arrived. After that a new window 
+ * starts. When the window closes with check-ins missing, the diagnostic record is captured 
+ * and the watchdog timer is no longer cleared until it expires.
+ * ***********************************************************************************************/
+volatile uint16_t exec_TaskWatchdog(void)
+{
+    if (task_wdt.ticks < TASK_MGR_TICKS(TASK_MGR_WDT_WINDOW_OPEN))
+    {
+        task_wdt.ticks++;
+        return(1);
+    }
+    
+    if (task_wdt.ticks < TASK_MGR_TICKS(TASK_MGR_WDT_WINDOW_CLOSE))
+    {
+        task_wdt.ticks++;
+        
+        if ((task_wdt.checkin & task_wdt.expected) == task_wdt.expected)
+        {
+            WDT_RESET; // Clear watchdog timer within the window
+            task_wdt.clear_count++;
+            task_wdt.ticks = 0;
+            task_wdt.checkin = 0;
+            task_wdt.expected = task_WatchdogExpected(task_mgr.op_mode.mode);
+        }
+        else if (task_wdt.ticks == TASK_MGR_TICKS(TASK_MGR_WDT_WINDOW_CLOSE))
+        { return(task_WatchdogMissed()); }
+        
+        return(1);
+    }
+    
+    return(0); // Waiting for the watchdog timer reset
+}
+
+/*!task_WatchdogModeSwitch
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t op_mode: new operation mode
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by the task manager when the operation mode changes. Only check-ins 
+ * expected in both, the previous and the new operation mode, remain mandatory for the recent 
+ * window.
+ * ***********************************************************************************************/
+volatile uint16_t task_WatchdogModeSwitch(volatile uint16_t op_mode)
+{
+    task_wdt.expected &= task_WatchdogExpected(op_mode);
+    return(1);
+}
+
+#endif  /* USE_TASK_MANAGER_WATCHDOG */
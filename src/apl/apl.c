@@ -48,6 +48,8 @@
  * 
  * Description:
  * Initializes the main oscillator, the auxiliary oscillator and task scheduler timer peripheral.
+ * When USE_DEFERRED_CLOCK_STARTUP is enabled, both PLLs are only started and the scheduler 
+ * starts up at the FRC clock while the boot task queue polls the PLL lock (see init_fosc.h).
  * All other, application specific peripheral configurations are executed within the scheduler 
  * where they can be monitored and faults can be detected and handled directly.
  * 
@@ -61,17 +63,50 @@
 inline volatile uint16_t CLOCK_Initialize(void){
 
     volatile uint16_t fres = 0;
+    #if (USE_DEFERRED_CLOCK_STARTUP == 1)
+    volatile bool deferred = true;
+    #endif
     
-    // Initialize main oscillator and auxiliary clock
-    //Remove: fres = init_SoftwareWatchDogTimer();
-    fres &= init_oscillator();      // Initialize main CPU clock
-    fres &= init_aux_oscillator();  // Initialize auxiliary clock for ADC, PWM and DAC peripheral
-    fres &= osc_get_frequencies(0); // Update system frequencies data structure
+    #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+    // During a warm boot the system frequencies are restored if the oscillator settings are still valid
+    fres &= warm_boot_RestoreClock();
+    if (!warm_boot.clock_valid)
+    #endif
+    {
+        #if (USE_DEFERRED_CLOCK_STARTUP == 1)
+        #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+        deferred = (!warm_boot.active); // Warm boots skip the boot task queue polling the PLL lock
+        #endif
+        if (deferred)
+        {
+            // Start main and auxiliary PLL in parallel, PLL lock is polled by the boot task queue
+            fres &= init_oscillator_deferred();     // Request main CPU clock switch-over
+            fres &= init_aux_oscillator_deferred(); // Start auxiliary clock for ADC, PWM and DAC peripheral
+        }
+        else
+        #endif
+        {
+            // Initialize main oscillator and auxiliary clock
+            //Remove: fres = init_SoftwareWatchDogTimer();
+            fres &= init_oscillator();      // Initialize main CPU clock
+            fres &= init_aux_oscillator();  // Initialize auxiliary clock for ADC, PWM and DAC peripheral
+            fres &= osc_get_frequencies(0); // Update system frequencies data structure
+        }
+    }
     
     // Setup and start Timer1 as base clock for the task scheduler
     fres &= init_system_timer();    // Initialize timer @ 10 kHz
     fres &= launch_system_timer();  // Enable Timer without interrupts
 
+    #if (USE_TASK_MANAGER_RT_TIER == 1)
+    fres &= init_rt_tier_timer();   // Initialize real-time tier timer (started by OS_Initialize)
+    #endif
+
+    #if (USE_TASK_MANAGER_BENCHMARK == 1)
+    fres &= init_bench_timer();     // Initialize free running benchmark cycle counter
+    fres &= launch_bench_timer();   // Enable Timer without interrupts
+    #endif
+
     return(fres);
     
 }
@@ -110,6 +145,23 @@ inline volatile uint16_t OS_Initialize(void) {
     fres = init_TaskManager();
     fres &= init_FaultObjects();
     
+    #if (USE_TASK_MANAGER_WARM_BOOT == 1)
+    fres &= warm_boot_Restore(); // Restore settings and skip boot queues after a warm boot
+    #endif
+    
+    #if (USE_TASK_MANAGER_RT_TIER == 1)
+    fres &= init_TaskRealTimeTier(); // Initialize real-time task tier
+    fres &= launch_rt_tier_timer();  // Start real-time tier timer with interrupts
+    #endif
+    
+    #if (USE_TASK_MANAGER_WATCHDOG == 1)
+    fres &= init_TaskWatchdog(); // Start windowed watchdog timer service
+    #endif
+    
+    #if (USE_TASK_MANAGER_BENCHMARK == 1)
+    fres &= init_TaskBenchmark(); // Reset benchmark results and calibrate the measurement overhead
+    #endif
+    
     return(fres);
     
 }
@@ -186,6 +238,7 @@ inline volatile uint16_t Device_Reset(void){
     
     // Device reset
     fres &= gpio_reset();               // Sets all device pins to DIGITAL INPUT, disabling all open-drain and pull-up/-down settings
+    BOOT_PROF_SUSPEND();                // Capture boot time before the boot profiler timer is powered off
     fres &= pmd_reset(PMD_POWER_OFF);   // Turns off power and clocks to all peripheral modules offering a PMD control bit
     
     return(fres);
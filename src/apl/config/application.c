@@ -97,12 +97,13 @@ volatile uint16_t init_ApplicationSettings(void) {
     application.system_status.flags.dummy_bit = STAT_BIT_DUMMY_1;
     
     /* SDB AIC power converter default settings */
-    application.timing.period = SWITCHING_PERIOD; // n x 250 ps (e.g. 20,000 = ~250 kHz)
-    application.timing.duty_ratio_init = DUTY_RATIO_INIT_REG; // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
-    application.timing.duty_ratio_min = DUTY_RATIO_MIN_REG + (PWM_DEAD_TIME_LE + PWM_DEAD_TIME_FE); // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
-    application.timing.duty_ratio_max = DUTY_RATIO_MAX_REG; // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
-    application.timing.dead_time_rising = PWM_DEAD_TIME_LE; // n x 250 ps (e.g. 200 = 50 ns)
-    application.timing.dead_time_falling = PWM_DEAD_TIME_FE; // n x 250 ps (e.g. 320 = 80 ns)
+    application.timing.period = PWM_PERIOD; // n x 250 ps (e.g. 20,000 = ~250 kHz)
+    application.timing.phase = PWM_PHASE_SHIFT; // n x 250 ps (phase shift between interleaved phases)
+    application.timing.duty_ratio_init = PWM_DUTY_CYCLE_INIT; // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
+    application.timing.duty_ratio_min = PWM_DUTY_CYCLE_MIN; // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
+    application.timing.duty_ratio_max = PWM_DUTY_CYCLE_MAX; // n x 250 ps (e.g. 1% x 20,000 = 200 ticks)
+    application.timing.dead_time_rising = PWM_DEAD_TIME_H; // n x 250 ps (e.g. 200 = 50 ns)
+    application.timing.dead_time_falling = PWM_DEAD_TIME_L; // n x 250 ps (e.g. 320 = 80 ns)
     
     /* power supply converter default settings */
 
@@ -114,7 +115,7 @@ volatile uint16_t init_ApplicationSettings(void) {
     application.ctrl_status.flags.system_ready = false; // system is not ready yet
     application.ctrl_status.flags.power_source_detected = false; // reset power source detection
     
-    
-    return(1);
+    // bind power converter instances (loop settings are derived from application.timing)
+    return(init_Converters());
 }
 
@@ -0,0 +1,130 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!converter.c
+ *****************************************************************************
+ * File:   converter.c
+ *
+ * Summary:
+ * Power converter instances of the application (see converter.h)
+ *
+ * Description:	
+ * The converter instances are bound to their control loops, feedback sources 
+ * and PWM outputs as registered in the converter registry.
+ * 
+ * References:
+ * -
+ *
+ * See also:
+ * converter.h
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * Author: M91406
+ * Comments:
+ *****************************************************************************/
+
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "hal/hal.h"
+#include "mcal/mcal.h"
+
+// Defining the global array of converter instances
+volatile CONVERTER_t converter[CONVERTER_COUNT]; // power converter instances, laid out contiguously
+
+/*!init_Converters
+ *****************************************************************************
+ * Summary:
+ * Binds all registered converter instances
+ *
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ *
+ * Description:	
+ * Links control loop objects, references, feedback sources and output functions
+ * of each entry of the converter registry to its instance and loads the loop 
+ * settings. The soft-start state machines are reset by init_SoftStart(). The fault 
+ * objects of each instance are bound by init_FaultObjects().
+ *****************************************************************************/
+#define CONVERTER_REGISTRY_BIND(id, ctrl, ref, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) \
+    converter[id].index = (uint16_t)id; \
+    converter[id].controller = &ctrl; \
+    converter[id].ptrReference = &ref; \
+    converter[id].ptrVoltageFeedback = (volatile uint16_t*)&v_fb; \
+    converter[id].ptrCurrentFeedback = (volatile uint16_t*)&i_fb; \
+    converter[id].enable_outputs = &outputs; \
+    converter[id].loop.reference = (uint16_t)(v_target); \
+    converter[id].loop.feedback_offset = 0; \
+    converter[id].loop.trigger_offset = 0; \
+    converter[id].loop.minimum = application.timing.duty_ratio_min; \
+    converter[id].loop.maximum = application.timing.duty_ratio_max; \
+    converter[id].status.value = 0; \
+    converter[id].data.v_out = 0; \
+    converter[id].data.i_out = 0;
+
+volatile uint16_t init_Converters(void) {
+    
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_BIND)
+    
+    return(1);
+}
+
+/*!converter_UpdateData
+ *****************************************************************************
+ * Summary:
+ * Captures the most recent feedback data of all converter instances
+ *
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ *
+ * Description:	
+ * Copies output voltage and current feedback of each instance into its data 
+ * set and publishes the data of the primary converter in application.data.
+ *****************************************************************************/
+volatile uint16_t converter_UpdateData(void) {
+    
+    volatile uint16_t i = 0;
+    
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        converter[i].data.v_out = *converter[i].ptrVoltageFeedback;
+        converter[i].data.i_out = *converter[i].ptrCurrentFeedback;
+    }
+    
+    application.data.v_out = converter[CONVERTER_PRIMARY].data.v_out;
+    application.data.i_out = converter[CONVERTER_PRIMARY].data.i_out;
+    
+    return(1);
+}
+
+// EOF
@@ -47,6 +47,7 @@
 
 
 #include <xc.h> // include processor files - each processor file is guarded.  
+#include <stddef.h>
 
 /* ***********************************************************************************************
  * INCLUDE OF HEADERS ALSO CONTAINING GLOBALLY AVAILABLE FUNCTION CALLS
@@ -58,39 +59,54 @@
  *  *****************************************************************************************************
  * Task Table lists all tasks which will be called by the task manager
  * *****************************************************************************************************
- * This is the list which defines ALL available tasks as enumerated items of an array.
- * These enumerations will be combined freely in so called Task Flow Lists which will then be called
- * by the manager's function calls from the main loop
+ * The dispatch table is generated from the task registry TASK_REGISTRY declared in tasks.h.
+ * It is declared constant and therefore located in program memory, accessed through PSV. 
+ * New tasks need to be added to the task registry in tasks.h.
  * *****************************************************************************************************/
 
-volatile uint16_t (*Task_Table[])(void) = {
-    
-    // Cross-function modules
-    init_ApplicationSettings, // initialize system-wide application data structure
-    init_FaultObjects, // call fault object initialization
-    exec_CaptureSystemStatus,           // Captures detection signals and analyzes voltages to determine the operating mode
-    
-    /* ===== USER FUNCTIONS LIST ===== */
-    
-    // Chip level initialization
-    init_gpio,              // task initializing all used GPIOs in accordance to their application specific function
-    init_irq,               // task initializing the interrupt controller
-    initialize_dsp,         // task initializing all digital signal controller
+#define TASK_REGISTRY_FUNCTION(id, function)    function,
 
-    // Board level initialization
-    init_taskDebugLED,                   // initialize DebugLED task 
-    task_DebugLED,                       // run DebugLED task
-            
-    // Add System function / Special function initialization
+volatile uint16_t (* const Task_Table[TASK_TABLE_SIZE])(void) = {
+    TASK_REGISTRY(TASK_REGISTRY_FUNCTION)
+};
 
-    
-    /* ===== END OF USER FUNCTIONS ===== */
 
-    // Empty task used as internal task execution timing buffer
-    task_Idle,              // simple task doing nothing 
-    
+/*!Real-Time Task Table
+ *  *****************************************************************************************************
+ * Real-time task descriptors generated from the real-time task registry RT_TASK_REGISTRY 
+ * declared in tasks.h.
+ * *****************************************************************************************************/
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+#define RT_TASK_REGISTRY_DESCRIPTOR(id, function, period, phase, deadline)  { function, period, phase, deadline },
+
+const rt_task_descriptor_t rt_task_table[RT_TASK_TABLE_SIZE] = {
+    RT_TASK_REGISTRY(RT_TASK_REGISTRY_DESCRIPTOR)
 };
 
+#endif
+
+
+/*!Watchdog Check-In Tables
+ *  *****************************************************************************************************
+ * Check-in descriptors and check-in bit masks indexed by task ID generated from the watchdog 
+ * check-in registry WDT_CHECKIN_REGISTRY declared in tasks.h. Tasks without check-in hold a 
+ * zero mask.
+ * *****************************************************************************************************/
+#if (USE_TASK_MANAGER_WATCHDOG == 1)
+
+#define WDT_CHECKIN_REGISTRY_DESCRIPTOR(id, op_modes)   { (id), (op_modes) },
+#define WDT_CHECKIN_REGISTRY_MASK(id, op_modes)         [(id)] = (1 << WDT_CHECKIN_##id),
+
+const wdt_checkin_descriptor_t wdt_checkin_table[WDT_CHECKIN_TABLE_SIZE] = {
+    WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_DESCRIPTOR)
+};
+
+const uint16_t wdt_checkin_task_mask[TASK_TABLE_SIZE] = {
+    WDT_CHECKIN_REGISTRY(WDT_CHECKIN_REGISTRY_MASK)
+};
+
+#endif
 
 /*!Task Queues
  *  *****************************************************************************************************
@@ -99,6 +115,9 @@ volatile uint16_t (*Task_Table[])(void) = {
  * These queues are used to establish any order of the registered tasks to be executed.
  * As the task manager is running on a fixed tick rate, more critical tasks might be called
  * multiple times while less critical ones might only be called once.
+ * 
+ * The contents of each queue are declared in the queue lists TASK_QUEUE_xxx in tasks.h. The
+ * queue arrays below are generated from these lists and located in program memory.
  * *****************************************************************************************************/
 
 /*!task_queue_boot
@@ -115,14 +134,9 @@ volatile uint16_t (*Task_Table[])(void) = {
  *   task queue device startup.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_boot[] = {
-    TASK_INIT_GPIO,         // Step #0
-    TASK_INIT_APPLICATION_SETTINGS, // Step #1
-    TASK_INIT_FAULT_OBJECTS, // Step #2
-//    TASK_INIT_DBGLED,      // Step #4
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_boot[TASK_QUEUE_BOOT_SIZE] = {
+    TASK_QUEUE_BOOT(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_boot_size = (sizeof(task_queue_boot)/sizeof(task_queue_boot[0]));
 
 /*!task_queue_device_startup
  * ***********************************************************************************************
@@ -142,11 +156,9 @@ volatile uint16_t task_queue_boot_size = (sizeof(task_queue_boot)/sizeof(task_qu
  *   task queue system startup.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_device_startup[] = {
-    TASK_DGBLED,                   // Step #1
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_device_startup[TASK_QUEUE_DEVICE_STARTUP_SIZE] = {
+    TASK_QUEUE_DEVICE_STARTUP(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_device_startup_size = (sizeof(task_queue_device_startup)/sizeof(task_queue_device_startup[0]));
 
 /*!task_queue_system_startup
  * ***********************************************************************************************
@@ -160,17 +172,19 @@ volatile uint16_t task_queue_device_startup_size = (sizeof(task_queue_device_sta
  *   appropriate operating mode.
  * 
  *   PLEASE NOTE:
- *   The system startup task queue is only executed once calling all listed tasks in one sequence.
- *   At the end of this task queue the task manager will automatically switch over to 
- *   task queue idle. if this is not desired, another operating mode needs to be actively set
- *   in user code.
+ *   The system startup task queue is executed until the soft-start task (see task_SoftStart.c)
+ *   has completed the startup sequence of the power converter and switches the task manager 
+ *   into OP_MODE_NORMAL. The soft-start state machine is reset each time this operating mode
+ *   is entered.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_system_startup[] = {
-    TASK_DGBLED, // Step #1
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_system_startup[TASK_QUEUE_SYSTEM_STARTUP_SIZE] = {
+    TASK_QUEUE_SYSTEM_STARTUP(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_system_startup_size = (sizeof(task_queue_system_startup)/sizeof(task_queue_system_startup[0]));
+volatile uint16_t task_queue_init_system_startup(void)
+{
+    return(init_SoftStart());
+}
 
 /*!task_queue_idle
  * ***********************************************************************************************
@@ -184,11 +198,9 @@ volatile uint16_t task_queue_system_startup_size = (sizeof(task_queue_system_sta
  *   requirement as well as serves as safety layer when no valid operating mode is set.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_idle[] = {
-    TASK_DGBLED, // Step #0
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_idle[TASK_QUEUE_IDLE_SIZE] = {
+    TASK_QUEUE_IDLE(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_idle_size = (sizeof(task_queue_idle)/sizeof(task_queue_idle[0]));
 volatile uint16_t task_queue_init_idle(void)
 {
     Nop();
@@ -213,17 +225,15 @@ volatile uint16_t task_queue_init_idle(void)
  *   mode. The MCU may be in sleep mode.
  * 
  * *********************************************************************************************** */
-/* ORIGINAL DEFINITION OF OP_MODE_NORMAL
+/* ORIGINAL DEFINITION OF OP_MODE_NORMAL (tasks.h)
  * 
-volatile uint16_t task_queue_normal[] = {
-    TASK_1,                     // Step #0
-    TASK_2                      // Step #1
-    TASK_3                      // Step #2
-    (...),                      // Step #3
-    TASK_IDLE                   // Step #n => empty buffer task execution window to account for 
-                                // overrunning task execution time
-};
-volatile uint16_t task_queue_normal_size = (sizeof(task_queue_normal)/sizeof(task_queue_normal[0]));
+#define TASK_QUEUE_NORMAL(ENTRY) \
+    ENTRY(TASK_1, n, 0)         (Step #0) \
+    ENTRY(TASK_2, n, 1)         (Step #1) \
+    ENTRY(TASK_3, n, 2)         (Step #2) \
+    (...)                       (Step #3) \
+    ENTRY(TASK_IDLE, n, n-1)    (Step #n => empty buffer task execution window to account for 
+                                 overrunning task execution time)
 */
 
 /*!task_queue_normal
@@ -235,11 +245,9 @@ volatile uint16_t task_queue_normal_size = (sizeof(task_queue_normal)/sizeof(tas
  *   executed in this mode need to added to this task queue.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_normal[] = {
-    TASK_DGBLED, // Step #0
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_normal[TASK_QUEUE_NORMAL_SIZE] = {
+    TASK_QUEUE_NORMAL(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_normal_size = (sizeof(task_queue_normal)/sizeof(task_queue_normal[0]));
 volatile uint16_t task_queue_init_normal(void)
 {
     Nop();
@@ -259,11 +267,9 @@ volatile uint16_t task_queue_init_normal(void)
  *   under fault conditions need to be added to this task queue.
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_fault[] = {
-    TASK_DGBLED, // Step #0
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_fault[TASK_QUEUE_FAULT_SIZE] = {
+    TASK_QUEUE_FAULT(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_fault_size = (sizeof(task_queue_fault)/sizeof(task_queue_fault[0]));
 volatile uint16_t task_queue_init_fault(void)
 {
     Nop();
@@ -279,15 +285,105 @@ volatile uint16_t task_queue_init_fault(void)
  *   profile does not require a standby mode, this task queue can be ignored..
  * *********************************************************************************************** */
 
-volatile uint16_t task_queue_standby[] = {
-    TASK_DGBLED, // Step #0
-    TASK_IDLE   // empty task used as task list execution time buffer 
+const task_queue_item_t task_queue_standby[TASK_QUEUE_STANDBY_SIZE] = {
+    TASK_QUEUE_STANDBY(TASK_QUEUE_ITEM)
 };
-volatile uint16_t task_queue_standby_size = (sizeof(task_queue_standby)/sizeof(task_queue_standby[0]));
 volatile uint16_t task_queue_init_standby(void)
 {
-    Nop();
-    return(1);
+    volatile uint16_t fres = 1;
+    
+    #if (USE_STANDBY_POWER_MANAGER == 1)
+    fres &= standby_Enter(); // Step down the CPU clock and gate peripherals not used in standby
+    #endif
+    
+    #if (USE_TASK_MANAGER_TIME_BASE == 1)
+    if (TASK_MGR_TIME_STEP_STANDBY > 0)
+    { fres &= task_TimeBaseSet(TASK_MGR_TIME_BASE_PERIOD(TASK_MGR_TIME_STEP_STANDBY)); } // Slow down tick to save power
+    #endif
+    
+    return(fres);
+}
+volatile uint16_t task_queue_exit_standby(void)
+{
+    volatile uint16_t fres = 1;
+    
+    #if (USE_STANDBY_POWER_MANAGER == 1)
+    fres &= standby_Exit(); // Return to full speed before the next mode is loaded
+    #endif
+    
+    return(fres);
 }
 
+/*!task_queue_warm_boot
+ * ***********************************************************************************************
+ *   After a warm boot (see USE_TASK_MANAGER_WARM_BOOT) the boot and device startup task queues 
+ *   are skipped and the task manager directly enters OP_MODE_SYSTEM_STARTUP. Instead, the tasks 
+ *   listed in this queue are called once in one sequence before the task manager is started. 
+ *   All initializations of data structures and peripherals which are required after a CPU reset
+ *   and which are not covered by the warm boot snapshot need to be listed here.
+ * 
+ *   PLEASE NOTE:
+ *   This queue only holds task IDs and is not executed by the task manager scheduler. 
+ * *********************************************************************************************** */
+
+#if (USE_TASK_MANAGER_WARM_BOOT == 1)
+const uint16_t task_queue_warm_boot[TASK_QUEUE_WARM_BOOT_SIZE] = {
+    TASK_QUEUE_WARM_BOOT(TASK_QUEUE_ID)
+};
+#endif
+
+/*!task_op_mode_table
+ * ***********************************************************************************************
+ *   The operation mode descriptor table assigns the task queues declared above to the 
+ *   operation modes of the task manager. When the operation mode changes, the task manager 
+ *   loads the new task queue from the descriptor located at the bit position of the new mode.
+ * 
+ *   - queue/size:      task queue and number of queue entries
+ *   - switch over:     user function called when switching over to this mode (NULL = none)
+ *   - next mode:       operation mode automatically selected after one pass through the task 
+ *                      queue (OP_MODE_UNKNOWN = keep running this task queue)
+ *   - flags:           OP_MODE_FLAG_FAULT_OVERRIDE: sets the fault override flag when entering
+ *                      OP_MODE_FLAG_STARTUP_COMPLETE: marks the startup sequence as completed
+ *                      after one pass through the task queue
+ *   - leave:           user function called when leaving this mode (optional, NULL = none)
+ * 
+ *   User defined operation modes are registered by adding a descriptor at their index, e.g.
+ * 
+ *   [OP_MODE_INDEX_USER_1] = { task_queue_user1, TASK_QUEUE_USER1_SIZE, NULL, OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE },
+ * 
+ *   Operation modes without descriptor run the task queue of OP_MODE_IDLE.
+ * *********************************************************************************************** */
+
+const task_op_mode_descriptor_t task_op_mode_table[OP_MODE_TABLE_SIZE] = {
+    
+    [OP_MODE_INDEX_BOOT] = 
+        { task_queue_boot, TASK_QUEUE_BOOT_SIZE, NULL, 
+          OP_MODE_DEVICE_STARTUP, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_DEVICE_STARTUP] = 
+        { task_queue_device_startup, TASK_QUEUE_DEVICE_STARTUP_SIZE, NULL, 
+          OP_MODE_SYSTEM_STARTUP, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_SYSTEM_STARTUP] = 
+        { task_queue_system_startup, TASK_QUEUE_SYSTEM_STARTUP_SIZE, &task_queue_init_system_startup, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_STARTUP_COMPLETE },
+    
+    [OP_MODE_INDEX_IDLE] = 
+        { task_queue_idle, TASK_QUEUE_IDLE_SIZE, &task_queue_init_idle, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_NORMAL] = 
+        { task_queue_normal, TASK_QUEUE_NORMAL_SIZE, &task_queue_init_normal, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE },
+    
+    [OP_MODE_INDEX_FAULT] = 
+        { task_queue_fault, TASK_QUEUE_FAULT_SIZE, &task_queue_init_fault, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_FAULT_OVERRIDE },
+    
+    [OP_MODE_INDEX_STANDBY] = 
+        { task_queue_standby, TASK_QUEUE_STANDBY_SIZE, &task_queue_init_standby, 
+          OP_MODE_UNKNOWN, OP_MODE_FLAG_NONE, &task_queue_exit_standby }
+    
+};
+
 // EOF
\ No newline at end of file
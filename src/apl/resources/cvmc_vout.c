@@ -0,0 +1,334 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!cvmc_vout.c
+ * ****************************************************************************
+ * File:   cvmc_vout.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the output voltage mode control loop designed in 
+ * h/hal/config/cvmc_vout.dcld. Coefficients are located in X-space, histories 
+ * in Y-space to allow dual operand fetches of the DSP engine.
+ * 
+ * History:
+ * Created on October 14, 2026, 11:00 AM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "apl/resources/cvmc_vout.h"
+#include "apl/apl.h"
+#include "hal/hal.h"
+
+/*!cvmc_vout_ACoefficients, cvmc_vout_BCoefficients
+ * ***********************************************************************************************
+ * Description:
+ * Q15 compensator coefficients generated from the filter settings in cvmc_vout.h 
+ * ***********************************************************************************************/
+volatile int16_t __attribute__((space(xmemory))) cvmc_vout_ACoefficients[CVMC_VOUT_A_COEFFICIENTS] = {
+    NPNZ16B_Q15(CVMC_VOUT_A1, CVMC_VOUT_POSTSHIFT_A), // Coefficient A1
+    NPNZ16B_Q15(CVMC_VOUT_A2, CVMC_VOUT_POSTSHIFT_A), // Coefficient A2
+    NPNZ16B_Q15(CVMC_VOUT_A3, CVMC_VOUT_POSTSHIFT_A)  // Coefficient A3
+};
+
+volatile int16_t __attribute__((space(xmemory))) cvmc_vout_BCoefficients[CVMC_VOUT_B_COEFFICIENTS] = {
+    NPNZ16B_Q15(CVMC_VOUT_B0, CVMC_VOUT_POSTSHIFT_B), // Coefficient B0
+    NPNZ16B_Q15(CVMC_VOUT_B1, CVMC_VOUT_POSTSHIFT_B), // Coefficient B1
+    NPNZ16B_Q15(CVMC_VOUT_B2, CVMC_VOUT_POSTSHIFT_B), // Coefficient B2
+    NPNZ16B_Q15(CVMC_VOUT_B3, CVMC_VOUT_POSTSHIFT_B)  // Coefficient B3
+};
+
+#if (EFFICIENCY_ENABLED)
+/*!cvmc_vout_ACoefficientsReduced, cvmc_vout_BCoefficientsReduced, cvmc_vout_efficiency_banks
+ * ***********************************************************************************************
+ * Description:
+ * Q15 coefficients of the reduced switching frequency operating point of the efficiency manager 
+ * (see CVMC_VOUT_REDUCED_FREQUENCY). The nominal bank uses the coefficients above, hence values
+ * written to these by the parameter access protocol remain effective at nominal frequency. The
+ * bank thresholds are not evaluated, operating points are selected by efficiency_Manager().
+ * ***********************************************************************************************/
+volatile int16_t __attribute__((space(xmemory))) cvmc_vout_ACoefficientsReduced[CVMC_VOUT_A_COEFFICIENTS] = {
+    NPNZ16B_Q15(CVMC_VOUT_A1_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_A), // Coefficient A1
+    NPNZ16B_Q15(CVMC_VOUT_A2_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_A), // Coefficient A2
+    NPNZ16B_Q15(CVMC_VOUT_A3_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_A)  // Coefficient A3
+};
+
+volatile int16_t __attribute__((space(xmemory))) cvmc_vout_BCoefficientsReduced[CVMC_VOUT_B_COEFFICIENTS] = {
+    NPNZ16B_Q15(CVMC_VOUT_GAIN_REDUCED * CVMC_VOUT_B0_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_B), // Coefficient B0
+    NPNZ16B_Q15(CVMC_VOUT_GAIN_REDUCED * CVMC_VOUT_B1_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_B), // Coefficient B1
+    NPNZ16B_Q15(CVMC_VOUT_GAIN_REDUCED * CVMC_VOUT_B2_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_B), // Coefficient B2
+    NPNZ16B_Q15(CVMC_VOUT_GAIN_REDUCED * CVMC_VOUT_B3_K(CVMC_VOUT_K_REDUCED), CVMC_VOUT_POSTSHIFT_B)  // Coefficient B3
+};
+
+volatile NPNZ16B_COEFF_BANK_t cvmc_vout_efficiency_banks[EFFICIENCY_POINTS] = {
+    { &cvmc_vout_ACoefficients[0], &cvmc_vout_BCoefficients[0], 0 },               // EFFICIENCY_POINT_NOMINAL
+    { &cvmc_vout_ACoefficientsReduced[0], &cvmc_vout_BCoefficientsReduced[0], 0 }  // EFFICIENCY_POINT_REDUCED
+};
+#endif
+
+#if (CVMC_VOUT_GAIN_SCHEDULING == 1)
+/*!cvmc_vout_BCoefficientsBank, cvmc_vout_banks
+ * ***********************************************************************************************
+ * Description:
+ * Q15 B-coefficients of each operating point with the compensator gain scaled by the gain 
+ * factor of the bank. All banks share the A-coefficients and the post-shift scalers.
+ * ***********************************************************************************************/
+#define CVMC_VOUT_B_BANK(gain) { \
+    NPNZ16B_Q15((gain) * CVMC_VOUT_B0, CVMC_VOUT_POSTSHIFT_B), \
+    NPNZ16B_Q15((gain) * CVMC_VOUT_B1, CVMC_VOUT_POSTSHIFT_B), \
+    NPNZ16B_Q15((gain) * CVMC_VOUT_B2, CVMC_VOUT_POSTSHIFT_B), \
+    NPNZ16B_Q15((gain) * CVMC_VOUT_B3, CVMC_VOUT_POSTSHIFT_B) }
+
+volatile int16_t __attribute__((space(xmemory))) 
+    cvmc_vout_BCoefficientsBank[CVMC_VOUT_GS_BANKS][CVMC_VOUT_B_COEFFICIENTS] = {
+    CVMC_VOUT_B_BANK(CVMC_VOUT_GS_GAIN_0), // Bank #0
+    CVMC_VOUT_B_BANK(CVMC_VOUT_GS_GAIN_1), // Bank #1
+    CVMC_VOUT_B_BANK(CVMC_VOUT_GS_GAIN_2)  // Bank #2
+};
+
+volatile NPNZ16B_COEFF_BANK_t cvmc_vout_banks[CVMC_VOUT_GS_BANKS] = {
+    { &cvmc_vout_ACoefficients[0], &cvmc_vout_BCoefficientsBank[0][0], CVMC_VOUT_GS_TICKS(CVMC_VOUT_GS_THRESHOLD_0) },
+    { &cvmc_vout_ACoefficients[0], &cvmc_vout_BCoefficientsBank[1][0], CVMC_VOUT_GS_TICKS(CVMC_VOUT_GS_THRESHOLD_1) },
+    { &cvmc_vout_ACoefficients[0], &cvmc_vout_BCoefficientsBank[2][0], CVMC_VOUT_GS_TICKS(CVMC_VOUT_GS_THRESHOLD_2) }
+};
+
+volatile NPNZ16B_GAIN_SCHEDULER_t cvmc_vout_scheduler; // Gain scheduler of the control loop
+#endif
+
+/*!cvmc_vout_ControlHistory, cvmc_vout_ErrorHistory
+ * ***********************************************************************************************
+ * Description:
+ * Recent control outputs y[n-1] ... y[n-3] and errors e[n] ... e[n-3] 
+ * ***********************************************************************************************/
+volatile int16_t __attribute__((space(ymemory))) cvmc_vout_ControlHistory[CVMC_VOUT_A_COEFFICIENTS];
+volatile int16_t __attribute__((space(ymemory))) cvmc_vout_ErrorHistory[CVMC_VOUT_B_COEFFICIENTS];
+
+volatile cNPNZ16b_t cvmc_vout; // Output voltage control loop object
+volatile uint16_t cvmc_vout_reference = 0; // Output voltage reference in ADC ticks
+
+#if (CVMC_VOUT_CYCLE_METER == 1)
+volatile NPNZ16B_CYCLE_METER_t cvmc_vout_cycles; // CPU cycles of the control loop interrupt service routine
+volatile SEQLOCK_t cvmc_vout_cycles_lock; // Seqlock of the cycle meter (written by the control loop interrupt service routine only)
+#endif
+
+/*!cvmc_vout_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine links coefficients, histories, source and target registers to the control loop
+ * object, loads the output clamping limits from the application timing settings and sets up 
+ * the ADC interrupt executing the control loop. When gain scheduling is enabled, the coefficient
+ * bank covering the design point is loaded. When the feed-forward stage is enabled, the control
+ * output is redirected into the feed-forward stage (see feedforward.h). The control loop remains disabled until 
+ * cvmc_vout.status.flags.enable is set.
+ * ***********************************************************************************************/
+volatile uint16_t cvmc_vout_Init(void)
+{
+    volatile uint16_t fres = 1;
+    
+    cvmc_vout.status.value = 0; // Control loop is disabled
+    
+    cvmc_vout.ptrSourceRegister = &CVMC_VOUT_ADC_BUFFER;
+    cvmc_vout.ptrTargetRegister = &CVMC_VOUT_PWM_DUTY_CYCLE;
+    cvmc_vout.ptrControlReference = &cvmc_vout_reference;
+    cvmc_vout.ptrACoefficients = &cvmc_vout_ACoefficients[0];
+    cvmc_vout.ptrBCoefficients = &cvmc_vout_BCoefficients[0];
+    cvmc_vout.ptrControlHistory = &cvmc_vout_ControlHistory[0];
+    cvmc_vout.ptrErrorHistory = &cvmc_vout_ErrorHistory[0];
+    cvmc_vout.ACoefficientsArraySize = CVMC_VOUT_A_COEFFICIENTS;
+    cvmc_vout.BCoefficientsArraySize = CVMC_VOUT_B_COEFFICIENTS;
+    cvmc_vout.normPreShift = CVMC_VOUT_PRESHIFT;
+    cvmc_vout.normPostShiftA = CVMC_VOUT_POSTSHIFT_A;
+    cvmc_vout.normPostShiftB = CVMC_VOUT_POSTSHIFT_B;
+    cvmc_vout.InputOffset = CVMC_VOUT_INPUT_OFFSET;
+    cvmc_vout.MinOutput = (int16_t)application.timing.duty_ratio_min;
+    cvmc_vout.MaxOutput = (int16_t)application.timing.duty_ratio_max;
+    
+    fres &= cvmc_vout_Reset(&cvmc_vout);
+    
+  #if (FEEDFORWARD_ENABLED)
+    fres &= feedforward_Init(&cvmc_vout, &CVMC_VOUT_PWM_DUTY_CYCLE); // Control output is scaled into the duty cycle
+  #endif
+    
+  #if (CVMC_VOUT_GAIN_SCHEDULING == 1)
+    cvmc_vout_scheduler.enable = false;
+    cvmc_vout_scheduler.bumpless = (bool)(CVMC_VOUT_GS_BUMPLESS == 1);
+    cvmc_vout_scheduler.ptrSchedulingVariable = &CVMC_VOUT_GS_SOURCE;
+    cvmc_vout_scheduler.ptrBanks = &cvmc_vout_banks[0];
+    cvmc_vout_scheduler.banks = CVMC_VOUT_GS_BANKS;
+    cvmc_vout_scheduler.hysteresis = CVMC_VOUT_GS_TICKS(CVMC_VOUT_GS_HYSTERESIS);
+    cvmc_vout_scheduler.active = CVMC_VOUT_GS_DEFAULT_BANK;
+    cvmc_vout_scheduler.switch_count = 0;
+    
+    fres &= npnz16b_SelectBank(&cvmc_vout, &cvmc_vout_banks[CVMC_VOUT_GS_DEFAULT_BANK], false);
+    cvmc_vout_scheduler.enable = true;
+  #endif
+    
+  #if (CVMC_VOUT_CYCLE_METER == 1)
+    cvmc_vout_cycles.cycles = 0;
+    cvmc_vout_cycles.maximum = 0;
+    cvmc_vout_cycles.count = 0;
+    fres &= seqlock_Init(&cvmc_vout_cycles_lock);
+  #endif
+    
+    // Control loop interrupt is raised by the ADC feedback channel
+    CVMC_VOUT_ADC_IP = CVMC_VOUT_ISR_PRIORITY;
+    CVMC_VOUT_ADC_IF = 0;
+    CVMC_VOUT_ADC_IE = 1;
+    
+    return(fres);
+}
+
+/*!cvmc_vout_Reset
+ * ***********************************************************************************************
+ * Parameters:
+ *      cNPNZ16b_t* controller: control loop object
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine clears the control and error histories of the given control loop object
+ * ***********************************************************************************************/
+volatile uint16_t cvmc_vout_Reset(volatile cNPNZ16b_t* controller)
+{
+    volatile uint16_t i = 0;
+    
+    for (i = 0; i < controller->ACoefficientsArraySize; i++)
+    { controller->ptrControlHistory[i] = 0; }
+
+    for (i = 0; i < controller->BCoefficientsArraySize; i++)
+    { controller->ptrErrorHistory[i] = 0; }
+    
+    return(1);
+}
+
+/*!cvmc_vout_Update
+ * ***********************************************************************************************
+ * Parameters:
+ *      cNPNZ16b_t* controller: control loop object
+ * 
+ * Return:
+ *      (none)
+ * 
+ * Description:
+ * This routine executes one iteration of the 3P3Z compensator. The normalized error is 
+ * multiplied with the B-coefficients in accumulator B, the control history with the 
+ * A-coefficients in accumulator A. Both results are scaled back by their post-shift scalers 
+ * and added before the result is rounded, clamped and written to the target register. The 
+ * clamped output is stored in the control history (anti-windup).
+ * 
+ * Please note:
+ * This routine relies on the DSP core configuration of initialize_dsp(). The post-shift scalers 
+ * are applied as compile-time constants of this control loop.
+ * ***********************************************************************************************/
+void cvmc_vout_Update(volatile cNPNZ16b_t* controller)
+{
+    register int acc_a asm("A");
+    register int acc_b asm("B");
+    volatile int16_t* e = controller->ptrErrorHistory;
+    volatile int16_t* u = controller->ptrControlHistory;
+    volatile int16_t* a = controller->ptrACoefficients;
+    volatile int16_t* b = controller->ptrBCoefficients;
+    volatile int16_t error = 0, output = 0;
+    
+    if (!controller->status.flags.enable)
+    { return; }
+    
+    // Shift error history and calculate normalized error of the recent sample
+    e[3] = e[2];
+    e[2] = e[1];
+    e[1] = e[0];
+    error = ((int16_t)*controller->ptrControlReference - 
+            ((int16_t)*controller->ptrSourceRegister - controller->InputOffset));
+    e[0] = (error << CVMC_VOUT_PRESHIFT);
+    
+    // B-term: B0 e[n] + B1 e[n-1] + B2 e[n-2] + B3 e[n-3]
+    acc_b = __builtin_clr();
+    acc_b = __builtin_mac(acc_b, b[0], e[0], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_b = __builtin_mac(acc_b, b[1], e[1], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_b = __builtin_mac(acc_b, b[2], e[2], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_b = __builtin_mac(acc_b, b[3], e[3], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_b = __builtin_sftac(acc_b, -CVMC_VOUT_POSTSHIFT_B);
+    
+    // A-term: A1 y[n-1] + A2 y[n-2] + A3 y[n-3]
+    acc_a = __builtin_clr();
+    acc_a = __builtin_mac(acc_a, a[0], u[0], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_a = __builtin_mac(acc_a, a[1], u[1], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_a = __builtin_mac(acc_a, a[2], u[2], NULL, NULL, 0, NULL, NULL, 0, NULL, 0);
+    acc_a = __builtin_sftac(acc_a, -CVMC_VOUT_POSTSHIFT_A);
+    
+    acc_a = __builtin_addab(acc_a, acc_b);
+    output = __builtin_sacr(acc_a, 0);
+    
+    // Output clamping (anti-windup)
+    controller->status.flags.lower_saturation_event = (output < controller->MinOutput);
+    controller->status.flags.upper_saturation_event = (output > controller->MaxOutput);
+    if (controller->status.flags.lower_saturation_event) { output = controller->MinOutput; }
+    if (controller->status.flags.upper_saturation_event) { output = controller->MaxOutput; }
+    
+    // Shift control history
+    u[2] = u[1];
+    u[1] = u[0];
+    u[0] = output;
+    
+    *controller->ptrTargetRegister = (uint16_t)output;
+    
+    return;
+}
+
+/*!cvmc_vout_GainScheduler
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Task function switching the coefficient banks of the output voltage control loop by the 
+ * recent operating point (see CVMC_VOUT_GAIN_SCHEDULING).
+ * ***********************************************************************************************/
+volatile uint16_t cvmc_vout_GainScheduler(void)
+{
+  #if (CVMC_VOUT_GAIN_SCHEDULING == 1)
+    return(npnz16b_GainScheduler(&cvmc_vout, &cvmc_vout_scheduler));
+  #else
+    return(1);
+  #endif
+}
+
+// EOF
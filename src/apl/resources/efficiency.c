@@ -0,0 +1,348 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!efficiency.c
+ * ****************************************************************************
+ * File:   efficiency.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the operating points, the operating mode 
+ * transitions and the burst mode comparator of the light-load efficiency 
+ * manager (see efficiency.h).
+ * 
+ * History:
+ * Created on October 14, 2026, 02:00 PM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "apl/apl.h"
+#include "apl/resources/efficiency.h"
+#include "apl/resources/cvmc_vout.h"
+
+volatile EFFICIENCY_t efficiency = { 
+    EFFICIENCY_MODE_FIXED, 0, 0, 0, (bool)(EFFICIENCY_ENABLED), false, false 
+}; // Light-load efficiency manager (enable setting is kept across converter restarts)
+
+#if (EFFICIENCY_ENABLED)
+
+/* private function prototypes */
+inline volatile uint16_t efficiency_SetPoint(volatile EFFICIENCY_POINT_t* from, volatile EFFICIENCY_POINT_t* to);
+inline volatile uint16_t efficiency_BurstStop(void);
+
+/*!efficiency_points
+ * ***********************************************************************************************
+ * Description:
+ * Operating points of both switching frequencies. The duty cycle limits of the point being left 
+ * are captured from the control loop at each transition, so that limits changed at runtime 
+ * (e.g. by the parameter access protocol) are restored when the point is entered again.
+ * ***********************************************************************************************/
+volatile EFFICIENCY_POINT_t efficiency_points[EFFICIENCY_POINTS] = {
+    { PWM_PERIOD, (int16_t)PWM_DUTY_CYCLE_MIN, (int16_t)PWM_DUTY_CYCLE_MAX, 
+      ADC_FAST_TRIGGER, ADC_SLOW_TRIGGER, &cvmc_vout_efficiency_banks[EFFICIENCY_POINT_NOMINAL] }, // EFFICIENCY_POINT_NOMINAL
+    { EFFICIENCY_REDUCED_PERIOD, (int16_t)EFFICIENCY_REDUCED_DUTY_MIN, (int16_t)EFFICIENCY_REDUCED_DUTY_MAX, 
+      EFFICIENCY_REDUCED_FAST_TRIGGER, EFFICIENCY_REDUCED_SLOW_TRIGGER, &cvmc_vout_efficiency_banks[EFFICIENCY_POINT_REDUCED] } // EFFICIENCY_POINT_REDUCED
+};
+
+#endif
+
+/*!efficiency_Reset
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Returns the converter to the nominal switching frequency and resets the entry delay. This 
+ * routine is called by init_SoftStart() each time the converter is restarted, which covers 
+ * restarts after a fault while the reduced frequency operating point was active.
+ * ***********************************************************************************************/
+volatile uint16_t efficiency_Reset(void)
+{
+    volatile uint16_t fres = 1;
+    
+    fres &= efficiency_SetMode(EFFICIENCY_MODE_FIXED);
+    efficiency.counter = 0;
+    
+    return(fres);
+}
+
+/*!efficiency_SetMode
+ * ***********************************************************************************************
+ * Parameters:
+ *      EFFICIENCY_MODE_e mode: new operating mode
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (mode not available)
+ *      1: Success
+ * 
+ * Description:
+ * Switches the operating mode. Burst mode is stopped before the operating point is changed and 
+ * started after the reduced frequency operating point has been loaded. Pending skipped pulses 
+ * are resumed when burst mode is left (see efficiency_BurstStop()).
+ * ***********************************************************************************************/
+volatile uint16_t efficiency_SetMode(volatile EFFICIENCY_MODE_e mode)
+{
+    volatile uint16_t fres = 1;
+    
+    if (mode == efficiency.mode)
+    { return(1); }
+    
+  #if (EFFICIENCY_ENABLED)
+    
+    if ((mode == EFFICIENCY_MODE_BURST) && (!EFFICIENCY_BURST_ENABLED))
+    { return(0); }
+    
+    if (efficiency.mode == EFFICIENCY_MODE_BURST)
+    { fres &= efficiency_BurstStop(); }
+    
+    if (mode == EFFICIENCY_MODE_FIXED)
+    { fres &= efficiency_SetPoint(&efficiency_points[EFFICIENCY_POINT_REDUCED], &efficiency_points[EFFICIENCY_POINT_NOMINAL]); }
+    else if (efficiency.mode == EFFICIENCY_MODE_FIXED)
+    { fres &= efficiency_SetPoint(&efficiency_points[EFFICIENCY_POINT_NOMINAL], &efficiency_points[EFFICIENCY_POINT_REDUCED]); }
+    
+    if (mode == EFFICIENCY_MODE_BURST)
+    {
+        efficiency.skipping = false;
+        efficiency.burst_active = true; // Comparator is evaluated from the next control loop iteration
+    }
+    
+    efficiency.mode = mode;
+    efficiency.counter = 0;
+    
+  #else
+    fres = 0; // Only EFFICIENCY_MODE_FIXED is available
+  #endif
+    
+    return(fres);
+}
+
+/*!efficiency_Manager
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Scheduler task selecting the operating mode by the output current (see USE_EFFICIENCY_MANAGER).
+ * Lower modes are entered after the output current has been below their entry level for 
+ * EFFICIENCY_DELAY consecutive calls, higher modes immediately when the output current exceeds 
+ * the exit level of the recent mode. The nominal switching frequency is forced while the 
+ * efficiency manager is disabled, while the converter is not running at its nominal reference,
+ * while a loop gain measurement is active and while more than one phase is active. When the event
+ * bus is enabled, the output current is only evaluated when a new sample has been published 
+ * (EVT_ADC_READY), so calls without a new sample are not counted.
+ * ***********************************************************************************************/
+volatile uint16_t efficiency_Manager(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t load = 0;
+    volatile CONTROL_SOFT_START_t* ss = &converter[CONVERTER_VOUT].soft_start;
+    
+    if ((!efficiency.enable) || (ss->step != SOFT_START_STEP_COMPLETE) || (ss->ramp_active) || 
+        (fra.status.flags.active) || (multiphase.active > 1))
+    { return(efficiency_SetMode(EFFICIENCY_MODE_FIXED)); }
+    
+  #if (USE_TASK_MANAGER_EVENT_BUS == 1)
+    if (!task_EventTake(EVENT_SUB_EFFICIENCY, EVENT_MASK(EVT_ADC_READY)))
+    { return(1); } // no new output current sample since the last call
+  #endif
+    
+    load = application.data.i_out;
+    
+    switch (efficiency.mode)
+    {
+        case EFFICIENCY_MODE_FIXED:
+            if (load < EFFICIENCY_REDUCED_ENTER_TICKS)
+            {
+                if (++efficiency.counter >= EFFICIENCY_DELAY)
+                { fres &= efficiency_SetMode(EFFICIENCY_MODE_REDUCED); }
+            }
+            else
+            { efficiency.counter = 0; }
+            break;
+            
+        case EFFICIENCY_MODE_REDUCED:
+            if (load > EFFICIENCY_REDUCED_EXIT_TICKS)
+            { fres &= efficiency_SetMode(EFFICIENCY_MODE_FIXED); }
+            else if ((EFFICIENCY_BURST_ENABLED) && (load < EFFICIENCY_BURST_ENTER_TICKS))
+            {
+                if (++efficiency.counter >= EFFICIENCY_DELAY)
+                { fres &= efficiency_SetMode(EFFICIENCY_MODE_BURST); }
+            }
+            else
+            { efficiency.counter = 0; }
+            break;
+            
+        case EFFICIENCY_MODE_BURST:
+            if (load > EFFICIENCY_REDUCED_EXIT_TICKS)
+            { fres &= efficiency_SetMode(EFFICIENCY_MODE_FIXED); }
+            else if (load > EFFICIENCY_BURST_EXIT_TICKS)
+            { fres &= efficiency_SetMode(EFFICIENCY_MODE_REDUCED); }
+            break;
+            
+        default:
+            fres &= efficiency_SetMode(EFFICIENCY_MODE_FIXED);
+            break;
+    }
+    
+    return(fres);
+}
+
+/*!efficiency_BurstSample
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Pulses are enabled, the control loop is executed
+ *      1: Pulses are skipped, the control loop is not executed
+ * 
+ * Description:
+ * Burst mode comparator called by the control loop interrupt service routine before each loop 
+ * iteration while burst mode is active (see EFFICIENCY_BURST_SKIP()). The outputs of all active 
+ * phases are overridden when the output voltage exceeds the burst band and released when it 
+ * drops below the band, as long as the converter outputs are enabled. Overrides are synchronized
+ * to the start of cycle of each phase.
+ * ***********************************************************************************************/
+volatile uint16_t efficiency_BurstSample(void)
+{
+  #if (EFFICIENCY_BURST_ENABLED)
+    uint16_t i = 0;
+    int16_t feedback = ((int16_t)CVMC_VOUT_ADC_BUFFER - cvmc_vout.InputOffset);
+    int16_t reference = (int16_t)cvmc_vout_reference;
+    
+    if (efficiency.skipping)
+    {
+        if (feedback < (reference - EFFICIENCY_BURST_RESTART_TICKS))
+        {
+            if (multiphase.outputs_enable)
+            {
+                for (i=0; i<multiphase.active; i++)
+                { *multiphase.phase[i].ptrIOCONL &= ~PWM_IOCONL_OVREN; }
+            }
+            efficiency.skipping = false;
+            efficiency.bursts++;
+        }
+    }
+    else if (feedback > (reference + EFFICIENCY_BURST_STOP_TICKS))
+    {
+        for (i=0; i<multiphase.active; i++)
+        { *multiphase.phase[i].ptrIOCONL |= PWM_IOCONL_OVREN; }
+        efficiency.skipping = true;
+    }
+    
+    return((uint16_t)efficiency.skipping);
+  #else
+    return(0);
+  #endif
+}
+
+#if (EFFICIENCY_ENABLED)
+
+/* ************************************************************************************************
+ * Switches from one operating point to another between two control loop iterations. The control 
+ * history is loaded with the recent control output scaled into the new switching period and the
+ * error history is cleared (bumpless transfer, see npnz16b_SelectBank()). The new PWM timing and 
+ * ADC trigger positions are latched at the next start of cycle. The phase current triggers of 
+ * all further phases are counted from the start of cycle of their phase and remain unchanged.
+ * ************************************************************************************************/
+inline volatile uint16_t efficiency_SetPoint(volatile EFFICIENCY_POINT_t* from, volatile EFFICIENCY_POINT_t* to)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile int16_t output = 0;
+    volatile cNPNZ16b_t* controller = &cvmc_vout;
+    
+    __builtin_disi(0x3FFF); // Suspend interrupts of priority levels 1-6
+    
+    from->minimum = controller->MinOutput;
+    from->maximum = controller->MaxOutput;
+    
+    controller->ptrACoefficients = to->bank->ptrACoefficients;
+    controller->ptrBCoefficients = to->bank->ptrBCoefficients;
+    
+    output = (int16_t)(((int32_t)controller->ptrControlHistory[0] * to->period) / from->period);
+    if (output > to->maximum) { output = to->maximum; }
+    else if (output < to->minimum) { output = to->minimum; }
+    
+    for (i = 0; i < controller->ACoefficientsArraySize; i++)
+    { controller->ptrControlHistory[i] = output; }
+    
+    for (i = 0; i < controller->BCoefficientsArraySize; i++)
+    { controller->ptrErrorHistory[i] = 0; }
+    
+    controller->MinOutput = to->minimum;
+    controller->MaxOutput = to->maximum;
+    
+    ADC_PWM_TRIGA = to->fast_trigger;
+    ADC_PWM_TRIGB = to->slow_trigger;
+    
+    fres &= multiphase_SetPeriod(to->period, to->minimum, to->maximum);
+    
+    __builtin_disi(0x0000); // Resume interrupts
+    
+    efficiency.transitions++;
+    
+    return(fres);
+}
+
+/* ************************************************************************************************
+ * Stops the burst mode comparator and releases the outputs of all active phases when pulses are
+ * recently skipped. The comparator is stopped first, so that the outputs are not overridden 
+ * again by the control loop interrupt.
+ * ************************************************************************************************/
+inline volatile uint16_t efficiency_BurstStop(void)
+{
+    volatile uint16_t i = 0;
+    
+    efficiency.burst_active = false;
+    
+    if (efficiency.skipping)
+    {
+        if (multiphase.outputs_enable)
+        {
+            for (i=0; i<multiphase.active; i++)
+            { *multiphase.phase[i].ptrIOCONL &= ~PWM_IOCONL_OVREN; }
+        }
+        efficiency.skipping = false;
+    }
+    
+    return(1);
+}
+
+#endif
+
+// EOF
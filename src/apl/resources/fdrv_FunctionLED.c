@@ -0,0 +1,180 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!fdrv_FunctionLED.c
+ * ****************************************************************************
+ * File:   fdrv_FunctionLED.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the hardware driver of the function LED generating
+ * the LED pattern by a SCCP module in 32-bit output compare mode (see 
+ * USE_FUNCTION_LED_HARDWARE in fdrv_FunctionLED.h).
+ * 
+ * History:
+ * Created on October 14, 2026, 02:00 PM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/resources/fdrv_FunctionLED.h"
+#include "_root/config/task_manager_config.h"
+
+#if (FUNCTION_LED_HARDWARE == 1)
+
+volatile FUNCTION_LED_HARDWARE_t fled_hardware; // Timer counts of the recent LED pattern
+
+/* private function prototypes */
+inline volatile uint16_t fled_HardwareLoad(volatile uint16_t mode, volatile uint32_t period, volatile uint16_t isr_enable);
+
+/*!fled_HardwareInit
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Resets the SCCP module, selects the 32-bit output compare time base clocked by the 
+ * instruction clock and maps the SCCP output to the function LED pin. The module is enabled by
+ * the first call of fled_HardwareApply().
+ * ***********************************************************************************************/
+volatile uint16_t fled_HardwareInit(void)
+{
+    _CCP2IE = 0;
+    _CCP2IF = 0;
+    _CCP2IP = FUNCTION_LED_ISR_PRIORITY;
+    
+    CCP2CON1L = 0; // Module disabled, clock = FOSC/2, prescaler 1:1
+    CCP2CON1H = 0; // No trigger or synchronization source
+    CCP2CON2L = 0;
+    CCP2CON2H = 0; // Output OCM2 disabled
+    CCP2CON3H = 0; // Output active high
+    CCP2CON1Lbits.T32 = 1;  // 32-bit time base
+    CCP2CON1Lbits.CCSEL = 0; // Output compare mode
+    
+    // Compare value of zero: the output changes its level each time the timer restarts
+    CCP2RA = 0;
+    CCP2RB = 0;
+    
+    fled_hardware.on_counts = 0;
+    fled_hardware.off_counts = 0;
+    
+    pps_UnlockIO();
+    pps_RemapOutput(FUNCTION_LED_RP, FUNCTION_LED_PPSOUT_OCM);
+    pps_LockIO();
+    
+    return(1);
+}
+
+/*!fled_HardwareApply
+ * ***********************************************************************************************
+ * Parameters:
+ *      FUNCTION_LED_CONFIG_t* config: LED pattern given in scheduler ticks
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Converts the on-time and period of the LED pattern into SCCP timer counts of the recent 
+ * scheduler timer period and reloads the SCCP module. The compare interrupt is only enabled
+ * when on-time and off-time of the pattern differ. A pattern with zero on-time or zero off-time
+ * statically drives the output to the off or on level.
+ * ***********************************************************************************************/
+volatile uint16_t fled_HardwareApply(volatile FUNCTION_LED_CONFIG_t* config)
+{
+    volatile uint32_t tick;
+    volatile uint16_t on_time, off_time;
+    
+    switch (config->status.flags.mode)
+    {
+        case LEDCTRL_MODE_TOGGLE:
+            on_time = config->on_time;
+            off_time = config->on_time;
+            break;
+        case LEDCTRL_MODE_DUTY_RATIO:
+            on_time = config->on_time;
+            off_time = (config->period > config->on_time) ? (config->period - config->on_time) : 0;
+            break;
+        case LEDCTRL_MODE_ALWAYS_ON:
+            on_time = 1;
+            off_time = 0;
+            break;
+        default:
+            on_time = 0;
+            off_time = 1;
+            break;
+    }
+    
+    // Static patterns do not need any timer period
+    if (on_time == 0)
+    { return(fled_HardwareLoad(FUNCTION_LED_CCP_MOD_STATIC(LED_OFF), 0xFFFFFFFF, false)); }
+    if (off_time == 0)
+    { return(fled_HardwareLoad(FUNCTION_LED_CCP_MOD_STATIC(LED_ON), 0xFFFFFFFF, false)); }
+    
+    tick = ((uint32_t)TASK_MGR_TIMER_PERIOD_REGISTER + 1); // SCCP timer counts per scheduler tick
+    fled_hardware.on_counts = ((uint32_t)on_time * tick) - 1;
+    fled_hardware.off_counts = ((uint32_t)off_time * tick) - 1;
+    
+    return(fled_HardwareLoad(FUNCTION_LED_CCP_MOD_TOGGLE, fled_hardware.off_counts, 
+                (fled_hardware.on_counts != fled_hardware.off_counts)));
+}
+
+/*!fled_HardwareLoad
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t mode: output compare mode (see FUNCTION_LED_CCP_MOD_xxx)
+ *      uint32_t period: SCCP timer period 
+ *      uint16_t isr_enable: enables the compare interrupt alternating on-time and off-time
+ * 
+ * Description:
+ * Stops the SCCP module, loads output compare mode and timer period and restarts the module 
+ * with the output enabled.
+ * ***********************************************************************************************/
+inline volatile uint16_t fled_HardwareLoad(volatile uint16_t mode, volatile uint32_t period, volatile uint16_t isr_enable)
+{
+    _CCP2IE = 0;
+    CCP2CON1Lbits.CCPON = 0;
+    _CCP2IF = 0;
+    
+    CCP2CON1Lbits.MOD = mode;
+    CCP2TMRL = 0;
+    CCP2TMRH = 0;
+    CCP2PRL = (uint16_t)(period & 0xFFFF);
+    CCP2PRH = (uint16_t)(period >> 16);
+    
+    CCP2CON2Hbits.OCAEN = 1; // Enable output OCM2
+    _CCP2IE = (isr_enable != 0);
+    CCP2CON1Lbits.CCPON = 1;
+    
+    return(1);
+}
+
+#endif
+
+// EOF
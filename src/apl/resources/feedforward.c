@@ -0,0 +1,216 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!feedforward.c
+ * ****************************************************************************
+ * File:   feedforward.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the lookup tables, the table interpolation task 
+ * and the duty cycle calculation of the feed-forward stage of the output 
+ * voltage control loop (see feedforward.h).
+ * 
+ * History:
+ * Created on October 14, 2026, 02:00 PM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/resources/feedforward.h"
+
+volatile FEEDFORWARD_t feedforward; // Feed-forward stage of the output voltage control loop
+
+/* private function prototypes */
+inline volatile int16_t feedforward_Interpolate(const int16_t* lut, volatile uint16_t size, 
+                volatile uint16_t value, volatile uint16_t range, volatile uint32_t scaler);
+
+#if (FEEDFORWARD_VIN == 1)
+// Input voltage gain factors VIN_NOMINAL / v_in (Q14)
+#define FEEDFORWARD_VIN_LUT_ENTRY(n)    FEEDFORWARD_VIN_LUT_GAIN(n)
+const int16_t feedforward_vin_lut[FEEDFORWARD_VIN_LUT_SIZE + 1] = { 
+    FEEDFORWARD_LUT_32(FEEDFORWARD_VIN_LUT_ENTRY) 
+};
+#endif
+
+#if (FEEDFORWARD_DEAD_TIME == 1)
+// Dead-time compensation by output current in PWM ticks
+#define FEEDFORWARD_DT_LUT_ENTRY(n)     FEEDFORWARD_DT_LUT_TICKS(n)
+const int16_t feedforward_dt_lut[FEEDFORWARD_DT_LUT_SIZE + 1] = { 
+    FEEDFORWARD_LUT_16(FEEDFORWARD_DT_LUT_ENTRY) 
+};
+#endif
+
+/*!feedforward_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      cNPNZ16b_t* controller: control loop object writing the normalized control output
+ *      uint16_t* ptrTarget: duty cycle written by the feed-forward stage
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine binds the feed-forward stage to the control loop. The control loop output is 
+ * redirected into feedforward.control_output. Gain and dead-time compensation are reset to 
+ * unity and zero until the first call of feedforward_Update().
+ * ***********************************************************************************************/
+volatile uint16_t feedforward_Init(volatile cNPNZ16b_t* controller, volatile uint16_t* ptrTarget)
+{
+    feedforward.gain = FEEDFORWARD_GAIN_UNITY;
+    feedforward.dead_time = 0;
+    feedforward.control_output = *ptrTarget;
+    feedforward.ptrTarget = ptrTarget;
+    feedforward.ptrController = controller;
+    controller->ptrTargetRegister = &feedforward.control_output;
+    
+    return(1);
+}
+
+/*!feedforward_Update
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Task function interpolating the gain factor of the recent input voltage and the dead-time 
+ * compensation of the recent output current from the lookup tables. Both values are written 
+ * by single 16-bit accesses and are applied by the next control loop iteration.
+ * ***********************************************************************************************/
+volatile uint16_t feedforward_Update(void)
+{
+  #if (FEEDFORWARD_VIN == 1)
+    volatile uint16_t v_in = application.data.v_in;
+    
+    if (v_in > FEEDFORWARD_VIN_LUT_START_TICKS) 
+    { v_in -= FEEDFORWARD_VIN_LUT_START_TICKS; }
+    else 
+    { v_in = 0; }
+    
+    feedforward.gain = feedforward_Interpolate(&feedforward_vin_lut[0], FEEDFORWARD_VIN_LUT_SIZE, 
+                v_in, FEEDFORWARD_VIN_LUT_RANGE_TICKS, FEEDFORWARD_VIN_LUT_SCALER);
+  #endif
+    
+  #if (FEEDFORWARD_DEAD_TIME == 1)
+    feedforward.dead_time = feedforward_Interpolate(&feedforward_dt_lut[0], FEEDFORWARD_DT_LUT_SIZE, 
+                application.data.i_out, FEEDFORWARD_DT_LUT_RANGE_TICKS, FEEDFORWARD_DT_LUT_SCALER);
+  #endif
+    
+    return(1);
+}
+
+/*!feedforward_Apply
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Called by the control loop interrupt service routine after each loop iteration. Scales the 
+ * normalized control output by the input voltage gain factor, adds the dead-time compensation
+ * and writes the result, clamped to the output limits of the control loop, into the duty cycle.
+ * The duty cycle is left unchanged while the control loop is disabled.
+ * 
+ * Please note:
+ * The control loop clamps its normalized output to the same limits. At input voltages below 
+ * VIN_NOMINAL, the duty cycle limit may be reached before the control output saturates. 
+ * ***********************************************************************************************/
+volatile uint16_t feedforward_Apply(void)
+{
+    int16_t duty = 0;
+    
+    if (!feedforward.ptrController->status.flags.enable)
+    { return(1); } // Duty cycle is not controlled while the control loop is disabled
+    
+    duty = (int16_t)(((int32_t)(int16_t)feedforward.control_output * feedforward.gain) >> FEEDFORWARD_GAIN_SHIFT);
+    duty += feedforward.dead_time;
+    
+    if (duty < feedforward.ptrController->MinOutput) { duty = feedforward.ptrController->MinOutput; }
+    else if (duty > feedforward.ptrController->MaxOutput) { duty = feedforward.ptrController->MaxOutput; }
+    
+    *feedforward.ptrTarget = (uint16_t)duty;
+    
+    return(1);
+}
+
+/*!feedforward_Normalize
+ * ***********************************************************************************************
+ * Parameters:
+ *      int16_t duty: duty cycle in PWM ticks
+ * 
+ * Return:
+ *      type: int16_t
+ *      normalized control output resulting in the given duty cycle
+ * 
+ * Description:
+ * Inverse of feedforward_Apply(), used to preload the control loop histories with a given duty
+ * cycle (e.g. pre-bias startup). Executed in task context.
+ * ***********************************************************************************************/
+volatile int16_t feedforward_Normalize(volatile int16_t duty)
+{
+    volatile int32_t output = ((int32_t)(duty - feedforward.dead_time) << FEEDFORWARD_GAIN_SHIFT);
+    
+    if (feedforward.gain > 0)
+    { output /= feedforward.gain; }
+    
+    if (output < feedforward.ptrController->MinOutput) { output = feedforward.ptrController->MinOutput; }
+    else if (output > feedforward.ptrController->MaxOutput) { output = feedforward.ptrController->MaxOutput; }
+    
+    return((int16_t)output);
+}
+
+/* ************************************************************************************************
+ * Interpolates a lookup table of (size + 1) equidistant entries at the given value. Values 
+ * above range return the last entry.
+ * ************************************************************************************************/
+inline volatile int16_t feedforward_Interpolate(const int16_t* lut, volatile uint16_t size, 
+                volatile uint16_t value, volatile uint16_t range, volatile uint32_t scaler)
+{
+    volatile uint16_t position = 0, index = 0, fraction = 0;
+    
+    if (value >= range)
+    { return(lut[size]); }
+    
+    position = (uint16_t)(((uint32_t)value * scaler) >> 16);
+    index = (position >> 8);
+    fraction = (position & 0x00FF);
+    
+    if (index >= size)
+    { return(lut[size]); }
+    
+    return((int16_t)(lut[index] + (((int32_t)(lut[index + 1] - lut[index]) * (int16_t)fraction) >> 8)));
+}
+
+// EOF
@@ -0,0 +1,361 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!multiphase.c
+ * ****************************************************************************
+ * File:   multiphase.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the phase descriptors, the current sharing routine
+ * and the phase manager of the interleaved power converter (see multiphase.h).
+ * 
+ * History:
+ * Created on October 14, 2026, 02:00 PM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "apl/apl.h"
+#include "apl/resources/multiphase.h"
+
+volatile MULTIPHASE_t multiphase; // Interleaved converter phase descriptors
+
+/* private function prototypes */
+volatile uint16_t multiphase_InitPhase(volatile MULTIPHASE_PHASE_t* phase, volatile uint16_t generator, 
+                volatile uint16_t* ptrCurrentSense);
+
+/*!multiphase_Init
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine links the PWM generator registers and current sense ADC buffers to the phase
+ * descriptors. All phases are active with the nominal phase shift PWM_PHASE_SHIFT set by 
+ * init_pwm(). Outputs remain overridden until multiphase_EnableOutputs() is called.
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_Init(void)
+{
+    volatile uint16_t fres = 1;
+    
+  #if (CONVERTER_PHASES > 1)
+    fres &= multiphase_InitPhase(&multiphase.phase[0], PWM_PHASE_GENERATOR_1, &ADC_SLOW_ADCBUF(ADC_PHASE_CS_1));
+    fres &= multiphase_InitPhase(&multiphase.phase[1], PWM_PHASE_GENERATOR_2, &ADC_SLOW_ADCBUF(ADC_PHASE_CS_2));
+  #else
+    fres &= multiphase_InitPhase(&multiphase.phase[0], PWM_PHASE_GENERATOR_1, NULL);
+  #endif
+  #if (CONVERTER_PHASES > 2)
+    fres &= multiphase_InitPhase(&multiphase.phase[2], PWM_PHASE_GENERATOR_3, &ADC_SLOW_ADCBUF(ADC_PHASE_CS_3));
+  #endif
+  #if (CONVERTER_PHASES > 3)
+    fres &= multiphase_InitPhase(&multiphase.phase[3], PWM_PHASE_GENERATOR_4, &ADC_SLOW_ADCBUF(ADC_PHASE_CS_4));
+  #endif
+    
+    multiphase.duty_cycle = PWM_DUTY_CYCLE_INIT;
+    multiphase.minimum = (int16_t)PWM_DUTY_CYCLE_MIN;
+    multiphase.maximum = (int16_t)PWM_DUTY_CYCLE_MAX;
+    multiphase.period = PWM_PERIOD;
+    multiphase.active = CONVERTER_PHASES;
+    multiphase.phase_shift = PWM_PHASE_SHIFT;
+    multiphase.shed_counter = 0;
+    multiphase.sharing_enable = (bool)((MULTIPHASE_SHARING == 1) && (CONVERTER_PHASES > 1));
+    multiphase.shedding_enable = (bool)((MULTIPHASE_SHEDDING == 1) && (CONVERTER_PHASES > 1));
+    multiphase.outputs_enable = false;
+    
+    return(fres);
+}
+
+/*!multiphase_Distribute
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * Description:
+ * This routine is called by the control loop interrupt service routine after each iteration.
+ * The current sharing correction of each active phase is updated and the common duty cycle 
+ * plus correction is written into the PGxDC register of this phase. The write latches the new 
+ * duty cycle at the next start of cycle of this phase (see init_pwm.h). Shed phases follow the
+ * common duty cycle without correction, so that they can be added back at any time.
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_Distribute(void)
+{
+    uint16_t i = 0, n = multiphase.active;
+    int16_t sum = 0, duty = 0;
+    int32_t limit = ((int32_t)MULTIPHASE_CORRECTION_LIMIT << MULTIPHASE_SHARING_SHIFT);
+    volatile MULTIPHASE_PHASE_t* phase;
+    
+    if (multiphase.sharing_enable)
+    {
+        for (i=0; i<n; i++)
+        { sum += (int16_t)(*multiphase.phase[i].ptrCurrentSense); }
+    }
+    
+    for (i=0; i<CONVERTER_PHASES; i++)
+    {
+        phase = &multiphase.phase[i];
+        
+        if ((multiphase.sharing_enable) && (i < n))
+        {
+            phase->sharing_integrator += (int32_t)(sum - (int16_t)(n * (*phase->ptrCurrentSense)));
+            if (phase->sharing_integrator > limit) { phase->sharing_integrator = limit; }
+            else if (phase->sharing_integrator < -limit) { phase->sharing_integrator = -limit; }
+            phase->correction = (int16_t)(phase->sharing_integrator >> MULTIPHASE_SHARING_SHIFT);
+        }
+        
+        duty = ((int16_t)multiphase.duty_cycle + phase->correction);
+        if (duty > multiphase.maximum) { duty = multiphase.maximum; }
+        else if (duty < multiphase.minimum) { duty = multiphase.minimum; }
+        
+        *phase->ptrDutyCycle = (uint16_t)duty;
+    }
+    
+    return(1);
+}
+
+/*!multiphase_SetActivePhases
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t phases: number of active phases (1...CONVERTER_PHASES)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (number of phases out of range)
+ *      1: Success
+ * 
+ * Description:
+ * Phases above the given number are shed: their outputs are overridden LOW and their current 
+ * sharing correction is cleared. The phase shift between the remaining phases is set to 
+ * the recent switching period / phases by the PGxTRIGC registers of the preceding phases, which are latched at 
+ * the next start of cycle.
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_SetActivePhases(volatile uint16_t phases)
+{
+    volatile uint16_t i = 0;
+    volatile MULTIPHASE_PHASE_t* phase;
+    
+    if ((phases < 1) || (phases > CONVERTER_PHASES))
+    { return(0); }
+    
+    // Shed phases are overridden before the remaining phases are moved
+    for (i=phases; i<CONVERTER_PHASES; i++)
+    {
+        phase = &multiphase.phase[i];
+        *phase->ptrIOCONL |= PWM_IOCONL_OVREN;
+        phase->sharing_integrator = 0;
+        phase->correction = 0;
+        phase->enabled = false;
+    }
+    
+    multiphase.phase_shift = (multiphase.period / phases);
+    
+    for (i=0; i<phases; i++)
+    {
+        phase = &multiphase.phase[i];
+        *phase->ptrTriggerC = multiphase.phase_shift;
+        *phase->ptrStatus |= PWM_STAT_UPDREQ; // Latch new phase shift at next SOC
+        phase->enabled = true;
+    }
+    
+    multiphase.active = phases;
+    
+    // Overrides of added phases are released at their next start of cycle
+    if (multiphase.outputs_enable)
+    {
+        for (i=0; i<phases; i++)
+        { *multiphase.phase[i].ptrIOCONL &= ~PWM_IOCONL_OVREN; }
+    }
+    
+    return(1);
+}
+
+/*!multiphase_SetPeriod
+ * ***********************************************************************************************
+ * Parameters:
+ *      uint16_t period: new switching period of all phases in PWM ticks
+ *      int16_t minimum: duty cycle minimum at the new switching period in PWM ticks
+ *      int16_t maximum: duty cycle maximum at the new switching period in PWM ticks
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure (invalid period)
+ *      1: Success
+ * 
+ * Description:
+ * Changes the switching period of all phases. The duty cycles of all phases are scaled by the 
+ * ratio of new and recent period to maintain the duty ratio, the phase shift of the active phases
+ * is set to period / active phases. All registers are latched at the next start of cycle. 
+ * 
+ * Every control loop iteration requests an update of the duty cycle register, which might latch
+ * the new period before the scaled duty cycle has been written (or vice versa). Period and duty 
+ * cycle are therefore written in the order resulting in the lower duty ratio for this one cycle:
+ * the period first when it is increased, the duty cycle first when it is decreased.
+ * 
+ * Please note:
+ * This routine has to be called while the control loop interrupt is suspended (DISI) and the
+ * control loop output has to be scaled accordingly (see efficiency_SetMode()).
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_SetPeriod(volatile uint16_t period, volatile int16_t minimum, volatile int16_t maximum)
+{
+    volatile uint16_t i = 0;
+    volatile int16_t duty = 0;
+    volatile MULTIPHASE_PHASE_t* phase;
+    
+    if ((period == 0) || (multiphase.period == 0))
+    { return(0); }
+    
+    multiphase.phase_shift = (period / multiphase.active);
+    
+    for (i=0; i<CONVERTER_PHASES; i++)
+    {
+        phase = &multiphase.phase[i];
+        
+        duty = (int16_t)(((int32_t)*phase->ptrDutyCycle * period) / multiphase.period);
+        if (duty > maximum) { duty = maximum; }
+        else if (duty < minimum) { duty = minimum; }
+        
+        if (period > multiphase.period)
+        { *phase->ptrPeriod = period; *phase->ptrDutyCycle = (uint16_t)duty; }
+        else
+        { *phase->ptrDutyCycle = (uint16_t)duty; *phase->ptrPeriod = period; }
+        
+        if (i < multiphase.active)
+        { *phase->ptrTriggerC = multiphase.phase_shift; }
+        *phase->ptrStatus |= PWM_STAT_UPDREQ; // Latch new timing at next SOC
+    }
+    
+    multiphase.duty_cycle = (uint16_t)(((uint32_t)multiphase.duty_cycle * period) / multiphase.period);
+    multiphase.minimum = minimum;
+    multiphase.maximum = maximum;
+    multiphase.period = period;
+    
+    return(1);
+}
+
+/*!multiphase_EnableOutputs
+ * ***********************************************************************************************
+ * Parameters:
+ *      bool enable: true = outputs of active phases are released, false = all outputs overridden
+ * 
+ * Return:
+ *      type: uint16_t
+ *      1: Success
+ * 
+ * Description:
+ * Hands the outputs of all active phases over to their PWM generators or overrides the outputs
+ * of all phases LOW. Overrides are synchronized to the start of cycle of each phase.
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_EnableOutputs(volatile bool enable)
+{
+    volatile uint16_t i = 0;
+    
+    multiphase.outputs_enable = enable;
+    
+    for (i=0; i<CONVERTER_PHASES; i++)
+    {
+        if ((enable) && (multiphase.phase[i].enabled))
+        { *multiphase.phase[i].ptrIOCONL &= ~PWM_IOCONL_OVREN; }
+        else
+        { *multiphase.phase[i].ptrIOCONL |= PWM_IOCONL_OVREN; }
+    }
+    
+    return(1);
+}
+
+/*!multiphase_PhaseManager
+ * ***********************************************************************************************
+ * Parameters:
+ *      (none)
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * Scheduler task adding and shedding phases based on the output current. Phases are added 
+ * immediately when the load exceeds the adding level to support load steps. Shedding is 
+ * delayed by MULTIPHASE_SHED_DELAY calls to prevent toggling at load levels close to the 
+ * shedding threshold (see MULTIPHASE_SHEDDING).
+ * ***********************************************************************************************/
+volatile uint16_t multiphase_PhaseManager(void)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t load = 0;
+    
+    if (!multiphase.shedding_enable)
+    { return(1); }
+    
+    load = application.data.i_out;
+    
+    if ((multiphase.active < CONVERTER_PHASES) && 
+        (load > (multiphase.active * MULTIPHASE_ADD_TICKS)))
+    {
+        fres &= multiphase_SetActivePhases(multiphase.active + 1);
+        multiphase.shed_counter = 0;
+    }
+    else if ((multiphase.active > 1) && 
+        (load < ((multiphase.active - 1) * MULTIPHASE_SHED_TICKS)))
+    {
+        if (++multiphase.shed_counter >= MULTIPHASE_SHED_DELAY)
+        {
+            fres &= multiphase_SetActivePhases(multiphase.active - 1);
+            multiphase.shed_counter = 0;
+        }
+    }
+    else
+    {
+        multiphase.shed_counter = 0;
+    }
+    
+    return(fres);
+}
+
+/* ************************************************************************************************
+ * Links the registers of one PWM generator and its current sense ADC buffer to a phase descriptor
+ * ************************************************************************************************/
+volatile uint16_t multiphase_InitPhase(volatile MULTIPHASE_PHASE_t* phase, volatile uint16_t generator, 
+                volatile uint16_t* ptrCurrentSense)
+{
+    phase->ptrDutyCycle = &PWM_PGx(DC, generator);
+    phase->ptrPeriod = &PWM_PGx(PER, generator);
+    phase->ptrTriggerC = &PWM_PGx(TRIGC, generator);
+    phase->ptrStatus = &PWM_PGx(STAT, generator);
+    phase->ptrIOCONL = &PWM_PGx(IOCONL, generator);
+    phase->ptrCurrentSense = ptrCurrentSense;
+    phase->sharing_integrator = 0;
+    phase->correction = 0;
+    phase->enabled = true;
+    
+    return(1);
+}
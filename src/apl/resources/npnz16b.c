@@ -0,0 +1,148 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!npnz16b.c
+ * ****************************************************************************
+ * File:   npnz16b.c
+ * Author: M91406
+ *
+ * Description:
+ * This source file provides the generic coefficient bank switch-over and gain 
+ * scheduler of nPnZ controller objects (cNPNZ16b_t). Coefficient banks are 
+ * selected by an operating point variable, such as input voltage or load current. 
+ * 
+ * History:
+ * Created on October 14, 2026, 11:00 AM
+ ******************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "apl/resources/npnz16b.h"
+
+/*!npnz16b_SelectBank
+ * ***********************************************************************************************
+ * Parameters:
+ *      cNPNZ16b_t* controller: control loop object
+ *      NPNZ16B_COEFF_BANK_t* bank: coefficient bank to be loaded
+ *      bool bumpless: true = bumpless transfer of the histories, false = histories are kept
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine swaps the coefficient pointers of the given control loop object. Interrupts are
+ * suspended for the few instruction cycles of the swap (DISI), which delays the control loop 
+ * interrupt, if pending, until both pointers have been updated. A control loop iteration 
+ * therefore always uses coefficients of one bank, and the swap takes effect between two 
+ * ADC samples.
+ * 
+ * When bumpless transfer is enabled, the control history is filled with the most recent 
+ * control output and the error history is cleared. As the A-coefficients of an integrating 
+ * compensator add up to one, the first output of the new bank continues from the most recent 
+ * output instead of applying the error history of the previous bank with the new gains.
+ * ***********************************************************************************************/
+volatile uint16_t npnz16b_SelectBank(volatile cNPNZ16b_t* controller, 
+                volatile NPNZ16B_COEFF_BANK_t* bank, volatile bool bumpless)
+{
+    volatile uint16_t i = 0;
+    volatile int16_t output = 0;
+
+    if ((controller == NULL) || (bank == NULL))
+    { return(0); }
+    
+    __builtin_disi(0x3FFF); // Suspend interrupts of priority levels 1-6
+    
+    controller->ptrACoefficients = bank->ptrACoefficients;
+    controller->ptrBCoefficients = bank->ptrBCoefficients;
+    
+    if (bumpless)
+    {
+        output = controller->ptrControlHistory[0];
+        
+        for (i = 0; i < controller->ACoefficientsArraySize; i++)
+        { controller->ptrControlHistory[i] = output; }
+
+        for (i = 0; i < controller->BCoefficientsArraySize; i++)
+        { controller->ptrErrorHistory[i] = 0; }
+    }
+    
+    __builtin_disi(0x0000); // Resume interrupts
+    
+    return(1);
+}
+
+/*!npnz16b_GainScheduler
+ * ***********************************************************************************************
+ * Parameters:
+ *      cNPNZ16b_t* controller: control loop object
+ *      NPNZ16B_GAIN_SCHEDULER_t* scheduler: gain scheduler of the control loop
+ * 
+ * Return:
+ *      type: uint16_t
+ *      0: Failure
+ *      1: Success
+ * 
+ * Description:
+ * This routine compares the scheduling variable against the thresholds of the coefficient 
+ * banks and switches to the next higher or lower bank, when the scheduling variable has left 
+ * the range of the recently active bank by more than the hysteresis. Only one bank step is 
+ * performed per call.
+ * ***********************************************************************************************/
+volatile uint16_t npnz16b_GainScheduler(volatile cNPNZ16b_t* controller, 
+                volatile NPNZ16B_GAIN_SCHEDULER_t* scheduler)
+{
+    volatile uint16_t fres = 1;
+    volatile uint16_t value = 0;
+    volatile uint16_t index = 0;
+    
+    if (!scheduler->enable)
+    { return(1); }
+    
+    if ((scheduler->ptrSchedulingVariable == NULL) || (scheduler->ptrBanks == NULL) || 
+        (scheduler->active >= scheduler->banks))
+    { return(0); }
+    
+    value = *scheduler->ptrSchedulingVariable;
+    index = scheduler->active;
+    
+    if ((index < (scheduler->banks - 1)) && 
+        (value > (scheduler->ptrBanks[index].upper_threshold + scheduler->hysteresis)))
+    { index++; }
+    else if ((index > 0) && 
+        ((value + scheduler->hysteresis) < scheduler->ptrBanks[index - 1].upper_threshold))
+    { index--; }
+    
+    if (index != scheduler->active)
+    {
+        fres &= npnz16b_SelectBank(controller, &scheduler->ptrBanks[index], scheduler->bumpless);
+        scheduler->active = index;
+        scheduler->switch_count++;
+    }
+    
+    return(fres);
+}
+
+// EOF
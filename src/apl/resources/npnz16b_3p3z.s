@@ -0,0 +1,169 @@
+; LICENSE ********************************************************************
+; Microchip Technology Inc. and its subsidiaries.  You may use this software 
+; and any derivatives exclusively with Microchip products. 
+; 
+; THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+; EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+; WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+; PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+; WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+;
+; IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+; INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+; WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+; BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+; FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+; IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+; ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+;
+; MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+; TERMS. 
+; ****************************************************************************
+;
+; File:   npnz16b_3p3z.s
+; Author: M91406
+;
+; Description:
+; Hand-optimized 3P3Z compensator kernel operating on the generic nPnZ controller 
+; object cNPNZ16b_t (see h/apl/resources/npnz16b.h). Coefficients are fetched from 
+; X-space (W8), histories from Y-space (W10) by the operand prefetch of the MAC 
+; instruction while both accumulators are used for the B- and A-terms.
+;
+; The kernel is designed to be called from a control loop interrupt service routine 
+; running on an alternate working register set (C attribute 'context'). W0...W7 and 
+; the accumulators are therefore not saved. W8 and W10 are preserved as required by 
+; the compiler calling conventions.
+;
+; Worst-case execution time (enabled, one clamping event):
+;   Kernel incl. CALL/RETURN ............................ 73 instruction cycles
+;   (1 cycle per instruction, BRA taken = 2, BTSS skip = 2, PUSH.D/POP.D = 2, 
+;    CALL = 2, RETURN = 3)
+; At 100 MIPS this equals 0.73 us or about 22% of the 3.33 us sampling period at 
+; 300 kHz. The actual execution time of each loop iteration including interrupt entry 
+; and exit is captured by the cycle meter of the control loop (e.g. cvmc_vout_cycles).
+;
+; History:
+; Created on October 14, 2026, 11:00 AM
+; ******************************************************************************
+
+    .include "xc.inc"
+
+; cNPNZ16b_t data structure offsets
+    .equ NPNZ16B_STATUS,            0   ; Status word (bit 15 = enable)
+    .equ NPNZ16B_PTR_SOURCE,        2   ; Pointer to feedback source register
+    .equ NPNZ16B_PTR_TARGET,        4   ; Pointer to control output target register
+    .equ NPNZ16B_PTR_REFERENCE,     6   ; Pointer to control reference
+    .equ NPNZ16B_PTR_A_COEFF,       8   ; Pointer to A-coefficients (X-space)
+    .equ NPNZ16B_PTR_B_COEFF,       10  ; Pointer to B-coefficients (X-space)
+    .equ NPNZ16B_PTR_CTRL_HIST,     12  ; Pointer to control history (Y-space)
+    .equ NPNZ16B_PTR_ERROR_HIST,    14  ; Pointer to error history (Y-space)
+    .equ NPNZ16B_PRESHIFT,          20  ; Normalization of the feedback value
+    .equ NPNZ16B_POSTSHIFT_A,       22  ; Scaling of the A-term result
+    .equ NPNZ16B_POSTSHIFT_B,       24  ; Scaling of the B-term result
+    .equ NPNZ16B_INPUT_OFFSET,      26  ; Feedback offset
+    .equ NPNZ16B_MIN_OUTPUT,        28  ; Control output clamping minimum
+    .equ NPNZ16B_MAX_OUTPUT,        30  ; Control output clamping maximum
+
+    .equ NPNZ16B_STATUS_LSAT,       0   ; Lower saturation event flag bit
+    .equ NPNZ16B_STATUS_USAT,       1   ; Upper saturation event flag bit
+    .equ NPNZ16B_STATUS_ENABLE,     15  ; Enable bit
+
+    .section .text
+
+; ******************************************************************************
+; void npnz16b_Update3p3z(volatile cNPNZ16b_t* controller)
+;
+; Input:  W0 = pointer to controller object
+; Uses:   W1...W5, W8, W10, ACCA, ACCB
+; ******************************************************************************
+    .global _npnz16b_Update3p3z
+_npnz16b_Update3p3z:                                ; cycles (CALL: 2)
+
+    mov [w0 + NPNZ16B_STATUS], w3                   ; 1  read status word
+    btss w3, #NPNZ16B_STATUS_ENABLE                 ; 1 (2) skip return if enabled
+    return
+    push.d w8                                       ; 2  preserve X-prefetch pointer
+    push.d w10                                      ; 2  preserve Y-prefetch pointer
+
+; Normalized error e[n] = (reference - (feedback - offset)) << preshift
+    mov [w0 + NPNZ16B_PTR_SOURCE], w1               ; 1
+    mov [w1], w1                                    ; 1  read feedback value
+    mov [w0 + NPNZ16B_INPUT_OFFSET], w2             ; 1
+    sub w1, w2, w1                                  ; 1  remove feedback offset
+    mov [w0 + NPNZ16B_PTR_REFERENCE], w2            ; 1
+    mov [w2], w2                                    ; 1  read reference
+    sub w2, w1, w1                                  ; 1  error = reference - feedback
+    mov [w0 + NPNZ16B_PRESHIFT], w2                 ; 1
+    sl w1, w2, w1                                   ; 1  normalize error into Q15
+
+; Error history e[n-3] = e[n-2], e[n-2] = e[n-1], e[n-1] = e[n], e[n] = error
+    mov [w0 + NPNZ16B_PTR_ERROR_HIST], w10          ; 1
+    mov [w10 + 4], w2                               ; 1
+    mov w2, [w10 + 6]                               ; 1
+    mov [w10 + 2], w2                               ; 1
+    mov w2, [w10 + 4]                               ; 1
+    mov [w10], w2                                   ; 1
+    mov w2, [w10 + 2]                               ; 1
+    mov w1, [w10]                                   ; 1
+
+; B-term: B0 e[n] + B1 e[n-1] + B2 e[n-2] + B3 e[n-3] in ACCB
+    mov [w0 + NPNZ16B_PTR_B_COEFF], w8              ; 1
+    clr b, [w8]+=2, w4, [w10]+=2, w5                ; 1  prefetch B0, e[n]
+    mac w4*w5, b, [w8]+=2, w4, [w10]+=2, w5         ; 1  B0 e[n], prefetch B1, e[n-1]
+    mac w4*w5, b, [w8]+=2, w4, [w10]+=2, w5         ; 1  B1 e[n-1], prefetch B2, e[n-2]
+    mac w4*w5, b, [w8]+=2, w4, [w10]+=2, w5         ; 1  B2 e[n-2], prefetch B3, e[n-3]
+    mac w4*w5, b                                    ; 1  B3 e[n-3]
+    mov [w0 + NPNZ16B_POSTSHIFT_B], w2              ; 1
+    neg w2, w2                                      ; 1  negative shift = left shift
+    sftac b, w2                                     ; 1  scale B-term
+
+; A-term: A1 y[n-1] + A2 y[n-2] + A3 y[n-3] in ACCA
+    mov [w0 + NPNZ16B_PTR_A_COEFF], w8              ; 1
+    mov [w0 + NPNZ16B_PTR_CTRL_HIST], w10           ; 1
+    clr a, [w8]+=2, w4, [w10]+=2, w5                ; 1  prefetch A1, y[n-1]
+    mac w4*w5, a, [w8]+=2, w4, [w10]+=2, w5         ; 1  A1 y[n-1], prefetch A2, y[n-2]
+    mac w4*w5, a, [w8]+=2, w4, [w10]+=2, w5         ; 1  A2 y[n-2], prefetch A3, y[n-3]
+    mac w4*w5, a                                    ; 1  A3 y[n-3]
+    mov [w0 + NPNZ16B_POSTSHIFT_A], w2              ; 1
+    neg w2, w2                                      ; 1  negative shift = left shift
+    sftac a, w2                                     ; 1  scale A-term
+
+; Control output y[n] = A-term + B-term
+    add a                                           ; 1  ACCA = ACCA + ACCB
+    sac.r a, #0, w1                                 ; 1  rounded control output
+
+; Output clamping (anti-windup)
+    bclr w3, #NPNZ16B_STATUS_LSAT                   ; 1
+    bclr w3, #NPNZ16B_STATUS_USAT                   ; 1
+    mov [w0 + NPNZ16B_MIN_OUTPUT], w2               ; 1
+    cp w1, w2                                       ; 1
+    bra ge, 1f                                      ; 1 (2)
+    mov w2, w1                                      ; 1  clamp to minimum
+    bset w3, #NPNZ16B_STATUS_LSAT                   ; 1
+1:  mov [w0 + NPNZ16B_MAX_OUTPUT], w2               ; 1
+    cp w1, w2                                       ; 1
+    bra le, 2f                                      ; 1 (2)
+    mov w2, w1                                      ; 1  clamp to maximum
+    bset w3, #NPNZ16B_STATUS_USAT                   ; 1
+2:  mov w3, [w0 + NPNZ16B_STATUS]                   ; 1  update saturation flags
+
+; Control history y[n-3] = y[n-2], y[n-2] = y[n-1], y[n-1] = y[n]
+    mov [w0 + NPNZ16B_PTR_CTRL_HIST], w10           ; 1
+    mov [w10 + 2], w2                               ; 1
+    mov w2, [w10 + 4]                               ; 1
+    mov [w10], w2                                   ; 1
+    mov w2, [w10 + 2]                               ; 1
+    mov w1, [w10]                                   ; 1
+
+; Write control output to target register
+    mov [w0 + NPNZ16B_PTR_TARGET], w2               ; 1
+    mov w1, [w2]                                    ; 1
+
+    pop.d w10                                       ; 2
+    pop.d w8                                        ; 2
+    return                                          ; 3
+
+; ******************************************************************************
+    .end
+
+; EOF
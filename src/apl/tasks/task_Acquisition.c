@@ -0,0 +1,157 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Acquisition.c
+ * *****************************************************************************
+ * File:   task_Acquisition.c
+ * Author: M91406
+ *
+ * Description:
+ * Collects the slow ADC channels into a double-buffered snapshot and 
+ * publishes the most recent values in the application data structure.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_Acquisition.h"
+
+// ADC channel ready bit masks of the slow channels (ADSTATL/ADSTATH)
+#define ADC_AN_MASK_L(an)   (((an) < 16) ? (1 << ((an) & 0x0F)) : 0)
+#define ADC_AN_MASK_H(an)   (((an) >= 16) ? (1 << ((an) & 0x0F)) : 0)
+
+#define ADC_SLOW_MASK_L     (ADC_AN_MASK_L(ADC_SLOW_AN_INPUT(ADC_SLOW_VIN)) | ADC_AN_MASK_L(ADC_SLOW_AN_INPUT(ADC_SLOW_IIN)) | \
+                             ADC_AN_MASK_L(ADC_SLOW_AN_INPUT(ADC_SLOW_IOUT)) | ADC_AN_MASK_L(ADC_SLOW_AN_INPUT(ADC_SLOW_TEMP)))
+#define ADC_SLOW_MASK_H     (ADC_AN_MASK_H(ADC_SLOW_AN_INPUT(ADC_SLOW_VIN)) | ADC_AN_MASK_H(ADC_SLOW_AN_INPUT(ADC_SLOW_IIN)) | \
+                             ADC_AN_MASK_H(ADC_SLOW_AN_INPUT(ADC_SLOW_IOUT)) | ADC_AN_MASK_H(ADC_SLOW_AN_INPUT(ADC_SLOW_TEMP)))
+
+volatile ADC_ACQUISITION_t adc_acquisition;
+
+/*!init_Acquisition
+ * ***********************************************************************************************
+ * Description:
+ * Resets the snapshot buffers. The ADC module itself is configured by init_adc().
+ * ***********************************************************************************************/
+volatile uint16_t init_Acquisition(void) {
+    
+    volatile uint16_t i = 0;
+    
+    for (i = 0; i < 2; i++)
+    {
+        adc_acquisition.buffer[i].v_in = 0;
+        adc_acquisition.buffer[i].i_in = 0;
+        adc_acquisition.buffer[i].i_out = 0;
+        adc_acquisition.buffer[i].temperature = 0;
+    }
+    
+    adc_acquisition.active = 0;
+    adc_acquisition.count = 0;
+    adc_acquisition.pending = 0;
+    
+    return(1);
+}
+
+/*!exec_Acquisition
+ * ***********************************************************************************************
+ * Description:
+ * When all slow channels have new results, the results are copied into the inactive snapshot 
+ * buffer. Depending on ADC_SLOW_FILTER_MODE, results are read from the ADC buffers or from the 
+ * digital filters, which deliver one decimated result of ADC_SLOW_RESOLUTION bits per filter 
+ * period. When the sense offset calibration is enabled, the current sense offsets are removed
+ * from the results. The buffer index is swapped by a 
+ * single word write after the snapshot is complete, which makes the new snapshot visible to 
+ * all readers at once. The most recent snapshot is published in application.data, output 
+ * feedback data of all converter instances is captured by converter_UpdateData() and the 
+ * ADC is declared active once the first snapshot has been captured.
+ * ***********************************************************************************************/
+volatile uint16_t exec_Acquisition(void) {
+    
+    volatile ADC_SNAPSHOT_t* snapshot;
+    volatile uint16_t next = 0;
+    
+  #if (ADC_SLOW_FILTER_MODE == ADC_FILTER_NONE)
+    
+    if (((ADSTATL & ADC_SLOW_MASK_L) != ADC_SLOW_MASK_L) || 
+        ((ADSTATH & ADC_SLOW_MASK_H) != ADC_SLOW_MASK_H))
+    { // Scan is not complete yet
+        adc_acquisition.pending++;
+        return(1);
+    }
+    
+    next = (adc_acquisition.active ^ 0x0001);
+    snapshot = &adc_acquisition.buffer[next];
+    
+    snapshot->v_in = ADC_SLOW_ADCBUF(ADC_SLOW_VIN);
+    snapshot->i_in = ADC_SLOW_ADCBUF(ADC_SLOW_IIN);
+    snapshot->i_out = ADC_SLOW_ADCBUF(ADC_SLOW_IOUT);
+    snapshot->temperature = ADC_SLOW_ADCBUF(ADC_SLOW_TEMP);
+    
+  #else
+    
+    if (!(ADC_FILTER_CON(ADC_SLOW_VIN_FILTER) & ADC_FILTER_RDY) || 
+        !(ADC_FILTER_CON(ADC_SLOW_IIN_FILTER) & ADC_FILTER_RDY) || 
+        !(ADC_FILTER_CON(ADC_SLOW_IOUT_FILTER) & ADC_FILTER_RDY) || 
+        !(ADC_FILTER_CON(ADC_SLOW_TEMP_FILTER) & ADC_FILTER_RDY))
+    { // Filter period is not complete yet
+        adc_acquisition.pending++;
+        return(1);
+    }
+    
+    next = (adc_acquisition.active ^ 0x0001);
+    snapshot = &adc_acquisition.buffer[next];
+    
+    // Reading the filter results clears their ready bits
+    snapshot->v_in = ADC_FILTER_DAT(ADC_SLOW_VIN_FILTER);
+    snapshot->i_in = ADC_FILTER_DAT(ADC_SLOW_IIN_FILTER);
+    snapshot->i_out = ADC_FILTER_DAT(ADC_SLOW_IOUT_FILTER);
+    snapshot->temperature = ADC_FILTER_DAT(ADC_SLOW_TEMP_FILTER);
+    
+  #endif
+    
+  #if (USE_SENSE_CALIBRATION == 1)
+    // Remove the current sense offsets measured at startup (see task_Calibration.h)
+    snapshot->i_in = CALIBRATION_REMOVE_OFFSET(snapshot->i_in, sense_calibration.offset.i_in);
+    snapshot->i_out = CALIBRATION_REMOVE_OFFSET(snapshot->i_out, sense_calibration.offset.i_out);
+  #endif
+    
+    adc_acquisition.active = next; // Publish the new snapshot
+    adc_acquisition.count++;
+    adc_acquisition.pending = 0;
+    
+    application.data.v_in = snapshot->v_in;
+    application.data.i_in = snapshot->i_in;
+    application.data.i_out = snapshot->i_out;
+    application.data.temperature = snapshot->temperature;
+    converter_UpdateData(); // Most recent samples of the converter output feedback channels
+    
+    application.ctrl_status.flags.adc_active = true;
+    
+    EVENT_POST(EVT_ADC_READY);
+    
+    return(1);
+}
+
+// EOF
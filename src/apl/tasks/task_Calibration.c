@@ -0,0 +1,389 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Calibration.c
+ * *****************************************************************************
+ * File:   task_Calibration.c
+ * Author: M91406
+ *
+ * Description:
+ * Measures the zero offsets of the current sense channels and the output 
+ * voltage feedback while the power stage is turned off and stores them in a 
+ * reserved program memory page.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_Calibration.h"
+
+/* private function prototypes */
+inline volatile uint16_t calib_Apply(void);
+inline volatile uint16_t calib_CheckWord(volatile uint16_t* record);
+inline volatile uint16_t calib_RecordBuild(volatile uint16_t* record);
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+inline volatile uint16_t calib_FlashRead(volatile uint16_t* record);
+inline volatile uint16_t calib_FlashLoad(void);
+inline volatile uint16_t calib_FlashDeviation(void);
+inline volatile uint16_t calib_FlashCommand(volatile uint32_t address, volatile uint16_t nvm_op, 
+                volatile uint16_t word_low, volatile uint16_t word_high);
+#endif
+
+volatile SENSE_CALIBRATION_t sense_calibration;
+
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+
+#define CALIBRATION_NVMOP_DWORD_WRITE   0x4001  // NVMCON: WREN = 1, NVMOP = double-word program
+#define CALIBRATION_NVMOP_PAGE_ERASE    0x4003  // NVMCON: WREN = 1, NVMOP = page erase
+#define CALIBRATION_NVM_LATCH_PAGE      0x00FA  // TBLPAG of the NVM write latches
+#define CALIBRATION_DWORD_STEPS         (CALIBRATION_RECORD_WORDS >> 1) // double-word writes per record
+
+/*!calibration_flash
+ * ***********************************************************************************************
+ * Description:
+ * Program memory page reserved for the calibration record. The page is not programmed by the 
+ * device programmer and only written by exec_Calibration(). Word #0 holds the signature, 
+ * followed by the offsets and the check word (lower 16-bit word of each instruction word).
+ * ***********************************************************************************************/
+const uint16_t __attribute__((space(prog), aligned(CALIBRATION_FLASH_PAGE_SIZE), noload))
+                calibration_flash[CALIBRATION_FLASH_PAGE_SIZE >> 1];
+
+volatile uint32_t calibration_flash_base = 0; // program memory address of calibration_flash[]
+
+#endif
+
+/*!init_Calibration
+ * ***********************************************************************************************
+ * Description:
+ * Loads the default offsets declared in syscfg_scaling.h, or the offsets of the stored 
+ * calibration record when a valid record exists, and applies them to all converter instances. 
+ * After a warm boot, this is the only calibration step executed.
+ * ***********************************************************************************************/
+volatile uint16_t init_Calibration(void) {
+    
+    volatile uint16_t i = 0;
+    
+    sense_calibration.status.value = 0;
+    task_ResumableStart(&sense_calibration.pt);
+    sense_calibration.samples = 0;
+    sense_calibration.ticks = 0;
+    sense_calibration.step = 0;
+    sense_calibration.sum_i_in = 0;
+    sense_calibration.sum_i_out = 0;
+    
+    sense_calibration.offset.i_in = 0;
+    sense_calibration.offset.i_out = IOUT_SCALER_OFFSET_TICKS;
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        sense_calibration.offset.v_out[i] = (uint16_t)VOUT_FB_OFFSET;
+        sense_calibration.sum_v_out[i] = 0;
+    }
+    
+  #if (USE_SENSE_CALIBRATION_FLASH == 1)
+    calibration_flash_base = (((uint32_t)__builtin_tblpage(calibration_flash) << 16) | 
+                              (uint32_t)__builtin_tbloffset(calibration_flash));
+    sense_calibration.status.flags.restored = calib_FlashLoad();
+  #endif
+    
+    return(calib_Apply());
+}
+
+/*!exec_Calibration
+ * ***********************************************************************************************
+ * Description:
+ * This task is called by the device startup task queue once per scheduler tick after the PWM 
+ * generators have been started with overridden outputs. It is a resumable task executing the 
+ * calibration sequence in slices (see task_resumable.h). With every call, one sample of each 
+ * channel is accumulated. Slow channel samples are results of the ADC digital filters and are 
+ * only accumulated when all filters are ready. Once CALIBRATION_SAMPLES samples have been 
+ * accumulated, the averages are checked against the accepted offset range and applied. If the 
+ * stored record is missing or outdated, the record page is erased and the record is written 
+ * with one program memory operation per call. The signature is written last, so that an 
+ * incomplete record is not recognized as valid. 
+ * 
+ * While the sequence is in progress, the task holds the task queue at its position. Returns 0 
+ * if the calibration did not complete within CALIBRATION_TIMEOUT task calls.
+ * ***********************************************************************************************/
+volatile uint16_t exec_Calibration(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile uint16_t i_in = 0, i_out = 0;
+  #if (USE_SENSE_CALIBRATION_FLASH == 1)
+    volatile uint16_t step = 0;
+    volatile uint16_t record[CALIBRATION_RECORD_WORDS];
+  #endif
+    
+    TASK_PT_BEGIN(&sense_calibration.pt);
+    
+    while (sense_calibration.samples < CALIBRATION_SAMPLES)
+    {
+        if (++sense_calibration.ticks > CALIBRATION_TIMEOUT)
+        {
+            sense_calibration.status.flags.timeout = true;
+            TASK_PT_EXIT(&sense_calibration.pt, 0); // Release task queue and report the timeout
+        }
+        
+      #if (ADC_SLOW_FILTER_MODE == ADC_FILTER_NONE)
+        i_in = ADC_SLOW_ADCBUF(ADC_SLOW_IIN);
+        i_out = ADC_SLOW_ADCBUF(ADC_SLOW_IOUT);
+      #else
+        if (!(ADC_FILTER_CON(ADC_SLOW_IIN_FILTER) & ADC_FILTER_RDY) || 
+            !(ADC_FILTER_CON(ADC_SLOW_IOUT_FILTER) & ADC_FILTER_RDY))
+        { // Filter period is not complete yet
+            TASK_PT_YIELD(&sense_calibration.pt);
+            continue;
+        }
+        i_in = ADC_FILTER_DAT(ADC_SLOW_IIN_FILTER); // Reading the filter results clears their ready bits
+        i_out = ADC_FILTER_DAT(ADC_SLOW_IOUT_FILTER);
+      #endif
+        
+        sense_calibration.sum_i_in += i_in;
+        sense_calibration.sum_i_out += i_out;
+        for (i = 0; i < CONVERTER_COUNT; i++)
+        { sense_calibration.sum_v_out[i] += *converter[i].ptrVoltageFeedback; }
+        
+        if (++sense_calibration.samples < CALIBRATION_SAMPLES)
+        { TASK_PT_YIELD(&sense_calibration.pt); }
+    }
+    
+    // Check averages against the accepted offset range
+    i_in = (uint16_t)(sense_calibration.sum_i_in >> CALIBRATION_SAMPLES_LOG2);
+    i_out = (uint16_t)(sense_calibration.sum_i_out >> CALIBRATION_SAMPLES_LOG2);
+
+    if ((i_in > CALIBRATION_SLOW_OFFSET_MAX) || (i_out > CALIBRATION_SLOW_OFFSET_MAX))
+    { sense_calibration.status.flags.rejected = true; }
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        if ((sense_calibration.sum_v_out[i] >> CALIBRATION_SAMPLES_LOG2) > CALIBRATION_FAST_OFFSET_MAX)
+        { sense_calibration.status.flags.rejected = true; }
+    }
+
+    if (sense_calibration.status.flags.rejected)
+    { TASK_PT_EXIT(&sense_calibration.pt, 1); } // Keep the offsets in use
+
+    sense_calibration.offset.i_in = i_in;
+    sense_calibration.offset.i_out = i_out;
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    { sense_calibration.offset.v_out[i] = (uint16_t)(sense_calibration.sum_v_out[i] >> CALIBRATION_SAMPLES_LOG2); }
+
+    fres &= calib_Apply();
+    sense_calibration.status.flags.complete = true;
+    
+  #if (USE_SENSE_CALIBRATION_FLASH == 1)
+    if (calib_FlashDeviation())
+    { // Stored record is missing or outdated
+        
+        // Erase the program memory page of the calibration record
+        TASK_PT_YIELD(&sense_calibration.pt);
+        TASK_PT_WAIT_WHILE(&sense_calibration.pt, NVMCONbits.WR); // previous program memory operation is still in progress
+        fres &= calib_FlashCommand(calibration_flash_base, CALIBRATION_NVMOP_PAGE_ERASE, 0, 0);
+        if (!fres)
+        { TASK_PT_EXIT(&sense_calibration.pt, 0); } // Abort the sequence, the record remains invalid
+        
+        // Write the calibration record (one double-word per call, step order 1, 2, ..., n-1, 0 => signature last)
+        for (sense_calibration.step = 0; sense_calibration.step < CALIBRATION_DWORD_STEPS; sense_calibration.step++)
+        {
+            TASK_PT_YIELD(&sense_calibration.pt);
+            TASK_PT_WAIT_WHILE(&sense_calibration.pt, NVMCONbits.WR); // previous program memory operation is still in progress
+            
+            calib_RecordBuild(record);
+            step = ((sense_calibration.step + 1) % CALIBRATION_DWORD_STEPS);
+            fres &= calib_FlashCommand((calibration_flash_base + ((uint32_t)step << 2)), 
+                        CALIBRATION_NVMOP_DWORD_WRITE, record[step << 1], record[(step << 1) + 1]);
+            if (!fres)
+            { TASK_PT_EXIT(&sense_calibration.pt, 0); } // Abort the sequence, the record remains invalid
+        }
+        
+        sense_calibration.status.flags.stored = true;
+    }
+  #endif
+    
+    TASK_PT_END(&sense_calibration.pt, fres);
+}
+
+/*!calib_Apply
+ * ***********************************************************************************************
+ * Description:
+ * Applies the output voltage feedback offsets to the control loop settings of all converter 
+ * instances. The difference to the recently applied offset is added to the reference.
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_Apply(void) {
+    
+    volatile uint16_t i = 0;
+    
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        converter[i].loop.reference += (sense_calibration.offset.v_out[i] - converter[i].loop.feedback_offset);
+        converter[i].loop.feedback_offset = sense_calibration.offset.v_out[i];
+    }
+    
+    return(1);
+}
+
+/*!calib_CheckWord
+ * ***********************************************************************************************
+ * Description:
+ * Calculates the check word across signature and offsets of a calibration record
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_CheckWord(volatile uint16_t* record) {
+    
+    volatile uint16_t i = 0, check = 0;
+    
+    for (i = 0; i <= CALIBRATION_OFFSET_WORDS; i++)
+    { check ^= record[i]; }
+    
+    return((uint16_t)~check);
+}
+
+/*!calib_RecordBuild
+ * ***********************************************************************************************
+ * Description:
+ * Builds the calibration record of the offsets in use (unused padding words remain erased)
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_RecordBuild(volatile uint16_t* record) {
+    
+    volatile uint16_t i = 0;
+    volatile uint16_t* offset = (volatile uint16_t*)&sense_calibration.offset;
+    
+    record[0] = CALIBRATION_SIGNATURE;
+    for (i = 0; i < CALIBRATION_OFFSET_WORDS; i++)
+    { record[i + 1] = offset[i]; }
+    record[CALIBRATION_OFFSET_WORDS + 1] = calib_CheckWord(record);
+    for (i = (CALIBRATION_OFFSET_WORDS + 2); i < CALIBRATION_RECORD_WORDS; i++)
+    { record[i] = 0xFFFF; }
+    
+    return(1);
+}
+
+#if (USE_SENSE_CALIBRATION_FLASH == 1)
+
+/*!calib_FlashRead
+ * ***********************************************************************************************
+ * Description:
+ * Copies the stored calibration record from calibration_flash[] (lower 16-bit word of each 
+ * instruction word). Returns 1 if signature and check word of the record are valid.
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_FlashRead(volatile uint16_t* record) {
+    
+    volatile uint16_t i = 0, tblpag_buffer = 0;
+    volatile uint32_t address = 0;
+    
+    tblpag_buffer = TBLPAG;
+    
+    for (i = 0; i < CALIBRATION_RECORD_WORDS; i++)
+    {
+        address = (calibration_flash_base + ((uint32_t)i << 1));
+        TBLPAG = (uint16_t)(address >> 16);
+        record[i] = __builtin_tblrdl((uint16_t)(address & 0xFFFF));
+    }
+    
+    TBLPAG = tblpag_buffer;
+    
+    return((record[0] == CALIBRATION_SIGNATURE) && 
+           (record[CALIBRATION_OFFSET_WORDS + 1] == calib_CheckWord(record)));
+}
+
+/*!calib_FlashLoad
+ * ***********************************************************************************************
+ * Description:
+ * Copies the offsets of the stored calibration record into sense_calibration.offset. Returns 
+ * 0 without changing the offsets in use if no valid record exists.
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_FlashLoad(void) {
+    
+    volatile uint16_t i = 0;
+    volatile uint16_t record[CALIBRATION_RECORD_WORDS];
+    volatile uint16_t* offset = (volatile uint16_t*)&sense_calibration.offset;
+    
+    if (!calib_FlashRead(record))
+    { return(0); }
+    
+    for (i = 0; i < CALIBRATION_OFFSET_WORDS; i++)
+    { offset[i] = record[i + 1]; }
+    
+    return(1);
+}
+
+/*!calib_FlashDeviation
+ * ***********************************************************************************************
+ * Description:
+ * Returns 1 if no valid record is stored or if one of the offsets in use deviates from the 
+ * stored record by more than CALIBRATION_STORE_DEVIATION
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_FlashDeviation(void) {
+    
+    volatile uint16_t i = 0, stored = 0;
+    volatile uint16_t record[CALIBRATION_RECORD_WORDS];
+    volatile uint16_t* offset = (volatile uint16_t*)&sense_calibration.offset;
+    
+    if (!calib_FlashRead(record))
+    { return(1); }
+    
+    for (i = 0; i < CALIBRATION_OFFSET_WORDS; i++)
+    {
+        stored = record[i + 1];
+        if (((offset[i] > stored) ? (offset[i] - stored) : (stored - offset[i])) > CALIBRATION_STORE_DEVIATION)
+        { return(1); }
+    }
+    
+    return(0);
+}
+
+/*!calib_FlashCommand
+ * ***********************************************************************************************
+ * Description:
+ * Executes a program memory page erase or double-word write at the given address. For 
+ * double-word writes, the lower 16-bit words of two successive instruction words are written 
+ * (the upper bytes remain erased).
+ * ***********************************************************************************************/
+inline volatile uint16_t calib_FlashCommand(volatile uint32_t address, volatile uint16_t nvm_op, 
+                volatile uint16_t word_low, volatile uint16_t word_high) {
+    
+    volatile uint16_t tblpag_buffer = 0;
+    
+    if (nvm_op == CALIBRATION_NVMOP_DWORD_WRITE)
+    {
+        tblpag_buffer = TBLPAG;
+        TBLPAG = CALIBRATION_NVM_LATCH_PAGE;
+        __builtin_tblwtl(0x0000, word_low);
+        __builtin_tblwth(0x0000, 0x00FF);
+        __builtin_tblwtl(0x0002, word_high);
+        __builtin_tblwth(0x0002, 0x00FF);
+        TBLPAG = tblpag_buffer;
+    }
+    
+    NVMADRU = (uint16_t)(address >> 16);
+    NVMADR = (uint16_t)(address & 0xFFFF);
+    NVMCON = nvm_op;
+    __builtin_write_NVM(); // unlock sequence and start operation (CPU stalls until completed)
+    
+    return(!NVMCONbits.WRERR);
+}
+
+#endif  /* USE_SENSE_CALIBRATION_FLASH */
+
+// EOF
@@ -0,0 +1,195 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_CanInterface.c
+ * *****************************************************************************
+ * File:   task_CanInterface.c
+ * Author: M91406
+ *
+ * Description:
+ * Rack-level CAN FD status and command interface (see task_CanInterface.h)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_CanInterface.h"
+#include "_root/generic/task_manager.h"
+
+volatile CAN_INTERFACE_t can_interface;
+
+/* private function prototypes */
+volatile uint16_t can_interface_Command(volatile uint8_t* data, volatile uint16_t length);
+volatile uint16_t can_interface_Publish(void);
+
+/*!init_CanInterface
+ * ***********************************************************************************************
+ * Description:
+ * Resets the CAN interface. Remote control is released and the first status message is sent
+ * with the next call of the CAN interface task.
+ * ***********************************************************************************************/
+volatile uint16_t init_CanInterface(void) {
+    
+    can_interface.remote_control = false;
+    can_interface.system_mode_request = SYSTEM_MODE_OFF;
+    can_interface.command_timeout = 0;
+    can_interface.publish_counter = TASK_MGR_TICKS(CAN_PUBLISH_PERIOD_TICKS);
+    can_interface.messages = 0;
+    can_interface.commands = 0;
+    can_interface.tx_overruns = 0;
+    
+    return(1);
+}
+
+/*!exec_CanInterface
+ * ***********************************************************************************************
+ * Description:
+ * Executes all received command messages, supervises the remote control timeout and sends the
+ * status message when it is due.
+ * ***********************************************************************************************/
+volatile uint16_t exec_CanInterface(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t sid=0, length=0;
+    volatile uint8_t data[CAN_RX_PAYLOAD_SIZE];
+    
+    #if (USE_CAN == 1)
+    
+    // Commands
+    while (can_Receive(&sid, &data[0], &length)) 
+    { fres &= can_interface_Command(&data[0], length); }
+    
+    // Timeouts are counted in scheduler ticks elapsed since the previous call
+    if (can_interface.command_timeout > task_mgr.exec_task_period)
+    { can_interface.command_timeout -= task_mgr.exec_task_period; }
+    else if (can_interface.command_timeout > 0) 
+    { 
+        can_interface.command_timeout = 0;
+        can_interface.remote_control = false;
+    }
+    
+    // Status message
+    fres &= can_interface_Publish();
+    
+    #endif
+    
+    return(fres);
+}
+
+/*!can_interface_Command
+ * ***********************************************************************************************
+ * Description:
+ * Executes one command message. Unknown commands and invalid system modes are ignored.
+ * ***********************************************************************************************/
+volatile uint16_t can_interface_Command(volatile uint8_t* data, volatile uint16_t length) {
+    
+    volatile uint16_t argument = 0;
+    
+    if (length < 1) 
+    { return(1); }
+    
+    if (length >= 3)
+    { argument = ((uint16_t)data[2] << 8) | (uint16_t)data[1]; }
+    
+    switch (data[0])
+    {
+        case CAN_CMD_RELEASE:
+            can_interface.remote_control = false;
+            can_interface.command_timeout = 0;
+            break;
+            
+        case CAN_CMD_SYSTEM_MODE:
+            if ((argument == SYSTEM_MODE_OFF) || (argument == SYSTEM_MODE_ON) || 
+                (argument == SYSTEM_MODE_STANDBY)) 
+            {
+                can_interface.system_mode_request = argument;
+                can_interface.remote_control = true;
+                can_interface.command_timeout = TASK_MGR_TICKS(CAN_COMMAND_TIMEOUT_TICKS);
+            }
+            break;
+            
+        case CAN_CMD_HEARTBEAT:
+            if (can_interface.remote_control)
+            { can_interface.command_timeout = TASK_MGR_TICKS(CAN_COMMAND_TIMEOUT_TICKS); }
+            break;
+            
+        default:
+            break;
+    }
+    
+    can_interface.commands++;
+    
+    return(1);
+}
+
+/*!can_interface_Publish
+ * ***********************************************************************************************
+ * Description:
+ * Sends the status message when CAN_PUBLISH_PERIOD has expired or when a status word has 
+ * changed and CAN_PUBLISH_MIN_INTERVAL has expired since the previous message. If the 
+ * transmit FIFO is full, the message is sent with the next call.
+ * ***********************************************************************************************/
+volatile uint16_t can_interface_Publish(void) {
+    
+    volatile CAN_STATUS_MESSAGE_t msg;
+    volatile uint16_t* recent = (volatile uint16_t*)&msg;
+    volatile uint16_t* previous = (volatile uint16_t*)&can_interface.published;
+    volatile uint16_t i=0;
+    volatile bool changed = false;
+    
+    if (can_interface.publish_counter < (0xFFFF - task_mgr.exec_task_period)) 
+    { can_interface.publish_counter += task_mgr.exec_task_period; }
+    else
+    { can_interface.publish_counter = 0xFFFF; }
+    
+    if (can_interface.publish_counter < TASK_MGR_TICKS(CAN_PUBLISH_MIN_TICKS))
+    { return(1); }
+    
+    msg.system_status = application.system_status.value;
+    msg.system_mode = application.system_mode.value;
+    msg.op_mode = task_mgr.op_mode.mode;
+    msg.ctrl_status = application.ctrl_status.value;
+    msg.task_mgr_status = task_mgr.status.value;
+    
+    for (i=0; i<CAN_STATUS_WORDS; i++)
+    { changed |= (recent[i] != previous[i]); }
+    
+    if ((!changed) && (can_interface.publish_counter < TASK_MGR_TICKS(CAN_PUBLISH_PERIOD_TICKS)))
+    { return(1); }
+    
+    msg.data = application.data;
+    
+    if (!can_Transmit(CAN_ID_STATUS, (volatile uint8_t*)&msg, sizeof(CAN_STATUS_MESSAGE_t))) {
+        can_interface.tx_overruns++;
+        return(1);
+    }
+    
+    can_interface.published = msg;
+    can_interface.publish_counter = 0;
+    can_interface.messages++;
+    
+    return(1);
+}
@@ -37,6 +37,7 @@
  * History:
  * 02/21/2019	File created
  * 04/17/2019   extended LED operation now reflecting operating modes
+ * 10/14/2026   added hardware LED pattern generation (see USE_FUNCTION_LED_HARDWARE)
  * ***************************************************************************/
 
 #include <xc.h>
@@ -46,6 +47,12 @@
 #define DEBUG_LED_TICK_RATE_FAULT    100 // default on-time during critical fault conditions
 
 volatile FUNCTION_LED_CONFIG_t taskDebugLED_config;
+volatile uint16_t taskDebugLED_tick_rate_default = DEBUG_LED_TICK_RATE_DEFAULT; // runtime tunable on-time in nominal ticks (see parameters.h)
+volatile uint16_t taskDebugLED_tick_rate_fault = DEBUG_LED_TICK_RATE_FAULT; // runtime tunable on-time in nominal ticks (see parameters.h)
+
+#if (FUNCTION_LED_HARDWARE == 1)
+volatile uint16_t taskDebugLED_op_mode = OP_MODE_UNKNOWN; // operating mode of the LED pattern recently applied
+#endif
 
 // Private prototypes
 volatile inline uint16_t task_DebugLED_ForceOn(void);
@@ -114,23 +121,23 @@ volatile uint16_t DebugLED_SwitchOpMode(void)
 
         case OP_MODE_NORMAL:  // In Normal mode on-time reflects the system status
             
-            taskDebugLED_config.on_time = 1000;   // set on_time
-            taskDebugLED_config.period = 2000;   // set period
+            taskDebugLED_config.on_time = TASK_MGR_TICKS(1000);   // set on_time
+            taskDebugLED_config.period = TASK_MGR_TICKS(2000);   // set period
             taskDebugLED_config.status.flags.mode = LEDCTRL_MODE_DUTY_RATIO;
             taskDebugLED_config.status.flags.enable = 1;
             break;
             
         case OP_MODE_STANDBY: // Standby operation mode
 
-            taskDebugLED_config.on_time = 50;   // set on_time
-            taskDebugLED_config.period = 20000;   // set period
+            taskDebugLED_config.on_time = TASK_MGR_TICKS(50);   // set on_time
+            taskDebugLED_config.period = TASK_MGR_TICKS(20000);   // set period
             taskDebugLED_config.status.flags.mode = LEDCTRL_MODE_DUTY_RATIO;
             taskDebugLED_config.status.flags.enable = 1;
             break;
 
         case OP_MODE_FAULT: // Fault mode will be entered when a critical fault condition has been detected
 
-            taskDebugLED_config.on_time = DEBUG_LED_TICK_RATE_FAULT;   // set on_time
+            taskDebugLED_config.on_time = TASK_MGR_TICKS(taskDebugLED_tick_rate_fault);   // set on_time
             taskDebugLED_config.period = (taskDebugLED_config.on_time << 1);   // set period
             taskDebugLED_config.status.flags.mode = LEDCTRL_MODE_TOGGLE;
             taskDebugLED_config.status.flags.enable = 1;
@@ -138,7 +145,7 @@ volatile uint16_t DebugLED_SwitchOpMode(void)
 
         default:          // Generic OP_MODE_IDLE => "DO NOTHING" fallback task
 
-            taskDebugLED_config.on_time = DEBUG_LED_TICK_RATE_DEFAULT;   // set on_time
+            taskDebugLED_config.on_time = TASK_MGR_TICKS(taskDebugLED_tick_rate_default);   // set on_time
             taskDebugLED_config.period = (taskDebugLED_config.on_time << 1);   // set period
             taskDebugLED_config.status.flags.mode = LEDCTRL_MODE_TOGGLE;
             taskDebugLED_config.status.flags.enable = 1;
@@ -153,7 +160,11 @@ volatile uint16_t task_DebugLED(void)
 {
     
     // if task manager operating mode has changed, read new settings
+  #if (USE_TASK_MANAGER_EVENT_BUS == 1)
+    if(task_EventTake(EVENT_SUB_DEBUG_LED, EVENT_MASK(EVT_OP_MODE_SWITCH)))
+  #else
     if(task_mgr.status.flags.queue_switch)
+  #endif
     { DebugLED_SwitchOpMode(); }
     
     
@@ -217,6 +228,34 @@ volatile uint16_t task_DebugLED(void)
     return(taskDebugLED_config.status.value);
 }
 
+/*!exec_DebugLEDHardware
+ * ***********************************************************************************************
+ * Description:
+ * Replaces the DebugLED task when the LED pattern is generated by the SCCP module (see 
+ * USE_FUNCTION_LED_HARDWARE). This function is called in every scheduler cycle but only 
+ * reconfigures the SCCP module when the operating mode has changed. The module is initialized
+ * by the first call.
+ * ***********************************************************************************************/
+#if (FUNCTION_LED_HARDWARE == 1)
+volatile uint16_t exec_DebugLEDHardware(void)
+{
+    volatile uint16_t fres = 1;
+    
+    if (task_mgr.op_mode.mode == taskDebugLED_op_mode)
+    { return(fres); }
+    
+    if (taskDebugLED_op_mode == OP_MODE_UNKNOWN)
+    { fres &= init_taskDebugLED(); }
+    else
+    { fres &= DebugLED_SwitchOpMode(); }
+    
+    fres &= fled_HardwareApply(&taskDebugLED_config);
+    taskDebugLED_op_mode = task_mgr.op_mode.mode;
+    
+    return(fres);
+}
+#endif
+
 volatile uint16_t init_taskDebugLED(void)
 {
     // Hardware pin initialization should be done in init_gpio.c
@@ -224,6 +263,10 @@ volatile uint16_t init_taskDebugLED(void)
     DEBUG_LED_WR = LED_OFF;
     DEBUG_LED_INIT_OUTPUT;
     
+    #if (FUNCTION_LED_HARDWARE == 1)
+    fled_HardwareInit(); // Map the LED pin to the SCCP output
+    #endif
+    
     // Initialize status structure
     taskDebugLED_config.status.flags.pin_status = LEDCTRL_PIN_STATUS_HIGH;
     taskDebugLED_config.status.flags.led_status = LEDCTRL_LED_STATUS_OFF;
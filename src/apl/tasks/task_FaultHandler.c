@@ -56,25 +56,152 @@
 FAULT_OBJECT_t fltobj_CPULoadOverrun;
 FAULT_OBJECT_t fltobj_TaskExecutionFailure;
 FAULT_OBJECT_t fltobj_TaskTimeQuotaViolation;
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+FAULT_OBJECT_t fltobj_SlotStartLatency;
+#endif
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+FAULT_OBJECT_t fltobj_StackUsageWarning;
+FAULT_OBJECT_t fltobj_StackUsageCritical;
+#endif
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+FAULT_OBJECT_t fltobj_FlashCrcFailure;
+FAULT_OBJECT_t fltobj_RamTestFailure;
+#endif
 
 // Declaration of user defined fault objects
 FAULT_OBJECT_t fltobj_PowerSourceFailure;
 
+// Fault objects of the converter instances (see converter.h)
+FAULT_OBJECT_t fltobj_ConverterOVP[CONVERTER_COUNT];
 
-/*!User-Defined Fault Objects Initialization
+
+/*!User-Defined Fault Object Descriptors
  * ***********************************************************************************************
  * Description:
- * The following prototype declarations represent user-defined initialization routines of each
- * defined fault object. Every fault object used to monitor values of variables or registers 
- * throughout the firmware needs to be initialized by a separate initialization routine.
+ * The following constant descriptors hold the settings of each user-defined fault object which 
+ * do not change at runtime (see FAULT_OBJECT_DESCRIPTOR_t). They are located in program memory 
+ * and loaded into their fault objects by init_FaultObjects(). Trip and release levels depending 
+ * on runtime settings are set by init_FaultObjects() after the descriptor has been loaded.
  * ***********************************************************************************************/
 
-inline uint16_t init_CPULoadOverrunFaultObject(void);
-inline uint16_t init_TaskExecutionFaultObject(void);
-inline uint16_t init_TaskTimeQuotaViolationFaultObject(void);
+// Fault object descriptors for firmware modules and task manager flow control
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_CPULoadOverrun = {
+    &task_mgr.cpu_load.load_max_buffer, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_CPU_LOAD_OVERRUN, (uint16_t)FLTOBJ_CPU_LOAD_OVERRUN, // error code and ID
+    FAULT_LEVEL_LESS_THAN, 50, 1, 100, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_WARNING, // fault classes
+    (FAULT_SW | FAULT_SI | FAULT_ACTIVE | FAULT_STAT | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (CPU load overrun has to be detected within one tick), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
 
-    // user defined fault objects
-inline uint16_t init_MyCustomFaultObject(void);
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_TaskExecutionFailure = {
+    &task_mgr.proc_code.segments.retval, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_TASK_EXECUTION_FAILURE, (uint16_t)FLTOBJ_TASK_EXECUTION_FAILURE, // error code and ID
+    FAULT_LEVEL_NOT_EQUAL, 1, 1, 0, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_WARNING, // fault classes
+    (FAULT_SW | FAULT_ACTIVE | FAULT_STAT | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (task return values are checked every tick), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_TaskTimeQuotaViolation = {
+    &task_mgr.task_time_ctrl.maximum, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_TASK_TIME_QUOTA_VIOLATION, (uint16_t)FLTOBJ_TASK_TIME_QUOTA_VIOLATION, // error code and ID
+    FAULT_LEVEL_GREATER_THAN, 0, 1, 0, 10, // fault condition, trip level/count, reset level/count (levels set at runtime)
+    FLT_CLASS_WARNING, // fault classes
+    (FAULT_SW | FAULT_ACTIVE | FAULT_STAT | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (task execution times are captured every tick), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+
+#if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_SlotStartLatency = {
+    &slot_profile.latency, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_SLOT_START_LATENCY, (uint16_t)FLTOBJ_SLOT_START_LATENCY, // error code and ID
+    FAULT_LEVEL_GREATER_THAN, 0, 1, 0, 10, // fault condition, trip level/count, reset level/count (levels set at runtime)
+    FLT_CLASS_WARNING, // fault classes
+    (FAULT_SW | FAULT_ACTIVE | FAULT_STAT | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (the latency is captured in every tick), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+#endif
+
+#if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_StackUsageWarning = {
+    &task_stack.usage, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_STACK_USAGE_WARNING, (uint16_t)FLTOBJ_STACK_USAGE_WARNING, // error code and ID
+    FAULT_LEVEL_GREATER_THAN, TASK_MGR_STACK_WARNING_LEVEL, 1, TASK_MGR_STACK_WARNING_LEVEL, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_WARNING, // fault classes
+    (FAULT_SW | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_SLOW, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (the high-water mark is updated once per scan pass), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_StackUsageCritical = {
+    &task_stack.usage, FAULT_OBJECT_BIT_MASK_DEFAULT, // monitored object and bit mask
+    (uint32_t)FLTOBJ_STACK_USAGE_CRITICAL, (uint16_t)FLTOBJ_STACK_USAGE_CRITICAL, // error code and ID
+    FAULT_LEVEL_GREATER_THAN, TASK_MGR_STACK_CRITICAL_LEVEL, 1, TASK_MGR_STACK_CRITICAL_LEVEL, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_CRITICAL, // fault classes
+    (FAULT_SW | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_SLOW, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (the high-water mark is updated once per scan pass), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+#endif
+
+#if (USE_TASK_MANAGER_SELF_TEST == 1)
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_FlashCrcFailure = {
+    &task_selftest.failures, SELF_TEST_FAILURE_FLASH, // monitored object and bit mask
+    (uint32_t)FLTOBJ_FLASH_CRC_FAILURE, (uint16_t)FLTOBJ_FLASH_CRC_FAILURE, // error code and ID
+    FAULT_LEVEL_NOT_EQUAL, 0, 1, 0, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_CRITICAL, // fault classes
+    (FAULT_SW | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_SLOW, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (failure flags are latched until reset), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_RamTestFailure = {
+    &task_selftest.failures, SELF_TEST_FAILURE_RAM, // monitored object and bit mask
+    (uint32_t)FLTOBJ_RAM_TEST_FAILURE, (uint16_t)FLTOBJ_RAM_TEST_FAILURE, // error code and ID
+    FAULT_LEVEL_NOT_EQUAL, 0, 1, 0, 1, // fault condition, trip level/count, reset level/count
+    FLT_CLASS_CRITICAL, // fault classes
+    (FAULT_SW | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_SLOW, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_TASK_MANAGER, // scan class (failure flags are latched until reset), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+#endif
+
+// Descriptors of user defined fault objects
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_PowerSourceFailure = {
+    &application.ctrl_status.value, CTRL_STAT_POWERSOURCE_DETECTED, // monitored object and bit mask
+    (uint32_t)FLTOBJ_POWER_SOURCE_FAILURE, (uint16_t)FLTOBJ_POWER_SOURCE_FAILURE, // error code and ID
+    FAULT_LEVEL_EQUAL, 0, 1, 1, 3, // fault condition, trip level/count, reset level/count
+    (FLT_CLASS_CRITICAL | FLT_CLASS_USER_ACTION), // fault classes
+    (FAULT_HW | FAULT_SYS | FAULT_ACTIVE | FAULT_STAT | FLTCHK_ENABLED), // fault levels, initial status and fault check enable
+    NULL, NULL, // user fault action and reset functions
+    FAULT_SCAN_CLASS_SLOW, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_SYSTEM, // scan class (input voltage changes slowly), trigger and group
+    NULL, NULL // hardware binding and fault filter
+};
+
+// Descriptors of the converter instance fault objects (levels are set by the converter registry)
+#define CONVERTER_REGISTRY_FLTDSC_OVP(index, controller, reference, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) \
+    { &converter[index].data.v_out, FAULT_OBJECT_BIT_MASK_DEFAULT, \
+      (uint32_t)FLTOBJ_OVP_##index, (uint16_t)FLTOBJ_OVP_##index, \
+      FAULT_LEVEL_GREATER_THAN, (ovp_trip), 3, (ovp_release), 10, \
+      FLT_CLASS_CRITICAL, (FAULT_HW | FLTCHK_ENABLED), NULL, NULL, \
+      FAULT_SCAN_CLASS_FAST, FAULT_TRIGGER_POLLED, (uint16_t)FLTGRP_##index, NULL, NULL },
+
+const FAULT_OBJECT_DESCRIPTOR_t fltdsc_ConverterOVP[CONVERTER_COUNT] = {
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_FLTDSC_OVP)
+};
 
 /*!fault_object_list[]
  * ***********************************************************************************************
@@ -84,37 +211,99 @@ inline uint16_t init_MyCustomFaultObject(void);
  * status information, fault classes and user fault actions.
  * ***********************************************************************************************/
 
+#define CONVERTER_REGISTRY_FLTOBJ_LIST(id, controller, reference, v_fb, i_fb, outputs, v_target, ovp_trip, ovp_release) \
+    &fltobj_ConverterOVP[id], // output over voltage protection of this converter
+
 volatile FAULT_OBJECT_t *fault_object_list[] = {
     
     // fault objects for firmware modules and task manager flow
     &fltobj_CPULoadOverrun,    // The CPU meter indicated an overrun condition (no free process time left))
     &fltobj_TaskExecutionFailure,   // a task returned an error code ("no success")
     &fltobj_TaskTimeQuotaViolation, // a time execution took longer than specified
+    #if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+    &fltobj_SlotStartLatency, // a scheduler time slot started late (previous time slot overrun)
+    #endif
+    #if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+    &fltobj_StackUsageWarning, // the stack high-water mark exceeded the warning level
+    &fltobj_StackUsageCritical, // the stack high-water mark exceeded the critical level
+    #endif
+    #if (USE_TASK_MANAGER_SELF_TEST == 1)
+    &fltobj_FlashCrcFailure, // the flash CRC signature differs from the reference
+    &fltobj_RamTestFailure, // the RAM March test detected a data memory cell failure
+    #endif
     
     // user defined fault objects
     &fltobj_PowerSourceFailure, 
+    
+    // fault objects of the converter instances
+    CONVERTER_REGISTRY(CONVERTER_REGISTRY_FLTOBJ_LIST)
 
 };
 volatile uint16_t fltobj_list_size = (sizeof(fault_object_list)/sizeof(fault_object_list[0]));
 
+/*!fault_group[]
+ * ***********************************************************************************************
+ * Description:
+ * The fault_group[] array holds the fault groups labeled by fault_group_index_e. Members are 
+ * assigned by fault_GroupsBuild() from the group setting of each fault object.
+ * ***********************************************************************************************/
+#if (USE_FAULT_GROUPS == 1)
+volatile FAULT_GROUP_t fault_group[FAULT_GROUP_COUNT];
+volatile uint16_t fault_group_count = FAULT_GROUP_COUNT;
+#endif
+
 /*!init_FaultObjects
  * ***********************************************************************************************
  * Description:
- * The fault_object_list[] array is a list of all fault objects defined for this project. It
- * is a list of pointers to FAULT_OBJECT_t data structures defining fault settings,
- * status information, fault classes and user fault actions.
+ * All fault objects listed in fault_object_list[] are initialized here by loading their 
+ * constant descriptors. Trip and release levels derived from the scheduler period are set 
+ * after the descriptor has been loaded:
+ * 
+ *    - fltobj_TaskTimeQuotaViolation trips at 7/8 and releases at 3/4 of the task time quota
+ *    - fltobj_SlotStartLatency trips at the latency limit slot_profile.limit and releases at 
+ *      half of the limit
+ * 
+ * The converter instance fault objects are bound to their converter by converter[].fltobj_ovp.
  * ***********************************************************************************************/
 
 volatile uint16_t init_FaultObjects(void)
 {
     volatile uint16_t fres = 0;
+    volatile uint16_t i = 0;
 
-    fres = init_CPULoadOverrunFaultObject();
-    fres &= init_TaskExecutionFaultObject();
-    fres &= init_TaskTimeQuotaViolationFaultObject();
+    // fault objects for firmware modules and task manager flow
+    fres = fault_ObjectLoad(&fltobj_CPULoadOverrun, &fltdsc_CPULoadOverrun);
+    fres &= fault_ObjectLoad(&fltobj_TaskExecutionFailure, &fltdsc_TaskExecutionFailure);
+    fres &= fault_ObjectLoad(&fltobj_TaskTimeQuotaViolation, &fltdsc_TaskTimeQuotaViolation);
+    fltobj_TaskTimeQuotaViolation.criteria.trip_level = (task_mgr.task_time_ctrl.quota - (task_mgr.task_time_ctrl.quota >> 3));
+    fltobj_TaskTimeQuotaViolation.criteria.reset_level = (task_mgr.task_time_ctrl.quota - (task_mgr.task_time_ctrl.quota >> 2));
+    #if (USE_TASK_MANAGER_JITTER_MONITOR == 1)
+    fres &= fault_ObjectLoad(&fltobj_SlotStartLatency, &fltdsc_SlotStartLatency);
+    fltobj_SlotStartLatency.criteria.trip_level = slot_profile.limit;
+    fltobj_SlotStartLatency.criteria.reset_level = (slot_profile.limit >> 1);
+    #endif
+    #if (USE_TASK_MANAGER_STACK_MONITOR == 1)
+    fres &= fault_ObjectLoad(&fltobj_StackUsageWarning, &fltdsc_StackUsageWarning);
+    fres &= fault_ObjectLoad(&fltobj_StackUsageCritical, &fltdsc_StackUsageCritical);
+    #endif
+    #if (USE_TASK_MANAGER_SELF_TEST == 1)
+    fres &= fault_ObjectLoad(&fltobj_FlashCrcFailure, &fltdsc_FlashCrcFailure);
+    fres &= fault_ObjectLoad(&fltobj_RamTestFailure, &fltdsc_RamTestFailure);
+    #endif
     
     // user defined fault objects
-    fres &= init_MyCustomFaultObject();
+    fres &= fault_ObjectLoad(&fltobj_PowerSourceFailure, &fltdsc_PowerSourceFailure);
+
+    // fault objects of the converter instances
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        fres &= fault_ObjectLoad(&fltobj_ConverterOVP[i], &fltdsc_ConverterOVP[i]);
+        converter[i].fltobj_ovp = (struct FAULT_OBJECT_s*)&fltobj_ConverterOVP[i];
+    }
+
+    #if (USE_FAULT_ENGINE == 1)
+    fres &= fault_EngineCompile(); // Compile fault objects into fault engine
+    #endif
 
     // Set global fault flags (need to be cleared during operation)
     task_mgr.status.flags.global_fault = 1;
@@ -125,194 +314,4 @@ volatile uint16_t init_FaultObjects(void)
     
 }
 
-/*!init_CPULoadOverrunFaultObject
- * ***********************************************************************************************
- * Description:
- * The fltobj_CPULoadOverrun is initialized here. This fault detects conditions where the CPU
- * meter of the main scheduler detects an overrun condition, where there is no free process
- * time left.
- * ***********************************************************************************************/
-
-inline uint16_t init_CPULoadOverrunFaultObject(void)
-{
-    // Configuring the CPU Load Overrun fault object
-
-    // specify the target value/register to be monitored
-    fltobj_CPULoadOverrun.object = &task_mgr.cpu_load.load_max_buffer; // monitoring the CPU meter result
-    fltobj_CPULoadOverrun.object_bit_mask = FAULT_OBJECT_BIT_MASK_DEFAULT;
-    fltobj_CPULoadOverrun.error_code = (uint32_t)FLTOBJ_CPU_LOAD_OVERRUN;
-    fltobj_CPULoadOverrun.id = (uint16_t)FLTOBJ_CPU_LOAD_OVERRUN;
-    
-    /* TODO: identify and set generic CPU load warning/fault thresholds */
-    // configuring the trip and reset levels as well as trip and reset event filter setting
-    fltobj_CPULoadOverrun.criteria.counter = 0;      // Set/reset fault counter
-    fltobj_CPULoadOverrun.criteria.fault_ratio = FAULT_LEVEL_LESS_THAN;
-    fltobj_CPULoadOverrun.criteria.trip_level = 50;   // Set/reset trip level value
-    fltobj_CPULoadOverrun.criteria.trip_cnt_threshold = 1; // Set/reset number of successive trips before triggering fault event
-    fltobj_CPULoadOverrun.criteria.reset_level = 100;  // Set/reset fault release level value
-    fltobj_CPULoadOverrun.criteria.reset_cnt_threshold = 1; // Set/reset number of successive resets before triggering fault release
-    
-    // specifying fault class, fault level and enable/disable status
-    fltobj_CPULoadOverrun.classes.flags.notify = 0;   // Set =1 if this fault object triggers a fault condition notification
-    fltobj_CPULoadOverrun.classes.flags.warning = 1;  // Set =1 if this fault object triggers a warning fault condition response
-    fltobj_CPULoadOverrun.classes.flags.critical = 0; // Set =1 if this fault object triggers a critical fault condition response
-    fltobj_CPULoadOverrun.classes.flags.catastrophic = 0; // Set =1 if this fault object triggers a catastrophic fault condition response
-
-    fltobj_CPULoadOverrun.classes.flags.user_class = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_CPULoadOverrun.user_fault_action = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_CPULoadOverrun.user_fault_reset = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-        
-    fltobj_CPULoadOverrun.status.flags.fltlvlhw = 0; // Set =1 if this fault condition is board-level fault condition
-    fltobj_CPULoadOverrun.status.flags.fltlvlsw = 1; // Set =1 if this fault condition is software-level fault condition
-    fltobj_CPULoadOverrun.status.flags.fltlvlsi = 1; // Set =1 if this fault condition is silicon-level fault condition
-    fltobj_CPULoadOverrun.status.flags.fltlvlsys = 0; // Set =1 if this fault condition is system-level fault condition
-
-    fltobj_CPULoadOverrun.status.flags.fltstat = 1; // Set/ret fault condition as present/active
-    fltobj_CPULoadOverrun.status.flags.fltactive = 1; // Set/reset fault condition as present/active
-    fltobj_CPULoadOverrun.status.flags.fltchken = 1; // Enable/disable fault check
-
-    return(1);
-    
-}
-
-/*!init_TaskExecutionFaultObject
- * ***********************************************************************************************
- * Description:
- * The fltobj_TaskExecutionFailure is initialized here. This fault detects conditions where a 
- * user defined task called by the main scheduler returns a failure flag
- * ***********************************************************************************************/
-
-inline uint16_t init_TaskExecutionFaultObject(void)
-{
-    // Configuring the Task Execution Failure fault object
-
-    // specify the target value/register to be monitored
-    fltobj_TaskExecutionFailure.object = &task_mgr.proc_code.segments.retval;
-    fltobj_TaskExecutionFailure.object_bit_mask = FAULT_OBJECT_BIT_MASK_DEFAULT;
-    fltobj_TaskExecutionFailure.error_code = (uint32_t)FLTOBJ_TASK_EXECUTION_FAILURE;
-    fltobj_TaskExecutionFailure.id = (uint16_t)FLTOBJ_TASK_EXECUTION_FAILURE;
-    
-    // configuring the trip and reset levels as well as trip and reset event filter setting
-    fltobj_TaskExecutionFailure.criteria.counter = 0;      // Set/reset fault counter
-    fltobj_TaskExecutionFailure.criteria.fault_ratio = FAULT_LEVEL_NOT_EQUAL;
-    fltobj_TaskExecutionFailure.criteria.trip_level = 1;   // Set/reset trip level value
-    fltobj_TaskExecutionFailure.criteria.trip_cnt_threshold = 1; // Set/reset number of successive trips before triggering fault event
-    fltobj_TaskExecutionFailure.criteria.reset_level = 0;  // Set/reset fault release level value
-    fltobj_TaskExecutionFailure.criteria.reset_cnt_threshold = 1; // Set/reset number of successive resets before triggering fault release
-
-    // specifying fault class, fault level and enable/disable status
-    fltobj_TaskExecutionFailure.classes.flags.notify = 0;   // Set =1 if this fault object triggers a fault condition notification
-    fltobj_TaskExecutionFailure.classes.flags.warning = 1;  // Set =1 if this fault object triggers a warning fault condition response
-    fltobj_TaskExecutionFailure.classes.flags.critical = 0; // Set =1 if this fault object triggers a critical fault condition response
-    fltobj_TaskExecutionFailure.classes.flags.catastrophic = 0; // Set =1 if this fault object triggers a catastrophic fault condition response
-
-    fltobj_TaskExecutionFailure.classes.flags.user_class = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_TaskExecutionFailure.user_fault_action = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_TaskExecutionFailure.user_fault_reset = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-        
-    fltobj_TaskExecutionFailure.status.flags.fltlvlhw = 0; // Set =1 if this fault condition is board-level fault condition
-    fltobj_TaskExecutionFailure.status.flags.fltlvlsw = 1; // Set =1 if this fault condition is software-level fault condition
-    fltobj_TaskExecutionFailure.status.flags.fltlvlsi = 0; // Set =1 if this fault condition is silicon-level fault condition
-    fltobj_TaskExecutionFailure.status.flags.fltlvlsys = 0; // Set =1 if this fault condition is system-level fault condition
-
-    fltobj_TaskExecutionFailure.status.flags.fltstat = 1; // Set/ret fault condition as present/active
-    fltobj_TaskExecutionFailure.status.flags.fltactive = 1; // Set/reset fault condition as present/active
-    fltobj_TaskExecutionFailure.status.flags.fltchken = 1; // Enable/disable fault check
-
-    return(1);
-    
-}
-
-/*!init_TaskTimeQuotaViolationFaultObject
- * ***********************************************************************************************
- * Description:
- * The fltobj_TaskTimeQuotaViolation is initialized here. This fault detects conditions where a 
- * user defined task takes more time than defined in the user task time quota or exceeds the 
- * maximum time quota defined within the task manager data structure.
- * ***********************************************************************************************/
-
-inline uint16_t init_TaskTimeQuotaViolationFaultObject(void)
-{
-    // Configuring the Task Time Quota Violation fault object
-    fltobj_TaskTimeQuotaViolation.object = &task_mgr.task_time_ctrl.maximum;
-    fltobj_TaskTimeQuotaViolation.object_bit_mask = FAULT_OBJECT_BIT_MASK_DEFAULT;
-    fltobj_TaskTimeQuotaViolation.error_code = (uint32_t)FLTOBJ_TASK_TIME_QUOTA_VIOLATION;
-    fltobj_TaskTimeQuotaViolation.id = (uint16_t)FLTOBJ_TASK_TIME_QUOTA_VIOLATION;
-
-
-    // configuring the trip and reset levels as well as trip and reset event filter setting
-    fltobj_TaskTimeQuotaViolation.criteria.counter = 0;      // Set/reset fault counter
-    fltobj_TaskTimeQuotaViolation.criteria.fault_ratio = FAULT_LEVEL_GREATER_THAN;
-    fltobj_TaskTimeQuotaViolation.criteria.trip_level = (task_mgr.task_time_ctrl.quota - (task_mgr.task_time_ctrl.quota >> 3));   // Set/reset trip level value
-    fltobj_TaskTimeQuotaViolation.criteria.trip_cnt_threshold = 1; // Set/reset number of successive trips before triggering fault event
-    fltobj_TaskTimeQuotaViolation.criteria.reset_level = (task_mgr.task_time_ctrl.quota - (task_mgr.task_time_ctrl.quota >> 2));  // Set/reset fault release level value
-    fltobj_TaskTimeQuotaViolation.criteria.reset_cnt_threshold = 10; // Set/reset number of successive resets before triggering fault release
-        
-    // specifying fault class, fault level and enable/disable status
-    fltobj_TaskTimeQuotaViolation.classes.flags.notify = 0;   // Set =1 if this fault object triggers a fault condition notification
-    fltobj_TaskTimeQuotaViolation.classes.flags.warning = 1;  // Set =1 if this fault object triggers a warning fault condition response
-    fltobj_TaskTimeQuotaViolation.classes.flags.critical = 0; // Set =1 if this fault object triggers a critical fault condition response
-    fltobj_TaskTimeQuotaViolation.classes.flags.catastrophic = 0; // Set =1 if this fault object triggers a catastrophic fault condition response
-
-    fltobj_TaskTimeQuotaViolation.classes.flags.user_class = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_TaskTimeQuotaViolation.user_fault_action = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_TaskTimeQuotaViolation.user_fault_reset = 0; // Set =1 if this fault object triggers a user-defined fault condition response
-        
-    fltobj_TaskTimeQuotaViolation.status.flags.fltlvlhw = 0; // Set =1 if this fault condition is board-level fault condition
-    fltobj_TaskTimeQuotaViolation.status.flags.fltlvlsw = 1; // Set =1 if this fault condition is software-level fault condition
-    fltobj_TaskTimeQuotaViolation.status.flags.fltlvlsi = 0; // Set =1 if this fault condition is silicon-level fault condition
-    fltobj_TaskTimeQuotaViolation.status.flags.fltlvlsys = 0; // Set =1 if this fault condition is system-level fault condition
-
-    fltobj_TaskTimeQuotaViolation.status.flags.fltstat = 1; // Set/ret fault condition as present/active
-    fltobj_TaskTimeQuotaViolation.status.flags.fltactive = 1; // Set/reset fault condition as present/active
-    fltobj_TaskTimeQuotaViolation.status.flags.fltchken = 1; // Enable/disable fault check
-
-    return(1);
-}
-
-
-/*!init_PowerSourceFaultObject
- * ***********************************************************************************************
- * Description:
- * The fltobj_PowerSourceFailure is initialized here. This fault object captures the condition 
- * when no power source is available (no AC source and no batteries)
- * ***********************************************************************************************/
-
-inline uint16_t init_MyCustomFaultObject(void)
-{
-    // Configuring the Task Time Quota Violation fault object
-    fltobj_PowerSourceFailure.object = &application.ctrl_status.value;
-    fltobj_PowerSourceFailure.object_bit_mask = CTRL_STAT_POWERSOURCE_DETECTED;
-    fltobj_PowerSourceFailure.error_code = (uint32_t)FLTOBJ_POWER_SOURCE_FAILURE;
-    fltobj_PowerSourceFailure.id = (uint16_t)FLTOBJ_POWER_SOURCE_FAILURE;
-
-    // configuring the trip and reset levels as well as trip and reset event filter setting
-    fltobj_PowerSourceFailure.criteria.counter = 0;      // Set/reset fault counter
-    fltobj_PowerSourceFailure.criteria.fault_ratio = FAULT_LEVEL_EQUAL;
-    fltobj_PowerSourceFailure.criteria.trip_level = 0;   // Set/reset trip level value
-    fltobj_PowerSourceFailure.criteria.trip_cnt_threshold = 1; // Set/reset number of successive trips before triggering fault event
-    fltobj_PowerSourceFailure.criteria.reset_level = 1;  // Set/reset fault release level value
-    fltobj_PowerSourceFailure.criteria.reset_cnt_threshold = 3; // Set/reset number of successive resets before triggering fault release
-
-    // specifying fault class, fault level and enable/disable status
-    fltobj_PowerSourceFailure.classes.flags.notify = 0;   // Set =1 if this fault object triggers a fault condition notification
-    fltobj_PowerSourceFailure.classes.flags.warning = 0;  // Set =1 if this fault object triggers a warning fault condition response
-    fltobj_PowerSourceFailure.classes.flags.critical = 1; // Set =1 if this fault object triggers a critical fault condition response
-    fltobj_PowerSourceFailure.classes.flags.catastrophic = 0; // Set =1 if this fault object triggers a catastrophic fault condition response
-
-    fltobj_PowerSourceFailure.classes.flags.user_class = 1; // Set =1 if this fault object triggers a user-defined fault condition response
-    fltobj_PowerSourceFailure.user_fault_action = 0; // Set = 0 if no function should be called, Set= [function pointer] to function which should be executed
-    fltobj_PowerSourceFailure.user_fault_reset = 0; // Set = 0 if no function should be called, Set = [function pointer] to function which should be executed
-
-    fltobj_PowerSourceFailure.status.flags.fltlvlhw = 1; // Set =1 if this fault condition is board-level fault condition
-    fltobj_PowerSourceFailure.status.flags.fltlvlsw = 0; // Set =1 if this fault condition is software-level fault condition
-    fltobj_PowerSourceFailure.status.flags.fltlvlsi = 0; // Set =1 if this fault condition is silicon-level fault condition
-    fltobj_PowerSourceFailure.status.flags.fltlvlsys = 1; // Set =1 if this fault condition is system-level fault condition
-
-    fltobj_PowerSourceFailure.status.flags.fltstat = 1; // Set/reset fault condition as present/active
-    fltobj_PowerSourceFailure.status.flags.fltactive = 1; // Set/reset fault condition as present/active
-    fltobj_PowerSourceFailure.status.flags.fltchken = 1; // Enable/disable fault check
-
-    return(1);
-}
-
+// EOF
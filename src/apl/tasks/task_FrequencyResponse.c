@@ -0,0 +1,370 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_FrequencyResponse.c
+ * *****************************************************************************
+ * File:   task_FrequencyResponse.c
+ * Author: M91406
+ *
+ * Description:
+ * Injects a sinusoidal perturbation into the reference of the output voltage 
+ * control loop, measures the loop gain at logarithmically spaced frequencies 
+ * and sends the results as telemetry response frames.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_FrequencyResponse.h"
+
+/* private function prototypes */
+inline volatile uint16_t fra_PointStart(void);
+inline volatile uint16_t fra_PointEvaluate(void);
+inline volatile uint16_t fra_Stop(void);
+inline volatile uint16_t fra_Send(void);
+
+volatile FREQUENCY_RESPONSE_t fra;
+
+#define FRA_RAD_TO_CENTIDEGREE      (float)(18000.0 / 3.14159265) // Conversion of radian into 0.01 degree
+
+#if (USE_FREQUENCY_RESPONSE_ANALYZER == 1)
+
+/*!fra_sine_table
+ * ***********************************************************************************************
+ * Description:
+ * One period of the sine function in Q15 format located in program memory (auto_psv section). 
+ * The cosine is read with an index offset of FRA_COSINE_OFFSET.
+ * ***********************************************************************************************/
+const int16_t fra_sine_table[FRA_SINE_TABLE_SIZE] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+     32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+     27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+     18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+      6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+     -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+     -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804
+};
+
+/*!fra_Sample
+ * ***********************************************************************************************
+ * Description:
+ * Called by the control loop interrupt through FRA_SAMPLE() while a sweep is active. Writes the 
+ * perturbed reference read by the control loop in the same interrupt and accumulates the 
+ * fundamentals of the perturbation and of the feedback deviation from the unperturbed reference.
+ * Each full period of the phase accumulator counts down the periods of the recent state.
+ * 
+ * The perturbation is suspended in FRA_STATE_EVALUATE. When the converter leaves 
+ * SOFT_START_STEP_COMPLETE, the unperturbed reference is restored immediately and the sweep 
+ * is flagged as aborted.
+ * ***********************************************************************************************/
+volatile uint16_t fra_Sample(void) {
+    
+    volatile cNPNZ16b_t* loop = converter[CONVERTER_VOUT].controller;
+    uint16_t index = 0;
+    int16_t sine = 0, cosine = 0, d = 0, y = 0;
+    
+    if (converter[CONVERTER_VOUT].soft_start.step != SOFT_START_STEP_COMPLETE)
+    {
+        loop->ptrControlReference = fra.ptrReference;
+        fra.status.flags.active = false;
+        fra.status.flags.aborted = true;
+        return(1);
+    }
+    
+    if ((fra.state != FRA_STATE_SETTLE) && (fra.state != FRA_STATE_MEASURE))
+    {
+        fra.reference = *fra.ptrReference;
+        return(1);
+    }
+    
+    index = (uint16_t)(fra.phase >> 24);
+    sine = fra_sine_table[index];
+    cosine = fra_sine_table[(index + FRA_COSINE_OFFSET) & (FRA_SINE_TABLE_SIZE - 1)];
+    d = (int16_t)(((int32_t)fra.amplitude * sine) >> 15);
+    fra.reference = (*fra.ptrReference + d);
+    
+    if (fra.state == FRA_STATE_MEASURE)
+    {
+        y = ((int16_t)*loop->ptrSourceRegister - loop->InputOffset) - (int16_t)*fra.ptrReference;
+        fra.injection.re += (((int32_t)d * cosine) >> FRA_PRODUCT_SHIFT);
+        fra.injection.im -= (((int32_t)d * sine) >> FRA_PRODUCT_SHIFT);
+        fra.response.re += (((int32_t)y * cosine) >> FRA_PRODUCT_SHIFT);
+        fra.response.im -= (((int32_t)y * sine) >> FRA_PRODUCT_SHIFT);
+    }
+    
+    fra.phase += fra.increment;
+    if (fra.phase < fra.increment) // full period of the perturbation
+    {
+        if (--fra.periods == 0)
+        {
+            if (fra.state == FRA_STATE_SETTLE)
+            {
+                fra.periods = fra.measure_periods;
+                fra.state = FRA_STATE_MEASURE;
+            }
+            else
+            { fra.state = FRA_STATE_EVALUATE; }
+        }
+    }
+    
+    return(1);
+}
+
+#endif
+
+/*!init_FrequencyResponse
+ * ***********************************************************************************************
+ * Description:
+ * Resets the frequency response analyzer and loads the default perturbation amplitude. The 
+ * unperturbed reference is the reference variable of the output voltage converter instance.
+ * ***********************************************************************************************/
+volatile uint16_t init_FrequencyResponse(void) {
+    
+    fra.status.value = 0;
+    fra.state = FRA_STATE_IDLE;
+    fra.command = FRA_COMMAND_NONE;
+    fra.amplitude = FRA_AMPLITUDE;
+    fra.point = 0;
+    fra.ptrReference = converter[CONVERTER_VOUT].ptrReference;
+    fra.reference = *fra.ptrReference;
+    
+    return(1);
+}
+
+/*!exec_FrequencyResponse
+ * ***********************************************************************************************
+ * Description:
+ * This task is called by the normal operation task queue. It executes pending commands, 
+ * evaluates each measured point, sends its result and starts the next point of the sweep. 
+ * When a result cannot be handed over to the telemetry task (previous response still pending),
+ * it is sent with the next call. The sweep is paused in the meantime.
+ * ***********************************************************************************************/
+volatile uint16_t exec_FrequencyResponse(void) {
+    
+    volatile uint16_t fres = 1;
+    
+    // Sweep aborted by the control loop interrupt (converter left steady state)
+    if (fra.status.flags.aborted)
+    {
+        fra.status.flags.aborted = false;
+        fra.state = FRA_STATE_IDLE;
+        fra.result = FRA_STATUS_ABORTED;
+        fra.status.flags.pending = true;
+    }
+    
+    // Commands written by the parameter access protocol
+    if (fra.command == FRA_COMMAND_START)
+    {
+        if ((!fra.status.flags.active) && (!fra.status.flags.pending) && 
+            (converter[CONVERTER_VOUT].soft_start.step == SOFT_START_STEP_COMPLETE))
+        {
+            fra.point = 0;
+            fra.frequency = FRA_FREQUENCY_START;
+            fres &= fra_PointStart();
+            
+            fra.reference = *fra.ptrReference;
+            fra.status.flags.active = true;
+            converter[CONVERTER_VOUT].controller->ptrControlReference = &fra.reference;
+        }
+    }
+    else if ((fra.command == FRA_COMMAND_STOP) && (fra.status.flags.active))
+    {
+        fres &= fra_Stop();
+        fra.result = FRA_STATUS_ABORTED;
+        fra.status.flags.pending = true;
+    }
+    fra.command = FRA_COMMAND_NONE;
+    
+    // Evaluation of the recent point
+    if ((fra.state == FRA_STATE_EVALUATE) && (!fra.status.flags.pending))
+    {
+        fres &= fra_PointEvaluate();
+        fra.status.flags.pending = true;
+    }
+    
+    // Result transmission and next point
+    if (fra.status.flags.pending)
+    {
+        if (fra_Send())
+        {
+            fra.status.flags.pending = false;
+            
+            if (fra.state == FRA_STATE_EVALUATE)
+            {
+                fra.point++;
+                fra.frequency *= FRA_FREQUENCY_RATIO;
+                
+                if (fra.frequency <= FRA_FREQUENCY_STOP)
+                { fres &= fra_PointStart(); }
+                else
+                {
+                    fres &= fra_Stop();
+                    fra.result = FRA_STATUS_SWEEP_COMPLETE;
+                    fra.status.flags.pending = true;
+                }
+            }
+        }
+    }
+    
+    return(fres);
+}
+
+/*!fra_PointStart
+ * ***********************************************************************************************
+ * Description:
+ * Resets the accumulators and the phase for the recent frequency. The number of measured 
+ * periods is limited to keep the number of accumulated samples below FRA_SAMPLES_MAX. The 
+ * state is written last to hand over the point to the control loop interrupt.
+ * ***********************************************************************************************/
+inline volatile uint16_t fra_PointStart(void) {
+    
+    volatile float samples_per_period = (CVMC_VOUT_SAMPLING_FREQUENCY / fra.frequency);
+    
+    fra.increment = (uint32_t)(4294967296.0 / samples_per_period);
+    fra.phase = 0;
+    
+    fra.measure_periods = (uint16_t)((float)FRA_SAMPLES_MAX / samples_per_period);
+    if (fra.measure_periods > FRA_MEASURE_PERIODS) 
+    { fra.measure_periods = FRA_MEASURE_PERIODS; }
+    else if (fra.measure_periods == 0) 
+    { fra.measure_periods = 1; }
+    fra.periods = FRA_SETTLE_PERIODS;
+    
+    fra.injection.re = 0;
+    fra.injection.im = 0;
+    fra.response.re = 0;
+    fra.response.im = 0;
+    
+    fra.state = FRA_STATE_SETTLE;
+    
+    return(1);
+}
+
+/*!fra_PointEvaluate
+ * ***********************************************************************************************
+ * Description:
+ * Calculates the loop gain L = Y / (D - Y) of the recent point from the accumulated 
+ * fundamentals. The point is invalid when no error signal has been measured.
+ * ***********************************************************************************************/
+inline volatile uint16_t fra_PointEvaluate(void) {
+    
+    volatile float y_re = (float)fra.response.re, y_im = (float)fra.response.im;
+    volatile float e_re = ((float)fra.injection.re - y_re);
+    volatile float e_im = ((float)fra.injection.im - y_im);
+    volatile float e_mag2 = ((e_re * e_re) + (e_im * e_im));
+    volatile float y_mag2 = ((y_re * y_re) + (y_im * y_im));
+    
+    if ((e_mag2 > 0.0) && (y_mag2 > 0.0))
+    {
+        fra.loop_gain = (int16_t)(1000.0 * log10f(y_mag2 / e_mag2)); // 10 * log10(|L|^2) in 0.01 dB
+        fra.loop_phase = (int16_t)(FRA_RAD_TO_CENTIDEGREE * 
+                atan2f(((y_im * e_re) - (y_re * e_im)), ((y_re * e_re) + (y_im * e_im))));
+        fra.result = FRA_STATUS_OK;
+    }
+    else
+    {
+        fra.loop_gain = 0;
+        fra.loop_phase = 0;
+        fra.result = FRA_STATUS_INVALID;
+    }
+    
+    return(1);
+}
+
+/*!fra_Stop
+ * ***********************************************************************************************
+ * Description:
+ * Ends the sweep and restores the unperturbed reference of the control loop
+ * ***********************************************************************************************/
+inline volatile uint16_t fra_Stop(void) {
+    
+    fra.status.flags.active = false;
+    converter[CONVERTER_VOUT].controller->ptrControlReference = fra.ptrReference;
+    fra.state = FRA_STATE_IDLE;
+    
+    return(1);
+}
+
+/*!fra_Send
+ * ***********************************************************************************************
+ * Description:
+ * Hands over the result of the recent point, or the end of the sweep, to the telemetry task. 
+ * Returns 0 if the previous response has not been sent yet.
+ * ***********************************************************************************************/
+inline volatile uint16_t fra_Send(void) {
+    
+    volatile uint8_t response[11];
+    volatile uint32_t frequency = 0;
+    volatile int16_t gain = 0, phase = 0;
+    volatile uint16_t i = 0;
+    
+    if ((fra.result == FRA_STATUS_OK) || (fra.result == FRA_STATUS_INVALID))
+    { 
+        frequency = (uint32_t)(10.0 * fra.frequency); 
+        gain = fra.loop_gain;
+        phase = fra.loop_phase;
+    }
+    
+    response[0] = FRA_RESPONSE_POINT;
+    response[1] = (uint8_t)fra.point;
+    response[2] = fra.result;
+    for (i=0; i<4; i++) 
+    { response[3 + i] = (uint8_t)(frequency >> (i << 3)); }
+    response[7] = (uint8_t)gain;
+    response[8] = (uint8_t)((uint16_t)gain >> 8);
+    response[9] = (uint8_t)phase;
+    response[10] = (uint8_t)((uint16_t)phase >> 8);
+    
+    return(telemetry_Respond(&response[0], sizeof(response)));
+}
+
+// EOF
@@ -0,0 +1,156 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_MsiExchange.c
+ * *****************************************************************************
+ * File:   task_MsiExchange.c
+ * Author: M91406
+ *
+ * Description:
+ * Application data mapping of the master/slave core data exchange (see 
+ * task_MsiExchange.h)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_MsiExchange.h"
+#include "_root/generic/task_manager.h"
+
+/*!init_MsiExchange
+ * ***********************************************************************************************
+ * Description:
+ * Initializes the master/slave data exchange. On the master core the slave core is programmed 
+ * and started.
+ * ***********************************************************************************************/
+volatile uint16_t init_MsiExchange(void) {
+
+#if (MSI_CORE_ROLE != MSI_ROLE_NONE)
+    return(msi_Init());
+#else
+    return(1);
+#endif
+
+}
+
+/*!exec_MsiExchange
+ * ***********************************************************************************************
+ * Description:
+ * Publishes the most recent data of this core, performs the mailbox transfer and applies the 
+ * most recent data set received from the other core.
+ * 
+ * Master core:
+ * The slave core feedback data and control status are copied into the application data 
+ * structure. When the slave core reports the completion of its startup sequence, the master
+ * core task manager is switched from OP_MODE_SYSTEM_STARTUP into OP_MODE_NORMAL. When the link 
+ * is lost, the control status is cleared.
+ * 
+ * Slave core:
+ * The running converter is ramped down when the master core withdraws the RUN command, sets the 
+ * fault override command or when the link is lost. When the converter has been turned off and 
+ * the RUN command is set again, the slave core restarts its system startup sequence.
+ * ***********************************************************************************************/
+volatile uint16_t exec_MsiExchange(void) {
+    
+    volatile uint16_t fres = 1;
+    
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+
+    volatile MSI_M2S_DATA_t* tx = msi_TxData();
+    volatile MSI_S2M_DATA_t* rx;
+    
+    tx->command = (task_mgr.status.flags.fault_override) ? MSI_CMD_FAULT_OVERRIDE : MSI_CMD_RUN;
+    tx->op_mode = (uint16_t)task_mgr.op_mode.mode;
+    tx->v_reference = 0; // use the slave core default reference
+    
+    fres &= msi_Publish();
+    fres &= msi_Transfer();
+    
+    if (msi.status.flags.link_lost)
+    {
+        application.ctrl_status.value = 0;
+        return(fres);
+    }
+    
+    rx = msi_RxData();
+    application.data.v_in = rx->v_in;
+    application.data.i_in = rx->i_in;
+    application.data.v_out = rx->v_out;
+    application.data.i_out = rx->i_out;
+    application.data.temperature = rx->temperature;
+    application.ctrl_status.value = rx->ctrl_status;
+    
+    // The startup sequence is executed by the slave core
+    if ((task_mgr.op_mode.mode == OP_MODE_SYSTEM_STARTUP) && 
+        (application.ctrl_status.flags.system_ready))
+    { task_mgr.op_mode.mode = OP_MODE_NORMAL; }
+    
+#elif (MSI_CORE_ROLE == MSI_ROLE_SLAVE)
+
+    volatile MSI_S2M_DATA_t* tx = msi_TxData();
+    volatile MSI_M2S_DATA_t* rx;
+    volatile bool run = false;
+    volatile bool off = false;
+    volatile uint16_t i = 0;
+    
+    tx->v_in = application.data.v_in;
+    tx->i_in = application.data.i_in;
+    tx->v_out = application.data.v_out;
+    tx->i_out = application.data.i_out;
+    tx->temperature = application.data.temperature;
+    tx->ctrl_status = application.ctrl_status.value;
+    tx->control_output = *cvmc_vout.ptrTargetRegister;
+    
+    fres &= msi_Publish();
+    fres &= msi_Transfer();
+    
+    rx = msi_RxData();
+    
+    if (msi.status.flags.link_active)
+    {
+        run = (volatile bool)((rx->command & (MSI_CMD_RUN | MSI_CMD_FAULT_OVERRIDE)) == MSI_CMD_RUN);
+        if (rx->v_reference != 0) // applied with the next ramp-up
+        { converter[CONVERTER_PRIMARY].soft_start.v_target = rx->v_reference; }
+    }
+    
+    if (!run)
+    { 
+        for (i = 0; i < CONVERTER_COUNT; i++)
+        { soft_start_Stop(&converter[i]); } // returns 0 when the converter is not running
+    }
+    else
+    {
+        off = true;
+        for (i = 0; i < CONVERTER_COUNT; i++)
+        { off &= (converter[i].soft_start.step == SOFT_START_STEP_OFF); }
+        if (off)
+        { task_mgr.op_mode.mode = OP_MODE_SYSTEM_STARTUP; } // restart the startup sequence
+    }
+    
+#endif
+
+    return(fres);
+}
@@ -0,0 +1,295 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Parameters.c
+ * *****************************************************************************
+ * File:   task_Parameters.c
+ * Author: M91406
+ *
+ * Description:
+ * Runtime parameter access protocol (see task_Parameters.h and parameters.h)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "apl/apl.h"
+#include "apl/config/parameters.h"
+#include "apl/tasks/task_Parameters.h"
+#include "_root/generic/task_manager.h"
+
+/*!PARAMETER_t
+ * ***********************************************************************************************
+ * Descriptor of one registered parameter
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint8_t* address; // Address of the variable
+    uint16_t size; // Size of the variable in bytes
+    int32_t minimum; // Minimum value accepted by write requests
+    int32_t maximum; // Maximum value accepted by write requests
+    uint16_t flags; // Access flags PARAM_FLAG_xxx
+} PARAMETER_t;
+
+#define PARAMETER_REGISTRY_ITEM(id, variable, minimum, maximum, flags)  \
+    { (volatile uint8_t*)&(variable), sizeof(variable), (int32_t)(minimum), (int32_t)(maximum), (flags) },
+
+// Parameter table generated from the parameter registry
+const PARAMETER_t parameter_table[PARAMETER_COUNT] = {
+    PARAMETER_REGISTRY(PARAMETER_REGISTRY_ITEM)
+};
+
+// Compile-time check of the parameter sizes supported by parameter_GetValue() (1, 2 or 4 bytes)
+#define PARAMETER_REGISTRY_SIZE_CHECK(id, variable, minimum, maximum, flags)  \
+    typedef char id##_size_check[((sizeof(variable) == 1) || (sizeof(variable) == 2) || (sizeof(variable) == 4)) ? 1 : -1];
+
+PARAMETER_REGISTRY(PARAMETER_REGISTRY_SIZE_CHECK)
+
+#define PARAM_RESPONSE_HEADER_SIZE      5       // Request type, sequence, status and parameter ID
+#define PARAM_REQUEST_HEADER_SIZE       4       // Request type, sequence and parameter ID
+#define PARAM_INFO_SIZE                 10      // Size, flags, minimum and maximum
+
+volatile PARAMETER_STATUS_t parameters;
+
+// Decoded request frame
+volatile uint8_t parameter_request[PARAM_REQUEST_SIZE];
+
+/* private function prototypes */
+volatile uint16_t parameter_DecodeByte(volatile uint8_t data);
+volatile uint16_t parameter_Execute(void);
+volatile int32_t parameter_GetValue(volatile uint8_t* data, volatile const PARAMETER_t* param);
+
+/*!init_Parameters
+ * ***********************************************************************************************
+ * Description:
+ * Resets the request decoder and synchronizes the read position with the receive ring buffer.
+ * Bytes received before the initialization are discarded.
+ * ***********************************************************************************************/
+volatile uint16_t init_Parameters(void) {
+    
+    parameters.requests = 0;
+    parameters.rejected = 0;
+    parameters.writes = 0;
+    parameters.rx_read = uart_DmaRxPosition();
+    parameters.length = 0;
+    parameters.code = 0;
+    parameters.block = 0;
+    parameters.overflow = false;
+    
+    return(1);
+}
+
+/*!exec_Parameters
+ * ***********************************************************************************************
+ * Description:
+ * Decodes received bytes until a complete request frame has been found or the receive ring 
+ * buffer is empty. A complete request is executed and its response handed over to the 
+ * telemetry task. At most one request is executed per call. While the previous response is
+ * still waiting to be framed, received bytes are left in the ring buffer.
+ * ***********************************************************************************************/
+volatile uint16_t exec_Parameters(void) {
+    
+    volatile uint16_t rx_write = 0;
+    volatile uint8_t data = 0;
+    
+    #if (USE_PARAMETER_ACCESS == 1)
+    
+    if (telemetry.response_pending)
+    { return(1); }
+    
+    rx_write = uart_DmaRxPosition();
+    
+    while (parameters.rx_read != rx_write) {
+        
+        data = uart_rx_buffer[parameters.rx_read];
+        if (++parameters.rx_read >= UART_RX_BUFFER_SIZE) 
+        { parameters.rx_read = 0; }
+        
+        if (parameter_DecodeByte(data)) {
+            parameter_Execute();
+            break;
+        }
+    }
+    
+    #endif
+    
+    return(1);
+}
+
+/*!parameter_DecodeByte
+ * ***********************************************************************************************
+ * Description:
+ * Adds one received byte to the COBS decoder. Returns 1 when a frame delimiter completing a 
+ * valid request frame (framing and CRC) has been received. Returns 0 otherwise.
+ * ***********************************************************************************************/
+volatile uint16_t parameter_DecodeByte(volatile uint8_t data) {
+    
+    volatile uint16_t fres = 0;
+    
+    if (data == 0x00) {
+        fres = ((!parameters.overflow) && (parameters.block == 0) && 
+                (parameters.length >= (PARAM_REQUEST_HEADER_SIZE + 2)));
+        if (fres)
+        { fres = (telemetry_Crc16(&parameter_request[0], parameters.length) == 0); } // CRC over data and CRC is zero
+        if ((!fres) && (parameters.length > 0))
+        { parameters.rejected++; }
+        
+        parameters.length = 0;
+        parameters.code = 0;
+        parameters.block = 0;
+        parameters.overflow = false;
+        return(fres);
+    }
+    
+    if (parameters.length >= PARAM_REQUEST_SIZE)
+    { parameters.overflow = true; }
+    else if (parameters.block == 0) {
+        // code byte: the previous block ended with an implicit zero unless it was a full block
+        if ((parameters.code != 0) && (parameters.code != 0xFF))
+        { parameter_request[parameters.length++] = 0x00; }
+        parameters.code = data;
+        parameters.block = (data - 1);
+    }
+    else {
+        parameter_request[parameters.length++] = data;
+        parameters.block--;
+    }
+    
+    return(0);
+}
+
+/*!parameter_Execute
+ * ***********************************************************************************************
+ * Description:
+ * Executes the decoded request and hands over the response to the telemetry task. Writes to 
+ * parameters shared with interrupt service routines are executed with interrupts of priority 
+ * levels 1-6 suspended. After a fault object setting has been written, the fault engine is 
+ * recompiled.
+ * ***********************************************************************************************/
+volatile uint16_t parameter_Execute(void) {
+    
+    volatile uint8_t response[PARAM_RESPONSE_HEADER_SIZE + PARAM_INFO_SIZE];
+    volatile uint16_t length = PARAM_RESPONSE_HEADER_SIZE;
+    volatile uint16_t id=0, size=0, i=0;
+    volatile uint8_t status = PARAM_STATUS_OK;
+    volatile int32_t value = 0;
+    volatile const PARAMETER_t* param = NULL;
+    
+    id = ((uint16_t)parameter_request[3] << 8) | (uint16_t)parameter_request[2];
+    size = (parameters.length - PARAM_REQUEST_HEADER_SIZE - 2); // value bytes behind parameter ID
+    
+    if (id >= PARAMETER_COUNT) { 
+        status = PARAM_STATUS_UNKNOWN_ID; 
+    }
+    else if (parameter_request[0] == PARAM_REQUEST_WRITE) {
+        
+        param = &parameter_table[id]; // Parameter ID has been validated
+        
+        if (param->flags & PARAM_FLAG_READ_ONLY) 
+        { status = PARAM_STATUS_READ_ONLY; }
+        else if (size != param->size)
+        { status = PARAM_STATUS_INVALID_LENGTH; }
+        else {
+            value = parameter_GetValue(&parameter_request[PARAM_REQUEST_HEADER_SIZE], param); // Size has been validated
+            if ((value < param->minimum) || (value > param->maximum))
+            { status = PARAM_STATUS_OUT_OF_RANGE; }
+        }
+        
+        if (status == PARAM_STATUS_OK) {
+            
+            if ((param->flags & PARAM_FLAG_ISR_SHARED) && (param->size == 2))
+            { *(volatile uint16_t*)param->address = (uint16_t)value; } // Single word write is atomic
+            else {
+                
+                if (param->flags & PARAM_FLAG_ISR_SHARED)
+                { __builtin_disi(0x3FFF); } // Suspend interrupts of priority levels 1-6
+
+                for (i=0; i<param->size; i++)
+                { param->address[i] = parameter_request[PARAM_REQUEST_HEADER_SIZE + i]; }
+
+                if (param->flags & PARAM_FLAG_ISR_SHARED)
+                { __builtin_disi(0x0000); } // Resume interrupts
+            }
+
+            #if (USE_FAULT_ENGINE == 1)
+            if (param->flags & PARAM_FLAG_FAULT_LEVEL)
+            { fault_EngineCompile(); }
+            #endif
+            
+            parameters.writes++;
+        }
+    }
+    else if ((parameter_request[0] != PARAM_REQUEST_READ) && (parameter_request[0] != PARAM_REQUEST_INFO)) {
+        status = PARAM_STATUS_UNKNOWN_REQUEST;
+    }
+    else {
+        param = &parameter_table[id]; // Parameter ID has been validated
+    }
+    
+    // Response data
+    if ((status == PARAM_STATUS_OK) && (parameter_request[0] == PARAM_REQUEST_INFO)) {
+        response[length++] = (uint8_t)param->size;
+        response[length++] = (uint8_t)param->flags;
+        for (i=0; i<4; i++) 
+        { response[length++] = (uint8_t)((uint32_t)param->minimum >> (i << 3)); }
+        for (i=0; i<4; i++) 
+        { response[length++] = (uint8_t)((uint32_t)param->maximum >> (i << 3)); }
+    }
+    else if (status == PARAM_STATUS_OK) {
+        for (i=0; i<param->size; i++)
+        { response[length++] = param->address[i]; }
+    }
+    
+    response[0] = parameter_request[0];
+    response[1] = parameter_request[1];
+    response[2] = status;
+    response[3] = parameter_request[2];
+    response[4] = parameter_request[3];
+    
+    parameters.requests++;
+    
+    return(telemetry_Respond(&response[0], length));
+}
+
+/*!parameter_GetValue
+ * ***********************************************************************************************
+ * Description:
+ * Converts the little endian value of the size of the given parameter into a 32-bit integer, 
+ * sign-extended for signed parameters.
+ * ***********************************************************************************************/
+volatile int32_t parameter_GetValue(volatile uint8_t* data, volatile const PARAMETER_t* param) {
+    
+    volatile uint32_t value = 0;
+    volatile uint16_t i = 0;
+    
+    for (i=0; i<param->size; i++) 
+    { value |= ((uint32_t)data[i] << (i << 3)); }
+    
+    if ((param->flags & PARAM_FLAG_SIGNED) && (param->size < 4) && 
+        (value & (1UL << ((param->size << 3) - 1))))
+    { value |= (0xFFFFFFFFUL << (param->size << 3)); }
+    
+    return((int32_t)value);
+}
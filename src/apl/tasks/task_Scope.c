@@ -0,0 +1,298 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Scope.c
+ * *****************************************************************************
+ * File:   task_Scope.c
+ * Author: M91406
+ *
+ * Description:
+ * Records the channels of the scope registry in the control loop interrupt 
+ * around a trigger event and sends the frozen capture as telemetry response 
+ * frames.
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/config/telemetry.h"
+#include "apl/tasks/task_Scope.h"
+
+/* private function prototypes */
+inline volatile uint16_t scope_Arm(void);
+inline volatile uint16_t scope_SendHeader(void);
+inline volatile uint16_t scope_SendData(void);
+
+#if ((USE_SCOPE == 1) && (SCOPE_AUTO_ARM == 1))
+  #define SCOPE_INIT_STATUS             SCOPE_STATUS_RECORDING
+  #define SCOPE_INIT_STATE              SCOPE_STATE_PRETRIGGER
+#else
+  #define SCOPE_INIT_STATUS             0
+  #define SCOPE_INIT_STATE              SCOPE_STATE_IDLE
+#endif
+
+volatile uint16_t scope_buffer[SCOPE_DEPTH * SCOPE_CHANNEL_COUNT]; // Capture ring buffer (samples of all channels in registry order)
+
+volatile SCOPE_t scope = {
+    { SCOPE_INIT_STATUS }, SCOPE_INIT_STATE, SCOPE_COMMAND_NONE, SCOPE_TRIGGER_DEFAULT, 
+    SCOPE_CH_VOUT, 0, SCOPE_DECIMATION, SCOPE_PRETRIGGER, ((SCOPE_DEPTH - 1) - SCOPE_PRETRIGGER), 
+    SCOPE_DECIMATION, SCOPE_PRETRIGGER, SCOPE_TRIGGER_NONE, 0, 0, &scope_buffer[0]
+}; // Waveform capture (armed at startup when SCOPE_AUTO_ARM = 1)
+
+#if (USE_SCOPE == 1)
+
+/*!scope_Sample
+ * ***********************************************************************************************
+ * Description:
+ * Called by the control loop interrupt through SCOPE_SAMPLE() after a sample has been recorded,
+ * when the remaining samples of the recent state have been recorded or while a trigger is 
+ * evaluated. The parameter points to the recent sample in the capture buffer. 
+ * 
+ * When the pretrigger history is complete, threshold triggers start to compare the trigger 
+ * channel with the trigger level. The capture is triggered at the first crossing of the level
+ * in the selected direction or by a pending event. It is frozen when the post-trigger samples 
+ * have been recorded.
+ * ***********************************************************************************************/
+volatile uint16_t scope_Sample(volatile uint16_t* sample) {
+    
+    bool above = false, triggered = false;
+    
+    switch (scope.state)
+    {
+        case SCOPE_STATE_PRETRIGGER:
+            
+            if (scope.remaining == 0) // pretrigger history complete
+            {
+                if ((scope.trigger == SCOPE_TRIGGER_RISING) || (scope.trigger == SCOPE_TRIGGER_FALLING))
+                {
+                    scope.status.flags.above = ((int16_t)sample[scope.channel] >= scope.level);
+                    scope.status.flags.threshold = true;
+                }
+                scope.state = SCOPE_STATE_ARMED;
+            }
+            break;
+            
+        case SCOPE_STATE_ARMED:
+            
+            if (scope.status.flags.event)
+            { triggered = true; }
+            else if (scope.status.flags.threshold)
+            {
+                above = ((int16_t)sample[scope.channel] >= scope.level);
+                if (above != scope.status.flags.above)
+                {
+                    scope.status.flags.above = above;
+                    if (above == (scope.trigger == SCOPE_TRIGGER_RISING))
+                    {
+                        scope.source = scope.trigger;
+                        scope.argument = 0;
+                        triggered = true;
+                    }
+                }
+            }
+            
+            if (triggered)
+            {
+                scope.status.value &= ~SCOPE_STATUS_TRIGGER_MASK;
+                scope.remaining = scope.post;
+                scope.state = SCOPE_STATE_TRIGGERED;
+            }
+            break;
+            
+        case SCOPE_STATE_TRIGGERED:
+            
+            if (scope.remaining == 0) // post-trigger samples complete
+            {
+                scope.status.value &= ~(SCOPE_STATUS_RECORDING | SCOPE_STATUS_TRIGGER_MASK);
+                scope.state = SCOPE_STATE_FROZEN;
+            }
+            break;
+            
+        default: // no state change of the control loop interrupt
+            break;
+    }
+    
+    return(1);
+}
+
+#endif
+
+/*!exec_Scope
+ * ***********************************************************************************************
+ * Description:
+ * This task is called by all operating mode task queues. It executes pending commands and sends 
+ * one frame of the capture per call while the capture is read. When a frame cannot be handed 
+ * over to the telemetry task (previous response still pending), it is sent with the next call. 
+ * The capture is re-armed with the recent settings when its last frame has been sent.
+ * ***********************************************************************************************/
+volatile uint16_t exec_Scope(void) {
+    
+    volatile uint16_t fres = 1;
+    
+    // Commands written by the parameter access protocol
+    switch (scope.command)
+    {
+        case SCOPE_COMMAND_ARM:
+            fres &= scope_Arm();
+            break;
+            
+        case SCOPE_COMMAND_FORCE:
+            if (scope.state == SCOPE_STATE_ARMED)
+            {
+                scope.source = SCOPE_TRIGGER_MANUAL;
+                scope.argument = 0;
+                scope.status.flags.event = true;
+            }
+            break;
+            
+        case SCOPE_COMMAND_READ:
+            if (scope.state == SCOPE_STATE_FROZEN)
+            {
+                scope.read_index = 0;
+                scope.status.flags.header = true;
+                scope.state = SCOPE_STATE_READOUT;
+            }
+            break;
+            
+        case SCOPE_COMMAND_STOP:
+            scope.status.value = 0;
+            scope.state = SCOPE_STATE_IDLE;
+            break;
+            
+        default:
+            break;
+    }
+    scope.command = SCOPE_COMMAND_NONE;
+    
+    // Readout of the frozen capture
+    if (scope.state == SCOPE_STATE_READOUT)
+    {
+        if (scope.status.flags.header)
+        {
+            if (scope_SendHeader())
+            { scope.status.flags.header = false; }
+        }
+        else if (scope_SendData())
+        {
+            scope.read_index += SCOPE_SAMPLES_PER_FRAME;
+            if (scope.read_index >= SCOPE_DEPTH)
+            { fres &= scope_Arm(); }
+        }
+    }
+    
+    return(fres);
+}
+
+/*!scope_Arm
+ * ***********************************************************************************************
+ * Description:
+ * Restarts the capture with the recent trigger settings. The recording flag is cleared before
+ * the capture is reset and set last to hand over the capture to the control loop interrupt.
+ * ***********************************************************************************************/
+inline volatile uint16_t scope_Arm(void) {
+    
+    scope.status.value = 0;
+    
+    scope.source = SCOPE_TRIGGER_NONE;
+    scope.argument = 0;
+    scope.post = ((SCOPE_DEPTH - 1) - scope.pretrigger);
+    scope.remaining = scope.pretrigger;
+    scope.prescaler = scope.decimation;
+    scope.state = SCOPE_STATE_PRETRIGGER;
+    
+    scope.status.flags.recording = true;
+    
+    return(1);
+}
+
+/*!scope_SendHeader
+ * ***********************************************************************************************
+ * Description:
+ * Hands over the header frame of the capture to the telemetry task. Returns 0 if the previous 
+ * response has not been sent yet.
+ * ***********************************************************************************************/
+inline volatile uint16_t scope_SendHeader(void) {
+    
+    volatile uint8_t response[11];
+    volatile uint16_t pretrigger = ((SCOPE_DEPTH - 1) - scope.post);
+    
+    response[0] = SCOPE_RESPONSE_HEADER;
+    response[1] = (uint8_t)SCOPE_CHANNEL_COUNT;
+    response[2] = (uint8_t)SCOPE_DEPTH;
+    response[3] = (uint8_t)(SCOPE_DEPTH >> 8);
+    response[4] = (uint8_t)pretrigger;
+    response[5] = (uint8_t)(pretrigger >> 8);
+    response[6] = (uint8_t)scope.decimation;
+    response[7] = (uint8_t)(scope.decimation >> 8);
+    response[8] = (uint8_t)scope.source;
+    response[9] = (uint8_t)scope.argument;
+    response[10] = (uint8_t)(scope.argument >> 8);
+    
+    return(telemetry_Respond(&response[0], sizeof(response)));
+}
+
+/*!scope_SendData
+ * ***********************************************************************************************
+ * Description:
+ * Hands over the next data frame of the capture to the telemetry task. The oldest sample of the
+ * frozen capture is the sample the control loop interrupt would have written next. Returns 0 
+ * if the previous response has not been sent yet.
+ * ***********************************************************************************************/
+inline volatile uint16_t scope_SendData(void) {
+    
+    volatile uint8_t response[SCOPE_DATA_HEADER_SIZE + (2 * SCOPE_CHANNEL_COUNT * SCOPE_SAMPLES_PER_FRAME)];
+    volatile uint16_t* ptr;
+    volatile uint16_t index = 0, count = SCOPE_SAMPLES_PER_FRAME, length = 0, i = 0, k = 0;
+    
+    if ((scope.read_index + count) > SCOPE_DEPTH)
+    { count = (SCOPE_DEPTH - scope.read_index); }
+    
+    index = (uint16_t)((scope.ptrWrite - &scope_buffer[0]) / SCOPE_CHANNEL_COUNT) + scope.read_index;
+    if (index >= SCOPE_DEPTH) 
+    { index -= SCOPE_DEPTH; }
+    ptr = &scope_buffer[index * SCOPE_CHANNEL_COUNT];
+    
+    response[0] = SCOPE_RESPONSE_DATA;
+    response[1] = (uint8_t)scope.read_index;
+    response[2] = (uint8_t)(scope.read_index >> 8);
+    length = SCOPE_DATA_HEADER_SIZE;
+    
+    for (i=0; i<count; i++)
+    {
+        if (ptr == &scope_buffer[SCOPE_DEPTH * SCOPE_CHANNEL_COUNT])
+        { ptr = &scope_buffer[0]; }
+        
+        for (k=0; k<SCOPE_CHANNEL_COUNT; k++)
+        {
+            response[length++] = (uint8_t)(*ptr);
+            response[length++] = (uint8_t)(*ptr++ >> 8);
+        }
+    }
+    
+    return(telemetry_Respond(&response[0], length));
+}
+
+// EOF
@@ -0,0 +1,346 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_SoftStart.c
+ * *****************************************************************************
+ * File:   task_SoftStart.c
+ * Author: M91406
+ *
+ * Description:
+ * Soft-start/soft-stop state machine of the power converter instances (see task_SoftStart.h)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/tasks/task_SoftStart.h"
+#include "_root/generic/task_manager.h"
+
+/* private function prototypes */
+volatile uint16_t soft_start_Step(volatile CONVERTER_t* conv);
+volatile uint16_t soft_start_PreBias(volatile CONVERTER_t* conv);
+volatile uint16_t soft_start_Shutdown(volatile CONVERTER_t* conv);
+volatile uint16_t soft_start_DelayExpired(volatile CONTROL_SOFT_START_t* ss);
+
+/*!init_SoftStart
+ * ***********************************************************************************************
+ * Description:
+ * Resets the soft-start state machines of all converter instances. This routine is called each 
+ * time the task manager enters OP_MODE_SYSTEM_STARTUP (see task_queue_init_system_startup()), 
+ * which restarts the converters from their initial state after power-up, warm boot and fault 
+ * recovery. The converters are restarted at the nominal switching frequency (see efficiency.h).
+ * ***********************************************************************************************/
+volatile uint16_t init_SoftStart(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile CONTROL_SOFT_START_t* ss;
+    
+    fres &= efficiency_Reset();
+    
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    {
+        ss = &converter[i].soft_start;
+        
+        ss->ramp_active = false;
+        ss->ramp_complete = false;
+        ss->direction = SOFT_START_RAMP_UP;
+        ss->step = SOFT_START_STEP_INITIALIZE;
+        ss->interval = 0;
+        ss->counter = 0;
+        ss->v_target = converter[i].loop.reference;
+        ss->v_ramp = 0;
+        ss->v_ramp_increment = SOFT_START_RAMP_UP_INCREMENT(ss->v_target);
+        ss->v_reference = 0;
+        ss->i_reference = 0;
+    }
+    
+    return(fres);
+}
+
+/*!exec_SoftStart
+ * ***********************************************************************************************
+ * Description:
+ * Soft-start/soft-stop task stepping the state machines of all converter instances. Delays are 
+ * counted in scheduler ticks by adding the call interval of this task in the recent task queue
+ * (see task_mgr.exec_task_period) on every call. The reference ramps are executed by soft_start_Ramp() in the control loop interrupts; 
+ * this task only waits for their completion. When the startup sequences of all instances have 
+ * been completed, the task manager is switched into OP_MODE_NORMAL.
+ * ***********************************************************************************************/
+volatile uint16_t exec_SoftStart(void) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile bool ready = true;
+    
+    for (i = 0; i < CONVERTER_COUNT; i++)
+    { 
+        fres &= soft_start_Step(&converter[i]); 
+        ready &= converter[i].status.flags.system_ready;
+    }
+    
+    if ((ready) && (application.ctrl_status.flags.system_startup))
+    {
+        application.ctrl_status.flags.system_startup = false;
+        application.ctrl_status.flags.system_ready = true;
+        task_mgr.op_mode.mode = OP_MODE_NORMAL; // Hand over to normal operation
+    }
+    
+    return(fres);
+}
+
+/*!soft_start_Step
+ * ***********************************************************************************************
+ * Description:
+ * Executes one step of the soft-start state machine of the given converter instance
+ * ***********************************************************************************************/
+volatile uint16_t soft_start_Step(volatile CONVERTER_t* conv) {
+    
+    volatile uint16_t fres = 1;
+    volatile CONTROL_SOFT_START_t* ss = &conv->soft_start;
+    
+    switch (ss->step)
+    {
+        case SOFT_START_STEP_INITIALIZE:
+            fres &= soft_start_Shutdown(conv);
+            application.ctrl_status.flags.system_startup = true;
+            application.ctrl_status.flags.system_ready = false;
+            conv->status.flags.system_startup = true;
+            conv->status.flags.system_ready = false;
+            ss->counter = 0;
+            ss->interval = TASK_MGR_TICKS(POWER_ON_DELAY_TICKS);
+            ss->step = SOFT_START_STEP_POWER_ON_DELAY;
+            break;
+            
+        case SOFT_START_STEP_POWER_ON_DELAY:
+            // The delay starts when the feedback signals are available
+            if (!application.ctrl_status.flags.adc_active)
+            { break; }
+            if (soft_start_DelayExpired(ss))
+            { ss->step = SOFT_START_STEP_PRE_BIAS; }
+            break;
+            
+        case SOFT_START_STEP_PRE_BIAS:
+            fres &= soft_start_PreBias(conv);
+            ss->step = SOFT_START_STEP_RAMP_UP;
+            break;
+            
+        case SOFT_START_STEP_RAMP_UP:
+            if (!ss->ramp_active)
+            {
+                ss->counter = 0;
+                ss->interval = TASK_MGR_TICKS(POWER_GOOD_DELAY_TICKS);
+                ss->step = SOFT_START_STEP_POWER_GOOD_DELAY;
+            }
+            break;
+            
+        case SOFT_START_STEP_POWER_GOOD_DELAY:
+            if (soft_start_DelayExpired(ss))
+            {
+                ss->ramp_complete = true;
+                conv->status.flags.system_startup = false;
+                conv->status.flags.system_ready = true;
+                ss->step = SOFT_START_STEP_COMPLETE;
+            }
+            break;
+            
+        case SOFT_START_STEP_COMPLETE:
+            break;
+            
+        case SOFT_START_STEP_RAMP_DOWN:
+            if (!ss->ramp_active)
+            {
+                fres &= soft_start_Shutdown(conv);
+                ss->step = SOFT_START_STEP_OFF;
+            }
+            break;
+            
+        case SOFT_START_STEP_OFF:
+            break;
+            
+        default: // Invalid state: restart the sequence
+            ss->step = SOFT_START_STEP_INITIALIZE;
+            fres = 0;
+            break;
+    }
+    
+    return(fres);
+}
+
+/*!soft_start_DelayExpired
+ * ***********************************************************************************************
+ * Description:
+ * Advances the delay counter of the recent soft-start step by the call interval of this task
+ * and returns 1 when the step interval has elapsed. The counter never exceeds the interval.
+ * ***********************************************************************************************/
+volatile uint16_t soft_start_DelayExpired(volatile CONTROL_SOFT_START_t* ss) {
+    
+    if ((ss->interval - ss->counter) <= task_mgr.exec_task_period)
+    { 
+        ss->counter = ss->interval;
+        return(1);
+    }
+    
+    ss->counter += task_mgr.exec_task_period;
+    return(0);
+}
+
+/*!soft_start_Stop
+ * ***********************************************************************************************
+ * Description:
+ * Requests a soft-stop of the given converter instance. The reference is ramped down to zero by 
+ * the control loop interrupt within RAMP_DOWN_PERIOD before the outputs are overridden. Returns 
+ * 0 if the converter is not running.
+ * ***********************************************************************************************/
+volatile uint16_t soft_start_Stop(volatile CONVERTER_t* conv) {
+    
+    volatile CONTROL_SOFT_START_t* ss = &conv->soft_start;
+    
+    if ((ss->step != SOFT_START_STEP_RAMP_UP) && 
+        (ss->step != SOFT_START_STEP_POWER_GOOD_DELAY) && 
+        (ss->step != SOFT_START_STEP_COMPLETE))
+    { return(0); }
+    
+    ss->ramp_active = false; // Ramp parameters are changed outside of the ramp
+    ss->ramp_complete = false;
+    ss->direction = SOFT_START_RAMP_DOWN;
+    ss->v_ramp_increment = SOFT_START_RAMP_DOWN_INCREMENT(ss->v_target);
+    ss->step = SOFT_START_STEP_RAMP_DOWN;
+    ss->ramp_active = true;
+    
+    return(1);
+}
+
+/*!soft_start_Ramp
+ * ***********************************************************************************************
+ * Description:
+ * Executes one step of the reference ramp of the given converter instance. This routine is 
+ * called by the control loop interrupt service routine of the instance before the control loop 
+ * update while conv->soft_start.ramp_active is set. The ramp is calculated in Q16.16 format; 
+ * the integer part is written to the control loop reference. ramp_active is cleared when the 
+ * ramp has reached its end.
+ * ***********************************************************************************************/
+volatile uint16_t soft_start_Ramp(volatile CONVERTER_t* conv) {
+    
+    volatile CONTROL_SOFT_START_t* ss = &conv->soft_start;
+    uint32_t target = ((uint32_t)ss->v_target << 16);
+    
+    if (ss->direction == SOFT_START_RAMP_UP)
+    {
+        ss->v_ramp += ss->v_ramp_increment;
+        if (ss->v_ramp >= target)
+        {
+            ss->v_ramp = target;
+            ss->ramp_active = false;
+        }
+    }
+    else
+    {
+        if (ss->v_ramp > ss->v_ramp_increment)
+        { ss->v_ramp -= ss->v_ramp_increment; }
+        else
+        {
+            ss->v_ramp = 0;
+            ss->ramp_active = false;
+        }
+    }
+    
+    ss->v_reference = (uint16_t)(ss->v_ramp >> 16);
+    *conv->ptrReference = ss->v_reference;
+    
+    return(1);
+}
+
+/* ************************************************************************************************
+ * Detects a pre-biased output, preloads the control loop and starts the ramp-up
+ * ************************************************************************************************/
+volatile uint16_t soft_start_PreBias(volatile CONVERTER_t* conv) {
+    
+    volatile uint16_t fres = 1;
+    volatile uint16_t i = 0;
+    volatile CONTROL_SOFT_START_t* ss = &conv->soft_start;
+    volatile cNPNZ16b_t* ctrl = conv->controller;
+    volatile uint16_t v_out = conv->data.v_out;
+    volatile uint16_t v_in = application.data.v_in;
+    volatile int16_t duty = ctrl->MinOutput;
+    
+    ss->v_ramp = 0;
+    
+    if ((v_out > SOFT_START_PREBIAS_THRESHOLD) && (v_in > 0))
+    {
+        // Start the ramp at the measured output voltage with the duty cycle of VOUT/VIN
+        if (v_out > ss->v_target) 
+        { v_out = ss->v_target; }
+        ss->v_ramp = ((uint32_t)v_out << 16);
+        duty = (int16_t)(((uint32_t)v_out * SOFT_START_PREBIAS_DUTY_FACTOR) / v_in);
+        
+        if (duty < ctrl->MinOutput) { duty = ctrl->MinOutput; }
+        else if (duty > ctrl->MaxOutput) { duty = ctrl->MaxOutput; }
+    }
+    
+  #if (FEEDFORWARD_ENABLED)
+    if (ctrl == feedforward.ptrController)
+    { duty = feedforward_Normalize(duty); } // Histories hold the normalized control output
+  #endif
+    
+    ss->v_reference = (uint16_t)(ss->v_ramp >> 16);
+    *conv->ptrReference = ss->v_reference;
+    
+    // Preload the control history: the first output continues from the pre-bias duty cycle
+    fres &= cvmc_vout_Reset(ctrl);
+    for (i = 0; i < ctrl->ACoefficientsArraySize; i++)
+    { ctrl->ptrControlHistory[i] = duty; }
+    *ctrl->ptrTargetRegister = (uint16_t)duty;
+    
+    ss->direction = SOFT_START_RAMP_UP;
+    ss->v_ramp_increment = SOFT_START_RAMP_UP_INCREMENT(ss->v_target);
+    ss->ramp_active = true;
+    
+    ctrl->status.flags.enable = true;
+  #if (FEEDFORWARD_ENABLED)
+    if (ctrl == feedforward.ptrController)
+    { fres &= feedforward_Apply(); } // Write the pre-bias duty cycle before the outputs are released
+  #endif
+    fres &= conv->enable_outputs(true);
+    conv->status.flags.pwm_started = true;
+    
+    return(fres);
+}
+
+/* ************************************************************************************************
+ * Overrides the PWM outputs and disables the control loop of the given converter instance
+ * ************************************************************************************************/
+volatile uint16_t soft_start_Shutdown(volatile CONVERTER_t* conv) {
+    
+    volatile uint16_t fres = 1;
+    
+    conv->soft_start.ramp_active = false;
+    fres &= conv->enable_outputs(false);
+    conv->controller->status.flags.enable = false;
+    conv->status.flags.pwm_started = false;
+    
+    return(fres);
+}
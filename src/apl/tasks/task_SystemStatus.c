@@ -49,6 +49,15 @@
 volatile uint16_t css_GetSystemStatus(void);
 volatile uint16_t css_SetSystemMode(void);
 
+#if (USE_TASK_MANAGER_EVENT_BUS == 1)
+// Startup and fault override state of the task manager, refreshed when an event has been taken
+volatile bool css_startup_complete = false;
+volatile bool css_fault_override = false;
+#else
+#define css_startup_complete    task_mgr.status.flags.startup_sequence_complete
+#define css_fault_override      task_mgr.status.flags.fault_override
+#endif
+
 /*!task_CaptureSystemStatus
  * ************************************************************************************************
  * Summary:
@@ -74,6 +83,10 @@ volatile uint16_t exec_CaptureSystemStatus(void) {
     
     volatile uint16_t fres=1;
     
+#if (FUNCTION_LED_HARDWARE == 1)
+    fres &= exec_DebugLEDHardware(); // Reload the hardware LED pattern after op-mode changes
+#endif
+    
     // System status cannot reliably be detected without running ADC
     if(!application.ctrl_status.flags.adc_active) 
     { return(fres); }
@@ -82,6 +95,9 @@ volatile uint16_t exec_CaptureSystemStatus(void) {
     fres &= css_SetSystemMode();
     
     /* Update time critical items of the MASTER-2-SLAVE interface immediately */
+#if (MSI_CORE_ROLE == MSI_ROLE_MASTER)
+    fres &= exec_MsiExchange();
+#endif
     
     return(fres);
 }
@@ -120,6 +136,12 @@ volatile uint16_t css_GetSystemStatus(void) {
 
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
     
+    // a system mode requested by the rack supervisor overrides the detected system mode
+#if (USE_CAN == 1)
+    if (can_interface.remote_control)
+    { sys_mode.value = can_interface.system_mode_request; }
+#endif
+    
     // apply detected system mode
     application.system_mode.value = sys_mode.value;   
     
@@ -142,12 +164,22 @@ volatile uint16_t css_SetSystemMode(void) {
     // Allow switching of operating modes only when the device and system startup procedure has been
     // completed and no fault condition is pending to make sure all peripherals and functions are 
     // available for NORMAL OPERATION modes
-    if (task_mgr.status.flags.startup_sequence_complete) 
+  #if (USE_TASK_MANAGER_EVENT_BUS == 1)
+    // The flags only change with operating mode switches, startup completion, fault trips and releases
+    if (task_EventTake(EVENT_SUB_SYSTEM_STATUS, (EVENT_MASK(EVT_OP_MODE_SWITCH) | EVENT_MASK(EVT_STARTUP_COMPLETE) | 
+                EVENT_MASK(EVT_FAULT_TRIP) | EVENT_MASK(EVT_FAULT_RELEASE))))
+    {
+        css_startup_complete = task_mgr.status.flags.startup_sequence_complete;
+        css_fault_override = task_mgr.status.flags.fault_override;
+    }
+  #endif
+    
+    if (css_startup_complete) 
     {
         // when the fault handler detected a critical fault requiring to shut down the system and
         // hold it in fault recovery mode until the fault flags have been reset, do not allow to 
         // switch operating mode (overrides the detected mode of operation))
-        if (task_mgr.status.flags.fault_override)
+        if (css_fault_override)
         { application.system_mode.flags = SYSTEM_MODE_FAULT; }
     
         // Set the appropriate task scheduler operating mode depending required for the detected system mode
@@ -0,0 +1,344 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*!task_Telemetry.c
+ * *****************************************************************************
+ * File:   task_Telemetry.c
+ * Author: M91406
+ *
+ * Description:
+ * Binary telemetry data stream over UART DMA (see task_Telemetry.h and 
+ * telemetry.h)
+ * 
+ * Revision history: 
+ * 10/14/26     Initial version
+ * ****************************************************************************/
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "apl/apl.h"
+#include "apl/config/telemetry.h"
+#include "apl/tasks/task_Telemetry.h"
+#include "_root/generic/task_manager.h"
+
+/*!TELEMETRY_FIELD_t
+ * ***********************************************************************************************
+ * Address and size of one registered variable
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint8_t* address; // Address of the variable
+    uint16_t size; // Size of the variable in bytes
+} TELEMETRY_FIELD_t;
+
+#define TELEMETRY_REGISTRY_FIELD(id, variable)  { (volatile uint8_t*)&(variable), sizeof(variable) },
+
+// Field table generated from the telemetry registry
+const TELEMETRY_FIELD_t telemetry_field[TELEMETRY_FIELD_COUNT] = {
+    TELEMETRY_REGISTRY(TELEMETRY_REGISTRY_FIELD)
+};
+
+// CRC-16/CCITT-FALSE nibble table
+const uint16_t telemetry_crc_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/*!TELEMETRY_ENCODER_t
+ * ***********************************************************************************************
+ * State of the COBS encoder while a frame is being built
+ * ***********************************************************************************************/
+typedef struct {
+    volatile uint8_t* frame; // Frame buffer being written
+    volatile uint16_t index; // Write index of the next data byte
+    volatile uint16_t code_index; // Index of the code byte of the running block
+    volatile uint8_t code; // Code byte of the running block
+    volatile uint16_t crc; // Running CRC-16 of the raw packet
+} TELEMETRY_ENCODER_t;
+
+volatile TELEMETRY_STATUS_t telemetry;
+
+// Frame buffers transmitted by the DMA (have to be located in DMA accessible RAM)
+volatile uint8_t telemetry_frame[2][TELEMETRY_FRAME_SIZE];
+volatile uint16_t telemetry_frame_length[2];
+
+// Response payload waiting to be framed
+volatile uint8_t telemetry_response[TELEMETRY_RESPONSE_SIZE];
+volatile uint16_t telemetry_response_length;
+
+// Copy of all registered variables the data frame payload is encoded from
+volatile uint8_t telemetry_snapshot[TELEMETRY_PAYLOAD_SIZE];
+
+/* private function prototypes */
+inline volatile uint16_t telemetry_Snapshot(void);
+inline volatile uint16_t telemetry_EncodeByte(volatile TELEMETRY_ENCODER_t* enc, volatile uint8_t data, volatile bool crc);
+volatile uint16_t telemetry_EncodeFrame(volatile uint8_t* frame, volatile uint8_t type);
+volatile uint16_t telemetry_Launch(void);
+
+/*!init_Telemetry
+ * ***********************************************************************************************
+ * Description:
+ * Resets the telemetry status. The first frame after initialization is a schema frame, which 
+ * allows a host to decode the data stream from the start.
+ * ***********************************************************************************************/
+volatile uint16_t init_Telemetry(void) {
+    
+    telemetry.frames = 0;
+    telemetry.overruns = 0;
+    telemetry.schema_counter = TELEMETRY_SCHEMA_INTERVAL;
+    telemetry.sequence = 0;
+    telemetry.write = 0;
+    telemetry.pending = false;
+    telemetry.response_pending = false;
+    telemetry_response_length = 0;
+    
+    return(1);
+}
+
+/*!exec_Telemetry
+ * ***********************************************************************************************
+ * Description:
+ * Launches a frame still waiting for transmission, takes the next snapshot into the free frame 
+ * buffer and launches it when the UART DMA channel is idle. If the previous frame is still 
+ * waiting when the task is called, no snapshot is taken and the overrun counter is incremented.
+ * Every TELEMETRY_SCHEMA_INTERVAL data frames a schema frame is inserted. A pending response
+ * is sent instead of the next data frame.
+ * ***********************************************************************************************/
+volatile uint16_t exec_Telemetry(void) {
+    
+    volatile uint8_t type = TELEMETRY_FRAME_DATA;
+    
+    #if (USE_TELEMETRY == 1)
+    
+    // Transmit pending frame
+    if (telemetry.pending)
+    { 
+        telemetry_Launch(); 
+        
+        if (telemetry.pending) {
+            telemetry.overruns++;
+            return(1);
+        }
+    }
+
+    // Build next frame
+    if (telemetry.response_pending) {
+        type = TELEMETRY_FRAME_RESPONSE;
+    }
+    else if (++telemetry.schema_counter >= TELEMETRY_SCHEMA_INTERVAL) {
+        telemetry.schema_counter = 0;
+        type = TELEMETRY_FRAME_SCHEMA;
+    }
+    
+    telemetry_frame_length[telemetry.write] = 
+        telemetry_EncodeFrame(&telemetry_frame[telemetry.write][0], type);
+    telemetry.pending = true;
+    
+    if (type == TELEMETRY_FRAME_RESPONSE)
+    { telemetry.response_pending = false; }
+    
+    telemetry_Launch();
+    
+    #endif
+    
+    return(1);
+}
+
+/*!telemetry_Respond
+ * ***********************************************************************************************
+ * Description:
+ * Copies <length> bytes of <data> into the response buffer, which is sent as response frame in
+ * the next telemetry time slot. Returns 0 if the previous response has not been framed yet or
+ * the response exceeds TELEMETRY_RESPONSE_SIZE.
+ * ***********************************************************************************************/
+volatile uint16_t telemetry_Respond(volatile uint8_t* data, volatile uint16_t length) {
+    
+    volatile uint16_t i=0;
+    
+    if ((telemetry.response_pending) || (length > TELEMETRY_RESPONSE_SIZE))
+    { return(0); }
+    
+    for (i=0; i<length; i++)
+    { telemetry_response[i] = data[i]; }
+    
+    telemetry_response_length = length;
+    telemetry.response_pending = true;
+    
+    return(1);
+}
+
+/*!telemetry_Crc16
+ * ***********************************************************************************************
+ * Description:
+ * Returns the CRC-16/CCITT-FALSE of <length> bytes of <data> as used by the telemetry framing.
+ * ***********************************************************************************************/
+volatile uint16_t telemetry_Crc16(volatile uint8_t* data, volatile uint16_t length) {
+    
+    volatile uint16_t crc=0xFFFF, i=0;
+    
+    for (i=0; i<length; i++) {
+        crc = (crc << 4) ^ telemetry_crc_table[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (crc << 4) ^ telemetry_crc_table[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    
+    return(crc);
+}
+
+/*!telemetry_Launch
+ * ***********************************************************************************************
+ * Description:
+ * Starts the transmission of the pending frame buffer if the UART DMA channel is idle and 
+ * switches over to the other frame buffer. Returns 0 if the DMA channel is still busy.
+ * ***********************************************************************************************/
+volatile uint16_t telemetry_Launch(void) {
+    
+    if (!uart_DmaTransmit(&telemetry_frame[telemetry.write][0], telemetry_frame_length[telemetry.write]))
+    { return(0); }
+    
+    telemetry.write ^= 1;
+    telemetry.pending = false;
+    telemetry.frames++;
+    
+    return(1);
+}
+
+/*!telemetry_EncodeByte
+ * ***********************************************************************************************
+ * Description:
+ * Adds one raw byte to the COBS encoded frame. Zero bytes close the running block, as do 
+ * 254 consecutive non-zero bytes. When <crc> is true, the byte is added to the running CRC.
+ * ***********************************************************************************************/
+inline volatile uint16_t telemetry_EncodeByte(volatile TELEMETRY_ENCODER_t* enc, volatile uint8_t data, volatile bool crc) {
+    
+    if (crc) {
+        enc->crc = (enc->crc << 4) ^ telemetry_crc_table[(enc->crc >> 12) ^ (data >> 4)];
+        enc->crc = (enc->crc << 4) ^ telemetry_crc_table[(enc->crc >> 12) ^ (data & 0x0F)];
+    }
+    
+    if (data != 0) {
+        enc->frame[enc->index++] = data;
+        enc->code++;
+    }
+    
+    if ((data == 0) || (enc->code == 0xFF)) {
+        enc->frame[enc->code_index] = enc->code;
+        enc->code_index = enc->index++;
+        enc->code = 1;
+    }
+    
+    return(1);
+}
+
+/*!telemetry_Snapshot
+ * ***********************************************************************************************
+ * Description:
+ * Copies all registered variables into the snapshot buffer. When TELEMETRY_SEQLOCK is defined, 
+ * the copy is repeated up to SEQLOCK_READ_RETRIES times while its writer has been active in 
+ * the meantime. Interrupts are never suspended. Returns 0 if no consistent snapshot could be 
+ * taken, in which case the most recent copy is used.
+ * ***********************************************************************************************/
+inline volatile uint16_t telemetry_Snapshot(void) {
+    
+    volatile uint16_t i=0, j=0, k=0;
+    #ifdef TELEMETRY_SEQLOCK
+    volatile uint16_t attempt=0, sequence=0;
+    
+    for (attempt=0; attempt<SEQLOCK_READ_RETRIES; attempt++)
+    {
+        sequence = seqlock_ReadBegin(&TELEMETRY_SEQLOCK);
+    #endif
+        
+        k = 0;
+        for (i=0; i<TELEMETRY_FIELD_COUNT; i++) {
+            for (j=0; j<telemetry_field[i].size; j++)
+            { telemetry_snapshot[k++] = telemetry_field[i].address[j]; }
+        }
+        
+    #ifdef TELEMETRY_SEQLOCK
+        if (!seqlock_ReadRetry(&TELEMETRY_SEQLOCK, sequence))
+        { return(1); }
+    }
+    
+    return(0);
+    #else
+    return(1);
+    #endif
+}
+
+/*!telemetry_EncodeFrame
+ * ***********************************************************************************************
+ * Description:
+ * Builds a complete frame of the given type in <frame>. Data frames are encoded from one
+ * snapshot of all registered variables, which is copied into the snapshot buffer first (see 
+ * telemetry_Snapshot()). The CRC is calculated while the raw bytes are COBS encoded in the 
+ * same pass. Returns the number of frame bytes including the 0x00 delimiter.
+ * ***********************************************************************************************/
+volatile uint16_t telemetry_EncodeFrame(volatile uint8_t* frame, volatile uint8_t type) {
+    
+    volatile TELEMETRY_ENCODER_t enc;
+    volatile uint16_t tick=0, crc=0, i=0;
+    
+    enc.frame = frame;
+    enc.code_index = 0;
+    enc.index = 1;
+    enc.code = 1;
+    enc.crc = 0xFFFF;
+
+    // Header
+    tick = task_mgr.tick_ctrl.counter;
+    telemetry_EncodeByte(&enc, type, true);
+    telemetry_EncodeByte(&enc, ++telemetry.sequence, true);
+    telemetry_EncodeByte(&enc, (uint8_t)(tick & 0x00FF), true);
+    telemetry_EncodeByte(&enc, (uint8_t)(tick >> 8), true);
+    
+    // Payload
+    if (type == TELEMETRY_FRAME_SCHEMA) {
+        telemetry_EncodeByte(&enc, (uint8_t)(TELEMETRY_SCHEMA_VERSION & 0x00FF), true);
+        telemetry_EncodeByte(&enc, (uint8_t)(TELEMETRY_SCHEMA_VERSION >> 8), true);
+        telemetry_EncodeByte(&enc, (uint8_t)(TELEMETRY_FIELD_COUNT & 0x00FF), true);
+        telemetry_EncodeByte(&enc, (uint8_t)(TELEMETRY_FIELD_COUNT >> 8), true);
+        for (i=0; i<TELEMETRY_FIELD_COUNT; i++) {
+            telemetry_EncodeByte(&enc, (uint8_t)(telemetry_field[i].size & 0x00FF), true);
+            telemetry_EncodeByte(&enc, (uint8_t)(telemetry_field[i].size >> 8), true);
+        }
+    }
+    else if (type == TELEMETRY_FRAME_RESPONSE) {
+        for (i=0; i<telemetry_response_length; i++)
+        { telemetry_EncodeByte(&enc, telemetry_response[i], true); }
+    }
+    else {
+        telemetry_Snapshot();
+        for (i=0; i<TELEMETRY_PAYLOAD_SIZE; i++)
+        { telemetry_EncodeByte(&enc, telemetry_snapshot[i], true); }
+    }
+    
+    // CRC-16, high byte first
+    crc = enc.crc;
+    telemetry_EncodeByte(&enc, (uint8_t)(crc >> 8), false);
+    telemetry_EncodeByte(&enc, (uint8_t)(crc & 0x00FF), false);
+    
+    // Close last block and add frame delimiter
+    frame[enc.code_index] = enc.code;
+    frame[enc.index++] = 0x00;
+    
+    return(enc.index);
+}
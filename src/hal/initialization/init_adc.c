@@ -0,0 +1,237 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   init_adc.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 11:00 AM
+ */
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/initialization/init_adc.h"
+
+// ADCON5L/ADCON3H bit masks of the ADC cores
+#define ADC_SHARED_CORE_PWR     0x0080  // ADCON5L: SHRPWR
+#define ADC_SHARED_CORE_RDY     0x8000  // ADCON5L: SHRRDY
+#define ADC_SHARED_CORE_EN      0x0080  // ADCON3H: SHREN
+#define ADC_CORE_PWR(x)         (0x0001 << (x)) // ADCON5L: CxPWR
+#define ADC_CORE_RDY(x)         (0x0100 << (x)) // ADCON5L: CxRDY
+#define ADC_CORE_EN(x)          (0x0001 << (x)) // ADCON3H: CxEN
+
+// PGxEVTH register settings of the PWM generators triggering phase current channels
+#define ADC_PWM_EVTH_ADTR2EN1   0x0020  // PGxTRIGA drives ADC Trigger 2
+
+// ADFLxCON register settings of the slow channel digital filters
+#define ADC_FLCON_FLEN          0x8000  // Filter enable
+#define ADC_FLCON_MODE_OVRSAM   0x0000  // Oversampling mode
+#define ADC_FLCON_MODE_AVG      0x6000  // Averaging mode
+#define ADC_FLCON_OVRSAM_POS    10      // Bit position of the OVRSAM bit field
+
+#if (ADC_SLOW_FILTER_MODE == ADC_FILTER_OVERSAMPLING)
+  #define ADC_FLCON_MODE        ADC_FLCON_MODE_OVRSAM
+  #define ADC_FLCON_OVRSAM      ((ADC_SLOW_FILTER_RATIO == 256) ? 0b011 : (ADC_SLOW_FILTER_RATIO == 64) ? 0b010 : \
+                                 (ADC_SLOW_FILTER_RATIO == 16) ? 0b001 : 0b000)
+#elif (ADC_SLOW_FILTER_MODE == ADC_FILTER_AVERAGING)
+  #define ADC_FLCON_MODE        ADC_FLCON_MODE_AVG
+  #define ADC_FLCON_OVRSAM      ((ADC_SLOW_FILTER_RATIO == 256) ? 0b111 : (ADC_SLOW_FILTER_RATIO == 128) ? 0b110 : \
+                                 (ADC_SLOW_FILTER_RATIO == 64) ? 0b101 : (ADC_SLOW_FILTER_RATIO == 32) ? 0b100 : \
+                                 (ADC_SLOW_FILTER_RATIO == 16) ? 0b011 : (ADC_SLOW_FILTER_RATIO == 8) ? 0b010 : \
+                                 (ADC_SLOW_FILTER_RATIO == 4) ? 0b001 : 0b000)
+#endif
+
+#if (ADC_SLOW_FILTER_MODE != ADC_FILTER_NONE)
+  #define ADC_FLCON(an)         (ADC_FLCON_FLEN | ADC_FLCON_MODE | (ADC_FLCON_OVRSAM << ADC_FLCON_OVRSAM_POS) | ((an) & 0x001F))
+#endif
+
+/* private function prototypes */
+volatile uint16_t adc_ConfigChannel(volatile uint16_t an_input, volatile uint16_t trigger_source, 
+                volatile bool interrupt_enable);
+volatile uint16_t adc_PowerUpCore(volatile uint16_t pwr_mask, volatile uint16_t rdy_mask, 
+                volatile uint16_t en_mask);
+volatile uint16_t adc_ConfigPhaseTrigger(volatile uint16_t generator);
+
+/*!init_adc
+ * ***********************************************************************************************
+ * Description:
+ * Configures the ADC module for 12-bit integer results, assigns trigger sources to fast and 
+ * slow channels, sets up the digital filters of the slow channels and places the PWM ADC 
+ * trigger events. The ADC remains turned off until
+ * launch_adc() is called.
+ * ***********************************************************************************************/
+volatile uint16_t init_adc(void) {
+
+    volatile uint16_t fres = 1;
+    
+    ADCON1Lbits.ADON = 0;           // Turn off ADC module during configuration
+    ADCON1Lbits.ADSIDL = 0;         // Continue operation in IDLE mode
+    ADCON1Hbits.FORM = 0;           // Integer output data format
+    ADCON1Hbits.SHRRES = 0b11;      // Shared core 12-bit resolution
+    ADCON2Lbits.SHRADCS = 0;        // Shared core clock divider 1:2
+    ADCON2Hbits.SHRSAMC = 8;        // Shared core sample time 10 TADCORE
+    ADCON3Lbits.REFSEL = 0;         // AVDD/AVSS voltage reference
+    ADCON3Hbits.CLKSEL = 0b01;      // ADC module clock source FOSC
+    ADCON3Hbits.CLKDIV = 0;         // ADC module clock divider 1:1
+    ADCON5Hbits.WARMTIME = 0b1111;  // Core warm-up time 32768 source clock periods
+    
+    // Dedicated core of the fast channel
+  #if (ADC_FAST_VOUT_CORE == 0)
+    ADCORE0Hbits.RES = 0b11;        // Core #0 12-bit resolution
+    ADCORE0Hbits.ADCS = 0;          // Core #0 clock divider 1:2
+    ADCORE0Lbits.SAMC = 0;          // Sampling is stopped by the trigger (minimum latency)
+    ADCON4Lbits.SAMC0EN = 0;        // No extended sampling time after trigger
+    ADCON4Hbits.C0CHS = 0;          // Core #0 input is AN0
+  #endif
+    
+    // Fast channel: PWM Trigger 2, interrupt executes the control loop 
+    ADC_FAST_VOUT_INIT_ANALOG;
+    fres &= adc_ConfigChannel(ADC_FAST_VOUT_AN_INPUT, ADC_TRGSRC_PWM1_TRIG2, true);
+    
+    // Slow channels: PWM Trigger 1 (with postscaler), no interrupts
+    ADC_SLOW_INIT_ANALOG(ADC_SLOW_VIN);
+    ADC_SLOW_INIT_ANALOG(ADC_SLOW_IIN);
+    ADC_SLOW_INIT_ANALOG(ADC_SLOW_IOUT);
+    ADC_SLOW_INIT_ANALOG(ADC_SLOW_TEMP);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_SLOW_VIN), ADC_TRGSRC_PWM1_TRIG1, false);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_SLOW_IIN), ADC_TRGSRC_PWM1_TRIG1, false);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_SLOW_IOUT), ADC_TRGSRC_PWM1_TRIG1, false);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_SLOW_TEMP), ADC_TRGSRC_PWM1_TRIG1, false);
+    
+  #if (CONVERTER_PHASES > 1)
+    // Phase currents: ADC Trigger 2 of the PWM generator of each phase, no interrupts
+    ADC_SLOW_INIT_ANALOG(ADC_PHASE_CS_1);
+    ADC_SLOW_INIT_ANALOG(ADC_PHASE_CS_2);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_PHASE_CS_1), ADC_TRGSRC_PWM_TRIG2(PWM_PHASE_GENERATOR_1), false);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_PHASE_CS_2), ADC_TRGSRC_PWM_TRIG2(PWM_PHASE_GENERATOR_2), false);
+    fres &= adc_ConfigPhaseTrigger(PWM_PHASE_GENERATOR_2);
+  #endif
+  #if (CONVERTER_PHASES > 2)
+    ADC_SLOW_INIT_ANALOG(ADC_PHASE_CS_3);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_PHASE_CS_3), ADC_TRGSRC_PWM_TRIG2(PWM_PHASE_GENERATOR_3), false);
+    fres &= adc_ConfigPhaseTrigger(PWM_PHASE_GENERATOR_3);
+  #endif
+  #if (CONVERTER_PHASES > 3)
+    ADC_SLOW_INIT_ANALOG(ADC_PHASE_CS_4);
+    fres &= adc_ConfigChannel(ADC_SLOW_AN_INPUT(ADC_PHASE_CS_4), ADC_TRGSRC_PWM_TRIG2(PWM_PHASE_GENERATOR_4), false);
+    fres &= adc_ConfigPhaseTrigger(PWM_PHASE_GENERATOR_4);
+  #endif
+    
+  #if (ADC_SLOW_FILTER_MODE != ADC_FILTER_NONE)
+    // Slow channel digital filters (decimation without interrupts)
+    ADC_FILTER_CON(ADC_SLOW_VIN_FILTER) = ADC_FLCON(ADC_SLOW_AN_INPUT(ADC_SLOW_VIN));
+    ADC_FILTER_CON(ADC_SLOW_IIN_FILTER) = ADC_FLCON(ADC_SLOW_AN_INPUT(ADC_SLOW_IIN));
+    ADC_FILTER_CON(ADC_SLOW_IOUT_FILTER) = ADC_FLCON(ADC_SLOW_AN_INPUT(ADC_SLOW_IOUT));
+    ADC_FILTER_CON(ADC_SLOW_TEMP_FILTER) = ADC_FLCON(ADC_SLOW_AN_INPUT(ADC_SLOW_TEMP));
+  #endif
+    
+    // PWM ADC trigger placement and routing
+    ADC_PWM_TRIGA = ADC_FAST_TRIGGER;   // Fast channel trigger position
+    ADC_PWM_TRIGB = ADC_SLOW_TRIGGER;   // Slow channel trigger position
+    ADC_PWM_EVTHbits.ADTR2EN1 = 1;      // PGxTRIGA drives ADC Trigger 2
+    ADC_PWM_EVTLbits.ADTR1EN2 = 1;      // PGxTRIGB drives ADC Trigger 1
+    ADC_PWM_EVTLbits.ADTR1PS = ADC_SLOW_TRIGGER_POSTSCALER; // ADC Trigger 1 postscaler
+    
+    return(fres);
+}
+
+/*!launch_adc
+ * ***********************************************************************************************
+ * Description:
+ * Turns on the ADC module and powers up the shared core and the dedicated core of the fast 
+ * channel. Returns 0 if one of the cores did not become ready within ADC_CORE_POWER_UP_TIMEOUT.
+ * ***********************************************************************************************/
+volatile uint16_t launch_adc(void) {
+
+    volatile uint16_t fres = 1;
+    
+    ADCON1Lbits.ADON = 1; // Turn on ADC module
+    
+    fres &= adc_PowerUpCore(ADC_SHARED_CORE_PWR, ADC_SHARED_CORE_RDY, ADC_SHARED_CORE_EN);
+  #if (ADC_FAST_VOUT_CORE != ADC_CORE_SHARED)
+    fres &= adc_PowerUpCore(ADC_CORE_PWR(ADC_FAST_VOUT_CORE), ADC_CORE_RDY(ADC_FAST_VOUT_CORE), 
+                ADC_CORE_EN(ADC_FAST_VOUT_CORE));
+  #endif
+    
+    ADC_FAST_VOUT_IF = 0; // Clear pending interrupt flag bit of the fast channel
+    
+    return(fres);
+}
+
+/* ************************************************************************************************
+ * Configures the trigger source and common interrupt of a single analog input
+ * ************************************************************************************************/
+volatile uint16_t adc_ConfigChannel(volatile uint16_t an_input, volatile uint16_t trigger_source, 
+                volatile bool interrupt_enable) {
+    
+    volatile uint8_t* trgsrc = (volatile uint8_t*)&ADTRIG0L;
+    
+    if (an_input > 31)
+    { return(0); }
+    
+    trgsrc[an_input] = (uint8_t)trigger_source; // ADTRIGxL/H hold one TRGSRC byte per input
+    
+    if (an_input < 16)
+    {
+        if (interrupt_enable) { ADIEL |= (1 << an_input); }
+        else { ADIEL &= ~(1 << an_input); }
+    }
+    else
+    {
+        if (interrupt_enable) { ADIEH |= (1 << (an_input - 16)); }
+        else { ADIEH &= ~(1 << (an_input - 16)); }
+    }
+    
+    return(1);
+}
+
+/* ************************************************************************************************
+ * Powers up an ADC core and enables it after it has become ready
+ * ************************************************************************************************/
+volatile uint16_t adc_PowerUpCore(volatile uint16_t pwr_mask, volatile uint16_t rdy_mask, 
+                volatile uint16_t en_mask) {
+    
+    volatile uint16_t timeout = 0;
+    
+    ADCON5L |= pwr_mask; // Power up core
+    
+    while ((!(ADCON5L & rdy_mask)) && (timeout++ < ADC_CORE_POWER_UP_TIMEOUT));
+    if (!(ADCON5L & rdy_mask))
+    { return(0); } // Core did not become ready
+    
+    ADCON3H |= en_mask; // Enable core
+    
+    return(1);
+}
+
+/* ************************************************************************************************
+ * Places the phase current trigger of a following phase and routes it to ADC Trigger 2
+ * ************************************************************************************************/
+volatile uint16_t adc_ConfigPhaseTrigger(volatile uint16_t generator) {
+    
+    PWM_PGx(TRIGA, generator) = ADC_FAST_TRIGGER; // Same position as phase #1 relative to the own SOC
+    PWM_PGx(EVTH, generator) |= ADC_PWM_EVTH_ADTR2EN1;
+    
+    return(1);
+}
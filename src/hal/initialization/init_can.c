@@ -0,0 +1,221 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   init_can.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 04:00 PM
+ */
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/initialization/init_can.h"
+
+// CANCLKCON register settings
+#define CAN_CANCLKCON_EN        0x8000  // CAN FD clock generator is enabled
+#define CAN_CANCLKCON_SEL_FPLLO 0x0100  // CAN FD clock source is FPLLO (see device data sheet)
+#define CAN_CANCLKCON_DIV       ((uint16_t)(200000000UL / CAN_CLOCK_FREQUENCY) - 1) // Divider of FPLLO = 200 MHz
+#define CAN_CANCLKCON_INIT      (CAN_CANCLKCON_EN | CAN_CANCLKCON_SEL_FPLLO | CAN_CANCLKCON_DIV)
+
+// CxCONL/CxCONH register settings
+#define CAN_CONL_CON            0x8000  // CAN FD module is enabled
+#define CAN_CONL_ISOCRCEN       0x0020  // ISO CRC of CAN FD frames is enabled
+#define CAN_CONH_REQOP_MASK     0x0700  // Request operating mode bits
+#define CAN_CONH_OPMOD_MASK     0x00E0  // Operating mode status bits
+#define CAN_CONH_TXQEN          0x0010  // Transmit queue is enabled
+#define CAN_CONH_STEF           0x0008  // Transmit event FIFO is enabled
+#define CAN_MODE_NORMAL_FD      0b000   // Normal CAN FD mode
+#define CAN_MODE_CONFIG         0b100   // Configuration mode
+
+// CxFIFOCONxL/CxFIFOCONxH register settings
+#define CAN_FIFOCONL_TXREQ      0x0200  // Message send request
+#define CAN_FIFOCONL_UINC       0x0100  // Increment FIFO head/tail
+#define CAN_FIFOCONL_TXEN       0x0080  // FIFO is a transmit FIFO
+#define CAN_FIFOCONH_TXAT_3     0x0060  // Unlimited retransmission attempts
+#define CAN_FIFOSTA_TFNRFNIF    0x0001  // Transmit FIFO not full/receive FIFO not empty
+
+// CxFLTCONxL register settings
+#define CAN_FLTCON_FLTEN0       0x0080  // Filter 0 is enabled
+#define CAN_FLTCON_FLTEN1       0x8000  // Filter 1 is enabled
+#define CAN_FLTCON_F0BP_FIFO2   0x0002  // Filter 0 points to FIFO2
+#define CAN_FLTCON_F1BP_FIFO2   0x0200  // Filter 1 points to FIFO2
+#define CAN_FLTMASK_MIDE        0x4000  // Match only standard or extended frames as selected by EXIDE
+#define CAN_SID_MASK            0x07FF  // 11-bit standard identifier
+
+// Message object header word #2 (T1/R1)
+#define CAN_MSG_DLC_MASK        0x000F  // Data length code
+#define CAN_MSG_BRS             0x0040  // Bit rate switching
+#define CAN_MSG_FDF             0x0080  // CAN FD frame
+
+// Message RAM of all FIFOs read and written by the CAN FD module
+volatile uint16_t __attribute__((aligned(4))) can_message_ram[CAN_MESSAGE_RAM_SIZE >> 1];
+
+// Payload size in bytes of each CAN FD data length code
+const uint8_t can_dlc_size[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+/* private function prototypes */
+volatile uint16_t can_SetMode(volatile uint16_t mode);
+
+/*!init_can
+ * ***********************************************************************************************
+ * Description:
+ * Initializes the CAN FD module with one transmit and one receive FIFO and two acceptance 
+ * filters for command messages to this node and broadcast command messages. Returns 0 if the
+ * module did not enter configuration or normal mode within CAN_MODE_TIMEOUT.
+ * ***********************************************************************************************/
+
+volatile uint16_t init_can(void) {
+    
+    volatile uint16_t fres = 1;
+    
+    // Pin assignment
+    pps_UnlockIO();
+    CAN_PPSIN_C1RX = CAN_RX_RP;
+    pps_RemapOutput(CAN_TX_RP, CAN_PPSOUT_C1TX);
+    pps_LockIO();
+    
+    // Clock and configuration mode
+    CANCLKCON = CAN_CANCLKCON_INIT;
+    C1CONL = (CAN_CONL_CON | CAN_CONL_ISOCRCEN);
+    fres &= can_SetMode(CAN_MODE_CONFIG);
+    C1CONH &= ~(CAN_CONH_TXQEN | CAN_CONH_STEF); // message RAM only holds FIFO1 and FIFO2
+    
+    // Bit timing (BRP = 1) and automatic transmitter delay compensation
+    C1NBTCFGH = (CAN_NOMINAL_TSEG1 - 1);
+    C1NBTCFGL = ((CAN_NOMINAL_TSEG2 - 1) << 8) | (CAN_NOMINAL_TSEG2 - 1);
+    C1DBTCFGH = (CAN_DATA_TSEG1 - 1);
+    C1DBTCFGL = ((CAN_DATA_TSEG2 - 1) << 8) | (CAN_DATA_TSEG2 - 1);
+    C1TDCH = 0x0002; // TDCMOD = automatic
+    C1TDCL = (CAN_DATA_TSEG1 << 8); // TDCO = data phase sample point
+    
+    // Message RAM: FIFO1 (transmit) followed by FIFO2 (receive)
+    C1FIFOBAL = (uint16_t)&can_message_ram[0];
+    C1FIFOBAH = 0;
+    
+    C1FIFOCON1H = (CAN_TX_PLSIZE << 13) | ((CAN_TX_FIFO_DEPTH - 1) << 8) | CAN_FIFOCONH_TXAT_3;
+    C1FIFOCON1L = CAN_FIFOCONL_TXEN;
+    C1FIFOCON2H = (CAN_RX_PLSIZE << 13) | ((CAN_RX_FIFO_DEPTH - 1) << 8);
+    C1FIFOCON2L = 0;
+    
+    // Acceptance filters (standard frames, all identifier bits compared)
+    C1FLTCON0L = 0;
+    C1FLTOBJ0L = (CAN_ID_COMMAND & CAN_SID_MASK);
+    C1FLTOBJ0H = 0;
+    C1MASK0L = CAN_SID_MASK;
+    C1MASK0H = CAN_FLTMASK_MIDE;
+    C1FLTOBJ1L = (CAN_ID_COMMAND_BROADCAST & CAN_SID_MASK);
+    C1FLTOBJ1H = 0;
+    C1MASK1L = CAN_SID_MASK;
+    C1MASK1H = CAN_FLTMASK_MIDE;
+    C1FLTCON0L = (CAN_FLTCON_FLTEN0 | CAN_FLTCON_F0BP_FIFO2 | CAN_FLTCON_FLTEN1 | CAN_FLTCON_F1BP_FIFO2);
+    
+    // Normal CAN FD mode
+    fres &= can_SetMode(CAN_MODE_NORMAL_FD);
+    
+    return(fres);
+}
+
+/*!can_Transmit
+ * ***********************************************************************************************
+ * Description:
+ * Queues a CAN FD message with bit rate switching of <length> bytes of <data> with the standard 
+ * identifier <sid> in the transmit FIFO. The payload is padded with zeros to the next valid CAN 
+ * FD data length. Returns 0 if the transmit FIFO is full or <length> exceeds CAN_TX_PAYLOAD_SIZE.
+ * ***********************************************************************************************/
+
+volatile uint16_t can_Transmit(volatile uint16_t sid, volatile uint8_t* data, volatile uint16_t length) {
+    
+    volatile uint16_t* msg;
+    volatile uint8_t* payload;
+    volatile uint16_t dlc=0, i=0;
+    
+    if ((!(C1FIFOSTA1 & CAN_FIFOSTA_TFNRFNIF)) || (length > CAN_TX_PAYLOAD_SIZE))
+    { return(0); }
+    
+    while (can_dlc_size[dlc] < length) { dlc++; }
+    
+    msg = (volatile uint16_t*)C1FIFOUA1L;
+    msg[0] = (sid & CAN_SID_MASK);
+    msg[1] = 0;
+    msg[2] = (CAN_MSG_FDF | CAN_MSG_BRS | dlc);
+    msg[3] = 0;
+    
+    payload = (volatile uint8_t*)&msg[4];
+    for (i=0; i<can_dlc_size[dlc]; i++)
+    { payload[i] = (i < length) ? data[i] : 0; }
+    
+    C1FIFOCON1L |= (CAN_FIFOCONL_UINC | CAN_FIFOCONL_TXREQ);
+    
+    return(1);
+}
+
+/*!can_Receive
+ * ***********************************************************************************************
+ * Description:
+ * Copies the oldest message of the receive FIFO into <data> and releases its message object. 
+ * <data> has to provide CAN_RX_PAYLOAD_SIZE bytes. Returns 0 if the receive FIFO is empty.
+ * ***********************************************************************************************/
+
+volatile uint16_t can_Receive(volatile uint16_t* sid, volatile uint8_t* data, volatile uint16_t* length) {
+    
+    volatile uint16_t* msg;
+    volatile uint8_t* payload;
+    volatile uint16_t i=0, size=0;
+    
+    if (!(C1FIFOSTA2 & CAN_FIFOSTA_TFNRFNIF))
+    { return(0); }
+    
+    msg = (volatile uint16_t*)C1FIFOUA2L;
+    size = can_dlc_size[(msg[2] & CAN_MSG_DLC_MASK)];
+    if (size > CAN_RX_PAYLOAD_SIZE) { size = CAN_RX_PAYLOAD_SIZE; }
+    
+    *sid = (msg[0] & CAN_SID_MASK);
+    *length = size;
+    
+    payload = (volatile uint8_t*)&msg[4];
+    for (i=0; i<size; i++)
+    { data[i] = payload[i]; }
+    
+    C1FIFOCON2L |= CAN_FIFOCONL_UINC;
+    
+    return(1);
+}
+
+/*!can_SetMode
+ * ***********************************************************************************************
+ * Description:
+ * Requests the given operating mode and waits until the module has entered it. 
+ * Returns 0 if the mode has not been entered within CAN_MODE_TIMEOUT.
+ * ***********************************************************************************************/
+
+volatile uint16_t can_SetMode(volatile uint16_t mode) {
+    
+    volatile uint16_t timeout = 0;
+    
+    C1CONH = (C1CONH & ~CAN_CONH_REQOP_MASK) | (mode << 8);
+    while ((((C1CONH & CAN_CONH_OPMOD_MASK) >> 5) != mode) && (timeout++ < CAN_MODE_TIMEOUT));
+    
+    return(timeout < CAN_MODE_TIMEOUT);
+}
@@ -30,6 +30,21 @@
 
 #include "hal/initialization/init_fosc.h"
 #include "mcal/config/devcfg_oscillator.h"
+#include "hal/config/syscfg_options.h"
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_timebase.h"
+#include "_root/generic/task_resumable.h"
+#include "_root/generic/task_slack.h"
+
+#if ((USE_DEFERRED_CLOCK_STARTUP == 1) && (USE_TASK_MANAGER_TIME_BASE == 0))
+  #error "The deferred clock startup requires USE_TASK_MANAGER_TIME_BASE = 1"
+#endif
+
+volatile OSC_STARTUP_t osc_startup; // Deferred clock startup status
+
+/* private function prototypes */
+inline volatile uint16_t osc_ClockUpdate(void);
 
 
 /*!init_oscillator()
@@ -97,3 +112,194 @@ volatile uint16_t init_aux_oscillator(void) {
     return(fres);
 }
 
+/*!init_oscillator_deferred()
+ * ************************************************************************************************
+ * Summary:
+ * Requests the CPU oscillator switch-over to FRC+PLL without waiting for the PLL to lock
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ * 
+ * Description:
+ * Configures the main PLL (see OSC_DEFERRED_PLL_x) and requests the switch-over to the FRC 
+ * oscillator with PLL. The CPU keeps running from FRC until the PLL has locked, when the 
+ * switch-over is completed by hardware. The system frequencies data structure is set up for 
+ * the FRC clock until the switch-over has been detected by launch_oscillator().
+ * 
+ * ***********************************************************************************************/
+
+volatile uint16_t init_oscillator_deferred(void) {
+
+    osc_startup.main_ready = false;
+    osc_startup.aux_ready = false;
+    osc_startup.main_ticks = 0;
+    osc_startup.aux_ticks = 0;
+    osc_startup.ticks = 0;
+    
+    // Configure PLL dividers
+    CLKDIVbits.PLLPRE = OSC_DEFERRED_PLL_N1;
+    PLLFBDbits.PLLFBDIV = OSC_DEFERRED_PLL_M;
+    PLLDIVbits.POST1DIV = OSC_DEFERRED_PLL_N2;
+    PLLDIVbits.POST2DIV = OSC_DEFERRED_PLL_N3;
+    
+    // Request switch-over to FRC with PLL
+    __builtin_write_OSCCONH(OSC_NOSC_FRCPLL);
+    __builtin_write_OSCCONL(OSCCON | 0x01);
+    
+    // Run scheduler setup at the FRC clock
+    system_frequencies.frc = OSC_FRC_FREQUENCY;
+    system_frequencies.fosc = OSC_FRC_FREQUENCY;
+    system_frequencies.fcy = (OSC_FRC_FREQUENCY >> 1);
+    system_frequencies.fp = system_frequencies.fcy;
+    system_frequencies.tcy = (1.0 / (float)system_frequencies.fcy);
+    system_frequencies.tp = (1.0 / (float)system_frequencies.fp);
+    system_frequencies.fpllo = 0;
+    system_frequencies.fvco = 0;
+    system_frequencies.afpllo = 0;
+    system_frequencies.afvco = 0;
+    
+    return(1);
+}
+
+/*!init_aux_oscillator_deferred()
+ * ************************************************************************************************
+ * Summary:
+ * Starts the auxiliary PLL without waiting for it to lock
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ * 
+ * Description:
+ * Configures the auxiliary PLL (see OSC_DEFERRED_APLL_x) to run from FRC and enables it. 
+ * The lock of the auxiliary PLL is detected by launch_oscillator().
+ * 
+ * ***********************************************************************************************/
+
+volatile uint16_t init_aux_oscillator_deferred(void) {
+
+    ACLKCON1bits.APLLEN = 0;
+    ACLKCON1bits.FRCSEL = 1; // Auxiliary PLL input is FRC
+    ACLKCON1bits.APLLPRE = OSC_DEFERRED_APLL_N1;
+    APLLFBD1bits.APLLFBDIV = OSC_DEFERRED_APLL_M;
+    APLLDIV1bits.APOST1DIV = OSC_DEFERRED_APLL_N2;
+    APLLDIV1bits.APOST2DIV = OSC_DEFERRED_APLL_N3;
+    ACLKCON1bits.APLLEN = 1;
+    
+    return(1);
+}
+
+/*!launch_oscillator()
+ * ************************************************************************************************
+ * Summary:
+ * Polls the deferred CPU oscillator switch-over and auxiliary PLL lock
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE (switch-over failed or PLLs did not lock within OSC_DEFERRED_TIMEOUT ticks)
+ * 1 = TRUE
+ * 
+ * Description:
+ * This task is called by the boot task queue once per scheduler tick. As soon as the CPU
+ * oscillator switch-over has completed, the system frequencies and all CPU clock dependent 
+ * timer periods are updated. While the switch-over or the auxiliary PLL lock are pending, 
+ * the task holds the task queue at its position. The number of scheduler ticks until both 
+ * events occurred are captured in osc_startup.
+ * 
+ * When USE_DEFERRED_CLOCK_STARTUP is disabled, both PLLs have already been locked by
+ * CLOCK_Initialize() and this task returns immediately.
+ * 
+ * ***********************************************************************************************/
+
+volatile uint16_t launch_oscillator(void) {
+
+    volatile uint16_t fres = 1;
+
+    #if (USE_DEFERRED_CLOCK_STARTUP == 1)
+    
+    if ((osc_startup.main_ready) && (osc_startup.aux_ready))
+    { return(1); }
+    
+    // Detect completed CPU oscillator switch-over
+    if ((!osc_startup.main_ready) && (!OSCCONbits.OSWEN))
+    {
+        if (OSCCONbits.COSC != OSC_NOSC_FRCPLL)
+        { return(0); } // Switch-over has been rejected
+        
+        osc_startup.main_ready = true;
+        osc_startup.main_ticks = osc_startup.ticks;
+        fres &= osc_ClockUpdate();
+    }
+    
+    // Detect auxiliary PLL lock
+    if ((!osc_startup.aux_ready) && (ACLKCON1bits.APLLCK))
+    {
+        osc_startup.aux_ready = true;
+        osc_startup.aux_ticks = osc_startup.ticks;
+        fres &= osc_get_frequencies(0); // Update auxiliary clock frequencies
+    }
+    
+    if ((osc_startup.main_ready) && (osc_startup.aux_ready))
+    { return(fres); }
+    
+    if (++osc_startup.ticks >= OSC_DEFERRED_TIMEOUT)
+    { return(0); } // Release task queue and report the timeout
+    
+    task_mgr.status.flags.queue_hold = true; // Call this task again in the next time slot
+    
+    #endif
+    
+    return(fres);
+}
+
+#if (USE_DEFERRED_CLOCK_STARTUP == 1)
+
+/*!osc_ClockUpdate()
+ * ************************************************************************************************
+ * Summary:
+ * Re-derives CPU clock dependent settings after the deferred switch-over
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ * 
+ * Description:
+ * Updates the system frequencies and converts the timer periods of the scheduler time base, 
+ * the real-time task tier and the slice budget of resumable tasks to the new CPU clock.
+ * 
+ * ***********************************************************************************************/
+
+inline volatile uint16_t osc_ClockUpdate(void) {
+
+    volatile uint16_t fres = 1;
+    
+    fres &= osc_get_frequencies(0); // Update system frequencies data structure
+    fres &= task_TimeBaseClockChange(); // Keep the scheduler tick period at the new CPU clock
+    fres &= task_ResumableClockChange(); // Keep the slice budget of resumable tasks at the new CPU clock
+    
+    #if (USE_TASK_MANAGER_RT_TIER == 1)
+    RT_TIER_TIMER_PERIOD_REGISTER = RT_TIER_PERIOD; // Keep the real-time tier period at the new CPU clock
+    #endif
+    
+    #if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+    task_slack.guard = TASK_MGR_SLACK_GUARD; // Keep the guard time of the slack executor at the new CPU clock
+    #endif
+    
+    return(fres);
+}
+
+#endif  /* USE_DEFERRED_CLOCK_STARTUP */
+
+// EOF
@@ -0,0 +1,161 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   init_pwm.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 02:00 PM
+ */
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/initialization/init_pwm.h"
+
+// PCLKCON register settings
+#define PWM_PCLKCON_HRRDY       0x8000  // High-resolution clock is ready
+#define PWM_PCLKCON_HRERR       0x4000  // High-resolution clock error
+#define PWM_PCLKCON_DIVSEL      ((PWM_PCLKDIV_PRIMARY - 1) << 4) // Clock divider DIVSEL<1:0>
+#define PWM_PCLKCON_MCLKSEL     0x0003  // Master clock source is AFPLLO (auxiliary PLL output)
+
+// PGxCONL register settings
+#define PWM_CONL_ON             0x8000  // PWM generator is enabled
+#define PWM_CONL_HREN           0x0080  // High-resolution mode enabled
+#define PWM_CONL_CLKSEL_MCLK    0x0008  // Clock source is the master clock selected by PCLKCON
+#define PWM_CONL_MODSEL_IEM     0x0000  // Independent edge PWM mode
+
+// PGxCONH register settings
+#define PWM_CONH_UPDMOD_SOC     0x0000  // Data registers are latched at the start of the next cycle
+#define PWM_CONH_SOCS_SELF      0x0000  // Start of cycle is self-triggered
+#define PWM_CONH_SOCS_PG(n)     ((((n)-1) & 0x0003) + 1) // Start of cycle is triggered by PGn (or PGn+4)
+
+// PGxIOCONH register settings
+#define PWM_IOCONH_PMOD_COMPL   0x0000  // Complementary output mode
+#define PWM_IOCONH_PENH         0x0008  // PWMxH output is controlled by the PWM generator
+#define PWM_IOCONH_PENL         0x0004  // PWMxL output is controlled by the PWM generator
+
+// PGxIOCONL register settings
+#define PWM_IOCONL_OVRDAT_LOW   0x0000  // Override state of PWMxH/PWMxL is LOW
+#define PWM_IOCONL_OSYNC_SOC    0x0000  // Overrides are synchronized to the switching period
+
+// PGxEVTL register settings
+#define PWM_EVTL_UPDTRG_DC      0x0008  // A write of PGxDC sets the update request automatically
+#define PWM_EVTL_PGTRGSEL_TRIGC 0x0003  // PGxTRIGC compare event is the PWM generator trigger output
+#define PWM_EVTL_UPDTRG_MASK    0x0018  // UPDTRG<1:0>
+#define PWM_EVTL_PGTRGSEL_MASK  0x0007  // PGTRGSEL<2:0>
+
+// PGxLEBH register settings
+#define PWM_LEBH_PHR            0x0008  // Rising edge of PWMxH triggers the blanking counter
+
+#define PWM_CONL_INIT           (PWM_CONL_HREN | PWM_CONL_CLKSEL_MCLK | PWM_CONL_MODSEL_IEM)
+#define PWM_IOCONH_INIT         (PWM_IOCONH_PMOD_COMPL | PWM_IOCONH_PENH | PWM_IOCONH_PENL)
+#define PWM_IOCONL_INIT         (PWM_IOCONL_OVREN | PWM_IOCONL_OVRDAT_LOW | PWM_IOCONL_OSYNC_SOC)
+
+/* private function prototypes */
+volatile uint16_t pwm_InitPhase(volatile uint16_t generator, volatile uint16_t trigger_source);
+
+/*!init_pwm
+ * ***********************************************************************************************
+ * Description:
+ * Loads the precomputed register values into the PWM generators of all converter phases. The 
+ * generators remain turned off and their outputs are overridden LOW until launch_pwm() is called
+ * and the outputs are released.
+ * ***********************************************************************************************/
+volatile uint16_t init_pwm(void) {
+
+    volatile uint16_t fres = 1;
+    
+    PCLKCON = (PWM_PCLKCON_DIVSEL | PWM_PCLKCON_MCLKSEL); // PWM master clock selection
+    
+    // Phase #1 is self-triggered, each further phase is triggered by its preceding phase
+    fres &= pwm_InitPhase(PWM_PHASE_GENERATOR_1, PWM_CONH_SOCS_SELF);
+  #if (CONVERTER_PHASES > 1)
+    fres &= pwm_InitPhase(PWM_PHASE_GENERATOR_2, PWM_CONH_SOCS_PG(PWM_PHASE_GENERATOR_1));
+  #endif
+  #if (CONVERTER_PHASES > 2)
+    fres &= pwm_InitPhase(PWM_PHASE_GENERATOR_3, PWM_CONH_SOCS_PG(PWM_PHASE_GENERATOR_2));
+  #endif
+  #if (CONVERTER_PHASES > 3)
+    fres &= pwm_InitPhase(PWM_PHASE_GENERATOR_4, PWM_CONH_SOCS_PG(PWM_PHASE_GENERATOR_3));
+  #endif
+    
+    return(fres);
+}
+
+/*!launch_pwm
+ * ***********************************************************************************************
+ * Description:
+ * Waits for the high-resolution clock to become ready and turns on the PWM generators. The PWM
+ * generators start generating ADC triggers while the outputs remain overridden. Returns 0 if 
+ * the high-resolution clock did not become ready within PWM_HRRDY_TIMEOUT or reported an error.
+ * ***********************************************************************************************/
+volatile uint16_t launch_pwm(void) {
+
+    volatile uint16_t timeout = 0;
+    
+    while ((!(PCLKCON & PWM_PCLKCON_HRRDY)) && (timeout++ < PWM_HRRDY_TIMEOUT));
+    if ((timeout >= PWM_HRRDY_TIMEOUT) || (PCLKCON & PWM_PCLKCON_HRERR))
+    { return(0); }
+    
+    // Following phases are turned on first and wait for the trigger of their preceding phase
+  #if (CONVERTER_PHASES > 3)
+    PWM_PGx(CONL, PWM_PHASE_GENERATOR_4) |= PWM_CONL_ON;
+  #endif
+  #if (CONVERTER_PHASES > 2)
+    PWM_PGx(CONL, PWM_PHASE_GENERATOR_3) |= PWM_CONL_ON;
+  #endif
+  #if (CONVERTER_PHASES > 1)
+    PWM_PGx(CONL, PWM_PHASE_GENERATOR_2) |= PWM_CONL_ON;
+  #endif
+    PWM_PGx(CONL, PWM_PHASE_GENERATOR_1) |= PWM_CONL_ON; // Turn on PWM generator of phase #1
+    
+    return(1);
+}
+
+/* ************************************************************************************************
+ * Loads the precomputed register values into the PWM generator of one converter phase
+ * ************************************************************************************************/
+volatile uint16_t pwm_InitPhase(volatile uint16_t generator, volatile uint16_t trigger_source) {
+    
+    PWM_PGx(CONL, generator) = PWM_CONL_INIT;   // Generator off, high-resolution, independent edge mode
+    PWM_PGx(CONH, generator) = (PWM_CONH_UPDMOD_SOC | trigger_source); // SOC update
+    PWM_PGx(IOCONL, generator) = PWM_IOCONL_INIT; // Outputs overridden LOW
+    PWM_PGx(IOCONH, generator) = PWM_IOCONH_INIT; // Complementary outputs
+    
+    PWM_PGx(PER, generator) = PWM_PERIOD;       // Switching period
+    PWM_PGx(PHASE, generator) = PWM_PHASE;      // Phase register
+    PWM_PGx(DC, generator) = PWM_DUTY_CYCLE_INIT; // Initial duty cycle
+    PWM_PGx(DTH, generator) = PWM_DEAD_TIME_H;  // Dead time at the rising edge of PWMxH
+    PWM_PGx(DTL, generator) = PWM_DEAD_TIME_L;  // Dead time at the falling edge of PWMxH
+    PWM_PGx(TRIGC, generator) = PWM_PHASE_SHIFT; // Start of the following phase
+    
+    PWM_PGx(LEBL, generator) = PWM_LEB_PERIOD;  // Leading edge blanking period
+    PWM_PGx(LEBH, generator) = PWM_LEBH_PHR;    // Rising edge of PWMxH starts the blanking period
+    
+    // Write of PGxDC latches new timing at next SOC, PGxTRIGC triggers the following phase
+    PWM_PGx(EVTL, generator) = ((PWM_PGx(EVTL, generator) & ~(PWM_EVTL_UPDTRG_MASK | PWM_EVTL_PGTRGSEL_MASK)) | 
+                                PWM_EVTL_UPDTRG_DC | PWM_EVTL_PGTRGSEL_TRIGC);
+    
+    return(1);
+}
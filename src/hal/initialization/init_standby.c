@@ -0,0 +1,279 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   init_standby.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 05:00 PM
+ */
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "mcal/mcal.h"
+#include "hal/config/syscfg_options.h"
+#include "hal/initialization/init_standby.h"
+#include "hal/initialization/init_uart.h"
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_timebase.h"
+#include "_root/generic/task_resumable.h"
+#include "_root/generic/task_slack.h"
+
+#if (USE_STANDBY_POWER_MANAGER == 1)
+
+#if (USE_TASK_MANAGER_TIME_BASE == 0)
+  #error "The standby power manager requires USE_TASK_MANAGER_TIME_BASE = 1"
+#endif
+
+volatile STANDBY_STATUS_t standby_status; // Standby entry/exit counters and wake-up polling cycles
+volatile OSC_FREQUENCIES_t standby_run_frequencies; // System frequencies at full speed captured when entering standby
+
+/* private function prototypes */
+inline volatile uint16_t standby_OscillatorSwitch(volatile uint16_t nosc, volatile uint16_t* polls);
+inline volatile uint16_t standby_ClockUpdate(void);
+
+/*!standby_Enter()
+ * ************************************************************************************************
+ * Summary:
+ * Steps the system down to the standby clock
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE (oscillator switch-over timed out, CPU remains at full speed)
+ * 1 = TRUE
+ * 
+ * Description:
+ * Gates all peripherals declared in STANDBY_PMD_REGISTRY, stops the auxiliary PLL (see 
+ * STANDBY_STOP_AUX_PLL) and switches the CPU over to the FRC oscillator without PLL. 
+ * The system frequencies, the telemetry UART baud rate and the scheduler time base are 
+ * re-derived at the new CPU clock. This function is called by the switch-over function of 
+ * OP_MODE_STANDBY.
+ * 
+ * ***********************************************************************************************/
+
+volatile uint16_t standby_Enter(void) {
+
+    volatile uint16_t fres = 1;
+    volatile uint16_t polls = 0;
+    
+    if (standby_status.active)
+    { return(1); }
+    
+    // Gate peripherals not used in standby
+    #define STANDBY_PMD_GATE(bit, init)     (bit) = 1;
+    STANDBY_PMD_REGISTRY(STANDBY_PMD_GATE)
+    
+    #if (STANDBY_STOP_AUX_PLL == 1)
+    ACLKCON1bits.APLLEN = 0; // Stop auxiliary PLL (PWM and ADC clock)
+    #endif
+
+    // Switch CPU over to FRC without PLL
+    fres &= standby_OscillatorSwitch(STANDBY_NOSC_FRC, &polls);
+    if (!fres)
+    { return(0); }
+    
+    standby_run_frequencies = system_frequencies;
+
+    system_frequencies.fosc = system_frequencies.frc;
+    system_frequencies.fcy = (system_frequencies.fosc >> 1);
+    system_frequencies.fp = system_frequencies.fcy;
+    system_frequencies.tcy = (1.0 / (float)system_frequencies.fcy);
+    system_frequencies.tp = (1.0 / (float)system_frequencies.fp);
+    #if (STANDBY_STOP_AUX_PLL == 1)
+    system_frequencies.afpllo = 0;
+    system_frequencies.afvco = 0;
+    #endif
+    
+    standby_status.active = true;
+    standby_status.entries++;
+    
+    fres &= standby_ClockUpdate();
+    
+    return(fres);
+}
+
+/*!standby_Exit()
+ * ************************************************************************************************
+ * Summary:
+ * Returns the system from the standby clock to full speed
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE (oscillator switch-over or PLL lock timed out)
+ * 1 = TRUE
+ * 
+ * Description:
+ * Re-enables the auxiliary PLL, switches the CPU back to the FRC oscillator with PLL and 
+ * waits for the auxiliary PLL to lock. Each polling loop is bounded by STANDBY_WAKEUP_TIMEOUT and 
+ * its number of polling cycles is captured in standby_status. Once the CPU runs at full 
+ * speed, the system frequencies, the telemetry UART baud rate and the scheduler time base 
+ * are restored and the peripherals declared in STANDBY_PMD_REGISTRY are released and 
+ * re-initialized. If the CPU oscillator switch-over times out, the CPU remains at the 
+ * standby clock.
+ * 
+ * This function is called by the task manager when leaving OP_MODE_STANDBY, before the 
+ * task queue of the new operation mode is loaded.
+ * 
+ * ***********************************************************************************************/
+
+volatile uint16_t standby_Exit(void) {
+
+    volatile uint16_t fres = 1;
+    volatile uint16_t polls = 0;
+    volatile uint16_t timeout = 0;
+    
+    // Restart auxiliary PLL first to let it lock while the CPU oscillator switches over
+    #if (STANDBY_STOP_AUX_PLL == 1)
+    ACLKCON1bits.APLLEN = 1;
+    #endif
+    
+    if (standby_status.active)
+    {
+        // Switch CPU over to FRC with PLL (switch-over completes when the PLL has locked)
+        fres &= standby_OscillatorSwitch(STANDBY_NOSC_FRCPLL, &polls);
+
+        standby_status.switch_polls = polls;
+        if (polls > standby_status.switch_polls_max)
+        { standby_status.switch_polls_max = polls; }
+
+        if (!fres) 
+        {
+            // Withdraw switch-over request and stay at the standby clock
+            standby_OscillatorSwitch(STANDBY_NOSC_FRC, &timeout);
+            return(0);
+        }
+        
+        system_frequencies = standby_run_frequencies;
+        
+        standby_status.active = false;
+        standby_status.exits++;
+
+        fres &= standby_ClockUpdate();
+    }
+    
+    // Wait for auxiliary PLL lock
+    #if (STANDBY_STOP_AUX_PLL == 1)
+    polls = 0;
+    while ((!ACLKCON1bits.APLLCK) && (polls < STANDBY_WAKEUP_TIMEOUT))
+    { polls++; }
+    
+    standby_status.apll_polls = polls;
+    if (polls > standby_status.apll_polls_max)
+    { standby_status.apll_polls_max = polls; }
+    
+    if (!ACLKCON1bits.APLLCK) 
+    {
+        standby_status.timeouts++;
+        fres = 0;
+    }
+    #endif
+    
+    // Release and re-initialize gated peripherals
+    #define STANDBY_PMD_RELEASE(bit, init)  (bit) = 0; \
+                                            if ((init) != NULL) { fres &= ((volatile uint16_t (*)(void))(init))(); }
+    STANDBY_PMD_REGISTRY(STANDBY_PMD_RELEASE)
+    
+    return(fres);
+}
+
+/*!standby_OscillatorSwitch()
+ * ************************************************************************************************
+ * Summary:
+ * Performs a bounded CPU oscillator switch-over
+ * 
+ * Parameters:
+ * uint16_t nosc: new oscillator selection (see STANDBY_NOSC_FRC, STANDBY_NOSC_FRCPLL)
+ * uint16_t* polls: number of polling cycles executed 
+ * 
+ * Returns:
+ * 0 = FALSE (switch-over did not complete within STANDBY_WAKEUP_TIMEOUT polling cycles)
+ * 1 = TRUE
+ * 
+ * ***********************************************************************************************/
+
+inline volatile uint16_t standby_OscillatorSwitch(volatile uint16_t nosc, volatile uint16_t* polls) {
+
+    __builtin_write_OSCCONH(nosc);
+    __builtin_write_OSCCONL(OSCCON | 0x01); // Request oscillator switch-over
+    
+    while ((OSCCONbits.OSWEN) && (*polls < STANDBY_WAKEUP_TIMEOUT))
+    { (*polls)++; }
+    
+    if (OSCCONbits.OSWEN)
+    { 
+        standby_status.timeouts++;
+        return(0); 
+    }
+    
+    return((uint16_t)(OSCCONbits.COSC == nosc));
+}
+
+/*!standby_ClockUpdate()
+ * ************************************************************************************************
+ * Summary:
+ * Re-derives CPU clock dependent settings
+ * 
+ * Parameters:
+ * (none)
+ * 
+ * Returns:
+ * 0 = FALSE
+ * 1 = TRUE
+ * 
+ * Description:
+ * Updates the baud rate generator of the telemetry UART and converts the timer periods of the 
+ * scheduler time base, the real-time task tier and the slice budget of resumable tasks to the 
+ * CPU clock given in system_frequencies.
+ * 
+ * ***********************************************************************************************/
+
+inline volatile uint16_t standby_ClockUpdate(void) {
+
+    volatile uint16_t fres = 1;
+    
+    #if (USE_UART == 1)
+    UART_BRG = (uint16_t)((system_frequencies.fcy / (4UL * UART_BAUDRATE)) - 1);
+    #endif
+    
+    fres &= task_TimeBaseClockChange();
+    fres &= task_ResumableClockChange(); // Keep the slice budget of resumable tasks at the new CPU clock
+    
+    #if (USE_TASK_MANAGER_RT_TIER == 1)
+    RT_TIER_TIMER_PERIOD_REGISTER = RT_TIER_PERIOD; // Keep the real-time tier period at the new CPU clock
+    #endif
+    
+    #if (USE_TASK_MANAGER_SLACK_EXECUTOR == 1)
+    task_slack.guard = TASK_MGR_SLACK_GUARD; // Keep the guard time of the slack executor at the new CPU clock
+    #endif
+    
+    return(fres);
+}
+
+#endif  /* USE_STANDBY_POWER_MANAGER */
+
+// EOF
@@ -12,7 +12,11 @@ uint16_t init_system_timer(void) {
     // Default configuration for 16-bit operation off CPU clock
     
     tmr.flags.ton = TON_DISABLED;
+    #if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT)
+    tmr.flags.tsidl = TSIDL_RUN;    // Timer needs to wake up the CPU from IDLE mode
+    #else
     tmr.flags.tsidl = TSIDL_STOP;
+    #endif
     tmr.flags.tcs = TCS_INTERNAL;
     tmr.flags.tgate = TGATE_DISABLED;
     tmr.flags.tsync = TSYNC_NONE;
@@ -44,3 +48,136 @@ uint16_t launch_system_timer(void) {
     
 }
 
+#if (USE_TASK_MANAGER_RT_TIER == 1)
+
+uint16_t init_rt_tier_timer(void) {
+
+    volatile uint16_t fres = 1;
+    TxCON_CONTROL_REGISTER_t tmr;
+    
+    // Initialize Real-Time Tier Timer
+    // Default configuration for 16-bit operation off CPU clock
+    
+    tmr.flags.ton = TON_DISABLED;
+    tmr.flags.tsidl = TSIDL_RUN;    // Real-time tier has to keep running while the CPU is in IDLE mode
+    tmr.flags.tcs = TCS_INTERNAL;
+    tmr.flags.tgate = TGATE_DISABLED;
+    tmr.flags.tsync = TSYNC_NONE;
+
+    #if defined (__P33SMPS_CH2__) || defined (__P33SMPS_CH5__)
+    
+    tmr.flags.tmwdis = TMWDIS_ENABLED;
+    tmr.flags.tmwip = TMWIP_COMPLETE;
+    tmr.flags.prwip = PRWIP_COMPLETE;
+    tmr.flags.tecs = TECS_TCY;
+
+    #endif
+    
+    // write configuration
+    fres &= gstmr_reset(RT_TIER_TIMER_INDEX); 
+    fres &= gstmr_init_timer16b(RT_TIER_TIMER_INDEX, tmr, RT_TIER_PERIOD, RT_TIER_ISR_PRIORITY);
+
+    return(fres);
+}
+
+uint16_t launch_rt_tier_timer(void) {
+
+    volatile uint16_t fres = 1;
+    
+    RT_TIER_TIMER_ISR_FLAG = 0; // Clear pending interrupt flag bit
+    fres &= gstmr_enable(RT_TIER_TIMER_INDEX, 1);  // Enable Timer with interrupts
+    
+    return(fres);
+    
+}
+
+#endif  /* USE_TASK_MANAGER_RT_TIER */
+
+#if (USE_TASK_MANAGER_BENCHMARK == 1)
+
+uint16_t init_bench_timer(void) {
+
+    volatile uint16_t fres = 1;
+    TxCON_CONTROL_REGISTER_t tmr;
+    
+    // Initialize Benchmark Timer
+    // Free running 16-bit counter off CPU clock without interrupts
+    
+    tmr.flags.ton = TON_DISABLED;
+    tmr.flags.tsidl = TSIDL_RUN;
+    tmr.flags.tcs = TCS_INTERNAL;
+    tmr.flags.tgate = TGATE_DISABLED;
+    tmr.flags.tsync = TSYNC_NONE;
+
+    #if defined (__P33SMPS_CH2__) || defined (__P33SMPS_CH5__)
+    
+    tmr.flags.tmwdis = TMWDIS_ENABLED;
+    tmr.flags.tmwip = TMWIP_COMPLETE;
+    tmr.flags.prwip = PRWIP_COMPLETE;
+    tmr.flags.tecs = TECS_TCY;
+
+    #endif
+    
+    // write configuration
+    fres &= gstmr_reset(BENCH_TIMER_INDEX); 
+    fres &= gstmr_init_timer16b(BENCH_TIMER_INDEX, tmr, BENCH_TIMER_PERIOD, 0);
+
+    return(fres);
+}
+
+uint16_t launch_bench_timer(void) {
+
+    volatile uint16_t fres = 1;
+    
+    fres &= gstmr_enable(BENCH_TIMER_INDEX, 0);  // Enable Timer without interrupts
+    
+    return(fres);
+    
+}
+
+#endif  /* USE_TASK_MANAGER_BENCHMARK */
+
+#if (USE_TASK_MANAGER_BOOT_PROFILER == 1)
+
+uint16_t init_boot_timer(void) {
+
+    volatile uint16_t fres = 1;
+    TxCON_CONTROL_REGISTER_t tmr;
+    
+    // Initialize Boot Profiler Timer
+    // Free running 16-bit counter off prescaled CPU clock without interrupts
+    
+    tmr.flags.ton = TON_DISABLED;
+    tmr.flags.tsidl = TSIDL_RUN;
+    tmr.flags.tcs = TCS_INTERNAL;
+    tmr.flags.tgate = TGATE_DISABLED;
+    tmr.flags.tsync = TSYNC_NONE;
+    tmr.flags.tckps = BOOT_PROF_TIMER_TCKPS;
+
+    #if defined (__P33SMPS_CH2__) || defined (__P33SMPS_CH5__)
+    
+    tmr.flags.tmwdis = TMWDIS_ENABLED;
+    tmr.flags.tmwip = TMWIP_COMPLETE;
+    tmr.flags.prwip = PRWIP_COMPLETE;
+    tmr.flags.tecs = TECS_TCY;
+
+    #endif
+    
+    // write configuration
+    fres &= gstmr_reset(BOOT_PROF_TIMER_INDEX); 
+    fres &= gstmr_init_timer16b(BOOT_PROF_TIMER_INDEX, tmr, BOOT_PROF_TIMER_PERIOD, 0);
+
+    return(fres);
+}
+
+uint16_t launch_boot_timer(void) {
+
+    volatile uint16_t fres = 1;
+    
+    fres &= gstmr_enable(BOOT_PROF_TIMER_INDEX, 0);  // Enable Timer without interrupts
+    
+    return(fres);
+    
+}
+
+#endif  /* USE_TASK_MANAGER_BOOT_PROFILER */
@@ -0,0 +1,146 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   init_uart.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 02:00 PM
+ */
+
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mcal/mcal.h"
+#include "hal/initialization/init_uart.h"
+
+// UxMODE register settings
+#define UART_MODE_UARTEN        0x8000  // UART is enabled
+#define UART_MODE_BRGH          0x0080  // High speed baud rate generation (4 clocks per bit)
+#define UART_MODE_UTXEN         0x0020  // Transmitter is enabled
+#define UART_MODE_URXEN         0x0010  // Receiver is enabled
+#define UART_MODE_MOD_ASYNC8    0x0000  // Asynchronous 8-bit UART mode
+
+// UxMODEH register settings
+#define UART_MODEH_BCLKSEL_FCY  0x0000  // Baud clock source is FOSC/2 (= FCY)
+
+// UxSTAH register settings
+#define UART_STAH_UTXISEL_1     0x7000  // Transmit interrupt (DMA trigger) while one buffer slot is free
+
+// DMA settings
+#define UART_DMA_SIZE_BYTE      1       // Byte transfers
+#define UART_DMA_TRMODE_ONESHOT 0b00    // One-shot transfer mode (channel is disabled when the count is done)
+#define UART_DMA_SAMODE_INC     0b01    // Source address is incremented
+#define UART_DMA_DAMODE_FIXED   0b00    // Destination address remains unchanged
+#define UART_DMA_TRMODE_REPEAT  0b01    // Repeated one-shot transfer mode (channel remains enabled)
+#define UART_DMA_SAMODE_FIXED   0b00    // Source address remains unchanged
+#define UART_DMA_DAMODE_INC     0b01    // Destination address is incremented
+
+volatile uint8_t uart_rx_buffer[UART_RX_BUFFER_SIZE]; // Receive ring buffer written by the DMA
+
+#define UART_MODE_INIT          (UART_MODE_BRGH | UART_MODE_MOD_ASYNC8)
+
+/*!init_uart
+ * ***********************************************************************************************
+ * Description:
+ * Initializes the UART at UART_BAUDRATE, the DMA channel moving transmit data into the UART 
+ * transmit buffer and the DMA channel moving received data into the receive ring buffer. The 
+ * baud rate divider is derived from the CPU clock captured during the oscillator initialization.
+ * ***********************************************************************************************/
+
+volatile uint16_t init_uart(void) {
+    
+    // UART transmitter and receiver, 8N1
+    UART_MODE = UART_MODE_INIT;
+    UART_MODEH = UART_MODEH_BCLKSEL_FCY;
+    UART_STAH = UART_STAH_UTXISEL_1;
+    UART_BRG = (uint16_t)((system_frequencies.fcy / (4UL * UART_BAUDRATE)) - 1);
+    
+    UART_MODE |= UART_MODE_UARTEN;
+    UART_MODE |= UART_MODE_UTXEN;
+    UART_MODE |= UART_MODE_URXEN;
+    
+    // DMA controller and transmit channel
+    DMACONbits.DMAEN = 1;
+    DMAL = UART_DMA_RAM_START;
+    DMAH = UART_DMA_RAM_END;
+    
+    UART_DMA_CH.CHEN = 0;
+    UART_DMA_CH.SIZE = UART_DMA_SIZE_BYTE;
+    UART_DMA_CH.TRMODE = UART_DMA_TRMODE_ONESHOT;
+    UART_DMA_CH.SAMODE = UART_DMA_SAMODE_INC;
+    UART_DMA_CH.DAMODE = UART_DMA_DAMODE_FIXED;
+    UART_DMA_INT.CHSEL = UART_DMA_TRIGGER;
+    UART_DMA_DST = (uint16_t)&UART_TXREG;
+    
+    UART_DMA_RX_CH.CHEN = 0;
+    UART_DMA_RX_CH.SIZE = UART_DMA_SIZE_BYTE;
+    UART_DMA_RX_CH.TRMODE = UART_DMA_TRMODE_REPEAT;
+    UART_DMA_RX_CH.SAMODE = UART_DMA_SAMODE_FIXED;
+    UART_DMA_RX_CH.DAMODE = UART_DMA_DAMODE_INC;
+    UART_DMA_RX_CH.RELOAD = 1; // reload destination address and count at the end of the ring buffer
+    UART_DMA_RX_INT.CHSEL = UART_DMA_RX_TRIGGER;
+    UART_DMA_RX_SRC = (uint16_t)&UART_RXREG;
+    UART_DMA_RX_DST = (uint16_t)&uart_rx_buffer[0];
+    UART_DMA_RX_CNT = UART_RX_BUFFER_SIZE;
+    UART_DMA_RX_CH.CHEN = 1;
+    
+    return(1);
+}
+
+/*!uart_DmaTransmit
+ * ***********************************************************************************************
+ * Description:
+ * Starts the transmission of <length> bytes from <buffer> by the DMA channel. Returns 0 if 
+ * the previous transfer has not been completed yet. The buffer must not be modified until 
+ * UART_DMA_BUSY has been cleared.
+ * ***********************************************************************************************/
+
+volatile uint16_t uart_DmaTransmit(volatile uint8_t* buffer, volatile uint16_t length) {
+    
+    if ((UART_DMA_BUSY) || (length == 0))
+    { return(0); }
+    
+    UART_DMA_INT.DONEIF = 0;
+    UART_DMA_SRC = (uint16_t)buffer;
+    UART_DMA_CNT = length;
+    UART_DMA_CH.CHEN = 1; // transfer starts with the next transmit buffer trigger
+    
+    return(1);
+}
+
+/*!uart_DmaRxPosition
+ * ***********************************************************************************************
+ * Description:
+ * Returns the index of the receive ring buffer element, which will be written next by the DMA.
+ * All elements between the last read position and this index have been received.
+ * ***********************************************************************************************/
+
+volatile uint16_t uart_DmaRxPosition(void) {
+    
+    volatile uint16_t pos = 0;
+    
+    pos = (UART_DMA_RX_DST - (uint16_t)&uart_rx_buffer[0]);
+    if (pos >= UART_RX_BUFFER_SIZE) { pos = 0; } // destination address is being reloaded
+    
+    return(pos);
+}
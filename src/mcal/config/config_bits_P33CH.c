@@ -77,10 +77,10 @@
 #pragma config XTBST = ENABLE    //XT Boost->Boost the kick-start
 
 // FWDT
-#pragma config RWDTPS = PS1048576    //Run Mode Watchdog Timer Post Scaler select bits->1:1048576
+#pragma config RWDTPS = PS1024    //Run Mode Watchdog Timer Post Scaler select bits->1:1024
 #pragma config RCLKSEL = LPRC    //Watchdog Timer Clock Select bits->Always use LPRC
 #pragma config WINDIS = OFF    //Watchdog Timer Window Enable bit->Watchdog Timer in Window mode
-#pragma config WDTWIN = WIN25    //Watchdog Timer Window Select bits->WDT Window is 25% of WDT period
+#pragma config WDTWIN = WIN50    //Watchdog Timer Window Select bits->WDT Window is 50% of WDT period
 #pragma config SWDTPS = PS1048576    //Sleep Mode Watchdog Timer Post Scaler select bits->1:1048576
 #pragma config FWDTEN = ON_SW    //Watchdog Timer Enable bit->WDT controlled via SW, use WDTCON.ON bit
 
@@ -219,8 +219,8 @@
 #pragma config MBXM15 = S2M    //Mailbox 15 data direction->Mailbox register configured for Master data read (Slave to Master data transfer)
 
 // FMBXHS1
-#pragma config MBXHSA = MBX15    //Mailbox handshake protocol block A register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block A
-#pragma config MBXHSB = MBX15    //Mailbox handshake protocol block B register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block B
+#pragma config MBXHSA = MBX7    //Mailbox handshake protocol block A register assignment->MSIxMBXD7 assigned to mailbox handshake protocol block A (master-to-slave data, see msi_exchange_config.h)
+#pragma config MBXHSB = MBX15    //Mailbox handshake protocol block B register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block B (slave-to-master data, see msi_exchange_config.h)
 #pragma config MBXHSC = MBX15    //Mailbox handshake protocol block C register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block C
 #pragma config MBXHSD = MBX15    //Mailbox handshake protocol block D register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block D
 
@@ -231,8 +231,8 @@
 #pragma config MBXHSH = MBX15    //Mailbox handshake protocol block H register assignment->MSIxMBXD15 assigned to mailbox handshake protocol block H
 
 // FMBXHSEN
-#pragma config HSAEN = OFF    //Mailbox A data flow control protocol block enable->Mailbox data flow control handshake protocol block disabled.
-#pragma config HSBEN = OFF    //Mailbox B data flow control protocol block enable->Mailbox data flow control handshake protocol block disabled.
+#pragma config HSAEN = ON    //Mailbox A data flow control protocol block enable->Mailbox data flow control handshake protocol block enabled.
+#pragma config HSBEN = ON    //Mailbox B data flow control protocol block enable->Mailbox data flow control handshake protocol block enabled.
 #pragma config HSCEN = OFF    //Mailbox C data flow control protocol block enable->Mailbox data flow control handshake protocol block disabled.
 #pragma config HSDEN = OFF    //Mailbox D data flow control protocol block enable->Mailbox data flow control handshake protocol block disabled.
 #pragma config HSEEN = OFF    //Mailbox E data flow control protocol block enable->Mailbox data flow control handshake protocol block disabled.
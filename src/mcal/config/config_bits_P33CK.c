@@ -54,10 +54,10 @@
 #pragma config XTBST = ENABLE    // XT Boost->Boost the kick-start
 
 // FWDT
-#pragma config RWDTPS = PS1048576    // Run Mode Watchdog Timer Post Scaler select bits->1:1048576
+#pragma config RWDTPS = PS1024    // Run Mode Watchdog Timer Post Scaler select bits->1:1024
 #pragma config RCLKSEL = LPRC    // Watchdog Timer Clock Select bits->Always use LPRC
 #pragma config WINDIS = OFF    // Watchdog Timer Window Enable bit->Watchdog Timer in Window mode
-#pragma config WDTWIN = WIN25    // Watchdog Timer Window Select bits->WDT Window is 25% of WDT period
+#pragma config WDTWIN = WIN50    // Watchdog Timer Window Select bits->WDT Window is 50% of WDT period
 #pragma config SWDTPS = PS1048576    // Sleep Mode Watchdog Timer Post Scaler select bits->1:1048576
 #pragma config FWDTEN = ON_SW    // Watchdog Timer Enable bit->WDT controlled via SW, use WDTCON.ON bit
 
@@ -0,0 +1,117 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   isr_adc.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 11:00 AM
+ **************************************************************************** */
+
+
+// Device header file
+#include <xc.h>
+#include <stdint.h>
+
+#include "apl/apl.h"
+#include "hal/hal.h"
+#include "mcal/mcal.h"
+#include "sfl/sfl.h"
+
+#include "_root/config/task_manager_config.h"
+#include "apl/resources/cvmc_vout.h"
+#include "_root/generic/task_trace.h"
+
+/***************************************************************************
+ISR: 		ADC Interrupt of the output voltage feedback
+Description:	Executes the output voltage control loop. When the cycle 
+                meter is enabled, the CPU cycles of each iteration are 
+                captured from the task manager timer, which is running 
+                at instruction clock without prescaler.
+                When the assembly implementation is selected, the ISR 
+                executes on the alternate working register set assigned 
+                to its priority level (attribute 'context', see IRQ_CONTEXT_SAVE_CONTROL).
+                During soft-start and soft-stop the reference is ramped 
+                in each iteration before the loop is executed.
+                While a loop gain measurement is active, the perturbed 
+                reference is calculated before the loop is executed.
+                The feed-forward stage scales the loop output into the 
+                duty cycle. Interleaved converters distribute the duty cycle to 
+                the duty cycle registers of all phases.
+                In burst mode the loop is not executed while pulses are 
+                skipped (see efficiency.h).
+                While a waveform capture is recorded, the channels of the 
+                scope registry are copied after the loop update (see task_Scope.h).
+***************************************************************************/
+void __attribute__((__interrupt__,IRQ_CONTEXT_SAVE_CONTROL no_auto_psv)) _CVMC_VOUT_ADC_Interrupt() 
+{	
+#if (CVMC_VOUT_CYCLE_METER == 1)
+    volatile uint16_t tstart = TASK_MGR_TIMER_COUNTER_REGISTER;
+    volatile uint16_t tstop = 0;
+#endif
+
+    TRACE_ISR(TRACE_EVT_ISR_ENTRY, TRACE_ISR_CVMC_VOUT);
+
+    if (converter[CONVERTER_VOUT].soft_start.ramp_active)
+    { soft_start_Ramp(&converter[CONVERTER_VOUT]); } // Soft-start/soft-stop reference ramp
+    
+    FRA_SAMPLE(); // Loop gain measurement: perturbed reference and response accumulation (see task_FrequencyResponse.h)
+    
+    if (!EFFICIENCY_BURST_SKIP()) // Burst mode: outputs are overridden above the burst band (see efficiency.h)
+    {
+        CVMC_VOUT_UPDATE(&cvmc_vout);
+      #if (FEEDFORWARD_ENABLED)
+        feedforward_Apply(); // Scale the normalized control output into the duty cycle (input voltage feed-forward, dead-time compensation)
+      #endif
+      #if (CONVERTER_PHASES > 1)
+        multiphase_Distribute(); // Write common duty cycle plus current sharing correction to all phases
+      #endif
+    }
+    
+    SCOPE_SAMPLE(); // Waveform capture: record the channels of the scope registry (see task_Scope.h)
+    
+	CVMC_VOUT_ADC_IF = 0;	// Clear interrupt flag bit
+	
+#if (CVMC_VOUT_CYCLE_METER == 1)
+    tstop = TASK_MGR_TIMER_COUNTER_REGISTER;
+    
+    SEQLOCK_WRITE_BEGIN(cvmc_vout_cycles_lock); // Readers discard copies taken while the meter is updated
+    if (tstop >= tstart)
+    { cvmc_vout_cycles.cycles = (tstop - tstart); }
+    else // timer period has expired during the loop iteration
+    { cvmc_vout_cycles.cycles = (tstop + TASK_MGR_TIMER_PERIOD_REGISTER + 1 - tstart); }
+    
+    if (cvmc_vout_cycles.cycles > cvmc_vout_cycles.maximum)
+    { cvmc_vout_cycles.maximum = cvmc_vout_cycles.cycles; }
+    cvmc_vout_cycles.count++;
+    SEQLOCK_WRITE_END(cvmc_vout_cycles_lock);
+#endif
+    
+    TRACE_ISR(TRACE_EVT_ISR_EXIT, TRACE_ISR_CVMC_VOUT);
+    
+	return;
+
+}
+/***************************************************************************
+End of ISR
+***************************************************************************/
+
+// EOF
@@ -0,0 +1,72 @@
+/*LICENSE ********************************************************************
+ * Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ * ***************************************************************************/
+/*
+ * File:   isr_ccp.c
+ * Author: M91406
+ *
+ * Created on October 14, 2026, 02:00 PM
+ **************************************************************************** */
+
+
+// Device header file
+#include <xc.h>
+#include <stdint.h>
+
+#include "apl/apl.h"
+#include "hal/hal.h"
+#include "mcal/mcal.h"
+#include "sfl/sfl.h"
+
+#include "apl/resources/fdrv_FunctionLED.h"
+
+/***************************************************************************
+ISR: 		CCP2Interrupt of the function LED output compare
+Description:	Only enabled when on-time and off-time of the recent LED 
+                pattern differ. The output has just changed its level on 
+                the restart of the SCCP timer. The timer period of the 
+                interval, which has just started, is loaded from the new 
+                output level. 
+***************************************************************************/
+#if (FUNCTION_LED_HARDWARE == 1)
+void __attribute__((__interrupt__,no_auto_psv)) _CCP2Interrupt() 
+{	
+    uint32_t period;
+    
+    if (FUNCTION_LED_RD == LED_ON)
+    { period = fled_hardware.on_counts; }
+    else
+    { period = fled_hardware.off_counts; }
+    
+    CCP2PRL = (uint16_t)(period & 0xFFFF);
+    CCP2PRH = (uint16_t)(period >> 16);
+
+	_CCP2IF = 0;	// Clear interrupt flag bit
+	
+	return;
+
+}
+#endif
+/***************************************************************************
+End of ISR
+***************************************************************************/
+
+// EOF
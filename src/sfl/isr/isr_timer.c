@@ -42,14 +42,26 @@
 #include "mcal/mcal.h"
 #include "sfl/sfl.h"
 
+#include "_root/config/task_manager_config.h"
+#include "_root/generic/task_manager.h"
+#include "_root/generic/task_realtime.h"
+#include "_root/generic/task_trace.h"
+
 /***************************************************************************
 ISR: 		T1Interrupt for Timer #1
-Description:	
+Description:	When the task manager is running in interrupt mode, this 
+                interrupt releases the next scheduler time slot
 ***************************************************************************/
 #if defined (T1CON)
-void __attribute__((__interrupt__,no_auto_psv)) _T1Interrupt() 
+void __attribute__((__interrupt__,IRQ_CONTEXT_SAVE_SCHEDULER no_auto_psv)) _T1Interrupt() 
 {	
 
+#if (TASK_MGR_SCHEDULER_MODE == TASK_MGR_MODE_INTERRUPT) && (TASK_MGR_TIMER_INDEX == 1)
+    TRACE_ISR(TRACE_EVT_ISR_ENTRY, TRACE_ISR_SCHEDULER);
+    task_mgr.tick_ctrl.counter++; // Release next task manager time slot
+    TRACE_ISR(TRACE_EVT_ISR_EXIT, TRACE_ISR_SCHEDULER);
+#endif
+
 	IFS0bits.T1IF = 0;	// Clear interrupt flag bit
 	
 	return;
@@ -65,10 +77,20 @@ ISR: 		T2Interrupt for Timer #2
 Description:	
 ***************************************************************************/
 #if defined (T2CON)
+#if (USE_TASK_MANAGER_RT_TIER == 1) && (RT_TIER_TIMER_INDEX == 2)
+void __attribute__((__interrupt__,IRQ_CONTEXT_SAVE_RT_TIER auto_psv)) _T2Interrupt() // real-time task table is read from PSV
+#else
 void __attribute__((__interrupt__,no_auto_psv)) _T2Interrupt() 
+#endif
 {	
 
 	IFS0bits.T2IF = 0;	// Clear interrupt flag bit
+
+#if (USE_TASK_MANAGER_RT_TIER == 1) && (RT_TIER_TIMER_INDEX == 2)
+    TRACE_ISR(TRACE_EVT_ISR_ENTRY, TRACE_ISR_RT_TIER);
+    exec_TaskRealTimeTier(); // Execute real-time task tier
+    TRACE_ISR(TRACE_EVT_ISR_EXIT, TRACE_ISR_RT_TIER);
+#endif
 	
 	return;
 
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Boot profile report
+
+Converts a memory dump of the boot profile record 'boot_profile' (see task_bootprof.h)
+into a list of startup steps and a critical path summary. The dump has to cover the
+complete BOOT_PROFILE_t data structure, starting at the address of 'boot_profile':
+
+    word 0:      complete    1 = the startup operation modes have been left
+    word 1:      count       number of step records in use
+    word 2:      size        number of step records (BOOT_PROF_SIZE)
+    word 3:      final_mode  operation mode index of the first mode after startup
+    word 4-5:    total       time from reset until the first mode after startup in [us]
+    word 6-11:   mode_start  time when BOOT, DEVICE_STARTUP and SYSTEM_STARTUP were entered
+    word 12...:  step records of eight words each
+                 (id, calls, start [2 words], end [2 words], busy [2 words])
+
+All times are 32-bit values in [us] since reset, low word first. Supported dump
+formats are raw little-endian binary files and text files holding 16-bit hexadecimal
+words (e.g. exported from the memory view of the debugger). Tokens ending with ':'
+are treated as address columns and are ignored.
+
+The critical path is given by the end times of all steps in chronological order:
+every step contributes the time from the end of its predecessor until its own end,
+including scheduler idle time spent waiting for its time slot. The contributions
+add up to the total boot time.
+
+Usage:
+    boot_report.py dump.bin [--tasks h/apl/config/tasks.h] [--top 5]
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+HEADER_WORDS = 12
+STEP_WORDS = 8
+
+# Step IDs of BOOT_STEP_e (task_bootprof.h)
+BOOT_STEPS = {0xFF00: "warm_boot_Check()", 0xFF01: "Device_Reset()",
+              0xFF02: "ExecuteUserStartupCode()", 0xFF03: "CLOCK_Initialize()",
+              0xFF04: "OS_Initialize()"}
+
+# Operation mode indices of OP_MODE_INDEX_e (task_manager.h)
+OP_MODES = ["BOOT", "DEVICE_STARTUP", "SYSTEM_STARTUP", "IDLE", "NORMAL",
+            "USER_1", "USER_2", "USER_3", "USER_4", "USER_5", "USER_6",
+            "USER_7", "USER_8", "USER_9", "FAULT", "STANDBY"]
+
+
+def read_words(path):
+    """Reads a dump file and returns its contents as list of 16-bit words"""
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        text = data.decode("ascii")
+        tokens = [t for t in text.split() if not t.endswith(":")]
+        return [int(t, 16) & 0xFFFF for t in tokens]
+    except (UnicodeDecodeError, ValueError):
+        if len(data) & 1:
+            data = data[:-1]
+        return list(struct.unpack("<%dH" % (len(data) >> 1), data))
+
+
+def read_task_names(path):
+    """Extracts the task IDs in order of registration from TASK_REGISTRY in tasks.h"""
+    names = []
+    inside = False
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            if not inside:
+                inside = line.startswith("#define TASK_REGISTRY(TASK)")
+                continue
+            row = re.match(r"\s*TASK\(\s*(\w+)\s*,", line)
+            if row:
+                names.append(row.group(1))
+            if not line.rstrip().endswith("\\"):
+                break
+    return names
+
+
+def dword(words, index):
+    """Returns the 32-bit value stored low word first at the given word index"""
+    return words[index] | (words[index + 1] << 16)
+
+
+def profile(words):
+    """Returns the header fields and the list of recorded steps"""
+    if len(words) < HEADER_WORDS:
+        sys.exit("dump too short: boot profile header missing")
+    complete, count, size, final_mode = words[0:4]
+    if (size == 0) or (count > size):
+        sys.exit("invalid boot profile status (count = %d, size = %d)" % (count, size))
+    if len(words) < HEADER_WORDS + STEP_WORDS * count:
+        sys.exit("dump too short: %d step records expected" % count)
+    header = {"complete": complete, "final_mode": final_mode, "total": dword(words, 4),
+              "mode_start": [dword(words, 6 + 2 * i) for i in range(3)]}
+    steps = []
+    for i in range(count):
+        base = HEADER_WORDS + STEP_WORDS * i
+        step_id, calls = words[base:base + 2]
+        if calls == 0:
+            continue  # step has not been executed (e.g. disabled by build option)
+        steps.append({"id": step_id, "calls": calls, "start": dword(words, base + 2),
+                      "end": dword(words, base + 4), "busy": dword(words, base + 6)})
+    return header, steps
+
+
+def mode_name(index):
+    """Returns the name of an operation mode index"""
+    return "OP_MODE_" + (OP_MODES[index] if index < len(OP_MODES) else "#%d" % index)
+
+
+def describe(step_id, tasks):
+    """Returns a readable name of a step ID"""
+    if step_id in BOOT_STEPS:
+        return BOOT_STEPS[step_id]
+    mode, task = step_id >> 8, step_id & 0xFF
+    name = tasks[task] if task < len(tasks) else "task #%d" % task
+    return "%s: %s" % (mode_name(mode)[8:], name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes a dump of the boot profile into a startup report")
+    parser.add_argument("dump", help="memory dump of the data structure 'boot_profile'")
+    parser.add_argument("--tasks", help="tasks.h used to translate task IDs into names")
+    parser.add_argument("--top", type=int, default=5, help="number of largest critical path contributors listed")
+    args = parser.parse_args()
+
+    tasks = read_task_names(args.tasks) if args.tasks else []
+    header, steps = profile(read_words(args.dump))
+    steps.sort(key=lambda s: (s["end"], s["start"]))
+
+    if header["complete"]:
+        print("boot completed after %d us, first operation mode %s"
+              % (header["total"], mode_name(header["final_mode"])))
+    else:
+        print("boot INCOMPLETE (interrupted by reset or still in progress)")
+    for i, name in enumerate(OP_MODES[0:3]):
+        print("  OP_MODE_%-16s entered at %10d us" % (name, header["mode_start"][i]))
+    print()
+
+    print("%10s %10s %10s %6s  %s" % ("start [us]", "busy [us]", "end [us]", "calls", "step"))
+    for s in steps:
+        print("%10d %10d %10d %6d  %s" % (s["start"], s["busy"], s["end"], s["calls"], describe(s["id"], tasks)))
+    print()
+
+    # Critical path contributions (time since the end of the previous step)
+    total = header["total"] if header["complete"] else (steps[-1]["end"] if steps else 0)
+    previous = 0
+    path = []
+    for s in steps:
+        path.append((s["end"] - previous, s))
+        previous = s["end"]
+    if header["complete"] and (total > previous):
+        path.append((total - previous, None))  # wait for the operation mode switch-over
+
+    print("critical path: %d us" % total)
+    print("%10s %7s  %s" % ("time [us]", "share", "step"))
+    for time, s in sorted(path, key=lambda p: p[0], reverse=True)[0:args.top]:
+        share = (100.0 * time / total) if total else 0.0
+        name = describe(s["id"], tasks) if s is not None else "operation mode switch-over"
+        print("%10d %6.1f%%  %s" % (time, share, name))
+
+
+if __name__ == "__main__":
+    main()
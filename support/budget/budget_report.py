@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""Memory and cycle budget report
+
+Combines the linker map file of a build configuration with the benchmark results
+measured on target into a per-module budget report and fails (exit code 1) if one
+of the budgets configured for this build configuration has been exceeded.
+
+Memory usage is taken from the XC16 linker map file. The memory usage report at the
+top of the map file ('report-memory-usage' option) assigns each output section to
+program or data memory. The input sections listed in the section 'Linker script and
+memory map' are assigned to the object file they have been taken from. Object files
+are assigned to modules by the module definitions of the budget file (first match
+wins). Object files which are not covered by any module definition (e.g. run-time
+libraries) and sections without object file (e.g. stack, heap, data initialization
+templates) are summarized as '(unassigned)'. Program memory sizes are reported in
+bytes (three bytes per instruction word = 1.5 bytes per PC unit), data memory in
+bytes.
+
+Cycle counts are taken from memory dumps of the following data structures:
+
+    --bench:        'bench_results[]' (see task_benchmark.h)
+                    six words per benchmark case in order of BENCH_CASE_REGISTRY
+                    (minimum, maximum, average, samples, sum [2 words])
+    --cycle-meter:  a cycle meter of type NPNZ16B_CYCLE_METER_t (see npnz16b.h)
+                    given as NAME=DUMP, e.g. cvmc_vout_cycles=isr.txt
+                    (cycles, maximum, count [2 words])
+
+The worst-case value (maximum) is compared against the budget. Supported dump formats
+are raw little-endian binary files and text files holding 16-bit hexadecimal words
+(e.g. exported from the memory view of the debugger). Tokens ending with ':' are
+treated as address columns and are ignored.
+
+Budget file (INI format):
+
+    [module:<name>]         objects = <object file name patterns>
+                            cycles = <benchmark cases and cycle meters of this module>
+    [budget]                budgets common to all build configurations
+    [budget:<conf>]         budgets of one build configuration (override [budget])
+
+Budget keys are <module>.ram and <module>.flash in [bytes], total.ram and total.flash
+for the complete image and cycles.<name> in [CPU cycles]. Missing keys are reported
+but not checked. Option --suggest prints a budget section of the measured values
+plus the given margin in [%], which can be used to update the budget file when an
+increase has been reviewed and accepted.
+
+Usage:
+    budget_report.py frmwrk4.X.production.map --conf MA330048_P33CK_R30
+                     [--budgets budgets.ini] [--bench bench.txt]
+                     [--cycle-meter cvmc_vout_cycles=isr.txt] [--suggest 10]
+"""
+
+import argparse
+import configparser
+import fnmatch
+import os
+import re
+import struct
+import sys
+
+BENCH_WORDS = 6
+METER_WORDS = 4
+UNASSIGNED = "(unassigned)"
+
+# Output sections not listed in the memory usage report (name patterns)
+PROGRAM_SECTIONS = [".text*", ".const*", ".dinit", ".isr*", ".handle", ".init", "*psv*",
+                    ".ivt*", ".aivt*", ".user_init", "*.prog*", ".libc", ".libm", ".lib*"]
+DATA_SECTIONS = [".bss*", ".nbss*", ".pbss*", ".data*", ".ndata*", ".xbss*", ".ybss*",
+                 ".xdata*", ".ydata*", ".persist*", ".stack", ".heap", "*xmemory*",
+                 "*ymemory*", "*dma*", "*eds*"]
+
+
+def read_words(path):
+    """Reads a dump file and returns its contents as list of 16-bit words"""
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        text = data.decode("ascii")
+        tokens = [t for t in text.split() if not t.endswith(":")]
+        return [int(t, 16) & 0xFFFF for t in tokens]
+    except (UnicodeDecodeError, ValueError):
+        if len(data) & 1:
+            data = data[:-1]
+        return list(struct.unpack("<%dH" % (len(data) >> 1), data))
+
+
+def read_bench_cases(path):
+    """Extracts the benchmark case IDs in order of registration from BENCH_CASE_REGISTRY"""
+    names = []
+    inside = False
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            if not inside:
+                inside = line.startswith("#define BENCH_CASE_REGISTRY(CASE)")
+                continue
+            row = re.match(r"\s*CASE\(\s*(\w+)\s*,", line)
+            if row:
+                names.append(row.group(1))
+            if not line.rstrip().endswith("\\"):
+                break
+    return names
+
+
+def matches(name, patterns):
+    """Returns True if the name matches one of the (case-sensitive) patterns"""
+    return any(fnmatch.fnmatchcase(name, p) for p in patterns)
+
+
+def read_map(path):
+    """Returns the memory usage per object file {object: {"ram": bytes, "flash": bytes}}
+    and the image totals {"ram": bytes, "flash": bytes}"""
+    with open(path, encoding="latin-1") as f:
+        lines = f.read().splitlines()
+
+    # Memory usage report: output section -> memory type
+    memory = {}
+    region = None
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            break
+        if line.startswith("Program Memory"):
+            region = "flash"
+        elif line.startswith("Data Memory") or line.startswith("Dynamic Memory"):
+            region = "ram"
+        elif region:
+            row = re.match(r"(\.?[\w.]+)\s+0x[0-9a-fA-F]+\s", line)
+            if row:
+                memory[row.group(1)] = region
+
+    def memory_of(section):
+        if section in memory:
+            return memory[section]
+        if matches(section, PROGRAM_SECTIONS):
+            return "flash"
+        if matches(section, DATA_SECTIONS):
+            return "ram"
+        return None  # debug information, comments, etc.
+
+    usage = {}
+    totals = {"ram": 0, "flash": 0}
+    start = next((i for i, l in enumerate(lines) if l.startswith("Linker script and memory map")), None)
+    if start is None:
+        sys.exit("%s: section 'Linker script and memory map' not found" % path)
+
+    output = None
+    pending = None  # section name wrapped onto its own line
+    for line in lines[start + 1:]:
+        if not line.strip() or line.lstrip().startswith("*"):
+            pending = None
+            continue
+        # Output section: name in the first column (address and size may be wrapped)
+        row = re.match(r"(\.?[\w.]+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?\s*$", line)
+        if row and not line[0].isspace():
+            output = memory_of(row.group(1))
+            if output and row.group(3):
+                totals[output] += int(row.group(3), 16)
+            pending = ("output", row.group(1)) if not row.group(3) else None
+            continue
+        # Input section: ' name address size object' or wrapped after ' name'
+        row = re.match(r"\s+(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$", line)
+        if row:
+            section, size, obj = row.group(1), int(row.group(3), 16), row.group(4).strip()
+        else:
+            row = re.match(r"\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*))?$", line)
+            if row and pending:
+                kind, section = pending
+                size, obj = int(row.group(2), 16), (row.group(3) or "").strip()
+                if kind == "output":
+                    output = memory_of(section)
+                    if output:
+                        totals[output] += size
+                    pending = None
+                    continue
+            else:
+                row = re.match(r"\s(\S+)\s*$", line)
+                pending = ("input", row.group(1)) if row else None
+                continue
+        pending = None
+        kind = memory_of(section) or output
+        if not kind or not obj or (size == 0):
+            continue
+        # Library members are given as 'library.a(member.o)'
+        member = re.search(r"\(([^()]+)\)$", obj)
+        name = member.group(1) if member else os.path.basename(obj.replace("\\", "/"))
+        entry = usage.setdefault(name, {"ram": 0, "flash": 0})
+        entry[kind] += size
+
+    # Program memory sizes are given in PC units (two per instruction word of three bytes)
+    for entry in list(usage.values()) + [totals]:
+        entry["flash"] = (entry["flash"] * 3) // 2
+
+    # Totals of the memory usage report take precedence (if available)
+    for line in lines[:start]:
+        row = re.search(r"Total (program|data) memory used \(bytes\):\s+0x([0-9a-fA-F]+)", line)
+        if row:
+            totals["flash" if row.group(1) == "program" else "ram"] = int(row.group(2), 16)
+    return usage, totals
+
+
+def read_budgets(path, conf):
+    """Returns the module definitions [(name, objects, cycles)] and the budgets of a configuration"""
+    parser = configparser.ConfigParser(interpolation=None, inline_comment_prefixes=("#", ";"))
+    parser.optionxform = str  # keep the case of benchmark case IDs
+    if not parser.read(path):
+        sys.exit("budget file %s not found" % path)
+    modules = []
+    budgets = {}
+    for section in parser.sections():
+        if section.startswith("module:"):
+            modules.append((section[7:], parser.get(section, "objects", fallback="").split(),
+                            parser.get(section, "cycles", fallback="").split()))
+    for section in ("budget", "budget:" + conf):
+        if parser.has_section(section):
+            for key, value in parser.items(section):
+                budgets[key] = int(value, 0)
+    if not parser.has_section("budget:" + conf):
+        print("warning: no budgets defined for build configuration %s" % conf, file=sys.stderr)
+    return modules, budgets
+
+
+def read_cycles(args):
+    """Returns the measured cycle counts {name: (maximum, average or None, samples)}"""
+    cycles = {}
+    if args.bench:
+        names = read_bench_cases(args.bench_cases)
+        words = read_words(args.bench)
+        if len(words) < BENCH_WORDS * len(names):
+            sys.exit("dump too short: %d benchmark results expected" % len(names))
+        for i, name in enumerate(names):
+            minimum, maximum, average, samples = words[BENCH_WORDS * i:BENCH_WORDS * i + 4]
+            if samples:
+                cycles[name] = (maximum, average, samples)
+    for meter in args.cycle_meter:
+        name, _, path = meter.partition("=")
+        words = read_words(path)
+        if (not path) or (len(words) < METER_WORDS):
+            sys.exit("invalid cycle meter %s (NAME=DUMP expected)" % meter)
+        cycles[name] = (words[1], None, words[2] | (words[3] << 16))
+    return cycles
+
+
+def check(value, budget):
+    """Returns the budget column and a flag indicating an overrun"""
+    if budget is None:
+        return "%8s %6s" % ("-", ""), False
+    share = (100.0 * value / budget) if budget else float("inf")
+    return "%8d %5.0f%%" % (budget, share), value > budget
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Reports RAM, flash and cycle usage per module against budgets")
+    parser.add_argument("map", help="linker map file of the build configuration")
+    parser.add_argument("--conf", required=True, help="build configuration, e.g. MA330048_P33CK_R30")
+    parser.add_argument("--budgets", default=os.path.join(here, "budgets.ini"), help="budget file")
+    parser.add_argument("--bench", help="memory dump of the benchmark results 'bench_results[]'")
+    parser.add_argument("--bench-cases", default=os.path.join(here, "..", "..", "h", "_root", "generic", "task_benchmark.h"),
+                        help="task_benchmark.h used to translate benchmark case IDs into names")
+    parser.add_argument("--cycle-meter", action="append", default=[], metavar="NAME=DUMP",
+                        help="memory dump of a control loop cycle meter (may be given repeatedly)")
+    parser.add_argument("--suggest", type=int, metavar="MARGIN", help="print budgets of the measured values plus MARGIN %%")
+    args = parser.parse_args()
+
+    modules, budgets = read_budgets(args.budgets, args.conf)
+    usage, totals = read_map(args.map)
+    cycles = read_cycles(args)
+
+    # Memory usage per module
+    report = {name: {"ram": 0, "flash": 0, "objects": []} for name, _, _ in modules}
+    report[UNASSIGNED] = {"ram": 0, "flash": 0, "objects": []}
+    for obj, entry in sorted(usage.items()):
+        name = next((m for m, patterns, _ in modules if matches(obj, patterns)), UNASSIGNED)
+        report[name]["ram"] += entry["ram"]
+        report[name]["flash"] += entry["flash"]
+        report[name]["objects"].append(obj)
+    report[UNASSIGNED]["ram"] += max(0, totals["ram"] - sum(e["ram"] for e in usage.values()))
+    report[UNASSIGNED]["flash"] += max(0, totals["flash"] - sum(e["flash"] for e in usage.values()))
+
+    overruns = []
+    print("memory budget report of %s (%s)" % (args.conf, os.path.basename(args.map)))
+    print()
+    print("%-16s %8s %8s %6s  %8s %8s %6s" % ("module", "RAM [B]", "budget", "", "flash [B]", "budget", ""))
+    rows = [(name, report[name]) for name, _, _ in modules] + [(UNASSIGNED, report[UNASSIGNED]), ("total", totals)]
+    for name, entry in rows:
+        ram, ram_over = check(entry["ram"], budgets.get(name + ".ram"))
+        flash, flash_over = check(entry["flash"], budgets.get(name + ".flash"))
+        mark = " <<< OVER BUDGET" if (ram_over or flash_over) else ""
+        print("%-16s %8d %s  %8d %s%s" % (name, entry["ram"], ram, entry["flash"], flash, mark))
+        overruns += [(name + ".ram", entry["ram"])] if ram_over else []
+        overruns += [(name + ".flash", entry["flash"])] if flash_over else []
+    print()
+
+    # Worst-case cycles per module
+    if cycles:
+        print("%-16s %-32s %8s %8s %8s %6s" % ("module", "measurement", "average", "maximum", "budget", ""))
+        listed = set()
+        for name, _, measurements in modules + [(UNASSIGNED, [], [c for c in cycles])]:
+            for measurement in measurements:
+                if (measurement not in cycles) or (measurement in listed):
+                    continue
+                listed.add(measurement)
+                maximum, average, samples = cycles[measurement]
+                budget, over = check(maximum, budgets.get("cycles." + measurement))
+                print("%-16s %-32s %8s %8d %s%s" % (name, measurement, "-" if average is None else average,
+                                                  maximum, budget, " <<< OVER BUDGET" if over else ""))
+                overruns += [("cycles." + measurement, maximum)] if over else []
+        missing = [m for _, _, ms in modules for m in ms if m not in cycles]
+        if missing:
+            print("not measured: %s" % ", ".join(missing))
+        print()
+
+    if args.suggest is not None:
+        print("[budget:%s]" % args.conf)
+        for name, entry in rows:
+            if name != UNASSIGNED:
+                print("%s.ram = %d" % (name, entry["ram"] * (100 + args.suggest) // 100))
+                print("%s.flash = %d" % (name, entry["flash"] * (100 + args.suggest) // 100))
+        for measurement, (maximum, _, _) in cycles.items():
+            print("cycles.%s = %d" % (measurement, maximum * (100 + args.suggest) // 100))
+        print()
+
+    if overruns:
+        for key, value in overruns:
+            print("budget exceeded: %s = %d (budget %d)" % (key, value, budgets[key]), file=sys.stderr)
+        sys.exit(1)
+    print("all budgets met")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Trace buffer decoder
+
+Converts a memory dump of the trace ring buffer 'trace' (see task_trace.h) into a
+timeline. The dump has to cover the complete TRACE_BUFFER_t data structure,
+starting at the address of 'trace':
+
+    word 0:     head    index of the next record to be written
+    word 1:     count   number of records held in the ring buffer
+    word 2:     frozen  1 = recording has been stopped by a trap
+    word 3:     size    number of records of the ring buffer (TRACE_BUFFER_SIZE)
+    word 4...:  records of two words each (timestamp, event ID | argument << 8)
+
+Supported dump formats are raw little-endian binary files and text files holding
+16-bit hexadecimal words (e.g. exported from the memory view of the debugger).
+Tokens ending with ':' are treated as address columns and are ignored.
+
+Timestamps are counter values of the task manager timer. A new scheduler tick is
+counted whenever the timestamp of a record is lower than the timestamp of its
+predecessor.
+
+Usage:
+    trace_decode.py dump.bin [--fcy 100e6] [--period 10000] [--tasks h/apl/config/tasks.h]
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# Event IDs of TRACE_EVENT_e (task_trace.h)
+EVT_TASK_START = 0x01
+EVT_TASK_END = 0x02
+EVT_OP_MODE = 0x03
+EVT_FAULT_TRIP = 0x04
+EVT_FAULT_RELEASE = 0x05
+EVT_TRAP = 0x06
+EVT_ISR_ENTRY = 0x07
+EVT_ISR_EXIT = 0x08
+EVT_USER = 0x80
+
+# Operation mode indices of OP_MODE_INDEX_e (task_manager.h)
+OP_MODES = ["BOOT", "DEVICE_STARTUP", "SYSTEM_STARTUP", "IDLE", "NORMAL",
+            "USER_1", "USER_2", "USER_3", "USER_4", "USER_5", "USER_6",
+            "USER_7", "USER_8", "USER_9", "FAULT", "STANDBY"]
+
+# Trap ID bit positions of TRAP_ID_e (fdrv_TrapHandler.h), 1 = bit #0
+TRAPS = {1: "OSCILLATOR_FAIL", 2: "ADDRESS_ERROR", 3: "STACK_ERROR", 4: "MATH_ERROR",
+         5: "DMA_ERROR", 6: "SOFT_TRAP_ERROR", 7: "HARD_TRAP_ERROR", 8: "RESERVED_TRAP_ERROR",
+         9: "ALT_OSCILLATOR_FAIL", 10: "ALT_ADDRESS_ERROR", 11: "ALT_STACK_ERROR",
+         12: "ALT_MATH_ERROR", 13: "ALT_DMA_ERROR", 14: "ALT_SOFT_TRAP_ERROR",
+         15: "ALT_HARD_TRAP_ERROR"}
+
+# Interrupt service routine IDs of TRACE_ISR_e (task_trace.h)
+ISRS = {1: "SCHEDULER", 2: "RT_TIER", 3: "CVMC_VOUT"}
+
+
+def read_words(path):
+    """Reads a dump file and returns its contents as list of 16-bit words"""
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        text = data.decode("ascii")
+        tokens = [t for t in text.split() if not t.endswith(":")]
+        return [int(t, 16) & 0xFFFF for t in tokens]
+    except (UnicodeDecodeError, ValueError):
+        if len(data) & 1:
+            data = data[:-1]
+        return list(struct.unpack("<%dH" % (len(data) >> 1), data))
+
+
+def read_task_names(path):
+    """Extracts the task IDs in order of registration from TASK_REGISTRY in tasks.h"""
+    names = []
+    inside = False
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            if not inside:
+                inside = line.startswith("#define TASK_REGISTRY(TASK)")
+                continue
+            row = re.match(r"\s*TASK\(\s*(\w+)\s*,", line)
+            if row:
+                names.append(row.group(1))
+            if not line.rstrip().endswith("\\"):
+                break
+    return names
+
+
+def records(words):
+    """Returns the records held in the ring buffer in chronological order"""
+    if len(words) < 4:
+        sys.exit("dump too short: trace buffer header missing")
+    head, count, frozen, size = words[0:4]
+    if (size == 0) or (len(words) < 4 + 2 * size):
+        sys.exit("dump too short: %d records expected" % size)
+    if (head >= size) or (count > size):
+        sys.exit("invalid trace buffer status (head = %d, count = %d)" % (head, count))
+    first = (head - count) % size
+    result = []
+    for i in range(count):
+        index = (first + i) % size
+        timestamp = words[4 + 2 * index]
+        value = words[5 + 2 * index]
+        result.append((timestamp, value & 0xFF, value >> 8))
+    return result, frozen
+
+
+def describe(event, arg, tasks):
+    """Returns a readable description of a trace record"""
+    if event in (EVT_TASK_START, EVT_TASK_END):
+        if event == EVT_TASK_END:
+            return "task end       retval = 0x%02X" % arg
+        name = tasks[arg] if arg < len(tasks) else "task #%d" % arg
+        return "task start     %s" % name
+    if event == EVT_OP_MODE:
+        name = OP_MODES[arg] if arg < len(OP_MODES) else "mode #%d" % arg
+        return "op-mode        OP_MODE_%s" % name
+    if event == EVT_FAULT_TRIP:
+        return "fault trip     fault object ID %d" % arg
+    if event == EVT_FAULT_RELEASE:
+        return "fault release  fault object ID %d" % arg
+    if event == EVT_TRAP:
+        return "TRAP           TRAP_%s" % TRAPS.get(arg, "#%d" % arg)
+    if event in (EVT_ISR_ENTRY, EVT_ISR_EXIT):
+        kind = "isr entry" if event == EVT_ISR_ENTRY else "isr exit"
+        return "%-14s %s" % (kind, ISRS.get(arg, "ISR #%d" % arg))
+    if event >= EVT_USER:
+        return "user #%-3d      arg = 0x%02X" % (event - EVT_USER, arg)
+    return "unknown 0x%02X   arg = 0x%02X" % (event, arg)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes a dump of the trace ring buffer into a timeline")
+    parser.add_argument("dump", help="memory dump of the data structure 'trace'")
+    parser.add_argument("--fcy", type=float, default=100e6, help="timer clock (instruction clock) in [Hz]")
+    parser.add_argument("--period", type=int, default=10000, help="timer counts per scheduler tick (TASK_MGR_PERIOD)")
+    parser.add_argument("--tasks", help="tasks.h used to translate task IDs into names")
+    args = parser.parse_args()
+
+    tasks = read_task_names(args.tasks) if args.tasks else []
+    trace, frozen = records(read_words(args.dump))
+
+    print("%d records%s" % (len(trace), " (frozen by trap)" if frozen else ""))
+    print("%6s %12s %8s  %s" % ("tick", "time [us]", "delta", "event"))
+
+    tick = 0
+    previous = None
+    task_start = None
+    depth = 0
+    for timestamp, event, arg in trace:
+        if (previous is not None) and (timestamp < previous[0]):
+            tick += 1
+        counts = tick * args.period + timestamp
+        delta = (counts - previous[1]) if previous is not None else 0
+        previous = (timestamp, counts)
+
+        if event == EVT_ISR_EXIT:
+            depth = max(depth - 1, 0)
+        text = "  " * depth + describe(event, arg, tasks)
+        if event == EVT_ISR_ENTRY:
+            depth += 1
+        if event == EVT_TASK_START:
+            task_start = counts
+        elif (event == EVT_TASK_END) and (task_start is not None):
+            text += "  (%.2f us)" % ((counts - task_start) * 1e6 / args.fcy)
+            task_start = None
+
+        print("%6d %12.2f %8d  %s" % (tick, counts * 1e6 / args.fcy, delta, text))
+
+
+if __name__ == "__main__":
+    main()